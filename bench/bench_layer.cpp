@@ -0,0 +1,50 @@
+// Synthetic layer for measure_build.py, which times compiling it and reports
+// what ends up in the shared object.
+//
+// Build with VKROOTS_BENCH_OVERRIDES set to 0, 5, 50 or -1 for every function.
+// Device creation always patches a few structs into the chain, like most real
+// layers do, so VKROOTS_USE_CONSTEXPR_FUNC has something to change.
+
+#include "vkroots.h"
+
+#include "bench_overrides.h"
+
+namespace VkBench {
+
+  // With no instance overrides of its own, the set is just NoOverrides.
+  // Deriving from that would mark the layer as not overriding anything, so
+  // CreateDevice would never be hooked.
+  struct NoInstanceOverrides {};
+  using LayerInstanceBase = std::conditional_t<std::is_same<InstanceOverrides, vkroots::NoOverrides>::value, NoInstanceOverrides, InstanceOverrides>;
+
+  class LayerInstanceOverrides : public LayerInstanceBase {
+  public:
+    static VkResult CreateDevice(
+      const vkroots::VkInstanceDispatch* pDispatch,
+            VkPhysicalDevice             physicalDevice,
+      const VkDeviceCreateInfo*          pCreateInfo,
+      const VkAllocationCallbacks*       pAllocator,
+            VkDevice*                    pDevice) {
+      vkroots::ChainPatcher<VkPhysicalDeviceVulkan11Features> vulkan11Patcher(pCreateInfo, [](VkPhysicalDeviceVulkan11Features* pFeatures) {
+        pFeatures->multiview = VK_TRUE;
+        return true;
+      });
+      vkroots::ChainPatcher<VkPhysicalDeviceVulkan12Features> vulkan12Patcher(pCreateInfo, [](VkPhysicalDeviceVulkan12Features* pFeatures) {
+        pFeatures->timelineSemaphore = VK_TRUE;
+        return true;
+      });
+      vkroots::ChainPatcher<VkPhysicalDeviceVulkan13Features> vulkan13Patcher(pCreateInfo, [](VkPhysicalDeviceVulkan13Features* pFeatures) {
+        pFeatures->dynamicRendering = VK_TRUE;
+        return true;
+      });
+      return pDispatch->CreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+    }
+  };
+
+  static_assert(!std::is_base_of<vkroots::NoOverrides, LayerInstanceOverrides>::value);
+
+}
+
+VKROOTS_DEFINE_LAYER_INTERFACES(VkBench::LayerInstanceOverrides,
+                                VkBench::PhysicalDeviceOverrides,
+                                VkBench::DeviceOverrides);
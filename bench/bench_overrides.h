@@ -0,0 +1,119 @@
+// Override sets shared by the benchmarks, picked with VKROOTS_BENCH_OVERRIDES:
+// 0, 5, 50 or -1 for every function (from bench_all_overrides.h).
+
+#pragma once
+
+#ifndef VKROOTS_BENCH_OVERRIDES
+#define VKROOTS_BENCH_OVERRIDES 0
+#endif
+
+#define VKROOTS_BENCH_FORWARD(name)                                   \
+  static constexpr auto name = [](const auto* pDispatch, auto... args) { \
+    return pDispatch->name(args...);                                  \
+  };
+
+#if VKROOTS_BENCH_OVERRIDES < 0
+#include "bench_all_overrides.h"
+#endif
+
+namespace VkBench {
+
+#if VKROOTS_BENCH_OVERRIDES == 0
+  using InstanceOverrides       = vkroots::NoOverrides;
+  using PhysicalDeviceOverrides = vkroots::NoOverrides;
+  using DeviceOverrides         = vkroots::NoOverrides;
+#elif VKROOTS_BENCH_OVERRIDES == 5
+  using InstanceOverrides       = vkroots::NoOverrides;
+  using PhysicalDeviceOverrides = vkroots::NoOverrides;
+
+  class DeviceOverrides {
+  public:
+    VKROOTS_BENCH_FORWARD(CreateImage)
+    VKROOTS_BENCH_FORWARD(CreateSwapchainKHR)
+    VKROOTS_BENCH_FORWARD(DestroySwapchainKHR)
+    VKROOTS_BENCH_FORWARD(QueuePresentKHR)
+    VKROOTS_BENCH_FORWARD(QueueSubmit)
+  };
+#elif VKROOTS_BENCH_OVERRIDES == 50
+  class InstanceOverrides {
+  public:
+    VKROOTS_BENCH_FORWARD(EnumerateDeviceExtensionProperties)
+    VKROOTS_BENCH_FORWARD(GetPhysicalDeviceFeatures2)
+    VKROOTS_BENCH_FORWARD(GetPhysicalDeviceProperties)
+    VKROOTS_BENCH_FORWARD(GetPhysicalDeviceSurfaceCapabilitiesKHR)
+    VKROOTS_BENCH_FORWARD(GetPhysicalDeviceSurfaceFormatsKHR)
+  };
+
+  using PhysicalDeviceOverrides = vkroots::NoOverrides;
+
+  class DeviceOverrides {
+  public:
+    VKROOTS_BENCH_FORWARD(AcquireNextImageKHR)
+    VKROOTS_BENCH_FORWARD(AllocateCommandBuffers)
+    VKROOTS_BENCH_FORWARD(AllocateMemory)
+    VKROOTS_BENCH_FORWARD(BeginCommandBuffer)
+    VKROOTS_BENCH_FORWARD(BindBufferMemory)
+    VKROOTS_BENCH_FORWARD(BindImageMemory)
+    VKROOTS_BENCH_FORWARD(CmdBeginRenderPass)
+    VKROOTS_BENCH_FORWARD(CmdBeginRendering)
+    VKROOTS_BENCH_FORWARD(CmdBindDescriptorSets)
+    VKROOTS_BENCH_FORWARD(CmdBindPipeline)
+    VKROOTS_BENCH_FORWARD(CmdBindVertexBuffers)
+    VKROOTS_BENCH_FORWARD(CmdBlitImage)
+    VKROOTS_BENCH_FORWARD(CmdCopyBufferToImage)
+    VKROOTS_BENCH_FORWARD(CmdDispatch)
+    VKROOTS_BENCH_FORWARD(CmdDraw)
+    VKROOTS_BENCH_FORWARD(CmdDrawIndexed)
+    VKROOTS_BENCH_FORWARD(CmdEndRenderPass)
+    VKROOTS_BENCH_FORWARD(CmdEndRendering)
+    VKROOTS_BENCH_FORWARD(CmdPipelineBarrier)
+    VKROOTS_BENCH_FORWARD(CmdPipelineBarrier2)
+    VKROOTS_BENCH_FORWARD(CmdPushConstants)
+    VKROOTS_BENCH_FORWARD(CmdSetScissor)
+    VKROOTS_BENCH_FORWARD(CmdSetViewport)
+    VKROOTS_BENCH_FORWARD(CreateBuffer)
+    VKROOTS_BENCH_FORWARD(CreateCommandPool)
+    VKROOTS_BENCH_FORWARD(CreateComputePipelines)
+    VKROOTS_BENCH_FORWARD(CreateDescriptorSetLayout)
+    VKROOTS_BENCH_FORWARD(CreateFence)
+    VKROOTS_BENCH_FORWARD(CreateFramebuffer)
+    VKROOTS_BENCH_FORWARD(CreateGraphicsPipelines)
+    VKROOTS_BENCH_FORWARD(CreateImage)
+    VKROOTS_BENCH_FORWARD(CreateImageView)
+    VKROOTS_BENCH_FORWARD(CreatePipelineLayout)
+    VKROOTS_BENCH_FORWARD(CreateRenderPass)
+    VKROOTS_BENCH_FORWARD(CreateSampler)
+    VKROOTS_BENCH_FORWARD(CreateSemaphore)
+    VKROOTS_BENCH_FORWARD(CreateShaderModule)
+    VKROOTS_BENCH_FORWARD(CreateSwapchainKHR)
+    VKROOTS_BENCH_FORWARD(DestroyCommandPool)
+    VKROOTS_BENCH_FORWARD(DestroyImage)
+    VKROOTS_BENCH_FORWARD(DestroySwapchainKHR)
+    VKROOTS_BENCH_FORWARD(EndCommandBuffer)
+    VKROOTS_BENCH_FORWARD(FreeCommandBuffers)
+    VKROOTS_BENCH_FORWARD(GetSwapchainImagesKHR)
+    VKROOTS_BENCH_FORWARD(QueuePresentKHR)
+    VKROOTS_BENCH_FORWARD(QueueSubmit)
+    VKROOTS_BENCH_FORWARD(QueueSubmit2)
+    VKROOTS_BENCH_FORWARD(ResetCommandPool)
+    VKROOTS_BENCH_FORWARD(ResetFences)
+    VKROOTS_BENCH_FORWARD(WaitForFences)
+  };
+#else
+  class InstanceOverrides {
+  public:
+    VKROOTS_BENCH_ALL_INSTANCE_OVERRIDES
+  };
+
+  class PhysicalDeviceOverrides {
+  public:
+    VKROOTS_BENCH_ALL_PHYSICAL_DEVICE_OVERRIDES
+  };
+
+  class DeviceOverrides {
+  public:
+    VKROOTS_BENCH_ALL_DEVICE_OVERRIDES
+  };
+#endif
+
+}
@@ -0,0 +1,131 @@
+// Measures how long the generated GetInstanceProcAddr/GetDeviceProcAddr take
+// per lookup, for the whole registry (hooked and forwarded names) and for
+// names nothing knows about.
+//
+// Build with VKROOTS_BENCH_OVERRIDES set to 0, 5, 50 or -1 for every function.
+
+#include "vkroots.h"
+
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench_overrides.h"
+
+namespace VkBench {
+
+  // Stand-in for the next layer, hands back the same thing for everything.
+  namespace next {
+    static void VKAPI_CALL Stub() {}
+
+    static VkResult VKAPI_CALL EnumeratePhysicalDevices(VkInstance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice*) {
+      *pPhysicalDeviceCount = 0;
+      return VK_SUCCESS;
+    }
+
+    static PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance, const char* pName) {
+      if (std::string_view(pName) == "vkEnumeratePhysicalDevices")
+        return (PFN_vkVoidFunction) &EnumeratePhysicalDevices;
+      return (PFN_vkVoidFunction) &Stub;
+    }
+
+    static PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance, const char*) {
+      return (PFN_vkVoidFunction) &Stub;
+    }
+
+    static PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice, const char*) {
+      return (PFN_vkVoidFunction) &Stub;
+    }
+  }
+
+  // Dispatchable handles start with the loader's dispatch pointer.
+  struct DispatchableObject {
+    void* pLoaderData;
+  };
+
+  static void* s_instanceLoaderData = nullptr;
+  static void* s_deviceLoaderData   = nullptr;
+  static DispatchableObject s_instance = { &s_instanceLoaderData };
+  static DispatchableObject s_device   = { &s_deviceLoaderData };
+
+  template <typename ProcAddrFunc>
+  static void Measure(const char* pLabel, ProcAddrFunc procAddrFunc, const std::vector<const char*>& names) {
+    constexpr size_t TargetLookups = 4'000'000;
+    const size_t rounds = TargetLookups / names.size() + 1;
+
+    uint32_t hooked = 0;
+    for (const char* name : names)
+      hooked += procAddrFunc(name) != (PFN_vkVoidFunction) &next::Stub ? 1 : 0;
+
+    uintptr_t sink = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < rounds; i++) {
+      for (const char* name : names)
+        sink ^= reinterpret_cast<uintptr_t>(procAddrFunc(name));
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count() / double(rounds * names.size());
+    printf("%-36s %4u/%-4zu hooked %8.2f ns/lookup (%zx)\n", pLabel, hooked, names.size(), ns, size_t(sink & 0xf));
+  }
+
+  template <size_t Count>
+  static std::vector<const char*> RegistryNames(const char* const (&names)[Count]) {
+    return std::vector<const char*>(std::begin(names), std::end(names));
+  }
+
+  // Same shape as real names but not in any registry, so they always miss.
+  static std::vector<const char*> UnknownNames(const std::vector<const char*>& names, std::deque<std::string>& storage) {
+    std::vector<const char*> unknown;
+    for (const char* name : names)
+      unknown.push_back(storage.emplace_back(std::string(name) + "NOTREAL").c_str());
+    return unknown;
+  }
+
+}
+
+int main() {
+  using namespace VkBench;
+
+  VkInstance instance = reinterpret_cast<VkInstance>(&s_instance);
+  VkDevice device = reinterpret_cast<VkDevice>(&s_device);
+
+  VkDeviceCreateInfo deviceCreateInfo = {};
+  deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+  vkroots::tables::CreateDispatchTable(&next::GetInstanceProcAddr, &next::GetPhysicalDeviceProcAddr, instance);
+  vkroots::tables::CreateDispatchTable(&deviceCreateInfo, &next::GetDeviceProcAddr, VK_NULL_HANDLE, device);
+
+  // These are what NegotiateLoaderLayerInterfaceVersion hands to the loader.
+  auto getInstanceProcAddr = [instance](const char* pName) {
+    return vkroots::GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(instance, pName);
+  };
+  auto getDeviceProcAddr = [device](const char* pName) {
+    return vkroots::GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(device, pName);
+  };
+
+  std::vector<const char*> instanceNames = RegistryNames(vkroots::procaddr::InstanceFuncNames);
+  for (const char* name : RegistryNames(vkroots::procaddr::PhysicalDeviceFuncNames))
+    instanceNames.push_back(name);
+  const std::vector<const char*> deviceNames = RegistryNames(vkroots::procaddr::DeviceFuncNames);
+
+  std::deque<std::string> storage;
+  const std::vector<const char*> unknownInstanceNames = UnknownNames(instanceNames, storage);
+  const std::vector<const char*> unknownDeviceNames   = UnknownNames(deviceNames, storage);
+
+#if VKROOTS_BENCH_OVERRIDES < 0
+  printf("vkroots proc address lookup, all functions overridden\n");
+#else
+  printf("vkroots proc address lookup, %d overrides\n", VKROOTS_BENCH_OVERRIDES);
+#endif
+  Measure("GetInstanceProcAddr registry names", getInstanceProcAddr, instanceNames);
+  Measure("GetInstanceProcAddr unknown names",  getInstanceProcAddr, unknownInstanceNames);
+  Measure("GetDeviceProcAddr registry names",   getDeviceProcAddr,   deviceNames);
+  Measure("GetDeviceProcAddr unknown names",    getDeviceProcAddr,   unknownDeviceNames);
+
+  vkroots::tables::DestroyDispatchTable(device);
+  vkroots::tables::DestroyDispatchTable(instance);
+  return 0;
+}
@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+
+# Generates override classes that forward every function in the dispatch
+# classes (vkroots/dispatch_classes.h)
+# straight down the chain, for benchmarking a layer that hooks everything.
+
+import re
+import sys
+
+# These have different signatures for overrides or are never overridden.
+SKIPPED = {
+    "GetInstanceProcAddr",
+    "GetDeviceProcAddr",
+    "CreateInstance",
+    "CreateDevice",
+    "DestroyInstance",
+    "DestroyDevice",
+}
+
+def dispatch_members(header, dispatch_type):
+    begin = re.search(rf"^  class (alignas\(\w+\) )?Vk{dispatch_type}Dispatch {{\n", header, re.MULTILINE).start()
+    end = header.index("  };\n", begin)
+    return [name for name in re.findall(r"^    PFN_vk\w+ (\w+);$", header[begin:end], re.MULTILINE) if name not in SKIPPED]
+
+def main():
+    with open(sys.argv[1], "r") as f:
+        header = f.read()
+    with open(sys.argv[2], "w") as f:
+        f.write("// Generated by gen_overrides.py, do not edit.\n\n")
+        for dispatch_type, macro in (("Instance", "INSTANCE"), ("PhysicalDevice", "PHYSICAL_DEVICE"), ("Device", "DEVICE")):
+            f.write(f"#define VKROOTS_BENCH_ALL_{macro}_OVERRIDES \\\n")
+            for name in dispatch_members(header, dispatch_type):
+                f.write(f"  VKROOTS_BENCH_FORWARD({name}) \\\n")
+            f.write("\n\n")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+
+# Builds a synthetic layer into a shared object and reports how long the
+# compile took, how many function template instantiations it emitted, how
+# big .text is and how many dynamic relocations the loader has to apply.
+#
+# measure_build.py <name> <source> -- <compiler> [args...]
+
+import os
+import shutil
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+def section_sizes(path):
+    with open(path, "rb") as f:
+        elf = f.read()
+    if elf[:4] != b"\x7fELF" or elf[4] != 2:
+        sys.exit(f"{path} is not a 64-bit ELF file")
+    endian = "<" if elf[5] == 1 else ">"
+    shoff, = struct.unpack_from(endian + "Q", elf, 0x28)
+    shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", elf, 0x3a)
+
+    def header(index):
+        # name, type, flags, addr, offset, size, link, info, addralign, entsize
+        return struct.unpack_from(endian + "IIQQQQIIQQ", elf, shoff + index * shentsize)
+
+    strtab_offset = header(shstrndx)[4]
+    sections = {}
+    for index in range(shnum):
+        fields = header(index)
+        name_end = elf.index(b"\0", strtab_offset + fields[0])
+        sections[elf[strtab_offset + fields[0]:name_end].decode()] = (fields[5], fields[9])
+    return sections
+
+def template_instantiations(nm, obj):
+    symbols = subprocess.run([nm, "-C", "--defined-only", obj], check=True, capture_output=True, text=True).stdout
+    count = 0
+    for line in symbols.splitlines():
+        fields = line.split(" ", 2)
+        if len(fields) == 3 and fields[1] in "tTwW" and "<" in fields[2]:
+            count += 1
+    return count
+
+def main():
+    if len(sys.argv) < 5 or sys.argv[3] != "--":
+        sys.exit(f"usage: {sys.argv[0]} <name> <source> -- <compiler> [args...]")
+    name, source, compiler = sys.argv[1], sys.argv[2], sys.argv[4:]
+    nm = shutil.which(os.environ.get("NM", "nm"))
+    if not nm:
+        sys.exit("nm not found, set NM")
+
+    with tempfile.TemporaryDirectory() as tmp:
+        obj = os.path.join(tmp, "layer.o")
+        lib = os.path.join(tmp, "layer.so")
+
+        start = time.perf_counter()
+        subprocess.run(compiler + ["-fPIC", "-c", source, "-o", obj], check=True)
+        compile_time = time.perf_counter() - start
+        subprocess.run(compiler + ["-shared", obj, "-o", lib], check=True)
+
+        # Unoptimized, so instantiations that would be inlined away still show up.
+        unoptimized = os.path.join(tmp, "layer_O0.o")
+        subprocess.run(compiler + ["-fPIC", "-O0", "-c", source, "-o", unoptimized], check=True)
+        templates = template_instantiations(nm, unoptimized)
+
+        sections = section_sizes(lib)
+        text = sections.get(".text", (0, 0))[0]
+        relocs = sum(size // entsize for section, (size, entsize) in sections.items()
+                     if section.startswith((".rela.", ".rel.")) and entsize)
+
+    print(f"{name:<28} {compile_time:7.2f} s compile {templates:6d} templates {text:9d} B text {relocs:6d} relocs")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,195 @@
+namespace vkroots {
+
+  template <class, class = void, size_t = 4 * sizeof(void*)>
+  class constexpr_function;
+  
+  template <size_t Capacity, class R, class... TArgs>
+  class constexpr_function<R(TArgs...), void, Capacity>;
+
+  template <class R, class Fn, class... TArgs> requires (!std::is_void_v<Fn>)
+  class constexpr_function<R(TArgs...), Fn>;
+
+  template <class>
+  class function_ref;
+
+  template <class R, class... TArgs>
+  class function_ref<R(TArgs...)>;
+  
+  template <class> struct function_traits {};
+
+  template <class R, class B, class... TArgs>
+  struct function_traits<R (B::*)(TArgs...) const> {
+    using type = R(TArgs...);
+  };
+
+  template <class F>
+  constexpr_function(F) -> constexpr_function<typename function_traits<decltype(&F::operator())>::type, F>;
+  
+  template <class Fn, class R>
+  concept ConceptNullFunc = (std::is_trivial_v<Fn> || std::is_fundamental_v<Fn>)
+                       && std::is_same<R,std::nullptr_t>::value;
+
+  // Consistency!
+  using PFN_vkGetPhysicalDeviceProcAddr = PFN_GetPhysicalDeviceProcAddr;
+
+  class VkInstanceDispatch;
+  class VkPhysicalDeviceDispatch;
+  class VkDeviceDispatch;
+
+  class NoOverrides { static constexpr bool IsNoOverrides = true; };
+
+  template <typename Type>
+  constexpr VkStructureType ResolveSType();
+
+  template <> constexpr VkStructureType ResolveSType<VkLayerInstanceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO; }
+  template <> constexpr VkStructureType ResolveSType<const VkLayerInstanceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO; }
+  template <> constexpr VkStructureType ResolveSType<VkLayerDeviceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO; }
+  template <> constexpr VkStructureType ResolveSType<const VkLayerDeviceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO; }
+
+  template <typename T>
+  constexpr bool TypeIsSinglePointer() {
+    // If we aren't a pointer at all, return false
+    // eg. int
+    if (!std::is_pointer<T>::value)
+      return false;
+
+    // If we are still a pointer after removing pointer, return false.
+    // eg. void**
+    if (std::is_pointer<typename std::remove_pointer<T>::type>::value)
+      return false;
+
+    // Must be a single * ptr.
+    return true;
+  }
+
+#if VKROOTS_USE_CONSTEXPR_FUNC
+  #define VKROOTS_CHAINPATCHER_FUNC function_ref
+  #define VKROOTS_CHAINPATCHER_ATTR constexpr
+#else
+  #define VKROOTS_CHAINPATCHER_FUNC std::function
+  #define VKROOTS_CHAINPATCHER_ATTR
+#endif
+
+  template <typename Type, typename AnyStruct>
+  VKROOTS_CHAINPATCHER_ATTR const Type* FindInChain(const AnyStruct* obj) {
+  	using AnyStructBase = std::remove_cvref_t<AnyStruct>;
+  	using TypeBase = std::remove_cvref_t<Type>;
+    static_assert(TypeIsSinglePointer<decltype(obj)>());
+
+    for (const VkBaseInStructure* header = std::bit_cast<VkBaseInStructure*, const AnyStructBase* const>(obj); header; header = header->pNext) {
+      if (header->sType == ResolveSType<Type>()) {
+        typedef struct {
+      			VkBaseInStructure base;
+      			char padding[sizeof(TypeBase)-sizeof(VkBaseInStructure)];
+      	} PaddedStruct_t;
+      	
+      	typedef union {
+      		PaddedStruct_t s;
+      		TypeBase tbase;
+      	} PaddedTypeBase;
+      	
+        const PaddedStruct_t* b = std::bit_cast<PaddedStruct_t*, const VkBaseInStructure*>(header);
+        
+        
+        return std::bit_cast<const TypeBase*, const PaddedStruct_t*>(b);
+      }
+    }
+    return nullptr;
+  }
+
+#undef VKROOTS_CHAINPATCHER_FUNC
+#undef VKROOTS_CHAINPATCHER_ATTR
+
+  template <typename Type, typename AnyStruct>
+  Type* FindInChainMutable(AnyStruct* obj) {
+    static_assert(TypeIsSinglePointer<decltype(obj)>());
+
+    for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(obj); header; header = header->pNext) {
+      if (header->sType == ResolveSType<Type>())
+        return reinterpret_cast<Type*>(header);
+    }
+    return nullptr;
+  }
+
+  template <typename... Types>
+  consteval bool STypesAreUnique() {
+    constexpr VkStructureType sTypes[] = { ResolveSType<Types>()... };
+    for (size_t i = 0; i < sizeof...(Types); i++) {
+      for (size_t j = i + 1; j < sizeof...(Types); j++) {
+        if (sTypes[i] == sTypes[j])
+          return false;
+      }
+    }
+    return true;
+  }
+
+  // Stores header in the slot of found whose type has its sType, unless that
+  // already has one. The comparisons are all against distinct constants, so
+  // this ends up as a switch.
+  template <typename... Types, typename Header, typename Found, size_t... Indices>
+  constexpr void MatchInChain(Header* header, Found& found, size_t& remaining, std::index_sequence<Indices...>) {
+    auto store = [&]<size_t Index>(std::integral_constant<size_t, Index>) {
+      if (!std::get<Index>(found)) {
+        std::get<Index>(found) = reinterpret_cast<std::tuple_element_t<Index, Found>>(header);
+        remaining--;
+      }
+      return true;
+    };
+    ((header->sType == ResolveSType<Types>() && store(std::integral_constant<size_t, Indices>{})) || ...);
+  }
+
+  // Looks for several structs in a single walk of the chain, returning the
+  // first of each type like FindInChain does, eg.
+  //   auto [pVulkan12, pVulkan13] = FindAllInChain<VkPhysicalDeviceVulkan12Features, VkPhysicalDeviceVulkan13Features>(pCreateInfo);
+  // It has its own name as FindInChain<Type, AnyStruct> already takes two.
+  template <typename... Types, typename AnyStruct>
+  constexpr std::tuple<const Types*...> FindAllInChain(const AnyStruct* obj) {
+    static_assert(TypeIsSinglePointer<decltype(obj)>());
+    static_assert(STypesAreUnique<Types...>(), "Each struct type can only be looked for once.");
+
+    std::tuple<const Types*...> found{};
+    size_t remaining = sizeof...(Types);
+    for (const VkBaseInStructure* header = reinterpret_cast<const VkBaseInStructure*>(obj); header && remaining; header = header->pNext)
+      MatchInChain<Types...>(header, found, remaining, std::index_sequence_for<Types...>{});
+    return found;
+  }
+
+  template <typename... Types, typename AnyStruct>
+  constexpr std::tuple<Types*...> FindAllInChainMutable(AnyStruct* obj) {
+    static_assert(TypeIsSinglePointer<decltype(obj)>());
+    static_assert(STypesAreUnique<Types...>(), "Each struct type can only be looked for once.");
+
+    std::tuple<Types*...> found{};
+    size_t remaining = sizeof...(Types);
+    for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(obj); header && remaining; header = header->pNext)
+      MatchInChain<Types...>(header, found, remaining, std::index_sequence_for<Types...>{});
+    return found;
+  }
+
+  template <typename Type, typename AnyStruct>
+  std::tuple<Type *, VkBaseOutStructure *> RemoveFromChain(AnyStruct *obj) {
+    static_assert(TypeIsSinglePointer<decltype(obj)>());
+
+    for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(obj); header; header = header->pNext) {
+      VkBaseOutStructure *pNextInChain = header->pNext;
+      if (pNextInChain && pNextInChain->sType == ResolveSType<Type>()) {
+        header->pNext = pNextInChain->pNext;
+        return std::make_tuple(reinterpret_cast<Type*>(pNextInChain), header);
+      }
+    }
+    return std::make_tuple(nullptr, nullptr);
+  }
+
+  template <typename Type, typename AnyStruct>
+  Type *AddToChain(AnyStruct *pParent, Type *pType) {
+    static_assert(TypeIsSinglePointer<decltype(pParent)>());
+    static_assert(TypeIsSinglePointer<decltype(pType)>());
+
+    void **ppParentNext = reinterpret_cast<void **>(&pParent->pNext);
+    void **ppTypeNext   = reinterpret_cast<void **>(&pType->pNext);
+
+    *ppTypeNext = std::exchange(*ppParentNext, reinterpret_cast<void *>(pType));
+    return pType;
+  }
+
+}
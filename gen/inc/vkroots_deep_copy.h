@@ -0,0 +1,352 @@
+namespace vkroots {
+
+  // Bump allocator for deep copies. Everything it hands out lives until
+  // reset() or until the arena is destroyed. Not thread-safe.
+  class Arena {
+  public:
+    explicit Arena(size_t blockSize = 64 * 1024)
+      : m_blockSize{ blockSize } {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator = (const Arena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+      assert(alignment <= alignof(std::max_align_t) && (alignment & (alignment - 1)) == 0);
+
+      size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+      if (m_pCurrent && offset + size <= m_blockSize) {
+        m_offset = offset + size;
+        return m_pCurrent + offset;
+      }
+
+      // Anything bigger than a block gets a block of its own, so the rest of
+      // the current one can still be used.
+      if (size > m_blockSize)
+        return m_blocks.emplace_back(new std::byte[size]).get();
+
+      m_pCurrent = m_blocks.emplace_back(new std::byte[m_blockSize]).get();
+      m_offset = size;
+      return m_pCurrent;
+    }
+
+    void reset() {
+      m_blocks.clear();
+      m_pCurrent = nullptr;
+      m_offset = 0;
+    }
+
+  private:
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    size_t m_blockSize;
+    std::byte* m_pCurrent = nullptr;
+    size_t m_offset = 0;
+  };
+
+  // Hands out consecutive pieces of the single allocation a deep copy is laid
+  // out in, in the same order the size pass reserved them.
+  class DeepCopyCursor {
+  public:
+    explicit DeepCopyCursor(void* pData)
+      : m_pData{ static_cast<std::byte*>(pData) } {
+    }
+
+    template <typename T>
+    T* take(size_t count) {
+      m_offset = (m_offset + alignof(T) - 1) & ~(alignof(T) - 1);
+      T* ptr = reinterpret_cast<T*>(m_pData + m_offset);
+      m_offset += sizeof(T) * count;
+      return ptr;
+    }
+
+  private:
+    std::byte* m_pData;
+    size_t m_offset = 0;
+  };
+
+  // Structs without any pointers have nothing to copy beyond themselves.
+  // make_vkroots specializes this for every struct that does, so one with a
+  // pNext that ends up here is from newer headers and can't be copied.
+  template <typename T>
+  struct DeepCopyTraits {
+    static constexpr bool Supported = !requires (const T& t) { t.pNext; };
+    static void size(const T&, size_t&) {}
+    static void copy(const T&, T&, DeepCopyCursor&) {}
+  };
+
+  template <typename T>
+  void DeepCopyReserve(size_t& offset, size_t count) {
+    offset = (offset + alignof(T) - 1) & ~(alignof(T) - 1);
+    offset += sizeof(T) * count;
+  }
+
+  // Copies the first struct in a pNext chain that can be copied, which copies
+  // the rest of the chain after it in turn. Structs vkroots doesn't know how
+  // to copy are left out.
+  inline void DeepCopyNextSize(const void* pNext, size_t& offset);
+  inline void* DeepCopyNext(const void* pNext, DeepCopyCursor& cursor);
+
+  template <typename T>
+  void DeepCopyStructSize(const T& src, size_t& offset) {
+    DeepCopyReserve<T>(offset, 1);
+    DeepCopyTraits<T>::size(src, offset);
+  }
+
+  template <typename T>
+  T* DeepCopyStruct(const T& src, DeepCopyCursor& cursor) {
+    T* dst = cursor.take<T>(1);
+    std::memcpy(dst, &src, sizeof(T));
+    DeepCopyTraits<T>::copy(src, *dst, cursor);
+    return dst;
+  }
+
+  // context is what the struct pointing to these hands down to them, for
+  // structs whose ignored pointers depend on it.
+  template <typename T, typename... Context>
+  void DeepCopyArraySize(const T* pSrc, size_t count, size_t& offset, const Context&... context) {
+    if (!pSrc || !count)
+      return;
+    DeepCopyReserve<T>(offset, count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyTraits<T>::size(pSrc[i], offset, context...);
+  }
+
+  template <typename T, typename... Context>
+  T* DeepCopyArray(const T* pSrc, size_t count, DeepCopyCursor& cursor, const Context&... context) {
+    if (!pSrc || !count)
+      return nullptr;
+    T* pDst = cursor.take<T>(count);
+    std::memcpy(pDst, pSrc, sizeof(T) * count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyTraits<T>::copy(pSrc[i], pDst[i], cursor, context...);
+    return pDst;
+  }
+
+  // Arrays of pointers to single elements, eg. ppGeometries.
+  template <typename T>
+  void DeepCopyPointerArraySize(const T* const* ppSrc, size_t count, size_t& offset) {
+    if (!ppSrc || !count)
+      return;
+    DeepCopyReserve<T*>(offset, count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyArraySize(ppSrc[i], 1, offset);
+  }
+
+  template <typename T>
+  T** DeepCopyPointerArray(const T* const* ppSrc, size_t count, DeepCopyCursor& cursor) {
+    if (!ppSrc || !count)
+      return nullptr;
+    T** ppDst = cursor.take<T*>(count);
+    for (size_t i = 0; i < count; i++)
+      ppDst[i] = DeepCopyArray(ppSrc[i], 1, cursor);
+    return ppDst;
+  }
+
+  inline void DeepCopyBytesSize(const void* pSrc, size_t size, size_t& offset) {
+    DeepCopyArraySize(static_cast<const std::byte*>(pSrc), size, offset);
+  }
+
+  inline void* DeepCopyBytes(const void* pSrc, size_t size, DeepCopyCursor& cursor) {
+    return DeepCopyArray(static_cast<const std::byte*>(pSrc), size, cursor);
+  }
+
+  inline void DeepCopyStringSize(const char* pSrc, size_t& offset) {
+    if (pSrc)
+      DeepCopyReserve<char>(offset, std::strlen(pSrc) + 1);
+  }
+
+  inline char* DeepCopyString(const char* pSrc, DeepCopyCursor& cursor) {
+    if (!pSrc)
+      return nullptr;
+    const size_t size = std::strlen(pSrc) + 1;
+    char* pDst = cursor.take<char>(size);
+    std::memcpy(pDst, pSrc, size);
+    return pDst;
+  }
+
+  inline void DeepCopyStringArraySize(const char* const* ppSrc, size_t count, size_t& offset) {
+    if (!ppSrc || !count)
+      return;
+    DeepCopyReserve<char*>(offset, count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyStringSize(ppSrc[i], offset);
+  }
+
+  inline char** DeepCopyStringArray(const char* const* ppSrc, size_t count, DeepCopyCursor& cursor) {
+    if (!ppSrc || !count)
+      return nullptr;
+    char** ppDst = cursor.take<char*>(count);
+    for (size_t i = 0; i < count; i++)
+      ppDst[i] = DeepCopyString(ppSrc[i], cursor);
+    return ppDst;
+  }
+
+  // Pointers the spec says are ignored unless another member says otherwise.
+  // make_vkroots only follows them when these say they are used, and leaves
+  // them null in the copy when they aren't.
+
+  inline bool DescriptorTypeUsesImmutableSamplers(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+  }
+
+  inline bool DescriptorTypeUsesImageInfo(VkDescriptorType type) {
+    switch (type) {
+      case VK_DESCRIPTOR_TYPE_SAMPLER:
+      case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+      case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+      case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+      case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+      case VK_DESCRIPTOR_TYPE_SAMPLE_WEIGHT_IMAGE_QCOM:
+      case VK_DESCRIPTOR_TYPE_BLOCK_MATCH_IMAGE_QCOM:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  inline bool DescriptorTypeUsesBufferInfo(VkDescriptorType type) {
+    switch (type) {
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  inline bool DescriptorTypeUsesTexelBufferView(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+  }
+
+  // Which of a VkGraphicsPipelineCreateInfo's state pointers are used, going
+  // by the library subsets it has, its shader stages, dynamic states, whether
+  // rasterization is discarded and the dynamic rendering formats. It is handed
+  // down to the state structs, whose arrays depend on the dynamic states too.
+  // A render pass' subpass can't be looked at from here, so with one both
+  // pDepthStencilState and pColorBlendState count as used.
+  // Default constructed, for state structs copied on their own, everything is.
+  class DeepCopyGraphicsPipelineState {
+  public:
+    DeepCopyGraphicsPipelineState() = default;
+
+    explicit DeepCopyGraphicsPipelineState(const VkGraphicsPipelineCreateInfo& info)
+      : m_pDynamicState{ info.pDynamicState } {
+      const VkGraphicsPipelineLibraryCreateInfoEXT* pLibraryInfo = nullptr;
+      const VkPipelineLibraryCreateInfoKHR* pLibraries = nullptr;
+      const VkPipelineRenderingCreateInfo* pRendering = nullptr;
+      for (const VkBaseInStructure* header = static_cast<const VkBaseInStructure*>(info.pNext); header; header = header->pNext) {
+        switch (header->sType) {
+          case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT:
+            pLibraryInfo = pLibraryInfo ? pLibraryInfo : reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT*>(header);
+            break;
+          case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
+            pLibraries = pLibraries ? pLibraries : reinterpret_cast<const VkPipelineLibraryCreateInfoKHR*>(header);
+            break;
+          case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+            pRendering = pRendering ? pRendering : reinterpret_cast<const VkPipelineRenderingCreateInfo*>(header);
+            break;
+          default:
+            break;
+        }
+      }
+
+      // Without VkGraphicsPipelineLibraryCreateInfoEXT, a library or a pipeline
+      // linked from libraries has none of the state itself.
+      VkGraphicsPipelineLibraryFlagsEXT subsets =
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT |
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+      if (pLibraryInfo)
+        subsets = pLibraryInfo->flags;
+      else if ((info.flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) || (pLibraries && pLibraries->libraryCount))
+        subsets = 0;
+      const bool vertexInput     = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+      const bool preRasterization = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+      const bool fragmentShader  = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+      const bool fragmentOutput  = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+
+      stages = preRasterization || fragmentShader;
+      VkShaderStageFlags stageFlags = 0;
+      if (stages && info.pStages) {
+        for (uint32_t i = 0; i < info.stageCount; i++)
+          stageFlags |= info.pStages[i].stage;
+      }
+      const bool mesh = stageFlags & VK_SHADER_STAGE_MESH_BIT_EXT;
+      const VkShaderStageFlags tessellation = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+
+      // Only the pre-rasterization state says whether rasterization is discarded.
+      const bool rasterization = !preRasterization || !info.pRasterizationState ||
+        !info.pRasterizationState->rasterizerDiscardEnable || IsDynamic(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE);
+
+      vertexInputState   = vertexInput && !mesh && !IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT);
+      inputAssemblyState = vertexInput && !mesh;
+      tessellationState  = preRasterization && (stageFlags & tessellation) == tessellation;
+      viewportState      = preRasterization && rasterization;
+      rasterizationState = preRasterization;
+      multisampleState   = (fragmentShader || fragmentOutput) && rasterization;
+      depthStencilState  = fragmentShader && rasterization;
+      colorBlendState    = fragmentOutput && rasterization;
+      if (info.renderPass == VK_NULL_HANDLE) {
+        depthStencilState = depthStencilState && pRendering &&
+          (pRendering->depthAttachmentFormat != VK_FORMAT_UNDEFINED || pRendering->stencilAttachmentFormat != VK_FORMAT_UNDEFINED);
+        colorBlendState = colorBlendState && pRendering && pRendering->colorAttachmentCount;
+      }
+    }
+
+    bool IsDynamic(VkDynamicState state) const {
+      if (!m_pDynamicState || !m_pDynamicState->pDynamicStates)
+        return false;
+      for (uint32_t i = 0; i < m_pDynamicState->dynamicStateCount; i++) {
+        if (m_pDynamicState->pDynamicStates[i] == state)
+          return true;
+      }
+      return false;
+    }
+
+    bool stages             = true;
+    bool vertexInputState   = true;
+    bool inputAssemblyState = true;
+    bool tessellationState  = true;
+    bool viewportState      = true;
+    bool rasterizationState = true;
+    bool multisampleState   = true;
+    bool depthStencilState  = true;
+    bool colorBlendState    = true;
+
+  private:
+    const VkPipelineDynamicStateCreateInfo* m_pDynamicState = nullptr;
+  };
+
+  // Copies src, everything its pointers point to and its pNext chain into a
+  // single allocation from arena, eg. to hold on to a create info after the
+  // call it was passed to has returned. Pointers the spec says are ignored are
+  // left out as far as the struct itself can tell they are, see above, the
+  // rest have to be valid or null.
+  template <typename T>
+  T* deepCopy(const T& src, Arena& arena) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+
+    size_t size = 0;
+    DeepCopyStructSize(src, size);
+    DeepCopyCursor cursor{ arena.allocate(size) };
+    return DeepCopyStruct(src, cursor);
+  }
+
+  // The same for an array of count structs, eg. the pCreateInfos of
+  // vkCreateGraphicsPipelines.
+  template <typename T>
+  T* deepCopy(const T* pSrc, size_t count, Arena& arena) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+
+    size_t size = 0;
+    DeepCopyArraySize(pSrc, count, size);
+    if (!size)
+      return nullptr;
+    DeepCopyCursor cursor{ arena.allocate(size) };
+    return DeepCopyArray(pSrc, count, cursor);
+  }
+
+}
@@ -1,8 +1,21 @@
 namespace vkroots::tables {
 
-  static inline void CreateDispatchTable(PFN_vkGetInstanceProcAddr nextInstanceProcAddr, PFN_GetPhysicalDeviceProcAddr nextPhysDevProcAddr, VkInstance instance) {
+  inline void CreateDispatchTable(PFN_vkGetInstanceProcAddr nextInstanceProcAddr, PFN_GetPhysicalDeviceProcAddr nextPhysDevProcAddr, VkInstance instance) {
+#if VKROOTS_USE_CREATE_TIMINGS
+    VkCreateTimer totalTimer;
+#endif
     auto instanceDispatch = InstanceDispatches.insert(instance, std::make_unique<VkInstanceDispatch>(nextInstanceProcAddr, instance));
     auto physicalDeviceDispatch = PhysicalDeviceInstanceDispatches.insert(instance, std::make_unique<VkPhysicalDeviceDispatch>(nextPhysDevProcAddr, instance, instanceDispatch));
+#if VKROOTS_USE_DISPATCH_KEY
+    // Physical devices share the instance's dispatch key.
+    KeyDispatches<VkInstanceDispatch>.insert(instance, instanceDispatch);
+    KeyDispatches<VkPhysicalDeviceDispatch>.insert(instance, physicalDeviceDispatch);
+#endif
+#if VKROOTS_USE_CREATE_TIMINGS
+    instanceDispatch->CreateTimings.DispatchConstruction = totalTimer.Elapsed();
+    totalTimer.StoreOnExit(&instanceDispatch->CreateTimings.CreateDispatchTable);
+    VkCreateTimer enumerationTimer(&instanceDispatch->CreateTimings.PhysicalDeviceEnumeration);
+#endif
 
     uint32_t physicalDeviceCount;
     VkResult res = instanceDispatch->EnumeratePhysicalDevices(instance, &physicalDeviceCount, nullptr);
@@ -17,9 +30,21 @@ namespace vkroots::tables {
       PhysicalDeviceDispatches.insert(physicalDevice, RawPointer(physicalDeviceDispatch));
   }
 
-  static inline void CreateDispatchTable(const VkDeviceCreateInfo* pCreateInfo, PFN_vkGetDeviceProcAddr nextProcAddr, VkPhysicalDevice physicalDevice, VkDevice device) {
+  inline void CreateDispatchTable(const VkDeviceCreateInfo* pCreateInfo, PFN_vkGetDeviceProcAddr nextProcAddr, VkPhysicalDevice physicalDevice, VkDevice device) {
+#if VKROOTS_USE_CREATE_TIMINGS
+    VkCreateTimer totalTimer;
+#endif
     auto physicalDeviceDispatch = vkroots::tables::LookupPhysicalDeviceDispatch(physicalDevice);
     auto deviceDispatch = DeviceDispatches.insert(device, std::make_unique<VkDeviceDispatch>(nextProcAddr, device, physicalDevice, physicalDeviceDispatch, pCreateInfo));
+#if VKROOTS_USE_DISPATCH_KEY
+    // Queues and command buffers share the device's dispatch key.
+    KeyDispatches<VkDeviceDispatch>.insert(device, deviceDispatch);
+#endif
+#if VKROOTS_USE_CREATE_TIMINGS
+    deviceDispatch->CreateTimings.DispatchConstruction = totalTimer.Elapsed();
+    totalTimer.StoreOnExit(&deviceDispatch->CreateTimings.CreateDispatchTable);
+    VkCreateTimer queueTimer(&deviceDispatch->CreateTimings.QueueRegistration);
+#endif
 
     for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; i++) {
       const auto &queueInfo = pCreateInfo->pQueueCreateInfos[i];
@@ -32,7 +57,7 @@ namespace vkroots::tables {
     }
   }
 
-  static inline void DestroyDispatchTable(VkInstance instance) {
+  inline void DestroyDispatchTable(VkInstance instance) {
     const VkInstanceDispatch* instanceDispatch = InstanceDispatches.find(instance);
     assert(instanceDispatch);
     if (!instanceDispatch)
@@ -51,11 +76,21 @@ namespace vkroots::tables {
       }
     }
 
+#if VKROOTS_USE_DISPATCH_KEY
+    KeyDispatches<VkPhysicalDeviceDispatch>.remove(instance);
+    KeyDispatches<VkInstanceDispatch>.remove(instance);
+#endif
     PhysicalDeviceInstanceDispatches.remove(instance);
     InstanceDispatches.remove(instance);
+
+    // Only once nothing can find them any more, or a lookup in between could
+    // cache them again under the new generation.
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    DispatchGeneration.fetch_add(1, std::memory_order_release);
+#endif
   }
 
-  static inline void DestroyDispatchTable(VkDevice device) {
+  inline void DestroyDispatchTable(VkDevice device) {
     const VkDeviceDispatch* deviceDispatch = DeviceDispatches.find(device);
     assert(deviceDispatch);
     if (!deviceDispatch)
@@ -69,7 +104,37 @@ namespace vkroots::tables {
       }
     }
 
+#if VKROOTS_USE_DISPATCH_KEY
+    KeyDispatches<VkDeviceDispatch>.remove(device);
+#endif
     DeviceDispatches.remove(device);
+    // Pools the app didn't destroy before the device.
+    CommandPools.destroy(device);
+
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    DispatchGeneration.fetch_add(1, std::memory_order_release);
+#endif
+  }
+
+  inline void RegisterCommandBuffers(const VkDeviceDispatch* deviceDispatch, const VkCommandBufferStateType* stateType, const VkCommandBufferAllocateInfo* pAllocateInfo, const VkCommandBuffer* pCommandBuffers) {
+    CommandPools.insert(deviceDispatch->Device, deviceDispatch, stateType, pAllocateInfo->commandPool, pAllocateInfo->commandBufferCount, pCommandBuffers);
+  }
+
+  inline void UnregisterCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    CommandPools.remove(device, commandPool, commandBufferCount, pCommandBuffers);
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    // The handles may come back for a command buffer on another device.
+    DispatchGeneration.fetch_add(1, std::memory_order_release);
+#endif
+  }
+
+  inline void UnregisterCommandPool(VkDevice device, VkCommandPool commandPool) {
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    if (CommandPools.destroy(device, commandPool))
+      DispatchGeneration.fetch_add(1, std::memory_order_release);
+#else
+    CommandPools.destroy(device, commandPool);
+#endif
   }
 
 }
@@ -1,145 +1,305 @@
 namespace vkroots {
 
-  template <class>
-  class constexpr_function;
-  
-  template <class R, class... TArgs>
-  class constexpr_function<R(TArgs...)>;
-  
-  template <class> struct function_traits {};
-
-  template <class R, class B, class... TArgs>
-  struct function_traits<R (B::*)(TArgs...) const> {
-    using type = R(TArgs...);
-  };
-
-  template <class F>
-  constexpr_function(F) -> constexpr_function<typename function_traits<decltype(&F::operator())>::type>;
-  
-  template <class Fn, class R>
-  concept ConceptNullFunc = (std::is_trivial_v<Fn> || std::is_fundamental_v<Fn>)
-                       && std::is_same<R,std::nullptr_t>::value;
-
-  // Consistency!
-  using PFN_vkGetPhysicalDeviceProcAddr = PFN_GetPhysicalDeviceProcAddr;
+#ifndef VKROOTS_CACHE_LINE_SIZE
+#define VKROOTS_CACHE_LINE_SIZE 64
+#endif
 
-  class VkInstanceDispatch;
-  class VkPhysicalDeviceDispatch;
-  class VkDeviceDispatch;
+  namespace tables {
 
-  class NoOverrides { static constexpr bool IsNoOverrides = true; };
+    template <typename T>
+    class RawPointer {
+    public:
+      RawPointer(T* value = nullptr) : m_value(value) {}
+            T* get()       { return m_value; }
+      const T* get() const { return m_value; }
+    private:
+      T* m_value;
+    };
 
-  template <typename Type>
-  constexpr VkStructureType ResolveSType();
+    // Open-addressing hash map keyed on Vulkan handles.
+    // Slots are stored inline (a handle and a pointer-sized value), probed
+    // linearly and erased with backward shifting, so lookups touch one or two
+    // cache lines and there are no per-entry allocations or tombstones.
+    template <typename Key, typename Value>
+    class VkHandleMap {
+      static_assert(sizeof(Key) <= sizeof(uint64_t));
+    public:
+      Value* find(Key key) {
+        return const_cast<Value*>(std::as_const(*this).find(key));
+      }
+      const Value* find(Key key) const {
+        if (!m_size)
+          return nullptr;
+        for (size_t i = index(key); ; i = (i + 1) & mask()) {
+          const Slot& slot = m_slots[i];
+          if (slot.key == key)
+            return &slot.value;
+          if (slot.key == Key{})
+            return nullptr;
+        }
+      }
+      // Does not replace an existing entry, like std::unordered_map::insert.
+      bool insert(Key key, Value value) {
+        assert(key != Key{});
+        if ((m_size + 1) * 2 > m_slots.size())
+          rehash(std::max<size_t>(m_slots.size() * 2, 8));
+        for (size_t i = index(key); ; i = (i + 1) & mask()) {
+          Slot& slot = m_slots[i];
+          if (slot.key == key)
+            return false;
+          if (slot.key == Key{}) {
+            slot.key = key;
+            slot.value = std::move(value);
+            m_size++;
+            return true;
+          }
+        }
+      }
+      bool erase(Key key) {
+        if (!m_size)
+          return false;
+        size_t i = index(key);
+        for (; m_slots[i].key != key; i = (i + 1) & mask()) {
+          if (m_slots[i].key == Key{})
+            return false;
+        }
+        // Shift back any following entries that would no longer be reachable.
+        for (size_t j = (i + 1) & mask(); m_slots[j].key != Key{}; j = (j + 1) & mask()) {
+          const size_t ideal = index(m_slots[j].key);
+          if (((j - ideal) & mask()) >= ((j - i) & mask())) {
+            m_slots[i] = std::move(m_slots[j]);
+            i = j;
+          }
+        }
+        m_slots[i] = Slot{};
+        m_size--;
+        return true;
+      }
+      template <typename Func>
+      void forEach(Func func) const {
+        for (const Slot& slot : m_slots) {
+          if (slot.key != Key{})
+            func(slot.key, slot.value);
+        }
+      }
+      void reserve(size_t count) {
+        if (count * 2 > m_slots.size())
+          rehash(std::bit_ceil(std::max<size_t>(count * 2, 8)));
+      }
+      size_t size() const { return m_size; }
+    private:
+      struct Slot {
+        Key key{};
+        Value value{};
+      };
 
-  template <> constexpr VkStructureType ResolveSType<VkLayerInstanceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO; }
-  template <> constexpr VkStructureType ResolveSType<const VkLayerInstanceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO; }
-  template <> constexpr VkStructureType ResolveSType<VkLayerDeviceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO; }
-  template <> constexpr VkStructureType ResolveSType<const VkLayerDeviceCreateInfo>() { return VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO; }
+      size_t mask() const { return m_slots.size() - 1; }
 
-  template <typename T>
-  static constexpr bool TypeIsSinglePointer() {
-    // If we aren't a pointer at all, return false
-    // eg. int
-    if (!std::is_pointer<T>::value)
-      return false;
+      size_t index(Key key) const {
+        uint64_t value;
+        if constexpr (std::is_pointer<Key>::value)
+          value = reinterpret_cast<uintptr_t>(key);
+        else
+          value = static_cast<uint64_t>(key);
+        // Handles are heap allocations, the low alignment bits carry no information.
+        // Fibonacci hashing spreads the rest over the table.
+        return size_t(((value >> 4) * 0x9E3779B97F4A7C15ull) >> m_shift);
+      }
 
-    // If we are still a pointer after removing pointer, return false.
-    // eg. void**
-    if (std::is_pointer<typename std::remove_pointer<T>::type>::value)
-      return false;
+      void rehash(size_t capacity) {
+        std::vector<Slot> slots(capacity);
+        std::swap(m_slots, slots);
+        m_shift = 64 - std::countr_zero(capacity);
+        m_size = 0;
+        for (Slot& slot : slots) {
+          if (slot.key != Key{})
+            insert(slot.key, std::move(slot.value));
+        }
+      }
 
-    // Must be a single * ptr.
-    return true;
-  }
+      std::vector<Slot> m_slots;
+      size_t m_size = 0;
+      uint32_t m_shift = 64;
+    };
 
-#if VKROOTS_USE_CONSTEXPR_FUNC
-  #define VKROOTS_CHAINPATCHER_FUNC constexpr_function
-  #define VKROOTS_CHAINPATCHER_ATTR constexpr
-#else
-  #define VKROOTS_CHAINPATCHER_FUNC std::function
-  #define VKROOTS_CHAINPATCHER_ATTR
-#endif
+    // Bulk inserts take either one dispatch for every object or one per object.
+    template <typename DispatchType>
+    inline const DispatchType* dispatchAt(const DispatchType* dispatch, uint32_t) { return dispatch; }
+    template <typename DispatchType>
+    inline const DispatchType* dispatchAt(const DispatchType* const* ppDispatches, uint32_t i) { return ppDispatches[i]; }
 
-  template <typename Type, typename AnyStruct>
-  VKROOTS_CHAINPATCHER_ATTR const Type* FindInChain(const AnyStruct* obj) {
-  	using AnyStructBase = std::remove_cvref_t<AnyStruct>;
-  	using TypeBase = std::remove_cvref_t<Type>;
-    static_assert(TypeIsSinglePointer<decltype(obj)>());
-
-    for (const VkBaseInStructure* header = std::bit_cast<VkBaseInStructure*, const AnyStructBase* const>(obj); header; header = header->pNext) {
-      if (header->sType == ResolveSType<Type>()) {
-        typedef struct {
-      			VkBaseInStructure base;
-      			char padding[sizeof(TypeBase)-sizeof(VkBaseInStructure)];
-      	} PaddedStruct_t;
-      	
-      	typedef union {
-      		PaddedStruct_t s;
-      		TypeBase tbase;
-      	} PaddedTypeBase;
-      	
-        const PaddedStruct_t* b = std::bit_cast<PaddedStruct_t*, const VkBaseInStructure*>(header);
-        
-        
-        return std::bit_cast<const TypeBase*, const PaddedStruct_t*>(b);
+    template <typename Object, typename DispatchPtr, typename Dispatches>
+    inline void insertOrAssign(VkHandleMap<Object, DispatchPtr>& map, uint32_t count, const Object* pObjs, Dispatches dispatches) {
+      map.reserve(map.size() + count);
+      for (uint32_t i = 0; i < count; i++) {
+        assert(pObjs[i]);
+        if (DispatchPtr* val = map.find(pObjs[i]))
+          *val = DispatchPtr(dispatchAt(dispatches, i));
+        else
+          map.insert(pObjs[i], DispatchPtr(dispatchAt(dispatches, i)));
       }
     }
-    return nullptr;
-  }
-
-#undef VKROOTS_CHAINPATCHER_FUNC
-#undef VKROOTS_CHAINPATCHER_ATTR
 
-  template <typename Type, typename AnyStruct>
-  Type* FindInChainMutable(AnyStruct* obj) {
-    static_assert(TypeIsSinglePointer<decltype(obj)>());
+#if VKROOTS_USE_RCU_DISPATCH_MAP
+    // Epoch based reclamation for VkDispatchTableMap snapshots.
+    // Each thread that reads a map owns a reader record which publishes the
+    // global epoch it observed while it is inside find.
+    // A retired snapshot is only freed once no reader is still inside an
+    // epoch that could have observed it.
+    class VkDispatchEpoch {
+      struct Reader {
+        std::atomic<uint64_t> epoch{ 0 };
+        std::atomic<bool> inUse{ true };
+        Reader* next = nullptr;
+      };
 
-    for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(obj); header; header = header->pNext) {
-      if (header->sType == ResolveSType<Type>())
-        return reinterpret_cast<Type*>(header);
-    }
-    return nullptr;
-  }
-
-  template <typename Type, typename AnyStruct>
-  std::tuple<Type *, VkBaseOutStructure *> RemoveFromChain(AnyStruct *obj) {
-    static_assert(TypeIsSinglePointer<decltype(obj)>());
+    public:
+      class ReadGuard {
+      public:
+        ReadGuard() : m_reader{ VkDispatchEpoch::threadReader() } {
+          m_reader->epoch.store(s_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+        ~ReadGuard() {
+          m_reader->epoch.store(0, std::memory_order_release);
+        }
+      private:
+        Reader* m_reader;
+      };
 
-    for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(obj); header; header = header->pNext) {
-      VkBaseOutStructure *pNextInChain = header->pNext;
-      if (pNextInChain && pNextInChain->sType == ResolveSType<Type>()) {
-        header->pNext = pNextInChain->pNext;
-        return std::make_tuple(reinterpret_cast<Type*>(pNextInChain), header);
+      // Returns the epoch that things retired now are tagged with.
+      static uint64_t retire() {
+        return s_epoch.fetch_add(1, std::memory_order_seq_cst);
       }
-    }
-    return std::make_tuple(nullptr, nullptr);
-  }
 
-  template <typename Type, typename AnyStruct>
-  Type *AddToChain(AnyStruct *pParent, Type *pType) {
-    static_assert(TypeIsSinglePointer<decltype(pParent)>());
-    static_assert(TypeIsSinglePointer<decltype(pType)>());
+      // Whether no reader can still be holding something retired in epoch.
+      static bool quiescent(uint64_t epoch) {
+        for (Reader* reader = s_readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+          uint64_t readerEpoch = reader->epoch.load(std::memory_order_seq_cst);
+          if (readerEpoch && readerEpoch <= epoch)
+            return false;
+        }
+        return true;
+      }
+    private:
+      // Records are never freed, only recycled when their thread exits.
+      static Reader* acquireReader() {
+        for (Reader* reader = s_readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+          bool expected = false;
+          if (!reader->inUse.load(std::memory_order_relaxed) && reader->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return reader;
+        }
+        Reader* reader = new Reader;
+        reader->next = s_readers.load(std::memory_order_relaxed);
+        while (!s_readers.compare_exchange_weak(reader->next, reader, std::memory_order_release, std::memory_order_relaxed))
+          ;
+        return reader;
+      }
 
-    void **ppParentNext = reinterpret_cast<void **>(&pParent->pNext);
-    void **ppTypeNext   = reinterpret_cast<void **>(&pType->pNext);
+      struct ThreadReader {
+        Reader* reader = acquireReader();
+        ~ThreadReader() { reader->inUse.store(false, std::memory_order_release); }
+      };
 
-    *ppTypeNext = std::exchange(*ppParentNext, reinterpret_cast<void *>(pType));
-    return pType;
-  }
+      static Reader* threadReader() {
+        static thread_local ThreadReader t_reader;
+        return t_reader.reader;
+      }
 
-  namespace tables {
+      static inline std::atomic<uint64_t> s_epoch{ 1 };
+      static inline std::atomic<Reader*> s_readers{ nullptr };
+    };
 
-    template <typename T>
-    class RawPointer {
+    // Copy-on-write dispatch map.
+    // find is a wait-free load of an immutable snapshot, insert and remove
+    // build and publish a new snapshot under the writer lock, and the old one
+    // is freed once every reader that could have seen it has left.
+    template <typename Object, typename DispatchType, typename DispatchPtr>
+    class VkDispatchTableMap {
+      using Snapshot = VkHandleMap<Object, const DispatchType*>;
     public:
-      RawPointer(T* value) : m_value(value) {}
-            T* get()       { return m_value; }
-      const T* get() const { return m_value; }
+      ~VkDispatchTableMap() {
+        delete m_snapshot.load(std::memory_order_relaxed);
+        for (auto& retired : m_retired)
+          delete retired.second;
+      }
+
+      const DispatchType* insert(Object obj, DispatchPtr ptr) {
+        assert(obj);
+        auto lock = std::unique_lock(m_mutex);
+        const DispatchType* val = ptr.get();
+        m_map.insert(obj, std::move(ptr));
+        publish();
+        return val;
+      }
+      void remove(Object obj) {
+        assert(obj);
+        auto lock = std::unique_lock(m_mutex);
+        if (m_map.erase(obj))
+          publish();
+      }
+      // Maps every object to the same dispatch, or each to its own, publishing once.
+      // Unlike the single insert, this replaces existing entries.
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* dispatch) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, dispatch);
+        publish();
+      }
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* const* ppDispatches) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, ppDispatches);
+        publish();
+      }
+      void remove(uint32_t count, const Object* pObjs) {
+        auto lock = std::unique_lock(m_mutex);
+        bool erased = false;
+        for (uint32_t i = 0; i < count; i++)
+          erased |= pObjs[i] && m_map.erase(pObjs[i]);
+        if (erased)
+          publish();
+      }
+      const DispatchType* find(Object obj) const {
+        if (!obj) return nullptr;
+        VkDispatchEpoch::ReadGuard guard;
+        const Snapshot* snapshot = m_snapshot.load(std::memory_order_seq_cst);
+        if (!snapshot)
+          return nullptr;
+        const DispatchType* const* val = snapshot->find(obj);
+        return val ? *val : nullptr;
+      }
+      // The only dispatch in the map, if there is exactly one.
+      const DispatchType* single() const {
+        return m_single.load(std::memory_order_acquire);
+      }
     private:
-      T* m_value;
-    };
+      static const DispatchType* onlyDispatch(const Snapshot& snapshot) {
+        const DispatchType* val = nullptr;
+        snapshot.forEach([&](Object, const DispatchType* dispatch) { val = dispatch; });
+        return val;
+      }
 
+      void publish() {
+        Snapshot* snapshot = new Snapshot;
+        snapshot->reserve(m_map.size());
+        m_map.forEach([&](Object obj, const DispatchPtr& ptr) { snapshot->insert(obj, ptr.get()); });
+        m_single.store(m_map.size() == 1 ? onlyDispatch(*snapshot) : nullptr, std::memory_order_release);
+        const Snapshot* old = m_snapshot.exchange(snapshot, std::memory_order_seq_cst);
+        if (old)
+          m_retired.emplace_back(VkDispatchEpoch::retire(), old);
+        std::erase_if(m_retired, [](const auto& retired) {
+          if (!VkDispatchEpoch::quiescent(retired.first))
+            return false;
+          delete retired.second;
+          return true;
+        });
+      }
+
+      VkHandleMap<Object, DispatchPtr> m_map;
+      std::atomic<const Snapshot*> m_snapshot{ nullptr };
+      std::atomic<const DispatchType*> m_single{ nullptr };
+      std::vector<std::pair<uint64_t, const Snapshot*>> m_retired;
+      std::mutex m_mutex;
+    };
+#else
     template <typename Object, typename DispatchType, typename DispatchPtr>
     class VkDispatchTableMap {
     public:
@@ -147,26 +307,322 @@ namespace vkroots {
         assert(obj);
         auto lock = std::unique_lock(m_mutex);
         const DispatchType* val = ptr.get();
-        m_map.insert(std::make_pair(obj, std::move(ptr)));
+        m_map.insert(obj, std::move(ptr));
+        updateSingle();
         return val;
       }
       void remove(Object obj) {
         assert(obj);
         auto lock = std::unique_lock(m_mutex);
         m_map.erase(obj);
+        updateSingle();
+      }
+      // Maps every object to the same dispatch, or each to its own, under one lock.
+      // Unlike the single insert, this replaces existing entries.
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* dispatch) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, dispatch);
+        updateSingle();
+      }
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* const* ppDispatches) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, ppDispatches);
+        updateSingle();
+      }
+      void remove(uint32_t count, const Object* pObjs) {
+        auto lock = std::unique_lock(m_mutex);
+        for (uint32_t i = 0; i < count; i++) {
+          if (pObjs[i])
+            m_map.erase(pObjs[i]);
+        }
+        updateSingle();
       }
       const DispatchType* find(Object obj) const {
         if (!obj) return nullptr;
         auto lock = std::unique_lock(m_mutex);
-        auto iter = m_map.find(obj);
-        if (iter == m_map.end())
-          return nullptr;
-        return iter->second.get();
+        const DispatchPtr* val = m_map.find(obj);
+        return val ? val->get() : nullptr;
+      }
+      // The only dispatch in the map, if there is exactly one.
+      const DispatchType* single() const {
+        return m_single.load(std::memory_order_acquire);
       }
     private:
-      std::unordered_map<Object, DispatchPtr> m_map;
+      void updateSingle() {
+        const DispatchType* val = nullptr;
+        if (m_map.size() == 1)
+          m_map.forEach([&](Object, const DispatchPtr& ptr) { val = ptr.get(); });
+        m_single.store(val, std::memory_order_release);
+      }
+
+      VkHandleMap<Object, DispatchPtr> m_map;
+      std::atomic<const DispatchType*> m_single{ nullptr };
       mutable std::mutex m_mutex;
     };
+#endif
+
+#if VKROOTS_USE_DISPATCH_KEY
+#ifndef VKROOTS_DISPATCH_KEY_TABLE_SIZE
+#define VKROOTS_DISPATCH_KEY_TABLE_SIZE 64
+#endif
+
+    // Every dispatchable handle points to an object whose first member is the
+    // loader's dispatch table pointer, which is shared between an instance and
+    // its physical devices, and between a device and its queues/command buffers.
+    inline void* GetDispatchKey(const void* object) {
+      return *static_cast<void* const*>(object);
+    }
+
+    // Fixed size open-addressing table from dispatch key -> dispatch.
+    // Lookups are lock-free. A slot keeps its key forever once claimed,
+    // removing only clears the value, so the slot can be reused by the same key
+    // or reclaimed by a new key without ever breaking a probe chain.
+    // If the table is full, insert fails and lookups fall back to the
+    // VkDispatchTableMap.
+    template <typename DispatchType, size_t Size = VKROOTS_DISPATCH_KEY_TABLE_SIZE>
+    class VkDispatchKeyTable {
+      static_assert(std::has_single_bit(Size), "Dispatch key table size must be a power of two.");
+    public:
+      bool insert(const void* obj, const DispatchType* dispatch) {
+        assert(obj);
+        void* key = GetDispatchKey(obj);
+        auto lock = std::unique_lock(m_mutex);
+        Slot* freeSlot = nullptr;
+        for (size_t i = 0; i < Size; i++) {
+          Slot& slot = m_slots[(index(key) + i) & (Size - 1)];
+          void* slotKey = slot.key.load(std::memory_order_relaxed);
+          if (slotKey == key) {
+            slot.value.store(dispatch, std::memory_order_release);
+            return true;
+          }
+          if (!freeSlot && !slot.value.load(std::memory_order_relaxed))
+            freeSlot = &slot;
+          if (!slotKey)
+            break;
+        }
+        if (!freeSlot)
+          return false;
+        freeSlot->key.store(key, std::memory_order_release);
+        freeSlot->value.store(dispatch, std::memory_order_release);
+        return true;
+      }
+      void remove(const void* obj) {
+        assert(obj);
+        void* key = GetDispatchKey(obj);
+        auto lock = std::unique_lock(m_mutex);
+        if (Slot* slot = lookup(key))
+          slot->value.store(nullptr, std::memory_order_release);
+      }
+      const DispatchType* find(const void* obj) const {
+        if (!obj) return nullptr;
+        const Slot* slot = lookup(GetDispatchKey(obj));
+        return slot ? slot->value.load(std::memory_order_acquire) : nullptr;
+      }
+    private:
+      struct Slot {
+        std::atomic<void*> key{};
+        std::atomic<const DispatchType*> value{};
+      };
+
+      static size_t index(void* key) {
+        // Dispatch tables are heap allocated, the low bits are always zero.
+        return (reinterpret_cast<uintptr_t>(key) >> 4) & (Size - 1);
+      }
+
+      Slot* lookup(void* key) const {
+        for (size_t i = 0; i < Size; i++) {
+          Slot& slot = m_slots[(index(key) + i) & (Size - 1)];
+          void* slotKey = slot.key.load(std::memory_order_acquire);
+          if (slotKey == key)
+            return &slot;
+          if (!slotKey)
+            return nullptr;
+        }
+        return nullptr;
+      }
+
+      mutable std::array<Slot, Size> m_slots;
+      std::mutex m_mutex;
+    };
+
+    // One per dispatch type: VkInstanceDispatch, VkPhysicalDeviceDispatch and VkDeviceDispatch.
+    template <typename DispatchType>
+    inline VkDispatchKeyTable<DispatchType> KeyDispatches;
+#endif
+
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    // Bumped once an instance or device's dispatches are gone, so a cached handle
+    // whose value gets reused by a new object can never return a stale dispatch.
+    inline std::atomic<uint64_t> DispatchGeneration{ 0 };
+
+    // Per-thread cache of the last two handles looked up for a given map.
+    template <typename Object, typename DispatchType>
+    class VkDispatchCache {
+    public:
+      template <typename Func>
+      static const DispatchType* lookup(Object obj, Func func) {
+        Cache& cache = t_cache;
+        const uint64_t generation = DispatchGeneration.load(std::memory_order_acquire);
+        if (cache.generation == generation) {
+          if (cache.entries[0].obj == obj && obj)
+            return cache.entries[0].dispatch;
+          if (cache.entries[1].obj == obj && obj) {
+            std::swap(cache.entries[0], cache.entries[1]);
+            return cache.entries[0].dispatch;
+          }
+        } else {
+          cache = Cache{ generation };
+        }
+        const DispatchType* dispatch = func(obj);
+        if (dispatch) {
+          cache.entries[1] = cache.entries[0];
+          cache.entries[0] = Entry{ obj, dispatch };
+        }
+        return dispatch;
+      }
+    private:
+      struct Entry {
+        Object obj{};
+        const DispatchType* dispatch = nullptr;
+      };
+      struct Cache {
+        uint64_t generation = 0;
+        std::array<Entry, 2> entries{};
+      };
+      static inline thread_local Cache t_cache;
+    };
+#endif
+
+#if VKROOTS_USE_PROC_ADDR_CACHE
+    // Remembers what the next layer handed back for each name, so repeat
+    // resolutions never go back down the chain.
+    // Names are matched by their contents only. Matching on the pointer would
+    // skip hashing, but a buffer the app rewrites with another name (or a
+    // std::string on the stack) would then get the first name's function.
+    class VkProcAddrCache {
+    public:
+      template <typename Func>
+      PFN_vkVoidFunction resolve(const char* name, Func func) const {
+        const std::string_view view{ name };
+        {
+          std::shared_lock lock(m_mutex);
+          auto iter = m_entries.find(view);
+          if (iter != m_entries.end())
+            return iter->second;
+        }
+
+        // Don't hold the lock while calling down the chain.
+        PFN_vkVoidFunction result = func();
+        std::unique_lock lock(m_mutex);
+        return m_entries.try_emplace(std::string(view), result).first->second;
+      }
+    private:
+      struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+      };
+
+      mutable std::unordered_map<std::string, PFN_vkVoidFunction, NameHash, std::equal_to<>> m_entries;
+      mutable std::shared_mutex m_mutex;
+    };
+#endif
+
+#if VKROOTS_USE_LAZY_DISPATCH
+    // What the functions of a lazily populated VkDeviceDispatch get resolved with.
+    struct VkLazyResolver {
+      VkDevice Device;
+      PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+    };
+
+    // A VkDeviceDispatch function that only asks the next layer for its
+    // pointer the first time it is used, then keeps it.
+    // Converts to the function pointer, so calls and null checks look the same
+    // as with the eagerly populated table.
+    // Only the pointer is stored. Owner's LazyResolver is shared by all of its
+    // functions, each finds it from its own offset in Owner.
+    template <typename PFN, auto Func, typename Owner>
+    class VkLazyFunc {
+    public:
+      VkLazyFunc() = default;
+      VkLazyFunc(const VkLazyFunc&) = delete;
+      VkLazyFunc& operator=(const VkLazyFunc&) = delete;
+
+      operator PFN() const {
+        PFN func = m_func.load(std::memory_order_relaxed);
+        if (func == Unresolved()) [[unlikely]] {
+          constexpr size_t Offset = Owner::Offset(Func);
+          const VkLazyResolver& resolver = reinterpret_cast<const Owner*>(reinterpret_cast<const std::byte*>(this) - Offset)->LazyResolver;
+          // Racing threads all get the same pointer back, so whoever stores last is fine.
+          // Functions the device doesn't have are kept as NULL, so they are only asked for once too.
+          func = reinterpret_cast<PFN>(resolver.GetDeviceProcAddr(resolver.Device, FuncName(Func)));
+          m_func.store(func, std::memory_order_relaxed);
+        }
+        return func;
+      }
+    private:
+      // Never called, only stands in for "not asked for yet" as NULL is a valid answer.
+      static void VKAPI_CALL UnresolvedFunc() {}
+      static PFN Unresolved() { return reinterpret_cast<PFN>(&UnresolvedFunc); }
+
+      mutable std::atomic<PFN> m_func{ Unresolved() };
+    };
+#endif
+
+#if VKROOTS_USE_EXTENSION_AWARE_DISPATCH
+    // The core version and extensions a device was created with,
+    // VkDeviceDispatch only resolves the functions these provide.
+    template <typename Extension, Extension (*LookupExtension)(const char*)>
+    class VkEnabledFeatures {
+    public:
+      VkEnabledFeatures(uint32_t apiVersion, uint32_t extensionCount, const char* const* ppExtensionNames)
+        : m_apiVersion(apiVersion) {
+        for (uint32_t i = 0; i < extensionCount; i++) {
+          Extension extension = LookupExtension(ppExtensionNames[i]);
+          if (extension != Extension::Count)
+            m_extensions.set(size_t(extension));
+        }
+      }
+
+      bool Version(uint32_t apiVersion) const { return m_apiVersion >= apiVersion; }
+      bool Has(Extension extension) const { return m_extensions.test(size_t(extension)); }
+    private:
+      uint32_t m_apiVersion;
+      std::bitset<size_t(Extension::Count)> m_extensions;
+    };
+#endif
+
+#if VKROOTS_USE_CREATE_TIMINGS
+    // Where the time went while creating an instance or device.
+    struct VkCreateTimings {
+      // The downstream vkCreateInstance/vkCreateDevice.
+      // When the layer overrides the create, this is the whole override.
+      std::chrono::nanoseconds Create{};
+      // All of CreateDispatchTable, including the phases below.
+      std::chrono::nanoseconds CreateDispatchTable{};
+      // Constructing the dispatch (resolving every function) and registering it.
+      std::chrono::nanoseconds DispatchConstruction{};
+      // Instance only: enumerating and registering its physical devices.
+      std::chrono::nanoseconds PhysicalDeviceEnumeration{};
+      // Device only: GetDeviceQueue and registering each of its queues.
+      std::chrono::nanoseconds QueueRegistration{};
+    };
+
+    class VkCreateTimer {
+    public:
+      VkCreateTimer() = default;
+      // Stores the elapsed time into pOut once the timer goes out of scope.
+      explicit VkCreateTimer(std::chrono::nanoseconds* pOut) : m_pOut(pOut) {}
+      VkCreateTimer(const VkCreateTimer&) = delete;
+      VkCreateTimer& operator=(const VkCreateTimer&) = delete;
+      ~VkCreateTimer() { if (m_pOut) *m_pOut = Elapsed(); }
+
+      void StoreOnExit(std::chrono::nanoseconds* pOut) { m_pOut = pOut; }
+      std::chrono::nanoseconds Elapsed() const { return std::chrono::steady_clock::now() - m_start; }
+    private:
+      std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+      std::chrono::nanoseconds* m_pOut = nullptr;
+    };
+#endif
 
     // All our dispatchables...
     inline VkDispatchTableMap<VkInstance,       VkInstanceDispatch,       std::unique_ptr<const VkInstanceDispatch>>       InstanceDispatches;
@@ -176,17 +632,454 @@ namespace vkroots {
     inline VkDispatchTableMap<VkQueue,          VkDeviceDispatch,         RawPointer     <const VkDeviceDispatch>>         QueueDispatches;
     inline VkDispatchTableMap<VkCommandBuffer,  VkDeviceDispatch,         RawPointer     <const VkDeviceDispatch>>         CommandBufferDispatches;
 
-    static inline const VkInstanceDispatch*       LookupInstanceDispatch      (VkInstance instance)             { return InstanceDispatches.find(instance); }
-    static inline const VkPhysicalDeviceDispatch* LookupPhysicalDeviceDispatch(VkInstance instance)             { return PhysicalDeviceInstanceDispatches.find(instance); }
-    static inline const VkPhysicalDeviceDispatch* LookupPhysicalDeviceDispatch(VkPhysicalDevice physicalDevice) { return PhysicalDeviceDispatches.find(physicalDevice); }
-    static inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkDevice device)                 { return DeviceDispatches.find(device); }
-    static inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkQueue device)                  { return QueueDispatches.find(device); }
-    static inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkCommandBuffer cmdBuffer)       { return CommandBufferDispatches.find(cmdBuffer); }
-
-    static inline void CreateDispatchTable(PFN_vkGetInstanceProcAddr nextInstanceProcAddr, PFN_GetPhysicalDeviceProcAddr nextPhysDevProcAddr, VkInstance instance);
-    static inline void CreateDispatchTable(const VkDeviceCreateInfo* pCreateInfo, PFN_vkGetDeviceProcAddr nextProcAddr, VkPhysicalDevice physicalDevice, VkDevice device);
-    static inline void DestroyDispatchTable(VkInstance instance);
-    static inline void DestroyDispatchTable(VkDevice device);
+    // A command buffer's dispatch, followed by the layer's
+    // DeviceOverrides::CommandBufferState when it has one.
+    struct VkCommandBufferEntry {
+      const VkDeviceDispatch* dispatch;
+
+      template <typename State>
+      State& CommandBufferState() const;
+    };
+
+    // How to lay out and construct a VkCommandBufferStateEntry without knowing its State.
+    struct VkCommandBufferStateType {
+      size_t size;
+      size_t alignment;
+      VkCommandBufferEntry* (*construct)(void* pMemory, const VkDeviceDispatch* dispatch);
+      // Null when there is nothing to destroy.
+      void (*destroy)(VkCommandBufferEntry* entry);
+    };
+
+    template <typename State>
+    struct VkCommandBufferStateEntry : VkCommandBufferEntry {
+      // Command buffers are externally synchronized, so whoever is recording
+      // into one owns its state, no locking needed.
+      mutable State state{};
+
+      explicit VkCommandBufferStateEntry(const VkDeviceDispatch* dispatch) : VkCommandBufferEntry{ dispatch } {}
+
+      static constexpr VkCommandBufferStateType Type = {
+        sizeof(VkCommandBufferStateEntry),
+        alignof(VkCommandBufferStateEntry),
+        [](void* pMemory, const VkDeviceDispatch* dispatch) -> VkCommandBufferEntry* { return new (pMemory) VkCommandBufferStateEntry(dispatch); },
+        std::is_trivially_destructible<State>::value ? nullptr : +[](VkCommandBufferEntry* entry) { static_cast<VkCommandBufferStateEntry*>(entry)->~VkCommandBufferStateEntry(); },
+      };
+    };
+
+    template <typename State>
+    State& VkCommandBufferEntry::CommandBufferState() const {
+      return static_cast<const VkCommandBufferStateEntry<State>*>(this)->state;
+    }
+
+    template <typename DeviceOverrides>
+    constexpr const VkCommandBufferStateType* CommandBufferStateTypeOf() {
+      if constexpr (requires { typename DeviceOverrides::CommandBufferState; })
+        return &VkCommandBufferStateEntry<typename DeviceOverrides::CommandBufferState>::Type;
+      else
+        return nullptr;
+    }
+
+    // Fixed size blocks handed out of chunks that are only freed all at once,
+    // so entries never move. Freed blocks are kept on a list for reuse.
+    class VkCommandBufferSlab {
+    public:
+      explicit VkCommandBufferSlab(const VkCommandBufferStateType* type)
+        : m_blockSize(std::max(type->size, sizeof(void*))), m_alignment(std::max(type->alignment, alignof(void*))) {
+        m_blockSize = (m_blockSize + m_alignment - 1) & ~(m_alignment - 1);
+      }
+      VkCommandBufferSlab(const VkCommandBufferSlab&) = delete;
+      VkCommandBufferSlab& operator=(const VkCommandBufferSlab&) = delete;
+      ~VkCommandBufferSlab() {
+        for (void* chunk : m_chunks)
+          ::operator delete(chunk, std::align_val_t(m_alignment));
+      }
+
+      void* allocate() {
+        if (m_free) {
+          void* block = m_free;
+          m_free = *static_cast<void**>(block);
+          return block;
+        }
+        if (m_used == m_chunkBlocks) {
+          m_chunkBlocks = m_chunks.empty() ? MinChunkBlocks : std::min(m_chunkBlocks * 2, MaxChunkBlocks);
+          m_chunks.push_back(::operator new(m_blockSize * m_chunkBlocks, std::align_val_t(m_alignment)));
+          m_used = 0;
+        }
+        return static_cast<std::byte*>(m_chunks.back()) + m_blockSize * m_used++;
+      }
+      void free(void* block) {
+        *static_cast<void**>(block) = std::exchange(m_free, block);
+      }
+    private:
+      static constexpr size_t MinChunkBlocks = 16;
+      static constexpr size_t MaxChunkBlocks = 1024;
+
+      size_t m_blockSize;
+      size_t m_alignment;
+      std::vector<void*> m_chunks;
+      size_t m_chunkBlocks = 0;
+      size_t m_used = 0;
+      void* m_free = nullptr;
+    };
+
+    // Only filled in for layers with a DeviceOverrides::CommandBufferState.
+    inline VkDispatchTableMap<VkCommandBuffer, VkCommandBufferEntry, RawPointer<const VkCommandBufferEntry>> CommandBufferEntries;
+
+    // The command buffers allocated from each pool, which keeps CommandBufferDispatches
+    // in sync as they come and go.
+    // Pools are tracked per device, as the same non-dispatchable handle can be
+    // a different pool on each device.
+    // Destroying a pool takes its command buffers out of CommandBufferDispatches
+    // and CommandBufferEntries straight from the pool's own list, in one batch,
+    // so neither map is left holding a handle the driver could hand out again.
+    // Destroying a device does the same for all the pools it has left.
+    class VkCommandPoolRegistry {
+    public:
+      void insert(VkDevice device, const VkDeviceDispatch* dispatch, const VkCommandBufferStateType* stateType, VkCommandPool commandPool, uint32_t count, const VkCommandBuffer* pCommandBuffers) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        if (!pools) {
+          m_devices.insert(device, DevicePools{});
+          pools = m_devices.find(device);
+        }
+        std::unique_ptr<Pool>* pool = pools->find(commandPool);
+        if (!pool) {
+          pools->insert(commandPool, std::make_unique<Pool>(dispatch, stateType));
+          pool = pools->find(commandPool);
+        }
+        std::vector<const VkCommandBufferEntry*> entries;
+        if ((*pool)->slab)
+          entries.reserve(count);
+        (*pool)->commandBuffers.reserve((*pool)->commandBuffers.size() + count);
+        for (uint32_t i = 0; i < count; i++) {
+          VkCommandBufferEntry* entry = (*pool)->allocate(pCommandBuffers[i]);
+          if ((*pool)->slab)
+            entries.push_back(entry);
+        }
+        CommandBufferDispatches.insert(count, pCommandBuffers, dispatch);
+        if ((*pool)->slab)
+          CommandBufferEntries.insert(count, pCommandBuffers, entries.data());
+      }
+
+      void remove(VkDevice device, VkCommandPool commandPool, uint32_t count, const VkCommandBuffer* pCommandBuffers) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        std::unique_ptr<Pool>* pool = pools ? pools->find(commandPool) : nullptr;
+        if (pool) {
+          for (uint32_t i = 0; i < count; i++)
+            (*pool)->free(pCommandBuffers[i]);
+        }
+        CommandBufferDispatches.remove(count, pCommandBuffers);
+        if (pool && (*pool)->slab)
+          CommandBufferEntries.remove(count, pCommandBuffers);
+      }
+
+      // Returns whether the pool had any command buffers.
+      bool destroy(VkDevice device, VkCommandPool commandPool) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        std::unique_ptr<Pool>* pool = pools ? pools->find(commandPool) : nullptr;
+        if (!pool)
+          return false;
+        std::vector<VkCommandBuffer> commandBuffers;
+        const bool hasEntries = gather(**pool, commandBuffers);
+        // Out of the maps before the entries they point to are freed.
+        const bool any = unregister(commandBuffers, hasEntries);
+        pools->erase(commandPool);
+        return any;
+      }
+
+      // Returns whether the device's pools had any command buffers.
+      bool destroy(VkDevice device) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        if (!pools)
+          return false;
+        std::vector<VkCommandBuffer> commandBuffers;
+        bool hasEntries = false;
+        pools->forEach([&](VkCommandPool, const std::unique_ptr<Pool>& pool) { hasEntries |= gather(*pool, commandBuffers); });
+        const bool any = unregister(commandBuffers, hasEntries);
+        m_devices.erase(device);
+        return any;
+      }
+    private:
+      class Pool {
+      public:
+        Pool(const VkDeviceDispatch* dispatch, const VkCommandBufferStateType* stateType)
+          : dispatch(dispatch), stateType(stateType) {
+          if (stateType)
+            slab.emplace(stateType);
+        }
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+        ~Pool() {
+          // Trivially destructible states are released with the slab in one go.
+          if (stateType && stateType->destroy)
+            commandBuffers.forEach([this](VkCommandBuffer, VkCommandBufferEntry* entry) { stateType->destroy(entry); });
+        }
+
+        VkCommandBufferEntry* allocate(VkCommandBuffer commandBuffer) {
+          VkCommandBufferEntry* entry = slab ? stateType->construct(slab->allocate(), dispatch) : nullptr;
+          if (VkCommandBufferEntry** existing = commandBuffers.find(commandBuffer)) {
+            release(*existing);
+            *existing = entry;
+          } else {
+            commandBuffers.insert(commandBuffer, entry);
+          }
+          return entry;
+        }
+        void free(VkCommandBuffer commandBuffer) {
+          VkCommandBufferEntry** entry = commandBuffer ? commandBuffers.find(commandBuffer) : nullptr;
+          if (!entry)
+            return;
+          release(*entry);
+          commandBuffers.erase(commandBuffer);
+        }
+
+        const VkDeviceDispatch* dispatch;
+        const VkCommandBufferStateType* stateType;
+        std::optional<VkCommandBufferSlab> slab;
+        // Null entries unless the layer has a CommandBufferState.
+        VkHandleMap<VkCommandBuffer, VkCommandBufferEntry*> commandBuffers;
+      private:
+        void release(VkCommandBufferEntry* entry) {
+          if (!entry)
+            return;
+          if (stateType->destroy)
+            stateType->destroy(entry);
+          slab->free(entry);
+        }
+      };
+
+      using DevicePools = VkHandleMap<VkCommandPool, std::unique_ptr<Pool>>;
+
+      // Appends the pool's command buffers, returns whether they have entries.
+      static bool gather(const Pool& pool, std::vector<VkCommandBuffer>& commandBuffers) {
+        commandBuffers.reserve(commandBuffers.size() + pool.commandBuffers.size());
+        pool.commandBuffers.forEach([&](VkCommandBuffer commandBuffer, VkCommandBufferEntry*) { commandBuffers.push_back(commandBuffer); });
+        return pool.slab.has_value();
+      }
+
+      static bool unregister(const std::vector<VkCommandBuffer>& commandBuffers, bool hasEntries) {
+        if (commandBuffers.empty())
+          return false;
+        CommandBufferDispatches.remove(uint32_t(commandBuffers.size()), commandBuffers.data());
+        if (hasEntries)
+          CommandBufferEntries.remove(uint32_t(commandBuffers.size()), commandBuffers.data());
+        return true;
+      }
+
+      VkHandleMap<VkDevice, DevicePools> m_devices;
+      std::mutex m_mutex;
+    };
+
+    inline VkCommandPoolRegistry CommandPools;
+
+    // While there is exactly one live instance or device, every physical device,
+    // queue and command buffer must belong to it, so skip the lookup entirely.
+    template <typename DispatchType, typename Object>
+    inline bool IsSingleDispatchFor(const DispatchType* dispatch, Object obj) {
+      if constexpr (std::is_same<Object, VkInstance>::value)
+        return dispatch->Instance == obj;
+      else if constexpr (std::is_same<Object, VkDevice>::value)
+        return dispatch->Device == obj;
+      else
+        return obj != VK_NULL_HANDLE;
+    }
+
+    template <typename Object, typename DispatchType, typename DispatchPtr, typename OwnerMap>
+    inline const DispatchType* LookupDispatch(const OwnerMap& owners, const VkDispatchTableMap<Object, DispatchType, DispatchPtr>& map, Object obj) {
+      if (const DispatchType* dispatch = owners.single(); dispatch && IsSingleDispatchFor(dispatch, obj))
+        return dispatch;
+
+      auto lookup = [&map](Object obj) -> const DispatchType* {
+#if VKROOTS_USE_DISPATCH_KEY
+        if (const DispatchType* dispatch = KeyDispatches<DispatchType>.find(obj))
+          return dispatch;
+#endif
+        return map.find(obj);
+      };
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+      return VkDispatchCache<Object, DispatchType>::lookup(obj, lookup);
+#else
+      return lookup(obj);
+#endif
+    }
+
+    inline const VkInstanceDispatch*       LookupInstanceDispatch      (VkInstance instance)             { return LookupDispatch(InstanceDispatches, InstanceDispatches, instance); }
+    inline const VkPhysicalDeviceDispatch* LookupPhysicalDeviceDispatch(VkInstance instance)             { return LookupDispatch(PhysicalDeviceInstanceDispatches, PhysicalDeviceInstanceDispatches, instance); }
+    inline const VkPhysicalDeviceDispatch* LookupPhysicalDeviceDispatch(VkPhysicalDevice physicalDevice) { return LookupDispatch(PhysicalDeviceInstanceDispatches, PhysicalDeviceDispatches, physicalDevice); }
+    inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkDevice device)                 { return LookupDispatch(DeviceDispatches, DeviceDispatches, device); }
+    inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkQueue device)                  { return LookupDispatch(DeviceDispatches, QueueDispatches, device); }
+    inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkCommandBuffer cmdBuffer)       { return LookupDispatch(DeviceDispatches, CommandBufferDispatches, cmdBuffer); }
+
+    // Only for layers with a DeviceOverrides::CommandBufferState.
+    // Goes through the same per-thread cache as LookupDispatch. There is no
+    // dispatch key or single owner to go by, each command buffer has an entry
+    // of its own, and one that isn't tracked has to come back as null.
+    inline const VkCommandBufferEntry* LookupCommandBufferEntry(VkCommandBuffer cmdBuffer) {
+      auto lookup = [](VkCommandBuffer cmdBuffer) { return CommandBufferEntries.find(cmdBuffer); };
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+      return VkDispatchCache<VkCommandBuffer, VkCommandBufferEntry>::lookup(cmdBuffer, lookup);
+#else
+      return lookup(cmdBuffer);
+#endif
+    }
+
+    template <typename State>
+    inline State* LookupCommandBufferState(VkCommandBuffer cmdBuffer) {
+      const VkCommandBufferEntry* entry = LookupCommandBufferEntry(cmdBuffer);
+      return entry ? &entry->CommandBufferState<State>() : nullptr;
+    }
+
+    inline void CreateDispatchTable(PFN_vkGetInstanceProcAddr nextInstanceProcAddr, PFN_GetPhysicalDeviceProcAddr nextPhysDevProcAddr, VkInstance instance);
+    inline void CreateDispatchTable(const VkDeviceCreateInfo* pCreateInfo, PFN_vkGetDeviceProcAddr nextProcAddr, VkPhysicalDevice physicalDevice, VkDevice device);
+    inline void DestroyDispatchTable(VkInstance instance);
+    inline void DestroyDispatchTable(VkDevice device);
+    inline void RegisterCommandBuffers(const VkDeviceDispatch* deviceDispatch, const VkCommandBufferStateType* stateType, const VkCommandBufferAllocateInfo* pAllocateInfo, const VkCommandBuffer* pCommandBuffers);
+    inline void UnregisterCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers);
+    inline void UnregisterCommandPool(VkDevice device, VkCommandPool commandPool);
+  }
+
+  namespace procaddr {
+    // Minimal perfect hash over the entrypoint names, the tables are generated
+    // by make_vkroots. The name is hashed once, its bucket's seed picks the
+    // slot and a single compare confirms it.
+    // Must match proc_addr_hash and proc_addr_mix in gen/make_vkroots.
+    constexpr uint64_t Hash(const char* name) {
+      uint64_t hash = 0xcbf29ce484222325ull;
+      for (; *name; name++)
+        hash = (hash ^ uint8_t(*name)) * 0x100000001b3ull;
+      return hash;
+    }
+
+    constexpr uint32_t Mix(uint64_t hash, uint32_t seed, uint32_t count) {
+      hash ^= uint64_t(seed) * 0x9e3779b97f4a7c15ull;
+      hash ^= hash >> 32;
+      hash *= 0xd6e8feb86659fd93ull;
+      hash ^= hash >> 32;
+      return uint32_t(hash % count);
+    }
+
+    constexpr bool Equal(const char* a, const char* b) {
+      for (; *a && *a == *b; a++, b++)
+        ;
+      return *a == *b;
+    }
+
+    template <typename Func, size_t Count>
+    constexpr Func Lookup(const int32_t (&seeds)[Count], const char* const (&names)[Count], const char* name) {
+      const uint64_t hash = Hash(name);
+      const int32_t seed = seeds[Mix(hash, 0, Count)];
+      const uint32_t index = seed < 0 ? uint32_t(-(seed + 1)) : Mix(hash, uint32_t(seed), Count);
+      return Equal(names[index], name) ? Func(index) : Func::Count;
+    }
+
+    // A perfect hash like the generated one, but over only the functions
+    // IsHooked is true for, built at compile time. However many a layer
+    // hooks, a name it doesn't is turned away by a single compare, which for
+    // almost every name fails within the first few characters after "vk".
+    template <const auto& Names, auto IsHooked>
+    class HookedFuncTable {
+      template <typename T>
+      struct FuncOf;
+      template <typename T>
+      struct FuncOf<bool (*)(T)> { using Type = T; };
+      using Func = typename FuncOf<decltype(IsHooked)>::Type;
+
+      static constexpr uint32_t Count = uint32_t(Func::Count);
+
+      static constexpr uint32_t Size = [] {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < Count; i++)
+          count += IsHooked(Func(i)) ? 1 : 0;
+        return count;
+      }();
+
+      struct Table {
+        // Same scheme as build_perfect_hash in gen/make_vkroots: a negative
+        // seed is the slot of the only name in its bucket.
+        std::array<int32_t, Size> seeds{};
+        std::array<Func, Size> slots{};
+      };
+
+      static constexpr Table Build() {
+        std::array<uint64_t, Size> hashes{};
+        std::array<Func, Size> funcs{};
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < Count; i++) {
+          if (IsHooked(Func(i))) {
+            hashes[count] = Hash(Names[i]);
+            funcs[count++] = Func(i);
+          }
+        }
+
+        std::array<uint32_t, Size> bucketOf{};
+        std::array<uint32_t, Size> bucketSize{};
+        for (uint32_t i = 0; i < Size; i++)
+          bucketSize[bucketOf[i] = Mix(hashes[i], 0, Size)]++;
+
+        // Biggest buckets first, while most slots are still free.
+        std::array<uint32_t, Size> order{};
+        for (uint32_t i = 0; i < Size; i++)
+          order[i] = i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+          if (bucketSize[bucketOf[a]] != bucketSize[bucketOf[b]])
+            return bucketSize[bucketOf[a]] > bucketSize[bucketOf[b]];
+          return bucketOf[a] < bucketOf[b];
+        });
+
+        Table table{};
+        std::array<bool, Size> used{};
+        uint32_t start = 0;
+        for (; start < Size && bucketSize[bucketOf[order[start]]] > 1; start += bucketSize[bucketOf[order[start]]]) {
+          const uint32_t bucket = bucketOf[order[start]];
+          const uint32_t size = bucketSize[bucket];
+          for (uint32_t seed = 1;; seed++) {
+            uint32_t placed = 0;
+            for (; placed < size; placed++) {
+              const uint32_t slot = Mix(hashes[order[start + placed]], seed, Size);
+              if (used[slot])
+                break;
+              used[slot] = true;
+            }
+            if (placed == size) {
+              for (uint32_t i = start; i < start + size; i++)
+                table.slots[Mix(hashes[order[i]], seed, Size)] = funcs[order[i]];
+              table.seeds[bucket] = int32_t(seed);
+              break;
+            }
+            while (placed--)
+              used[Mix(hashes[order[start + placed]], seed, Size)] = false;
+          }
+        }
+
+        uint32_t freeSlot = 0;
+        for (; start < Size; start++) {
+          while (used[freeSlot])
+            freeSlot++;
+          used[freeSlot] = true;
+          table.slots[freeSlot] = funcs[order[start]];
+          table.seeds[bucketOf[order[start]]] = -int32_t(freeSlot + 1);
+        }
+        return table;
+      }
+
+      static constexpr Table Hooked = Build();
+
+    public:
+      // Returns Func::Count for anything we don't hook, the caller falls through to the next layer.
+      static constexpr Func Find(const char* name) {
+        if constexpr (Size == 0) {
+          return Func::Count;
+        } else {
+          const uint64_t hash = Hash(name);
+          const int32_t seed = Hooked.seeds[Mix(hash, 0, Size)];
+          const Func func = Hooked.slots[seed < 0 ? uint32_t(-(seed + 1)) : Mix(hash, uint32_t(seed), Size)];
+          return Equal(Names[uint32_t(func)], name) ? func : Func::Count;
+        }
+      }
+    };
   }
 
   struct VkInstanceProcAddrFuncs {
@@ -194,7 +1087,7 @@ namespace vkroots {
     PFN_vkGetPhysicalDeviceProcAddr NextGetPhysicalDeviceProcAddr;
   };
 
-  static inline VkResult GetProcAddrs(const VkInstanceCreateInfo* pInfo, VkInstanceProcAddrFuncs *pOutFuncs) {
+  inline VkResult GetProcAddrs(const VkInstanceCreateInfo* pInfo, VkInstanceProcAddrFuncs *pOutFuncs) {
     const void* pNext = (const void*) pInfo;
     const VkLayerInstanceCreateInfo* layerInfo;
     while ((layerInfo = FindInChain<const VkLayerInstanceCreateInfo>(pNext)) && layerInfo->function != VK_LAYER_LINK_INFO)
@@ -210,7 +1103,7 @@ namespace vkroots {
     return VK_SUCCESS;
   }
 
-  static inline VkResult GetProcAddrs(const VkDeviceCreateInfo* pInfo, PFN_vkGetDeviceProcAddr *pOutAddr) {
+  inline VkResult GetProcAddrs(const VkDeviceCreateInfo* pInfo, PFN_vkGetDeviceProcAddr *pOutAddr) {
     const void* pNext = (const void*) pInfo;
     const VkLayerDeviceCreateInfo* layerInfo;
     while ((layerInfo = FindInChain<const VkLayerDeviceCreateInfo>(pNext)) && layerInfo->function != VK_LAYER_LINK_INFO)
@@ -11,128 +11,157 @@ namespace vkroots {
     return in;
   }
 
+  // Refers to a callable without owning or copying it, so it is the size of
+  // two pointers however big the callable is, and never allocates. The
+  // callable has to outlive it, as one passed as a function argument does for
+  // the duration of the call, which is all the ChainPatcher constructors
+  // take it for. Don't store one, use constexpr_function for that.
   template <class R, class... TArgs>
-  class constexpr_function<R(TArgs...)> {
-
-  //lamda holding base+derived classes use the "Simulated C++ Interface Template Pattern"
-  //approach described here: https://www.codeproject.com/articles/603818/cplusplus-runtime-polymorphism-without-virtual-fun
-  //to avoid using virtual functions to reduce the amount of indirection at runtime
-  struct interface {
-	typedef R (*PFN_RUN_T)(const void* const, TArgs...);
- 
-    PFN_RUN_T m_pfnRun_T;
- 
-    template<typename T> 
-    static constexpr R VKROOTS_INLINE_ATTR Run_T( const void* const pObj, TArgs... args ) {
-      return static_cast<const T* const>(pObj)->siRun( args... ); }
-
-    constexpr interface() : m_pfnRun_T( 0 ) {}
-     
- 
-    constexpr R VKROOTS_FLATTEN_ATTR siRun(  TArgs... args ) const {
-      return (*m_pfnRun_T)( this, args... );
-    }
-
-    protected:
-      template<typename T>
-      constexpr void Init() {
-        m_pfnRun_T = (PFN_RUN_T) &Run_T<T>;
-      }
+  class function_ref<R(TArgs...)> {
+  public:
+    template <class Fn> requires (std::invocable<Fn&, TArgs...> || ConceptNullFunc<Fn, R>) && (!std::is_same_v<std::remove_cvref_t<Fn>, function_ref>)
+    constexpr function_ref(Fn&& fn)
+      : m_obj{ std::addressof(fn) }
+      , m_pfnRun{ &Run<std::remove_reference_t<Fn>> } {
+    }
+
+    constexpr R VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const {
+      return m_pfnRun(m_obj, std::forward<TArgs>(args)...);
+    }
+
+    constexpr operator bool() {
+      return true;
+    }
+
+  private:
+    template <class Fn>
+    static constexpr R VKROOTS_INLINE_ATTR Run(const void* pObj, TArgs... args) {
+      return (*static_cast<Fn*>(const_cast<void*>(pObj)))(std::forward<TArgs>(args)...);
+    }
+
+    const void* m_obj;
+    R (*m_pfnRun)(const void*, TArgs...);
   };
 
-  template <typename Fn>
-  struct implementation final : interface {
-    friend struct interface;
-    
-    constexpr implementation( Fn fn) : fn{fn} {
-      interface::template Init<implementation>();
-    }
-    
-    /*constexpr ~implementation() {
-      this->~fn();
-    }*/
-    
-    /*consteval const interface& getParent() {
-    	return static_cast<interface>(*this);
-    }*/
-    
-    //consteval implementation() : fn{ .padding={} } {}
-   
-    constexpr implementation(const implementation& __restrict__ other) : fn{other.fn} {
-    	interface::template Init<implementation>();
-    }
-    
-    constexpr const implementation<Fn>& operator=(const implementation<Fn>& __retrict__ ) const {
-        return std::move(*this);
-    }
-    
-    private:
-      constexpr R VKROOTS_FLATTEN_ATTR siRun( TArgs... args ) const { 
-        return (fn)(args...);
+  // Owns a copy of the callable, so unlike function_ref it can be stored and
+  // outlive what it was made from. The copy lives in an in-place buffer of
+  // Capacity bytes and is called through a plain function pointer, so it never
+  // allocates and has no virtual dispatch. A callable that doesn't fit is a
+  // compile error, give such one a bigger Capacity.
+  // Being type erased into raw storage, it can't be used in constant
+  // expressions, the in-place form below can.
+  template <size_t Capacity, class R, class... TArgs>
+  class constexpr_function<R(TArgs...), void, Capacity> {
+  public:
+    template <class Fn> requires std::invocable<Fn&, TArgs...> && (!std::is_same_v<std::remove_cvref_t<Fn>, constexpr_function>)
+    constexpr_function(Fn&& fn) {
+      using T = std::remove_cvref_t<Fn>;
+      static_assert(sizeof(T) <= Capacity, "Callable is too big for this constexpr_function's Capacity.");
+      static_assert(alignof(T) <= alignof(std::max_align_t), "Callable is over-aligned.");
+      ::new (static_cast<void*>(m_storage)) T(std::forward<Fn>(fn));
+      m_pfnRun    = &Run<T>;
+      m_pfnManage = &Manage<T>;
+    }
+
+    constexpr_function(const constexpr_function& other)
+      : m_pfnRun{ other.m_pfnRun }
+      , m_pfnManage{ other.m_pfnManage } {
+      if (m_pfnManage)
+        m_pfnManage(Op::Copy, m_storage, other.m_storage);
+    }
+
+    constexpr_function(constexpr_function&& other)
+      : m_pfnRun{ std::exchange(other.m_pfnRun, nullptr) }
+      , m_pfnManage{ std::exchange(other.m_pfnManage, nullptr) } {
+      if (m_pfnManage)
+        m_pfnManage(Op::Move, m_storage, other.m_storage);
+    }
+
+    constexpr_function& operator=(const constexpr_function& other) {
+      if (this != &other) {
+        this->~constexpr_function();
+        ::new (static_cast<void*>(this)) constexpr_function(other);
+      }
+      return *this;
+    }
+
+    constexpr_function& operator=(constexpr_function&& other) {
+      if (this != &other) {
+        this->~constexpr_function();
+        ::new (static_cast<void*>(this)) constexpr_function(std::move(other));
       }
+      return *this;
+    }
 
-    protected:
-      /*struct alignas(8) fn_internal_t {
-        union {
-          Fn fn;
-          char padding[std::max(sizeof(Fn), sizeof(int32_t))];
-        };
-      };
-      [[no_unique_address]] fn_internal_t fn;*/
-      Fn fn;
+    ~constexpr_function() {
+      if (m_pfnManage)
+        m_pfnManage(Op::Destroy, m_storage, nullptr);
+    }
+
+    R VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const {
+      return m_pfnRun(m_storage, std::forward<TArgs>(args)...);
+    }
+
+    // Only a moved-from one is empty.
+    operator bool() const {
+      return m_pfnRun != nullptr;
+    }
+
+  private:
+    enum class Op {
+      Copy,
+      // Also destroys the source.
+      Move,
+      Destroy,
+    };
+
+    template <class T>
+    static R VKROOTS_INLINE_ATTR Run(void* pObj, TArgs... args) {
+      return (*static_cast<T*>(pObj))(std::forward<TArgs>(args)...);
+    }
+
+    template <class T>
+    static void Manage(Op op, void* pDst, void* pSrc) {
+      switch (op) {
+        case Op::Copy:
+          ::new (pDst) T(*static_cast<const T*>(pSrc));
+          break;
+        case Op::Move:
+          ::new (pDst) T(std::move(*static_cast<T*>(pSrc)));
+          static_cast<T*>(pSrc)->~T();
+          break;
+        case Op::Destroy:
+          static_cast<T*>(pDst)->~T();
+          break;
+      }
+    }
+
+    alignas(std::max_align_t) mutable std::byte m_storage[Capacity];
+    R (*m_pfnRun)(void*, TArgs...) = nullptr;
+    void (*m_pfnManage)(Op, void*, void*) = nullptr;
   };
 
- public:
-  //constexpr constexpr_function(const constexpr_function& __restrict__ other) : m_fn{other.m_fn} {}
-  //consteval constexpr_function(size_t size) : buf{size} {}
-
-  /*template <typename Fn>
-  constexpr const implementation<Fn>* const implOnStack(Fn& fn) {
-    return new (buf.data()) implementation<Fn>(fn);
-  }*/
-
-  template <typename Fn>
-  constexpr const interface* const getInterface(Fn& fn) {
-    if constexpr ( requires { new (bufOne) implementation<Fn>(fn); } ) 
-      return (static_cast<const interface* const>(new (bufOne) implementation<Fn>(fn)));
-    if constexpr ( requires { new (bufTwo) implementation<Fn>(fn); } ) 
-      return (static_cast<const interface* const>(new (bufTwo) implementation<Fn>(fn)));
-    if constexpr ( requires { new (bufThree) implementation<Fn>(fn); } ) 
-      return (static_cast<const interface* const>(new (bufThree) implementation<Fn>(fn)));
-  }
-  
-  template <typename Fn>
-  static constexpr size_t getSize() {
-    return sizeof(implementation<Fn>)/sizeof(std::byte);
-  }
-  
-  //constexpr ~constexpr_function() {}
-
-  template <class Fn> requires std::invocable<Fn, TArgs...> || ConceptNullFunc<Fn, R>
-  constexpr constexpr_function(Fn fn) : m_fn{ getInterface(fn) }  {}
-  //constexpr  constexpr_function(Fn fn) : 
-  constexpr auto VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const -> R {
-	 if constexpr (sizeof...(TArgs) == 0)
-	 	return (m_fn->siRun)();
-	 else if constexpr (sizeof...(TArgs) != 0) {
-	    return (m_fn->siRun)(args...);
-	 } else {
-	    __builtin_unreachable();
-	 }
-  }
-  constexpr operator bool() {
-  	return true;
-  }
+  // Holds the callable in place, so it is exactly the size of the callable and
+  // calls it directly. This is what `constexpr_function f = [](...) { ... };`
+  // deduces to, and it converts to either of the above.
+  template <class R, class Fn, class... TArgs> requires (!std::is_void_v<Fn>)
+  class constexpr_function<R(TArgs...), Fn> {
+  public:
+    constexpr constexpr_function(Fn fn)
+      : m_fn{ std::move(fn) } {
+    }
 
- private:
-  union {
-    [[no_unique_address]] char bufOne[4000];
-    [[no_unique_address]] char bufTwo[8000];
-    [[no_unique_address]] char bufThree[16000];
+    constexpr R VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const {
+      return m_fn(std::forward<TArgs>(args)...);
+    }
+
+    constexpr operator bool() {
+      return true;
+    }
+
+  private:
+    [[no_unique_address]] Fn m_fn;
   };
- 
-  [[no_unique_address]] const interface* m_fn{};
-};// end of constexpr_func class
 } // vkroots
 
 #undef VKROOTS_INLINE_ATTR
@@ -321,7 +350,7 @@ namespace vkroots::helpers {
 
 namespace vkroots {
 #if VKROOTS_USE_CONSTEXPR_FUNC
-  #define VKROOTS_CHAINPATCHER_FUNC constexpr_function
+  #define VKROOTS_CHAINPATCHER_FUNC function_ref
   #define VKROOTS_CHAINPATCHER_ATTR constexpr
 #else
   #define VKROOTS_CHAINPATCHER_FUNC std::function
@@ -331,8 +360,30 @@ namespace vkroots {
   template <typename Type, typename UserData = uint64_t>
   class ChainPatcher {
   public:
+    // Lambdas and other callables are called directly, without being type-erased.
+    template <typename AnyStruct, typename Fn> requires std::invocable<Fn&, UserData&, Type *>
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, Fn&& func) {
+      patch(obj, func);
+    }
+
+    template <typename AnyStruct, typename Fn> requires std::invocable<Fn&, Type *> && (!std::invocable<Fn&, UserData&, Type *>)
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, Fn&& func) {
+      patch(obj, [&func](UserData&, Type *obj) { return func(obj); });
+    }
+
     template <typename AnyStruct>
     VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, VKROOTS_CHAINPATCHER_FUNC<bool(UserData&, Type *)> func) {
+      patch(obj, func);
+    }
+
+    template <typename AnyStruct>
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, VKROOTS_CHAINPATCHER_FUNC<bool(Type *)> func) {
+      patch(obj, [&func](UserData&, Type *obj) { return func(obj); });
+    }
+
+  private:
+    template <typename AnyStruct, typename Fn>
+    VKROOTS_CHAINPATCHER_ATTR void patch(const AnyStruct * __restrict__ obj, Fn&& func) {
       const Type * __restrict__ type = vkroots::FindInChain<Type>(obj);
       if (type) {
         func(m_ctx, const_cast<Type *>(type));
@@ -345,14 +396,74 @@ namespace vkroots {
       }
     }
 
+    Type m_value{};
+    UserData m_ctx;
+  };
+
+  // Finds or adds several structs in a pNext chain in one walk over it, with
+  // the added ones stored in the builder itself, eg.
+  //   vkroots::ChainBuilder<VkPhysicalDeviceVulkan12Features, VkPhysicalDeviceVulkan13Features> builder(pCreateInfo);
+  //   builder.get<VkPhysicalDeviceVulkan12Features>()->timelineSemaphore = VK_TRUE;
+  //   builder.get<VkPhysicalDeviceVulkan13Features>()->dynamicRendering = VK_TRUE;
+  //   return pDispatch->CreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+  // Structs that weren't in the chain are value-initialized and linked in
+  // after obj, whose original pNext is put back when the builder goes away.
+  template <typename... Types>
+  class ChainBuilder {
+  public:
+    static_assert(STypesAreUnique<Types...>(), "Each struct type can only be added once.");
+
     template <typename AnyStruct>
-    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, VKROOTS_CHAINPATCHER_FUNC<bool(Type *)> func)
-      : ChainPatcher(obj, [func](UserData& ctx, Type *obj) { return func(obj); }) {
+    ChainBuilder(const AnyStruct* obj) {
+      static_assert(TypeIsSinglePointer<decltype(obj)>());
+
+      size_t remaining = sizeof...(Types);
+      for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(const_cast<AnyStruct*>(obj))->pNext; header && remaining; header = header->pNext)
+        MatchInChain<Types...>(header, m_found, remaining, std::index_sequence_for<Types...>{});
+
+      if (remaining) {
+        m_pObj = reinterpret_cast<VkBaseOutStructure*>(const_cast<AnyStruct*>(obj));
+        m_pOriginalNext = m_pObj->pNext;
+        link(std::index_sequence_for<Types...>{});
+      }
+    }
+
+    ~ChainBuilder() {
+      if (m_pObj)
+        m_pObj->pNext = m_pOriginalNext;
+    }
+
+    ChainBuilder(const ChainBuilder&) = delete;
+    ChainBuilder& operator = (const ChainBuilder&) = delete;
+
+    template <typename Type>
+    Type* get() const {
+      return std::get<Type*>(m_found);
+    }
+
+    template <typename Type>
+    bool added() const {
+      return std::get<Type*>(m_found) == &std::get<Type>(m_values);
     }
 
   private:
-    Type m_value{};
-    UserData m_ctx;
+    template <size_t... Indices>
+    void link(std::index_sequence<Indices...>) {
+      auto add = [this]<size_t Index>(std::integral_constant<size_t, Index>) {
+        if (std::get<Index>(m_found))
+          return;
+        auto& value = std::get<Index>(m_values);
+        value.sType = ResolveSType<std::tuple_element_t<Index, std::tuple<Types...>>>();
+        value.pNext = std::exchange(m_pObj->pNext, reinterpret_cast<VkBaseOutStructure*>(&value));
+        std::get<Index>(m_found) = &value;
+      };
+      (add(std::integral_constant<size_t, Indices>{}), ...);
+    }
+
+    std::tuple<Types...> m_values{};
+    std::tuple<Types*...> m_found{};
+    VkBaseOutStructure* m_pObj = nullptr;
+    VkBaseOutStructure* m_pOriginalNext = nullptr;
   };
   
   #undef VKROOTS_CHAINPATCHER_FUNC
@@ -0,0 +1,35 @@
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult implicit_wrap_AllocateCommandBuffers(
+          VkDevice                     device,
+    const VkCommandBufferAllocateInfo* pAllocateInfo,
+          VkCommandBuffer*             pCommandBuffers) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = dispatch->AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    if (ret == VK_SUCCESS)
+      tables::RegisterCommandBuffers(dispatch, tables::CommandBufferStateTypeOf<DeviceOverrides>(), pAllocateInfo, pCommandBuffers);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void implicit_wrap_FreeCommandBuffers(
+          VkDevice                     device,
+          VkCommandPool                commandPool,
+          uint32_t                     commandBufferCount,
+    const VkCommandBuffer*             pCommandBuffers) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    // Unregister first, the handles can be handed out again as soon as they're freed.
+    tables::UnregisterCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+    dispatch->FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void implicit_wrap_DestroyCommandPool(
+          VkDevice                     device,
+          VkCommandPool                commandPool,
+    const VkAllocationCallbacks*       pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    // Destroying a pool frees every command buffer allocated from it.
+    tables::UnregisterCommandPool(device, commandPool);
+    dispatch->DestroyCommandPool(device, commandPool, pAllocator);
+  }
@@ -1,6 +1,6 @@
 
   template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
-  static VkResult implicit_wrap_CreateDevice(
+  inline VkResult implicit_wrap_CreateDevice(
             VkPhysicalDevice       physicalDevice,
       const VkDeviceCreateInfo*    pCreateInfo,
       const VkAllocationCallbacks* pAllocator,
@@ -10,9 +10,19 @@
     VkResult procAddrRes = GetProcAddrs(pCreateInfo, &deviceProcAddr);
     if (procAddrRes != VK_SUCCESS)
       return procAddrRes;
+#if VKROOTS_USE_CREATE_TIMINGS
+    tables::VkCreateTimer createTimer;
+#endif
     VkResult ret = dispatch->CreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
-    if (ret == VK_SUCCESS)
+#if VKROOTS_USE_CREATE_TIMINGS
+    const std::chrono::nanoseconds createTime = createTimer.Elapsed();
+#endif
+    if (ret == VK_SUCCESS) {
       tables::CreateDispatchTable(pCreateInfo, deviceProcAddr, physicalDevice, *pDevice);
+#if VKROOTS_USE_CREATE_TIMINGS
+      tables::LookupDeviceDispatch(*pDevice)->CreateTimings.Create = createTime;
+#endif
+    }
     return ret;
   }
 
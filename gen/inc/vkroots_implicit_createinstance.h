@@ -1,6 +1,6 @@
 
   template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
-  static VkResult implicit_wrap_CreateInstance(
+  inline VkResult implicit_wrap_CreateInstance(
     const VkInstanceCreateInfo*  pCreateInfo,
     const VkAllocationCallbacks* pAllocator,
           VkInstance*            pInstance) {
@@ -9,9 +9,19 @@
     if (procAddrRes != VK_SUCCESS)
       return procAddrRes;
     PFN_vkCreateInstance createInstanceProc = (PFN_vkCreateInstance) instanceProcAddrFuncs.NextGetInstanceProcAddr(nullptr, "vkCreateInstance");
+#if VKROOTS_USE_CREATE_TIMINGS
+    tables::VkCreateTimer createTimer;
+#endif
     VkResult ret = createInstanceProc(pCreateInfo, pAllocator, pInstance);
-    if (ret == VK_SUCCESS)
+#if VKROOTS_USE_CREATE_TIMINGS
+    const std::chrono::nanoseconds createTime = createTimer.Elapsed();
+#endif
+    if (ret == VK_SUCCESS) {
       tables::CreateDispatchTable(instanceProcAddrFuncs.NextGetInstanceProcAddr, instanceProcAddrFuncs.NextGetPhysicalDeviceProcAddr, *pInstance);
+#if VKROOTS_USE_CREATE_TIMINGS
+      tables::LookupInstanceDispatch(*pInstance)->CreateTimings.Create = createTime;
+#endif
+    }
     return ret;
   }
 
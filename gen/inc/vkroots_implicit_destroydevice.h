@@ -1,6 +1,6 @@
 
   template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
-  static void implicit_wrap_DestroyDevice(
+  inline void implicit_wrap_DestroyDevice(
           VkDevice               device,
     const VkAllocationCallbacks* pAllocator) {
     const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
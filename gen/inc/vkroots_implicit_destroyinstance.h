@@ -1,6 +1,6 @@
 
   template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
-  static void implicit_wrap_DestroyInstance(
+  inline void implicit_wrap_DestroyInstance(
           VkInstance             instance,
     const VkAllocationCallbacks* pAllocator) {
     const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
@@ -7,20 +7,28 @@
 #include <vulkan/vk_layer.h>
 #include <vulkan/vulkan.h>
 
+#include <cstddef>
 #include <cstring>
 #include <unordered_map>
 #include <memory>
+#include <new>
 #include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <memory>
 #include <cassert>
 #include <vector>
 #include <utility>
 #include <optional>
+#include <tuple>
 #include <string_view>
 #include <array>
 #include <functional>
 #include <bit>
+#include <atomic>
+#include <algorithm>
+#include <bitset>
+#include <chrono>
 
 #define VKROOTS_VERSION_MAJOR 0
 #define VKROOTS_VERSION_MINOR 1
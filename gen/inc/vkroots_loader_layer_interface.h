@@ -51,3 +51,19 @@ namespace vkroots {
   VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL VKROOTS_NEGOTIATION_INTERFACE(VkNegotiateLayerInterface* pVersionStruct) {            \
     return vkroots::NegotiateLoaderLayerInterfaceVersion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(pVersionStruct); \
   }
+
+// For layers split across many TUs. Put VKROOTS_EXTERN_LAYER_INTERFACES in a
+// header every TU includes and VKROOTS_INSTANTIATE_LAYER_INTERFACES in exactly
+// one source, and the resolvers and every wrapper they reference are compiled
+// once for the given overrides instead of in each TU that uses them.
+#define VKROOTS_EXTERN_LAYER_INTERFACES(InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides)                                                            \
+  extern template PFN_vkVoidFunction vkroots::GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*);       \
+  extern template PFN_vkVoidFunction vkroots::GetPhysicalDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*); \
+  extern template PFN_vkVoidFunction vkroots::GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkDevice, const char*);           \
+  extern template VkResult vkroots::NegotiateLoaderLayerInterfaceVersion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkNegotiateLayerInterface*);
+
+#define VKROOTS_INSTANTIATE_LAYER_INTERFACES(InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides)                                                       \
+  template PFN_vkVoidFunction vkroots::GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*);              \
+  template PFN_vkVoidFunction vkroots::GetPhysicalDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*);        \
+  template PFN_vkVoidFunction vkroots::GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkDevice, const char*);                  \
+  template VkResult vkroots::NegotiateLoaderLayerInterfaceVersion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkNegotiateLayerInterface*);
@@ -0,0 +1,232 @@
+namespace vkroots {
+
+  // A serialized struct is a deep copy of it with every pointer in it swapped
+  // for an offset from the start of the blob, after this header.
+  struct SerializedHeader {
+    uint32_t magic;
+    uint32_t rootSize;
+    uint64_t size;
+  };
+
+  inline constexpr uint32_t SerializedMagic = 0x3152'4b56; // "VKR1"
+
+  // Swaps the pointers in a blob between addresses and offsets, in the same
+  // order deepCopy laid things out. Each one has to point exactly where the
+  // next piece of the layout goes, which keeps everything in bounds and
+  // rules out overlaps and loops in blobs that have been tampered with.
+  class PointerRelocator {
+  public:
+    enum Direction {
+      ToOffsets,
+      ToAddresses,
+    };
+
+    PointerRelocator(void* pData, size_t size, size_t offset, Direction direction)
+      : m_pBase{ static_cast<std::byte*>(pData) }
+      , m_size{ size }
+      , m_offset{ offset }
+      , m_direction{ direction } {
+    }
+
+    // Returns where field points, without claiming it, so the sType of the
+    // next struct in a chain can be read.
+    template <typename T, typename P>
+    const T* peek(P field) {
+      if (!field || m_failed)
+        return nullptr;
+
+      const size_t offset = offsetOf(field);
+      if (offset < m_offset || offset > m_size || m_size - offset < sizeof(T)) {
+        m_failed = true;
+        return nullptr;
+      }
+      return reinterpret_cast<const T*>(m_pBase + offset);
+    }
+
+    // Relocates field, which points to count Ts, and returns their address.
+    template <typename T, typename P>
+    T* relocate(P& field, size_t count) {
+      static_assert(std::is_pointer_v<P>);
+
+      if (!field || m_failed)
+        return nullptr;
+
+      const size_t offset = (m_offset + alignof(T) - 1) & ~(alignof(T) - 1);
+      if (offsetOf(field) != offset || offset > m_size || count > (m_size - offset) / sizeof(T)) {
+        m_failed = true;
+        return nullptr;
+      }
+      m_offset = offset + sizeof(T) * count;
+
+      T* ptr = reinterpret_cast<T*>(m_pBase + offset);
+      field = m_direction == ToOffsets ? reinterpret_cast<P>(offset) : reinterpret_cast<P>(ptr);
+      return ptr;
+    }
+
+    template <typename P>
+    void string(P& field) {
+      const char* pString = peek<char>(field);
+      if (!pString)
+        return;
+
+      const size_t offset = pString - reinterpret_cast<const char*>(m_pBase);
+      const void* pEnd = std::memchr(pString, '\0', m_size - offset);
+      if (!pEnd) {
+        m_failed = true;
+        return;
+      }
+      relocate<char>(field, static_cast<const char*>(pEnd) - pString + 1);
+    }
+
+    bool failed() const {
+      return m_failed;
+    }
+
+    void fail() {
+      m_failed = true;
+    }
+
+  private:
+    template <typename P>
+    size_t offsetOf(P field) const {
+      if (m_direction == ToOffsets)
+        return reinterpret_cast<const std::byte*>(field) - m_pBase;
+      return reinterpret_cast<uintptr_t>(field);
+    }
+
+    std::byte* m_pBase;
+    size_t m_size;
+    size_t m_offset;
+    Direction m_direction;
+    bool m_failed = false;
+  };
+
+  // Structs without any pointers have nothing to relocate.
+  // make_vkroots specializes this for every struct that does.
+  template <typename T>
+  struct RelocateTraits {
+    static void relocate(T&, PointerRelocator&) {}
+  };
+
+  // sTypes are read as plain integers, a blob may hold any value there.
+  inline uint32_t ReadSType(const void* pStruct) {
+    uint32_t sType;
+    std::memcpy(&sType, pStruct, sizeof(sType));
+    return sType;
+  }
+
+  inline void RelocateNextStruct(uint32_t sType, const void*& pNext, PointerRelocator& relocator);
+
+  template <typename P>
+  void RelocateNext(P& pNext, PointerRelocator& relocator) {
+    if (const VkBaseInStructure* header = relocator.peek<VkBaseInStructure>(pNext)) {
+      const void* pRelocated = pNext;
+      RelocateNextStruct(ReadSType(header), pRelocated, relocator);
+      pNext = static_cast<P>(const_cast<void*>(pRelocated));
+    }
+  }
+
+  template <typename T>
+  void RelocateStruct(const void*& pNext, PointerRelocator& relocator) {
+    if (T* ptr = relocator.relocate<T>(pNext, 1))
+      RelocateTraits<T>::relocate(*ptr, relocator);
+  }
+
+  template <typename P>
+  void RelocateArray(P& field, size_t count, PointerRelocator& relocator) {
+    using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+    if (T* ptr = relocator.relocate<T>(field, count)) {
+      for (size_t i = 0; i < count; i++)
+        RelocateTraits<T>::relocate(ptr[i], relocator);
+    }
+  }
+
+  template <typename P>
+  void RelocatePointerArray(P& field, size_t count, PointerRelocator& relocator) {
+    using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+    if (T* ptr = relocator.relocate<T>(field, count)) {
+      for (size_t i = 0; i < count; i++)
+        RelocateArray(ptr[i], 1, relocator);
+    }
+  }
+
+  template <typename P>
+  void RelocateStringArray(P& field, size_t count, PointerRelocator& relocator) {
+    using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+    if (T* ptr = relocator.relocate<T>(field, count)) {
+      for (size_t i = 0; i < count; i++)
+        relocator.string(ptr[i]);
+    }
+  }
+
+  template <typename T>
+  size_t SerializedRootOffset() {
+    size_t offset = 0;
+    DeepCopyReserve<SerializedHeader>(offset, 1);
+    DeepCopyReserve<T>(offset, 0);
+    return offset;
+  }
+
+  // Writes src, everything its pointers point to and its pNext chain into
+  // pData as a single blob without any pointers in it, and returns the size
+  // that needs. Nothing is written if size is smaller than that.
+  // pData must be aligned to alignof(std::max_align_t).
+  // Opaque pointers such as pUserData and handles are written as they are,
+  // so they only mean something in the process that wrote them.
+  template <typename T>
+  size_t serialize(const T& src, void* pData, size_t size) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+
+    size_t needed = SerializedRootOffset<T>();
+    DeepCopyStructSize(src, needed);
+    if (!pData || size < needed)
+      return needed;
+
+    assert(reinterpret_cast<uintptr_t>(pData) % alignof(std::max_align_t) == 0);
+    DeepCopyCursor cursor{ pData };
+    *cursor.take<SerializedHeader>(1) = SerializedHeader{ SerializedMagic, uint32_t(sizeof(T)), needed };
+    T* dst = DeepCopyStruct(src, cursor);
+
+    PointerRelocator relocator{ pData, needed, SerializedRootOffset<T>() + sizeof(T), PointerRelocator::ToOffsets };
+    RelocateTraits<T>::relocate(*dst, relocator);
+    assert(!relocator.failed());
+    return needed;
+  }
+
+  template <typename T>
+  std::vector<std::byte> serialize(const T& src) {
+    std::vector<std::byte> data(serialize(src, nullptr, 0));
+    serialize(src, data.data(), data.size());
+    return data;
+  }
+
+  // Turns a blob written by serialize back into a T, in place: the offsets in
+  // it are swapped for pointers into pData, nothing is allocated or copied.
+  // pData has to be writable (eg. a MAP_PRIVATE mapping), aligned to
+  // alignof(std::max_align_t), and outlive the T.
+  // Returns nullptr if pData isn't a valid blob of a T from the same ABI, in
+  // which case it may be left half relocated.
+  template <typename T>
+  T* deserialize(void* pData, size_t size) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+    assert(reinterpret_cast<uintptr_t>(pData) % alignof(std::max_align_t) == 0);
+
+    const size_t rootOffset = SerializedRootOffset<T>();
+    const SerializedHeader* header = static_cast<const SerializedHeader*>(pData);
+    if (size < rootOffset + sizeof(T) || header->magic != SerializedMagic || header->rootSize != sizeof(T))
+      return nullptr;
+    if (header->size < rootOffset + sizeof(T) || header->size > size)
+      return nullptr;
+
+    T* root = reinterpret_cast<T*>(static_cast<std::byte*>(pData) + rootOffset);
+    if constexpr (requires { root->sType; }) {
+      if (ReadSType(root) != uint32_t(ResolveSType<T>()))
+        return nullptr;
+    }
+
+    PointerRelocator relocator{ pData, header->size, rootOffset + sizeof(T), PointerRelocator::ToAddresses };
+    RelocateTraits<T>::relocate(*root, relocator);
+    return relocator.failed() ? nullptr : root;
+  }
+
+}
@@ -0,0 +1,10 @@
+// The vkroots.h header is licensed under Apache-2.0 OR MIT
+// as it was generated from the Vulkan Registry, which is licensed
+// under the same license.
+
+#pragma once
+
+// Everything in vkroots. TUs which only need part of it can include
+// the pieces in the vkroots directory directly, e.g. vkroots/stypes.h
+// for FindInChain or vkroots/helpers.h for SynchronizedMapObject.
+
@@ -339,6 +339,8 @@ class VkFunction(object):
         self.type = _type
         self.params = params
         self.alias = alias
+        # Core version which first requires this function, e.g. VK_VERSION_1_1.
+        self.feature = None
 
         # Required is set while parsing which APIs and types are required
         # and is used by the code generation.
@@ -1966,6 +1968,8 @@ class VkRegistry(object):
                             continue
                         name = tag.attrib["name"]
                         self._mark_command_required(name)
+                        if self.funcs[name].feature is None:
+                            self.funcs[name].feature = feature_name
                     elif tag.tag == "enum":
                         self._process_require_enum(tag)
                     elif tag.tag == "type":
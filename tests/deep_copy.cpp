@@ -0,0 +1,225 @@
+#include "vkroots.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static int failures = 0;
+
+#define CHECK(expr) do { if (!(expr)) { std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); failures++; } } while (0)
+
+static_assert(vkroots::DeepCopyTraits<VkDeviceCreateInfo>::Supported);
+static_assert(vkroots::DeepCopyTraits<VkGraphicsPipelineCreateInfo>::Supported);
+static_assert(vkroots::DeepCopyTraits<VkWriteDescriptorSet>::Supported);
+// Whether pInheritanceInfo is ignored depends on the command buffer.
+static_assert(!vkroots::DeepCopyTraits<VkCommandBufferBeginInfo>::Supported);
+
+// Stands in for pointers the spec says are ignored, which may be anything.
+template <typename T>
+static const T* Garbage() {
+  return reinterpret_cast<const T*>(uintptr_t(0xdead0000));
+}
+
+static void TestDeviceCreateInfo() {
+  const float priorities[] = { 1.0f, 0.5f };
+  VkDeviceQueueCreateInfo queueInfos[2] = {};
+  for (uint32_t i = 0; i < 2; i++) {
+    queueInfos[i].sType = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+    queueInfos[i].queueFamilyIndex = i;
+    queueInfos[i].queueCount = 2;
+    queueInfos[i].pQueuePriorities = priorities;
+  }
+
+  std::string extensions[] = { VK_KHR_SWAPCHAIN_EXTENSION_NAME, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME };
+  const char* extensionNames[] = { extensions[0].c_str(), extensions[1].c_str() };
+
+  VkPhysicalDeviceVulkan13Features features13 = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES, .dynamicRendering = VK_TRUE };
+  // Not a struct vkroots knows, so it is left out of the copy.
+  VkBaseInStructure unknown = { VkStructureType(0x7fff0000), reinterpret_cast<const VkBaseInStructure*>(&features13) };
+  VkPhysicalDeviceVulkan12Features features12 = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES, .pNext = &unknown, .timelineSemaphore = VK_TRUE };
+  VkPhysicalDeviceFeatures features = { .samplerAnisotropy = VK_TRUE };
+
+  const VkDeviceCreateInfo info = {
+    .sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+    .pNext                   = &features12,
+    .queueCreateInfoCount    = 2,
+    .pQueueCreateInfos       = queueInfos,
+    .enabledExtensionCount   = 2,
+    .ppEnabledExtensionNames = extensionNames,
+    .pEnabledFeatures        = &features,
+  };
+
+  vkroots::Arena arena;
+  const VkDeviceCreateInfo* pCopy = vkroots::deepCopy(info, arena);
+
+  // Nothing in the copy may point back at the original.
+  queueInfos[1].queueFamilyIndex = 7;
+  extensions[0].assign(extensions[0].size(), 'x');
+  features12.timelineSemaphore = VK_FALSE;
+  features13.dynamicRendering = VK_FALSE;
+  features.samplerAnisotropy = VK_FALSE;
+
+  CHECK(pCopy && pCopy != &info);
+  CHECK(pCopy->queueCreateInfoCount == 2 && pCopy->pQueueCreateInfos != queueInfos);
+  CHECK(pCopy->pQueueCreateInfos[1].queueFamilyIndex == 1);
+  CHECK(pCopy->pQueueCreateInfos[1].pQueuePriorities != priorities && pCopy->pQueueCreateInfos[1].pQueuePriorities[1] == 0.5f);
+  CHECK(pCopy->ppEnabledExtensionNames != extensionNames);
+  CHECK(!std::strcmp(pCopy->ppEnabledExtensionNames[0], VK_KHR_SWAPCHAIN_EXTENSION_NAME));
+  CHECK(!std::strcmp(pCopy->ppEnabledExtensionNames[1], VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+  CHECK(pCopy->pEnabledFeatures != &features && pCopy->pEnabledFeatures->samplerAnisotropy);
+
+  const auto* pFeatures12 = static_cast<const VkPhysicalDeviceVulkan12Features*>(pCopy->pNext);
+  CHECK(pFeatures12 != &features12 && pFeatures12->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES);
+  CHECK(pFeatures12->timelineSemaphore);
+  const auto* pFeatures13 = static_cast<const VkPhysicalDeviceVulkan13Features*>(pFeatures12->pNext);
+  CHECK(pFeatures13 != &features13 && pFeatures13->sType == VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES);
+  CHECK(pFeatures13->dynamicRendering && !pFeatures13->pNext);
+}
+
+static void TestGraphicsPipelineCreateInfo() {
+  const uint32_t specData[] = { 1, 2 };
+  const VkSpecializationMapEntry specEntries[] = { { 0, 0, 4 }, { 1, 4, 4 } };
+  const VkSpecializationInfo specInfo = { 2, specEntries, sizeof(specData), specData };
+  const VkPipelineShaderStageCreateInfo stages[] = {
+    { .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .stage = VK_SHADER_STAGE_VERTEX_BIT, .pName = "main" },
+    { .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .stage = VK_SHADER_STAGE_FRAGMENT_BIT, .pName = "main", .pSpecializationInfo = &specInfo },
+  };
+
+  const VkVertexInputBindingDescription binding = { 0, 16, VK_VERTEX_INPUT_RATE_VERTEX };
+  const VkVertexInputAttributeDescription attribute = { 0, 0, VK_FORMAT_R32G32B32A32_SFLOAT, 0 };
+  const VkPipelineVertexInputStateCreateInfo vertexInput = {
+    .sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+    .vertexBindingDescriptionCount   = 1,
+    .pVertexBindingDescriptions      = &binding,
+    .vertexAttributeDescriptionCount = 1,
+    .pVertexAttributeDescriptions    = &attribute,
+  };
+  const VkPipelineInputAssemblyStateCreateInfo inputAssembly = { .sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO, .topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST };
+  const VkRect2D scissor = { { 0, 0 }, { 64, 64 } };
+  // The viewport is dynamic, so pViewports is ignored.
+  const VkPipelineViewportStateCreateInfo viewport = {
+    .sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO,
+    .viewportCount = 1,
+    .pViewports    = Garbage<VkViewport>(),
+    .scissorCount  = 1,
+    .pScissors     = &scissor,
+  };
+  const VkPipelineRasterizationStateCreateInfo rasterization = { .sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO, .lineWidth = 1.0f };
+  const VkSampleMask sampleMask = 0x1;
+  const VkPipelineMultisampleStateCreateInfo multisample = {
+    .sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO,
+    .rasterizationSamples = VK_SAMPLE_COUNT_1_BIT,
+    .pSampleMask          = &sampleMask,
+  };
+  const VkPipelineColorBlendAttachmentState attachment = { .colorWriteMask = 0xf };
+  const VkPipelineColorBlendStateCreateInfo colorBlend = { .sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO, .attachmentCount = 1, .pAttachments = &attachment };
+  const VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_LINE_WIDTH };
+  const VkPipelineDynamicStateCreateInfo dynamic = { .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, .dynamicStateCount = 2, .pDynamicStates = dynamicStates };
+  const VkFormat colorFormat = VK_FORMAT_B8G8R8A8_UNORM;
+  const VkPipelineRenderingCreateInfo rendering = { .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO, .colorAttachmentCount = 1, .pColorAttachmentFormats = &colorFormat };
+
+  // Dynamic rendering without a depth or stencil attachment, and no
+  // tessellation shaders, so pDepthStencilState and pTessellationState are
+  // ignored.
+  const VkGraphicsPipelineCreateInfo info = {
+    .sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+    .pNext               = &rendering,
+    .stageCount          = 2,
+    .pStages             = stages,
+    .pVertexInputState   = &vertexInput,
+    .pInputAssemblyState = &inputAssembly,
+    .pTessellationState  = Garbage<VkPipelineTessellationStateCreateInfo>(),
+    .pViewportState      = &viewport,
+    .pRasterizationState = &rasterization,
+    .pMultisampleState   = &multisample,
+    .pDepthStencilState  = Garbage<VkPipelineDepthStencilStateCreateInfo>(),
+    .pColorBlendState    = &colorBlend,
+    .pDynamicState       = &dynamic,
+    .basePipelineIndex   = -1,
+  };
+
+  vkroots::Arena arena;
+  const VkGraphicsPipelineCreateInfo* pCopy = vkroots::deepCopy(&info, 1, arena);
+  CHECK(pCopy && pCopy != &info);
+  CHECK(pCopy->stageCount == 2 && pCopy->pStages != stages);
+  CHECK(pCopy->pStages[1].stage == VK_SHADER_STAGE_FRAGMENT_BIT && !std::strcmp(pCopy->pStages[1].pName, "main"));
+  CHECK(pCopy->pStages[1].pName != stages[1].pName);
+  const VkSpecializationInfo* pSpecInfo = pCopy->pStages[1].pSpecializationInfo;
+  CHECK(pSpecInfo && pSpecInfo != &specInfo && pSpecInfo->mapEntryCount == 2 && pSpecInfo->pMapEntries[1].offset == 4);
+  CHECK(pSpecInfo->pData != specData && !std::memcmp(pSpecInfo->pData, specData, sizeof(specData)));
+  CHECK(pCopy->pVertexInputState != &vertexInput && pCopy->pVertexInputState->pVertexAttributeDescriptions[0].format == VK_FORMAT_R32G32B32A32_SFLOAT);
+  CHECK(pCopy->pInputAssemblyState->topology == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+  CHECK(!pCopy->pTessellationState);
+  CHECK(!pCopy->pViewportState->pViewports && pCopy->pViewportState->pScissors->extent.width == 64);
+  CHECK(pCopy->pRasterizationState->lineWidth == 1.0f);
+  CHECK(pCopy->pMultisampleState->pSampleMask != &sampleMask && *pCopy->pMultisampleState->pSampleMask == 0x1);
+  CHECK(!pCopy->pDepthStencilState);
+  CHECK(pCopy->pColorBlendState->pAttachments[0].colorWriteMask == 0xf);
+  CHECK(pCopy->pDynamicState->dynamicStateCount == 2 && pCopy->pDynamicState->pDynamicStates[1] == VK_DYNAMIC_STATE_LINE_WIDTH);
+  CHECK(pCopy->basePipelineIndex == -1);
+  const auto* pRendering = static_cast<const VkPipelineRenderingCreateInfo*>(pCopy->pNext);
+  CHECK(pRendering != &rendering && pRendering->pColorAttachmentFormats[0] == VK_FORMAT_B8G8R8A8_UNORM);
+
+  // A fragment output interface library only has the state that goes with
+  // it, everything else is ignored.
+  const VkGraphicsPipelineLibraryCreateInfoEXT libraryInfo = {
+    .sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT,
+    .pNext = &rendering,
+    .flags = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+  };
+  const VkGraphicsPipelineCreateInfo library = {
+    .sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+    .pNext               = &libraryInfo,
+    .flags               = VK_PIPELINE_CREATE_LIBRARY_BIT_KHR,
+    .stageCount          = 5,
+    .pStages             = Garbage<VkPipelineShaderStageCreateInfo>(),
+    .pVertexInputState   = Garbage<VkPipelineVertexInputStateCreateInfo>(),
+    .pInputAssemblyState = Garbage<VkPipelineInputAssemblyStateCreateInfo>(),
+    .pViewportState      = Garbage<VkPipelineViewportStateCreateInfo>(),
+    .pRasterizationState = Garbage<VkPipelineRasterizationStateCreateInfo>(),
+    .pMultisampleState   = &multisample,
+    .pColorBlendState    = &colorBlend,
+  };
+
+  const VkGraphicsPipelineCreateInfo* pLibrary = vkroots::deepCopy(library, arena);
+  CHECK(!pLibrary->pStages && !pLibrary->pVertexInputState && !pLibrary->pInputAssemblyState);
+  CHECK(!pLibrary->pViewportState && !pLibrary->pRasterizationState);
+  CHECK(pLibrary->pMultisampleState && *pLibrary->pMultisampleState->pSampleMask == 0x1);
+  CHECK(pLibrary->pColorBlendState && pLibrary->pColorBlendState->attachmentCount == 1);
+  CHECK(static_cast<const VkGraphicsPipelineLibraryCreateInfoEXT*>(pLibrary->pNext)->flags == VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT);
+}
+
+static void TestDescriptors() {
+  const VkSampler sampler = VK_NULL_HANDLE;
+  const VkDescriptorSetLayoutBinding bindings[] = {
+    { 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL, Garbage<VkSampler>() },
+    { 1, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, 1, VK_SHADER_STAGE_ALL, &sampler },
+  };
+  const VkDescriptorSetLayoutCreateInfo layoutInfo = { .sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO, .bindingCount = 2, .pBindings = bindings };
+
+  vkroots::Arena arena;
+  const VkDescriptorSetLayoutCreateInfo* pLayoutInfo = vkroots::deepCopy(layoutInfo, arena);
+  CHECK(!pLayoutInfo->pBindings[0].pImmutableSamplers);
+  CHECK(pLayoutInfo->pBindings[1].pImmutableSamplers && pLayoutInfo->pBindings[1].pImmutableSamplers != &sampler);
+
+  const VkDescriptorBufferInfo bufferInfo = { VK_NULL_HANDLE, 256, VK_WHOLE_SIZE };
+  const VkWriteDescriptorSet write = {
+    .sType            = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,
+    .descriptorCount  = 1,
+    .descriptorType   = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+    .pImageInfo       = Garbage<VkDescriptorImageInfo>(),
+    .pBufferInfo      = &bufferInfo,
+    .pTexelBufferView = Garbage<VkBufferView>(),
+  };
+
+  const VkWriteDescriptorSet* pWrite = vkroots::deepCopy(write, arena);
+  CHECK(!pWrite->pImageInfo && !pWrite->pTexelBufferView);
+  CHECK(pWrite->pBufferInfo != &bufferInfo && pWrite->pBufferInfo->offset == 256);
+}
+
+int main() {
+  TestDeviceCreateInfo();
+  TestGraphicsPipelineCreateInfo();
+  TestDescriptors();
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,35 @@
+// Uses vkroots through `import vkroots;` rather than the header.
+//
+// The module can't export macros, so a layer's source which uses
+// VKROOTS_DEFINE_LAYER_INTERFACES still includes vkroots.h, and the rest
+// of its sources import the module.
+
+#include <vulkan/vulkan.h>
+
+#include <cstdio>
+#include <cstring>
+
+import vkroots;
+
+static int failures = 0;
+
+#define CHECK(expr) do { if (!(expr)) { std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); failures++; } } while (0)
+
+int main() {
+  VkPhysicalDeviceVulkan13Features features13 = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES };
+  VkPhysicalDeviceVulkan12Features features12 = { .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES, .pNext = &features13 };
+  VkDeviceCreateInfo createInfo = { .sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO, .pNext = &features12 };
+
+  CHECK(vkroots::FindInChain<VkPhysicalDeviceVulkan13Features>(&createInfo) == &features13);
+  CHECK(!vkroots::FindInChain<VkPhysicalDeviceVulkan11Features>(&createInfo));
+
+  auto [pFeatures12, pFeatures13] = vkroots::FindAllInChain<VkPhysicalDeviceVulkan12Features, VkPhysicalDeviceVulkan13Features>(&createInfo);
+  CHECK(pFeatures12 == &features12 && pFeatures13 == &features13);
+
+  auto [pRemoved, pParent] = vkroots::RemoveFromChain<VkPhysicalDeviceVulkan13Features>(&createInfo);
+  CHECK(pRemoved == &features13 && !features12.pNext);
+
+  CHECK(!std::strcmp(vkroots::helpers::enumString(VK_ERROR_DEVICE_LOST), "VK_ERROR_DEVICE_LOST"));
+
+  return failures ? 1 : 0;
+}
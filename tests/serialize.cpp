@@ -0,0 +1,182 @@
+#include "vkroots.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+static int failures = 0;
+
+#define CHECK(expr) do { if (!(expr)) { std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #expr); failures++; } } while (0)
+
+// deserialize works in place on suitably aligned memory, so each attempt
+// gets a fresh copy of the blob.
+class Blob {
+public:
+  Blob(const std::vector<std::byte>& data)
+    : m_pData{ new std::max_align_t[(data.size() + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)] }
+    , m_size{ data.size() } {
+    std::memcpy(m_pData.get(), data.data(), data.size());
+  }
+
+  std::byte* data() {
+    return reinterpret_cast<std::byte*>(m_pData.get());
+  }
+
+  size_t size() const {
+    return m_size;
+  }
+
+  bool contains(const void* ptr, size_t size) const {
+    const std::byte* pBase = reinterpret_cast<const std::byte*>(m_pData.get());
+    const std::byte* pByte = static_cast<const std::byte*>(ptr);
+    return pByte >= pBase && size <= m_size && size_t(pByte - pBase) <= m_size - size;
+  }
+
+  template <typename T>
+  T* deserialize(size_t size) {
+    return vkroots::deserialize<T>(m_pData.get(), size);
+  }
+
+  template <typename T>
+  T* deserialize() {
+    return deserialize<T>(m_size);
+  }
+
+private:
+  std::unique_ptr<std::max_align_t[]> m_pData;
+  size_t m_size;
+};
+
+// Every pointer in a deserialized pipeline, which all have to be in the blob.
+static bool PointersInBlob(const Blob& blob, const VkGraphicsPipelineCreateInfo& info) {
+  bool ok = true;
+  for (const VkBaseInStructure* pNext = static_cast<const VkBaseInStructure*>(info.pNext); ok && pNext; pNext = pNext->pNext)
+    ok = blob.contains(pNext, sizeof(VkBaseInStructure));
+  ok = ok && (!info.pStages || blob.contains(info.pStages, sizeof(*info.pStages) * info.stageCount));
+  for (uint32_t i = 0; ok && info.pStages && i < info.stageCount; i++) {
+    const VkPipelineShaderStageCreateInfo& stage = info.pStages[i];
+    ok = (!stage.pName || blob.contains(stage.pName, std::strlen(stage.pName) + 1)) &&
+         (!stage.pSpecializationInfo || blob.contains(stage.pSpecializationInfo, sizeof(VkSpecializationInfo)));
+    if (ok && stage.pSpecializationInfo) {
+      const VkSpecializationInfo& spec = *stage.pSpecializationInfo;
+      ok = (!spec.pMapEntries || blob.contains(spec.pMapEntries, sizeof(*spec.pMapEntries) * spec.mapEntryCount)) &&
+           (!spec.pData || blob.contains(spec.pData, spec.dataSize));
+    }
+  }
+  ok = ok && (!info.pVertexInputState || blob.contains(info.pVertexInputState, sizeof(*info.pVertexInputState)));
+  ok = ok && (!info.pDynamicState || blob.contains(info.pDynamicState, sizeof(*info.pDynamicState)));
+  if (ok && info.pDynamicState)
+    ok = !info.pDynamicState->pDynamicStates || blob.contains(info.pDynamicState->pDynamicStates, sizeof(VkDynamicState) * info.pDynamicState->dynamicStateCount);
+  return ok;
+}
+
+int main() {
+  const uint32_t specData[] = { 1, 2 };
+  const VkSpecializationMapEntry specEntries[] = { { 0, 0, 4 }, { 1, 4, 4 } };
+  const VkSpecializationInfo specInfo = { 2, specEntries, sizeof(specData), specData };
+  const VkPipelineShaderStageCreateInfo stages[] = {
+    { .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .stage = VK_SHADER_STAGE_VERTEX_BIT, .pName = "main" },
+    { .sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO, .stage = VK_SHADER_STAGE_FRAGMENT_BIT, .pName = "fragment_main", .pSpecializationInfo = &specInfo },
+  };
+  const VkVertexInputBindingDescription binding = { 0, 16, VK_VERTEX_INPUT_RATE_VERTEX };
+  const VkPipelineVertexInputStateCreateInfo vertexInput = {
+    .sType                         = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO,
+    .vertexBindingDescriptionCount = 1,
+    .pVertexBindingDescriptions    = &binding,
+  };
+  const VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+  const VkPipelineDynamicStateCreateInfo dynamic = { .sType = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO, .dynamicStateCount = 2, .pDynamicStates = dynamicStates };
+  const VkFormat colorFormat = VK_FORMAT_B8G8R8A8_UNORM;
+  const VkPipelineRenderingCreateInfo rendering = { .sType = VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO, .colorAttachmentCount = 1, .pColorAttachmentFormats = &colorFormat };
+  const VkGraphicsPipelineCreateInfo info = {
+    .sType             = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO,
+    .pNext             = &rendering,
+    .stageCount        = 2,
+    .pStages           = stages,
+    .pVertexInputState = &vertexInput,
+    .pDynamicState     = &dynamic,
+    .basePipelineIndex = -1,
+  };
+
+  const std::vector<std::byte> data = vkroots::serialize(info);
+  CHECK(data.size() == vkroots::serialize(info, nullptr, 0));
+
+  // Round trip.
+  {
+    Blob blob{ data };
+    const VkGraphicsPipelineCreateInfo* pInfo = blob.deserialize<VkGraphicsPipelineCreateInfo>();
+    CHECK(pInfo && blob.contains(pInfo, sizeof(*pInfo)));
+    if (pInfo) {
+      CHECK(PointersInBlob(blob, *pInfo));
+      CHECK(pInfo->sType == VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO && pInfo->basePipelineIndex == -1);
+      CHECK(pInfo->stageCount == 2 && !std::strcmp(pInfo->pStages[1].pName, "fragment_main"));
+      CHECK(pInfo->pStages[1].pSpecializationInfo->pMapEntries[1].offset == 4);
+      CHECK(!std::memcmp(pInfo->pStages[1].pSpecializationInfo->pData, specData, sizeof(specData)));
+      CHECK(pInfo->pVertexInputState->pVertexBindingDescriptions[0].stride == 16);
+      CHECK(pInfo->pDynamicState->pDynamicStates[1] == VK_DYNAMIC_STATE_SCISSOR);
+      const auto* pRendering = static_cast<const VkPipelineRenderingCreateInfo*>(pInfo->pNext);
+      CHECK(pRendering->sType == VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO && pRendering->pColorAttachmentFormats[0] == VK_FORMAT_B8G8R8A8_UNORM);
+
+      // Serializing the deserialized struct gives back the same blob.
+      CHECK(vkroots::serialize(*pInfo) == data);
+    }
+  }
+
+  // Truncated blobs, and blobs of another struct.
+  {
+    Blob blob{ data };
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>(data.size() - 1));
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>(vkroots::SerializedRootOffset<VkGraphicsPipelineCreateInfo>()));
+  }
+  {
+    Blob blob{ data };
+    CHECK(!blob.deserialize<VkDeviceCreateInfo>());
+  }
+  {
+    Blob blob{ data };
+    reinterpret_cast<vkroots::SerializedHeader*>(blob.data())->magic ^= 1;
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>());
+  }
+
+  // Pointers that lead out of the blob, back into what was already read, or
+  // to a struct vkroots doesn't know.
+  const size_t rootOffset = vkroots::SerializedRootOffset<VkGraphicsPipelineCreateInfo>();
+  auto root = [&](Blob& blob) {
+    return reinterpret_cast<VkGraphicsPipelineCreateInfo*>(blob.data() + rootOffset);
+  };
+  {
+    Blob blob{ data };
+    root(blob)->pStages = reinterpret_cast<const VkPipelineShaderStageCreateInfo*>(uintptr_t(data.size() + 64));
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>());
+  }
+  {
+    Blob blob{ data };
+    root(blob)->pDynamicState = reinterpret_cast<const VkPipelineDynamicStateCreateInfo*>(uintptr_t(rootOffset));
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>());
+  }
+  {
+    Blob blob{ data };
+    root(blob)->stageCount = ~0u;
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>());
+  }
+  {
+    Blob blob{ data };
+    const uintptr_t nextOffset = reinterpret_cast<uintptr_t>(root(blob)->pNext);
+    const VkStructureType unknown = VkStructureType(0x7fff0000);
+    std::memcpy(blob.data() + nextOffset, &unknown, sizeof(unknown));
+    CHECK(!blob.deserialize<VkGraphicsPipelineCreateInfo>());
+  }
+
+  // Whatever byte is changed, deserialize either fails or gives back a
+  // struct that stays within the blob.
+  for (size_t i = sizeof(vkroots::SerializedHeader); i < data.size(); i++) {
+    for (uint8_t flip : { uint8_t(0x01), uint8_t(0x80), uint8_t(0xff) }) {
+      Blob blob{ data };
+      blob.data()[i] ^= std::byte{ flip };
+      if (const VkGraphicsPipelineCreateInfo* pInfo = blob.deserialize<VkGraphicsPipelineCreateInfo>())
+        CHECK(PointersInBlob(blob, *pInfo));
+    }
+  }
+
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+// The vkroots.h header is licensed under Apache-2.0 OR MIT
+// as it was generated from the Vulkan Registry, which is licensed
+// under the same license.
+
+// C++20 module interface over vkroots.h.
+//
+// Macros can't be exported from a module, so the TU which defines the
+// layer's entrypoints with VKROOTS_DEFINE_LAYER_INTERFACES (or any of the
+// other VKROOTS_ macros) still has to include vkroots.h. Everything else
+// can `import vkroots;` instead.
+
+module;
+
+#include "vkroots.h"
+
+export module vkroots;
+
+export namespace vkroots {
+  using vkroots::NoOverrides;
+  using vkroots::VkInstanceDispatch;
+  using vkroots::VkPhysicalDeviceDispatch;
+  using vkroots::VkDeviceDispatch;
+
+  using vkroots::constexpr_function;
+  using vkroots::function_ref;
+  using vkroots::ChainPatcher;
+  using vkroots::ChainBuilder;
+
+  using vkroots::ResolveSType;
+  using vkroots::FindInChain;
+  using vkroots::FindInChainMutable;
+  using vkroots::FindAllInChain;
+  using vkroots::FindAllInChainMutable;
+  using vkroots::RemoveFromChain;
+  using vkroots::AddToChain;
+
+  using vkroots::NegotiateLoaderLayerInterfaceVersion;
+}
+
+export namespace vkroots {
+  using vkroots::Arena;
+  using vkroots::deepCopy;
+}
+
+export namespace vkroots {
+  using vkroots::serialize;
+  using vkroots::deserialize;
+}
+
+export namespace vkroots::helpers {
+  using vkroots::helpers::enumString;
+  using vkroots::helpers::delimitStringView;
+  using vkroots::helpers::array;
+  using vkroots::helpers::enumerate;
+  using vkroots::helpers::append;
+  using vkroots::helpers::chain;
+  using vkroots::helpers::SynchronizedMapObject;
+}
@@ -0,0 +1,14309 @@
+// Part of vkroots.h, generated by gen/make_vkroots.
+
+#pragma once
+
+#include "core.h"
+
+namespace vkroots {
+
+  // Bump allocator for deep copies. Everything it hands out lives until
+  // reset() or until the arena is destroyed. Not thread-safe.
+  class Arena {
+  public:
+    explicit Arena(size_t blockSize = 64 * 1024)
+      : m_blockSize{ blockSize } {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator = (const Arena&) = delete;
+
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+      assert(alignment <= alignof(std::max_align_t) && (alignment & (alignment - 1)) == 0);
+
+      size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+      if (m_pCurrent && offset + size <= m_blockSize) {
+        m_offset = offset + size;
+        return m_pCurrent + offset;
+      }
+
+      // Anything bigger than a block gets a block of its own, so the rest of
+      // the current one can still be used.
+      if (size > m_blockSize)
+        return m_blocks.emplace_back(new std::byte[size]).get();
+
+      m_pCurrent = m_blocks.emplace_back(new std::byte[m_blockSize]).get();
+      m_offset = size;
+      return m_pCurrent;
+    }
+
+    void reset() {
+      m_blocks.clear();
+      m_pCurrent = nullptr;
+      m_offset = 0;
+    }
+
+  private:
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    size_t m_blockSize;
+    std::byte* m_pCurrent = nullptr;
+    size_t m_offset = 0;
+  };
+
+  // Hands out consecutive pieces of the single allocation a deep copy is laid
+  // out in, in the same order the size pass reserved them.
+  class DeepCopyCursor {
+  public:
+    explicit DeepCopyCursor(void* pData)
+      : m_pData{ static_cast<std::byte*>(pData) } {
+    }
+
+    template <typename T>
+    T* take(size_t count) {
+      m_offset = (m_offset + alignof(T) - 1) & ~(alignof(T) - 1);
+      T* ptr = reinterpret_cast<T*>(m_pData + m_offset);
+      m_offset += sizeof(T) * count;
+      return ptr;
+    }
+
+  private:
+    std::byte* m_pData;
+    size_t m_offset = 0;
+  };
+
+  // Structs without any pointers have nothing to copy beyond themselves.
+  // make_vkroots specializes this for every struct that does, so one with a
+  // pNext that ends up here is from newer headers and can't be copied.
+  template <typename T>
+  struct DeepCopyTraits {
+    static constexpr bool Supported = !requires (const T& t) { t.pNext; };
+    static void size(const T&, size_t&) {}
+    static void copy(const T&, T&, DeepCopyCursor&) {}
+  };
+
+  template <typename T>
+  void DeepCopyReserve(size_t& offset, size_t count) {
+    offset = (offset + alignof(T) - 1) & ~(alignof(T) - 1);
+    offset += sizeof(T) * count;
+  }
+
+  // Copies the first struct in a pNext chain that can be copied, which copies
+  // the rest of the chain after it in turn. Structs vkroots doesn't know how
+  // to copy are left out.
+  inline void DeepCopyNextSize(const void* pNext, size_t& offset);
+  inline void* DeepCopyNext(const void* pNext, DeepCopyCursor& cursor);
+
+  template <typename T>
+  void DeepCopyStructSize(const T& src, size_t& offset) {
+    DeepCopyReserve<T>(offset, 1);
+    DeepCopyTraits<T>::size(src, offset);
+  }
+
+  template <typename T>
+  T* DeepCopyStruct(const T& src, DeepCopyCursor& cursor) {
+    T* dst = cursor.take<T>(1);
+    std::memcpy(dst, &src, sizeof(T));
+    DeepCopyTraits<T>::copy(src, *dst, cursor);
+    return dst;
+  }
+
+  // context is what the struct pointing to these hands down to them, for
+  // structs whose ignored pointers depend on it.
+  template <typename T, typename... Context>
+  void DeepCopyArraySize(const T* pSrc, size_t count, size_t& offset, const Context&... context) {
+    if (!pSrc || !count)
+      return;
+    DeepCopyReserve<T>(offset, count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyTraits<T>::size(pSrc[i], offset, context...);
+  }
+
+  template <typename T, typename... Context>
+  T* DeepCopyArray(const T* pSrc, size_t count, DeepCopyCursor& cursor, const Context&... context) {
+    if (!pSrc || !count)
+      return nullptr;
+    T* pDst = cursor.take<T>(count);
+    std::memcpy(pDst, pSrc, sizeof(T) * count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyTraits<T>::copy(pSrc[i], pDst[i], cursor, context...);
+    return pDst;
+  }
+
+  // Arrays of pointers to single elements, eg. ppGeometries.
+  template <typename T>
+  void DeepCopyPointerArraySize(const T* const* ppSrc, size_t count, size_t& offset) {
+    if (!ppSrc || !count)
+      return;
+    DeepCopyReserve<T*>(offset, count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyArraySize(ppSrc[i], 1, offset);
+  }
+
+  template <typename T>
+  T** DeepCopyPointerArray(const T* const* ppSrc, size_t count, DeepCopyCursor& cursor) {
+    if (!ppSrc || !count)
+      return nullptr;
+    T** ppDst = cursor.take<T*>(count);
+    for (size_t i = 0; i < count; i++)
+      ppDst[i] = DeepCopyArray(ppSrc[i], 1, cursor);
+    return ppDst;
+  }
+
+  inline void DeepCopyBytesSize(const void* pSrc, size_t size, size_t& offset) {
+    DeepCopyArraySize(static_cast<const std::byte*>(pSrc), size, offset);
+  }
+
+  inline void* DeepCopyBytes(const void* pSrc, size_t size, DeepCopyCursor& cursor) {
+    return DeepCopyArray(static_cast<const std::byte*>(pSrc), size, cursor);
+  }
+
+  inline void DeepCopyStringSize(const char* pSrc, size_t& offset) {
+    if (pSrc)
+      DeepCopyReserve<char>(offset, std::strlen(pSrc) + 1);
+  }
+
+  inline char* DeepCopyString(const char* pSrc, DeepCopyCursor& cursor) {
+    if (!pSrc)
+      return nullptr;
+    const size_t size = std::strlen(pSrc) + 1;
+    char* pDst = cursor.take<char>(size);
+    std::memcpy(pDst, pSrc, size);
+    return pDst;
+  }
+
+  inline void DeepCopyStringArraySize(const char* const* ppSrc, size_t count, size_t& offset) {
+    if (!ppSrc || !count)
+      return;
+    DeepCopyReserve<char*>(offset, count);
+    for (size_t i = 0; i < count; i++)
+      DeepCopyStringSize(ppSrc[i], offset);
+  }
+
+  inline char** DeepCopyStringArray(const char* const* ppSrc, size_t count, DeepCopyCursor& cursor) {
+    if (!ppSrc || !count)
+      return nullptr;
+    char** ppDst = cursor.take<char*>(count);
+    for (size_t i = 0; i < count; i++)
+      ppDst[i] = DeepCopyString(ppSrc[i], cursor);
+    return ppDst;
+  }
+
+  // Pointers the spec says are ignored unless another member says otherwise.
+  // make_vkroots only follows them when these say they are used, and leaves
+  // them null in the copy when they aren't.
+
+  inline bool DescriptorTypeUsesImmutableSamplers(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_SAMPLER || type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+  }
+
+  inline bool DescriptorTypeUsesImageInfo(VkDescriptorType type) {
+    switch (type) {
+      case VK_DESCRIPTOR_TYPE_SAMPLER:
+      case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+      case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+      case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+      case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+      case VK_DESCRIPTOR_TYPE_SAMPLE_WEIGHT_IMAGE_QCOM:
+      case VK_DESCRIPTOR_TYPE_BLOCK_MATCH_IMAGE_QCOM:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  inline bool DescriptorTypeUsesBufferInfo(VkDescriptorType type) {
+    switch (type) {
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+      case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+      case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  inline bool DescriptorTypeUsesTexelBufferView(VkDescriptorType type) {
+    return type == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || type == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
+  }
+
+  // Which of a VkGraphicsPipelineCreateInfo's state pointers are used, going
+  // by the library subsets it has, its shader stages, dynamic states, whether
+  // rasterization is discarded and the dynamic rendering formats. It is handed
+  // down to the state structs, whose arrays depend on the dynamic states too.
+  // A render pass' subpass can't be looked at from here, so with one both
+  // pDepthStencilState and pColorBlendState count as used.
+  // Default constructed, for state structs copied on their own, everything is.
+  class DeepCopyGraphicsPipelineState {
+  public:
+    DeepCopyGraphicsPipelineState() = default;
+
+    explicit DeepCopyGraphicsPipelineState(const VkGraphicsPipelineCreateInfo& info)
+      : m_pDynamicState{ info.pDynamicState } {
+      const VkGraphicsPipelineLibraryCreateInfoEXT* pLibraryInfo = nullptr;
+      const VkPipelineLibraryCreateInfoKHR* pLibraries = nullptr;
+      const VkPipelineRenderingCreateInfo* pRendering = nullptr;
+      for (const VkBaseInStructure* header = static_cast<const VkBaseInStructure*>(info.pNext); header; header = header->pNext) {
+        switch (header->sType) {
+          case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT:
+            pLibraryInfo = pLibraryInfo ? pLibraryInfo : reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT*>(header);
+            break;
+          case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
+            pLibraries = pLibraries ? pLibraries : reinterpret_cast<const VkPipelineLibraryCreateInfoKHR*>(header);
+            break;
+          case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+            pRendering = pRendering ? pRendering : reinterpret_cast<const VkPipelineRenderingCreateInfo*>(header);
+            break;
+          default:
+            break;
+        }
+      }
+
+      // Without VkGraphicsPipelineLibraryCreateInfoEXT, a library or a pipeline
+      // linked from libraries has none of the state itself.
+      VkGraphicsPipelineLibraryFlagsEXT subsets =
+        VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT |
+        VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT |
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT |
+        VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+      if (pLibraryInfo)
+        subsets = pLibraryInfo->flags;
+      else if ((info.flags & VK_PIPELINE_CREATE_LIBRARY_BIT_KHR) || (pLibraries && pLibraries->libraryCount))
+        subsets = 0;
+      const bool vertexInput     = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+      const bool preRasterization = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+      const bool fragmentShader  = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+      const bool fragmentOutput  = subsets & VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+
+      stages = preRasterization || fragmentShader;
+      VkShaderStageFlags stageFlags = 0;
+      if (stages && info.pStages) {
+        for (uint32_t i = 0; i < info.stageCount; i++)
+          stageFlags |= info.pStages[i].stage;
+      }
+      const bool mesh = stageFlags & VK_SHADER_STAGE_MESH_BIT_EXT;
+      const VkShaderStageFlags tessellation = VK_SHADER_STAGE_TESSELLATION_CONTROL_BIT | VK_SHADER_STAGE_TESSELLATION_EVALUATION_BIT;
+
+      // Only the pre-rasterization state says whether rasterization is discarded.
+      const bool rasterization = !preRasterization || !info.pRasterizationState ||
+        !info.pRasterizationState->rasterizerDiscardEnable || IsDynamic(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE);
+
+      vertexInputState   = vertexInput && !mesh && !IsDynamic(VK_DYNAMIC_STATE_VERTEX_INPUT_EXT);
+      inputAssemblyState = vertexInput && !mesh;
+      tessellationState  = preRasterization && (stageFlags & tessellation) == tessellation;
+      viewportState      = preRasterization && rasterization;
+      rasterizationState = preRasterization;
+      multisampleState   = (fragmentShader || fragmentOutput) && rasterization;
+      depthStencilState  = fragmentShader && rasterization;
+      colorBlendState    = fragmentOutput && rasterization;
+      if (info.renderPass == VK_NULL_HANDLE) {
+        depthStencilState = depthStencilState && pRendering &&
+          (pRendering->depthAttachmentFormat != VK_FORMAT_UNDEFINED || pRendering->stencilAttachmentFormat != VK_FORMAT_UNDEFINED);
+        colorBlendState = colorBlendState && pRendering && pRendering->colorAttachmentCount;
+      }
+    }
+
+    bool IsDynamic(VkDynamicState state) const {
+      if (!m_pDynamicState || !m_pDynamicState->pDynamicStates)
+        return false;
+      for (uint32_t i = 0; i < m_pDynamicState->dynamicStateCount; i++) {
+        if (m_pDynamicState->pDynamicStates[i] == state)
+          return true;
+      }
+      return false;
+    }
+
+    bool stages             = true;
+    bool vertexInputState   = true;
+    bool inputAssemblyState = true;
+    bool tessellationState  = true;
+    bool viewportState      = true;
+    bool rasterizationState = true;
+    bool multisampleState   = true;
+    bool depthStencilState  = true;
+    bool colorBlendState    = true;
+
+  private:
+    const VkPipelineDynamicStateCreateInfo* m_pDynamicState = nullptr;
+  };
+
+  // Copies src, everything its pointers point to and its pNext chain into a
+  // single allocation from arena, eg. to hold on to a create info after the
+  // call it was passed to has returned. Pointers the spec says are ignored are
+  // left out as far as the struct itself can tell they are, see above, the
+  // rest have to be valid or null.
+  template <typename T>
+  T* deepCopy(const T& src, Arena& arena) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+
+    size_t size = 0;
+    DeepCopyStructSize(src, size);
+    DeepCopyCursor cursor{ arena.allocate(size) };
+    return DeepCopyStruct(src, cursor);
+  }
+
+  // The same for an array of count structs, eg. the pCreateInfos of
+  // vkCreateGraphicsPipelines.
+  template <typename T>
+  T* deepCopy(const T* pSrc, size_t count, Arena& arena) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+
+    size_t size = 0;
+    DeepCopyArraySize(pSrc, count, size);
+    if (!size)
+      return nullptr;
+    DeepCopyCursor cursor{ arena.allocate(size) };
+    return DeepCopyArray(pSrc, count, cursor);
+  }
+
+}
+namespace vkroots {
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureBuildGeometryInfoKHR> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureBuildSizesInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureBuildSizesInfoKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureBuildSizesInfoKHR& src, VkAccelerationStructureBuildSizesInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureCaptureDescriptorDataInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureCaptureDescriptorDataInfoEXT& src, size_t& offset);
+    static void copy(const VkAccelerationStructureCaptureDescriptorDataInfoEXT& src, VkAccelerationStructureCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureCreateInfoKHR& src, VkAccelerationStructureCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureCreateInfoNV& src, size_t& offset);
+    static void copy(const VkAccelerationStructureCreateInfoNV& src, VkAccelerationStructureCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureDeviceAddressInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureDeviceAddressInfoKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureDeviceAddressInfoKHR& src, VkAccelerationStructureDeviceAddressInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureGeometryAabbsDataKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureGeometryAabbsDataKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureGeometryAabbsDataKHR& src, VkAccelerationStructureGeometryAabbsDataKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureGeometryInstancesDataKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureGeometryInstancesDataKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureGeometryInstancesDataKHR& src, VkAccelerationStructureGeometryInstancesDataKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureGeometryDataKHR> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureGeometryKHR> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureGeometryMotionTrianglesDataNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureGeometryMotionTrianglesDataNV& src, size_t& offset);
+    static void copy(const VkAccelerationStructureGeometryMotionTrianglesDataNV& src, VkAccelerationStructureGeometryMotionTrianglesDataNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureGeometryTrianglesDataKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureGeometryTrianglesDataKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureGeometryTrianglesDataKHR& src, VkAccelerationStructureGeometryTrianglesDataKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureInfoNV& src, size_t& offset);
+    static void copy(const VkAccelerationStructureInfoNV& src, VkAccelerationStructureInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureMemoryRequirementsInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureMemoryRequirementsInfoNV& src, size_t& offset);
+    static void copy(const VkAccelerationStructureMemoryRequirementsInfoNV& src, VkAccelerationStructureMemoryRequirementsInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureMotionInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureMotionInfoNV& src, size_t& offset);
+    static void copy(const VkAccelerationStructureMotionInfoNV& src, VkAccelerationStructureMotionInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkAccelerationStructureTrianglesDisplacementMicromapNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureTrianglesDisplacementMicromapNV& src, size_t& offset);
+    static void copy(const VkAccelerationStructureTrianglesDisplacementMicromapNV& src, VkAccelerationStructureTrianglesDisplacementMicromapNV& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureTrianglesOpacityMicromapEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureTrianglesOpacityMicromapEXT& src, size_t& offset);
+    static void copy(const VkAccelerationStructureTrianglesOpacityMicromapEXT& src, VkAccelerationStructureTrianglesOpacityMicromapEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAccelerationStructureVersionInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAccelerationStructureVersionInfoKHR& src, size_t& offset);
+    static void copy(const VkAccelerationStructureVersionInfoKHR& src, VkAccelerationStructureVersionInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAcquireNextImageInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAcquireNextImageInfoKHR& src, size_t& offset);
+    static void copy(const VkAcquireNextImageInfoKHR& src, VkAcquireNextImageInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAcquireProfilingLockInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAcquireProfilingLockInfoKHR& src, size_t& offset);
+    static void copy(const VkAcquireProfilingLockInfoKHR& src, VkAcquireProfilingLockInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAmigoProfilingSubmitInfoSEC> {
+    static constexpr bool Supported = true;
+    static void size(const VkAmigoProfilingSubmitInfoSEC& src, size_t& offset);
+    static void copy(const VkAmigoProfilingSubmitInfoSEC& src, VkAmigoProfilingSubmitInfoSEC& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkAndroidHardwareBufferFormatProperties2ANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkAndroidHardwareBufferFormatProperties2ANDROID& src, size_t& offset);
+    static void copy(const VkAndroidHardwareBufferFormatProperties2ANDROID& src, VkAndroidHardwareBufferFormatProperties2ANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkAndroidHardwareBufferFormatPropertiesANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkAndroidHardwareBufferFormatPropertiesANDROID& src, size_t& offset);
+    static void copy(const VkAndroidHardwareBufferFormatPropertiesANDROID& src, VkAndroidHardwareBufferFormatPropertiesANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkAndroidHardwareBufferPropertiesANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkAndroidHardwareBufferPropertiesANDROID& src, size_t& offset);
+    static void copy(const VkAndroidHardwareBufferPropertiesANDROID& src, VkAndroidHardwareBufferPropertiesANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkAndroidHardwareBufferUsageANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkAndroidHardwareBufferUsageANDROID& src, size_t& offset);
+    static void copy(const VkAndroidHardwareBufferUsageANDROID& src, VkAndroidHardwareBufferUsageANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkAndroidSurfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkAndroidSurfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkAndroidSurfaceCreateInfoKHR& src, VkAndroidSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkApplicationInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkApplicationInfo& src, size_t& offset);
+    static void copy(const VkApplicationInfo& src, VkApplicationInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAttachmentDescription2> {
+    static constexpr bool Supported = true;
+    static void size(const VkAttachmentDescription2& src, size_t& offset);
+    static void copy(const VkAttachmentDescription2& src, VkAttachmentDescription2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAttachmentDescriptionStencilLayout> {
+    static constexpr bool Supported = true;
+    static void size(const VkAttachmentDescriptionStencilLayout& src, size_t& offset);
+    static void copy(const VkAttachmentDescriptionStencilLayout& src, VkAttachmentDescriptionStencilLayout& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAttachmentReference2> {
+    static constexpr bool Supported = true;
+    static void size(const VkAttachmentReference2& src, size_t& offset);
+    static void copy(const VkAttachmentReference2& src, VkAttachmentReference2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAttachmentReferenceStencilLayout> {
+    static constexpr bool Supported = true;
+    static void size(const VkAttachmentReferenceStencilLayout& src, size_t& offset);
+    static void copy(const VkAttachmentReferenceStencilLayout& src, VkAttachmentReferenceStencilLayout& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAttachmentSampleCountInfoAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkAttachmentSampleCountInfoAMD& src, size_t& offset);
+    static void copy(const VkAttachmentSampleCountInfoAMD& src, VkAttachmentSampleCountInfoAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindAccelerationStructureMemoryInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindAccelerationStructureMemoryInfoNV& src, size_t& offset);
+    static void copy(const VkBindAccelerationStructureMemoryInfoNV& src, VkBindAccelerationStructureMemoryInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindBufferMemoryDeviceGroupInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindBufferMemoryDeviceGroupInfo& src, size_t& offset);
+    static void copy(const VkBindBufferMemoryDeviceGroupInfo& src, VkBindBufferMemoryDeviceGroupInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindBufferMemoryInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindBufferMemoryInfo& src, size_t& offset);
+    static void copy(const VkBindBufferMemoryInfo& src, VkBindBufferMemoryInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindImageMemoryDeviceGroupInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindImageMemoryDeviceGroupInfo& src, size_t& offset);
+    static void copy(const VkBindImageMemoryDeviceGroupInfo& src, VkBindImageMemoryDeviceGroupInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindImageMemoryInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindImageMemoryInfo& src, size_t& offset);
+    static void copy(const VkBindImageMemoryInfo& src, VkBindImageMemoryInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindImageMemorySwapchainInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindImageMemorySwapchainInfoKHR& src, size_t& offset);
+    static void copy(const VkBindImageMemorySwapchainInfoKHR& src, VkBindImageMemorySwapchainInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindImagePlaneMemoryInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindImagePlaneMemoryInfo& src, size_t& offset);
+    static void copy(const VkBindImagePlaneMemoryInfo& src, VkBindImagePlaneMemoryInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSparseBufferMemoryBindInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSparseBufferMemoryBindInfo& src, size_t& offset);
+    static void copy(const VkSparseBufferMemoryBindInfo& src, VkSparseBufferMemoryBindInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSparseImageOpaqueMemoryBindInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSparseImageOpaqueMemoryBindInfo& src, size_t& offset);
+    static void copy(const VkSparseImageOpaqueMemoryBindInfo& src, VkSparseImageOpaqueMemoryBindInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSparseImageMemoryBindInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSparseImageMemoryBindInfo& src, size_t& offset);
+    static void copy(const VkSparseImageMemoryBindInfo& src, VkSparseImageMemoryBindInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindSparseInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindSparseInfo& src, size_t& offset);
+    static void copy(const VkBindSparseInfo& src, VkBindSparseInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBindVideoSessionMemoryInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkBindVideoSessionMemoryInfoKHR& src, size_t& offset);
+    static void copy(const VkBindVideoSessionMemoryInfoKHR& src, VkBindVideoSessionMemoryInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBlitImageInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkBlitImageInfo2& src, size_t& offset);
+    static void copy(const VkBlitImageInfo2& src, VkBlitImageInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferCaptureDescriptorDataInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCaptureDescriptorDataInfoEXT& src, size_t& offset);
+    static void copy(const VkBufferCaptureDescriptorDataInfoEXT& src, VkBufferCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkBufferCollectionBufferCreateInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCollectionBufferCreateInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkBufferCollectionBufferCreateInfoFUCHSIA& src, VkBufferCollectionBufferCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCollectionConstraintsInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkBufferCollectionConstraintsInfoFUCHSIA& src, VkBufferCollectionConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkBufferCollectionCreateInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCollectionCreateInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkBufferCollectionCreateInfoFUCHSIA& src, VkBufferCollectionCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkBufferCollectionImageCreateInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCollectionImageCreateInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkBufferCollectionImageCreateInfoFUCHSIA& src, VkBufferCollectionImageCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkBufferCollectionPropertiesFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCollectionPropertiesFUCHSIA& src, size_t& offset);
+    static void copy(const VkBufferCollectionPropertiesFUCHSIA& src, VkBufferCollectionPropertiesFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkBufferConstraintsInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferConstraintsInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkBufferConstraintsInfoFUCHSIA& src, VkBufferConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkBufferCopy2> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCopy2& src, size_t& offset);
+    static void copy(const VkBufferCopy2& src, VkBufferCopy2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferCreateInfo& src, size_t& offset);
+    static void copy(const VkBufferCreateInfo& src, VkBufferCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferDeviceAddressCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferDeviceAddressCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkBufferDeviceAddressCreateInfoEXT& src, VkBufferDeviceAddressCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferDeviceAddressInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferDeviceAddressInfo& src, size_t& offset);
+    static void copy(const VkBufferDeviceAddressInfo& src, VkBufferDeviceAddressInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferImageCopy2> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferImageCopy2& src, size_t& offset);
+    static void copy(const VkBufferImageCopy2& src, VkBufferImageCopy2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferMemoryBarrier> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferMemoryBarrier& src, size_t& offset);
+    static void copy(const VkBufferMemoryBarrier& src, VkBufferMemoryBarrier& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferMemoryBarrier2> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferMemoryBarrier2& src, size_t& offset);
+    static void copy(const VkBufferMemoryBarrier2& src, VkBufferMemoryBarrier2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferMemoryRequirementsInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferMemoryRequirementsInfo2& src, size_t& offset);
+    static void copy(const VkBufferMemoryRequirementsInfo2& src, VkBufferMemoryRequirementsInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferOpaqueCaptureAddressCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferOpaqueCaptureAddressCreateInfo& src, size_t& offset);
+    static void copy(const VkBufferOpaqueCaptureAddressCreateInfo& src, VkBufferOpaqueCaptureAddressCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkBufferViewCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkBufferViewCreateInfo& src, size_t& offset);
+    static void copy(const VkBufferViewCreateInfo& src, VkBufferViewCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCalibratedTimestampInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkCalibratedTimestampInfoEXT& src, size_t& offset);
+    static void copy(const VkCalibratedTimestampInfoEXT& src, VkCalibratedTimestampInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCheckpointData2NV> {
+    static constexpr bool Supported = true;
+    static void size(const VkCheckpointData2NV& src, size_t& offset);
+    static void copy(const VkCheckpointData2NV& src, VkCheckpointData2NV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCheckpointDataNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkCheckpointDataNV& src, size_t& offset);
+    static void copy(const VkCheckpointDataNV& src, VkCheckpointDataNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferAllocateInfo& src, size_t& offset);
+    static void copy(const VkCommandBufferAllocateInfo& src, VkCommandBufferAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferBeginInfo> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkCommandBufferInheritanceConditionalRenderingInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferInheritanceConditionalRenderingInfoEXT& src, size_t& offset);
+    static void copy(const VkCommandBufferInheritanceConditionalRenderingInfoEXT& src, VkCommandBufferInheritanceConditionalRenderingInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferInheritanceInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferInheritanceInfo& src, size_t& offset);
+    static void copy(const VkCommandBufferInheritanceInfo& src, VkCommandBufferInheritanceInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferInheritanceRenderPassTransformInfoQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& src, size_t& offset);
+    static void copy(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& src, VkCommandBufferInheritanceRenderPassTransformInfoQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferInheritanceRenderingInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferInheritanceRenderingInfo& src, size_t& offset);
+    static void copy(const VkCommandBufferInheritanceRenderingInfo& src, VkCommandBufferInheritanceRenderingInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferInheritanceViewportScissorInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferInheritanceViewportScissorInfoNV& src, size_t& offset);
+    static void copy(const VkCommandBufferInheritanceViewportScissorInfoNV& src, VkCommandBufferInheritanceViewportScissorInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandBufferSubmitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandBufferSubmitInfo& src, size_t& offset);
+    static void copy(const VkCommandBufferSubmitInfo& src, VkCommandBufferSubmitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCommandPoolCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkCommandPoolCreateInfo& src, size_t& offset);
+    static void copy(const VkCommandPoolCreateInfo& src, VkCommandPoolCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkComputePipelineCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkComputePipelineCreateInfo& src, size_t& offset);
+    static void copy(const VkComputePipelineCreateInfo& src, VkComputePipelineCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkConditionalRenderingBeginInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkConditionalRenderingBeginInfoEXT& src, size_t& offset);
+    static void copy(const VkConditionalRenderingBeginInfoEXT& src, VkConditionalRenderingBeginInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCooperativeMatrixPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkCooperativeMatrixPropertiesNV& src, size_t& offset);
+    static void copy(const VkCooperativeMatrixPropertiesNV& src, VkCooperativeMatrixPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyAccelerationStructureInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyAccelerationStructureInfoKHR& src, size_t& offset);
+    static void copy(const VkCopyAccelerationStructureInfoKHR& src, VkCopyAccelerationStructureInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyAccelerationStructureToMemoryInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyAccelerationStructureToMemoryInfoKHR& src, size_t& offset);
+    static void copy(const VkCopyAccelerationStructureToMemoryInfoKHR& src, VkCopyAccelerationStructureToMemoryInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyBufferInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyBufferInfo2& src, size_t& offset);
+    static void copy(const VkCopyBufferInfo2& src, VkCopyBufferInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyBufferToImageInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyBufferToImageInfo2& src, size_t& offset);
+    static void copy(const VkCopyBufferToImageInfo2& src, VkCopyBufferToImageInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyCommandTransformInfoQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyCommandTransformInfoQCOM& src, size_t& offset);
+    static void copy(const VkCopyCommandTransformInfoQCOM& src, VkCopyCommandTransformInfoQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyDescriptorSet> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyDescriptorSet& src, size_t& offset);
+    static void copy(const VkCopyDescriptorSet& src, VkCopyDescriptorSet& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyImageInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyImageInfo2& src, size_t& offset);
+    static void copy(const VkCopyImageInfo2& src, VkCopyImageInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyImageToBufferInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyImageToBufferInfo2& src, size_t& offset);
+    static void copy(const VkCopyImageToBufferInfo2& src, VkCopyImageToBufferInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyMemoryToAccelerationStructureInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyMemoryToAccelerationStructureInfoKHR& src, size_t& offset);
+    static void copy(const VkCopyMemoryToAccelerationStructureInfoKHR& src, VkCopyMemoryToAccelerationStructureInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyMemoryToMicromapInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyMemoryToMicromapInfoEXT& src, size_t& offset);
+    static void copy(const VkCopyMemoryToMicromapInfoEXT& src, VkCopyMemoryToMicromapInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyMicromapInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyMicromapInfoEXT& src, size_t& offset);
+    static void copy(const VkCopyMicromapInfoEXT& src, VkCopyMicromapInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCopyMicromapToMemoryInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkCopyMicromapToMemoryInfoEXT& src, size_t& offset);
+    static void copy(const VkCopyMicromapToMemoryInfoEXT& src, VkCopyMicromapToMemoryInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkD3D12FenceSubmitInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkD3D12FenceSubmitInfoKHR& src, size_t& offset);
+    static void copy(const VkD3D12FenceSubmitInfoKHR& src, VkD3D12FenceSubmitInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkDebugMarkerMarkerInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugMarkerMarkerInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugMarkerMarkerInfoEXT& src, VkDebugMarkerMarkerInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugMarkerObjectNameInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugMarkerObjectNameInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugMarkerObjectNameInfoEXT& src, VkDebugMarkerObjectNameInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugMarkerObjectTagInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugMarkerObjectTagInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugMarkerObjectTagInfoEXT& src, VkDebugMarkerObjectTagInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugReportCallbackCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugReportCallbackCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugReportCallbackCreateInfoEXT& src, VkDebugReportCallbackCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugUtilsLabelEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugUtilsLabelEXT& src, size_t& offset);
+    static void copy(const VkDebugUtilsLabelEXT& src, VkDebugUtilsLabelEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugUtilsMessengerCallbackDataEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugUtilsMessengerCallbackDataEXT& src, size_t& offset);
+    static void copy(const VkDebugUtilsMessengerCallbackDataEXT& src, VkDebugUtilsMessengerCallbackDataEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugUtilsMessengerCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugUtilsMessengerCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugUtilsMessengerCreateInfoEXT& src, VkDebugUtilsMessengerCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugUtilsObjectNameInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugUtilsObjectNameInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugUtilsObjectNameInfoEXT& src, VkDebugUtilsObjectNameInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDebugUtilsObjectTagInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDebugUtilsObjectTagInfoEXT& src, size_t& offset);
+    static void copy(const VkDebugUtilsObjectTagInfoEXT& src, VkDebugUtilsObjectTagInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDedicatedAllocationBufferCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkDedicatedAllocationBufferCreateInfoNV& src, size_t& offset);
+    static void copy(const VkDedicatedAllocationBufferCreateInfoNV& src, VkDedicatedAllocationBufferCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDedicatedAllocationImageCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkDedicatedAllocationImageCreateInfoNV& src, size_t& offset);
+    static void copy(const VkDedicatedAllocationImageCreateInfoNV& src, VkDedicatedAllocationImageCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDedicatedAllocationMemoryAllocateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkDedicatedAllocationMemoryAllocateInfoNV& src, size_t& offset);
+    static void copy(const VkDedicatedAllocationMemoryAllocateInfoNV& src, VkDedicatedAllocationMemoryAllocateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDependencyInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDependencyInfo& src, size_t& offset);
+    static void copy(const VkDependencyInfo& src, VkDependencyInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorAddressInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorAddressInfoEXT& src, size_t& offset);
+    static void copy(const VkDescriptorAddressInfoEXT& src, VkDescriptorAddressInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorBufferBindingInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorBufferBindingInfoEXT& src, size_t& offset);
+    static void copy(const VkDescriptorBufferBindingInfoEXT& src, VkDescriptorBufferBindingInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorBufferBindingPushDescriptorBufferHandleEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& src, size_t& offset);
+    static void copy(const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& src, VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorDataEXT> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkDescriptorGetInfoEXT> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkDescriptorPoolCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorPoolCreateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorPoolCreateInfo& src, VkDescriptorPoolCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorPoolInlineUniformBlockCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorPoolInlineUniformBlockCreateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorPoolInlineUniformBlockCreateInfo& src, VkDescriptorPoolInlineUniformBlockCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetAllocateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorSetAllocateInfo& src, VkDescriptorSetAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetBindingReferenceVALVE> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetBindingReferenceVALVE& src, size_t& offset);
+    static void copy(const VkDescriptorSetBindingReferenceVALVE& src, VkDescriptorSetBindingReferenceVALVE& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetLayoutBindingFlagsCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetLayoutBindingFlagsCreateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorSetLayoutBindingFlagsCreateInfo& src, VkDescriptorSetLayoutBindingFlagsCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetLayoutBinding> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetLayoutBinding& src, size_t& offset);
+    static void copy(const VkDescriptorSetLayoutBinding& src, VkDescriptorSetLayoutBinding& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetLayoutCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetLayoutCreateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorSetLayoutCreateInfo& src, VkDescriptorSetLayoutCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetLayoutHostMappingInfoVALVE> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetLayoutHostMappingInfoVALVE& src, size_t& offset);
+    static void copy(const VkDescriptorSetLayoutHostMappingInfoVALVE& src, VkDescriptorSetLayoutHostMappingInfoVALVE& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetLayoutSupport> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetLayoutSupport& src, size_t& offset);
+    static void copy(const VkDescriptorSetLayoutSupport& src, VkDescriptorSetLayoutSupport& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetVariableDescriptorCountAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetVariableDescriptorCountAllocateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorSetVariableDescriptorCountAllocateInfo& src, VkDescriptorSetVariableDescriptorCountAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorSetVariableDescriptorCountLayoutSupport> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorSetVariableDescriptorCountLayoutSupport& src, size_t& offset);
+    static void copy(const VkDescriptorSetVariableDescriptorCountLayoutSupport& src, VkDescriptorSetVariableDescriptorCountLayoutSupport& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDescriptorUpdateTemplateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDescriptorUpdateTemplateCreateInfo& src, size_t& offset);
+    static void copy(const VkDescriptorUpdateTemplateCreateInfo& src, VkDescriptorUpdateTemplateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceAddressBindingCallbackDataEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceAddressBindingCallbackDataEXT& src, size_t& offset);
+    static void copy(const VkDeviceAddressBindingCallbackDataEXT& src, VkDeviceAddressBindingCallbackDataEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceBufferMemoryRequirements> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceBufferMemoryRequirements& src, size_t& offset);
+    static void copy(const VkDeviceBufferMemoryRequirements& src, VkDeviceBufferMemoryRequirements& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceCreateInfo& src, size_t& offset);
+    static void copy(const VkDeviceCreateInfo& src, VkDeviceCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceDeviceMemoryReportCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceDeviceMemoryReportCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkDeviceDeviceMemoryReportCreateInfoEXT& src, VkDeviceDeviceMemoryReportCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceDiagnosticsConfigCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceDiagnosticsConfigCreateInfoNV& src, size_t& offset);
+    static void copy(const VkDeviceDiagnosticsConfigCreateInfoNV& src, VkDeviceDiagnosticsConfigCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceEventInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceEventInfoEXT& src, size_t& offset);
+    static void copy(const VkDeviceEventInfoEXT& src, VkDeviceEventInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceFaultCountsEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceFaultCountsEXT& src, size_t& offset);
+    static void copy(const VkDeviceFaultCountsEXT& src, VkDeviceFaultCountsEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceFaultInfoEXT> { static constexpr bool Supported = false; };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupBindSparseInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupBindSparseInfo& src, size_t& offset);
+    static void copy(const VkDeviceGroupBindSparseInfo& src, VkDeviceGroupBindSparseInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupCommandBufferBeginInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupCommandBufferBeginInfo& src, size_t& offset);
+    static void copy(const VkDeviceGroupCommandBufferBeginInfo& src, VkDeviceGroupCommandBufferBeginInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupDeviceCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupDeviceCreateInfo& src, size_t& offset);
+    static void copy(const VkDeviceGroupDeviceCreateInfo& src, VkDeviceGroupDeviceCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupPresentCapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupPresentCapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkDeviceGroupPresentCapabilitiesKHR& src, VkDeviceGroupPresentCapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupPresentInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupPresentInfoKHR& src, size_t& offset);
+    static void copy(const VkDeviceGroupPresentInfoKHR& src, VkDeviceGroupPresentInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupRenderPassBeginInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupRenderPassBeginInfo& src, size_t& offset);
+    static void copy(const VkDeviceGroupRenderPassBeginInfo& src, VkDeviceGroupRenderPassBeginInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupSubmitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupSubmitInfo& src, size_t& offset);
+    static void copy(const VkDeviceGroupSubmitInfo& src, VkDeviceGroupSubmitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceGroupSwapchainCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceGroupSwapchainCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkDeviceGroupSwapchainCreateInfoKHR& src, VkDeviceGroupSwapchainCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceImageMemoryRequirements> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceImageMemoryRequirements& src, size_t& offset);
+    static void copy(const VkDeviceImageMemoryRequirements& src, VkDeviceImageMemoryRequirements& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceMemoryOpaqueCaptureAddressInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceMemoryOpaqueCaptureAddressInfo& src, size_t& offset);
+    static void copy(const VkDeviceMemoryOpaqueCaptureAddressInfo& src, VkDeviceMemoryOpaqueCaptureAddressInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceMemoryOverallocationCreateInfoAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceMemoryOverallocationCreateInfoAMD& src, size_t& offset);
+    static void copy(const VkDeviceMemoryOverallocationCreateInfoAMD& src, VkDeviceMemoryOverallocationCreateInfoAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceMemoryReportCallbackDataEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceMemoryReportCallbackDataEXT& src, size_t& offset);
+    static void copy(const VkDeviceMemoryReportCallbackDataEXT& src, VkDeviceMemoryReportCallbackDataEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDevicePrivateDataCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDevicePrivateDataCreateInfo& src, size_t& offset);
+    static void copy(const VkDevicePrivateDataCreateInfo& src, VkDevicePrivateDataCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceQueueCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceQueueCreateInfo& src, size_t& offset);
+    static void copy(const VkDeviceQueueCreateInfo& src, VkDeviceQueueCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceQueueGlobalPriorityCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceQueueGlobalPriorityCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkDeviceQueueGlobalPriorityCreateInfoKHR& src, VkDeviceQueueGlobalPriorityCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDeviceQueueInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkDeviceQueueInfo2& src, size_t& offset);
+    static void copy(const VkDeviceQueueInfo2& src, VkDeviceQueueInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDirectDriverLoadingInfoLUNARG> {
+    static constexpr bool Supported = true;
+    static void size(const VkDirectDriverLoadingInfoLUNARG& src, size_t& offset);
+    static void copy(const VkDirectDriverLoadingInfoLUNARG& src, VkDirectDriverLoadingInfoLUNARG& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDirectDriverLoadingListLUNARG> {
+    static constexpr bool Supported = true;
+    static void size(const VkDirectDriverLoadingListLUNARG& src, size_t& offset);
+    static void copy(const VkDirectDriverLoadingListLUNARG& src, VkDirectDriverLoadingListLUNARG& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+  template <> struct DeepCopyTraits<VkDirectFBSurfaceCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDirectFBSurfaceCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkDirectFBSurfaceCreateInfoEXT& src, VkDirectFBSurfaceCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkDisplayEventInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayEventInfoEXT& src, size_t& offset);
+    static void copy(const VkDisplayEventInfoEXT& src, VkDisplayEventInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayModeCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayModeCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkDisplayModeCreateInfoKHR& src, VkDisplayModeCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayModeProperties2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayModeProperties2KHR& src, size_t& offset);
+    static void copy(const VkDisplayModeProperties2KHR& src, VkDisplayModeProperties2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayNativeHdrSurfaceCapabilitiesAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayNativeHdrSurfaceCapabilitiesAMD& src, size_t& offset);
+    static void copy(const VkDisplayNativeHdrSurfaceCapabilitiesAMD& src, VkDisplayNativeHdrSurfaceCapabilitiesAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayPlaneCapabilities2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayPlaneCapabilities2KHR& src, size_t& offset);
+    static void copy(const VkDisplayPlaneCapabilities2KHR& src, VkDisplayPlaneCapabilities2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayPlaneInfo2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayPlaneInfo2KHR& src, size_t& offset);
+    static void copy(const VkDisplayPlaneInfo2KHR& src, VkDisplayPlaneInfo2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayPlaneProperties2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayPlaneProperties2KHR& src, size_t& offset);
+    static void copy(const VkDisplayPlaneProperties2KHR& src, VkDisplayPlaneProperties2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayPowerInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayPowerInfoEXT& src, size_t& offset);
+    static void copy(const VkDisplayPowerInfoEXT& src, VkDisplayPowerInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayPresentInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayPresentInfoKHR& src, size_t& offset);
+    static void copy(const VkDisplayPresentInfoKHR& src, VkDisplayPresentInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayPropertiesKHR& src, size_t& offset);
+    static void copy(const VkDisplayPropertiesKHR& src, VkDisplayPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplayProperties2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplayProperties2KHR& src, size_t& offset);
+    static void copy(const VkDisplayProperties2KHR& src, VkDisplayProperties2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDisplaySurfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkDisplaySurfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkDisplaySurfaceCreateInfoKHR& src, VkDisplaySurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDrmFormatModifierPropertiesList2EXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDrmFormatModifierPropertiesList2EXT& src, size_t& offset);
+    static void copy(const VkDrmFormatModifierPropertiesList2EXT& src, VkDrmFormatModifierPropertiesList2EXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkDrmFormatModifierPropertiesListEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkDrmFormatModifierPropertiesListEXT& src, size_t& offset);
+    static void copy(const VkDrmFormatModifierPropertiesListEXT& src, VkDrmFormatModifierPropertiesListEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkEventCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkEventCreateInfo& src, size_t& offset);
+    static void copy(const VkEventCreateInfo& src, VkEventCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExportFenceCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportFenceCreateInfo& src, size_t& offset);
+    static void copy(const VkExportFenceCreateInfo& src, VkExportFenceCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkExportFenceWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportFenceWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkExportFenceWin32HandleInfoKHR& src, VkExportFenceWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkExportMemoryAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMemoryAllocateInfo& src, size_t& offset);
+    static void copy(const VkExportMemoryAllocateInfo& src, VkExportMemoryAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExportMemoryAllocateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMemoryAllocateInfoNV& src, size_t& offset);
+    static void copy(const VkExportMemoryAllocateInfoNV& src, VkExportMemoryAllocateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkExportMemoryWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMemoryWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkExportMemoryWin32HandleInfoKHR& src, VkExportMemoryWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkExportMemoryWin32HandleInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMemoryWin32HandleInfoNV& src, size_t& offset);
+    static void copy(const VkExportMemoryWin32HandleInfoNV& src, VkExportMemoryWin32HandleInfoNV& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalBufferInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalBufferInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalBufferInfoEXT& src, VkExportMetalBufferInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalCommandQueueInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalCommandQueueInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalCommandQueueInfoEXT& src, VkExportMetalCommandQueueInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalDeviceInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalDeviceInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalDeviceInfoEXT& src, VkExportMetalDeviceInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalIOSurfaceInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalIOSurfaceInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalIOSurfaceInfoEXT& src, VkExportMetalIOSurfaceInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalObjectCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalObjectCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalObjectCreateInfoEXT& src, VkExportMetalObjectCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalObjectsInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalObjectsInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalObjectsInfoEXT& src, VkExportMetalObjectsInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalSharedEventInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalSharedEventInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalSharedEventInfoEXT& src, VkExportMetalSharedEventInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkExportMetalTextureInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportMetalTextureInfoEXT& src, size_t& offset);
+    static void copy(const VkExportMetalTextureInfoEXT& src, VkExportMetalTextureInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkExportSemaphoreCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportSemaphoreCreateInfo& src, size_t& offset);
+    static void copy(const VkExportSemaphoreCreateInfo& src, VkExportSemaphoreCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkExportSemaphoreWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkExportSemaphoreWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkExportSemaphoreWin32HandleInfoKHR& src, VkExportSemaphoreWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkExternalBufferProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalBufferProperties& src, size_t& offset);
+    static void copy(const VkExternalBufferProperties& src, VkExternalBufferProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExternalFenceProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalFenceProperties& src, size_t& offset);
+    static void copy(const VkExternalFenceProperties& src, VkExternalFenceProperties& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkExternalFormatANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalFormatANDROID& src, size_t& offset);
+    static void copy(const VkExternalFormatANDROID& src, VkExternalFormatANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkExternalImageFormatProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalImageFormatProperties& src, size_t& offset);
+    static void copy(const VkExternalImageFormatProperties& src, VkExternalImageFormatProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExternalMemoryAcquireUnmodifiedEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalMemoryAcquireUnmodifiedEXT& src, size_t& offset);
+    static void copy(const VkExternalMemoryAcquireUnmodifiedEXT& src, VkExternalMemoryAcquireUnmodifiedEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExternalMemoryBufferCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalMemoryBufferCreateInfo& src, size_t& offset);
+    static void copy(const VkExternalMemoryBufferCreateInfo& src, VkExternalMemoryBufferCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExternalMemoryImageCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalMemoryImageCreateInfo& src, size_t& offset);
+    static void copy(const VkExternalMemoryImageCreateInfo& src, VkExternalMemoryImageCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExternalMemoryImageCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalMemoryImageCreateInfoNV& src, size_t& offset);
+    static void copy(const VkExternalMemoryImageCreateInfoNV& src, VkExternalMemoryImageCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkExternalSemaphoreProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkExternalSemaphoreProperties& src, size_t& offset);
+    static void copy(const VkExternalSemaphoreProperties& src, VkExternalSemaphoreProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFenceCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkFenceCreateInfo& src, size_t& offset);
+    static void copy(const VkFenceCreateInfo& src, VkFenceCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFenceGetFdInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkFenceGetFdInfoKHR& src, size_t& offset);
+    static void copy(const VkFenceGetFdInfoKHR& src, VkFenceGetFdInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkFenceGetWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkFenceGetWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkFenceGetWin32HandleInfoKHR& src, VkFenceGetWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkFilterCubicImageViewImageFormatPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkFilterCubicImageViewImageFormatPropertiesEXT& src, size_t& offset);
+    static void copy(const VkFilterCubicImageViewImageFormatPropertiesEXT& src, VkFilterCubicImageViewImageFormatPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFormatProperties2> {
+    static constexpr bool Supported = true;
+    static void size(const VkFormatProperties2& src, size_t& offset);
+    static void copy(const VkFormatProperties2& src, VkFormatProperties2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFormatProperties3> {
+    static constexpr bool Supported = true;
+    static void size(const VkFormatProperties3& src, size_t& offset);
+    static void copy(const VkFormatProperties3& src, VkFormatProperties3& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFragmentShadingRateAttachmentInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkFragmentShadingRateAttachmentInfoKHR& src, size_t& offset);
+    static void copy(const VkFragmentShadingRateAttachmentInfoKHR& src, VkFragmentShadingRateAttachmentInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFramebufferAttachmentImageInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkFramebufferAttachmentImageInfo& src, size_t& offset);
+    static void copy(const VkFramebufferAttachmentImageInfo& src, VkFramebufferAttachmentImageInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFramebufferAttachmentsCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkFramebufferAttachmentsCreateInfo& src, size_t& offset);
+    static void copy(const VkFramebufferAttachmentsCreateInfo& src, VkFramebufferAttachmentsCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFramebufferCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkFramebufferCreateInfo& src, size_t& offset);
+    static void copy(const VkFramebufferCreateInfo& src, VkFramebufferCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkFramebufferMixedSamplesCombinationNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkFramebufferMixedSamplesCombinationNV& src, size_t& offset);
+    static void copy(const VkFramebufferMixedSamplesCombinationNV& src, VkFramebufferMixedSamplesCombinationNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGeneratedCommandsInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGeneratedCommandsInfoNV& src, size_t& offset);
+    static void copy(const VkGeneratedCommandsInfoNV& src, VkGeneratedCommandsInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGeneratedCommandsMemoryRequirementsInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGeneratedCommandsMemoryRequirementsInfoNV& src, size_t& offset);
+    static void copy(const VkGeneratedCommandsMemoryRequirementsInfoNV& src, VkGeneratedCommandsMemoryRequirementsInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGeometryAABBNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGeometryAABBNV& src, size_t& offset);
+    static void copy(const VkGeometryAABBNV& src, VkGeometryAABBNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGeometryDataNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGeometryDataNV& src, size_t& offset);
+    static void copy(const VkGeometryDataNV& src, VkGeometryDataNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGeometryNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGeometryNV& src, size_t& offset);
+    static void copy(const VkGeometryNV& src, VkGeometryNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGeometryTrianglesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGeometryTrianglesNV& src, size_t& offset);
+    static void copy(const VkGeometryTrianglesNV& src, VkGeometryTrianglesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGraphicsPipelineCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkGraphicsPipelineCreateInfo& src, size_t& offset);
+    static void copy(const VkGraphicsPipelineCreateInfo& src, VkGraphicsPipelineCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGraphicsPipelineLibraryCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkGraphicsPipelineLibraryCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkGraphicsPipelineLibraryCreateInfoEXT& src, VkGraphicsPipelineLibraryCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGraphicsPipelineShaderGroupsCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGraphicsPipelineShaderGroupsCreateInfoNV& src, size_t& offset);
+    static void copy(const VkGraphicsPipelineShaderGroupsCreateInfoNV& src, VkGraphicsPipelineShaderGroupsCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkGraphicsShaderGroupCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkGraphicsShaderGroupCreateInfoNV& src, size_t& offset);
+    static void copy(const VkGraphicsShaderGroupCreateInfoNV& src, VkGraphicsShaderGroupCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkHdrMetadataEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkHdrMetadataEXT& src, size_t& offset);
+    static void copy(const VkHdrMetadataEXT& src, VkHdrMetadataEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkHeadlessSurfaceCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkHeadlessSurfaceCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkHeadlessSurfaceCreateInfoEXT& src, VkHeadlessSurfaceCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_IOS_MVK
+  template <> struct DeepCopyTraits<VkIOSSurfaceCreateInfoMVK> {
+    static constexpr bool Supported = true;
+    static void size(const VkIOSSurfaceCreateInfoMVK& src, size_t& offset);
+    static void copy(const VkIOSSurfaceCreateInfoMVK& src, VkIOSSurfaceCreateInfoMVK& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImageBlit2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageBlit2& src, size_t& offset);
+    static void copy(const VkImageBlit2& src, VkImageBlit2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageCaptureDescriptorDataInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageCaptureDescriptorDataInfoEXT& src, size_t& offset);
+    static void copy(const VkImageCaptureDescriptorDataInfoEXT& src, VkImageCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageCompressionControlEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageCompressionControlEXT& src, size_t& offset);
+    static void copy(const VkImageCompressionControlEXT& src, VkImageCompressionControlEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageCompressionPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageCompressionPropertiesEXT& src, size_t& offset);
+    static void copy(const VkImageCompressionPropertiesEXT& src, VkImageCompressionPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkImageConstraintsInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageConstraintsInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkImageConstraintsInfoFUCHSIA& src, VkImageConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImageCopy2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageCopy2& src, size_t& offset);
+    static void copy(const VkImageCopy2& src, VkImageCopy2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageCreateInfo& src, size_t& offset);
+    static void copy(const VkImageCreateInfo& src, VkImageCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageDrmFormatModifierExplicitCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageDrmFormatModifierExplicitCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkImageDrmFormatModifierExplicitCreateInfoEXT& src, VkImageDrmFormatModifierExplicitCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageDrmFormatModifierListCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageDrmFormatModifierListCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkImageDrmFormatModifierListCreateInfoEXT& src, VkImageDrmFormatModifierListCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageDrmFormatModifierPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageDrmFormatModifierPropertiesEXT& src, size_t& offset);
+    static void copy(const VkImageDrmFormatModifierPropertiesEXT& src, VkImageDrmFormatModifierPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkImageFormatConstraintsInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageFormatConstraintsInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkImageFormatConstraintsInfoFUCHSIA& src, VkImageFormatConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImageFormatListCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageFormatListCreateInfo& src, size_t& offset);
+    static void copy(const VkImageFormatListCreateInfo& src, VkImageFormatListCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageFormatProperties2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageFormatProperties2& src, size_t& offset);
+    static void copy(const VkImageFormatProperties2& src, VkImageFormatProperties2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageMemoryBarrier> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageMemoryBarrier& src, size_t& offset);
+    static void copy(const VkImageMemoryBarrier& src, VkImageMemoryBarrier& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageMemoryBarrier2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageMemoryBarrier2& src, size_t& offset);
+    static void copy(const VkImageMemoryBarrier2& src, VkImageMemoryBarrier2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageMemoryRequirementsInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageMemoryRequirementsInfo2& src, size_t& offset);
+    static void copy(const VkImageMemoryRequirementsInfo2& src, VkImageMemoryRequirementsInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkImagePipeSurfaceCreateInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkImagePipeSurfaceCreateInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkImagePipeSurfaceCreateInfoFUCHSIA& src, VkImagePipeSurfaceCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImagePlaneMemoryRequirementsInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkImagePlaneMemoryRequirementsInfo& src, size_t& offset);
+    static void copy(const VkImagePlaneMemoryRequirementsInfo& src, VkImagePlaneMemoryRequirementsInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageResolve2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageResolve2& src, size_t& offset);
+    static void copy(const VkImageResolve2& src, VkImageResolve2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageSparseMemoryRequirementsInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageSparseMemoryRequirementsInfo2& src, size_t& offset);
+    static void copy(const VkImageSparseMemoryRequirementsInfo2& src, VkImageSparseMemoryRequirementsInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageStencilUsageCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageStencilUsageCreateInfo& src, size_t& offset);
+    static void copy(const VkImageStencilUsageCreateInfo& src, VkImageStencilUsageCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageSubresource2EXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageSubresource2EXT& src, size_t& offset);
+    static void copy(const VkImageSubresource2EXT& src, VkImageSubresource2EXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageSwapchainCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageSwapchainCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkImageSwapchainCreateInfoKHR& src, VkImageSwapchainCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewASTCDecodeModeEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewASTCDecodeModeEXT& src, size_t& offset);
+    static void copy(const VkImageViewASTCDecodeModeEXT& src, VkImageViewASTCDecodeModeEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewCaptureDescriptorDataInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewCaptureDescriptorDataInfoEXT& src, size_t& offset);
+    static void copy(const VkImageViewCaptureDescriptorDataInfoEXT& src, VkImageViewCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewCreateInfo& src, size_t& offset);
+    static void copy(const VkImageViewCreateInfo& src, VkImageViewCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewMinLodCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewMinLodCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkImageViewMinLodCreateInfoEXT& src, VkImageViewMinLodCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewSampleWeightCreateInfoQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewSampleWeightCreateInfoQCOM& src, size_t& offset);
+    static void copy(const VkImageViewSampleWeightCreateInfoQCOM& src, VkImageViewSampleWeightCreateInfoQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewSlicedCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewSlicedCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkImageViewSlicedCreateInfoEXT& src, VkImageViewSlicedCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImageViewUsageCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkImageViewUsageCreateInfo& src, size_t& offset);
+    static void copy(const VkImageViewUsageCreateInfo& src, VkImageViewUsageCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkImportAndroidHardwareBufferInfoANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportAndroidHardwareBufferInfoANDROID& src, size_t& offset);
+    static void copy(const VkImportAndroidHardwareBufferInfoANDROID& src, VkImportAndroidHardwareBufferInfoANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImportFenceFdInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportFenceFdInfoKHR& src, size_t& offset);
+    static void copy(const VkImportFenceFdInfoKHR& src, VkImportFenceFdInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkImportFenceWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportFenceWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkImportFenceWin32HandleInfoKHR& src, VkImportFenceWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkImportMemoryBufferCollectionFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMemoryBufferCollectionFUCHSIA& src, size_t& offset);
+    static void copy(const VkImportMemoryBufferCollectionFUCHSIA& src, VkImportMemoryBufferCollectionFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImportMemoryFdInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMemoryFdInfoKHR& src, size_t& offset);
+    static void copy(const VkImportMemoryFdInfoKHR& src, VkImportMemoryFdInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkImportMemoryHostPointerInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMemoryHostPointerInfoEXT& src, size_t& offset);
+    static void copy(const VkImportMemoryHostPointerInfoEXT& src, VkImportMemoryHostPointerInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkImportMemoryWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMemoryWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkImportMemoryWin32HandleInfoKHR& src, VkImportMemoryWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkImportMemoryWin32HandleInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMemoryWin32HandleInfoNV& src, size_t& offset);
+    static void copy(const VkImportMemoryWin32HandleInfoNV& src, VkImportMemoryWin32HandleInfoNV& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkImportMemoryZirconHandleInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMemoryZirconHandleInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkImportMemoryZirconHandleInfoFUCHSIA& src, VkImportMemoryZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkImportMetalBufferInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMetalBufferInfoEXT& src, size_t& offset);
+    static void copy(const VkImportMetalBufferInfoEXT& src, VkImportMetalBufferInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkImportMetalIOSurfaceInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMetalIOSurfaceInfoEXT& src, size_t& offset);
+    static void copy(const VkImportMetalIOSurfaceInfoEXT& src, VkImportMetalIOSurfaceInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkImportMetalSharedEventInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMetalSharedEventInfoEXT& src, size_t& offset);
+    static void copy(const VkImportMetalSharedEventInfoEXT& src, VkImportMetalSharedEventInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkImportMetalTextureInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportMetalTextureInfoEXT& src, size_t& offset);
+    static void copy(const VkImportMetalTextureInfoEXT& src, VkImportMetalTextureInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkImportSemaphoreFdInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportSemaphoreFdInfoKHR& src, size_t& offset);
+    static void copy(const VkImportSemaphoreFdInfoKHR& src, VkImportSemaphoreFdInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkImportSemaphoreWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportSemaphoreWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkImportSemaphoreWin32HandleInfoKHR& src, VkImportSemaphoreWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkImportSemaphoreZirconHandleInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkImportSemaphoreZirconHandleInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkImportSemaphoreZirconHandleInfoFUCHSIA& src, VkImportSemaphoreZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkIndirectCommandsLayoutCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkIndirectCommandsLayoutCreateInfoNV& src, size_t& offset);
+    static void copy(const VkIndirectCommandsLayoutCreateInfoNV& src, VkIndirectCommandsLayoutCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkIndirectCommandsLayoutTokenNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkIndirectCommandsLayoutTokenNV& src, size_t& offset);
+    static void copy(const VkIndirectCommandsLayoutTokenNV& src, VkIndirectCommandsLayoutTokenNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkInitializePerformanceApiInfoINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkInitializePerformanceApiInfoINTEL& src, size_t& offset);
+    static void copy(const VkInitializePerformanceApiInfoINTEL& src, VkInitializePerformanceApiInfoINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkInstanceCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkInstanceCreateInfo& src, size_t& offset);
+    static void copy(const VkInstanceCreateInfo& src, VkInstanceCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+  template <> struct DeepCopyTraits<VkMacOSSurfaceCreateInfoMVK> {
+    static constexpr bool Supported = true;
+    static void size(const VkMacOSSurfaceCreateInfoMVK& src, size_t& offset);
+    static void copy(const VkMacOSSurfaceCreateInfoMVK& src, VkMacOSSurfaceCreateInfoMVK& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkMappedMemoryRange> {
+    static constexpr bool Supported = true;
+    static void size(const VkMappedMemoryRange& src, size_t& offset);
+    static void copy(const VkMappedMemoryRange& src, VkMappedMemoryRange& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryAllocateFlagsInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryAllocateFlagsInfo& src, size_t& offset);
+    static void copy(const VkMemoryAllocateFlagsInfo& src, VkMemoryAllocateFlagsInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryAllocateInfo& src, size_t& offset);
+    static void copy(const VkMemoryAllocateInfo& src, VkMemoryAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryBarrier> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryBarrier& src, size_t& offset);
+    static void copy(const VkMemoryBarrier& src, VkMemoryBarrier& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryBarrier2> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryBarrier2& src, size_t& offset);
+    static void copy(const VkMemoryBarrier2& src, VkMemoryBarrier2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryDedicatedAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryDedicatedAllocateInfo& src, size_t& offset);
+    static void copy(const VkMemoryDedicatedAllocateInfo& src, VkMemoryDedicatedAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryDedicatedRequirements> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryDedicatedRequirements& src, size_t& offset);
+    static void copy(const VkMemoryDedicatedRequirements& src, VkMemoryDedicatedRequirements& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryFdPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryFdPropertiesKHR& src, size_t& offset);
+    static void copy(const VkMemoryFdPropertiesKHR& src, VkMemoryFdPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct DeepCopyTraits<VkMemoryGetAndroidHardwareBufferInfoANDROID> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryGetAndroidHardwareBufferInfoANDROID& src, size_t& offset);
+    static void copy(const VkMemoryGetAndroidHardwareBufferInfoANDROID& src, VkMemoryGetAndroidHardwareBufferInfoANDROID& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkMemoryGetFdInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryGetFdInfoKHR& src, size_t& offset);
+    static void copy(const VkMemoryGetFdInfoKHR& src, VkMemoryGetFdInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryGetRemoteAddressInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryGetRemoteAddressInfoNV& src, size_t& offset);
+    static void copy(const VkMemoryGetRemoteAddressInfoNV& src, VkMemoryGetRemoteAddressInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkMemoryGetWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryGetWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkMemoryGetWin32HandleInfoKHR& src, VkMemoryGetWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkMemoryGetZirconHandleInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryGetZirconHandleInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkMemoryGetZirconHandleInfoFUCHSIA& src, VkMemoryGetZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkMemoryHostPointerPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryHostPointerPropertiesEXT& src, size_t& offset);
+    static void copy(const VkMemoryHostPointerPropertiesEXT& src, VkMemoryHostPointerPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryMapInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryMapInfoKHR& src, size_t& offset);
+    static void copy(const VkMemoryMapInfoKHR& src, VkMemoryMapInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryOpaqueCaptureAddressAllocateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryOpaqueCaptureAddressAllocateInfo& src, size_t& offset);
+    static void copy(const VkMemoryOpaqueCaptureAddressAllocateInfo& src, VkMemoryOpaqueCaptureAddressAllocateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryPriorityAllocateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryPriorityAllocateInfoEXT& src, size_t& offset);
+    static void copy(const VkMemoryPriorityAllocateInfoEXT& src, VkMemoryPriorityAllocateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryRequirements2> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryRequirements2& src, size_t& offset);
+    static void copy(const VkMemoryRequirements2& src, VkMemoryRequirements2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMemoryUnmapInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryUnmapInfoKHR& src, size_t& offset);
+    static void copy(const VkMemoryUnmapInfoKHR& src, VkMemoryUnmapInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkMemoryWin32HandlePropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryWin32HandlePropertiesKHR& src, size_t& offset);
+    static void copy(const VkMemoryWin32HandlePropertiesKHR& src, VkMemoryWin32HandlePropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkMemoryZirconHandlePropertiesFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkMemoryZirconHandlePropertiesFUCHSIA& src, size_t& offset);
+    static void copy(const VkMemoryZirconHandlePropertiesFUCHSIA& src, VkMemoryZirconHandlePropertiesFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct DeepCopyTraits<VkMetalSurfaceCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMetalSurfaceCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkMetalSurfaceCreateInfoEXT& src, VkMetalSurfaceCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkMicromapBuildInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMicromapBuildInfoEXT& src, size_t& offset);
+    static void copy(const VkMicromapBuildInfoEXT& src, VkMicromapBuildInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMicromapBuildSizesInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMicromapBuildSizesInfoEXT& src, size_t& offset);
+    static void copy(const VkMicromapBuildSizesInfoEXT& src, VkMicromapBuildSizesInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMicromapCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMicromapCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkMicromapCreateInfoEXT& src, VkMicromapCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMicromapVersionInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMicromapVersionInfoEXT& src, size_t& offset);
+    static void copy(const VkMicromapVersionInfoEXT& src, VkMicromapVersionInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMultisamplePropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMultisamplePropertiesEXT& src, size_t& offset);
+    static void copy(const VkMultisamplePropertiesEXT& src, VkMultisamplePropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMultisampledRenderToSingleSampledInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMultisampledRenderToSingleSampledInfoEXT& src, size_t& offset);
+    static void copy(const VkMultisampledRenderToSingleSampledInfoEXT& src, VkMultisampledRenderToSingleSampledInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMultiviewPerViewAttributesInfoNVX> {
+    static constexpr bool Supported = true;
+    static void size(const VkMultiviewPerViewAttributesInfoNVX& src, size_t& offset);
+    static void copy(const VkMultiviewPerViewAttributesInfoNVX& src, VkMultiviewPerViewAttributesInfoNVX& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& src, size_t& offset);
+    static void copy(const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& src, VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMutableDescriptorTypeListEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMutableDescriptorTypeListEXT& src, size_t& offset);
+    static void copy(const VkMutableDescriptorTypeListEXT& src, VkMutableDescriptorTypeListEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkMutableDescriptorTypeCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkMutableDescriptorTypeCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkMutableDescriptorTypeCreateInfoEXT& src, VkMutableDescriptorTypeCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkOpaqueCaptureDescriptorDataCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkOpaqueCaptureDescriptorDataCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkOpaqueCaptureDescriptorDataCreateInfoEXT& src, VkOpaqueCaptureDescriptorDataCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkOpticalFlowExecuteInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkOpticalFlowExecuteInfoNV& src, size_t& offset);
+    static void copy(const VkOpticalFlowExecuteInfoNV& src, VkOpticalFlowExecuteInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkOpticalFlowImageFormatInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkOpticalFlowImageFormatInfoNV& src, size_t& offset);
+    static void copy(const VkOpticalFlowImageFormatInfoNV& src, VkOpticalFlowImageFormatInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkOpticalFlowImageFormatPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkOpticalFlowImageFormatPropertiesNV& src, size_t& offset);
+    static void copy(const VkOpticalFlowImageFormatPropertiesNV& src, VkOpticalFlowImageFormatPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkOpticalFlowSessionCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkOpticalFlowSessionCreateInfoNV& src, size_t& offset);
+    static void copy(const VkOpticalFlowSessionCreateInfoNV& src, VkOpticalFlowSessionCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkOpticalFlowSessionCreatePrivateDataInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkOpticalFlowSessionCreatePrivateDataInfoNV& src, size_t& offset);
+    static void copy(const VkOpticalFlowSessionCreatePrivateDataInfoNV& src, VkOpticalFlowSessionCreatePrivateDataInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceConfigurationAcquireInfoINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceConfigurationAcquireInfoINTEL& src, size_t& offset);
+    static void copy(const VkPerformanceConfigurationAcquireInfoINTEL& src, VkPerformanceConfigurationAcquireInfoINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceCounterDescriptionKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceCounterDescriptionKHR& src, size_t& offset);
+    static void copy(const VkPerformanceCounterDescriptionKHR& src, VkPerformanceCounterDescriptionKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceCounterKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceCounterKHR& src, size_t& offset);
+    static void copy(const VkPerformanceCounterKHR& src, VkPerformanceCounterKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceMarkerInfoINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceMarkerInfoINTEL& src, size_t& offset);
+    static void copy(const VkPerformanceMarkerInfoINTEL& src, VkPerformanceMarkerInfoINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceOverrideInfoINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceOverrideInfoINTEL& src, size_t& offset);
+    static void copy(const VkPerformanceOverrideInfoINTEL& src, VkPerformanceOverrideInfoINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceQuerySubmitInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceQuerySubmitInfoKHR& src, size_t& offset);
+    static void copy(const VkPerformanceQuerySubmitInfoKHR& src, VkPerformanceQuerySubmitInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPerformanceStreamMarkerInfoINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkPerformanceStreamMarkerInfoINTEL& src, size_t& offset);
+    static void copy(const VkPerformanceStreamMarkerInfoINTEL& src, VkPerformanceStreamMarkerInfoINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevice16BitStorageFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevice16BitStorageFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDevice16BitStorageFeatures& src, VkPhysicalDevice16BitStorageFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevice4444FormatsFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevice4444FormatsFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevice4444FormatsFeaturesEXT& src, VkPhysicalDevice4444FormatsFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevice8BitStorageFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevice8BitStorageFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDevice8BitStorageFeatures& src, VkPhysicalDevice8BitStorageFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceASTCDecodeFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceASTCDecodeFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceASTCDecodeFeaturesEXT& src, VkPhysicalDeviceASTCDecodeFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceAccelerationStructureFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceAccelerationStructureFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceAccelerationStructureFeaturesKHR& src, VkPhysicalDeviceAccelerationStructureFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceAccelerationStructurePropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceAccelerationStructurePropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceAccelerationStructurePropertiesKHR& src, VkPhysicalDeviceAccelerationStructurePropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceAddressBindingReportFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceAddressBindingReportFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceAddressBindingReportFeaturesEXT& src, VkPhysicalDeviceAddressBindingReportFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceAmigoProfilingFeaturesSEC> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceAmigoProfilingFeaturesSEC& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceAmigoProfilingFeaturesSEC& src, VkPhysicalDeviceAmigoProfilingFeaturesSEC& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& src, VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& src, VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& src, VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& src, VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& src, VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceBufferDeviceAddressFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceBufferDeviceAddressFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceBufferDeviceAddressFeatures& src, VkPhysicalDeviceBufferDeviceAddressFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& src, VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& src, VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& src, VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCoherentMemoryFeaturesAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCoherentMemoryFeaturesAMD& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCoherentMemoryFeaturesAMD& src, VkPhysicalDeviceCoherentMemoryFeaturesAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceColorWriteEnableFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceColorWriteEnableFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceColorWriteEnableFeaturesEXT& src, VkPhysicalDeviceColorWriteEnableFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& src, VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceConditionalRenderingFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceConditionalRenderingFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceConditionalRenderingFeaturesEXT& src, VkPhysicalDeviceConditionalRenderingFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceConservativeRasterizationPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& src, VkPhysicalDeviceConservativeRasterizationPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCooperativeMatrixFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCooperativeMatrixFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCooperativeMatrixFeaturesNV& src, VkPhysicalDeviceCooperativeMatrixFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCooperativeMatrixPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCooperativeMatrixPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCooperativeMatrixPropertiesNV& src, VkPhysicalDeviceCooperativeMatrixPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCopyMemoryIndirectFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& src, VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCopyMemoryIndirectPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& src, VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCornerSampledImageFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCornerSampledImageFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCornerSampledImageFeaturesNV& src, VkPhysicalDeviceCornerSampledImageFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCoverageReductionModeFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCoverageReductionModeFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCoverageReductionModeFeaturesNV& src, VkPhysicalDeviceCoverageReductionModeFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCustomBorderColorFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCustomBorderColorFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCustomBorderColorFeaturesEXT& src, VkPhysicalDeviceCustomBorderColorFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceCustomBorderColorPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceCustomBorderColorPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceCustomBorderColorPropertiesEXT& src, VkPhysicalDeviceCustomBorderColorPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& src, VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDepthClampZeroOneFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& src, VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDepthClipControlFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDepthClipControlFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDepthClipControlFeaturesEXT& src, VkPhysicalDeviceDepthClipControlFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDepthClipEnableFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDepthClipEnableFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDepthClipEnableFeaturesEXT& src, VkPhysicalDeviceDepthClipEnableFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDepthStencilResolveProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDepthStencilResolveProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDepthStencilResolveProperties& src, VkPhysicalDeviceDepthStencilResolveProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& src, VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDescriptorBufferFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDescriptorBufferFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDescriptorBufferFeaturesEXT& src, VkPhysicalDeviceDescriptorBufferFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDescriptorBufferPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& src, VkPhysicalDeviceDescriptorBufferPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDescriptorIndexingFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDescriptorIndexingFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDescriptorIndexingFeatures& src, VkPhysicalDeviceDescriptorIndexingFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDescriptorIndexingProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDescriptorIndexingProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDescriptorIndexingProperties& src, VkPhysicalDeviceDescriptorIndexingProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& src, VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& src, VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& src, VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& src, VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDiagnosticsConfigFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& src, VkPhysicalDeviceDiagnosticsConfigFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDiscardRectanglePropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDiscardRectanglePropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDiscardRectanglePropertiesEXT& src, VkPhysicalDeviceDiscardRectanglePropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDisplacementMicromapFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDisplacementMicromapFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDisplacementMicromapFeaturesNV& src, VkPhysicalDeviceDisplacementMicromapFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDisplacementMicromapPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDisplacementMicromapPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDisplacementMicromapPropertiesNV& src, VkPhysicalDeviceDisplacementMicromapPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDriverProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDriverProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDriverProperties& src, VkPhysicalDeviceDriverProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDrmPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDrmPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDrmPropertiesEXT& src, VkPhysicalDeviceDrmPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDynamicRenderingFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDynamicRenderingFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDynamicRenderingFeatures& src, VkPhysicalDeviceDynamicRenderingFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& src, VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExclusiveScissorFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExclusiveScissorFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExclusiveScissorFeaturesNV& src, VkPhysicalDeviceExclusiveScissorFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& src, VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState3FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& src, VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState3PropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& src, VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& src, VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExternalBufferInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExternalBufferInfo& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExternalBufferInfo& src, VkPhysicalDeviceExternalBufferInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExternalFenceInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExternalFenceInfo& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExternalFenceInfo& src, VkPhysicalDeviceExternalFenceInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExternalImageFormatInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExternalImageFormatInfo& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExternalImageFormatInfo& src, VkPhysicalDeviceExternalImageFormatInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExternalMemoryHostPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& src, VkPhysicalDeviceExternalMemoryHostPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& src, VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceExternalSemaphoreInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceExternalSemaphoreInfo& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceExternalSemaphoreInfo& src, VkPhysicalDeviceExternalSemaphoreInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFaultFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFaultFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFaultFeaturesEXT& src, VkPhysicalDeviceFaultFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFeatures2> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFeatures2& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFeatures2& src, VkPhysicalDeviceFeatures2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFloatControlsProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFloatControlsProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFloatControlsProperties& src, VkPhysicalDeviceFloatControlsProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& src, VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& src, VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& src, VkPhysicalDeviceFragmentDensityMapFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& src, VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& src, VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& src, VkPhysicalDeviceFragmentDensityMapPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& src, VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& src, VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& src, VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& src, VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& src, VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& src, VkPhysicalDeviceFragmentShadingRateFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShadingRateKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShadingRateKHR& src, VkPhysicalDeviceFragmentShadingRateKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceFragmentShadingRatePropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& src, VkPhysicalDeviceFragmentShadingRatePropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& src, VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& src, VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& src, VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceGroupProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceGroupProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceGroupProperties& src, VkPhysicalDeviceGroupProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceHostQueryResetFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceHostQueryResetFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceHostQueryResetFeatures& src, VkPhysicalDeviceHostQueryResetFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceIDProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceIDProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceIDProperties& src, VkPhysicalDeviceIDProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& src, VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageCompressionControlFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageCompressionControlFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageCompressionControlFeaturesEXT& src, VkPhysicalDeviceImageCompressionControlFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& src, VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageDrmFormatModifierInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& src, VkPhysicalDeviceImageDrmFormatModifierInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageFormatInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageFormatInfo2& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageFormatInfo2& src, VkPhysicalDeviceImageFormatInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageProcessingFeaturesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageProcessingFeaturesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageProcessingFeaturesQCOM& src, VkPhysicalDeviceImageProcessingFeaturesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageProcessingPropertiesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageProcessingPropertiesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageProcessingPropertiesQCOM& src, VkPhysicalDeviceImageProcessingPropertiesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageRobustnessFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageRobustnessFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageRobustnessFeatures& src, VkPhysicalDeviceImageRobustnessFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& src, VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageViewImageFormatInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageViewImageFormatInfoEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageViewImageFormatInfoEXT& src, VkPhysicalDeviceImageViewImageFormatInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImageViewMinLodFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImageViewMinLodFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImageViewMinLodFeaturesEXT& src, VkPhysicalDeviceImageViewMinLodFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceImagelessFramebufferFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceImagelessFramebufferFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceImagelessFramebufferFeatures& src, VkPhysicalDeviceImagelessFramebufferFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceIndexTypeUint8FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& src, VkPhysicalDeviceIndexTypeUint8FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceInheritedViewportScissorFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceInheritedViewportScissorFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceInheritedViewportScissorFeaturesNV& src, VkPhysicalDeviceInheritedViewportScissorFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceInlineUniformBlockFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceInlineUniformBlockFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceInlineUniformBlockFeatures& src, VkPhysicalDeviceInlineUniformBlockFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceInlineUniformBlockProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceInlineUniformBlockProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceInlineUniformBlockProperties& src, VkPhysicalDeviceInlineUniformBlockProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& src, VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceLegacyDitheringFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceLegacyDitheringFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceLegacyDitheringFeaturesEXT& src, VkPhysicalDeviceLegacyDitheringFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceLineRasterizationFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceLineRasterizationFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceLineRasterizationFeaturesEXT& src, VkPhysicalDeviceLineRasterizationFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceLineRasterizationPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceLineRasterizationPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceLineRasterizationPropertiesEXT& src, VkPhysicalDeviceLineRasterizationPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceLinearColorAttachmentFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceLinearColorAttachmentFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceLinearColorAttachmentFeaturesNV& src, VkPhysicalDeviceLinearColorAttachmentFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMaintenance3Properties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMaintenance3Properties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMaintenance3Properties& src, VkPhysicalDeviceMaintenance3Properties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMaintenance4Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMaintenance4Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMaintenance4Features& src, VkPhysicalDeviceMaintenance4Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMaintenance4Properties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMaintenance4Properties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMaintenance4Properties& src, VkPhysicalDeviceMaintenance4Properties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMemoryBudgetPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMemoryBudgetPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMemoryBudgetPropertiesEXT& src, VkPhysicalDeviceMemoryBudgetPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMemoryDecompressionFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMemoryDecompressionFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMemoryDecompressionFeaturesNV& src, VkPhysicalDeviceMemoryDecompressionFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMemoryDecompressionPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMemoryDecompressionPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMemoryDecompressionPropertiesNV& src, VkPhysicalDeviceMemoryDecompressionPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMemoryPriorityFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMemoryPriorityFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMemoryPriorityFeaturesEXT& src, VkPhysicalDeviceMemoryPriorityFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMemoryProperties2> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMemoryProperties2& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMemoryProperties2& src, VkPhysicalDeviceMemoryProperties2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMeshShaderFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMeshShaderFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMeshShaderFeaturesEXT& src, VkPhysicalDeviceMeshShaderFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMeshShaderFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMeshShaderFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMeshShaderFeaturesNV& src, VkPhysicalDeviceMeshShaderFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMeshShaderPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMeshShaderPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMeshShaderPropertiesEXT& src, VkPhysicalDeviceMeshShaderPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMeshShaderPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMeshShaderPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMeshShaderPropertiesNV& src, VkPhysicalDeviceMeshShaderPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultiDrawFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultiDrawFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultiDrawFeaturesEXT& src, VkPhysicalDeviceMultiDrawFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultiDrawPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultiDrawPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultiDrawPropertiesEXT& src, VkPhysicalDeviceMultiDrawPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& src, VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultiviewFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultiviewFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultiviewFeatures& src, VkPhysicalDeviceMultiviewFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& src, VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& src, VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMultiviewProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMultiviewProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMultiviewProperties& src, VkPhysicalDeviceMultiviewProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& src, VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& src, VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceOpacityMicromapFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceOpacityMicromapFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceOpacityMicromapFeaturesEXT& src, VkPhysicalDeviceOpacityMicromapFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceOpacityMicromapPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceOpacityMicromapPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceOpacityMicromapPropertiesEXT& src, VkPhysicalDeviceOpacityMicromapPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceOpticalFlowFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceOpticalFlowFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceOpticalFlowFeaturesNV& src, VkPhysicalDeviceOpticalFlowFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceOpticalFlowPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceOpticalFlowPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceOpticalFlowPropertiesNV& src, VkPhysicalDeviceOpticalFlowPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePCIBusInfoPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePCIBusInfoPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePCIBusInfoPropertiesEXT& src, VkPhysicalDevicePCIBusInfoPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& src, VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePerformanceQueryFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePerformanceQueryFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePerformanceQueryFeaturesKHR& src, VkPhysicalDevicePerformanceQueryFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePerformanceQueryPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePerformanceQueryPropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePerformanceQueryPropertiesKHR& src, VkPhysicalDevicePerformanceQueryPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelineCreationCacheControlFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelineCreationCacheControlFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelineCreationCacheControlFeatures& src, VkPhysicalDevicePipelineCreationCacheControlFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& src, VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& src, VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelinePropertiesFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelinePropertiesFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelinePropertiesFeaturesEXT& src, VkPhysicalDevicePipelinePropertiesFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelineProtectedAccessFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& src, VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelineRobustnessFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelineRobustnessFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelineRobustnessFeaturesEXT& src, VkPhysicalDevicePipelineRobustnessFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePipelineRobustnessPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePipelineRobustnessPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePipelineRobustnessPropertiesEXT& src, VkPhysicalDevicePipelineRobustnessPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePointClippingProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePointClippingProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePointClippingProperties& src, VkPhysicalDevicePointClippingProperties& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkPhysicalDevicePortabilitySubsetFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePortabilitySubsetFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePortabilitySubsetFeaturesKHR& src, VkPhysicalDevicePortabilitySubsetFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkPhysicalDevicePortabilitySubsetPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePortabilitySubsetPropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePortabilitySubsetPropertiesKHR& src, VkPhysicalDevicePortabilitySubsetPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePresentBarrierFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePresentBarrierFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePresentBarrierFeaturesNV& src, VkPhysicalDevicePresentBarrierFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePresentIdFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePresentIdFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePresentIdFeaturesKHR& src, VkPhysicalDevicePresentIdFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePresentWaitFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePresentWaitFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePresentWaitFeaturesKHR& src, VkPhysicalDevicePresentWaitFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& src, VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& src, VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePrivateDataFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePrivateDataFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePrivateDataFeatures& src, VkPhysicalDevicePrivateDataFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceProperties2> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceProperties2& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceProperties2& src, VkPhysicalDeviceProperties2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceProtectedMemoryFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceProtectedMemoryFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceProtectedMemoryFeatures& src, VkPhysicalDeviceProtectedMemoryFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceProtectedMemoryProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceProtectedMemoryProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceProtectedMemoryProperties& src, VkPhysicalDeviceProtectedMemoryProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceProvokingVertexFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceProvokingVertexFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceProvokingVertexFeaturesEXT& src, VkPhysicalDeviceProvokingVertexFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceProvokingVertexPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceProvokingVertexPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceProvokingVertexPropertiesEXT& src, VkPhysicalDeviceProvokingVertexPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDevicePushDescriptorPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDevicePushDescriptorPropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDevicePushDescriptorPropertiesKHR& src, VkPhysicalDevicePushDescriptorPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& src, VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& src, VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayQueryFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayQueryFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayQueryFeaturesKHR& src, VkPhysicalDeviceRayQueryFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& src, VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& src, VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& src, VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& src, VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingPipelineFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& src, VkPhysicalDeviceRayTracingPipelineFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingPipelinePropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& src, VkPhysicalDeviceRayTracingPipelinePropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& src, VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRayTracingPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRayTracingPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRayTracingPropertiesNV& src, VkPhysicalDeviceRayTracingPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& src, VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRobustness2FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRobustness2FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRobustness2FeaturesEXT& src, VkPhysicalDeviceRobustness2FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceRobustness2PropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceRobustness2PropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceRobustness2PropertiesEXT& src, VkPhysicalDeviceRobustness2PropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSampleLocationsPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSampleLocationsPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSampleLocationsPropertiesEXT& src, VkPhysicalDeviceSampleLocationsPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSamplerFilterMinmaxProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSamplerFilterMinmaxProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSamplerFilterMinmaxProperties& src, VkPhysicalDeviceSamplerFilterMinmaxProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSamplerYcbcrConversionFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSamplerYcbcrConversionFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSamplerYcbcrConversionFeatures& src, VkPhysicalDeviceSamplerYcbcrConversionFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceScalarBlockLayoutFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceScalarBlockLayoutFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceScalarBlockLayoutFeatures& src, VkPhysicalDeviceScalarBlockLayoutFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& src, VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& src, VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& src, VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderAtomicInt64Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderAtomicInt64Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderAtomicInt64Features& src, VkPhysicalDeviceShaderAtomicInt64Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderClockFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderClockFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderClockFeaturesKHR& src, VkPhysicalDeviceShaderClockFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& src, VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& src, VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderCoreProperties2AMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderCoreProperties2AMD& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderCoreProperties2AMD& src, VkPhysicalDeviceShaderCoreProperties2AMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderCorePropertiesAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderCorePropertiesAMD& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderCorePropertiesAMD& src, VkPhysicalDeviceShaderCorePropertiesAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderCorePropertiesARM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderCorePropertiesARM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderCorePropertiesARM& src, VkPhysicalDeviceShaderCorePropertiesARM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& src, VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderDrawParametersFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderDrawParametersFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderDrawParametersFeatures& src, VkPhysicalDeviceShaderDrawParametersFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& src, VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderFloat16Int8Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderFloat16Int8Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderFloat16Int8Features& src, VkPhysicalDeviceShaderFloat16Int8Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& src, VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderImageFootprintFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderImageFootprintFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderImageFootprintFeaturesNV& src, VkPhysicalDeviceShaderImageFootprintFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderIntegerDotProductFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderIntegerDotProductFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderIntegerDotProductFeatures& src, VkPhysicalDeviceShaderIntegerDotProductFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderIntegerDotProductProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderIntegerDotProductProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderIntegerDotProductProperties& src, VkPhysicalDeviceShaderIntegerDotProductProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& src, VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& src, VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& src, VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderObjectFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderObjectFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderObjectFeaturesEXT& src, VkPhysicalDeviceShaderObjectFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderObjectPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderObjectPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderObjectPropertiesEXT& src, VkPhysicalDeviceShaderObjectPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& src, VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& src, VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& src, VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& src, VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderTerminateInvocationFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderTerminateInvocationFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderTerminateInvocationFeatures& src, VkPhysicalDeviceShaderTerminateInvocationFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderTileImageFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderTileImageFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderTileImageFeaturesEXT& src, VkPhysicalDeviceShaderTileImageFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShaderTileImagePropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShaderTileImagePropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShaderTileImagePropertiesEXT& src, VkPhysicalDeviceShaderTileImagePropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShadingRateImageFeaturesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShadingRateImageFeaturesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShadingRateImageFeaturesNV& src, VkPhysicalDeviceShadingRateImageFeaturesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceShadingRateImagePropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceShadingRateImagePropertiesNV& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceShadingRateImagePropertiesNV& src, VkPhysicalDeviceShadingRateImagePropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSparseImageFormatInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSparseImageFormatInfo2& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSparseImageFormatInfo2& src, VkPhysicalDeviceSparseImageFormatInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSubgroupProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSubgroupProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSubgroupProperties& src, VkPhysicalDeviceSubgroupProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSubgroupSizeControlFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSubgroupSizeControlFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSubgroupSizeControlFeatures& src, VkPhysicalDeviceSubgroupSizeControlFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSubgroupSizeControlProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSubgroupSizeControlProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSubgroupSizeControlProperties& src, VkPhysicalDeviceSubgroupSizeControlProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& src, VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& src, VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& src, VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSurfaceInfo2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSurfaceInfo2KHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSurfaceInfo2KHR& src, VkPhysicalDeviceSurfaceInfo2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& src, VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceSynchronization2Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceSynchronization2Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceSynchronization2Features& src, VkPhysicalDeviceSynchronization2Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& src, VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTexelBufferAlignmentProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTexelBufferAlignmentProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTexelBufferAlignmentProperties& src, VkPhysicalDeviceTexelBufferAlignmentProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTextureCompressionASTCHDRFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTextureCompressionASTCHDRFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTextureCompressionASTCHDRFeatures& src, VkPhysicalDeviceTextureCompressionASTCHDRFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTilePropertiesFeaturesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTilePropertiesFeaturesQCOM& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTilePropertiesFeaturesQCOM& src, VkPhysicalDeviceTilePropertiesFeaturesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTimelineSemaphoreFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTimelineSemaphoreFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTimelineSemaphoreFeatures& src, VkPhysicalDeviceTimelineSemaphoreFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTimelineSemaphoreProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTimelineSemaphoreProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTimelineSemaphoreProperties& src, VkPhysicalDeviceTimelineSemaphoreProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceToolProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceToolProperties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceToolProperties& src, VkPhysicalDeviceToolProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTransformFeedbackFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTransformFeedbackFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTransformFeedbackFeaturesEXT& src, VkPhysicalDeviceTransformFeedbackFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceTransformFeedbackPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceTransformFeedbackPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceTransformFeedbackPropertiesEXT& src, VkPhysicalDeviceTransformFeedbackPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceUniformBufferStandardLayoutFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& src, VkPhysicalDeviceUniformBufferStandardLayoutFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVariablePointersFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVariablePointersFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVariablePointersFeatures& src, VkPhysicalDeviceVariablePointersFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& src, VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& src, VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& src, VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& src, VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVideoFormatInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVideoFormatInfoKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVideoFormatInfoKHR& src, VkPhysicalDeviceVideoFormatInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkan11Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkan11Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkan11Features& src, VkPhysicalDeviceVulkan11Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkan11Properties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkan11Properties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkan11Properties& src, VkPhysicalDeviceVulkan11Properties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkan12Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkan12Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkan12Features& src, VkPhysicalDeviceVulkan12Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkan12Properties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkan12Properties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkan12Properties& src, VkPhysicalDeviceVulkan12Properties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkan13Features> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkan13Features& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkan13Features& src, VkPhysicalDeviceVulkan13Features& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkan13Properties> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkan13Properties& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkan13Properties& src, VkPhysicalDeviceVulkan13Properties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceVulkanMemoryModelFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceVulkanMemoryModelFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceVulkanMemoryModelFeatures& src, VkPhysicalDeviceVulkanMemoryModelFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& src, VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& src, VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& src, VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures> {
+    static constexpr bool Supported = true;
+    static void size(const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& src, size_t& offset);
+    static void copy(const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& src, VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineCacheCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineCacheCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineCacheCreateInfo& src, VkPipelineCacheCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineColorBlendAdvancedStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineColorBlendAdvancedStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineColorBlendAdvancedStateCreateInfoEXT& src, VkPipelineColorBlendAdvancedStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineColorBlendStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineColorBlendStateCreateInfo& src, size_t& offset, const DeepCopyGraphicsPipelineState& context = {});
+    static void copy(const VkPipelineColorBlendStateCreateInfo& src, VkPipelineColorBlendStateCreateInfo& dst, DeepCopyCursor& cursor, const DeepCopyGraphicsPipelineState& context = {});
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineColorWriteCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineColorWriteCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineColorWriteCreateInfoEXT& src, VkPipelineColorWriteCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineCompilerControlCreateInfoAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineCompilerControlCreateInfoAMD& src, size_t& offset);
+    static void copy(const VkPipelineCompilerControlCreateInfoAMD& src, VkPipelineCompilerControlCreateInfoAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineCoverageModulationStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineCoverageModulationStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineCoverageModulationStateCreateInfoNV& src, VkPipelineCoverageModulationStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineCoverageReductionStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineCoverageReductionStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineCoverageReductionStateCreateInfoNV& src, VkPipelineCoverageReductionStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineCoverageToColorStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineCoverageToColorStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineCoverageToColorStateCreateInfoNV& src, VkPipelineCoverageToColorStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineCreationFeedbackCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineCreationFeedbackCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineCreationFeedbackCreateInfo& src, VkPipelineCreationFeedbackCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineDepthStencilStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineDepthStencilStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineDepthStencilStateCreateInfo& src, VkPipelineDepthStencilStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineDiscardRectangleStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineDiscardRectangleStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineDiscardRectangleStateCreateInfoEXT& src, VkPipelineDiscardRectangleStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineDynamicStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineDynamicStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineDynamicStateCreateInfo& src, VkPipelineDynamicStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineExecutableInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineExecutableInfoKHR& src, size_t& offset);
+    static void copy(const VkPipelineExecutableInfoKHR& src, VkPipelineExecutableInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineExecutableInternalRepresentationKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineExecutableInternalRepresentationKHR& src, size_t& offset);
+    static void copy(const VkPipelineExecutableInternalRepresentationKHR& src, VkPipelineExecutableInternalRepresentationKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineExecutablePropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineExecutablePropertiesKHR& src, size_t& offset);
+    static void copy(const VkPipelineExecutablePropertiesKHR& src, VkPipelineExecutablePropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineExecutableStatisticKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineExecutableStatisticKHR& src, size_t& offset);
+    static void copy(const VkPipelineExecutableStatisticKHR& src, VkPipelineExecutableStatisticKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineFragmentShadingRateEnumStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& src, VkPipelineFragmentShadingRateEnumStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineFragmentShadingRateStateCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineFragmentShadingRateStateCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkPipelineFragmentShadingRateStateCreateInfoKHR& src, VkPipelineFragmentShadingRateStateCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineInfoKHR& src, size_t& offset);
+    static void copy(const VkPipelineInfoKHR& src, VkPipelineInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineInputAssemblyStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineInputAssemblyStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineInputAssemblyStateCreateInfo& src, VkPipelineInputAssemblyStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineLayoutCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineLayoutCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineLayoutCreateInfo& src, VkPipelineLayoutCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineLibraryCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineLibraryCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkPipelineLibraryCreateInfoKHR& src, VkPipelineLibraryCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineMultisampleStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineMultisampleStateCreateInfo& src, size_t& offset, const DeepCopyGraphicsPipelineState& context = {});
+    static void copy(const VkPipelineMultisampleStateCreateInfo& src, VkPipelineMultisampleStateCreateInfo& dst, DeepCopyCursor& cursor, const DeepCopyGraphicsPipelineState& context = {});
+  };
+
+  template <> struct DeepCopyTraits<VkPipelinePropertiesIdentifierEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelinePropertiesIdentifierEXT& src, size_t& offset);
+    static void copy(const VkPipelinePropertiesIdentifierEXT& src, VkPipelinePropertiesIdentifierEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationConservativeStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationConservativeStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationConservativeStateCreateInfoEXT& src, VkPipelineRasterizationConservativeStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationDepthClipStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationDepthClipStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationDepthClipStateCreateInfoEXT& src, VkPipelineRasterizationDepthClipStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationLineStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationLineStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationLineStateCreateInfoEXT& src, VkPipelineRasterizationLineStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& src, VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationStateCreateInfo& src, VkPipelineRasterizationStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationStateRasterizationOrderAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationStateRasterizationOrderAMD& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationStateRasterizationOrderAMD& src, VkPipelineRasterizationStateRasterizationOrderAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRasterizationStateStreamCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRasterizationStateStreamCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineRasterizationStateStreamCreateInfoEXT& src, VkPipelineRasterizationStateStreamCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRenderingCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRenderingCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineRenderingCreateInfo& src, VkPipelineRenderingCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRepresentativeFragmentTestStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& src, VkPipelineRepresentativeFragmentTestStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineRobustnessCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineRobustnessCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineRobustnessCreateInfoEXT& src, VkPipelineRobustnessCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineSampleLocationsStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineSampleLocationsStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineSampleLocationsStateCreateInfoEXT& src, VkPipelineSampleLocationsStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSpecializationInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSpecializationInfo& src, size_t& offset);
+    static void copy(const VkSpecializationInfo& src, VkSpecializationInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineShaderStageCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineShaderStageCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineShaderStageCreateInfo& src, VkPipelineShaderStageCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineShaderStageModuleIdentifierCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineShaderStageModuleIdentifierCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineShaderStageModuleIdentifierCreateInfoEXT& src, VkPipelineShaderStageModuleIdentifierCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& src, VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineTessellationDomainOriginStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineTessellationDomainOriginStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineTessellationDomainOriginStateCreateInfo& src, VkPipelineTessellationDomainOriginStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineTessellationStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineTessellationStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineTessellationStateCreateInfo& src, VkPipelineTessellationStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineVertexInputDivisorStateCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineVertexInputDivisorStateCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineVertexInputDivisorStateCreateInfoEXT& src, VkPipelineVertexInputDivisorStateCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineVertexInputStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineVertexInputStateCreateInfo& src, size_t& offset);
+    static void copy(const VkPipelineVertexInputStateCreateInfo& src, VkPipelineVertexInputStateCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkCoarseSampleOrderCustomNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkCoarseSampleOrderCustomNV& src, size_t& offset);
+    static void copy(const VkCoarseSampleOrderCustomNV& src, VkCoarseSampleOrderCustomNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& src, VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportDepthClipControlCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportDepthClipControlCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkPipelineViewportDepthClipControlCreateInfoEXT& src, VkPipelineViewportDepthClipControlCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportExclusiveScissorStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportExclusiveScissorStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineViewportExclusiveScissorStateCreateInfoNV& src, VkPipelineViewportExclusiveScissorStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkShadingRatePaletteNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkShadingRatePaletteNV& src, size_t& offset);
+    static void copy(const VkShadingRatePaletteNV& src, VkShadingRatePaletteNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportShadingRateImageStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportShadingRateImageStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineViewportShadingRateImageStateCreateInfoNV& src, VkPipelineViewportShadingRateImageStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportStateCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportStateCreateInfo& src, size_t& offset, const DeepCopyGraphicsPipelineState& context = {});
+    static void copy(const VkPipelineViewportStateCreateInfo& src, VkPipelineViewportStateCreateInfo& dst, DeepCopyCursor& cursor, const DeepCopyGraphicsPipelineState& context = {});
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportSwizzleStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportSwizzleStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineViewportSwizzleStateCreateInfoNV& src, VkPipelineViewportSwizzleStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPipelineViewportWScalingStateCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkPipelineViewportWScalingStateCreateInfoNV& src, size_t& offset);
+    static void copy(const VkPipelineViewportWScalingStateCreateInfoNV& src, VkPipelineViewportWScalingStateCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_GGP
+  template <> struct DeepCopyTraits<VkPresentFrameTokenGGP> {
+    static constexpr bool Supported = true;
+    static void size(const VkPresentFrameTokenGGP& src, size_t& offset);
+    static void copy(const VkPresentFrameTokenGGP& src, VkPresentFrameTokenGGP& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkPresentIdKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPresentIdKHR& src, size_t& offset);
+    static void copy(const VkPresentIdKHR& src, VkPresentIdKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPresentInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPresentInfoKHR& src, size_t& offset);
+    static void copy(const VkPresentInfoKHR& src, VkPresentInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPresentRegionKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPresentRegionKHR& src, size_t& offset);
+    static void copy(const VkPresentRegionKHR& src, VkPresentRegionKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPresentRegionsKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkPresentRegionsKHR& src, size_t& offset);
+    static void copy(const VkPresentRegionsKHR& src, VkPresentRegionsKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPresentTimesInfoGOOGLE> {
+    static constexpr bool Supported = true;
+    static void size(const VkPresentTimesInfoGOOGLE& src, size_t& offset);
+    static void copy(const VkPresentTimesInfoGOOGLE& src, VkPresentTimesInfoGOOGLE& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkPrivateDataSlotCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkPrivateDataSlotCreateInfo& src, size_t& offset);
+    static void copy(const VkPrivateDataSlotCreateInfo& src, VkPrivateDataSlotCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkProtectedSubmitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkProtectedSubmitInfo& src, size_t& offset);
+    static void copy(const VkProtectedSubmitInfo& src, VkProtectedSubmitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueryLowLatencySupportNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueryLowLatencySupportNV& src, size_t& offset);
+    static void copy(const VkQueryLowLatencySupportNV& src, VkQueryLowLatencySupportNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueryPoolCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueryPoolCreateInfo& src, size_t& offset);
+    static void copy(const VkQueryPoolCreateInfo& src, VkQueryPoolCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueryPoolPerformanceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueryPoolPerformanceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkQueryPoolPerformanceCreateInfoKHR& src, VkQueryPoolPerformanceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueryPoolPerformanceQueryCreateInfoINTEL> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueryPoolPerformanceQueryCreateInfoINTEL& src, size_t& offset);
+    static void copy(const VkQueryPoolPerformanceQueryCreateInfoINTEL& src, VkQueryPoolPerformanceQueryCreateInfoINTEL& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkQueryPoolVideoEncodeFeedbackCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& src, VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkQueueFamilyCheckpointProperties2NV> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueueFamilyCheckpointProperties2NV& src, size_t& offset);
+    static void copy(const VkQueueFamilyCheckpointProperties2NV& src, VkQueueFamilyCheckpointProperties2NV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueueFamilyCheckpointPropertiesNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueueFamilyCheckpointPropertiesNV& src, size_t& offset);
+    static void copy(const VkQueueFamilyCheckpointPropertiesNV& src, VkQueueFamilyCheckpointPropertiesNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueueFamilyGlobalPriorityPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueueFamilyGlobalPriorityPropertiesKHR& src, size_t& offset);
+    static void copy(const VkQueueFamilyGlobalPriorityPropertiesKHR& src, VkQueueFamilyGlobalPriorityPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueueFamilyProperties2> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueueFamilyProperties2& src, size_t& offset);
+    static void copy(const VkQueueFamilyProperties2& src, VkQueueFamilyProperties2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueueFamilyQueryResultStatusPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueueFamilyQueryResultStatusPropertiesKHR& src, size_t& offset);
+    static void copy(const VkQueueFamilyQueryResultStatusPropertiesKHR& src, VkQueueFamilyQueryResultStatusPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkQueueFamilyVideoPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkQueueFamilyVideoPropertiesKHR& src, size_t& offset);
+    static void copy(const VkQueueFamilyVideoPropertiesKHR& src, VkQueueFamilyVideoPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRayTracingPipelineCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkRayTracingPipelineCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkRayTracingPipelineCreateInfoKHR& src, VkRayTracingPipelineCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRayTracingPipelineCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkRayTracingPipelineCreateInfoNV& src, size_t& offset);
+    static void copy(const VkRayTracingPipelineCreateInfoNV& src, VkRayTracingPipelineCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRayTracingPipelineInterfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkRayTracingPipelineInterfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkRayTracingPipelineInterfaceCreateInfoKHR& src, VkRayTracingPipelineInterfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRayTracingShaderGroupCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkRayTracingShaderGroupCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkRayTracingShaderGroupCreateInfoKHR& src, VkRayTracingShaderGroupCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRayTracingShaderGroupCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkRayTracingShaderGroupCreateInfoNV& src, size_t& offset);
+    static void copy(const VkRayTracingShaderGroupCreateInfoNV& src, VkRayTracingShaderGroupCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkReleaseSwapchainImagesInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkReleaseSwapchainImagesInfoEXT& src, size_t& offset);
+    static void copy(const VkReleaseSwapchainImagesInfoEXT& src, VkReleaseSwapchainImagesInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassAttachmentBeginInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassAttachmentBeginInfo& src, size_t& offset);
+    static void copy(const VkRenderPassAttachmentBeginInfo& src, VkRenderPassAttachmentBeginInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassBeginInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassBeginInfo& src, size_t& offset);
+    static void copy(const VkRenderPassBeginInfo& src, VkRenderPassBeginInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassDescription> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassDescription& src, size_t& offset);
+    static void copy(const VkSubpassDescription& src, VkSubpassDescription& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassCreateInfo& src, size_t& offset);
+    static void copy(const VkRenderPassCreateInfo& src, VkRenderPassCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassCreateInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassCreateInfo2& src, size_t& offset);
+    static void copy(const VkRenderPassCreateInfo2& src, VkRenderPassCreateInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassCreationControlEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassCreationControlEXT& src, size_t& offset);
+    static void copy(const VkRenderPassCreationControlEXT& src, VkRenderPassCreationControlEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassCreationFeedbackCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassCreationFeedbackCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkRenderPassCreationFeedbackCreateInfoEXT& src, VkRenderPassCreationFeedbackCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassFragmentDensityMapCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassFragmentDensityMapCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkRenderPassFragmentDensityMapCreateInfoEXT& src, VkRenderPassFragmentDensityMapCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassInputAttachmentAspectCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassInputAttachmentAspectCreateInfo& src, size_t& offset);
+    static void copy(const VkRenderPassInputAttachmentAspectCreateInfo& src, VkRenderPassInputAttachmentAspectCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassMultiviewCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassMultiviewCreateInfo& src, size_t& offset);
+    static void copy(const VkRenderPassMultiviewCreateInfo& src, VkRenderPassMultiviewCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkAttachmentSampleLocationsEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkAttachmentSampleLocationsEXT& src, size_t& offset);
+    static void copy(const VkAttachmentSampleLocationsEXT& src, VkAttachmentSampleLocationsEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassSampleLocationsEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassSampleLocationsEXT& src, size_t& offset);
+    static void copy(const VkSubpassSampleLocationsEXT& src, VkSubpassSampleLocationsEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassSampleLocationsBeginInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassSampleLocationsBeginInfoEXT& src, size_t& offset);
+    static void copy(const VkRenderPassSampleLocationsBeginInfoEXT& src, VkRenderPassSampleLocationsBeginInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassSubpassFeedbackCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassSubpassFeedbackCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkRenderPassSubpassFeedbackCreateInfoEXT& src, VkRenderPassSubpassFeedbackCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderPassTransformBeginInfoQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderPassTransformBeginInfoQCOM& src, size_t& offset);
+    static void copy(const VkRenderPassTransformBeginInfoQCOM& src, VkRenderPassTransformBeginInfoQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderingAttachmentInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderingAttachmentInfo& src, size_t& offset);
+    static void copy(const VkRenderingAttachmentInfo& src, VkRenderingAttachmentInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderingFragmentDensityMapAttachmentInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderingFragmentDensityMapAttachmentInfoEXT& src, size_t& offset);
+    static void copy(const VkRenderingFragmentDensityMapAttachmentInfoEXT& src, VkRenderingFragmentDensityMapAttachmentInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderingFragmentShadingRateAttachmentInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderingFragmentShadingRateAttachmentInfoKHR& src, size_t& offset);
+    static void copy(const VkRenderingFragmentShadingRateAttachmentInfoKHR& src, VkRenderingFragmentShadingRateAttachmentInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkRenderingInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkRenderingInfo& src, size_t& offset);
+    static void copy(const VkRenderingInfo& src, VkRenderingInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkResolveImageInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkResolveImageInfo2& src, size_t& offset);
+    static void copy(const VkResolveImageInfo2& src, VkResolveImageInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSampleLocationsInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSampleLocationsInfoEXT& src, size_t& offset);
+    static void copy(const VkSampleLocationsInfoEXT& src, VkSampleLocationsInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerBorderColorComponentMappingCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerBorderColorComponentMappingCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkSamplerBorderColorComponentMappingCreateInfoEXT& src, VkSamplerBorderColorComponentMappingCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerCaptureDescriptorDataInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerCaptureDescriptorDataInfoEXT& src, size_t& offset);
+    static void copy(const VkSamplerCaptureDescriptorDataInfoEXT& src, VkSamplerCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerCreateInfo& src, size_t& offset);
+    static void copy(const VkSamplerCreateInfo& src, VkSamplerCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerCustomBorderColorCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerCustomBorderColorCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkSamplerCustomBorderColorCreateInfoEXT& src, VkSamplerCustomBorderColorCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerReductionModeCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerReductionModeCreateInfo& src, size_t& offset);
+    static void copy(const VkSamplerReductionModeCreateInfo& src, VkSamplerReductionModeCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerYcbcrConversionCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerYcbcrConversionCreateInfo& src, size_t& offset);
+    static void copy(const VkSamplerYcbcrConversionCreateInfo& src, VkSamplerYcbcrConversionCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerYcbcrConversionImageFormatProperties> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerYcbcrConversionImageFormatProperties& src, size_t& offset);
+    static void copy(const VkSamplerYcbcrConversionImageFormatProperties& src, VkSamplerYcbcrConversionImageFormatProperties& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSamplerYcbcrConversionInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSamplerYcbcrConversionInfo& src, size_t& offset);
+    static void copy(const VkSamplerYcbcrConversionInfo& src, VkSamplerYcbcrConversionInfo& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+  template <> struct DeepCopyTraits<VkScreenSurfaceCreateInfoQNX> {
+    static constexpr bool Supported = true;
+    static void size(const VkScreenSurfaceCreateInfoQNX& src, size_t& offset);
+    static void copy(const VkScreenSurfaceCreateInfoQNX& src, VkScreenSurfaceCreateInfoQNX& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkSemaphoreCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreCreateInfo& src, size_t& offset);
+    static void copy(const VkSemaphoreCreateInfo& src, VkSemaphoreCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSemaphoreGetFdInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreGetFdInfoKHR& src, size_t& offset);
+    static void copy(const VkSemaphoreGetFdInfoKHR& src, VkSemaphoreGetFdInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkSemaphoreGetWin32HandleInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreGetWin32HandleInfoKHR& src, size_t& offset);
+    static void copy(const VkSemaphoreGetWin32HandleInfoKHR& src, VkSemaphoreGetWin32HandleInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkSemaphoreGetZirconHandleInfoFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreGetZirconHandleInfoFUCHSIA& src, size_t& offset);
+    static void copy(const VkSemaphoreGetZirconHandleInfoFUCHSIA& src, VkSemaphoreGetZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkSemaphoreSignalInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreSignalInfo& src, size_t& offset);
+    static void copy(const VkSemaphoreSignalInfo& src, VkSemaphoreSignalInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSemaphoreSubmitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreSubmitInfo& src, size_t& offset);
+    static void copy(const VkSemaphoreSubmitInfo& src, VkSemaphoreSubmitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSemaphoreTypeCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreTypeCreateInfo& src, size_t& offset);
+    static void copy(const VkSemaphoreTypeCreateInfo& src, VkSemaphoreTypeCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSemaphoreWaitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSemaphoreWaitInfo& src, size_t& offset);
+    static void copy(const VkSemaphoreWaitInfo& src, VkSemaphoreWaitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkShaderCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkShaderCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkShaderCreateInfoEXT& src, VkShaderCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkShaderModuleCreateInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkShaderModuleCreateInfo& src, size_t& offset);
+    static void copy(const VkShaderModuleCreateInfo& src, VkShaderModuleCreateInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkShaderModuleIdentifierEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkShaderModuleIdentifierEXT& src, size_t& offset);
+    static void copy(const VkShaderModuleIdentifierEXT& src, VkShaderModuleIdentifierEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkShaderModuleValidationCacheCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkShaderModuleValidationCacheCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkShaderModuleValidationCacheCreateInfoEXT& src, VkShaderModuleValidationCacheCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSharedPresentSurfaceCapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSharedPresentSurfaceCapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkSharedPresentSurfaceCapabilitiesKHR& src, VkSharedPresentSurfaceCapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSparseImageFormatProperties2> {
+    static constexpr bool Supported = true;
+    static void size(const VkSparseImageFormatProperties2& src, size_t& offset);
+    static void copy(const VkSparseImageFormatProperties2& src, VkSparseImageFormatProperties2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSparseImageMemoryRequirements2> {
+    static constexpr bool Supported = true;
+    static void size(const VkSparseImageMemoryRequirements2& src, size_t& offset);
+    static void copy(const VkSparseImageMemoryRequirements2& src, VkSparseImageMemoryRequirements2& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_GGP
+  template <> struct DeepCopyTraits<VkStreamDescriptorSurfaceCreateInfoGGP> {
+    static constexpr bool Supported = true;
+    static void size(const VkStreamDescriptorSurfaceCreateInfoGGP& src, size_t& offset);
+    static void copy(const VkStreamDescriptorSurfaceCreateInfoGGP& src, VkStreamDescriptorSurfaceCreateInfoGGP& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkSubmitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubmitInfo& src, size_t& offset);
+    static void copy(const VkSubmitInfo& src, VkSubmitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubmitInfo2> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubmitInfo2& src, size_t& offset);
+    static void copy(const VkSubmitInfo2& src, VkSubmitInfo2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassBeginInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassBeginInfo& src, size_t& offset);
+    static void copy(const VkSubpassBeginInfo& src, VkSubpassBeginInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassDependency2> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassDependency2& src, size_t& offset);
+    static void copy(const VkSubpassDependency2& src, VkSubpassDependency2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassDescription2> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassDescription2& src, size_t& offset);
+    static void copy(const VkSubpassDescription2& src, VkSubpassDescription2& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassDescriptionDepthStencilResolve> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassDescriptionDepthStencilResolve& src, size_t& offset);
+    static void copy(const VkSubpassDescriptionDepthStencilResolve& src, VkSubpassDescriptionDepthStencilResolve& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassEndInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassEndInfo& src, size_t& offset);
+    static void copy(const VkSubpassEndInfo& src, VkSubpassEndInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassFragmentDensityMapOffsetEndInfoQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassFragmentDensityMapOffsetEndInfoQCOM& src, size_t& offset);
+    static void copy(const VkSubpassFragmentDensityMapOffsetEndInfoQCOM& src, VkSubpassFragmentDensityMapOffsetEndInfoQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassResolvePerformanceQueryEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassResolvePerformanceQueryEXT& src, size_t& offset);
+    static void copy(const VkSubpassResolvePerformanceQueryEXT& src, VkSubpassResolvePerformanceQueryEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubpassShadingPipelineCreateInfoHUAWEI> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubpassShadingPipelineCreateInfoHUAWEI& src, size_t& offset);
+    static void copy(const VkSubpassShadingPipelineCreateInfoHUAWEI& src, VkSubpassShadingPipelineCreateInfoHUAWEI& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSubresourceLayout2EXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSubresourceLayout2EXT& src, size_t& offset);
+    static void copy(const VkSubresourceLayout2EXT& src, VkSubresourceLayout2EXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSurfaceCapabilities2EXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceCapabilities2EXT& src, size_t& offset);
+    static void copy(const VkSurfaceCapabilities2EXT& src, VkSurfaceCapabilities2EXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSurfaceCapabilities2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceCapabilities2KHR& src, size_t& offset);
+    static void copy(const VkSurfaceCapabilities2KHR& src, VkSurfaceCapabilities2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkSurfaceCapabilitiesFullScreenExclusiveEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceCapabilitiesFullScreenExclusiveEXT& src, size_t& offset);
+    static void copy(const VkSurfaceCapabilitiesFullScreenExclusiveEXT& src, VkSurfaceCapabilitiesFullScreenExclusiveEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkSurfaceCapabilitiesPresentBarrierNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceCapabilitiesPresentBarrierNV& src, size_t& offset);
+    static void copy(const VkSurfaceCapabilitiesPresentBarrierNV& src, VkSurfaceCapabilitiesPresentBarrierNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSurfaceFormat2KHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceFormat2KHR& src, size_t& offset);
+    static void copy(const VkSurfaceFormat2KHR& src, VkSurfaceFormat2KHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkSurfaceFullScreenExclusiveInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceFullScreenExclusiveInfoEXT& src, size_t& offset);
+    static void copy(const VkSurfaceFullScreenExclusiveInfoEXT& src, VkSurfaceFullScreenExclusiveInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkSurfaceFullScreenExclusiveWin32InfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceFullScreenExclusiveWin32InfoEXT& src, size_t& offset);
+    static void copy(const VkSurfaceFullScreenExclusiveWin32InfoEXT& src, VkSurfaceFullScreenExclusiveWin32InfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkSurfacePresentModeCompatibilityEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfacePresentModeCompatibilityEXT& src, size_t& offset);
+    static void copy(const VkSurfacePresentModeCompatibilityEXT& src, VkSurfacePresentModeCompatibilityEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSurfacePresentModeEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfacePresentModeEXT& src, size_t& offset);
+    static void copy(const VkSurfacePresentModeEXT& src, VkSurfacePresentModeEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSurfacePresentScalingCapabilitiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfacePresentScalingCapabilitiesEXT& src, size_t& offset);
+    static void copy(const VkSurfacePresentScalingCapabilitiesEXT& src, VkSurfacePresentScalingCapabilitiesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSurfaceProtectedCapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSurfaceProtectedCapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkSurfaceProtectedCapabilitiesKHR& src, VkSurfaceProtectedCapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainCounterCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainCounterCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkSwapchainCounterCreateInfoEXT& src, VkSwapchainCounterCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkSwapchainCreateInfoKHR& src, VkSwapchainCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainDisplayNativeHdrCreateInfoAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainDisplayNativeHdrCreateInfoAMD& src, size_t& offset);
+    static void copy(const VkSwapchainDisplayNativeHdrCreateInfoAMD& src, VkSwapchainDisplayNativeHdrCreateInfoAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainPresentBarrierCreateInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainPresentBarrierCreateInfoNV& src, size_t& offset);
+    static void copy(const VkSwapchainPresentBarrierCreateInfoNV& src, VkSwapchainPresentBarrierCreateInfoNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainPresentFenceInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainPresentFenceInfoEXT& src, size_t& offset);
+    static void copy(const VkSwapchainPresentFenceInfoEXT& src, VkSwapchainPresentFenceInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainPresentModeInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainPresentModeInfoEXT& src, size_t& offset);
+    static void copy(const VkSwapchainPresentModeInfoEXT& src, VkSwapchainPresentModeInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainPresentModesCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainPresentModesCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkSwapchainPresentModesCreateInfoEXT& src, VkSwapchainPresentModesCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkSwapchainPresentScalingCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkSwapchainPresentScalingCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkSwapchainPresentScalingCreateInfoEXT& src, VkSwapchainPresentScalingCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct DeepCopyTraits<VkSysmemColorSpaceFUCHSIA> {
+    static constexpr bool Supported = true;
+    static void size(const VkSysmemColorSpaceFUCHSIA& src, size_t& offset);
+    static void copy(const VkSysmemColorSpaceFUCHSIA& src, VkSysmemColorSpaceFUCHSIA& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkTextureLODGatherFormatPropertiesAMD> {
+    static constexpr bool Supported = true;
+    static void size(const VkTextureLODGatherFormatPropertiesAMD& src, size_t& offset);
+    static void copy(const VkTextureLODGatherFormatPropertiesAMD& src, VkTextureLODGatherFormatPropertiesAMD& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkTilePropertiesQCOM> {
+    static constexpr bool Supported = true;
+    static void size(const VkTilePropertiesQCOM& src, size_t& offset);
+    static void copy(const VkTilePropertiesQCOM& src, VkTilePropertiesQCOM& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkTimelineSemaphoreSubmitInfo> {
+    static constexpr bool Supported = true;
+    static void size(const VkTimelineSemaphoreSubmitInfo& src, size_t& offset);
+    static void copy(const VkTimelineSemaphoreSubmitInfo& src, VkTimelineSemaphoreSubmitInfo& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkValidationCacheCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkValidationCacheCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkValidationCacheCreateInfoEXT& src, VkValidationCacheCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkValidationFeaturesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkValidationFeaturesEXT& src, size_t& offset);
+    static void copy(const VkValidationFeaturesEXT& src, VkValidationFeaturesEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkValidationFlagsEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkValidationFlagsEXT& src, size_t& offset);
+    static void copy(const VkValidationFlagsEXT& src, VkValidationFlagsEXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVertexInputAttributeDescription2EXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVertexInputAttributeDescription2EXT& src, size_t& offset);
+    static void copy(const VkVertexInputAttributeDescription2EXT& src, VkVertexInputAttributeDescription2EXT& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVertexInputBindingDescription2EXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVertexInputBindingDescription2EXT& src, size_t& offset);
+    static void copy(const VkVertexInputBindingDescription2EXT& src, VkVertexInputBindingDescription2EXT& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_VI_NN
+  template <> struct DeepCopyTraits<VkViSurfaceCreateInfoNN> {
+    static constexpr bool Supported = true;
+    static void size(const VkViSurfaceCreateInfoNN& src, size_t& offset);
+    static void copy(const VkViSurfaceCreateInfoNN& src, VkViSurfaceCreateInfoNN& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkVideoBeginCodingInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoBeginCodingInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoBeginCodingInfoKHR& src, VkVideoBeginCodingInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoCapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoCapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkVideoCapabilitiesKHR& src, VkVideoCapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoCodingControlInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoCodingControlInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoCodingControlInfoKHR& src, VkVideoCodingControlInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeCapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeCapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeCapabilitiesKHR& src, VkVideoDecodeCapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH264CapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH264CapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH264CapabilitiesKHR& src, VkVideoDecodeH264CapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH264DpbSlotInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH264DpbSlotInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH264DpbSlotInfoKHR& src, VkVideoDecodeH264DpbSlotInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH264PictureInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH264PictureInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH264PictureInfoKHR& src, VkVideoDecodeH264PictureInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH264ProfileInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH264ProfileInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH264ProfileInfoKHR& src, VkVideoDecodeH264ProfileInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH264SessionParametersAddInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH264SessionParametersAddInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH264SessionParametersAddInfoKHR& src, VkVideoDecodeH264SessionParametersAddInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH264SessionParametersCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH264SessionParametersCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH264SessionParametersCreateInfoKHR& src, VkVideoDecodeH264SessionParametersCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH265CapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH265CapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH265CapabilitiesKHR& src, VkVideoDecodeH265CapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH265DpbSlotInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH265DpbSlotInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH265DpbSlotInfoKHR& src, VkVideoDecodeH265DpbSlotInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH265PictureInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH265PictureInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH265PictureInfoKHR& src, VkVideoDecodeH265PictureInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH265ProfileInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH265ProfileInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH265ProfileInfoKHR& src, VkVideoDecodeH265ProfileInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH265SessionParametersAddInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH265SessionParametersAddInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH265SessionParametersAddInfoKHR& src, VkVideoDecodeH265SessionParametersAddInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeH265SessionParametersCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeH265SessionParametersCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeH265SessionParametersCreateInfoKHR& src, VkVideoDecodeH265SessionParametersCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeInfoKHR& src, VkVideoDecodeInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoDecodeUsageInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoDecodeUsageInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoDecodeUsageInfoKHR& src, VkVideoDecodeUsageInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeCapabilitiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeCapabilitiesKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeCapabilitiesKHR& src, VkVideoEncodeCapabilitiesKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264CapabilitiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264CapabilitiesEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264CapabilitiesEXT& src, VkVideoEncodeH264CapabilitiesEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264DpbSlotInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264DpbSlotInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264DpbSlotInfoEXT& src, VkVideoEncodeH264DpbSlotInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264GopRemainingFrameInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264GopRemainingFrameInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264GopRemainingFrameInfoEXT& src, VkVideoEncodeH264GopRemainingFrameInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264NaluSliceInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264NaluSliceInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264NaluSliceInfoEXT& src, VkVideoEncodeH264NaluSliceInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264PictureInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264PictureInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264PictureInfoEXT& src, VkVideoEncodeH264PictureInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264ProfileInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264ProfileInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264ProfileInfoEXT& src, VkVideoEncodeH264ProfileInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264QualityLevelPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264QualityLevelPropertiesEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264QualityLevelPropertiesEXT& src, VkVideoEncodeH264QualityLevelPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264RateControlInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264RateControlInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264RateControlInfoEXT& src, VkVideoEncodeH264RateControlInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264RateControlLayerInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264RateControlLayerInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264RateControlLayerInfoEXT& src, VkVideoEncodeH264RateControlLayerInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264SessionCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264SessionCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264SessionCreateInfoEXT& src, VkVideoEncodeH264SessionCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264SessionParametersAddInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264SessionParametersAddInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264SessionParametersAddInfoEXT& src, VkVideoEncodeH264SessionParametersAddInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264SessionParametersCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264SessionParametersCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264SessionParametersCreateInfoEXT& src, VkVideoEncodeH264SessionParametersCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264SessionParametersFeedbackInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264SessionParametersFeedbackInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264SessionParametersFeedbackInfoEXT& src, VkVideoEncodeH264SessionParametersFeedbackInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH264SessionParametersGetInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH264SessionParametersGetInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH264SessionParametersGetInfoEXT& src, VkVideoEncodeH264SessionParametersGetInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265CapabilitiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265CapabilitiesEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265CapabilitiesEXT& src, VkVideoEncodeH265CapabilitiesEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265DpbSlotInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265DpbSlotInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265DpbSlotInfoEXT& src, VkVideoEncodeH265DpbSlotInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265GopRemainingFrameInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265GopRemainingFrameInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265GopRemainingFrameInfoEXT& src, VkVideoEncodeH265GopRemainingFrameInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265NaluSliceSegmentInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265NaluSliceSegmentInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265NaluSliceSegmentInfoEXT& src, VkVideoEncodeH265NaluSliceSegmentInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265PictureInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265PictureInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265PictureInfoEXT& src, VkVideoEncodeH265PictureInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265ProfileInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265ProfileInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265ProfileInfoEXT& src, VkVideoEncodeH265ProfileInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265QualityLevelPropertiesEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265QualityLevelPropertiesEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265QualityLevelPropertiesEXT& src, VkVideoEncodeH265QualityLevelPropertiesEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265RateControlInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265RateControlInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265RateControlInfoEXT& src, VkVideoEncodeH265RateControlInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265RateControlLayerInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265RateControlLayerInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265RateControlLayerInfoEXT& src, VkVideoEncodeH265RateControlLayerInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265SessionCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265SessionCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265SessionCreateInfoEXT& src, VkVideoEncodeH265SessionCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265SessionParametersAddInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265SessionParametersAddInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265SessionParametersAddInfoEXT& src, VkVideoEncodeH265SessionParametersAddInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265SessionParametersCreateInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265SessionParametersCreateInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265SessionParametersCreateInfoEXT& src, VkVideoEncodeH265SessionParametersCreateInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265SessionParametersFeedbackInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265SessionParametersFeedbackInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265SessionParametersFeedbackInfoEXT& src, VkVideoEncodeH265SessionParametersFeedbackInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeH265SessionParametersGetInfoEXT> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeH265SessionParametersGetInfoEXT& src, size_t& offset);
+    static void copy(const VkVideoEncodeH265SessionParametersGetInfoEXT& src, VkVideoEncodeH265SessionParametersGetInfoEXT& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeInfoKHR& src, VkVideoEncodeInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeQualityLevelInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeQualityLevelInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeQualityLevelInfoKHR& src, VkVideoEncodeQualityLevelInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeQualityLevelPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeQualityLevelPropertiesKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeQualityLevelPropertiesKHR& src, VkVideoEncodeQualityLevelPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeRateControlInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeRateControlInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeRateControlInfoKHR& src, VkVideoEncodeRateControlInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeRateControlLayerInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeRateControlLayerInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeRateControlLayerInfoKHR& src, VkVideoEncodeRateControlLayerInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeSessionParametersFeedbackInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeSessionParametersFeedbackInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeSessionParametersFeedbackInfoKHR& src, VkVideoEncodeSessionParametersFeedbackInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeSessionParametersGetInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeSessionParametersGetInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeSessionParametersGetInfoKHR& src, VkVideoEncodeSessionParametersGetInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct DeepCopyTraits<VkVideoEncodeUsageInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEncodeUsageInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEncodeUsageInfoKHR& src, VkVideoEncodeUsageInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkVideoEndCodingInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoEndCodingInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoEndCodingInfoKHR& src, VkVideoEndCodingInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoFormatPropertiesKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoFormatPropertiesKHR& src, size_t& offset);
+    static void copy(const VkVideoFormatPropertiesKHR& src, VkVideoFormatPropertiesKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoPictureResourceInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoPictureResourceInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoPictureResourceInfoKHR& src, VkVideoPictureResourceInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoProfileInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoProfileInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoProfileInfoKHR& src, VkVideoProfileInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoProfileListInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoProfileListInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoProfileListInfoKHR& src, VkVideoProfileListInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoReferenceSlotInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoReferenceSlotInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoReferenceSlotInfoKHR& src, VkVideoReferenceSlotInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoSessionCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoSessionCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoSessionCreateInfoKHR& src, VkVideoSessionCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoSessionMemoryRequirementsKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoSessionMemoryRequirementsKHR& src, size_t& offset);
+    static void copy(const VkVideoSessionMemoryRequirementsKHR& src, VkVideoSessionMemoryRequirementsKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoSessionParametersCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoSessionParametersCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoSessionParametersCreateInfoKHR& src, VkVideoSessionParametersCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkVideoSessionParametersUpdateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkVideoSessionParametersUpdateInfoKHR& src, size_t& offset);
+    static void copy(const VkVideoSessionParametersUpdateInfoKHR& src, VkVideoSessionParametersUpdateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+  template <> struct DeepCopyTraits<VkWaylandSurfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkWaylandSurfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkWaylandSurfaceCreateInfoKHR& src, VkWaylandSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkWin32KeyedMutexAcquireReleaseInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkWin32KeyedMutexAcquireReleaseInfoKHR& src, size_t& offset);
+    static void copy(const VkWin32KeyedMutexAcquireReleaseInfoKHR& src, VkWin32KeyedMutexAcquireReleaseInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkWin32KeyedMutexAcquireReleaseInfoNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkWin32KeyedMutexAcquireReleaseInfoNV& src, size_t& offset);
+    static void copy(const VkWin32KeyedMutexAcquireReleaseInfoNV& src, VkWin32KeyedMutexAcquireReleaseInfoNV& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct DeepCopyTraits<VkWin32SurfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkWin32SurfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkWin32SurfaceCreateInfoKHR& src, VkWin32SurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  template <> struct DeepCopyTraits<VkWriteDescriptorSet> {
+    static constexpr bool Supported = true;
+    static void size(const VkWriteDescriptorSet& src, size_t& offset);
+    static void copy(const VkWriteDescriptorSet& src, VkWriteDescriptorSet& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkWriteDescriptorSetAccelerationStructureKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkWriteDescriptorSetAccelerationStructureKHR& src, size_t& offset);
+    static void copy(const VkWriteDescriptorSetAccelerationStructureKHR& src, VkWriteDescriptorSetAccelerationStructureKHR& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkWriteDescriptorSetAccelerationStructureNV> {
+    static constexpr bool Supported = true;
+    static void size(const VkWriteDescriptorSetAccelerationStructureNV& src, size_t& offset);
+    static void copy(const VkWriteDescriptorSetAccelerationStructureNV& src, VkWriteDescriptorSetAccelerationStructureNV& dst, DeepCopyCursor& cursor);
+  };
+
+  template <> struct DeepCopyTraits<VkWriteDescriptorSetInlineUniformBlock> {
+    static constexpr bool Supported = true;
+    static void size(const VkWriteDescriptorSetInlineUniformBlock& src, size_t& offset);
+    static void copy(const VkWriteDescriptorSetInlineUniformBlock& src, VkWriteDescriptorSetInlineUniformBlock& dst, DeepCopyCursor& cursor);
+  };
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+  template <> struct DeepCopyTraits<VkXcbSurfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkXcbSurfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkXcbSurfaceCreateInfoKHR& src, VkXcbSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+  template <> struct DeepCopyTraits<VkXlibSurfaceCreateInfoKHR> {
+    static constexpr bool Supported = true;
+    static void size(const VkXlibSurfaceCreateInfoKHR& src, size_t& offset);
+    static void copy(const VkXlibSurfaceCreateInfoKHR& src, VkXlibSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor);
+  };
+#endif
+
+  inline void DeepCopyTraits<VkAccelerationStructureBuildSizesInfoKHR>::size(const VkAccelerationStructureBuildSizesInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureBuildSizesInfoKHR>::copy(const VkAccelerationStructureBuildSizesInfoKHR& src, VkAccelerationStructureBuildSizesInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureCaptureDescriptorDataInfoEXT>::size(const VkAccelerationStructureCaptureDescriptorDataInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureCaptureDescriptorDataInfoEXT>::copy(const VkAccelerationStructureCaptureDescriptorDataInfoEXT& src, VkAccelerationStructureCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureCreateInfoKHR>::size(const VkAccelerationStructureCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureCreateInfoKHR>::copy(const VkAccelerationStructureCreateInfoKHR& src, VkAccelerationStructureCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureCreateInfoNV>::size(const VkAccelerationStructureCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkAccelerationStructureInfoNV>::size(src.info, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureCreateInfoNV>::copy(const VkAccelerationStructureCreateInfoNV& src, VkAccelerationStructureCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkAccelerationStructureInfoNV>::copy(src.info, dst.info, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureDeviceAddressInfoKHR>::size(const VkAccelerationStructureDeviceAddressInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureDeviceAddressInfoKHR>::copy(const VkAccelerationStructureDeviceAddressInfoKHR& src, VkAccelerationStructureDeviceAddressInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryAabbsDataKHR>::size(const VkAccelerationStructureGeometryAabbsDataKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryAabbsDataKHR>::copy(const VkAccelerationStructureGeometryAabbsDataKHR& src, VkAccelerationStructureGeometryAabbsDataKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryInstancesDataKHR>::size(const VkAccelerationStructureGeometryInstancesDataKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryInstancesDataKHR>::copy(const VkAccelerationStructureGeometryInstancesDataKHR& src, VkAccelerationStructureGeometryInstancesDataKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryMotionTrianglesDataNV>::size(const VkAccelerationStructureGeometryMotionTrianglesDataNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryMotionTrianglesDataNV>::copy(const VkAccelerationStructureGeometryMotionTrianglesDataNV& src, VkAccelerationStructureGeometryMotionTrianglesDataNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryTrianglesDataKHR>::size(const VkAccelerationStructureGeometryTrianglesDataKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureGeometryTrianglesDataKHR>::copy(const VkAccelerationStructureGeometryTrianglesDataKHR& src, VkAccelerationStructureGeometryTrianglesDataKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureInfoNV>::size(const VkAccelerationStructureInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pGeometries, src.geometryCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureInfoNV>::copy(const VkAccelerationStructureInfoNV& src, VkAccelerationStructureInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pGeometries = DeepCopyArray(src.pGeometries, src.geometryCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureMemoryRequirementsInfoNV>::size(const VkAccelerationStructureMemoryRequirementsInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureMemoryRequirementsInfoNV>::copy(const VkAccelerationStructureMemoryRequirementsInfoNV& src, VkAccelerationStructureMemoryRequirementsInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureMotionInfoNV>::size(const VkAccelerationStructureMotionInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureMotionInfoNV>::copy(const VkAccelerationStructureMotionInfoNV& src, VkAccelerationStructureMotionInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkAccelerationStructureTrianglesDisplacementMicromapNV>::size(const VkAccelerationStructureTrianglesDisplacementMicromapNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pUsageCounts, src.usageCountsCount, offset);
+    DeepCopyPointerArraySize(src.ppUsageCounts, src.usageCountsCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureTrianglesDisplacementMicromapNV>::copy(const VkAccelerationStructureTrianglesDisplacementMicromapNV& src, VkAccelerationStructureTrianglesDisplacementMicromapNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pUsageCounts = DeepCopyArray(src.pUsageCounts, src.usageCountsCount, cursor);
+    dst.ppUsageCounts = DeepCopyPointerArray(src.ppUsageCounts, src.usageCountsCount, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkAccelerationStructureTrianglesOpacityMicromapEXT>::size(const VkAccelerationStructureTrianglesOpacityMicromapEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pUsageCounts, src.usageCountsCount, offset);
+    DeepCopyPointerArraySize(src.ppUsageCounts, src.usageCountsCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureTrianglesOpacityMicromapEXT>::copy(const VkAccelerationStructureTrianglesOpacityMicromapEXT& src, VkAccelerationStructureTrianglesOpacityMicromapEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pUsageCounts = DeepCopyArray(src.pUsageCounts, src.usageCountsCount, cursor);
+    dst.ppUsageCounts = DeepCopyPointerArray(src.ppUsageCounts, src.usageCountsCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureVersionInfoKHR>::size(const VkAccelerationStructureVersionInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pVersionData, 2 * VK_UUID_SIZE, offset);
+  }
+
+  inline void DeepCopyTraits<VkAccelerationStructureVersionInfoKHR>::copy(const VkAccelerationStructureVersionInfoKHR& src, VkAccelerationStructureVersionInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pVersionData = DeepCopyArray(src.pVersionData, 2 * VK_UUID_SIZE, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAcquireNextImageInfoKHR>::size(const VkAcquireNextImageInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAcquireNextImageInfoKHR>::copy(const VkAcquireNextImageInfoKHR& src, VkAcquireNextImageInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAcquireProfilingLockInfoKHR>::size(const VkAcquireProfilingLockInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAcquireProfilingLockInfoKHR>::copy(const VkAcquireProfilingLockInfoKHR& src, VkAcquireProfilingLockInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAmigoProfilingSubmitInfoSEC>::size(const VkAmigoProfilingSubmitInfoSEC& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAmigoProfilingSubmitInfoSEC>::copy(const VkAmigoProfilingSubmitInfoSEC& src, VkAmigoProfilingSubmitInfoSEC& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkAndroidHardwareBufferFormatProperties2ANDROID>::size(const VkAndroidHardwareBufferFormatProperties2ANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAndroidHardwareBufferFormatProperties2ANDROID>::copy(const VkAndroidHardwareBufferFormatProperties2ANDROID& src, VkAndroidHardwareBufferFormatProperties2ANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkAndroidHardwareBufferFormatPropertiesANDROID>::size(const VkAndroidHardwareBufferFormatPropertiesANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAndroidHardwareBufferFormatPropertiesANDROID>::copy(const VkAndroidHardwareBufferFormatPropertiesANDROID& src, VkAndroidHardwareBufferFormatPropertiesANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkAndroidHardwareBufferPropertiesANDROID>::size(const VkAndroidHardwareBufferPropertiesANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAndroidHardwareBufferPropertiesANDROID>::copy(const VkAndroidHardwareBufferPropertiesANDROID& src, VkAndroidHardwareBufferPropertiesANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkAndroidHardwareBufferUsageANDROID>::size(const VkAndroidHardwareBufferUsageANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAndroidHardwareBufferUsageANDROID>::copy(const VkAndroidHardwareBufferUsageANDROID& src, VkAndroidHardwareBufferUsageANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkAndroidSurfaceCreateInfoKHR>::size(const VkAndroidSurfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAndroidSurfaceCreateInfoKHR>::copy(const VkAndroidSurfaceCreateInfoKHR& src, VkAndroidSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkApplicationInfo>::size(const VkApplicationInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pApplicationName, offset);
+    DeepCopyStringSize(src.pEngineName, offset);
+  }
+
+  inline void DeepCopyTraits<VkApplicationInfo>::copy(const VkApplicationInfo& src, VkApplicationInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pApplicationName = DeepCopyString(src.pApplicationName, cursor);
+    dst.pEngineName = DeepCopyString(src.pEngineName, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentDescription2>::size(const VkAttachmentDescription2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentDescription2>::copy(const VkAttachmentDescription2& src, VkAttachmentDescription2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentDescriptionStencilLayout>::size(const VkAttachmentDescriptionStencilLayout& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentDescriptionStencilLayout>::copy(const VkAttachmentDescriptionStencilLayout& src, VkAttachmentDescriptionStencilLayout& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentReference2>::size(const VkAttachmentReference2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentReference2>::copy(const VkAttachmentReference2& src, VkAttachmentReference2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentReferenceStencilLayout>::size(const VkAttachmentReferenceStencilLayout& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentReferenceStencilLayout>::copy(const VkAttachmentReferenceStencilLayout& src, VkAttachmentReferenceStencilLayout& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentSampleCountInfoAMD>::size(const VkAttachmentSampleCountInfoAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pColorAttachmentSamples, src.colorAttachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentSampleCountInfoAMD>::copy(const VkAttachmentSampleCountInfoAMD& src, VkAttachmentSampleCountInfoAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pColorAttachmentSamples = DeepCopyArray(src.pColorAttachmentSamples, src.colorAttachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindAccelerationStructureMemoryInfoNV>::size(const VkBindAccelerationStructureMemoryInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDeviceIndices, src.deviceIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindAccelerationStructureMemoryInfoNV>::copy(const VkBindAccelerationStructureMemoryInfoNV& src, VkBindAccelerationStructureMemoryInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDeviceIndices = DeepCopyArray(src.pDeviceIndices, src.deviceIndexCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindBufferMemoryDeviceGroupInfo>::size(const VkBindBufferMemoryDeviceGroupInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDeviceIndices, src.deviceIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindBufferMemoryDeviceGroupInfo>::copy(const VkBindBufferMemoryDeviceGroupInfo& src, VkBindBufferMemoryDeviceGroupInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDeviceIndices = DeepCopyArray(src.pDeviceIndices, src.deviceIndexCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindBufferMemoryInfo>::size(const VkBindBufferMemoryInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindBufferMemoryInfo>::copy(const VkBindBufferMemoryInfo& src, VkBindBufferMemoryInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindImageMemoryDeviceGroupInfo>::size(const VkBindImageMemoryDeviceGroupInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDeviceIndices, src.deviceIndexCount, offset);
+    DeepCopyArraySize(src.pSplitInstanceBindRegions, src.splitInstanceBindRegionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindImageMemoryDeviceGroupInfo>::copy(const VkBindImageMemoryDeviceGroupInfo& src, VkBindImageMemoryDeviceGroupInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDeviceIndices = DeepCopyArray(src.pDeviceIndices, src.deviceIndexCount, cursor);
+    dst.pSplitInstanceBindRegions = DeepCopyArray(src.pSplitInstanceBindRegions, src.splitInstanceBindRegionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindImageMemoryInfo>::size(const VkBindImageMemoryInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindImageMemoryInfo>::copy(const VkBindImageMemoryInfo& src, VkBindImageMemoryInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindImageMemorySwapchainInfoKHR>::size(const VkBindImageMemorySwapchainInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindImageMemorySwapchainInfoKHR>::copy(const VkBindImageMemorySwapchainInfoKHR& src, VkBindImageMemorySwapchainInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindImagePlaneMemoryInfo>::size(const VkBindImagePlaneMemoryInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindImagePlaneMemoryInfo>::copy(const VkBindImagePlaneMemoryInfo& src, VkBindImagePlaneMemoryInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSparseBufferMemoryBindInfo>::size(const VkSparseBufferMemoryBindInfo& src, size_t& offset) {
+    DeepCopyArraySize(src.pBinds, src.bindCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSparseBufferMemoryBindInfo>::copy(const VkSparseBufferMemoryBindInfo& src, VkSparseBufferMemoryBindInfo& dst, DeepCopyCursor& cursor) {
+    dst.pBinds = DeepCopyArray(src.pBinds, src.bindCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageOpaqueMemoryBindInfo>::size(const VkSparseImageOpaqueMemoryBindInfo& src, size_t& offset) {
+    DeepCopyArraySize(src.pBinds, src.bindCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageOpaqueMemoryBindInfo>::copy(const VkSparseImageOpaqueMemoryBindInfo& src, VkSparseImageOpaqueMemoryBindInfo& dst, DeepCopyCursor& cursor) {
+    dst.pBinds = DeepCopyArray(src.pBinds, src.bindCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageMemoryBindInfo>::size(const VkSparseImageMemoryBindInfo& src, size_t& offset) {
+    DeepCopyArraySize(src.pBinds, src.bindCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageMemoryBindInfo>::copy(const VkSparseImageMemoryBindInfo& src, VkSparseImageMemoryBindInfo& dst, DeepCopyCursor& cursor) {
+    dst.pBinds = DeepCopyArray(src.pBinds, src.bindCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindSparseInfo>::size(const VkBindSparseInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphores, src.waitSemaphoreCount, offset);
+    DeepCopyArraySize(src.pBufferBinds, src.bufferBindCount, offset);
+    DeepCopyArraySize(src.pImageOpaqueBinds, src.imageOpaqueBindCount, offset);
+    DeepCopyArraySize(src.pImageBinds, src.imageBindCount, offset);
+    DeepCopyArraySize(src.pSignalSemaphores, src.signalSemaphoreCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindSparseInfo>::copy(const VkBindSparseInfo& src, VkBindSparseInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphores = DeepCopyArray(src.pWaitSemaphores, src.waitSemaphoreCount, cursor);
+    dst.pBufferBinds = DeepCopyArray(src.pBufferBinds, src.bufferBindCount, cursor);
+    dst.pImageOpaqueBinds = DeepCopyArray(src.pImageOpaqueBinds, src.imageOpaqueBindCount, cursor);
+    dst.pImageBinds = DeepCopyArray(src.pImageBinds, src.imageBindCount, cursor);
+    dst.pSignalSemaphores = DeepCopyArray(src.pSignalSemaphores, src.signalSemaphoreCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBindVideoSessionMemoryInfoKHR>::size(const VkBindVideoSessionMemoryInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBindVideoSessionMemoryInfoKHR>::copy(const VkBindVideoSessionMemoryInfoKHR& src, VkBindVideoSessionMemoryInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBlitImageInfo2>::size(const VkBlitImageInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkBlitImageInfo2>::copy(const VkBlitImageInfo2& src, VkBlitImageInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferCaptureDescriptorDataInfoEXT>::size(const VkBufferCaptureDescriptorDataInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCaptureDescriptorDataInfoEXT>::copy(const VkBufferCaptureDescriptorDataInfoEXT& src, VkBufferCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkBufferCollectionBufferCreateInfoFUCHSIA>::size(const VkBufferCollectionBufferCreateInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCollectionBufferCreateInfoFUCHSIA>::copy(const VkBufferCollectionBufferCreateInfoFUCHSIA& src, VkBufferCollectionBufferCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::size(const VkBufferCollectionConstraintsInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::copy(const VkBufferCollectionConstraintsInfoFUCHSIA& src, VkBufferCollectionConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkBufferCollectionCreateInfoFUCHSIA>::size(const VkBufferCollectionCreateInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCollectionCreateInfoFUCHSIA>::copy(const VkBufferCollectionCreateInfoFUCHSIA& src, VkBufferCollectionCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkBufferCollectionImageCreateInfoFUCHSIA>::size(const VkBufferCollectionImageCreateInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCollectionImageCreateInfoFUCHSIA>::copy(const VkBufferCollectionImageCreateInfoFUCHSIA& src, VkBufferCollectionImageCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkBufferCollectionPropertiesFUCHSIA>::size(const VkBufferCollectionPropertiesFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkSysmemColorSpaceFUCHSIA>::size(src.sysmemColorSpaceIndex, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCollectionPropertiesFUCHSIA>::copy(const VkBufferCollectionPropertiesFUCHSIA& src, VkBufferCollectionPropertiesFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkSysmemColorSpaceFUCHSIA>::copy(src.sysmemColorSpaceIndex, dst.sysmemColorSpaceIndex, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkBufferConstraintsInfoFUCHSIA>::size(const VkBufferConstraintsInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkBufferCreateInfo>::size(src.createInfo, offset);
+    DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::size(src.bufferCollectionConstraints, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferConstraintsInfoFUCHSIA>::copy(const VkBufferConstraintsInfoFUCHSIA& src, VkBufferConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkBufferCreateInfo>::copy(src.createInfo, dst.createInfo, cursor);
+    DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::copy(src.bufferCollectionConstraints, dst.bufferCollectionConstraints, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkBufferCopy2>::size(const VkBufferCopy2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCopy2>::copy(const VkBufferCopy2& src, VkBufferCopy2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferCreateInfo>::size(const VkBufferCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (src.sharingMode == VK_SHARING_MODE_CONCURRENT)
+      DeepCopyArraySize(src.pQueueFamilyIndices, src.queueFamilyIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferCreateInfo>::copy(const VkBufferCreateInfo& src, VkBufferCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pQueueFamilyIndices = src.sharingMode == VK_SHARING_MODE_CONCURRENT ? DeepCopyArray(src.pQueueFamilyIndices, src.queueFamilyIndexCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkBufferDeviceAddressCreateInfoEXT>::size(const VkBufferDeviceAddressCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferDeviceAddressCreateInfoEXT>::copy(const VkBufferDeviceAddressCreateInfoEXT& src, VkBufferDeviceAddressCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferDeviceAddressInfo>::size(const VkBufferDeviceAddressInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferDeviceAddressInfo>::copy(const VkBufferDeviceAddressInfo& src, VkBufferDeviceAddressInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferImageCopy2>::size(const VkBufferImageCopy2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferImageCopy2>::copy(const VkBufferImageCopy2& src, VkBufferImageCopy2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferMemoryBarrier>::size(const VkBufferMemoryBarrier& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferMemoryBarrier>::copy(const VkBufferMemoryBarrier& src, VkBufferMemoryBarrier& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferMemoryBarrier2>::size(const VkBufferMemoryBarrier2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferMemoryBarrier2>::copy(const VkBufferMemoryBarrier2& src, VkBufferMemoryBarrier2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferMemoryRequirementsInfo2>::size(const VkBufferMemoryRequirementsInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferMemoryRequirementsInfo2>::copy(const VkBufferMemoryRequirementsInfo2& src, VkBufferMemoryRequirementsInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferOpaqueCaptureAddressCreateInfo>::size(const VkBufferOpaqueCaptureAddressCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferOpaqueCaptureAddressCreateInfo>::copy(const VkBufferOpaqueCaptureAddressCreateInfo& src, VkBufferOpaqueCaptureAddressCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkBufferViewCreateInfo>::size(const VkBufferViewCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkBufferViewCreateInfo>::copy(const VkBufferViewCreateInfo& src, VkBufferViewCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCalibratedTimestampInfoEXT>::size(const VkCalibratedTimestampInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCalibratedTimestampInfoEXT>::copy(const VkCalibratedTimestampInfoEXT& src, VkCalibratedTimestampInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCheckpointData2NV>::size(const VkCheckpointData2NV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCheckpointData2NV>::copy(const VkCheckpointData2NV& src, VkCheckpointData2NV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCheckpointDataNV>::size(const VkCheckpointDataNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCheckpointDataNV>::copy(const VkCheckpointDataNV& src, VkCheckpointDataNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferAllocateInfo>::size(const VkCommandBufferAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferAllocateInfo>::copy(const VkCommandBufferAllocateInfo& src, VkCommandBufferAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceConditionalRenderingInfoEXT>::size(const VkCommandBufferInheritanceConditionalRenderingInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceConditionalRenderingInfoEXT>::copy(const VkCommandBufferInheritanceConditionalRenderingInfoEXT& src, VkCommandBufferInheritanceConditionalRenderingInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceInfo>::size(const VkCommandBufferInheritanceInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceInfo>::copy(const VkCommandBufferInheritanceInfo& src, VkCommandBufferInheritanceInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceRenderPassTransformInfoQCOM>::size(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceRenderPassTransformInfoQCOM>::copy(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& src, VkCommandBufferInheritanceRenderPassTransformInfoQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceRenderingInfo>::size(const VkCommandBufferInheritanceRenderingInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pColorAttachmentFormats, src.colorAttachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceRenderingInfo>::copy(const VkCommandBufferInheritanceRenderingInfo& src, VkCommandBufferInheritanceRenderingInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pColorAttachmentFormats = DeepCopyArray(src.pColorAttachmentFormats, src.colorAttachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceViewportScissorInfoNV>::size(const VkCommandBufferInheritanceViewportScissorInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (src.viewportScissor2D)
+      DeepCopyArraySize(src.pViewportDepths, src.viewportDepthCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferInheritanceViewportScissorInfoNV>::copy(const VkCommandBufferInheritanceViewportScissorInfoNV& src, VkCommandBufferInheritanceViewportScissorInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewportDepths = src.viewportScissor2D ? DeepCopyArray(src.pViewportDepths, src.viewportDepthCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferSubmitInfo>::size(const VkCommandBufferSubmitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandBufferSubmitInfo>::copy(const VkCommandBufferSubmitInfo& src, VkCommandBufferSubmitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCommandPoolCreateInfo>::size(const VkCommandPoolCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCommandPoolCreateInfo>::copy(const VkCommandPoolCreateInfo& src, VkCommandPoolCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkComputePipelineCreateInfo>::size(const VkComputePipelineCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkPipelineShaderStageCreateInfo>::size(src.stage, offset);
+  }
+
+  inline void DeepCopyTraits<VkComputePipelineCreateInfo>::copy(const VkComputePipelineCreateInfo& src, VkComputePipelineCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkPipelineShaderStageCreateInfo>::copy(src.stage, dst.stage, cursor);
+  }
+
+  inline void DeepCopyTraits<VkConditionalRenderingBeginInfoEXT>::size(const VkConditionalRenderingBeginInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkConditionalRenderingBeginInfoEXT>::copy(const VkConditionalRenderingBeginInfoEXT& src, VkConditionalRenderingBeginInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCooperativeMatrixPropertiesNV>::size(const VkCooperativeMatrixPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCooperativeMatrixPropertiesNV>::copy(const VkCooperativeMatrixPropertiesNV& src, VkCooperativeMatrixPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyAccelerationStructureInfoKHR>::size(const VkCopyAccelerationStructureInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyAccelerationStructureInfoKHR>::copy(const VkCopyAccelerationStructureInfoKHR& src, VkCopyAccelerationStructureInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyAccelerationStructureToMemoryInfoKHR>::size(const VkCopyAccelerationStructureToMemoryInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyAccelerationStructureToMemoryInfoKHR>::copy(const VkCopyAccelerationStructureToMemoryInfoKHR& src, VkCopyAccelerationStructureToMemoryInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyBufferInfo2>::size(const VkCopyBufferInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyBufferInfo2>::copy(const VkCopyBufferInfo2& src, VkCopyBufferInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyBufferToImageInfo2>::size(const VkCopyBufferToImageInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyBufferToImageInfo2>::copy(const VkCopyBufferToImageInfo2& src, VkCopyBufferToImageInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyCommandTransformInfoQCOM>::size(const VkCopyCommandTransformInfoQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyCommandTransformInfoQCOM>::copy(const VkCopyCommandTransformInfoQCOM& src, VkCopyCommandTransformInfoQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyDescriptorSet>::size(const VkCopyDescriptorSet& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyDescriptorSet>::copy(const VkCopyDescriptorSet& src, VkCopyDescriptorSet& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyImageInfo2>::size(const VkCopyImageInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyImageInfo2>::copy(const VkCopyImageInfo2& src, VkCopyImageInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyImageToBufferInfo2>::size(const VkCopyImageToBufferInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyImageToBufferInfo2>::copy(const VkCopyImageToBufferInfo2& src, VkCopyImageToBufferInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyMemoryToAccelerationStructureInfoKHR>::size(const VkCopyMemoryToAccelerationStructureInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyMemoryToAccelerationStructureInfoKHR>::copy(const VkCopyMemoryToAccelerationStructureInfoKHR& src, VkCopyMemoryToAccelerationStructureInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyMemoryToMicromapInfoEXT>::size(const VkCopyMemoryToMicromapInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyMemoryToMicromapInfoEXT>::copy(const VkCopyMemoryToMicromapInfoEXT& src, VkCopyMemoryToMicromapInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyMicromapInfoEXT>::size(const VkCopyMicromapInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyMicromapInfoEXT>::copy(const VkCopyMicromapInfoEXT& src, VkCopyMicromapInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCopyMicromapToMemoryInfoEXT>::size(const VkCopyMicromapToMemoryInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkCopyMicromapToMemoryInfoEXT>::copy(const VkCopyMicromapToMemoryInfoEXT& src, VkCopyMicromapToMemoryInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkD3D12FenceSubmitInfoKHR>::size(const VkD3D12FenceSubmitInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphoreValues, src.waitSemaphoreValuesCount, offset);
+    DeepCopyArraySize(src.pSignalSemaphoreValues, src.signalSemaphoreValuesCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkD3D12FenceSubmitInfoKHR>::copy(const VkD3D12FenceSubmitInfoKHR& src, VkD3D12FenceSubmitInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphoreValues = DeepCopyArray(src.pWaitSemaphoreValues, src.waitSemaphoreValuesCount, cursor);
+    dst.pSignalSemaphoreValues = DeepCopyArray(src.pSignalSemaphoreValues, src.signalSemaphoreValuesCount, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkDebugMarkerMarkerInfoEXT>::size(const VkDebugMarkerMarkerInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pMarkerName, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugMarkerMarkerInfoEXT>::copy(const VkDebugMarkerMarkerInfoEXT& src, VkDebugMarkerMarkerInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pMarkerName = DeepCopyString(src.pMarkerName, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugMarkerObjectNameInfoEXT>::size(const VkDebugMarkerObjectNameInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pObjectName, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugMarkerObjectNameInfoEXT>::copy(const VkDebugMarkerObjectNameInfoEXT& src, VkDebugMarkerObjectNameInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pObjectName = DeepCopyString(src.pObjectName, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugMarkerObjectTagInfoEXT>::size(const VkDebugMarkerObjectTagInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pTag, src.tagSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugMarkerObjectTagInfoEXT>::copy(const VkDebugMarkerObjectTagInfoEXT& src, VkDebugMarkerObjectTagInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pTag = DeepCopyBytes(src.pTag, src.tagSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugReportCallbackCreateInfoEXT>::size(const VkDebugReportCallbackCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugReportCallbackCreateInfoEXT>::copy(const VkDebugReportCallbackCreateInfoEXT& src, VkDebugReportCallbackCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsLabelEXT>::size(const VkDebugUtilsLabelEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pLabelName, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsLabelEXT>::copy(const VkDebugUtilsLabelEXT& src, VkDebugUtilsLabelEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pLabelName = DeepCopyString(src.pLabelName, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsMessengerCallbackDataEXT>::size(const VkDebugUtilsMessengerCallbackDataEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pMessageIdName, offset);
+    DeepCopyStringSize(src.pMessage, offset);
+    DeepCopyArraySize(src.pQueueLabels, src.queueLabelCount, offset);
+    DeepCopyArraySize(src.pCmdBufLabels, src.cmdBufLabelCount, offset);
+    DeepCopyArraySize(src.pObjects, src.objectCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsMessengerCallbackDataEXT>::copy(const VkDebugUtilsMessengerCallbackDataEXT& src, VkDebugUtilsMessengerCallbackDataEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pMessageIdName = DeepCopyString(src.pMessageIdName, cursor);
+    dst.pMessage = DeepCopyString(src.pMessage, cursor);
+    dst.pQueueLabels = DeepCopyArray(src.pQueueLabels, src.queueLabelCount, cursor);
+    dst.pCmdBufLabels = DeepCopyArray(src.pCmdBufLabels, src.cmdBufLabelCount, cursor);
+    dst.pObjects = DeepCopyArray(src.pObjects, src.objectCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsMessengerCreateInfoEXT>::size(const VkDebugUtilsMessengerCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsMessengerCreateInfoEXT>::copy(const VkDebugUtilsMessengerCreateInfoEXT& src, VkDebugUtilsMessengerCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsObjectNameInfoEXT>::size(const VkDebugUtilsObjectNameInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pObjectName, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsObjectNameInfoEXT>::copy(const VkDebugUtilsObjectNameInfoEXT& src, VkDebugUtilsObjectNameInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pObjectName = DeepCopyString(src.pObjectName, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsObjectTagInfoEXT>::size(const VkDebugUtilsObjectTagInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pTag, src.tagSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkDebugUtilsObjectTagInfoEXT>::copy(const VkDebugUtilsObjectTagInfoEXT& src, VkDebugUtilsObjectTagInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pTag = DeepCopyBytes(src.pTag, src.tagSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDedicatedAllocationBufferCreateInfoNV>::size(const VkDedicatedAllocationBufferCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDedicatedAllocationBufferCreateInfoNV>::copy(const VkDedicatedAllocationBufferCreateInfoNV& src, VkDedicatedAllocationBufferCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDedicatedAllocationImageCreateInfoNV>::size(const VkDedicatedAllocationImageCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDedicatedAllocationImageCreateInfoNV>::copy(const VkDedicatedAllocationImageCreateInfoNV& src, VkDedicatedAllocationImageCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDedicatedAllocationMemoryAllocateInfoNV>::size(const VkDedicatedAllocationMemoryAllocateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDedicatedAllocationMemoryAllocateInfoNV>::copy(const VkDedicatedAllocationMemoryAllocateInfoNV& src, VkDedicatedAllocationMemoryAllocateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDependencyInfo>::size(const VkDependencyInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pMemoryBarriers, src.memoryBarrierCount, offset);
+    DeepCopyArraySize(src.pBufferMemoryBarriers, src.bufferMemoryBarrierCount, offset);
+    DeepCopyArraySize(src.pImageMemoryBarriers, src.imageMemoryBarrierCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDependencyInfo>::copy(const VkDependencyInfo& src, VkDependencyInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pMemoryBarriers = DeepCopyArray(src.pMemoryBarriers, src.memoryBarrierCount, cursor);
+    dst.pBufferMemoryBarriers = DeepCopyArray(src.pBufferMemoryBarriers, src.bufferMemoryBarrierCount, cursor);
+    dst.pImageMemoryBarriers = DeepCopyArray(src.pImageMemoryBarriers, src.imageMemoryBarrierCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorAddressInfoEXT>::size(const VkDescriptorAddressInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorAddressInfoEXT>::copy(const VkDescriptorAddressInfoEXT& src, VkDescriptorAddressInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorBufferBindingInfoEXT>::size(const VkDescriptorBufferBindingInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorBufferBindingInfoEXT>::copy(const VkDescriptorBufferBindingInfoEXT& src, VkDescriptorBufferBindingInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorBufferBindingPushDescriptorBufferHandleEXT>::size(const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorBufferBindingPushDescriptorBufferHandleEXT>::copy(const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& src, VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorPoolCreateInfo>::size(const VkDescriptorPoolCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPoolSizes, src.poolSizeCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorPoolCreateInfo>::copy(const VkDescriptorPoolCreateInfo& src, VkDescriptorPoolCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPoolSizes = DeepCopyArray(src.pPoolSizes, src.poolSizeCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorPoolInlineUniformBlockCreateInfo>::size(const VkDescriptorPoolInlineUniformBlockCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorPoolInlineUniformBlockCreateInfo>::copy(const VkDescriptorPoolInlineUniformBlockCreateInfo& src, VkDescriptorPoolInlineUniformBlockCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetAllocateInfo>::size(const VkDescriptorSetAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSetLayouts, src.descriptorSetCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetAllocateInfo>::copy(const VkDescriptorSetAllocateInfo& src, VkDescriptorSetAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSetLayouts = DeepCopyArray(src.pSetLayouts, src.descriptorSetCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetBindingReferenceVALVE>::size(const VkDescriptorSetBindingReferenceVALVE& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetBindingReferenceVALVE>::copy(const VkDescriptorSetBindingReferenceVALVE& src, VkDescriptorSetBindingReferenceVALVE& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutBindingFlagsCreateInfo>::size(const VkDescriptorSetLayoutBindingFlagsCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pBindingFlags, src.bindingCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutBindingFlagsCreateInfo>::copy(const VkDescriptorSetLayoutBindingFlagsCreateInfo& src, VkDescriptorSetLayoutBindingFlagsCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pBindingFlags = DeepCopyArray(src.pBindingFlags, src.bindingCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutBinding>::size(const VkDescriptorSetLayoutBinding& src, size_t& offset) {
+    if (DescriptorTypeUsesImmutableSamplers(src.descriptorType))
+      DeepCopyArraySize(src.pImmutableSamplers, src.descriptorCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutBinding>::copy(const VkDescriptorSetLayoutBinding& src, VkDescriptorSetLayoutBinding& dst, DeepCopyCursor& cursor) {
+    dst.pImmutableSamplers = DescriptorTypeUsesImmutableSamplers(src.descriptorType) ? DeepCopyArray(src.pImmutableSamplers, src.descriptorCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutCreateInfo>::size(const VkDescriptorSetLayoutCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pBindings, src.bindingCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutCreateInfo>::copy(const VkDescriptorSetLayoutCreateInfo& src, VkDescriptorSetLayoutCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pBindings = DeepCopyArray(src.pBindings, src.bindingCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutHostMappingInfoVALVE>::size(const VkDescriptorSetLayoutHostMappingInfoVALVE& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutHostMappingInfoVALVE>::copy(const VkDescriptorSetLayoutHostMappingInfoVALVE& src, VkDescriptorSetLayoutHostMappingInfoVALVE& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutSupport>::size(const VkDescriptorSetLayoutSupport& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetLayoutSupport>::copy(const VkDescriptorSetLayoutSupport& src, VkDescriptorSetLayoutSupport& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetVariableDescriptorCountAllocateInfo>::size(const VkDescriptorSetVariableDescriptorCountAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDescriptorCounts, src.descriptorSetCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetVariableDescriptorCountAllocateInfo>::copy(const VkDescriptorSetVariableDescriptorCountAllocateInfo& src, VkDescriptorSetVariableDescriptorCountAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDescriptorCounts = DeepCopyArray(src.pDescriptorCounts, src.descriptorSetCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetVariableDescriptorCountLayoutSupport>::size(const VkDescriptorSetVariableDescriptorCountLayoutSupport& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorSetVariableDescriptorCountLayoutSupport>::copy(const VkDescriptorSetVariableDescriptorCountLayoutSupport& src, VkDescriptorSetVariableDescriptorCountLayoutSupport& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorUpdateTemplateCreateInfo>::size(const VkDescriptorUpdateTemplateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDescriptorUpdateEntries, src.descriptorUpdateEntryCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDescriptorUpdateTemplateCreateInfo>::copy(const VkDescriptorUpdateTemplateCreateInfo& src, VkDescriptorUpdateTemplateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDescriptorUpdateEntries = DeepCopyArray(src.pDescriptorUpdateEntries, src.descriptorUpdateEntryCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceAddressBindingCallbackDataEXT>::size(const VkDeviceAddressBindingCallbackDataEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceAddressBindingCallbackDataEXT>::copy(const VkDeviceAddressBindingCallbackDataEXT& src, VkDeviceAddressBindingCallbackDataEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceBufferMemoryRequirements>::size(const VkDeviceBufferMemoryRequirements& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pCreateInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceBufferMemoryRequirements>::copy(const VkDeviceBufferMemoryRequirements& src, VkDeviceBufferMemoryRequirements& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCreateInfo = DeepCopyArray(src.pCreateInfo, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceCreateInfo>::size(const VkDeviceCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pQueueCreateInfos, src.queueCreateInfoCount, offset);
+    DeepCopyStringArraySize(src.ppEnabledLayerNames, src.enabledLayerCount, offset);
+    DeepCopyStringArraySize(src.ppEnabledExtensionNames, src.enabledExtensionCount, offset);
+    DeepCopyArraySize(src.pEnabledFeatures, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceCreateInfo>::copy(const VkDeviceCreateInfo& src, VkDeviceCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pQueueCreateInfos = DeepCopyArray(src.pQueueCreateInfos, src.queueCreateInfoCount, cursor);
+    dst.ppEnabledLayerNames = DeepCopyStringArray(src.ppEnabledLayerNames, src.enabledLayerCount, cursor);
+    dst.ppEnabledExtensionNames = DeepCopyStringArray(src.ppEnabledExtensionNames, src.enabledExtensionCount, cursor);
+    dst.pEnabledFeatures = DeepCopyArray(src.pEnabledFeatures, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceDeviceMemoryReportCreateInfoEXT>::size(const VkDeviceDeviceMemoryReportCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceDeviceMemoryReportCreateInfoEXT>::copy(const VkDeviceDeviceMemoryReportCreateInfoEXT& src, VkDeviceDeviceMemoryReportCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceDiagnosticsConfigCreateInfoNV>::size(const VkDeviceDiagnosticsConfigCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceDiagnosticsConfigCreateInfoNV>::copy(const VkDeviceDiagnosticsConfigCreateInfoNV& src, VkDeviceDiagnosticsConfigCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceEventInfoEXT>::size(const VkDeviceEventInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceEventInfoEXT>::copy(const VkDeviceEventInfoEXT& src, VkDeviceEventInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceFaultCountsEXT>::size(const VkDeviceFaultCountsEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceFaultCountsEXT>::copy(const VkDeviceFaultCountsEXT& src, VkDeviceFaultCountsEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupBindSparseInfo>::size(const VkDeviceGroupBindSparseInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupBindSparseInfo>::copy(const VkDeviceGroupBindSparseInfo& src, VkDeviceGroupBindSparseInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupCommandBufferBeginInfo>::size(const VkDeviceGroupCommandBufferBeginInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupCommandBufferBeginInfo>::copy(const VkDeviceGroupCommandBufferBeginInfo& src, VkDeviceGroupCommandBufferBeginInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupDeviceCreateInfo>::size(const VkDeviceGroupDeviceCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPhysicalDevices, src.physicalDeviceCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupDeviceCreateInfo>::copy(const VkDeviceGroupDeviceCreateInfo& src, VkDeviceGroupDeviceCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPhysicalDevices = DeepCopyArray(src.pPhysicalDevices, src.physicalDeviceCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupPresentCapabilitiesKHR>::size(const VkDeviceGroupPresentCapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupPresentCapabilitiesKHR>::copy(const VkDeviceGroupPresentCapabilitiesKHR& src, VkDeviceGroupPresentCapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupPresentInfoKHR>::size(const VkDeviceGroupPresentInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDeviceMasks, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupPresentInfoKHR>::copy(const VkDeviceGroupPresentInfoKHR& src, VkDeviceGroupPresentInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDeviceMasks = DeepCopyArray(src.pDeviceMasks, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupRenderPassBeginInfo>::size(const VkDeviceGroupRenderPassBeginInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDeviceRenderAreas, src.deviceRenderAreaCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupRenderPassBeginInfo>::copy(const VkDeviceGroupRenderPassBeginInfo& src, VkDeviceGroupRenderPassBeginInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDeviceRenderAreas = DeepCopyArray(src.pDeviceRenderAreas, src.deviceRenderAreaCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupSubmitInfo>::size(const VkDeviceGroupSubmitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphoreDeviceIndices, src.waitSemaphoreCount, offset);
+    DeepCopyArraySize(src.pCommandBufferDeviceMasks, src.commandBufferCount, offset);
+    DeepCopyArraySize(src.pSignalSemaphoreDeviceIndices, src.signalSemaphoreCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupSubmitInfo>::copy(const VkDeviceGroupSubmitInfo& src, VkDeviceGroupSubmitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphoreDeviceIndices = DeepCopyArray(src.pWaitSemaphoreDeviceIndices, src.waitSemaphoreCount, cursor);
+    dst.pCommandBufferDeviceMasks = DeepCopyArray(src.pCommandBufferDeviceMasks, src.commandBufferCount, cursor);
+    dst.pSignalSemaphoreDeviceIndices = DeepCopyArray(src.pSignalSemaphoreDeviceIndices, src.signalSemaphoreCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupSwapchainCreateInfoKHR>::size(const VkDeviceGroupSwapchainCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceGroupSwapchainCreateInfoKHR>::copy(const VkDeviceGroupSwapchainCreateInfoKHR& src, VkDeviceGroupSwapchainCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceImageMemoryRequirements>::size(const VkDeviceImageMemoryRequirements& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pCreateInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceImageMemoryRequirements>::copy(const VkDeviceImageMemoryRequirements& src, VkDeviceImageMemoryRequirements& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCreateInfo = DeepCopyArray(src.pCreateInfo, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceMemoryOpaqueCaptureAddressInfo>::size(const VkDeviceMemoryOpaqueCaptureAddressInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceMemoryOpaqueCaptureAddressInfo>::copy(const VkDeviceMemoryOpaqueCaptureAddressInfo& src, VkDeviceMemoryOpaqueCaptureAddressInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceMemoryOverallocationCreateInfoAMD>::size(const VkDeviceMemoryOverallocationCreateInfoAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceMemoryOverallocationCreateInfoAMD>::copy(const VkDeviceMemoryOverallocationCreateInfoAMD& src, VkDeviceMemoryOverallocationCreateInfoAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceMemoryReportCallbackDataEXT>::size(const VkDeviceMemoryReportCallbackDataEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceMemoryReportCallbackDataEXT>::copy(const VkDeviceMemoryReportCallbackDataEXT& src, VkDeviceMemoryReportCallbackDataEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDevicePrivateDataCreateInfo>::size(const VkDevicePrivateDataCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDevicePrivateDataCreateInfo>::copy(const VkDevicePrivateDataCreateInfo& src, VkDevicePrivateDataCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceQueueCreateInfo>::size(const VkDeviceQueueCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pQueuePriorities, src.queueCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceQueueCreateInfo>::copy(const VkDeviceQueueCreateInfo& src, VkDeviceQueueCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pQueuePriorities = DeepCopyArray(src.pQueuePriorities, src.queueCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceQueueGlobalPriorityCreateInfoKHR>::size(const VkDeviceQueueGlobalPriorityCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceQueueGlobalPriorityCreateInfoKHR>::copy(const VkDeviceQueueGlobalPriorityCreateInfoKHR& src, VkDeviceQueueGlobalPriorityCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDeviceQueueInfo2>::size(const VkDeviceQueueInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDeviceQueueInfo2>::copy(const VkDeviceQueueInfo2& src, VkDeviceQueueInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDirectDriverLoadingInfoLUNARG>::size(const VkDirectDriverLoadingInfoLUNARG& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDirectDriverLoadingInfoLUNARG>::copy(const VkDirectDriverLoadingInfoLUNARG& src, VkDirectDriverLoadingInfoLUNARG& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDirectDriverLoadingListLUNARG>::size(const VkDirectDriverLoadingListLUNARG& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDrivers, src.driverCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDirectDriverLoadingListLUNARG>::copy(const VkDirectDriverLoadingListLUNARG& src, VkDirectDriverLoadingListLUNARG& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDrivers = DeepCopyArray(src.pDrivers, src.driverCount, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+  inline void DeepCopyTraits<VkDirectFBSurfaceCreateInfoEXT>::size(const VkDirectFBSurfaceCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDirectFBSurfaceCreateInfoEXT>::copy(const VkDirectFBSurfaceCreateInfoEXT& src, VkDirectFBSurfaceCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkDisplayEventInfoEXT>::size(const VkDisplayEventInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayEventInfoEXT>::copy(const VkDisplayEventInfoEXT& src, VkDisplayEventInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayModeCreateInfoKHR>::size(const VkDisplayModeCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayModeCreateInfoKHR>::copy(const VkDisplayModeCreateInfoKHR& src, VkDisplayModeCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayModeProperties2KHR>::size(const VkDisplayModeProperties2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayModeProperties2KHR>::copy(const VkDisplayModeProperties2KHR& src, VkDisplayModeProperties2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayNativeHdrSurfaceCapabilitiesAMD>::size(const VkDisplayNativeHdrSurfaceCapabilitiesAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayNativeHdrSurfaceCapabilitiesAMD>::copy(const VkDisplayNativeHdrSurfaceCapabilitiesAMD& src, VkDisplayNativeHdrSurfaceCapabilitiesAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPlaneCapabilities2KHR>::size(const VkDisplayPlaneCapabilities2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPlaneCapabilities2KHR>::copy(const VkDisplayPlaneCapabilities2KHR& src, VkDisplayPlaneCapabilities2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPlaneInfo2KHR>::size(const VkDisplayPlaneInfo2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPlaneInfo2KHR>::copy(const VkDisplayPlaneInfo2KHR& src, VkDisplayPlaneInfo2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPlaneProperties2KHR>::size(const VkDisplayPlaneProperties2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPlaneProperties2KHR>::copy(const VkDisplayPlaneProperties2KHR& src, VkDisplayPlaneProperties2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPowerInfoEXT>::size(const VkDisplayPowerInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPowerInfoEXT>::copy(const VkDisplayPowerInfoEXT& src, VkDisplayPowerInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPresentInfoKHR>::size(const VkDisplayPresentInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPresentInfoKHR>::copy(const VkDisplayPresentInfoKHR& src, VkDisplayPresentInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPropertiesKHR>::size(const VkDisplayPropertiesKHR& src, size_t& offset) {
+    DeepCopyStringSize(src.displayName, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayPropertiesKHR>::copy(const VkDisplayPropertiesKHR& src, VkDisplayPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.displayName = DeepCopyString(src.displayName, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplayProperties2KHR>::size(const VkDisplayProperties2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkDisplayPropertiesKHR>::size(src.displayProperties, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplayProperties2KHR>::copy(const VkDisplayProperties2KHR& src, VkDisplayProperties2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkDisplayPropertiesKHR>::copy(src.displayProperties, dst.displayProperties, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDisplaySurfaceCreateInfoKHR>::size(const VkDisplaySurfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkDisplaySurfaceCreateInfoKHR>::copy(const VkDisplaySurfaceCreateInfoKHR& src, VkDisplaySurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDrmFormatModifierPropertiesList2EXT>::size(const VkDrmFormatModifierPropertiesList2EXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDrmFormatModifierProperties, src.drmFormatModifierCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDrmFormatModifierPropertiesList2EXT>::copy(const VkDrmFormatModifierPropertiesList2EXT& src, VkDrmFormatModifierPropertiesList2EXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDrmFormatModifierProperties = DeepCopyArray(src.pDrmFormatModifierProperties, src.drmFormatModifierCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkDrmFormatModifierPropertiesListEXT>::size(const VkDrmFormatModifierPropertiesListEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDrmFormatModifierProperties, src.drmFormatModifierCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkDrmFormatModifierPropertiesListEXT>::copy(const VkDrmFormatModifierPropertiesListEXT& src, VkDrmFormatModifierPropertiesListEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDrmFormatModifierProperties = DeepCopyArray(src.pDrmFormatModifierProperties, src.drmFormatModifierCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkEventCreateInfo>::size(const VkEventCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkEventCreateInfo>::copy(const VkEventCreateInfo& src, VkEventCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExportFenceCreateInfo>::size(const VkExportFenceCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportFenceCreateInfo>::copy(const VkExportFenceCreateInfo& src, VkExportFenceCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkExportFenceWin32HandleInfoKHR>::size(const VkExportFenceWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportFenceWin32HandleInfoKHR>::copy(const VkExportFenceWin32HandleInfoKHR& src, VkExportFenceWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkExportMemoryAllocateInfo>::size(const VkExportMemoryAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMemoryAllocateInfo>::copy(const VkExportMemoryAllocateInfo& src, VkExportMemoryAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExportMemoryAllocateInfoNV>::size(const VkExportMemoryAllocateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMemoryAllocateInfoNV>::copy(const VkExportMemoryAllocateInfoNV& src, VkExportMemoryAllocateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkExportMemoryWin32HandleInfoKHR>::size(const VkExportMemoryWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMemoryWin32HandleInfoKHR>::copy(const VkExportMemoryWin32HandleInfoKHR& src, VkExportMemoryWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkExportMemoryWin32HandleInfoNV>::size(const VkExportMemoryWin32HandleInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMemoryWin32HandleInfoNV>::copy(const VkExportMemoryWin32HandleInfoNV& src, VkExportMemoryWin32HandleInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalBufferInfoEXT>::size(const VkExportMetalBufferInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalBufferInfoEXT>::copy(const VkExportMetalBufferInfoEXT& src, VkExportMetalBufferInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalCommandQueueInfoEXT>::size(const VkExportMetalCommandQueueInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalCommandQueueInfoEXT>::copy(const VkExportMetalCommandQueueInfoEXT& src, VkExportMetalCommandQueueInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalDeviceInfoEXT>::size(const VkExportMetalDeviceInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalDeviceInfoEXT>::copy(const VkExportMetalDeviceInfoEXT& src, VkExportMetalDeviceInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalIOSurfaceInfoEXT>::size(const VkExportMetalIOSurfaceInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalIOSurfaceInfoEXT>::copy(const VkExportMetalIOSurfaceInfoEXT& src, VkExportMetalIOSurfaceInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalObjectCreateInfoEXT>::size(const VkExportMetalObjectCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalObjectCreateInfoEXT>::copy(const VkExportMetalObjectCreateInfoEXT& src, VkExportMetalObjectCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalObjectsInfoEXT>::size(const VkExportMetalObjectsInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalObjectsInfoEXT>::copy(const VkExportMetalObjectsInfoEXT& src, VkExportMetalObjectsInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalSharedEventInfoEXT>::size(const VkExportMetalSharedEventInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalSharedEventInfoEXT>::copy(const VkExportMetalSharedEventInfoEXT& src, VkExportMetalSharedEventInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkExportMetalTextureInfoEXT>::size(const VkExportMetalTextureInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportMetalTextureInfoEXT>::copy(const VkExportMetalTextureInfoEXT& src, VkExportMetalTextureInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkExportSemaphoreCreateInfo>::size(const VkExportSemaphoreCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportSemaphoreCreateInfo>::copy(const VkExportSemaphoreCreateInfo& src, VkExportSemaphoreCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkExportSemaphoreWin32HandleInfoKHR>::size(const VkExportSemaphoreWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExportSemaphoreWin32HandleInfoKHR>::copy(const VkExportSemaphoreWin32HandleInfoKHR& src, VkExportSemaphoreWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkExternalBufferProperties>::size(const VkExternalBufferProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalBufferProperties>::copy(const VkExternalBufferProperties& src, VkExternalBufferProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExternalFenceProperties>::size(const VkExternalFenceProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalFenceProperties>::copy(const VkExternalFenceProperties& src, VkExternalFenceProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkExternalFormatANDROID>::size(const VkExternalFormatANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalFormatANDROID>::copy(const VkExternalFormatANDROID& src, VkExternalFormatANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkExternalImageFormatProperties>::size(const VkExternalImageFormatProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalImageFormatProperties>::copy(const VkExternalImageFormatProperties& src, VkExternalImageFormatProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryAcquireUnmodifiedEXT>::size(const VkExternalMemoryAcquireUnmodifiedEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryAcquireUnmodifiedEXT>::copy(const VkExternalMemoryAcquireUnmodifiedEXT& src, VkExternalMemoryAcquireUnmodifiedEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryBufferCreateInfo>::size(const VkExternalMemoryBufferCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryBufferCreateInfo>::copy(const VkExternalMemoryBufferCreateInfo& src, VkExternalMemoryBufferCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryImageCreateInfo>::size(const VkExternalMemoryImageCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryImageCreateInfo>::copy(const VkExternalMemoryImageCreateInfo& src, VkExternalMemoryImageCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryImageCreateInfoNV>::size(const VkExternalMemoryImageCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalMemoryImageCreateInfoNV>::copy(const VkExternalMemoryImageCreateInfoNV& src, VkExternalMemoryImageCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkExternalSemaphoreProperties>::size(const VkExternalSemaphoreProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkExternalSemaphoreProperties>::copy(const VkExternalSemaphoreProperties& src, VkExternalSemaphoreProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFenceCreateInfo>::size(const VkFenceCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFenceCreateInfo>::copy(const VkFenceCreateInfo& src, VkFenceCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFenceGetFdInfoKHR>::size(const VkFenceGetFdInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFenceGetFdInfoKHR>::copy(const VkFenceGetFdInfoKHR& src, VkFenceGetFdInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkFenceGetWin32HandleInfoKHR>::size(const VkFenceGetWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFenceGetWin32HandleInfoKHR>::copy(const VkFenceGetWin32HandleInfoKHR& src, VkFenceGetWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkFilterCubicImageViewImageFormatPropertiesEXT>::size(const VkFilterCubicImageViewImageFormatPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFilterCubicImageViewImageFormatPropertiesEXT>::copy(const VkFilterCubicImageViewImageFormatPropertiesEXT& src, VkFilterCubicImageViewImageFormatPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFormatProperties2>::size(const VkFormatProperties2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFormatProperties2>::copy(const VkFormatProperties2& src, VkFormatProperties2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFormatProperties3>::size(const VkFormatProperties3& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFormatProperties3>::copy(const VkFormatProperties3& src, VkFormatProperties3& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFragmentShadingRateAttachmentInfoKHR>::size(const VkFragmentShadingRateAttachmentInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pFragmentShadingRateAttachment, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkFragmentShadingRateAttachmentInfoKHR>::copy(const VkFragmentShadingRateAttachmentInfoKHR& src, VkFragmentShadingRateAttachmentInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pFragmentShadingRateAttachment = DeepCopyArray(src.pFragmentShadingRateAttachment, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferAttachmentImageInfo>::size(const VkFramebufferAttachmentImageInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pViewFormats, src.viewFormatCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferAttachmentImageInfo>::copy(const VkFramebufferAttachmentImageInfo& src, VkFramebufferAttachmentImageInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewFormats = DeepCopyArray(src.pViewFormats, src.viewFormatCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferAttachmentsCreateInfo>::size(const VkFramebufferAttachmentsCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAttachmentImageInfos, src.attachmentImageInfoCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferAttachmentsCreateInfo>::copy(const VkFramebufferAttachmentsCreateInfo& src, VkFramebufferAttachmentsCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachmentImageInfos = DeepCopyArray(src.pAttachmentImageInfos, src.attachmentImageInfoCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferCreateInfo>::size(const VkFramebufferCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (!(src.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT))
+      DeepCopyArraySize(src.pAttachments, src.attachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferCreateInfo>::copy(const VkFramebufferCreateInfo& src, VkFramebufferCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachments = !(src.flags & VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT) ? DeepCopyArray(src.pAttachments, src.attachmentCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkFramebufferMixedSamplesCombinationNV>::size(const VkFramebufferMixedSamplesCombinationNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkFramebufferMixedSamplesCombinationNV>::copy(const VkFramebufferMixedSamplesCombinationNV& src, VkFramebufferMixedSamplesCombinationNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGeneratedCommandsInfoNV>::size(const VkGeneratedCommandsInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pStreams, src.streamCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkGeneratedCommandsInfoNV>::copy(const VkGeneratedCommandsInfoNV& src, VkGeneratedCommandsInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pStreams = DeepCopyArray(src.pStreams, src.streamCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGeneratedCommandsMemoryRequirementsInfoNV>::size(const VkGeneratedCommandsMemoryRequirementsInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkGeneratedCommandsMemoryRequirementsInfoNV>::copy(const VkGeneratedCommandsMemoryRequirementsInfoNV& src, VkGeneratedCommandsMemoryRequirementsInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGeometryAABBNV>::size(const VkGeometryAABBNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkGeometryAABBNV>::copy(const VkGeometryAABBNV& src, VkGeometryAABBNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGeometryDataNV>::size(const VkGeometryDataNV& src, size_t& offset) {
+    DeepCopyTraits<VkGeometryTrianglesNV>::size(src.triangles, offset);
+    DeepCopyTraits<VkGeometryAABBNV>::size(src.aabbs, offset);
+  }
+
+  inline void DeepCopyTraits<VkGeometryDataNV>::copy(const VkGeometryDataNV& src, VkGeometryDataNV& dst, DeepCopyCursor& cursor) {
+    DeepCopyTraits<VkGeometryTrianglesNV>::copy(src.triangles, dst.triangles, cursor);
+    DeepCopyTraits<VkGeometryAABBNV>::copy(src.aabbs, dst.aabbs, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGeometryNV>::size(const VkGeometryNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkGeometryDataNV>::size(src.geometry, offset);
+  }
+
+  inline void DeepCopyTraits<VkGeometryNV>::copy(const VkGeometryNV& src, VkGeometryNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkGeometryDataNV>::copy(src.geometry, dst.geometry, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGeometryTrianglesNV>::size(const VkGeometryTrianglesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkGeometryTrianglesNV>::copy(const VkGeometryTrianglesNV& src, VkGeometryTrianglesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsPipelineCreateInfo>::size(const VkGraphicsPipelineCreateInfo& src, size_t& offset) {
+    const DeepCopyGraphicsPipelineState context{ src };
+    DeepCopyNextSize(src.pNext, offset);
+    if (context.stages)
+      DeepCopyArraySize(src.pStages, src.stageCount, offset);
+    if (context.vertexInputState)
+      DeepCopyArraySize(src.pVertexInputState, 1, offset);
+    if (context.inputAssemblyState)
+      DeepCopyArraySize(src.pInputAssemblyState, 1, offset);
+    if (context.tessellationState)
+      DeepCopyArraySize(src.pTessellationState, 1, offset);
+    if (context.viewportState)
+      DeepCopyArraySize(src.pViewportState, 1, offset, context);
+    if (context.rasterizationState)
+      DeepCopyArraySize(src.pRasterizationState, 1, offset);
+    if (context.multisampleState)
+      DeepCopyArraySize(src.pMultisampleState, 1, offset, context);
+    if (context.depthStencilState)
+      DeepCopyArraySize(src.pDepthStencilState, 1, offset);
+    if (context.colorBlendState)
+      DeepCopyArraySize(src.pColorBlendState, 1, offset, context);
+    DeepCopyArraySize(src.pDynamicState, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsPipelineCreateInfo>::copy(const VkGraphicsPipelineCreateInfo& src, VkGraphicsPipelineCreateInfo& dst, DeepCopyCursor& cursor) {
+    const DeepCopyGraphicsPipelineState context{ src };
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pStages = context.stages ? DeepCopyArray(src.pStages, src.stageCount, cursor) : nullptr;
+    dst.pVertexInputState = context.vertexInputState ? DeepCopyArray(src.pVertexInputState, 1, cursor) : nullptr;
+    dst.pInputAssemblyState = context.inputAssemblyState ? DeepCopyArray(src.pInputAssemblyState, 1, cursor) : nullptr;
+    dst.pTessellationState = context.tessellationState ? DeepCopyArray(src.pTessellationState, 1, cursor) : nullptr;
+    dst.pViewportState = context.viewportState ? DeepCopyArray(src.pViewportState, 1, cursor, context) : nullptr;
+    dst.pRasterizationState = context.rasterizationState ? DeepCopyArray(src.pRasterizationState, 1, cursor) : nullptr;
+    dst.pMultisampleState = context.multisampleState ? DeepCopyArray(src.pMultisampleState, 1, cursor, context) : nullptr;
+    dst.pDepthStencilState = context.depthStencilState ? DeepCopyArray(src.pDepthStencilState, 1, cursor) : nullptr;
+    dst.pColorBlendState = context.colorBlendState ? DeepCopyArray(src.pColorBlendState, 1, cursor, context) : nullptr;
+    dst.pDynamicState = DeepCopyArray(src.pDynamicState, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsPipelineLibraryCreateInfoEXT>::size(const VkGraphicsPipelineLibraryCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsPipelineLibraryCreateInfoEXT>::copy(const VkGraphicsPipelineLibraryCreateInfoEXT& src, VkGraphicsPipelineLibraryCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsPipelineShaderGroupsCreateInfoNV>::size(const VkGraphicsPipelineShaderGroupsCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pGroups, src.groupCount, offset);
+    DeepCopyArraySize(src.pPipelines, src.pipelineCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsPipelineShaderGroupsCreateInfoNV>::copy(const VkGraphicsPipelineShaderGroupsCreateInfoNV& src, VkGraphicsPipelineShaderGroupsCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pGroups = DeepCopyArray(src.pGroups, src.groupCount, cursor);
+    dst.pPipelines = DeepCopyArray(src.pPipelines, src.pipelineCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsShaderGroupCreateInfoNV>::size(const VkGraphicsShaderGroupCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pStages, src.stageCount, offset);
+    DeepCopyArraySize(src.pVertexInputState, 1, offset);
+    DeepCopyArraySize(src.pTessellationState, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkGraphicsShaderGroupCreateInfoNV>::copy(const VkGraphicsShaderGroupCreateInfoNV& src, VkGraphicsShaderGroupCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pStages = DeepCopyArray(src.pStages, src.stageCount, cursor);
+    dst.pVertexInputState = DeepCopyArray(src.pVertexInputState, 1, cursor);
+    dst.pTessellationState = DeepCopyArray(src.pTessellationState, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkHdrMetadataEXT>::size(const VkHdrMetadataEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkHdrMetadataEXT>::copy(const VkHdrMetadataEXT& src, VkHdrMetadataEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkHeadlessSurfaceCreateInfoEXT>::size(const VkHeadlessSurfaceCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkHeadlessSurfaceCreateInfoEXT>::copy(const VkHeadlessSurfaceCreateInfoEXT& src, VkHeadlessSurfaceCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_IOS_MVK
+  inline void DeepCopyTraits<VkIOSSurfaceCreateInfoMVK>::size(const VkIOSSurfaceCreateInfoMVK& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkIOSSurfaceCreateInfoMVK>::copy(const VkIOSSurfaceCreateInfoMVK& src, VkIOSSurfaceCreateInfoMVK& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImageBlit2>::size(const VkImageBlit2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageBlit2>::copy(const VkImageBlit2& src, VkImageBlit2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageCaptureDescriptorDataInfoEXT>::size(const VkImageCaptureDescriptorDataInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageCaptureDescriptorDataInfoEXT>::copy(const VkImageCaptureDescriptorDataInfoEXT& src, VkImageCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageCompressionControlEXT>::size(const VkImageCompressionControlEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pFixedRateFlags, src.compressionControlPlaneCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageCompressionControlEXT>::copy(const VkImageCompressionControlEXT& src, VkImageCompressionControlEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pFixedRateFlags = DeepCopyArray(src.pFixedRateFlags, src.compressionControlPlaneCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageCompressionPropertiesEXT>::size(const VkImageCompressionPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageCompressionPropertiesEXT>::copy(const VkImageCompressionPropertiesEXT& src, VkImageCompressionPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkImageConstraintsInfoFUCHSIA>::size(const VkImageConstraintsInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pFormatConstraints, src.formatConstraintsCount, offset);
+    DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::size(src.bufferCollectionConstraints, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageConstraintsInfoFUCHSIA>::copy(const VkImageConstraintsInfoFUCHSIA& src, VkImageConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pFormatConstraints = DeepCopyArray(src.pFormatConstraints, src.formatConstraintsCount, cursor);
+    DeepCopyTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::copy(src.bufferCollectionConstraints, dst.bufferCollectionConstraints, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImageCopy2>::size(const VkImageCopy2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageCopy2>::copy(const VkImageCopy2& src, VkImageCopy2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageCreateInfo>::size(const VkImageCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (src.sharingMode == VK_SHARING_MODE_CONCURRENT)
+      DeepCopyArraySize(src.pQueueFamilyIndices, src.queueFamilyIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageCreateInfo>::copy(const VkImageCreateInfo& src, VkImageCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pQueueFamilyIndices = src.sharingMode == VK_SHARING_MODE_CONCURRENT ? DeepCopyArray(src.pQueueFamilyIndices, src.queueFamilyIndexCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkImageDrmFormatModifierExplicitCreateInfoEXT>::size(const VkImageDrmFormatModifierExplicitCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPlaneLayouts, src.drmFormatModifierPlaneCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageDrmFormatModifierExplicitCreateInfoEXT>::copy(const VkImageDrmFormatModifierExplicitCreateInfoEXT& src, VkImageDrmFormatModifierExplicitCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPlaneLayouts = DeepCopyArray(src.pPlaneLayouts, src.drmFormatModifierPlaneCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageDrmFormatModifierListCreateInfoEXT>::size(const VkImageDrmFormatModifierListCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDrmFormatModifiers, src.drmFormatModifierCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageDrmFormatModifierListCreateInfoEXT>::copy(const VkImageDrmFormatModifierListCreateInfoEXT& src, VkImageDrmFormatModifierListCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDrmFormatModifiers = DeepCopyArray(src.pDrmFormatModifiers, src.drmFormatModifierCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageDrmFormatModifierPropertiesEXT>::size(const VkImageDrmFormatModifierPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageDrmFormatModifierPropertiesEXT>::copy(const VkImageDrmFormatModifierPropertiesEXT& src, VkImageDrmFormatModifierPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkImageFormatConstraintsInfoFUCHSIA>::size(const VkImageFormatConstraintsInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkImageCreateInfo>::size(src.imageCreateInfo, offset);
+    DeepCopyArraySize(src.pColorSpaces, src.colorSpaceCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageFormatConstraintsInfoFUCHSIA>::copy(const VkImageFormatConstraintsInfoFUCHSIA& src, VkImageFormatConstraintsInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkImageCreateInfo>::copy(src.imageCreateInfo, dst.imageCreateInfo, cursor);
+    dst.pColorSpaces = DeepCopyArray(src.pColorSpaces, src.colorSpaceCount, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImageFormatListCreateInfo>::size(const VkImageFormatListCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pViewFormats, src.viewFormatCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageFormatListCreateInfo>::copy(const VkImageFormatListCreateInfo& src, VkImageFormatListCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewFormats = DeepCopyArray(src.pViewFormats, src.viewFormatCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageFormatProperties2>::size(const VkImageFormatProperties2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageFormatProperties2>::copy(const VkImageFormatProperties2& src, VkImageFormatProperties2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageMemoryBarrier>::size(const VkImageMemoryBarrier& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageMemoryBarrier>::copy(const VkImageMemoryBarrier& src, VkImageMemoryBarrier& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageMemoryBarrier2>::size(const VkImageMemoryBarrier2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageMemoryBarrier2>::copy(const VkImageMemoryBarrier2& src, VkImageMemoryBarrier2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageMemoryRequirementsInfo2>::size(const VkImageMemoryRequirementsInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageMemoryRequirementsInfo2>::copy(const VkImageMemoryRequirementsInfo2& src, VkImageMemoryRequirementsInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkImagePipeSurfaceCreateInfoFUCHSIA>::size(const VkImagePipeSurfaceCreateInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImagePipeSurfaceCreateInfoFUCHSIA>::copy(const VkImagePipeSurfaceCreateInfoFUCHSIA& src, VkImagePipeSurfaceCreateInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImagePlaneMemoryRequirementsInfo>::size(const VkImagePlaneMemoryRequirementsInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImagePlaneMemoryRequirementsInfo>::copy(const VkImagePlaneMemoryRequirementsInfo& src, VkImagePlaneMemoryRequirementsInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageResolve2>::size(const VkImageResolve2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageResolve2>::copy(const VkImageResolve2& src, VkImageResolve2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageSparseMemoryRequirementsInfo2>::size(const VkImageSparseMemoryRequirementsInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageSparseMemoryRequirementsInfo2>::copy(const VkImageSparseMemoryRequirementsInfo2& src, VkImageSparseMemoryRequirementsInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageStencilUsageCreateInfo>::size(const VkImageStencilUsageCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageStencilUsageCreateInfo>::copy(const VkImageStencilUsageCreateInfo& src, VkImageStencilUsageCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageSubresource2EXT>::size(const VkImageSubresource2EXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageSubresource2EXT>::copy(const VkImageSubresource2EXT& src, VkImageSubresource2EXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageSwapchainCreateInfoKHR>::size(const VkImageSwapchainCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageSwapchainCreateInfoKHR>::copy(const VkImageSwapchainCreateInfoKHR& src, VkImageSwapchainCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewASTCDecodeModeEXT>::size(const VkImageViewASTCDecodeModeEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewASTCDecodeModeEXT>::copy(const VkImageViewASTCDecodeModeEXT& src, VkImageViewASTCDecodeModeEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewCaptureDescriptorDataInfoEXT>::size(const VkImageViewCaptureDescriptorDataInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewCaptureDescriptorDataInfoEXT>::copy(const VkImageViewCaptureDescriptorDataInfoEXT& src, VkImageViewCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewCreateInfo>::size(const VkImageViewCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewCreateInfo>::copy(const VkImageViewCreateInfo& src, VkImageViewCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewMinLodCreateInfoEXT>::size(const VkImageViewMinLodCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewMinLodCreateInfoEXT>::copy(const VkImageViewMinLodCreateInfoEXT& src, VkImageViewMinLodCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewSampleWeightCreateInfoQCOM>::size(const VkImageViewSampleWeightCreateInfoQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewSampleWeightCreateInfoQCOM>::copy(const VkImageViewSampleWeightCreateInfoQCOM& src, VkImageViewSampleWeightCreateInfoQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewSlicedCreateInfoEXT>::size(const VkImageViewSlicedCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewSlicedCreateInfoEXT>::copy(const VkImageViewSlicedCreateInfoEXT& src, VkImageViewSlicedCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImageViewUsageCreateInfo>::size(const VkImageViewUsageCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImageViewUsageCreateInfo>::copy(const VkImageViewUsageCreateInfo& src, VkImageViewUsageCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkImportAndroidHardwareBufferInfoANDROID>::size(const VkImportAndroidHardwareBufferInfoANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportAndroidHardwareBufferInfoANDROID>::copy(const VkImportAndroidHardwareBufferInfoANDROID& src, VkImportAndroidHardwareBufferInfoANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImportFenceFdInfoKHR>::size(const VkImportFenceFdInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportFenceFdInfoKHR>::copy(const VkImportFenceFdInfoKHR& src, VkImportFenceFdInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkImportFenceWin32HandleInfoKHR>::size(const VkImportFenceWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportFenceWin32HandleInfoKHR>::copy(const VkImportFenceWin32HandleInfoKHR& src, VkImportFenceWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkImportMemoryBufferCollectionFUCHSIA>::size(const VkImportMemoryBufferCollectionFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryBufferCollectionFUCHSIA>::copy(const VkImportMemoryBufferCollectionFUCHSIA& src, VkImportMemoryBufferCollectionFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImportMemoryFdInfoKHR>::size(const VkImportMemoryFdInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryFdInfoKHR>::copy(const VkImportMemoryFdInfoKHR& src, VkImportMemoryFdInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryHostPointerInfoEXT>::size(const VkImportMemoryHostPointerInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryHostPointerInfoEXT>::copy(const VkImportMemoryHostPointerInfoEXT& src, VkImportMemoryHostPointerInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkImportMemoryWin32HandleInfoKHR>::size(const VkImportMemoryWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryWin32HandleInfoKHR>::copy(const VkImportMemoryWin32HandleInfoKHR& src, VkImportMemoryWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkImportMemoryWin32HandleInfoNV>::size(const VkImportMemoryWin32HandleInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryWin32HandleInfoNV>::copy(const VkImportMemoryWin32HandleInfoNV& src, VkImportMemoryWin32HandleInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkImportMemoryZirconHandleInfoFUCHSIA>::size(const VkImportMemoryZirconHandleInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMemoryZirconHandleInfoFUCHSIA>::copy(const VkImportMemoryZirconHandleInfoFUCHSIA& src, VkImportMemoryZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkImportMetalBufferInfoEXT>::size(const VkImportMetalBufferInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMetalBufferInfoEXT>::copy(const VkImportMetalBufferInfoEXT& src, VkImportMetalBufferInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkImportMetalIOSurfaceInfoEXT>::size(const VkImportMetalIOSurfaceInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMetalIOSurfaceInfoEXT>::copy(const VkImportMetalIOSurfaceInfoEXT& src, VkImportMetalIOSurfaceInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkImportMetalSharedEventInfoEXT>::size(const VkImportMetalSharedEventInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMetalSharedEventInfoEXT>::copy(const VkImportMetalSharedEventInfoEXT& src, VkImportMetalSharedEventInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkImportMetalTextureInfoEXT>::size(const VkImportMetalTextureInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportMetalTextureInfoEXT>::copy(const VkImportMetalTextureInfoEXT& src, VkImportMetalTextureInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkImportSemaphoreFdInfoKHR>::size(const VkImportSemaphoreFdInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportSemaphoreFdInfoKHR>::copy(const VkImportSemaphoreFdInfoKHR& src, VkImportSemaphoreFdInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkImportSemaphoreWin32HandleInfoKHR>::size(const VkImportSemaphoreWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportSemaphoreWin32HandleInfoKHR>::copy(const VkImportSemaphoreWin32HandleInfoKHR& src, VkImportSemaphoreWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkImportSemaphoreZirconHandleInfoFUCHSIA>::size(const VkImportSemaphoreZirconHandleInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkImportSemaphoreZirconHandleInfoFUCHSIA>::copy(const VkImportSemaphoreZirconHandleInfoFUCHSIA& src, VkImportSemaphoreZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkIndirectCommandsLayoutCreateInfoNV>::size(const VkIndirectCommandsLayoutCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pTokens, src.tokenCount, offset);
+    DeepCopyArraySize(src.pStreamStrides, src.streamCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkIndirectCommandsLayoutCreateInfoNV>::copy(const VkIndirectCommandsLayoutCreateInfoNV& src, VkIndirectCommandsLayoutCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pTokens = DeepCopyArray(src.pTokens, src.tokenCount, cursor);
+    dst.pStreamStrides = DeepCopyArray(src.pStreamStrides, src.streamCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkIndirectCommandsLayoutTokenNV>::size(const VkIndirectCommandsLayoutTokenNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pIndexTypes, src.indexTypeCount, offset);
+    DeepCopyArraySize(src.pIndexTypeValues, src.indexTypeCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkIndirectCommandsLayoutTokenNV>::copy(const VkIndirectCommandsLayoutTokenNV& src, VkIndirectCommandsLayoutTokenNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pIndexTypes = DeepCopyArray(src.pIndexTypes, src.indexTypeCount, cursor);
+    dst.pIndexTypeValues = DeepCopyArray(src.pIndexTypeValues, src.indexTypeCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkInitializePerformanceApiInfoINTEL>::size(const VkInitializePerformanceApiInfoINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkInitializePerformanceApiInfoINTEL>::copy(const VkInitializePerformanceApiInfoINTEL& src, VkInitializePerformanceApiInfoINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkInstanceCreateInfo>::size(const VkInstanceCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pApplicationInfo, 1, offset);
+    DeepCopyStringArraySize(src.ppEnabledLayerNames, src.enabledLayerCount, offset);
+    DeepCopyStringArraySize(src.ppEnabledExtensionNames, src.enabledExtensionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkInstanceCreateInfo>::copy(const VkInstanceCreateInfo& src, VkInstanceCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pApplicationInfo = DeepCopyArray(src.pApplicationInfo, 1, cursor);
+    dst.ppEnabledLayerNames = DeepCopyStringArray(src.ppEnabledLayerNames, src.enabledLayerCount, cursor);
+    dst.ppEnabledExtensionNames = DeepCopyStringArray(src.ppEnabledExtensionNames, src.enabledExtensionCount, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+  inline void DeepCopyTraits<VkMacOSSurfaceCreateInfoMVK>::size(const VkMacOSSurfaceCreateInfoMVK& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMacOSSurfaceCreateInfoMVK>::copy(const VkMacOSSurfaceCreateInfoMVK& src, VkMacOSSurfaceCreateInfoMVK& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkMappedMemoryRange>::size(const VkMappedMemoryRange& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMappedMemoryRange>::copy(const VkMappedMemoryRange& src, VkMappedMemoryRange& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryAllocateFlagsInfo>::size(const VkMemoryAllocateFlagsInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryAllocateFlagsInfo>::copy(const VkMemoryAllocateFlagsInfo& src, VkMemoryAllocateFlagsInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryAllocateInfo>::size(const VkMemoryAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryAllocateInfo>::copy(const VkMemoryAllocateInfo& src, VkMemoryAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryBarrier>::size(const VkMemoryBarrier& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryBarrier>::copy(const VkMemoryBarrier& src, VkMemoryBarrier& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryBarrier2>::size(const VkMemoryBarrier2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryBarrier2>::copy(const VkMemoryBarrier2& src, VkMemoryBarrier2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryDedicatedAllocateInfo>::size(const VkMemoryDedicatedAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryDedicatedAllocateInfo>::copy(const VkMemoryDedicatedAllocateInfo& src, VkMemoryDedicatedAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryDedicatedRequirements>::size(const VkMemoryDedicatedRequirements& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryDedicatedRequirements>::copy(const VkMemoryDedicatedRequirements& src, VkMemoryDedicatedRequirements& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryFdPropertiesKHR>::size(const VkMemoryFdPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryFdPropertiesKHR>::copy(const VkMemoryFdPropertiesKHR& src, VkMemoryFdPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void DeepCopyTraits<VkMemoryGetAndroidHardwareBufferInfoANDROID>::size(const VkMemoryGetAndroidHardwareBufferInfoANDROID& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryGetAndroidHardwareBufferInfoANDROID>::copy(const VkMemoryGetAndroidHardwareBufferInfoANDROID& src, VkMemoryGetAndroidHardwareBufferInfoANDROID& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkMemoryGetFdInfoKHR>::size(const VkMemoryGetFdInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryGetFdInfoKHR>::copy(const VkMemoryGetFdInfoKHR& src, VkMemoryGetFdInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryGetRemoteAddressInfoNV>::size(const VkMemoryGetRemoteAddressInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryGetRemoteAddressInfoNV>::copy(const VkMemoryGetRemoteAddressInfoNV& src, VkMemoryGetRemoteAddressInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkMemoryGetWin32HandleInfoKHR>::size(const VkMemoryGetWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryGetWin32HandleInfoKHR>::copy(const VkMemoryGetWin32HandleInfoKHR& src, VkMemoryGetWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkMemoryGetZirconHandleInfoFUCHSIA>::size(const VkMemoryGetZirconHandleInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryGetZirconHandleInfoFUCHSIA>::copy(const VkMemoryGetZirconHandleInfoFUCHSIA& src, VkMemoryGetZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkMemoryHostPointerPropertiesEXT>::size(const VkMemoryHostPointerPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryHostPointerPropertiesEXT>::copy(const VkMemoryHostPointerPropertiesEXT& src, VkMemoryHostPointerPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryMapInfoKHR>::size(const VkMemoryMapInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryMapInfoKHR>::copy(const VkMemoryMapInfoKHR& src, VkMemoryMapInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryOpaqueCaptureAddressAllocateInfo>::size(const VkMemoryOpaqueCaptureAddressAllocateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryOpaqueCaptureAddressAllocateInfo>::copy(const VkMemoryOpaqueCaptureAddressAllocateInfo& src, VkMemoryOpaqueCaptureAddressAllocateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryPriorityAllocateInfoEXT>::size(const VkMemoryPriorityAllocateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryPriorityAllocateInfoEXT>::copy(const VkMemoryPriorityAllocateInfoEXT& src, VkMemoryPriorityAllocateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryRequirements2>::size(const VkMemoryRequirements2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryRequirements2>::copy(const VkMemoryRequirements2& src, VkMemoryRequirements2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMemoryUnmapInfoKHR>::size(const VkMemoryUnmapInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryUnmapInfoKHR>::copy(const VkMemoryUnmapInfoKHR& src, VkMemoryUnmapInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkMemoryWin32HandlePropertiesKHR>::size(const VkMemoryWin32HandlePropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryWin32HandlePropertiesKHR>::copy(const VkMemoryWin32HandlePropertiesKHR& src, VkMemoryWin32HandlePropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkMemoryZirconHandlePropertiesFUCHSIA>::size(const VkMemoryZirconHandlePropertiesFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMemoryZirconHandlePropertiesFUCHSIA>::copy(const VkMemoryZirconHandlePropertiesFUCHSIA& src, VkMemoryZirconHandlePropertiesFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void DeepCopyTraits<VkMetalSurfaceCreateInfoEXT>::size(const VkMetalSurfaceCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMetalSurfaceCreateInfoEXT>::copy(const VkMetalSurfaceCreateInfoEXT& src, VkMetalSurfaceCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkMicromapBuildInfoEXT>::size(const VkMicromapBuildInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pUsageCounts, src.usageCountsCount, offset);
+    DeepCopyPointerArraySize(src.ppUsageCounts, src.usageCountsCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkMicromapBuildInfoEXT>::copy(const VkMicromapBuildInfoEXT& src, VkMicromapBuildInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pUsageCounts = DeepCopyArray(src.pUsageCounts, src.usageCountsCount, cursor);
+    dst.ppUsageCounts = DeepCopyPointerArray(src.ppUsageCounts, src.usageCountsCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMicromapBuildSizesInfoEXT>::size(const VkMicromapBuildSizesInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMicromapBuildSizesInfoEXT>::copy(const VkMicromapBuildSizesInfoEXT& src, VkMicromapBuildSizesInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMicromapCreateInfoEXT>::size(const VkMicromapCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMicromapCreateInfoEXT>::copy(const VkMicromapCreateInfoEXT& src, VkMicromapCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMicromapVersionInfoEXT>::size(const VkMicromapVersionInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pVersionData, 2 * VK_UUID_SIZE, offset);
+  }
+
+  inline void DeepCopyTraits<VkMicromapVersionInfoEXT>::copy(const VkMicromapVersionInfoEXT& src, VkMicromapVersionInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pVersionData = DeepCopyArray(src.pVersionData, 2 * VK_UUID_SIZE, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMultisamplePropertiesEXT>::size(const VkMultisamplePropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMultisamplePropertiesEXT>::copy(const VkMultisamplePropertiesEXT& src, VkMultisamplePropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMultisampledRenderToSingleSampledInfoEXT>::size(const VkMultisampledRenderToSingleSampledInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMultisampledRenderToSingleSampledInfoEXT>::copy(const VkMultisampledRenderToSingleSampledInfoEXT& src, VkMultisampledRenderToSingleSampledInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMultiviewPerViewAttributesInfoNVX>::size(const VkMultiviewPerViewAttributesInfoNVX& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkMultiviewPerViewAttributesInfoNVX>::copy(const VkMultiviewPerViewAttributesInfoNVX& src, VkMultiviewPerViewAttributesInfoNVX& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM>::size(const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPerViewRenderAreas, src.perViewRenderAreaCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM>::copy(const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& src, VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPerViewRenderAreas = DeepCopyArray(src.pPerViewRenderAreas, src.perViewRenderAreaCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMutableDescriptorTypeListEXT>::size(const VkMutableDescriptorTypeListEXT& src, size_t& offset) {
+    DeepCopyArraySize(src.pDescriptorTypes, src.descriptorTypeCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkMutableDescriptorTypeListEXT>::copy(const VkMutableDescriptorTypeListEXT& src, VkMutableDescriptorTypeListEXT& dst, DeepCopyCursor& cursor) {
+    dst.pDescriptorTypes = DeepCopyArray(src.pDescriptorTypes, src.descriptorTypeCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkMutableDescriptorTypeCreateInfoEXT>::size(const VkMutableDescriptorTypeCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pMutableDescriptorTypeLists, src.mutableDescriptorTypeListCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkMutableDescriptorTypeCreateInfoEXT>::copy(const VkMutableDescriptorTypeCreateInfoEXT& src, VkMutableDescriptorTypeCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pMutableDescriptorTypeLists = DeepCopyArray(src.pMutableDescriptorTypeLists, src.mutableDescriptorTypeListCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkOpaqueCaptureDescriptorDataCreateInfoEXT>::size(const VkOpaqueCaptureDescriptorDataCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkOpaqueCaptureDescriptorDataCreateInfoEXT>::copy(const VkOpaqueCaptureDescriptorDataCreateInfoEXT& src, VkOpaqueCaptureDescriptorDataCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowExecuteInfoNV>::size(const VkOpticalFlowExecuteInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowExecuteInfoNV>::copy(const VkOpticalFlowExecuteInfoNV& src, VkOpticalFlowExecuteInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowImageFormatInfoNV>::size(const VkOpticalFlowImageFormatInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowImageFormatInfoNV>::copy(const VkOpticalFlowImageFormatInfoNV& src, VkOpticalFlowImageFormatInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowImageFormatPropertiesNV>::size(const VkOpticalFlowImageFormatPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowImageFormatPropertiesNV>::copy(const VkOpticalFlowImageFormatPropertiesNV& src, VkOpticalFlowImageFormatPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowSessionCreateInfoNV>::size(const VkOpticalFlowSessionCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowSessionCreateInfoNV>::copy(const VkOpticalFlowSessionCreateInfoNV& src, VkOpticalFlowSessionCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowSessionCreatePrivateDataInfoNV>::size(const VkOpticalFlowSessionCreatePrivateDataInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkOpticalFlowSessionCreatePrivateDataInfoNV>::copy(const VkOpticalFlowSessionCreatePrivateDataInfoNV& src, VkOpticalFlowSessionCreatePrivateDataInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceConfigurationAcquireInfoINTEL>::size(const VkPerformanceConfigurationAcquireInfoINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceConfigurationAcquireInfoINTEL>::copy(const VkPerformanceConfigurationAcquireInfoINTEL& src, VkPerformanceConfigurationAcquireInfoINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceCounterDescriptionKHR>::size(const VkPerformanceCounterDescriptionKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceCounterDescriptionKHR>::copy(const VkPerformanceCounterDescriptionKHR& src, VkPerformanceCounterDescriptionKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceCounterKHR>::size(const VkPerformanceCounterKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceCounterKHR>::copy(const VkPerformanceCounterKHR& src, VkPerformanceCounterKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceMarkerInfoINTEL>::size(const VkPerformanceMarkerInfoINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceMarkerInfoINTEL>::copy(const VkPerformanceMarkerInfoINTEL& src, VkPerformanceMarkerInfoINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceOverrideInfoINTEL>::size(const VkPerformanceOverrideInfoINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceOverrideInfoINTEL>::copy(const VkPerformanceOverrideInfoINTEL& src, VkPerformanceOverrideInfoINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceQuerySubmitInfoKHR>::size(const VkPerformanceQuerySubmitInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceQuerySubmitInfoKHR>::copy(const VkPerformanceQuerySubmitInfoKHR& src, VkPerformanceQuerySubmitInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceStreamMarkerInfoINTEL>::size(const VkPerformanceStreamMarkerInfoINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPerformanceStreamMarkerInfoINTEL>::copy(const VkPerformanceStreamMarkerInfoINTEL& src, VkPerformanceStreamMarkerInfoINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevice16BitStorageFeatures>::size(const VkPhysicalDevice16BitStorageFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevice16BitStorageFeatures>::copy(const VkPhysicalDevice16BitStorageFeatures& src, VkPhysicalDevice16BitStorageFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevice4444FormatsFeaturesEXT>::size(const VkPhysicalDevice4444FormatsFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevice4444FormatsFeaturesEXT>::copy(const VkPhysicalDevice4444FormatsFeaturesEXT& src, VkPhysicalDevice4444FormatsFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevice8BitStorageFeatures>::size(const VkPhysicalDevice8BitStorageFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevice8BitStorageFeatures>::copy(const VkPhysicalDevice8BitStorageFeatures& src, VkPhysicalDevice8BitStorageFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceASTCDecodeFeaturesEXT>::size(const VkPhysicalDeviceASTCDecodeFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceASTCDecodeFeaturesEXT>::copy(const VkPhysicalDeviceASTCDecodeFeaturesEXT& src, VkPhysicalDeviceASTCDecodeFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAccelerationStructureFeaturesKHR>::size(const VkPhysicalDeviceAccelerationStructureFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAccelerationStructureFeaturesKHR>::copy(const VkPhysicalDeviceAccelerationStructureFeaturesKHR& src, VkPhysicalDeviceAccelerationStructureFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAccelerationStructurePropertiesKHR>::size(const VkPhysicalDeviceAccelerationStructurePropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAccelerationStructurePropertiesKHR>::copy(const VkPhysicalDeviceAccelerationStructurePropertiesKHR& src, VkPhysicalDeviceAccelerationStructurePropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAddressBindingReportFeaturesEXT>::size(const VkPhysicalDeviceAddressBindingReportFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAddressBindingReportFeaturesEXT>::copy(const VkPhysicalDeviceAddressBindingReportFeaturesEXT& src, VkPhysicalDeviceAddressBindingReportFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAmigoProfilingFeaturesSEC>::size(const VkPhysicalDeviceAmigoProfilingFeaturesSEC& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAmigoProfilingFeaturesSEC>::copy(const VkPhysicalDeviceAmigoProfilingFeaturesSEC& src, VkPhysicalDeviceAmigoProfilingFeaturesSEC& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT>::size(const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT>::copy(const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& src, VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT>::size(const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT>::copy(const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& src, VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT>::size(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT>::copy(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& src, VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT>::size(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT>::copy(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& src, VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT>::size(const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT>::copy(const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& src, VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBufferDeviceAddressFeatures>::size(const VkPhysicalDeviceBufferDeviceAddressFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBufferDeviceAddressFeatures>::copy(const VkPhysicalDeviceBufferDeviceAddressFeatures& src, VkPhysicalDeviceBufferDeviceAddressFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>::size(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>::copy(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& src, VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI>::size(const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI>::copy(const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& src, VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI>::size(const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI>::copy(const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& src, VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCoherentMemoryFeaturesAMD>::size(const VkPhysicalDeviceCoherentMemoryFeaturesAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCoherentMemoryFeaturesAMD>::copy(const VkPhysicalDeviceCoherentMemoryFeaturesAMD& src, VkPhysicalDeviceCoherentMemoryFeaturesAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceColorWriteEnableFeaturesEXT>::size(const VkPhysicalDeviceColorWriteEnableFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceColorWriteEnableFeaturesEXT>::copy(const VkPhysicalDeviceColorWriteEnableFeaturesEXT& src, VkPhysicalDeviceColorWriteEnableFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>::size(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>::copy(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& src, VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceConditionalRenderingFeaturesEXT>::size(const VkPhysicalDeviceConditionalRenderingFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceConditionalRenderingFeaturesEXT>::copy(const VkPhysicalDeviceConditionalRenderingFeaturesEXT& src, VkPhysicalDeviceConditionalRenderingFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceConservativeRasterizationPropertiesEXT>::size(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceConservativeRasterizationPropertiesEXT>::copy(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& src, VkPhysicalDeviceConservativeRasterizationPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCooperativeMatrixFeaturesNV>::size(const VkPhysicalDeviceCooperativeMatrixFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCooperativeMatrixFeaturesNV>::copy(const VkPhysicalDeviceCooperativeMatrixFeaturesNV& src, VkPhysicalDeviceCooperativeMatrixFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCooperativeMatrixPropertiesNV>::size(const VkPhysicalDeviceCooperativeMatrixPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCooperativeMatrixPropertiesNV>::copy(const VkPhysicalDeviceCooperativeMatrixPropertiesNV& src, VkPhysicalDeviceCooperativeMatrixPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCopyMemoryIndirectFeaturesNV>::size(const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCopyMemoryIndirectFeaturesNV>::copy(const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& src, VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCopyMemoryIndirectPropertiesNV>::size(const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCopyMemoryIndirectPropertiesNV>::copy(const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& src, VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCornerSampledImageFeaturesNV>::size(const VkPhysicalDeviceCornerSampledImageFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCornerSampledImageFeaturesNV>::copy(const VkPhysicalDeviceCornerSampledImageFeaturesNV& src, VkPhysicalDeviceCornerSampledImageFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCoverageReductionModeFeaturesNV>::size(const VkPhysicalDeviceCoverageReductionModeFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCoverageReductionModeFeaturesNV>::copy(const VkPhysicalDeviceCoverageReductionModeFeaturesNV& src, VkPhysicalDeviceCoverageReductionModeFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCustomBorderColorFeaturesEXT>::size(const VkPhysicalDeviceCustomBorderColorFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCustomBorderColorFeaturesEXT>::copy(const VkPhysicalDeviceCustomBorderColorFeaturesEXT& src, VkPhysicalDeviceCustomBorderColorFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCustomBorderColorPropertiesEXT>::size(const VkPhysicalDeviceCustomBorderColorPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceCustomBorderColorPropertiesEXT>::copy(const VkPhysicalDeviceCustomBorderColorPropertiesEXT& src, VkPhysicalDeviceCustomBorderColorPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>::size(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>::copy(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& src, VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthClampZeroOneFeaturesEXT>::size(const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthClampZeroOneFeaturesEXT>::copy(const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& src, VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthClipControlFeaturesEXT>::size(const VkPhysicalDeviceDepthClipControlFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthClipControlFeaturesEXT>::copy(const VkPhysicalDeviceDepthClipControlFeaturesEXT& src, VkPhysicalDeviceDepthClipControlFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthClipEnableFeaturesEXT>::size(const VkPhysicalDeviceDepthClipEnableFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthClipEnableFeaturesEXT>::copy(const VkPhysicalDeviceDepthClipEnableFeaturesEXT& src, VkPhysicalDeviceDepthClipEnableFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthStencilResolveProperties>::size(const VkPhysicalDeviceDepthStencilResolveProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDepthStencilResolveProperties>::copy(const VkPhysicalDeviceDepthStencilResolveProperties& src, VkPhysicalDeviceDepthStencilResolveProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT>::size(const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT>::copy(const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& src, VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorBufferFeaturesEXT>::size(const VkPhysicalDeviceDescriptorBufferFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorBufferFeaturesEXT>::copy(const VkPhysicalDeviceDescriptorBufferFeaturesEXT& src, VkPhysicalDeviceDescriptorBufferFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorBufferPropertiesEXT>::size(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorBufferPropertiesEXT>::copy(const VkPhysicalDeviceDescriptorBufferPropertiesEXT& src, VkPhysicalDeviceDescriptorBufferPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorIndexingFeatures>::size(const VkPhysicalDeviceDescriptorIndexingFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorIndexingFeatures>::copy(const VkPhysicalDeviceDescriptorIndexingFeatures& src, VkPhysicalDeviceDescriptorIndexingFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorIndexingProperties>::size(const VkPhysicalDeviceDescriptorIndexingProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorIndexingProperties>::copy(const VkPhysicalDeviceDescriptorIndexingProperties& src, VkPhysicalDeviceDescriptorIndexingProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE>::size(const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE>::copy(const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& src, VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV>::size(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV>::copy(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& src, VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV>::size(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV>::copy(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& src, VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT>::size(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT>::copy(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& src, VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDiagnosticsConfigFeaturesNV>::size(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDiagnosticsConfigFeaturesNV>::copy(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& src, VkPhysicalDeviceDiagnosticsConfigFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDiscardRectanglePropertiesEXT>::size(const VkPhysicalDeviceDiscardRectanglePropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDiscardRectanglePropertiesEXT>::copy(const VkPhysicalDeviceDiscardRectanglePropertiesEXT& src, VkPhysicalDeviceDiscardRectanglePropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkPhysicalDeviceDisplacementMicromapFeaturesNV>::size(const VkPhysicalDeviceDisplacementMicromapFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDisplacementMicromapFeaturesNV>::copy(const VkPhysicalDeviceDisplacementMicromapFeaturesNV& src, VkPhysicalDeviceDisplacementMicromapFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkPhysicalDeviceDisplacementMicromapPropertiesNV>::size(const VkPhysicalDeviceDisplacementMicromapPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDisplacementMicromapPropertiesNV>::copy(const VkPhysicalDeviceDisplacementMicromapPropertiesNV& src, VkPhysicalDeviceDisplacementMicromapPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDriverProperties>::size(const VkPhysicalDeviceDriverProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDriverProperties>::copy(const VkPhysicalDeviceDriverProperties& src, VkPhysicalDeviceDriverProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDrmPropertiesEXT>::size(const VkPhysicalDeviceDrmPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDrmPropertiesEXT>::copy(const VkPhysicalDeviceDrmPropertiesEXT& src, VkPhysicalDeviceDrmPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDynamicRenderingFeatures>::size(const VkPhysicalDeviceDynamicRenderingFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDynamicRenderingFeatures>::copy(const VkPhysicalDeviceDynamicRenderingFeatures& src, VkPhysicalDeviceDynamicRenderingFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT>::size(const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT>::copy(const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& src, VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExclusiveScissorFeaturesNV>::size(const VkPhysicalDeviceExclusiveScissorFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExclusiveScissorFeaturesNV>::copy(const VkPhysicalDeviceExclusiveScissorFeaturesNV& src, VkPhysicalDeviceExclusiveScissorFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>::size(const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>::copy(const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& src, VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState3FeaturesEXT>::size(const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState3FeaturesEXT>::copy(const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& src, VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState3PropertiesEXT>::size(const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicState3PropertiesEXT>::copy(const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& src, VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>::size(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>::copy(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& src, VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalBufferInfo>::size(const VkPhysicalDeviceExternalBufferInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalBufferInfo>::copy(const VkPhysicalDeviceExternalBufferInfo& src, VkPhysicalDeviceExternalBufferInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalFenceInfo>::size(const VkPhysicalDeviceExternalFenceInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalFenceInfo>::copy(const VkPhysicalDeviceExternalFenceInfo& src, VkPhysicalDeviceExternalFenceInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalImageFormatInfo>::size(const VkPhysicalDeviceExternalImageFormatInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalImageFormatInfo>::copy(const VkPhysicalDeviceExternalImageFormatInfo& src, VkPhysicalDeviceExternalImageFormatInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalMemoryHostPropertiesEXT>::size(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalMemoryHostPropertiesEXT>::copy(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& src, VkPhysicalDeviceExternalMemoryHostPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV>::size(const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV>::copy(const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& src, VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalSemaphoreInfo>::size(const VkPhysicalDeviceExternalSemaphoreInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceExternalSemaphoreInfo>::copy(const VkPhysicalDeviceExternalSemaphoreInfo& src, VkPhysicalDeviceExternalSemaphoreInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFaultFeaturesEXT>::size(const VkPhysicalDeviceFaultFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFaultFeaturesEXT>::copy(const VkPhysicalDeviceFaultFeaturesEXT& src, VkPhysicalDeviceFaultFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFeatures2>::size(const VkPhysicalDeviceFeatures2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFeatures2>::copy(const VkPhysicalDeviceFeatures2& src, VkPhysicalDeviceFeatures2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFloatControlsProperties>::size(const VkPhysicalDeviceFloatControlsProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFloatControlsProperties>::copy(const VkPhysicalDeviceFloatControlsProperties& src, VkPhysicalDeviceFloatControlsProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>::size(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>::copy(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& src, VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT>::size(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT>::copy(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& src, VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>::size(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>::copy(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& src, VkPhysicalDeviceFragmentDensityMapFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>::size(const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>::copy(const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& src, VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM>::size(const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM>::copy(const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& src, VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapPropertiesEXT>::size(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentDensityMapPropertiesEXT>::copy(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& src, VkPhysicalDeviceFragmentDensityMapPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR>::size(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR>::copy(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& src, VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR>::size(const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR>::copy(const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& src, VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>::size(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>::copy(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& src, VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>::size(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>::copy(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& src, VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV>::size(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV>::copy(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& src, VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>::size(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>::copy(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& src, VkPhysicalDeviceFragmentShadingRateFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateKHR>::size(const VkPhysicalDeviceFragmentShadingRateKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRateKHR>::copy(const VkPhysicalDeviceFragmentShadingRateKHR& src, VkPhysicalDeviceFragmentShadingRateKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRatePropertiesKHR>::size(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceFragmentShadingRatePropertiesKHR>::copy(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& src, VkPhysicalDeviceFragmentShadingRatePropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR>::size(const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR>::copy(const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& src, VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>::size(const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>::copy(const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& src, VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT>::size(const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT>::copy(const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& src, VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGroupProperties>::size(const VkPhysicalDeviceGroupProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceGroupProperties>::copy(const VkPhysicalDeviceGroupProperties& src, VkPhysicalDeviceGroupProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceHostQueryResetFeatures>::size(const VkPhysicalDeviceHostQueryResetFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceHostQueryResetFeatures>::copy(const VkPhysicalDeviceHostQueryResetFeatures& src, VkPhysicalDeviceHostQueryResetFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceIDProperties>::size(const VkPhysicalDeviceIDProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceIDProperties>::copy(const VkPhysicalDeviceIDProperties& src, VkPhysicalDeviceIDProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT>::size(const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT>::copy(const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& src, VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageCompressionControlFeaturesEXT>::size(const VkPhysicalDeviceImageCompressionControlFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageCompressionControlFeaturesEXT>::copy(const VkPhysicalDeviceImageCompressionControlFeaturesEXT& src, VkPhysicalDeviceImageCompressionControlFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT>::size(const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT>::copy(const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& src, VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageDrmFormatModifierInfoEXT>::size(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (src.sharingMode == VK_SHARING_MODE_CONCURRENT)
+      DeepCopyArraySize(src.pQueueFamilyIndices, src.queueFamilyIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageDrmFormatModifierInfoEXT>::copy(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& src, VkPhysicalDeviceImageDrmFormatModifierInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pQueueFamilyIndices = src.sharingMode == VK_SHARING_MODE_CONCURRENT ? DeepCopyArray(src.pQueueFamilyIndices, src.queueFamilyIndexCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageFormatInfo2>::size(const VkPhysicalDeviceImageFormatInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageFormatInfo2>::copy(const VkPhysicalDeviceImageFormatInfo2& src, VkPhysicalDeviceImageFormatInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageProcessingFeaturesQCOM>::size(const VkPhysicalDeviceImageProcessingFeaturesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageProcessingFeaturesQCOM>::copy(const VkPhysicalDeviceImageProcessingFeaturesQCOM& src, VkPhysicalDeviceImageProcessingFeaturesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageProcessingPropertiesQCOM>::size(const VkPhysicalDeviceImageProcessingPropertiesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageProcessingPropertiesQCOM>::copy(const VkPhysicalDeviceImageProcessingPropertiesQCOM& src, VkPhysicalDeviceImageProcessingPropertiesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageRobustnessFeatures>::size(const VkPhysicalDeviceImageRobustnessFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageRobustnessFeatures>::copy(const VkPhysicalDeviceImageRobustnessFeatures& src, VkPhysicalDeviceImageRobustnessFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT>::size(const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT>::copy(const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& src, VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageViewImageFormatInfoEXT>::size(const VkPhysicalDeviceImageViewImageFormatInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageViewImageFormatInfoEXT>::copy(const VkPhysicalDeviceImageViewImageFormatInfoEXT& src, VkPhysicalDeviceImageViewImageFormatInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageViewMinLodFeaturesEXT>::size(const VkPhysicalDeviceImageViewMinLodFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImageViewMinLodFeaturesEXT>::copy(const VkPhysicalDeviceImageViewMinLodFeaturesEXT& src, VkPhysicalDeviceImageViewMinLodFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImagelessFramebufferFeatures>::size(const VkPhysicalDeviceImagelessFramebufferFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceImagelessFramebufferFeatures>::copy(const VkPhysicalDeviceImagelessFramebufferFeatures& src, VkPhysicalDeviceImagelessFramebufferFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceIndexTypeUint8FeaturesEXT>::size(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceIndexTypeUint8FeaturesEXT>::copy(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& src, VkPhysicalDeviceIndexTypeUint8FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>::size(const VkPhysicalDeviceInheritedViewportScissorFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>::copy(const VkPhysicalDeviceInheritedViewportScissorFeaturesNV& src, VkPhysicalDeviceInheritedViewportScissorFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInlineUniformBlockFeatures>::size(const VkPhysicalDeviceInlineUniformBlockFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInlineUniformBlockFeatures>::copy(const VkPhysicalDeviceInlineUniformBlockFeatures& src, VkPhysicalDeviceInlineUniformBlockFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInlineUniformBlockProperties>::size(const VkPhysicalDeviceInlineUniformBlockProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInlineUniformBlockProperties>::copy(const VkPhysicalDeviceInlineUniformBlockProperties& src, VkPhysicalDeviceInlineUniformBlockProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI>::size(const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI>::copy(const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& src, VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLegacyDitheringFeaturesEXT>::size(const VkPhysicalDeviceLegacyDitheringFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLegacyDitheringFeaturesEXT>::copy(const VkPhysicalDeviceLegacyDitheringFeaturesEXT& src, VkPhysicalDeviceLegacyDitheringFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLineRasterizationFeaturesEXT>::size(const VkPhysicalDeviceLineRasterizationFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLineRasterizationFeaturesEXT>::copy(const VkPhysicalDeviceLineRasterizationFeaturesEXT& src, VkPhysicalDeviceLineRasterizationFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLineRasterizationPropertiesEXT>::size(const VkPhysicalDeviceLineRasterizationPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLineRasterizationPropertiesEXT>::copy(const VkPhysicalDeviceLineRasterizationPropertiesEXT& src, VkPhysicalDeviceLineRasterizationPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLinearColorAttachmentFeaturesNV>::size(const VkPhysicalDeviceLinearColorAttachmentFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceLinearColorAttachmentFeaturesNV>::copy(const VkPhysicalDeviceLinearColorAttachmentFeaturesNV& src, VkPhysicalDeviceLinearColorAttachmentFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMaintenance3Properties>::size(const VkPhysicalDeviceMaintenance3Properties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMaintenance3Properties>::copy(const VkPhysicalDeviceMaintenance3Properties& src, VkPhysicalDeviceMaintenance3Properties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMaintenance4Features>::size(const VkPhysicalDeviceMaintenance4Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMaintenance4Features>::copy(const VkPhysicalDeviceMaintenance4Features& src, VkPhysicalDeviceMaintenance4Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMaintenance4Properties>::size(const VkPhysicalDeviceMaintenance4Properties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMaintenance4Properties>::copy(const VkPhysicalDeviceMaintenance4Properties& src, VkPhysicalDeviceMaintenance4Properties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryBudgetPropertiesEXT>::size(const VkPhysicalDeviceMemoryBudgetPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryBudgetPropertiesEXT>::copy(const VkPhysicalDeviceMemoryBudgetPropertiesEXT& src, VkPhysicalDeviceMemoryBudgetPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryDecompressionFeaturesNV>::size(const VkPhysicalDeviceMemoryDecompressionFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryDecompressionFeaturesNV>::copy(const VkPhysicalDeviceMemoryDecompressionFeaturesNV& src, VkPhysicalDeviceMemoryDecompressionFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryDecompressionPropertiesNV>::size(const VkPhysicalDeviceMemoryDecompressionPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryDecompressionPropertiesNV>::copy(const VkPhysicalDeviceMemoryDecompressionPropertiesNV& src, VkPhysicalDeviceMemoryDecompressionPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryPriorityFeaturesEXT>::size(const VkPhysicalDeviceMemoryPriorityFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryPriorityFeaturesEXT>::copy(const VkPhysicalDeviceMemoryPriorityFeaturesEXT& src, VkPhysicalDeviceMemoryPriorityFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryProperties2>::size(const VkPhysicalDeviceMemoryProperties2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMemoryProperties2>::copy(const VkPhysicalDeviceMemoryProperties2& src, VkPhysicalDeviceMemoryProperties2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderFeaturesEXT>::size(const VkPhysicalDeviceMeshShaderFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderFeaturesEXT>::copy(const VkPhysicalDeviceMeshShaderFeaturesEXT& src, VkPhysicalDeviceMeshShaderFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderFeaturesNV>::size(const VkPhysicalDeviceMeshShaderFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderFeaturesNV>::copy(const VkPhysicalDeviceMeshShaderFeaturesNV& src, VkPhysicalDeviceMeshShaderFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderPropertiesEXT>::size(const VkPhysicalDeviceMeshShaderPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderPropertiesEXT>::copy(const VkPhysicalDeviceMeshShaderPropertiesEXT& src, VkPhysicalDeviceMeshShaderPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderPropertiesNV>::size(const VkPhysicalDeviceMeshShaderPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMeshShaderPropertiesNV>::copy(const VkPhysicalDeviceMeshShaderPropertiesNV& src, VkPhysicalDeviceMeshShaderPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiDrawFeaturesEXT>::size(const VkPhysicalDeviceMultiDrawFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiDrawFeaturesEXT>::copy(const VkPhysicalDeviceMultiDrawFeaturesEXT& src, VkPhysicalDeviceMultiDrawFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiDrawPropertiesEXT>::size(const VkPhysicalDeviceMultiDrawPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiDrawPropertiesEXT>::copy(const VkPhysicalDeviceMultiDrawPropertiesEXT& src, VkPhysicalDeviceMultiDrawPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT>::size(const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT>::copy(const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& src, VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewFeatures>::size(const VkPhysicalDeviceMultiviewFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewFeatures>::copy(const VkPhysicalDeviceMultiviewFeatures& src, VkPhysicalDeviceMultiviewFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM>::size(const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM>::copy(const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& src, VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM>::size(const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM>::copy(const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& src, VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewProperties>::size(const VkPhysicalDeviceMultiviewProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMultiviewProperties>::copy(const VkPhysicalDeviceMultiviewProperties& src, VkPhysicalDeviceMultiviewProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT>::size(const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT>::copy(const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& src, VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT>::size(const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT>::copy(const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& src, VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpacityMicromapFeaturesEXT>::size(const VkPhysicalDeviceOpacityMicromapFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpacityMicromapFeaturesEXT>::copy(const VkPhysicalDeviceOpacityMicromapFeaturesEXT& src, VkPhysicalDeviceOpacityMicromapFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpacityMicromapPropertiesEXT>::size(const VkPhysicalDeviceOpacityMicromapPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpacityMicromapPropertiesEXT>::copy(const VkPhysicalDeviceOpacityMicromapPropertiesEXT& src, VkPhysicalDeviceOpacityMicromapPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpticalFlowFeaturesNV>::size(const VkPhysicalDeviceOpticalFlowFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpticalFlowFeaturesNV>::copy(const VkPhysicalDeviceOpticalFlowFeaturesNV& src, VkPhysicalDeviceOpticalFlowFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpticalFlowPropertiesNV>::size(const VkPhysicalDeviceOpticalFlowPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceOpticalFlowPropertiesNV>::copy(const VkPhysicalDeviceOpticalFlowPropertiesNV& src, VkPhysicalDeviceOpticalFlowPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePCIBusInfoPropertiesEXT>::size(const VkPhysicalDevicePCIBusInfoPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePCIBusInfoPropertiesEXT>::copy(const VkPhysicalDevicePCIBusInfoPropertiesEXT& src, VkPhysicalDevicePCIBusInfoPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT>::size(const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT>::copy(const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& src, VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePerformanceQueryFeaturesKHR>::size(const VkPhysicalDevicePerformanceQueryFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePerformanceQueryFeaturesKHR>::copy(const VkPhysicalDevicePerformanceQueryFeaturesKHR& src, VkPhysicalDevicePerformanceQueryFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePerformanceQueryPropertiesKHR>::size(const VkPhysicalDevicePerformanceQueryPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePerformanceQueryPropertiesKHR>::copy(const VkPhysicalDevicePerformanceQueryPropertiesKHR& src, VkPhysicalDevicePerformanceQueryPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineCreationCacheControlFeatures>::size(const VkPhysicalDevicePipelineCreationCacheControlFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineCreationCacheControlFeatures>::copy(const VkPhysicalDevicePipelineCreationCacheControlFeatures& src, VkPhysicalDevicePipelineCreationCacheControlFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>::size(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>::copy(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& src, VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT>::size(const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT>::copy(const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& src, VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelinePropertiesFeaturesEXT>::size(const VkPhysicalDevicePipelinePropertiesFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelinePropertiesFeaturesEXT>::copy(const VkPhysicalDevicePipelinePropertiesFeaturesEXT& src, VkPhysicalDevicePipelinePropertiesFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineProtectedAccessFeaturesEXT>::size(const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineProtectedAccessFeaturesEXT>::copy(const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& src, VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineRobustnessFeaturesEXT>::size(const VkPhysicalDevicePipelineRobustnessFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineRobustnessFeaturesEXT>::copy(const VkPhysicalDevicePipelineRobustnessFeaturesEXT& src, VkPhysicalDevicePipelineRobustnessFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineRobustnessPropertiesEXT>::size(const VkPhysicalDevicePipelineRobustnessPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePipelineRobustnessPropertiesEXT>::copy(const VkPhysicalDevicePipelineRobustnessPropertiesEXT& src, VkPhysicalDevicePipelineRobustnessPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePointClippingProperties>::size(const VkPhysicalDevicePointClippingProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePointClippingProperties>::copy(const VkPhysicalDevicePointClippingProperties& src, VkPhysicalDevicePointClippingProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkPhysicalDevicePortabilitySubsetFeaturesKHR>::size(const VkPhysicalDevicePortabilitySubsetFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePortabilitySubsetFeaturesKHR>::copy(const VkPhysicalDevicePortabilitySubsetFeaturesKHR& src, VkPhysicalDevicePortabilitySubsetFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkPhysicalDevicePortabilitySubsetPropertiesKHR>::size(const VkPhysicalDevicePortabilitySubsetPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePortabilitySubsetPropertiesKHR>::copy(const VkPhysicalDevicePortabilitySubsetPropertiesKHR& src, VkPhysicalDevicePortabilitySubsetPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkPhysicalDevicePresentBarrierFeaturesNV>::size(const VkPhysicalDevicePresentBarrierFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePresentBarrierFeaturesNV>::copy(const VkPhysicalDevicePresentBarrierFeaturesNV& src, VkPhysicalDevicePresentBarrierFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePresentIdFeaturesKHR>::size(const VkPhysicalDevicePresentIdFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePresentIdFeaturesKHR>::copy(const VkPhysicalDevicePresentIdFeaturesKHR& src, VkPhysicalDevicePresentIdFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePresentWaitFeaturesKHR>::size(const VkPhysicalDevicePresentWaitFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePresentWaitFeaturesKHR>::copy(const VkPhysicalDevicePresentWaitFeaturesKHR& src, VkPhysicalDevicePresentWaitFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>::size(const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>::copy(const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& src, VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>::size(const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>::copy(const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& src, VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePrivateDataFeatures>::size(const VkPhysicalDevicePrivateDataFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePrivateDataFeatures>::copy(const VkPhysicalDevicePrivateDataFeatures& src, VkPhysicalDevicePrivateDataFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProperties2>::size(const VkPhysicalDeviceProperties2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProperties2>::copy(const VkPhysicalDeviceProperties2& src, VkPhysicalDeviceProperties2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProtectedMemoryFeatures>::size(const VkPhysicalDeviceProtectedMemoryFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProtectedMemoryFeatures>::copy(const VkPhysicalDeviceProtectedMemoryFeatures& src, VkPhysicalDeviceProtectedMemoryFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProtectedMemoryProperties>::size(const VkPhysicalDeviceProtectedMemoryProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProtectedMemoryProperties>::copy(const VkPhysicalDeviceProtectedMemoryProperties& src, VkPhysicalDeviceProtectedMemoryProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProvokingVertexFeaturesEXT>::size(const VkPhysicalDeviceProvokingVertexFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProvokingVertexFeaturesEXT>::copy(const VkPhysicalDeviceProvokingVertexFeaturesEXT& src, VkPhysicalDeviceProvokingVertexFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProvokingVertexPropertiesEXT>::size(const VkPhysicalDeviceProvokingVertexPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceProvokingVertexPropertiesEXT>::copy(const VkPhysicalDeviceProvokingVertexPropertiesEXT& src, VkPhysicalDeviceProvokingVertexPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePushDescriptorPropertiesKHR>::size(const VkPhysicalDevicePushDescriptorPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDevicePushDescriptorPropertiesKHR>::copy(const VkPhysicalDevicePushDescriptorPropertiesKHR& src, VkPhysicalDevicePushDescriptorPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>::size(const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>::copy(const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& src, VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT>::size(const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT>::copy(const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& src, VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayQueryFeaturesKHR>::size(const VkPhysicalDeviceRayQueryFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayQueryFeaturesKHR>::copy(const VkPhysicalDeviceRayQueryFeaturesKHR& src, VkPhysicalDeviceRayQueryFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV>::size(const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV>::copy(const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& src, VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV>::size(const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV>::copy(const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& src, VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR>::size(const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR>::copy(const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& src, VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>::size(const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>::copy(const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& src, VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>::size(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>::copy(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& src, VkPhysicalDeviceRayTracingPipelineFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPipelinePropertiesKHR>::size(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPipelinePropertiesKHR>::copy(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& src, VkPhysicalDeviceRayTracingPipelinePropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR>::size(const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR>::copy(const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& src, VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPropertiesNV>::size(const VkPhysicalDeviceRayTracingPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRayTracingPropertiesNV>::copy(const VkPhysicalDeviceRayTracingPropertiesNV& src, VkPhysicalDeviceRayTracingPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV>::size(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV>::copy(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& src, VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRobustness2FeaturesEXT>::size(const VkPhysicalDeviceRobustness2FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRobustness2FeaturesEXT>::copy(const VkPhysicalDeviceRobustness2FeaturesEXT& src, VkPhysicalDeviceRobustness2FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRobustness2PropertiesEXT>::size(const VkPhysicalDeviceRobustness2PropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceRobustness2PropertiesEXT>::copy(const VkPhysicalDeviceRobustness2PropertiesEXT& src, VkPhysicalDeviceRobustness2PropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSampleLocationsPropertiesEXT>::size(const VkPhysicalDeviceSampleLocationsPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSampleLocationsPropertiesEXT>::copy(const VkPhysicalDeviceSampleLocationsPropertiesEXT& src, VkPhysicalDeviceSampleLocationsPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSamplerFilterMinmaxProperties>::size(const VkPhysicalDeviceSamplerFilterMinmaxProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSamplerFilterMinmaxProperties>::copy(const VkPhysicalDeviceSamplerFilterMinmaxProperties& src, VkPhysicalDeviceSamplerFilterMinmaxProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSamplerYcbcrConversionFeatures>::size(const VkPhysicalDeviceSamplerYcbcrConversionFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSamplerYcbcrConversionFeatures>::copy(const VkPhysicalDeviceSamplerYcbcrConversionFeatures& src, VkPhysicalDeviceSamplerYcbcrConversionFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceScalarBlockLayoutFeatures>::size(const VkPhysicalDeviceScalarBlockLayoutFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceScalarBlockLayoutFeatures>::copy(const VkPhysicalDeviceScalarBlockLayoutFeatures& src, VkPhysicalDeviceScalarBlockLayoutFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>::size(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>::copy(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& src, VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>::size(const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>::copy(const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& src, VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>::size(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>::copy(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& src, VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderAtomicInt64Features>::size(const VkPhysicalDeviceShaderAtomicInt64Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderAtomicInt64Features>::copy(const VkPhysicalDeviceShaderAtomicInt64Features& src, VkPhysicalDeviceShaderAtomicInt64Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderClockFeaturesKHR>::size(const VkPhysicalDeviceShaderClockFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderClockFeaturesKHR>::copy(const VkPhysicalDeviceShaderClockFeaturesKHR& src, VkPhysicalDeviceShaderClockFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM>::size(const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM>::copy(const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& src, VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM>::size(const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM>::copy(const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& src, VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCoreProperties2AMD>::size(const VkPhysicalDeviceShaderCoreProperties2AMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCoreProperties2AMD>::copy(const VkPhysicalDeviceShaderCoreProperties2AMD& src, VkPhysicalDeviceShaderCoreProperties2AMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCorePropertiesAMD>::size(const VkPhysicalDeviceShaderCorePropertiesAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCorePropertiesAMD>::copy(const VkPhysicalDeviceShaderCorePropertiesAMD& src, VkPhysicalDeviceShaderCorePropertiesAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCorePropertiesARM>::size(const VkPhysicalDeviceShaderCorePropertiesARM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderCorePropertiesARM>::copy(const VkPhysicalDeviceShaderCorePropertiesARM& src, VkPhysicalDeviceShaderCorePropertiesARM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>::size(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>::copy(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& src, VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderDrawParametersFeatures>::size(const VkPhysicalDeviceShaderDrawParametersFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderDrawParametersFeatures>::copy(const VkPhysicalDeviceShaderDrawParametersFeatures& src, VkPhysicalDeviceShaderDrawParametersFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD>::size(const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD>::copy(const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& src, VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderFloat16Int8Features>::size(const VkPhysicalDeviceShaderFloat16Int8Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderFloat16Int8Features>::copy(const VkPhysicalDeviceShaderFloat16Int8Features& src, VkPhysicalDeviceShaderFloat16Int8Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>::size(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>::copy(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& src, VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderImageFootprintFeaturesNV>::size(const VkPhysicalDeviceShaderImageFootprintFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderImageFootprintFeaturesNV>::copy(const VkPhysicalDeviceShaderImageFootprintFeaturesNV& src, VkPhysicalDeviceShaderImageFootprintFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderIntegerDotProductFeatures>::size(const VkPhysicalDeviceShaderIntegerDotProductFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderIntegerDotProductFeatures>::copy(const VkPhysicalDeviceShaderIntegerDotProductFeatures& src, VkPhysicalDeviceShaderIntegerDotProductFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderIntegerDotProductProperties>::size(const VkPhysicalDeviceShaderIntegerDotProductProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderIntegerDotProductProperties>::copy(const VkPhysicalDeviceShaderIntegerDotProductProperties& src, VkPhysicalDeviceShaderIntegerDotProductProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>::size(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>::copy(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& src, VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT>::size(const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT>::copy(const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& src, VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT>::size(const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT>::copy(const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& src, VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderObjectFeaturesEXT>::size(const VkPhysicalDeviceShaderObjectFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderObjectFeaturesEXT>::copy(const VkPhysicalDeviceShaderObjectFeaturesEXT& src, VkPhysicalDeviceShaderObjectFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderObjectPropertiesEXT>::size(const VkPhysicalDeviceShaderObjectPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderObjectPropertiesEXT>::copy(const VkPhysicalDeviceShaderObjectPropertiesEXT& src, VkPhysicalDeviceShaderObjectPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>::size(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>::copy(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& src, VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV>::size(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV>::copy(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& src, VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>::size(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>::copy(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& src, VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR>::size(const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR>::copy(const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& src, VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderTerminateInvocationFeatures>::size(const VkPhysicalDeviceShaderTerminateInvocationFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderTerminateInvocationFeatures>::copy(const VkPhysicalDeviceShaderTerminateInvocationFeatures& src, VkPhysicalDeviceShaderTerminateInvocationFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderTileImageFeaturesEXT>::size(const VkPhysicalDeviceShaderTileImageFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderTileImageFeaturesEXT>::copy(const VkPhysicalDeviceShaderTileImageFeaturesEXT& src, VkPhysicalDeviceShaderTileImageFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderTileImagePropertiesEXT>::size(const VkPhysicalDeviceShaderTileImagePropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShaderTileImagePropertiesEXT>::copy(const VkPhysicalDeviceShaderTileImagePropertiesEXT& src, VkPhysicalDeviceShaderTileImagePropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShadingRateImageFeaturesNV>::size(const VkPhysicalDeviceShadingRateImageFeaturesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShadingRateImageFeaturesNV>::copy(const VkPhysicalDeviceShadingRateImageFeaturesNV& src, VkPhysicalDeviceShadingRateImageFeaturesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShadingRateImagePropertiesNV>::size(const VkPhysicalDeviceShadingRateImagePropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceShadingRateImagePropertiesNV>::copy(const VkPhysicalDeviceShadingRateImagePropertiesNV& src, VkPhysicalDeviceShadingRateImagePropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSparseImageFormatInfo2>::size(const VkPhysicalDeviceSparseImageFormatInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSparseImageFormatInfo2>::copy(const VkPhysicalDeviceSparseImageFormatInfo2& src, VkPhysicalDeviceSparseImageFormatInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubgroupProperties>::size(const VkPhysicalDeviceSubgroupProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubgroupProperties>::copy(const VkPhysicalDeviceSubgroupProperties& src, VkPhysicalDeviceSubgroupProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubgroupSizeControlFeatures>::size(const VkPhysicalDeviceSubgroupSizeControlFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubgroupSizeControlFeatures>::copy(const VkPhysicalDeviceSubgroupSizeControlFeatures& src, VkPhysicalDeviceSubgroupSizeControlFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubgroupSizeControlProperties>::size(const VkPhysicalDeviceSubgroupSizeControlProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubgroupSizeControlProperties>::copy(const VkPhysicalDeviceSubgroupSizeControlProperties& src, VkPhysicalDeviceSubgroupSizeControlProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT>::size(const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT>::copy(const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& src, VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI>::size(const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI>::copy(const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& src, VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI>::size(const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI>::copy(const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& src, VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSurfaceInfo2KHR>::size(const VkPhysicalDeviceSurfaceInfo2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSurfaceInfo2KHR>::copy(const VkPhysicalDeviceSurfaceInfo2KHR& src, VkPhysicalDeviceSurfaceInfo2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT>::size(const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT>::copy(const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& src, VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSynchronization2Features>::size(const VkPhysicalDeviceSynchronization2Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceSynchronization2Features>::copy(const VkPhysicalDeviceSynchronization2Features& src, VkPhysicalDeviceSynchronization2Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>::size(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>::copy(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& src, VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTexelBufferAlignmentProperties>::size(const VkPhysicalDeviceTexelBufferAlignmentProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTexelBufferAlignmentProperties>::copy(const VkPhysicalDeviceTexelBufferAlignmentProperties& src, VkPhysicalDeviceTexelBufferAlignmentProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>::size(const VkPhysicalDeviceTextureCompressionASTCHDRFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>::copy(const VkPhysicalDeviceTextureCompressionASTCHDRFeatures& src, VkPhysicalDeviceTextureCompressionASTCHDRFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTilePropertiesFeaturesQCOM>::size(const VkPhysicalDeviceTilePropertiesFeaturesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTilePropertiesFeaturesQCOM>::copy(const VkPhysicalDeviceTilePropertiesFeaturesQCOM& src, VkPhysicalDeviceTilePropertiesFeaturesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTimelineSemaphoreFeatures>::size(const VkPhysicalDeviceTimelineSemaphoreFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTimelineSemaphoreFeatures>::copy(const VkPhysicalDeviceTimelineSemaphoreFeatures& src, VkPhysicalDeviceTimelineSemaphoreFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTimelineSemaphoreProperties>::size(const VkPhysicalDeviceTimelineSemaphoreProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTimelineSemaphoreProperties>::copy(const VkPhysicalDeviceTimelineSemaphoreProperties& src, VkPhysicalDeviceTimelineSemaphoreProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceToolProperties>::size(const VkPhysicalDeviceToolProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceToolProperties>::copy(const VkPhysicalDeviceToolProperties& src, VkPhysicalDeviceToolProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTransformFeedbackFeaturesEXT>::size(const VkPhysicalDeviceTransformFeedbackFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTransformFeedbackFeaturesEXT>::copy(const VkPhysicalDeviceTransformFeedbackFeaturesEXT& src, VkPhysicalDeviceTransformFeedbackFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTransformFeedbackPropertiesEXT>::size(const VkPhysicalDeviceTransformFeedbackPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceTransformFeedbackPropertiesEXT>::copy(const VkPhysicalDeviceTransformFeedbackPropertiesEXT& src, VkPhysicalDeviceTransformFeedbackPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>::size(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>::copy(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& src, VkPhysicalDeviceUniformBufferStandardLayoutFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVariablePointersFeatures>::size(const VkPhysicalDeviceVariablePointersFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVariablePointersFeatures>::copy(const VkPhysicalDeviceVariablePointersFeatures& src, VkPhysicalDeviceVariablePointersFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>::size(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>::copy(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& src, VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT>::size(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT>::copy(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& src, VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>::size(const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>::copy(const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& src, VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>::size(const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pVideoProfile, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>::copy(const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& src, VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pVideoProfile = DeepCopyArray(src.pVideoProfile, 1, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVideoFormatInfoKHR>::size(const VkPhysicalDeviceVideoFormatInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVideoFormatInfoKHR>::copy(const VkPhysicalDeviceVideoFormatInfoKHR& src, VkPhysicalDeviceVideoFormatInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan11Features>::size(const VkPhysicalDeviceVulkan11Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan11Features>::copy(const VkPhysicalDeviceVulkan11Features& src, VkPhysicalDeviceVulkan11Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan11Properties>::size(const VkPhysicalDeviceVulkan11Properties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan11Properties>::copy(const VkPhysicalDeviceVulkan11Properties& src, VkPhysicalDeviceVulkan11Properties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan12Features>::size(const VkPhysicalDeviceVulkan12Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan12Features>::copy(const VkPhysicalDeviceVulkan12Features& src, VkPhysicalDeviceVulkan12Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan12Properties>::size(const VkPhysicalDeviceVulkan12Properties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan12Properties>::copy(const VkPhysicalDeviceVulkan12Properties& src, VkPhysicalDeviceVulkan12Properties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan13Features>::size(const VkPhysicalDeviceVulkan13Features& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan13Features>::copy(const VkPhysicalDeviceVulkan13Features& src, VkPhysicalDeviceVulkan13Features& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan13Properties>::size(const VkPhysicalDeviceVulkan13Properties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkan13Properties>::copy(const VkPhysicalDeviceVulkan13Properties& src, VkPhysicalDeviceVulkan13Properties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkanMemoryModelFeatures>::size(const VkPhysicalDeviceVulkanMemoryModelFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceVulkanMemoryModelFeatures>::copy(const VkPhysicalDeviceVulkanMemoryModelFeatures& src, VkPhysicalDeviceVulkanMemoryModelFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>::size(const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>::copy(const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& src, VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT>::size(const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT>::copy(const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& src, VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>::size(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>::copy(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& src, VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>::size(const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>::copy(const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& src, VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCacheCreateInfo>::size(const VkPipelineCacheCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pInitialData, src.initialDataSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCacheCreateInfo>::copy(const VkPipelineCacheCreateInfo& src, VkPipelineCacheCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pInitialData = DeepCopyBytes(src.pInitialData, src.initialDataSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineColorBlendAdvancedStateCreateInfoEXT>::size(const VkPipelineColorBlendAdvancedStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineColorBlendAdvancedStateCreateInfoEXT>::copy(const VkPipelineColorBlendAdvancedStateCreateInfoEXT& src, VkPipelineColorBlendAdvancedStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineColorBlendStateCreateInfo>::size(const VkPipelineColorBlendStateCreateInfo& src, size_t& offset, const DeepCopyGraphicsPipelineState& context) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (!context.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT) || !context.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT) || !context.IsDynamic(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT))
+      DeepCopyArraySize(src.pAttachments, src.attachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineColorBlendStateCreateInfo>::copy(const VkPipelineColorBlendStateCreateInfo& src, VkPipelineColorBlendStateCreateInfo& dst, DeepCopyCursor& cursor, const DeepCopyGraphicsPipelineState& context) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachments = !context.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_ENABLE_EXT) || !context.IsDynamic(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT) || !context.IsDynamic(VK_DYNAMIC_STATE_COLOR_WRITE_MASK_EXT) ? DeepCopyArray(src.pAttachments, src.attachmentCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkPipelineColorWriteCreateInfoEXT>::size(const VkPipelineColorWriteCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pColorWriteEnables, src.attachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineColorWriteCreateInfoEXT>::copy(const VkPipelineColorWriteCreateInfoEXT& src, VkPipelineColorWriteCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pColorWriteEnables = DeepCopyArray(src.pColorWriteEnables, src.attachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCompilerControlCreateInfoAMD>::size(const VkPipelineCompilerControlCreateInfoAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCompilerControlCreateInfoAMD>::copy(const VkPipelineCompilerControlCreateInfoAMD& src, VkPipelineCompilerControlCreateInfoAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCoverageModulationStateCreateInfoNV>::size(const VkPipelineCoverageModulationStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pCoverageModulationTable, src.coverageModulationTableCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCoverageModulationStateCreateInfoNV>::copy(const VkPipelineCoverageModulationStateCreateInfoNV& src, VkPipelineCoverageModulationStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCoverageModulationTable = DeepCopyArray(src.pCoverageModulationTable, src.coverageModulationTableCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCoverageReductionStateCreateInfoNV>::size(const VkPipelineCoverageReductionStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCoverageReductionStateCreateInfoNV>::copy(const VkPipelineCoverageReductionStateCreateInfoNV& src, VkPipelineCoverageReductionStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCoverageToColorStateCreateInfoNV>::size(const VkPipelineCoverageToColorStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCoverageToColorStateCreateInfoNV>::copy(const VkPipelineCoverageToColorStateCreateInfoNV& src, VkPipelineCoverageToColorStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCreationFeedbackCreateInfo>::size(const VkPipelineCreationFeedbackCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPipelineCreationFeedback, 1, offset);
+    DeepCopyArraySize(src.pPipelineStageCreationFeedbacks, src.pipelineStageCreationFeedbackCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineCreationFeedbackCreateInfo>::copy(const VkPipelineCreationFeedbackCreateInfo& src, VkPipelineCreationFeedbackCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPipelineCreationFeedback = DeepCopyArray(src.pPipelineCreationFeedback, 1, cursor);
+    dst.pPipelineStageCreationFeedbacks = DeepCopyArray(src.pPipelineStageCreationFeedbacks, src.pipelineStageCreationFeedbackCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineDepthStencilStateCreateInfo>::size(const VkPipelineDepthStencilStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineDepthStencilStateCreateInfo>::copy(const VkPipelineDepthStencilStateCreateInfo& src, VkPipelineDepthStencilStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineDiscardRectangleStateCreateInfoEXT>::size(const VkPipelineDiscardRectangleStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDiscardRectangles, src.discardRectangleCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineDiscardRectangleStateCreateInfoEXT>::copy(const VkPipelineDiscardRectangleStateCreateInfoEXT& src, VkPipelineDiscardRectangleStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDiscardRectangles = DeepCopyArray(src.pDiscardRectangles, src.discardRectangleCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineDynamicStateCreateInfo>::size(const VkPipelineDynamicStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDynamicStates, src.dynamicStateCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineDynamicStateCreateInfo>::copy(const VkPipelineDynamicStateCreateInfo& src, VkPipelineDynamicStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDynamicStates = DeepCopyArray(src.pDynamicStates, src.dynamicStateCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutableInfoKHR>::size(const VkPipelineExecutableInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutableInfoKHR>::copy(const VkPipelineExecutableInfoKHR& src, VkPipelineExecutableInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutableInternalRepresentationKHR>::size(const VkPipelineExecutableInternalRepresentationKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pData, src.dataSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutableInternalRepresentationKHR>::copy(const VkPipelineExecutableInternalRepresentationKHR& src, VkPipelineExecutableInternalRepresentationKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pData = DeepCopyBytes(src.pData, src.dataSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutablePropertiesKHR>::size(const VkPipelineExecutablePropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutablePropertiesKHR>::copy(const VkPipelineExecutablePropertiesKHR& src, VkPipelineExecutablePropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutableStatisticKHR>::size(const VkPipelineExecutableStatisticKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineExecutableStatisticKHR>::copy(const VkPipelineExecutableStatisticKHR& src, VkPipelineExecutableStatisticKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineFragmentShadingRateEnumStateCreateInfoNV>::size(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineFragmentShadingRateEnumStateCreateInfoNV>::copy(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& src, VkPipelineFragmentShadingRateEnumStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineFragmentShadingRateStateCreateInfoKHR>::size(const VkPipelineFragmentShadingRateStateCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineFragmentShadingRateStateCreateInfoKHR>::copy(const VkPipelineFragmentShadingRateStateCreateInfoKHR& src, VkPipelineFragmentShadingRateStateCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineInfoKHR>::size(const VkPipelineInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineInfoKHR>::copy(const VkPipelineInfoKHR& src, VkPipelineInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineInputAssemblyStateCreateInfo>::size(const VkPipelineInputAssemblyStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineInputAssemblyStateCreateInfo>::copy(const VkPipelineInputAssemblyStateCreateInfo& src, VkPipelineInputAssemblyStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineLayoutCreateInfo>::size(const VkPipelineLayoutCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSetLayouts, src.setLayoutCount, offset);
+    DeepCopyArraySize(src.pPushConstantRanges, src.pushConstantRangeCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineLayoutCreateInfo>::copy(const VkPipelineLayoutCreateInfo& src, VkPipelineLayoutCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSetLayouts = DeepCopyArray(src.pSetLayouts, src.setLayoutCount, cursor);
+    dst.pPushConstantRanges = DeepCopyArray(src.pPushConstantRanges, src.pushConstantRangeCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineLibraryCreateInfoKHR>::size(const VkPipelineLibraryCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pLibraries, src.libraryCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineLibraryCreateInfoKHR>::copy(const VkPipelineLibraryCreateInfoKHR& src, VkPipelineLibraryCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pLibraries = DeepCopyArray(src.pLibraries, src.libraryCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineMultisampleStateCreateInfo>::size(const VkPipelineMultisampleStateCreateInfo& src, size_t& offset, const DeepCopyGraphicsPipelineState& context) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (!context.IsDynamic(VK_DYNAMIC_STATE_SAMPLE_MASK_EXT))
+      DeepCopyArraySize(src.pSampleMask, (src.rasterizationSamples + 31) / 32, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineMultisampleStateCreateInfo>::copy(const VkPipelineMultisampleStateCreateInfo& src, VkPipelineMultisampleStateCreateInfo& dst, DeepCopyCursor& cursor, const DeepCopyGraphicsPipelineState& context) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSampleMask = !context.IsDynamic(VK_DYNAMIC_STATE_SAMPLE_MASK_EXT) ? DeepCopyArray(src.pSampleMask, (src.rasterizationSamples + 31) / 32, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkPipelinePropertiesIdentifierEXT>::size(const VkPipelinePropertiesIdentifierEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelinePropertiesIdentifierEXT>::copy(const VkPipelinePropertiesIdentifierEXT& src, VkPipelinePropertiesIdentifierEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationConservativeStateCreateInfoEXT>::size(const VkPipelineRasterizationConservativeStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationConservativeStateCreateInfoEXT>::copy(const VkPipelineRasterizationConservativeStateCreateInfoEXT& src, VkPipelineRasterizationConservativeStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationDepthClipStateCreateInfoEXT>::size(const VkPipelineRasterizationDepthClipStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationDepthClipStateCreateInfoEXT>::copy(const VkPipelineRasterizationDepthClipStateCreateInfoEXT& src, VkPipelineRasterizationDepthClipStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationLineStateCreateInfoEXT>::size(const VkPipelineRasterizationLineStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationLineStateCreateInfoEXT>::copy(const VkPipelineRasterizationLineStateCreateInfoEXT& src, VkPipelineRasterizationLineStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT>::size(const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT>::copy(const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& src, VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationStateCreateInfo>::size(const VkPipelineRasterizationStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationStateCreateInfo>::copy(const VkPipelineRasterizationStateCreateInfo& src, VkPipelineRasterizationStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationStateRasterizationOrderAMD>::size(const VkPipelineRasterizationStateRasterizationOrderAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationStateRasterizationOrderAMD>::copy(const VkPipelineRasterizationStateRasterizationOrderAMD& src, VkPipelineRasterizationStateRasterizationOrderAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationStateStreamCreateInfoEXT>::size(const VkPipelineRasterizationStateStreamCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRasterizationStateStreamCreateInfoEXT>::copy(const VkPipelineRasterizationStateStreamCreateInfoEXT& src, VkPipelineRasterizationStateStreamCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRenderingCreateInfo>::size(const VkPipelineRenderingCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pColorAttachmentFormats, src.colorAttachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRenderingCreateInfo>::copy(const VkPipelineRenderingCreateInfo& src, VkPipelineRenderingCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pColorAttachmentFormats = DeepCopyArray(src.pColorAttachmentFormats, src.colorAttachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRepresentativeFragmentTestStateCreateInfoNV>::size(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRepresentativeFragmentTestStateCreateInfoNV>::copy(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& src, VkPipelineRepresentativeFragmentTestStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRobustnessCreateInfoEXT>::size(const VkPipelineRobustnessCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineRobustnessCreateInfoEXT>::copy(const VkPipelineRobustnessCreateInfoEXT& src, VkPipelineRobustnessCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineSampleLocationsStateCreateInfoEXT>::size(const VkPipelineSampleLocationsStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkSampleLocationsInfoEXT>::size(src.sampleLocationsInfo, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineSampleLocationsStateCreateInfoEXT>::copy(const VkPipelineSampleLocationsStateCreateInfoEXT& src, VkPipelineSampleLocationsStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkSampleLocationsInfoEXT>::copy(src.sampleLocationsInfo, dst.sampleLocationsInfo, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSpecializationInfo>::size(const VkSpecializationInfo& src, size_t& offset) {
+    DeepCopyArraySize(src.pMapEntries, src.mapEntryCount, offset);
+    DeepCopyBytesSize(src.pData, src.dataSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkSpecializationInfo>::copy(const VkSpecializationInfo& src, VkSpecializationInfo& dst, DeepCopyCursor& cursor) {
+    dst.pMapEntries = DeepCopyArray(src.pMapEntries, src.mapEntryCount, cursor);
+    dst.pData = DeepCopyBytes(src.pData, src.dataSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineShaderStageCreateInfo>::size(const VkPipelineShaderStageCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyStringSize(src.pName, offset);
+    DeepCopyArraySize(src.pSpecializationInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineShaderStageCreateInfo>::copy(const VkPipelineShaderStageCreateInfo& src, VkPipelineShaderStageCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pName = DeepCopyString(src.pName, cursor);
+    dst.pSpecializationInfo = DeepCopyArray(src.pSpecializationInfo, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>::size(const VkPipelineShaderStageModuleIdentifierCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pIdentifier, src.identifierSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>::copy(const VkPipelineShaderStageModuleIdentifierCreateInfoEXT& src, VkPipelineShaderStageModuleIdentifierCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pIdentifier = DeepCopyArray(src.pIdentifier, src.identifierSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo>::size(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo>::copy(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& src, VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineTessellationDomainOriginStateCreateInfo>::size(const VkPipelineTessellationDomainOriginStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineTessellationDomainOriginStateCreateInfo>::copy(const VkPipelineTessellationDomainOriginStateCreateInfo& src, VkPipelineTessellationDomainOriginStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineTessellationStateCreateInfo>::size(const VkPipelineTessellationStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineTessellationStateCreateInfo>::copy(const VkPipelineTessellationStateCreateInfo& src, VkPipelineTessellationStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineVertexInputDivisorStateCreateInfoEXT>::size(const VkPipelineVertexInputDivisorStateCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pVertexBindingDivisors, src.vertexBindingDivisorCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineVertexInputDivisorStateCreateInfoEXT>::copy(const VkPipelineVertexInputDivisorStateCreateInfoEXT& src, VkPipelineVertexInputDivisorStateCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pVertexBindingDivisors = DeepCopyArray(src.pVertexBindingDivisors, src.vertexBindingDivisorCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineVertexInputStateCreateInfo>::size(const VkPipelineVertexInputStateCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pVertexBindingDescriptions, src.vertexBindingDescriptionCount, offset);
+    DeepCopyArraySize(src.pVertexAttributeDescriptions, src.vertexAttributeDescriptionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineVertexInputStateCreateInfo>::copy(const VkPipelineVertexInputStateCreateInfo& src, VkPipelineVertexInputStateCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pVertexBindingDescriptions = DeepCopyArray(src.pVertexBindingDescriptions, src.vertexBindingDescriptionCount, cursor);
+    dst.pVertexAttributeDescriptions = DeepCopyArray(src.pVertexAttributeDescriptions, src.vertexAttributeDescriptionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkCoarseSampleOrderCustomNV>::size(const VkCoarseSampleOrderCustomNV& src, size_t& offset) {
+    DeepCopyArraySize(src.pSampleLocations, src.sampleLocationCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkCoarseSampleOrderCustomNV>::copy(const VkCoarseSampleOrderCustomNV& src, VkCoarseSampleOrderCustomNV& dst, DeepCopyCursor& cursor) {
+    dst.pSampleLocations = DeepCopyArray(src.pSampleLocations, src.sampleLocationCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>::size(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pCustomSampleOrders, src.customSampleOrderCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>::copy(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& src, VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCustomSampleOrders = DeepCopyArray(src.pCustomSampleOrders, src.customSampleOrderCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportDepthClipControlCreateInfoEXT>::size(const VkPipelineViewportDepthClipControlCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportDepthClipControlCreateInfoEXT>::copy(const VkPipelineViewportDepthClipControlCreateInfoEXT& src, VkPipelineViewportDepthClipControlCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportExclusiveScissorStateCreateInfoNV>::size(const VkPipelineViewportExclusiveScissorStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pExclusiveScissors, src.exclusiveScissorCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportExclusiveScissorStateCreateInfoNV>::copy(const VkPipelineViewportExclusiveScissorStateCreateInfoNV& src, VkPipelineViewportExclusiveScissorStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pExclusiveScissors = DeepCopyArray(src.pExclusiveScissors, src.exclusiveScissorCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkShadingRatePaletteNV>::size(const VkShadingRatePaletteNV& src, size_t& offset) {
+    DeepCopyArraySize(src.pShadingRatePaletteEntries, src.shadingRatePaletteEntryCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkShadingRatePaletteNV>::copy(const VkShadingRatePaletteNV& src, VkShadingRatePaletteNV& dst, DeepCopyCursor& cursor) {
+    dst.pShadingRatePaletteEntries = DeepCopyArray(src.pShadingRatePaletteEntries, src.shadingRatePaletteEntryCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportShadingRateImageStateCreateInfoNV>::size(const VkPipelineViewportShadingRateImageStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pShadingRatePalettes, src.viewportCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportShadingRateImageStateCreateInfoNV>::copy(const VkPipelineViewportShadingRateImageStateCreateInfoNV& src, VkPipelineViewportShadingRateImageStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pShadingRatePalettes = DeepCopyArray(src.pShadingRatePalettes, src.viewportCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportStateCreateInfo>::size(const VkPipelineViewportStateCreateInfo& src, size_t& offset, const DeepCopyGraphicsPipelineState& context) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (!context.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT) && !context.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT))
+      DeepCopyArraySize(src.pViewports, src.viewportCount, offset);
+    if (!context.IsDynamic(VK_DYNAMIC_STATE_SCISSOR) && !context.IsDynamic(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT))
+      DeepCopyArraySize(src.pScissors, src.scissorCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportStateCreateInfo>::copy(const VkPipelineViewportStateCreateInfo& src, VkPipelineViewportStateCreateInfo& dst, DeepCopyCursor& cursor, const DeepCopyGraphicsPipelineState& context) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewports = !context.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT) && !context.IsDynamic(VK_DYNAMIC_STATE_VIEWPORT_WITH_COUNT) ? DeepCopyArray(src.pViewports, src.viewportCount, cursor) : nullptr;
+    dst.pScissors = !context.IsDynamic(VK_DYNAMIC_STATE_SCISSOR) && !context.IsDynamic(VK_DYNAMIC_STATE_SCISSOR_WITH_COUNT) ? DeepCopyArray(src.pScissors, src.scissorCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportSwizzleStateCreateInfoNV>::size(const VkPipelineViewportSwizzleStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pViewportSwizzles, src.viewportCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportSwizzleStateCreateInfoNV>::copy(const VkPipelineViewportSwizzleStateCreateInfoNV& src, VkPipelineViewportSwizzleStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewportSwizzles = DeepCopyArray(src.pViewportSwizzles, src.viewportCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportWScalingStateCreateInfoNV>::size(const VkPipelineViewportWScalingStateCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pViewportWScalings, src.viewportCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPipelineViewportWScalingStateCreateInfoNV>::copy(const VkPipelineViewportWScalingStateCreateInfoNV& src, VkPipelineViewportWScalingStateCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewportWScalings = DeepCopyArray(src.pViewportWScalings, src.viewportCount, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_GGP
+  inline void DeepCopyTraits<VkPresentFrameTokenGGP>::size(const VkPresentFrameTokenGGP& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPresentFrameTokenGGP>::copy(const VkPresentFrameTokenGGP& src, VkPresentFrameTokenGGP& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkPresentIdKHR>::size(const VkPresentIdKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPresentIds, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPresentIdKHR>::copy(const VkPresentIdKHR& src, VkPresentIdKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPresentIds = DeepCopyArray(src.pPresentIds, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPresentInfoKHR>::size(const VkPresentInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphores, src.waitSemaphoreCount, offset);
+    DeepCopyArraySize(src.pSwapchains, src.swapchainCount, offset);
+    DeepCopyArraySize(src.pImageIndices, src.swapchainCount, offset);
+    DeepCopyArraySize(src.pResults, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPresentInfoKHR>::copy(const VkPresentInfoKHR& src, VkPresentInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphores = DeepCopyArray(src.pWaitSemaphores, src.waitSemaphoreCount, cursor);
+    dst.pSwapchains = DeepCopyArray(src.pSwapchains, src.swapchainCount, cursor);
+    dst.pImageIndices = DeepCopyArray(src.pImageIndices, src.swapchainCount, cursor);
+    dst.pResults = DeepCopyArray(src.pResults, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPresentRegionKHR>::size(const VkPresentRegionKHR& src, size_t& offset) {
+    DeepCopyArraySize(src.pRectangles, src.rectangleCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPresentRegionKHR>::copy(const VkPresentRegionKHR& src, VkPresentRegionKHR& dst, DeepCopyCursor& cursor) {
+    dst.pRectangles = DeepCopyArray(src.pRectangles, src.rectangleCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPresentRegionsKHR>::size(const VkPresentRegionsKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPresentRegionsKHR>::copy(const VkPresentRegionsKHR& src, VkPresentRegionsKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPresentTimesInfoGOOGLE>::size(const VkPresentTimesInfoGOOGLE& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pTimes, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkPresentTimesInfoGOOGLE>::copy(const VkPresentTimesInfoGOOGLE& src, VkPresentTimesInfoGOOGLE& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pTimes = DeepCopyArray(src.pTimes, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkPrivateDataSlotCreateInfo>::size(const VkPrivateDataSlotCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkPrivateDataSlotCreateInfo>::copy(const VkPrivateDataSlotCreateInfo& src, VkPrivateDataSlotCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkProtectedSubmitInfo>::size(const VkProtectedSubmitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkProtectedSubmitInfo>::copy(const VkProtectedSubmitInfo& src, VkProtectedSubmitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueryLowLatencySupportNV>::size(const VkQueryLowLatencySupportNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueryLowLatencySupportNV>::copy(const VkQueryLowLatencySupportNV& src, VkQueryLowLatencySupportNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolCreateInfo>::size(const VkQueryPoolCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolCreateInfo>::copy(const VkQueryPoolCreateInfo& src, VkQueryPoolCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolPerformanceCreateInfoKHR>::size(const VkQueryPoolPerformanceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pCounterIndices, src.counterIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolPerformanceCreateInfoKHR>::copy(const VkQueryPoolPerformanceCreateInfoKHR& src, VkQueryPoolPerformanceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCounterIndices = DeepCopyArray(src.pCounterIndices, src.counterIndexCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolPerformanceQueryCreateInfoINTEL>::size(const VkQueryPoolPerformanceQueryCreateInfoINTEL& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolPerformanceQueryCreateInfoINTEL>::copy(const VkQueryPoolPerformanceQueryCreateInfoINTEL& src, VkQueryPoolPerformanceQueryCreateInfoINTEL& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkQueryPoolVideoEncodeFeedbackCreateInfoKHR>::size(const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueryPoolVideoEncodeFeedbackCreateInfoKHR>::copy(const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& src, VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkQueueFamilyCheckpointProperties2NV>::size(const VkQueueFamilyCheckpointProperties2NV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyCheckpointProperties2NV>::copy(const VkQueueFamilyCheckpointProperties2NV& src, VkQueueFamilyCheckpointProperties2NV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyCheckpointPropertiesNV>::size(const VkQueueFamilyCheckpointPropertiesNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyCheckpointPropertiesNV>::copy(const VkQueueFamilyCheckpointPropertiesNV& src, VkQueueFamilyCheckpointPropertiesNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyGlobalPriorityPropertiesKHR>::size(const VkQueueFamilyGlobalPriorityPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyGlobalPriorityPropertiesKHR>::copy(const VkQueueFamilyGlobalPriorityPropertiesKHR& src, VkQueueFamilyGlobalPriorityPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyProperties2>::size(const VkQueueFamilyProperties2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyProperties2>::copy(const VkQueueFamilyProperties2& src, VkQueueFamilyProperties2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyQueryResultStatusPropertiesKHR>::size(const VkQueueFamilyQueryResultStatusPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyQueryResultStatusPropertiesKHR>::copy(const VkQueueFamilyQueryResultStatusPropertiesKHR& src, VkQueueFamilyQueryResultStatusPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyVideoPropertiesKHR>::size(const VkQueueFamilyVideoPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkQueueFamilyVideoPropertiesKHR>::copy(const VkQueueFamilyVideoPropertiesKHR& src, VkQueueFamilyVideoPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingPipelineCreateInfoKHR>::size(const VkRayTracingPipelineCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pStages, src.stageCount, offset);
+    DeepCopyArraySize(src.pGroups, src.groupCount, offset);
+    DeepCopyArraySize(src.pLibraryInfo, 1, offset);
+    DeepCopyArraySize(src.pLibraryInterface, 1, offset);
+    DeepCopyArraySize(src.pDynamicState, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingPipelineCreateInfoKHR>::copy(const VkRayTracingPipelineCreateInfoKHR& src, VkRayTracingPipelineCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pStages = DeepCopyArray(src.pStages, src.stageCount, cursor);
+    dst.pGroups = DeepCopyArray(src.pGroups, src.groupCount, cursor);
+    dst.pLibraryInfo = DeepCopyArray(src.pLibraryInfo, 1, cursor);
+    dst.pLibraryInterface = DeepCopyArray(src.pLibraryInterface, 1, cursor);
+    dst.pDynamicState = DeepCopyArray(src.pDynamicState, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingPipelineCreateInfoNV>::size(const VkRayTracingPipelineCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pStages, src.stageCount, offset);
+    DeepCopyArraySize(src.pGroups, src.groupCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingPipelineCreateInfoNV>::copy(const VkRayTracingPipelineCreateInfoNV& src, VkRayTracingPipelineCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pStages = DeepCopyArray(src.pStages, src.stageCount, cursor);
+    dst.pGroups = DeepCopyArray(src.pGroups, src.groupCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingPipelineInterfaceCreateInfoKHR>::size(const VkRayTracingPipelineInterfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingPipelineInterfaceCreateInfoKHR>::copy(const VkRayTracingPipelineInterfaceCreateInfoKHR& src, VkRayTracingPipelineInterfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingShaderGroupCreateInfoKHR>::size(const VkRayTracingShaderGroupCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingShaderGroupCreateInfoKHR>::copy(const VkRayTracingShaderGroupCreateInfoKHR& src, VkRayTracingShaderGroupCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingShaderGroupCreateInfoNV>::size(const VkRayTracingShaderGroupCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRayTracingShaderGroupCreateInfoNV>::copy(const VkRayTracingShaderGroupCreateInfoNV& src, VkRayTracingShaderGroupCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkReleaseSwapchainImagesInfoEXT>::size(const VkReleaseSwapchainImagesInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pImageIndices, src.imageIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkReleaseSwapchainImagesInfoEXT>::copy(const VkReleaseSwapchainImagesInfoEXT& src, VkReleaseSwapchainImagesInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pImageIndices = DeepCopyArray(src.pImageIndices, src.imageIndexCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassAttachmentBeginInfo>::size(const VkRenderPassAttachmentBeginInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAttachments, src.attachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassAttachmentBeginInfo>::copy(const VkRenderPassAttachmentBeginInfo& src, VkRenderPassAttachmentBeginInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachments = DeepCopyArray(src.pAttachments, src.attachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassBeginInfo>::size(const VkRenderPassBeginInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pClearValues, src.clearValueCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassBeginInfo>::copy(const VkRenderPassBeginInfo& src, VkRenderPassBeginInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pClearValues = DeepCopyArray(src.pClearValues, src.clearValueCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDescription>::size(const VkSubpassDescription& src, size_t& offset) {
+    DeepCopyArraySize(src.pInputAttachments, src.inputAttachmentCount, offset);
+    DeepCopyArraySize(src.pColorAttachments, src.colorAttachmentCount, offset);
+    DeepCopyArraySize(src.pResolveAttachments, src.colorAttachmentCount, offset);
+    DeepCopyArraySize(src.pDepthStencilAttachment, 1, offset);
+    DeepCopyArraySize(src.pPreserveAttachments, src.preserveAttachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDescription>::copy(const VkSubpassDescription& src, VkSubpassDescription& dst, DeepCopyCursor& cursor) {
+    dst.pInputAttachments = DeepCopyArray(src.pInputAttachments, src.inputAttachmentCount, cursor);
+    dst.pColorAttachments = DeepCopyArray(src.pColorAttachments, src.colorAttachmentCount, cursor);
+    dst.pResolveAttachments = DeepCopyArray(src.pResolveAttachments, src.colorAttachmentCount, cursor);
+    dst.pDepthStencilAttachment = DeepCopyArray(src.pDepthStencilAttachment, 1, cursor);
+    dst.pPreserveAttachments = DeepCopyArray(src.pPreserveAttachments, src.preserveAttachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreateInfo>::size(const VkRenderPassCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAttachments, src.attachmentCount, offset);
+    DeepCopyArraySize(src.pSubpasses, src.subpassCount, offset);
+    DeepCopyArraySize(src.pDependencies, src.dependencyCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreateInfo>::copy(const VkRenderPassCreateInfo& src, VkRenderPassCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachments = DeepCopyArray(src.pAttachments, src.attachmentCount, cursor);
+    dst.pSubpasses = DeepCopyArray(src.pSubpasses, src.subpassCount, cursor);
+    dst.pDependencies = DeepCopyArray(src.pDependencies, src.dependencyCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreateInfo2>::size(const VkRenderPassCreateInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAttachments, src.attachmentCount, offset);
+    DeepCopyArraySize(src.pSubpasses, src.subpassCount, offset);
+    DeepCopyArraySize(src.pDependencies, src.dependencyCount, offset);
+    DeepCopyArraySize(src.pCorrelatedViewMasks, src.correlatedViewMaskCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreateInfo2>::copy(const VkRenderPassCreateInfo2& src, VkRenderPassCreateInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachments = DeepCopyArray(src.pAttachments, src.attachmentCount, cursor);
+    dst.pSubpasses = DeepCopyArray(src.pSubpasses, src.subpassCount, cursor);
+    dst.pDependencies = DeepCopyArray(src.pDependencies, src.dependencyCount, cursor);
+    dst.pCorrelatedViewMasks = DeepCopyArray(src.pCorrelatedViewMasks, src.correlatedViewMaskCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreationControlEXT>::size(const VkRenderPassCreationControlEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreationControlEXT>::copy(const VkRenderPassCreationControlEXT& src, VkRenderPassCreationControlEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreationFeedbackCreateInfoEXT>::size(const VkRenderPassCreationFeedbackCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRenderPassFeedback, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassCreationFeedbackCreateInfoEXT>::copy(const VkRenderPassCreationFeedbackCreateInfoEXT& src, VkRenderPassCreationFeedbackCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRenderPassFeedback = DeepCopyArray(src.pRenderPassFeedback, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassFragmentDensityMapCreateInfoEXT>::size(const VkRenderPassFragmentDensityMapCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassFragmentDensityMapCreateInfoEXT>::copy(const VkRenderPassFragmentDensityMapCreateInfoEXT& src, VkRenderPassFragmentDensityMapCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassInputAttachmentAspectCreateInfo>::size(const VkRenderPassInputAttachmentAspectCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAspectReferences, src.aspectReferenceCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassInputAttachmentAspectCreateInfo>::copy(const VkRenderPassInputAttachmentAspectCreateInfo& src, VkRenderPassInputAttachmentAspectCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAspectReferences = DeepCopyArray(src.pAspectReferences, src.aspectReferenceCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassMultiviewCreateInfo>::size(const VkRenderPassMultiviewCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pViewMasks, src.subpassCount, offset);
+    DeepCopyArraySize(src.pViewOffsets, src.dependencyCount, offset);
+    DeepCopyArraySize(src.pCorrelationMasks, src.correlationMaskCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassMultiviewCreateInfo>::copy(const VkRenderPassMultiviewCreateInfo& src, VkRenderPassMultiviewCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pViewMasks = DeepCopyArray(src.pViewMasks, src.subpassCount, cursor);
+    dst.pViewOffsets = DeepCopyArray(src.pViewOffsets, src.dependencyCount, cursor);
+    dst.pCorrelationMasks = DeepCopyArray(src.pCorrelationMasks, src.correlationMaskCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentSampleLocationsEXT>::size(const VkAttachmentSampleLocationsEXT& src, size_t& offset) {
+    DeepCopyTraits<VkSampleLocationsInfoEXT>::size(src.sampleLocationsInfo, offset);
+  }
+
+  inline void DeepCopyTraits<VkAttachmentSampleLocationsEXT>::copy(const VkAttachmentSampleLocationsEXT& src, VkAttachmentSampleLocationsEXT& dst, DeepCopyCursor& cursor) {
+    DeepCopyTraits<VkSampleLocationsInfoEXT>::copy(src.sampleLocationsInfo, dst.sampleLocationsInfo, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassSampleLocationsEXT>::size(const VkSubpassSampleLocationsEXT& src, size_t& offset) {
+    DeepCopyTraits<VkSampleLocationsInfoEXT>::size(src.sampleLocationsInfo, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassSampleLocationsEXT>::copy(const VkSubpassSampleLocationsEXT& src, VkSubpassSampleLocationsEXT& dst, DeepCopyCursor& cursor) {
+    DeepCopyTraits<VkSampleLocationsInfoEXT>::copy(src.sampleLocationsInfo, dst.sampleLocationsInfo, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassSampleLocationsBeginInfoEXT>::size(const VkRenderPassSampleLocationsBeginInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAttachmentInitialSampleLocations, src.attachmentInitialSampleLocationsCount, offset);
+    DeepCopyArraySize(src.pPostSubpassSampleLocations, src.postSubpassSampleLocationsCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassSampleLocationsBeginInfoEXT>::copy(const VkRenderPassSampleLocationsBeginInfoEXT& src, VkRenderPassSampleLocationsBeginInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAttachmentInitialSampleLocations = DeepCopyArray(src.pAttachmentInitialSampleLocations, src.attachmentInitialSampleLocationsCount, cursor);
+    dst.pPostSubpassSampleLocations = DeepCopyArray(src.pPostSubpassSampleLocations, src.postSubpassSampleLocationsCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassSubpassFeedbackCreateInfoEXT>::size(const VkRenderPassSubpassFeedbackCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSubpassFeedback, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassSubpassFeedbackCreateInfoEXT>::copy(const VkRenderPassSubpassFeedbackCreateInfoEXT& src, VkRenderPassSubpassFeedbackCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSubpassFeedback = DeepCopyArray(src.pSubpassFeedback, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassTransformBeginInfoQCOM>::size(const VkRenderPassTransformBeginInfoQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderPassTransformBeginInfoQCOM>::copy(const VkRenderPassTransformBeginInfoQCOM& src, VkRenderPassTransformBeginInfoQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderingAttachmentInfo>::size(const VkRenderingAttachmentInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderingAttachmentInfo>::copy(const VkRenderingAttachmentInfo& src, VkRenderingAttachmentInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderingFragmentDensityMapAttachmentInfoEXT>::size(const VkRenderingFragmentDensityMapAttachmentInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderingFragmentDensityMapAttachmentInfoEXT>::copy(const VkRenderingFragmentDensityMapAttachmentInfoEXT& src, VkRenderingFragmentDensityMapAttachmentInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderingFragmentShadingRateAttachmentInfoKHR>::size(const VkRenderingFragmentShadingRateAttachmentInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderingFragmentShadingRateAttachmentInfoKHR>::copy(const VkRenderingFragmentShadingRateAttachmentInfoKHR& src, VkRenderingFragmentShadingRateAttachmentInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkRenderingInfo>::size(const VkRenderingInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pColorAttachments, src.colorAttachmentCount, offset);
+    DeepCopyArraySize(src.pDepthAttachment, 1, offset);
+    DeepCopyArraySize(src.pStencilAttachment, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkRenderingInfo>::copy(const VkRenderingInfo& src, VkRenderingInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pColorAttachments = DeepCopyArray(src.pColorAttachments, src.colorAttachmentCount, cursor);
+    dst.pDepthAttachment = DeepCopyArray(src.pDepthAttachment, 1, cursor);
+    dst.pStencilAttachment = DeepCopyArray(src.pStencilAttachment, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkResolveImageInfo2>::size(const VkResolveImageInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pRegions, src.regionCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkResolveImageInfo2>::copy(const VkResolveImageInfo2& src, VkResolveImageInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pRegions = DeepCopyArray(src.pRegions, src.regionCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSampleLocationsInfoEXT>::size(const VkSampleLocationsInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSampleLocations, src.sampleLocationsCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSampleLocationsInfoEXT>::copy(const VkSampleLocationsInfoEXT& src, VkSampleLocationsInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSampleLocations = DeepCopyArray(src.pSampleLocations, src.sampleLocationsCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerBorderColorComponentMappingCreateInfoEXT>::size(const VkSamplerBorderColorComponentMappingCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerBorderColorComponentMappingCreateInfoEXT>::copy(const VkSamplerBorderColorComponentMappingCreateInfoEXT& src, VkSamplerBorderColorComponentMappingCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerCaptureDescriptorDataInfoEXT>::size(const VkSamplerCaptureDescriptorDataInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerCaptureDescriptorDataInfoEXT>::copy(const VkSamplerCaptureDescriptorDataInfoEXT& src, VkSamplerCaptureDescriptorDataInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerCreateInfo>::size(const VkSamplerCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerCreateInfo>::copy(const VkSamplerCreateInfo& src, VkSamplerCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerCustomBorderColorCreateInfoEXT>::size(const VkSamplerCustomBorderColorCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerCustomBorderColorCreateInfoEXT>::copy(const VkSamplerCustomBorderColorCreateInfoEXT& src, VkSamplerCustomBorderColorCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerReductionModeCreateInfo>::size(const VkSamplerReductionModeCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerReductionModeCreateInfo>::copy(const VkSamplerReductionModeCreateInfo& src, VkSamplerReductionModeCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerYcbcrConversionCreateInfo>::size(const VkSamplerYcbcrConversionCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerYcbcrConversionCreateInfo>::copy(const VkSamplerYcbcrConversionCreateInfo& src, VkSamplerYcbcrConversionCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerYcbcrConversionImageFormatProperties>::size(const VkSamplerYcbcrConversionImageFormatProperties& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerYcbcrConversionImageFormatProperties>::copy(const VkSamplerYcbcrConversionImageFormatProperties& src, VkSamplerYcbcrConversionImageFormatProperties& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSamplerYcbcrConversionInfo>::size(const VkSamplerYcbcrConversionInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSamplerYcbcrConversionInfo>::copy(const VkSamplerYcbcrConversionInfo& src, VkSamplerYcbcrConversionInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+  inline void DeepCopyTraits<VkScreenSurfaceCreateInfoQNX>::size(const VkScreenSurfaceCreateInfoQNX& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkScreenSurfaceCreateInfoQNX>::copy(const VkScreenSurfaceCreateInfoQNX& src, VkScreenSurfaceCreateInfoQNX& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkSemaphoreCreateInfo>::size(const VkSemaphoreCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreCreateInfo>::copy(const VkSemaphoreCreateInfo& src, VkSemaphoreCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreGetFdInfoKHR>::size(const VkSemaphoreGetFdInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreGetFdInfoKHR>::copy(const VkSemaphoreGetFdInfoKHR& src, VkSemaphoreGetFdInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkSemaphoreGetWin32HandleInfoKHR>::size(const VkSemaphoreGetWin32HandleInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreGetWin32HandleInfoKHR>::copy(const VkSemaphoreGetWin32HandleInfoKHR& src, VkSemaphoreGetWin32HandleInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkSemaphoreGetZirconHandleInfoFUCHSIA>::size(const VkSemaphoreGetZirconHandleInfoFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreGetZirconHandleInfoFUCHSIA>::copy(const VkSemaphoreGetZirconHandleInfoFUCHSIA& src, VkSemaphoreGetZirconHandleInfoFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkSemaphoreSignalInfo>::size(const VkSemaphoreSignalInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreSignalInfo>::copy(const VkSemaphoreSignalInfo& src, VkSemaphoreSignalInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreSubmitInfo>::size(const VkSemaphoreSubmitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreSubmitInfo>::copy(const VkSemaphoreSubmitInfo& src, VkSemaphoreSubmitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreTypeCreateInfo>::size(const VkSemaphoreTypeCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreTypeCreateInfo>::copy(const VkSemaphoreTypeCreateInfo& src, VkSemaphoreTypeCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreWaitInfo>::size(const VkSemaphoreWaitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSemaphores, src.semaphoreCount, offset);
+    DeepCopyArraySize(src.pValues, src.semaphoreCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSemaphoreWaitInfo>::copy(const VkSemaphoreWaitInfo& src, VkSemaphoreWaitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSemaphores = DeepCopyArray(src.pSemaphores, src.semaphoreCount, cursor);
+    dst.pValues = DeepCopyArray(src.pValues, src.semaphoreCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkShaderCreateInfoEXT>::size(const VkShaderCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pCode, src.codeSize, offset);
+    DeepCopyStringSize(src.pName, offset);
+    DeepCopyArraySize(src.pSetLayouts, src.setLayoutCount, offset);
+    DeepCopyArraySize(src.pPushConstantRanges, src.pushConstantRangeCount, offset);
+    DeepCopyArraySize(src.pSpecializationInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkShaderCreateInfoEXT>::copy(const VkShaderCreateInfoEXT& src, VkShaderCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCode = DeepCopyBytes(src.pCode, src.codeSize, cursor);
+    dst.pName = DeepCopyString(src.pName, cursor);
+    dst.pSetLayouts = DeepCopyArray(src.pSetLayouts, src.setLayoutCount, cursor);
+    dst.pPushConstantRanges = DeepCopyArray(src.pPushConstantRanges, src.pushConstantRangeCount, cursor);
+    dst.pSpecializationInfo = DeepCopyArray(src.pSpecializationInfo, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkShaderModuleCreateInfo>::size(const VkShaderModuleCreateInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pCode, src.codeSize / 4, offset);
+  }
+
+  inline void DeepCopyTraits<VkShaderModuleCreateInfo>::copy(const VkShaderModuleCreateInfo& src, VkShaderModuleCreateInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pCode = DeepCopyArray(src.pCode, src.codeSize / 4, cursor);
+  }
+
+  inline void DeepCopyTraits<VkShaderModuleIdentifierEXT>::size(const VkShaderModuleIdentifierEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkShaderModuleIdentifierEXT>::copy(const VkShaderModuleIdentifierEXT& src, VkShaderModuleIdentifierEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkShaderModuleValidationCacheCreateInfoEXT>::size(const VkShaderModuleValidationCacheCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkShaderModuleValidationCacheCreateInfoEXT>::copy(const VkShaderModuleValidationCacheCreateInfoEXT& src, VkShaderModuleValidationCacheCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSharedPresentSurfaceCapabilitiesKHR>::size(const VkSharedPresentSurfaceCapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSharedPresentSurfaceCapabilitiesKHR>::copy(const VkSharedPresentSurfaceCapabilitiesKHR& src, VkSharedPresentSurfaceCapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageFormatProperties2>::size(const VkSparseImageFormatProperties2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageFormatProperties2>::copy(const VkSparseImageFormatProperties2& src, VkSparseImageFormatProperties2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageMemoryRequirements2>::size(const VkSparseImageMemoryRequirements2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSparseImageMemoryRequirements2>::copy(const VkSparseImageMemoryRequirements2& src, VkSparseImageMemoryRequirements2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_GGP
+  inline void DeepCopyTraits<VkStreamDescriptorSurfaceCreateInfoGGP>::size(const VkStreamDescriptorSurfaceCreateInfoGGP& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkStreamDescriptorSurfaceCreateInfoGGP>::copy(const VkStreamDescriptorSurfaceCreateInfoGGP& src, VkStreamDescriptorSurfaceCreateInfoGGP& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkSubmitInfo>::size(const VkSubmitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphores, src.waitSemaphoreCount, offset);
+    DeepCopyArraySize(src.pWaitDstStageMask, src.waitSemaphoreCount, offset);
+    DeepCopyArraySize(src.pCommandBuffers, src.commandBufferCount, offset);
+    DeepCopyArraySize(src.pSignalSemaphores, src.signalSemaphoreCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubmitInfo>::copy(const VkSubmitInfo& src, VkSubmitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphores = DeepCopyArray(src.pWaitSemaphores, src.waitSemaphoreCount, cursor);
+    dst.pWaitDstStageMask = DeepCopyArray(src.pWaitDstStageMask, src.waitSemaphoreCount, cursor);
+    dst.pCommandBuffers = DeepCopyArray(src.pCommandBuffers, src.commandBufferCount, cursor);
+    dst.pSignalSemaphores = DeepCopyArray(src.pSignalSemaphores, src.signalSemaphoreCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubmitInfo2>::size(const VkSubmitInfo2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphoreInfos, src.waitSemaphoreInfoCount, offset);
+    DeepCopyArraySize(src.pCommandBufferInfos, src.commandBufferInfoCount, offset);
+    DeepCopyArraySize(src.pSignalSemaphoreInfos, src.signalSemaphoreInfoCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubmitInfo2>::copy(const VkSubmitInfo2& src, VkSubmitInfo2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphoreInfos = DeepCopyArray(src.pWaitSemaphoreInfos, src.waitSemaphoreInfoCount, cursor);
+    dst.pCommandBufferInfos = DeepCopyArray(src.pCommandBufferInfos, src.commandBufferInfoCount, cursor);
+    dst.pSignalSemaphoreInfos = DeepCopyArray(src.pSignalSemaphoreInfos, src.signalSemaphoreInfoCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassBeginInfo>::size(const VkSubpassBeginInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassBeginInfo>::copy(const VkSubpassBeginInfo& src, VkSubpassBeginInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDependency2>::size(const VkSubpassDependency2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDependency2>::copy(const VkSubpassDependency2& src, VkSubpassDependency2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDescription2>::size(const VkSubpassDescription2& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pInputAttachments, src.inputAttachmentCount, offset);
+    DeepCopyArraySize(src.pColorAttachments, src.colorAttachmentCount, offset);
+    DeepCopyArraySize(src.pResolveAttachments, src.colorAttachmentCount, offset);
+    DeepCopyArraySize(src.pDepthStencilAttachment, 1, offset);
+    DeepCopyArraySize(src.pPreserveAttachments, src.preserveAttachmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDescription2>::copy(const VkSubpassDescription2& src, VkSubpassDescription2& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pInputAttachments = DeepCopyArray(src.pInputAttachments, src.inputAttachmentCount, cursor);
+    dst.pColorAttachments = DeepCopyArray(src.pColorAttachments, src.colorAttachmentCount, cursor);
+    dst.pResolveAttachments = DeepCopyArray(src.pResolveAttachments, src.colorAttachmentCount, cursor);
+    dst.pDepthStencilAttachment = DeepCopyArray(src.pDepthStencilAttachment, 1, cursor);
+    dst.pPreserveAttachments = DeepCopyArray(src.pPreserveAttachments, src.preserveAttachmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDescriptionDepthStencilResolve>::size(const VkSubpassDescriptionDepthStencilResolve& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDepthStencilResolveAttachment, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassDescriptionDepthStencilResolve>::copy(const VkSubpassDescriptionDepthStencilResolve& src, VkSubpassDescriptionDepthStencilResolve& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDepthStencilResolveAttachment = DeepCopyArray(src.pDepthStencilResolveAttachment, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassEndInfo>::size(const VkSubpassEndInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassEndInfo>::copy(const VkSubpassEndInfo& src, VkSubpassEndInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassFragmentDensityMapOffsetEndInfoQCOM>::size(const VkSubpassFragmentDensityMapOffsetEndInfoQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pFragmentDensityOffsets, src.fragmentDensityOffsetCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassFragmentDensityMapOffsetEndInfoQCOM>::copy(const VkSubpassFragmentDensityMapOffsetEndInfoQCOM& src, VkSubpassFragmentDensityMapOffsetEndInfoQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pFragmentDensityOffsets = DeepCopyArray(src.pFragmentDensityOffsets, src.fragmentDensityOffsetCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassResolvePerformanceQueryEXT>::size(const VkSubpassResolvePerformanceQueryEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassResolvePerformanceQueryEXT>::copy(const VkSubpassResolvePerformanceQueryEXT& src, VkSubpassResolvePerformanceQueryEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubpassShadingPipelineCreateInfoHUAWEI>::size(const VkSubpassShadingPipelineCreateInfoHUAWEI& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubpassShadingPipelineCreateInfoHUAWEI>::copy(const VkSubpassShadingPipelineCreateInfoHUAWEI& src, VkSubpassShadingPipelineCreateInfoHUAWEI& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSubresourceLayout2EXT>::size(const VkSubresourceLayout2EXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSubresourceLayout2EXT>::copy(const VkSubresourceLayout2EXT& src, VkSubresourceLayout2EXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceCapabilities2EXT>::size(const VkSurfaceCapabilities2EXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceCapabilities2EXT>::copy(const VkSurfaceCapabilities2EXT& src, VkSurfaceCapabilities2EXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceCapabilities2KHR>::size(const VkSurfaceCapabilities2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceCapabilities2KHR>::copy(const VkSurfaceCapabilities2KHR& src, VkSurfaceCapabilities2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkSurfaceCapabilitiesFullScreenExclusiveEXT>::size(const VkSurfaceCapabilitiesFullScreenExclusiveEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceCapabilitiesFullScreenExclusiveEXT>::copy(const VkSurfaceCapabilitiesFullScreenExclusiveEXT& src, VkSurfaceCapabilitiesFullScreenExclusiveEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkSurfaceCapabilitiesPresentBarrierNV>::size(const VkSurfaceCapabilitiesPresentBarrierNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceCapabilitiesPresentBarrierNV>::copy(const VkSurfaceCapabilitiesPresentBarrierNV& src, VkSurfaceCapabilitiesPresentBarrierNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceFormat2KHR>::size(const VkSurfaceFormat2KHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceFormat2KHR>::copy(const VkSurfaceFormat2KHR& src, VkSurfaceFormat2KHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkSurfaceFullScreenExclusiveInfoEXT>::size(const VkSurfaceFullScreenExclusiveInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceFullScreenExclusiveInfoEXT>::copy(const VkSurfaceFullScreenExclusiveInfoEXT& src, VkSurfaceFullScreenExclusiveInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkSurfaceFullScreenExclusiveWin32InfoEXT>::size(const VkSurfaceFullScreenExclusiveWin32InfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceFullScreenExclusiveWin32InfoEXT>::copy(const VkSurfaceFullScreenExclusiveWin32InfoEXT& src, VkSurfaceFullScreenExclusiveWin32InfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkSurfacePresentModeCompatibilityEXT>::size(const VkSurfacePresentModeCompatibilityEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPresentModes, src.presentModeCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfacePresentModeCompatibilityEXT>::copy(const VkSurfacePresentModeCompatibilityEXT& src, VkSurfacePresentModeCompatibilityEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPresentModes = DeepCopyArray(src.pPresentModes, src.presentModeCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSurfacePresentModeEXT>::size(const VkSurfacePresentModeEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfacePresentModeEXT>::copy(const VkSurfacePresentModeEXT& src, VkSurfacePresentModeEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSurfacePresentScalingCapabilitiesEXT>::size(const VkSurfacePresentScalingCapabilitiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfacePresentScalingCapabilitiesEXT>::copy(const VkSurfacePresentScalingCapabilitiesEXT& src, VkSurfacePresentScalingCapabilitiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceProtectedCapabilitiesKHR>::size(const VkSurfaceProtectedCapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSurfaceProtectedCapabilitiesKHR>::copy(const VkSurfaceProtectedCapabilitiesKHR& src, VkSurfaceProtectedCapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainCounterCreateInfoEXT>::size(const VkSwapchainCounterCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainCounterCreateInfoEXT>::copy(const VkSwapchainCounterCreateInfoEXT& src, VkSwapchainCounterCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainCreateInfoKHR>::size(const VkSwapchainCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (src.imageSharingMode == VK_SHARING_MODE_CONCURRENT)
+      DeepCopyArraySize(src.pQueueFamilyIndices, src.queueFamilyIndexCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainCreateInfoKHR>::copy(const VkSwapchainCreateInfoKHR& src, VkSwapchainCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pQueueFamilyIndices = src.imageSharingMode == VK_SHARING_MODE_CONCURRENT ? DeepCopyArray(src.pQueueFamilyIndices, src.queueFamilyIndexCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkSwapchainDisplayNativeHdrCreateInfoAMD>::size(const VkSwapchainDisplayNativeHdrCreateInfoAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainDisplayNativeHdrCreateInfoAMD>::copy(const VkSwapchainDisplayNativeHdrCreateInfoAMD& src, VkSwapchainDisplayNativeHdrCreateInfoAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentBarrierCreateInfoNV>::size(const VkSwapchainPresentBarrierCreateInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentBarrierCreateInfoNV>::copy(const VkSwapchainPresentBarrierCreateInfoNV& src, VkSwapchainPresentBarrierCreateInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentFenceInfoEXT>::size(const VkSwapchainPresentFenceInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pFences, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentFenceInfoEXT>::copy(const VkSwapchainPresentFenceInfoEXT& src, VkSwapchainPresentFenceInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pFences = DeepCopyArray(src.pFences, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentModeInfoEXT>::size(const VkSwapchainPresentModeInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPresentModes, src.swapchainCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentModeInfoEXT>::copy(const VkSwapchainPresentModeInfoEXT& src, VkSwapchainPresentModeInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPresentModes = DeepCopyArray(src.pPresentModes, src.swapchainCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentModesCreateInfoEXT>::size(const VkSwapchainPresentModesCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPresentModes, src.presentModeCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentModesCreateInfoEXT>::copy(const VkSwapchainPresentModesCreateInfoEXT& src, VkSwapchainPresentModesCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPresentModes = DeepCopyArray(src.pPresentModes, src.presentModeCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentScalingCreateInfoEXT>::size(const VkSwapchainPresentScalingCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSwapchainPresentScalingCreateInfoEXT>::copy(const VkSwapchainPresentScalingCreateInfoEXT& src, VkSwapchainPresentScalingCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void DeepCopyTraits<VkSysmemColorSpaceFUCHSIA>::size(const VkSysmemColorSpaceFUCHSIA& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkSysmemColorSpaceFUCHSIA>::copy(const VkSysmemColorSpaceFUCHSIA& src, VkSysmemColorSpaceFUCHSIA& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkTextureLODGatherFormatPropertiesAMD>::size(const VkTextureLODGatherFormatPropertiesAMD& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkTextureLODGatherFormatPropertiesAMD>::copy(const VkTextureLODGatherFormatPropertiesAMD& src, VkTextureLODGatherFormatPropertiesAMD& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkTilePropertiesQCOM>::size(const VkTilePropertiesQCOM& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkTilePropertiesQCOM>::copy(const VkTilePropertiesQCOM& src, VkTilePropertiesQCOM& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkTimelineSemaphoreSubmitInfo>::size(const VkTimelineSemaphoreSubmitInfo& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pWaitSemaphoreValues, src.waitSemaphoreValueCount, offset);
+    DeepCopyArraySize(src.pSignalSemaphoreValues, src.signalSemaphoreValueCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkTimelineSemaphoreSubmitInfo>::copy(const VkTimelineSemaphoreSubmitInfo& src, VkTimelineSemaphoreSubmitInfo& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pWaitSemaphoreValues = DeepCopyArray(src.pWaitSemaphoreValues, src.waitSemaphoreValueCount, cursor);
+    dst.pSignalSemaphoreValues = DeepCopyArray(src.pSignalSemaphoreValues, src.signalSemaphoreValueCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkValidationCacheCreateInfoEXT>::size(const VkValidationCacheCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pInitialData, src.initialDataSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkValidationCacheCreateInfoEXT>::copy(const VkValidationCacheCreateInfoEXT& src, VkValidationCacheCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pInitialData = DeepCopyBytes(src.pInitialData, src.initialDataSize, cursor);
+  }
+
+  inline void DeepCopyTraits<VkValidationFeaturesEXT>::size(const VkValidationFeaturesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pEnabledValidationFeatures, src.enabledValidationFeatureCount, offset);
+    DeepCopyArraySize(src.pDisabledValidationFeatures, src.disabledValidationFeatureCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkValidationFeaturesEXT>::copy(const VkValidationFeaturesEXT& src, VkValidationFeaturesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pEnabledValidationFeatures = DeepCopyArray(src.pEnabledValidationFeatures, src.enabledValidationFeatureCount, cursor);
+    dst.pDisabledValidationFeatures = DeepCopyArray(src.pDisabledValidationFeatures, src.disabledValidationFeatureCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkValidationFlagsEXT>::size(const VkValidationFlagsEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pDisabledValidationChecks, src.disabledValidationCheckCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkValidationFlagsEXT>::copy(const VkValidationFlagsEXT& src, VkValidationFlagsEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pDisabledValidationChecks = DeepCopyArray(src.pDisabledValidationChecks, src.disabledValidationCheckCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVertexInputAttributeDescription2EXT>::size(const VkVertexInputAttributeDescription2EXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVertexInputAttributeDescription2EXT>::copy(const VkVertexInputAttributeDescription2EXT& src, VkVertexInputAttributeDescription2EXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVertexInputBindingDescription2EXT>::size(const VkVertexInputBindingDescription2EXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVertexInputBindingDescription2EXT>::copy(const VkVertexInputBindingDescription2EXT& src, VkVertexInputBindingDescription2EXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_VI_NN
+  inline void DeepCopyTraits<VkViSurfaceCreateInfoNN>::size(const VkViSurfaceCreateInfoNN& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkViSurfaceCreateInfoNN>::copy(const VkViSurfaceCreateInfoNN& src, VkViSurfaceCreateInfoNN& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkVideoBeginCodingInfoKHR>::size(const VkVideoBeginCodingInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pReferenceSlots, src.referenceSlotCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoBeginCodingInfoKHR>::copy(const VkVideoBeginCodingInfoKHR& src, VkVideoBeginCodingInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pReferenceSlots = DeepCopyArray(src.pReferenceSlots, src.referenceSlotCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoCapabilitiesKHR>::size(const VkVideoCapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoCapabilitiesKHR>::copy(const VkVideoCapabilitiesKHR& src, VkVideoCapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoCodingControlInfoKHR>::size(const VkVideoCodingControlInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoCodingControlInfoKHR>::copy(const VkVideoCodingControlInfoKHR& src, VkVideoCodingControlInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeCapabilitiesKHR>::size(const VkVideoDecodeCapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeCapabilitiesKHR>::copy(const VkVideoDecodeCapabilitiesKHR& src, VkVideoDecodeCapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264CapabilitiesKHR>::size(const VkVideoDecodeH264CapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264CapabilitiesKHR>::copy(const VkVideoDecodeH264CapabilitiesKHR& src, VkVideoDecodeH264CapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264DpbSlotInfoKHR>::size(const VkVideoDecodeH264DpbSlotInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264DpbSlotInfoKHR>::copy(const VkVideoDecodeH264DpbSlotInfoKHR& src, VkVideoDecodeH264DpbSlotInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264PictureInfoKHR>::size(const VkVideoDecodeH264PictureInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSliceOffsets, src.sliceCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264PictureInfoKHR>::copy(const VkVideoDecodeH264PictureInfoKHR& src, VkVideoDecodeH264PictureInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSliceOffsets = DeepCopyArray(src.pSliceOffsets, src.sliceCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264ProfileInfoKHR>::size(const VkVideoDecodeH264ProfileInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264ProfileInfoKHR>::copy(const VkVideoDecodeH264ProfileInfoKHR& src, VkVideoDecodeH264ProfileInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264SessionParametersAddInfoKHR>::size(const VkVideoDecodeH264SessionParametersAddInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264SessionParametersAddInfoKHR>::copy(const VkVideoDecodeH264SessionParametersAddInfoKHR& src, VkVideoDecodeH264SessionParametersAddInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264SessionParametersCreateInfoKHR>::size(const VkVideoDecodeH264SessionParametersCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pParametersAddInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH264SessionParametersCreateInfoKHR>::copy(const VkVideoDecodeH264SessionParametersCreateInfoKHR& src, VkVideoDecodeH264SessionParametersCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pParametersAddInfo = DeepCopyArray(src.pParametersAddInfo, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265CapabilitiesKHR>::size(const VkVideoDecodeH265CapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265CapabilitiesKHR>::copy(const VkVideoDecodeH265CapabilitiesKHR& src, VkVideoDecodeH265CapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265DpbSlotInfoKHR>::size(const VkVideoDecodeH265DpbSlotInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265DpbSlotInfoKHR>::copy(const VkVideoDecodeH265DpbSlotInfoKHR& src, VkVideoDecodeH265DpbSlotInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265PictureInfoKHR>::size(const VkVideoDecodeH265PictureInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pSliceSegmentOffsets, src.sliceSegmentCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265PictureInfoKHR>::copy(const VkVideoDecodeH265PictureInfoKHR& src, VkVideoDecodeH265PictureInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pSliceSegmentOffsets = DeepCopyArray(src.pSliceSegmentOffsets, src.sliceSegmentCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265ProfileInfoKHR>::size(const VkVideoDecodeH265ProfileInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265ProfileInfoKHR>::copy(const VkVideoDecodeH265ProfileInfoKHR& src, VkVideoDecodeH265ProfileInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265SessionParametersAddInfoKHR>::size(const VkVideoDecodeH265SessionParametersAddInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265SessionParametersAddInfoKHR>::copy(const VkVideoDecodeH265SessionParametersAddInfoKHR& src, VkVideoDecodeH265SessionParametersAddInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265SessionParametersCreateInfoKHR>::size(const VkVideoDecodeH265SessionParametersCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pParametersAddInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeH265SessionParametersCreateInfoKHR>::copy(const VkVideoDecodeH265SessionParametersCreateInfoKHR& src, VkVideoDecodeH265SessionParametersCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pParametersAddInfo = DeepCopyArray(src.pParametersAddInfo, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeInfoKHR>::size(const VkVideoDecodeInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkVideoPictureResourceInfoKHR>::size(src.dstPictureResource, offset);
+    DeepCopyArraySize(src.pSetupReferenceSlot, 1, offset);
+    DeepCopyArraySize(src.pReferenceSlots, src.referenceSlotCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeInfoKHR>::copy(const VkVideoDecodeInfoKHR& src, VkVideoDecodeInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkVideoPictureResourceInfoKHR>::copy(src.dstPictureResource, dst.dstPictureResource, cursor);
+    dst.pSetupReferenceSlot = DeepCopyArray(src.pSetupReferenceSlot, 1, cursor);
+    dst.pReferenceSlots = DeepCopyArray(src.pReferenceSlots, src.referenceSlotCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeUsageInfoKHR>::size(const VkVideoDecodeUsageInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoDecodeUsageInfoKHR>::copy(const VkVideoDecodeUsageInfoKHR& src, VkVideoDecodeUsageInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeCapabilitiesKHR>::size(const VkVideoEncodeCapabilitiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeCapabilitiesKHR>::copy(const VkVideoEncodeCapabilitiesKHR& src, VkVideoEncodeCapabilitiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264CapabilitiesEXT>::size(const VkVideoEncodeH264CapabilitiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264CapabilitiesEXT>::copy(const VkVideoEncodeH264CapabilitiesEXT& src, VkVideoEncodeH264CapabilitiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264DpbSlotInfoEXT>::size(const VkVideoEncodeH264DpbSlotInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264DpbSlotInfoEXT>::copy(const VkVideoEncodeH264DpbSlotInfoEXT& src, VkVideoEncodeH264DpbSlotInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264GopRemainingFrameInfoEXT>::size(const VkVideoEncodeH264GopRemainingFrameInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264GopRemainingFrameInfoEXT>::copy(const VkVideoEncodeH264GopRemainingFrameInfoEXT& src, VkVideoEncodeH264GopRemainingFrameInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264NaluSliceInfoEXT>::size(const VkVideoEncodeH264NaluSliceInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264NaluSliceInfoEXT>::copy(const VkVideoEncodeH264NaluSliceInfoEXT& src, VkVideoEncodeH264NaluSliceInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264PictureInfoEXT>::size(const VkVideoEncodeH264PictureInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pNaluSliceEntries, src.naluSliceEntryCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264PictureInfoEXT>::copy(const VkVideoEncodeH264PictureInfoEXT& src, VkVideoEncodeH264PictureInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pNaluSliceEntries = DeepCopyArray(src.pNaluSliceEntries, src.naluSliceEntryCount, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264ProfileInfoEXT>::size(const VkVideoEncodeH264ProfileInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264ProfileInfoEXT>::copy(const VkVideoEncodeH264ProfileInfoEXT& src, VkVideoEncodeH264ProfileInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264QualityLevelPropertiesEXT>::size(const VkVideoEncodeH264QualityLevelPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264QualityLevelPropertiesEXT>::copy(const VkVideoEncodeH264QualityLevelPropertiesEXT& src, VkVideoEncodeH264QualityLevelPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264RateControlInfoEXT>::size(const VkVideoEncodeH264RateControlInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264RateControlInfoEXT>::copy(const VkVideoEncodeH264RateControlInfoEXT& src, VkVideoEncodeH264RateControlInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264RateControlLayerInfoEXT>::size(const VkVideoEncodeH264RateControlLayerInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264RateControlLayerInfoEXT>::copy(const VkVideoEncodeH264RateControlLayerInfoEXT& src, VkVideoEncodeH264RateControlLayerInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionCreateInfoEXT>::size(const VkVideoEncodeH264SessionCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionCreateInfoEXT>::copy(const VkVideoEncodeH264SessionCreateInfoEXT& src, VkVideoEncodeH264SessionCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersAddInfoEXT>::size(const VkVideoEncodeH264SessionParametersAddInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersAddInfoEXT>::copy(const VkVideoEncodeH264SessionParametersAddInfoEXT& src, VkVideoEncodeH264SessionParametersAddInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersCreateInfoEXT>::size(const VkVideoEncodeH264SessionParametersCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pParametersAddInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersCreateInfoEXT>::copy(const VkVideoEncodeH264SessionParametersCreateInfoEXT& src, VkVideoEncodeH264SessionParametersCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pParametersAddInfo = DeepCopyArray(src.pParametersAddInfo, 1, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersFeedbackInfoEXT>::size(const VkVideoEncodeH264SessionParametersFeedbackInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersFeedbackInfoEXT>::copy(const VkVideoEncodeH264SessionParametersFeedbackInfoEXT& src, VkVideoEncodeH264SessionParametersFeedbackInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersGetInfoEXT>::size(const VkVideoEncodeH264SessionParametersGetInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH264SessionParametersGetInfoEXT>::copy(const VkVideoEncodeH264SessionParametersGetInfoEXT& src, VkVideoEncodeH264SessionParametersGetInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265CapabilitiesEXT>::size(const VkVideoEncodeH265CapabilitiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265CapabilitiesEXT>::copy(const VkVideoEncodeH265CapabilitiesEXT& src, VkVideoEncodeH265CapabilitiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265DpbSlotInfoEXT>::size(const VkVideoEncodeH265DpbSlotInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265DpbSlotInfoEXT>::copy(const VkVideoEncodeH265DpbSlotInfoEXT& src, VkVideoEncodeH265DpbSlotInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265GopRemainingFrameInfoEXT>::size(const VkVideoEncodeH265GopRemainingFrameInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265GopRemainingFrameInfoEXT>::copy(const VkVideoEncodeH265GopRemainingFrameInfoEXT& src, VkVideoEncodeH265GopRemainingFrameInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265NaluSliceSegmentInfoEXT>::size(const VkVideoEncodeH265NaluSliceSegmentInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265NaluSliceSegmentInfoEXT>::copy(const VkVideoEncodeH265NaluSliceSegmentInfoEXT& src, VkVideoEncodeH265NaluSliceSegmentInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265PictureInfoEXT>::size(const VkVideoEncodeH265PictureInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pNaluSliceSegmentEntries, src.naluSliceSegmentEntryCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265PictureInfoEXT>::copy(const VkVideoEncodeH265PictureInfoEXT& src, VkVideoEncodeH265PictureInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pNaluSliceSegmentEntries = DeepCopyArray(src.pNaluSliceSegmentEntries, src.naluSliceSegmentEntryCount, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265ProfileInfoEXT>::size(const VkVideoEncodeH265ProfileInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265ProfileInfoEXT>::copy(const VkVideoEncodeH265ProfileInfoEXT& src, VkVideoEncodeH265ProfileInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265QualityLevelPropertiesEXT>::size(const VkVideoEncodeH265QualityLevelPropertiesEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265QualityLevelPropertiesEXT>::copy(const VkVideoEncodeH265QualityLevelPropertiesEXT& src, VkVideoEncodeH265QualityLevelPropertiesEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265RateControlInfoEXT>::size(const VkVideoEncodeH265RateControlInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265RateControlInfoEXT>::copy(const VkVideoEncodeH265RateControlInfoEXT& src, VkVideoEncodeH265RateControlInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265RateControlLayerInfoEXT>::size(const VkVideoEncodeH265RateControlLayerInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265RateControlLayerInfoEXT>::copy(const VkVideoEncodeH265RateControlLayerInfoEXT& src, VkVideoEncodeH265RateControlLayerInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionCreateInfoEXT>::size(const VkVideoEncodeH265SessionCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionCreateInfoEXT>::copy(const VkVideoEncodeH265SessionCreateInfoEXT& src, VkVideoEncodeH265SessionCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersAddInfoEXT>::size(const VkVideoEncodeH265SessionParametersAddInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersAddInfoEXT>::copy(const VkVideoEncodeH265SessionParametersAddInfoEXT& src, VkVideoEncodeH265SessionParametersAddInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersCreateInfoEXT>::size(const VkVideoEncodeH265SessionParametersCreateInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pParametersAddInfo, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersCreateInfoEXT>::copy(const VkVideoEncodeH265SessionParametersCreateInfoEXT& src, VkVideoEncodeH265SessionParametersCreateInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pParametersAddInfo = DeepCopyArray(src.pParametersAddInfo, 1, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersFeedbackInfoEXT>::size(const VkVideoEncodeH265SessionParametersFeedbackInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersFeedbackInfoEXT>::copy(const VkVideoEncodeH265SessionParametersFeedbackInfoEXT& src, VkVideoEncodeH265SessionParametersFeedbackInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersGetInfoEXT>::size(const VkVideoEncodeH265SessionParametersGetInfoEXT& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeH265SessionParametersGetInfoEXT>::copy(const VkVideoEncodeH265SessionParametersGetInfoEXT& src, VkVideoEncodeH265SessionParametersGetInfoEXT& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeInfoKHR>::size(const VkVideoEncodeInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyTraits<VkVideoPictureResourceInfoKHR>::size(src.srcPictureResource, offset);
+    DeepCopyArraySize(src.pSetupReferenceSlot, 1, offset);
+    DeepCopyArraySize(src.pReferenceSlots, src.referenceSlotCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeInfoKHR>::copy(const VkVideoEncodeInfoKHR& src, VkVideoEncodeInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    DeepCopyTraits<VkVideoPictureResourceInfoKHR>::copy(src.srcPictureResource, dst.srcPictureResource, cursor);
+    dst.pSetupReferenceSlot = DeepCopyArray(src.pSetupReferenceSlot, 1, cursor);
+    dst.pReferenceSlots = DeepCopyArray(src.pReferenceSlots, src.referenceSlotCount, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeQualityLevelInfoKHR>::size(const VkVideoEncodeQualityLevelInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeQualityLevelInfoKHR>::copy(const VkVideoEncodeQualityLevelInfoKHR& src, VkVideoEncodeQualityLevelInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeQualityLevelPropertiesKHR>::size(const VkVideoEncodeQualityLevelPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeQualityLevelPropertiesKHR>::copy(const VkVideoEncodeQualityLevelPropertiesKHR& src, VkVideoEncodeQualityLevelPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeRateControlInfoKHR>::size(const VkVideoEncodeRateControlInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pLayers, src.layerCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeRateControlInfoKHR>::copy(const VkVideoEncodeRateControlInfoKHR& src, VkVideoEncodeRateControlInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pLayers = DeepCopyArray(src.pLayers, src.layerCount, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeRateControlLayerInfoKHR>::size(const VkVideoEncodeRateControlLayerInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeRateControlLayerInfoKHR>::copy(const VkVideoEncodeRateControlLayerInfoKHR& src, VkVideoEncodeRateControlLayerInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeSessionParametersFeedbackInfoKHR>::size(const VkVideoEncodeSessionParametersFeedbackInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeSessionParametersFeedbackInfoKHR>::copy(const VkVideoEncodeSessionParametersFeedbackInfoKHR& src, VkVideoEncodeSessionParametersFeedbackInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeSessionParametersGetInfoKHR>::size(const VkVideoEncodeSessionParametersGetInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeSessionParametersGetInfoKHR>::copy(const VkVideoEncodeSessionParametersGetInfoKHR& src, VkVideoEncodeSessionParametersGetInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void DeepCopyTraits<VkVideoEncodeUsageInfoKHR>::size(const VkVideoEncodeUsageInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEncodeUsageInfoKHR>::copy(const VkVideoEncodeUsageInfoKHR& src, VkVideoEncodeUsageInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkVideoEndCodingInfoKHR>::size(const VkVideoEndCodingInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoEndCodingInfoKHR>::copy(const VkVideoEndCodingInfoKHR& src, VkVideoEndCodingInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoFormatPropertiesKHR>::size(const VkVideoFormatPropertiesKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoFormatPropertiesKHR>::copy(const VkVideoFormatPropertiesKHR& src, VkVideoFormatPropertiesKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoPictureResourceInfoKHR>::size(const VkVideoPictureResourceInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoPictureResourceInfoKHR>::copy(const VkVideoPictureResourceInfoKHR& src, VkVideoPictureResourceInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoProfileInfoKHR>::size(const VkVideoProfileInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoProfileInfoKHR>::copy(const VkVideoProfileInfoKHR& src, VkVideoProfileInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoProfileListInfoKHR>::size(const VkVideoProfileListInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pProfiles, src.profileCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoProfileListInfoKHR>::copy(const VkVideoProfileListInfoKHR& src, VkVideoProfileListInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pProfiles = DeepCopyArray(src.pProfiles, src.profileCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoReferenceSlotInfoKHR>::size(const VkVideoReferenceSlotInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pPictureResource, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoReferenceSlotInfoKHR>::copy(const VkVideoReferenceSlotInfoKHR& src, VkVideoReferenceSlotInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pPictureResource = DeepCopyArray(src.pPictureResource, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionCreateInfoKHR>::size(const VkVideoSessionCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pVideoProfile, 1, offset);
+    DeepCopyArraySize(src.pStdHeaderVersion, 1, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionCreateInfoKHR>::copy(const VkVideoSessionCreateInfoKHR& src, VkVideoSessionCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pVideoProfile = DeepCopyArray(src.pVideoProfile, 1, cursor);
+    dst.pStdHeaderVersion = DeepCopyArray(src.pStdHeaderVersion, 1, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionMemoryRequirementsKHR>::size(const VkVideoSessionMemoryRequirementsKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionMemoryRequirementsKHR>::copy(const VkVideoSessionMemoryRequirementsKHR& src, VkVideoSessionMemoryRequirementsKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionParametersCreateInfoKHR>::size(const VkVideoSessionParametersCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionParametersCreateInfoKHR>::copy(const VkVideoSessionParametersCreateInfoKHR& src, VkVideoSessionParametersCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionParametersUpdateInfoKHR>::size(const VkVideoSessionParametersUpdateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkVideoSessionParametersUpdateInfoKHR>::copy(const VkVideoSessionParametersUpdateInfoKHR& src, VkVideoSessionParametersUpdateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+  inline void DeepCopyTraits<VkWaylandSurfaceCreateInfoKHR>::size(const VkWaylandSurfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkWaylandSurfaceCreateInfoKHR>::copy(const VkWaylandSurfaceCreateInfoKHR& src, VkWaylandSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkWin32KeyedMutexAcquireReleaseInfoKHR>::size(const VkWin32KeyedMutexAcquireReleaseInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAcquireSyncs, src.acquireCount, offset);
+    DeepCopyArraySize(src.pAcquireKeys, src.acquireCount, offset);
+    DeepCopyArraySize(src.pAcquireTimeouts, src.acquireCount, offset);
+    DeepCopyArraySize(src.pReleaseSyncs, src.releaseCount, offset);
+    DeepCopyArraySize(src.pReleaseKeys, src.releaseCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkWin32KeyedMutexAcquireReleaseInfoKHR>::copy(const VkWin32KeyedMutexAcquireReleaseInfoKHR& src, VkWin32KeyedMutexAcquireReleaseInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAcquireSyncs = DeepCopyArray(src.pAcquireSyncs, src.acquireCount, cursor);
+    dst.pAcquireKeys = DeepCopyArray(src.pAcquireKeys, src.acquireCount, cursor);
+    dst.pAcquireTimeouts = DeepCopyArray(src.pAcquireTimeouts, src.acquireCount, cursor);
+    dst.pReleaseSyncs = DeepCopyArray(src.pReleaseSyncs, src.releaseCount, cursor);
+    dst.pReleaseKeys = DeepCopyArray(src.pReleaseKeys, src.releaseCount, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkWin32KeyedMutexAcquireReleaseInfoNV>::size(const VkWin32KeyedMutexAcquireReleaseInfoNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAcquireSyncs, src.acquireCount, offset);
+    DeepCopyArraySize(src.pAcquireKeys, src.acquireCount, offset);
+    DeepCopyArraySize(src.pAcquireTimeoutMilliseconds, src.acquireCount, offset);
+    DeepCopyArraySize(src.pReleaseSyncs, src.releaseCount, offset);
+    DeepCopyArraySize(src.pReleaseKeys, src.releaseCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkWin32KeyedMutexAcquireReleaseInfoNV>::copy(const VkWin32KeyedMutexAcquireReleaseInfoNV& src, VkWin32KeyedMutexAcquireReleaseInfoNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAcquireSyncs = DeepCopyArray(src.pAcquireSyncs, src.acquireCount, cursor);
+    dst.pAcquireKeys = DeepCopyArray(src.pAcquireKeys, src.acquireCount, cursor);
+    dst.pAcquireTimeoutMilliseconds = DeepCopyArray(src.pAcquireTimeoutMilliseconds, src.acquireCount, cursor);
+    dst.pReleaseSyncs = DeepCopyArray(src.pReleaseSyncs, src.releaseCount, cursor);
+    dst.pReleaseKeys = DeepCopyArray(src.pReleaseKeys, src.releaseCount, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void DeepCopyTraits<VkWin32SurfaceCreateInfoKHR>::size(const VkWin32SurfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkWin32SurfaceCreateInfoKHR>::copy(const VkWin32SurfaceCreateInfoKHR& src, VkWin32SurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyTraits<VkWriteDescriptorSet>::size(const VkWriteDescriptorSet& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    if (DescriptorTypeUsesImageInfo(src.descriptorType))
+      DeepCopyArraySize(src.pImageInfo, src.descriptorCount, offset);
+    if (DescriptorTypeUsesBufferInfo(src.descriptorType))
+      DeepCopyArraySize(src.pBufferInfo, src.descriptorCount, offset);
+    if (DescriptorTypeUsesTexelBufferView(src.descriptorType))
+      DeepCopyArraySize(src.pTexelBufferView, src.descriptorCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSet>::copy(const VkWriteDescriptorSet& src, VkWriteDescriptorSet& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pImageInfo = DescriptorTypeUsesImageInfo(src.descriptorType) ? DeepCopyArray(src.pImageInfo, src.descriptorCount, cursor) : nullptr;
+    dst.pBufferInfo = DescriptorTypeUsesBufferInfo(src.descriptorType) ? DeepCopyArray(src.pBufferInfo, src.descriptorCount, cursor) : nullptr;
+    dst.pTexelBufferView = DescriptorTypeUsesTexelBufferView(src.descriptorType) ? DeepCopyArray(src.pTexelBufferView, src.descriptorCount, cursor) : nullptr;
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSetAccelerationStructureKHR>::size(const VkWriteDescriptorSetAccelerationStructureKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAccelerationStructures, src.accelerationStructureCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSetAccelerationStructureKHR>::copy(const VkWriteDescriptorSetAccelerationStructureKHR& src, VkWriteDescriptorSetAccelerationStructureKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAccelerationStructures = DeepCopyArray(src.pAccelerationStructures, src.accelerationStructureCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSetAccelerationStructureNV>::size(const VkWriteDescriptorSetAccelerationStructureNV& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyArraySize(src.pAccelerationStructures, src.accelerationStructureCount, offset);
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSetAccelerationStructureNV>::copy(const VkWriteDescriptorSetAccelerationStructureNV& src, VkWriteDescriptorSetAccelerationStructureNV& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pAccelerationStructures = DeepCopyArray(src.pAccelerationStructures, src.accelerationStructureCount, cursor);
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSetInlineUniformBlock>::size(const VkWriteDescriptorSetInlineUniformBlock& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+    DeepCopyBytesSize(src.pData, src.dataSize, offset);
+  }
+
+  inline void DeepCopyTraits<VkWriteDescriptorSetInlineUniformBlock>::copy(const VkWriteDescriptorSetInlineUniformBlock& src, VkWriteDescriptorSetInlineUniformBlock& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+    dst.pData = DeepCopyBytes(src.pData, src.dataSize, cursor);
+  }
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+  inline void DeepCopyTraits<VkXcbSurfaceCreateInfoKHR>::size(const VkXcbSurfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkXcbSurfaceCreateInfoKHR>::copy(const VkXcbSurfaceCreateInfoKHR& src, VkXcbSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+  inline void DeepCopyTraits<VkXlibSurfaceCreateInfoKHR>::size(const VkXlibSurfaceCreateInfoKHR& src, size_t& offset) {
+    DeepCopyNextSize(src.pNext, offset);
+  }
+
+  inline void DeepCopyTraits<VkXlibSurfaceCreateInfoKHR>::copy(const VkXlibSurfaceCreateInfoKHR& src, VkXlibSurfaceCreateInfoKHR& dst, DeepCopyCursor& cursor) {
+    dst.pNext = DeepCopyNext(src.pNext, cursor);
+  }
+#endif
+
+  inline void DeepCopyNextSize(const void* pNext, size_t& offset) {
+    for (const VkBaseInStructure* header = static_cast<const VkBaseInStructure*>(pNext); header; header = header->pNext) {
+      switch (header->sType) {
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureBuildSizesInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureCaptureDescriptorDataInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureDeviceAddressInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureGeometryAabbsDataKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureGeometryInstancesDataKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureGeometryMotionTrianglesDataNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureGeometryTrianglesDataKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureMemoryRequirementsInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureMotionInfoNV*>(header), offset);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_DISPLACEMENT_MICROMAP_NV: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureTrianglesDisplacementMicromapNV*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureTrianglesOpacityMicromapEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAccelerationStructureVersionInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAcquireNextImageInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAcquireProfilingLockInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_AMIGO_PROFILING_SUBMIT_INFO_SEC: return DeepCopyStructSize(*reinterpret_cast<const VkAmigoProfilingSubmitInfoSEC*>(header), offset);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkAndroidHardwareBufferFormatProperties2ANDROID*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkAndroidHardwareBufferFormatPropertiesANDROID*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkAndroidHardwareBufferPropertiesANDROID*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkAndroidHardwareBufferUsageANDROID*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkAndroidSurfaceCreateInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_APPLICATION_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkApplicationInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2: return DeepCopyStructSize(*reinterpret_cast<const VkAttachmentDescription2*>(header), offset);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT: return DeepCopyStructSize(*reinterpret_cast<const VkAttachmentDescriptionStencilLayout*>(header), offset);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2: return DeepCopyStructSize(*reinterpret_cast<const VkAttachmentReference2*>(header), offset);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT: return DeepCopyStructSize(*reinterpret_cast<const VkAttachmentReferenceStencilLayout*>(header), offset);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkAttachmentSampleCountInfoAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkBindAccelerationStructureMemoryInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBindBufferMemoryDeviceGroupInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBindBufferMemoryInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBindImageMemoryDeviceGroupInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBindImageMemoryInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkBindImageMemorySwapchainInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBindImagePlaneMemoryInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBindSparseInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BIND_VIDEO_SESSION_MEMORY_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkBindVideoSessionMemoryInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkBlitImageInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCaptureDescriptorDataInfoEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCollectionBufferCreateInfoFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCollectionConstraintsInfoFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCollectionCreateInfoFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCollectionImageCreateInfoFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCollectionPropertiesFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkBufferConstraintsInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_BUFFER_COPY_2: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCopy2*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBufferCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkBufferDeviceAddressCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBufferDeviceAddressInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2: return DeepCopyStructSize(*reinterpret_cast<const VkBufferImageCopy2*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER: return DeepCopyStructSize(*reinterpret_cast<const VkBufferMemoryBarrier*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2: return DeepCopyStructSize(*reinterpret_cast<const VkBufferMemoryBarrier2*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkBufferMemoryRequirementsInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBufferOpaqueCaptureAddressCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkBufferViewCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkCalibratedTimestampInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV: return DeepCopyStructSize(*reinterpret_cast<const VkCheckpointData2NV*>(header), offset);
+        case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV: return DeepCopyStructSize(*reinterpret_cast<const VkCheckpointDataNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferInheritanceConditionalRenderingInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferInheritanceInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferInheritanceRenderPassTransformInfoQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferInheritanceRenderingInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferInheritanceViewportScissorInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkCommandBufferSubmitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkCommandPoolCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkComputePipelineCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkConditionalRenderingBeginInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkCooperativeMatrixPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkCopyAccelerationStructureInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkCopyAccelerationStructureToMemoryInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkCopyBufferInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkCopyBufferToImageInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkCopyCommandTransformInfoQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET: return DeepCopyStructSize(*reinterpret_cast<const VkCopyDescriptorSet*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkCopyImageInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkCopyImageToBufferInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkCopyMemoryToAccelerationStructureInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_MICROMAP_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkCopyMemoryToMicromapInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_MICROMAP_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkCopyMicromapInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_COPY_MICROMAP_TO_MEMORY_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkCopyMicromapToMemoryInfoEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkD3D12FenceSubmitInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugMarkerMarkerInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugMarkerObjectNameInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugMarkerObjectTagInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugUtilsLabelEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugUtilsMessengerCallbackDataEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugUtilsObjectNameInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDebugUtilsObjectTagInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkDedicatedAllocationBufferCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkDedicatedAllocationImageCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEPENDENCY_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDependencyInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorAddressInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorBufferBindingInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorPoolCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorPoolInlineUniformBlockCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_BINDING_REFERENCE_VALVE: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetBindingReferenceVALVE*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetLayoutCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_HOST_MAPPING_INFO_VALVE: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetLayoutHostMappingInfoVALVE*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetLayoutSupport*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetVariableDescriptorCountAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorSetVariableDescriptorCountLayoutSupport*>(header), offset);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDescriptorUpdateTemplateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_ADDRESS_BINDING_CALLBACK_DATA_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceAddressBindingCallbackDataEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceBufferMemoryRequirements*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceDeviceMemoryReportCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceDiagnosticsConfigCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceEventInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_COUNTS_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceFaultCountsEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupBindSparseInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupCommandBufferBeginInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupDeviceCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupPresentCapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupPresentInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupRenderPassBeginInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupSubmitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceGroupSwapchainCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceImageMemoryRequirements*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceMemoryOpaqueCaptureAddressInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceMemoryOverallocationCreateInfoAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceMemoryReportCallbackDataEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDevicePrivateDataCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceQueueCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceQueueGlobalPriorityCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkDeviceQueueInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_INFO_LUNARG: return DeepCopyStructSize(*reinterpret_cast<const VkDirectDriverLoadingInfoLUNARG*>(header), offset);
+        case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_LIST_LUNARG: return DeepCopyStructSize(*reinterpret_cast<const VkDirectDriverLoadingListLUNARG*>(header), offset);
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+        case VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDirectFBSurfaceCreateInfoEXT*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayEventInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayModeCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayModeProperties2KHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayNativeHdrSurfaceCapabilitiesAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayPlaneCapabilities2KHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayPlaneInfo2KHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayPlaneProperties2KHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayPowerInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayPresentInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplayProperties2KHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkDisplaySurfaceCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDrmFormatModifierPropertiesList2EXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkDrmFormatModifierPropertiesListEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkEventCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkExportFenceCreateInfo*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkExportFenceWin32HandleInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkExportMemoryAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkExportMemoryAllocateInfoNV*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkExportMemoryWin32HandleInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkExportMemoryWin32HandleInfoNV*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalBufferInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_COMMAND_QUEUE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalCommandQueueInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_DEVICE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalDeviceInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalIOSurfaceInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalObjectCreateInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECTS_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalObjectsInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalSharedEventInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExportMetalTextureInfoEXT*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkExportSemaphoreCreateInfo*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkExportSemaphoreWin32HandleInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkExternalBufferProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkExternalFenceProperties*>(header), offset);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkExternalFormatANDROID*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkExternalImageFormatProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkExternalMemoryAcquireUnmodifiedEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkExternalMemoryBufferCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkExternalMemoryImageCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkExternalMemoryImageCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkExternalSemaphoreProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkFenceCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkFenceGetFdInfoKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkFenceGetWin32HandleInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkFilterCubicImageViewImageFormatPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2: return DeepCopyStructSize(*reinterpret_cast<const VkFormatProperties2*>(header), offset);
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3: return DeepCopyStructSize(*reinterpret_cast<const VkFormatProperties3*>(header), offset);
+        case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkFragmentShadingRateAttachmentInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkFramebufferAttachmentImageInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkFramebufferAttachmentsCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkFramebufferCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV: return DeepCopyStructSize(*reinterpret_cast<const VkFramebufferMixedSamplesCombinationNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGeneratedCommandsInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGeneratedCommandsMemoryRequirementsInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGeometryAABBNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GEOMETRY_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGeometryNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGeometryTrianglesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkGraphicsPipelineCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGraphicsPipelineShaderGroupsCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkGraphicsShaderGroupCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_HDR_METADATA_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkHdrMetadataEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkHeadlessSurfaceCreateInfoEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_IOS_MVK
+        case VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK: return DeepCopyStructSize(*reinterpret_cast<const VkIOSSurfaceCreateInfoMVK*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_BLIT_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageBlit2*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageCaptureDescriptorDataInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageCompressionControlEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageCompressionPropertiesEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkImageConstraintsInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_COPY_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageCopy2*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkImageCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageDrmFormatModifierExplicitCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageDrmFormatModifierListCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageDrmFormatModifierPropertiesEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkImageFormatConstraintsInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkImageFormatListCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageFormatProperties2*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER: return DeepCopyStructSize(*reinterpret_cast<const VkImageMemoryBarrier*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageMemoryBarrier2*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageMemoryRequirementsInfo2*>(header), offset);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkImagePipeSurfaceCreateInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkImagePlaneMemoryRequirementsInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageResolve2*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkImageSparseMemoryRequirementsInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkImageStencilUsageCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_SUBRESOURCE_2_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageSubresource2EXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImageSwapchainCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewASTCDecodeModeEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewCaptureDescriptorDataInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewMinLodCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewSampleWeightCreateInfoQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewSlicedCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkImageViewUsageCreateInfo*>(header), offset);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkImportAndroidHardwareBufferInfoANDROID*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImportFenceFdInfoKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImportFenceWin32HandleInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkImportMemoryBufferCollectionFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImportMemoryFdInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImportMemoryHostPointerInfoEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImportMemoryWin32HandleInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkImportMemoryWin32HandleInfoNV*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkImportMemoryZirconHandleInfoFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_BUFFER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImportMetalBufferInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_IO_SURFACE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImportMetalIOSurfaceInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_SHARED_EVENT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImportMetalSharedEventInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_TEXTURE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkImportMetalTextureInfoEXT*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImportSemaphoreFdInfoKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkImportSemaphoreWin32HandleInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkImportSemaphoreZirconHandleInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkIndirectCommandsLayoutCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV: return DeepCopyStructSize(*reinterpret_cast<const VkIndirectCommandsLayoutTokenNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkInitializePerformanceApiInfoINTEL*>(header), offset);
+        case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkInstanceCreateInfo*>(header), offset);
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+        case VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK: return DeepCopyStructSize(*reinterpret_cast<const VkMacOSSurfaceCreateInfoMVK*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE: return DeepCopyStructSize(*reinterpret_cast<const VkMappedMemoryRange*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryAllocateFlagsInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryBarrier*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryBarrier2*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryDedicatedAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryDedicatedRequirements*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryFdPropertiesKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryGetAndroidHardwareBufferInfoANDROID*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryGetFdInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryGetRemoteAddressInfoNV*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryGetWin32HandleInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryGetZirconHandleInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryHostPointerPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_MAP_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryMapInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryOpaqueCaptureAddressAllocateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryPriorityAllocateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryRequirements2*>(header), offset);
+        case VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryUnmapInfoKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryWin32HandlePropertiesKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkMemoryZirconHandlePropertiesFUCHSIA*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMetalSurfaceCreateInfoEXT*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_MICROMAP_BUILD_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMicromapBuildInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MICROMAP_BUILD_SIZES_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMicromapBuildSizesInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MICROMAP_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMicromapCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MICROMAP_VERSION_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMicromapVersionInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMultisamplePropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMultisampledRenderToSingleSampledInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX: return DeepCopyStructSize(*reinterpret_cast<const VkMultiviewPerViewAttributesInfoNVX*>(header), offset);
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_RENDER_AREAS_RENDER_PASS_BEGIN_INFO_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkMutableDescriptorTypeCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkOpaqueCaptureDescriptorDataCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_EXECUTE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkOpticalFlowExecuteInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkOpticalFlowImageFormatInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkOpticalFlowImageFormatPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkOpticalFlowSessionCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_PRIVATE_DATA_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkOpticalFlowSessionCreatePrivateDataInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceConfigurationAcquireInfoINTEL*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceCounterDescriptionKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceCounterKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceMarkerInfoINTEL*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceOverrideInfoINTEL*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceQuerySubmitInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkPerformanceStreamMarkerInfoINTEL*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevice16BitStorageFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevice4444FormatsFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevice8BitStorageFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceASTCDecodeFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceAccelerationStructureFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceAccelerationStructurePropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceAddressBindingReportFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_AMIGO_PROFILING_FEATURES_SEC: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceAmigoProfilingFeaturesSEC*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_DYNAMIC_STATE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_FEATURES_HUAWEI: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_PROPERTIES_HUAWEI: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCoherentMemoryFeaturesAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceColorWriteEnableFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceConditionalRenderingFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceConservativeRasterizationPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCornerSampledImageFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCoverageReductionModeFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCustomBorderColorFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceCustomBorderColorPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDepthClipControlFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDepthClipEnableFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDepthStencilResolveProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_DENSITY_MAP_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDescriptorBufferFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDescriptorBufferPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDiagnosticsConfigFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDiscardRectanglePropertiesEXT*>(header), offset);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDisplacementMicromapFeaturesNV*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDisplacementMicromapPropertiesNV*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDriverProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDrmPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDynamicRenderingFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExclusiveScissorFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExternalBufferInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExternalFenceInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExternalMemoryHostPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceExternalSemaphoreInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFaultFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFeatures2*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFloatControlsProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRatePropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceGroupProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceHostQueryResetFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceIDProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageCompressionControlFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageDrmFormatModifierInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageFormatInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_FEATURES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageProcessingFeaturesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_PROPERTIES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageProcessingPropertiesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageRobustnessFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_SLICED_VIEW_OF_3D_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageViewImageFormatInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImageViewMinLodFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceImagelessFramebufferFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceIndexTypeUint8FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceInheritedViewportScissorFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceLegacyDitheringFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceLineRasterizationFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceLineRasterizationPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceLinearColorAttachmentFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMaintenance3Properties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMaintenance4Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMaintenance4Properties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMemoryBudgetPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMemoryDecompressionFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMemoryDecompressionPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMemoryPriorityFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMemoryProperties2*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultiDrawFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultiDrawPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultiviewFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_RENDER_AREAS_FEATURES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_VIEWPORTS_FEATURES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMultiviewProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NON_SEAMLESS_CUBE_MAP_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceOpacityMicromapFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceOpacityMicromapPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceOpticalFlowFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceOpticalFlowPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePCIBusInfoPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePerformanceQueryFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePerformanceQueryPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelineCreationCacheControlFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_LIBRARY_GROUP_HANDLES_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROPERTIES_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelinePropertiesFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelineRobustnessFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePipelineRobustnessPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePointClippingProperties*>(header), offset);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePortabilitySubsetFeaturesKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePortabilitySubsetPropertiesKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_BARRIER_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePresentBarrierFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePresentIdFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePresentWaitFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePrivateDataFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceProperties2*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceProtectedMemoryFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceProtectedMemoryProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceProvokingVertexFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceProvokingVertexPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDevicePushDescriptorPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayQueryFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MAINTENANCE_1_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingPipelineFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingPipelinePropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_POSITION_FETCH_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRayTracingPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRobustness2FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceRobustness2PropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSampleLocationsPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSamplerFilterMinmaxProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSamplerYcbcrConversionFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceScalarBlockLayoutFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderAtomicInt64Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderClockFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_FEATURES_ARM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_PROPERTIES_ARM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderCoreProperties2AMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_ARM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesARM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderDrawParametersFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EARLY_AND_LATE_FRAGMENT_TESTS_FEATURES_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderFloat16Int8Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderImageFootprintFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderObjectFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderObjectPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderTerminateInvocationFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderTileImageFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShaderTileImagePropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShadingRateImageFeaturesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceShadingRateImagePropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSparseImageFormatInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSubgroupProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSurfaceInfo2KHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceSynchronization2Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTextureCompressionASTCHDRFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_PROPERTIES_FEATURES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTilePropertiesFeaturesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceToolProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTransformFeedbackFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceTransformFeedbackPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceUniformBufferStandardLayoutFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVariablePointersFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT*>(header), offset);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVideoFormatInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkan11Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkan11Properties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkan12Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkan12Properties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkan13Features*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkan13Properties*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceVulkanMemoryModelFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES: return DeepCopyStructSize(*reinterpret_cast<const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineCacheCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineColorBlendAdvancedStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineColorBlendStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineColorWriteCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineCompilerControlCreateInfoAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineCoverageModulationStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineCoverageReductionStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineCoverageToColorStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineCreationFeedbackCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineDepthStencilStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineDiscardRectangleStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineDynamicStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineExecutableInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineExecutableInternalRepresentationKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineExecutablePropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineExecutableStatisticKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineFragmentShadingRateEnumStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineFragmentShadingRateStateCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineInputAssemblyStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineLayoutCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineLibraryCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineMultisampleStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_PROPERTIES_IDENTIFIER_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelinePropertiesIdentifierEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationConservativeStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationDepthClipStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationLineStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationStateRasterizationOrderAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRasterizationStateStreamCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRenderingCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRepresentativeFragmentTestStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineRobustnessCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineSampleLocationsStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineShaderStageCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineShaderStageModuleIdentifierCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineTessellationDomainOriginStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineTessellationStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineVertexInputStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportDepthClipControlCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportExclusiveScissorStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportShadingRateImageStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportStateCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportSwizzleStateCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkPipelineViewportWScalingStateCreateInfoNV*>(header), offset);
+#ifdef VK_USE_PLATFORM_GGP
+        case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP: return DeepCopyStructSize(*reinterpret_cast<const VkPresentFrameTokenGGP*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_PRESENT_ID_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPresentIdKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPresentInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkPresentRegionsKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE: return DeepCopyStructSize(*reinterpret_cast<const VkPresentTimesInfoGOOGLE*>(header), offset);
+        case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkPrivateDataSlotCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkProtectedSubmitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUERY_LOW_LATENCY_SUPPORT_NV: return DeepCopyStructSize(*reinterpret_cast<const VkQueryLowLatencySupportNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkQueryPoolCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkQueryPoolPerformanceCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL: return DeepCopyStructSize(*reinterpret_cast<const VkQueryPoolPerformanceQueryCreateInfoINTEL*>(header), offset);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_QUERY_POOL_VIDEO_ENCODE_FEEDBACK_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV: return DeepCopyStructSize(*reinterpret_cast<const VkQueueFamilyCheckpointProperties2NV*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV: return DeepCopyStructSize(*reinterpret_cast<const VkQueueFamilyCheckpointPropertiesNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkQueueFamilyGlobalPriorityPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2: return DeepCopyStructSize(*reinterpret_cast<const VkQueueFamilyProperties2*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkQueueFamilyQueryResultStatusPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkQueueFamilyVideoPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkRayTracingPipelineCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkRayTracingPipelineCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkRayTracingPipelineInterfaceCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkRayTracingShaderGroupCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkRayTracingShaderGroupCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_RELEASE_SWAPCHAIN_IMAGES_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkReleaseSwapchainImagesInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassAttachmentBeginInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassBeginInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassCreateInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_CONTROL_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassCreationControlEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_FEEDBACK_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassCreationFeedbackCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassFragmentDensityMapCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassInputAttachmentAspectCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassMultiviewCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassSampleLocationsBeginInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SUBPASS_FEEDBACK_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassSubpassFeedbackCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkRenderPassTransformBeginInfoQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderingAttachmentInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkRenderingFragmentDensityMapAttachmentInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkRenderingFragmentShadingRateAttachmentInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_RENDERING_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkRenderingInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkResolveImageInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSampleLocationsInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerBorderColorComponentMappingCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerCaptureDescriptorDataInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerReductionModeCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerYcbcrConversionCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerYcbcrConversionImageFormatProperties*>(header), offset);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSamplerYcbcrConversionInfo*>(header), offset);
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+        case VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX: return DeepCopyStructSize(*reinterpret_cast<const VkScreenSurfaceCreateInfoQNX*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreGetFdInfoKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreGetWin32HandleInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreGetZirconHandleInfoFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreSignalInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreSubmitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreTypeCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSemaphoreWaitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkShaderCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkShaderModuleCreateInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkShaderModuleIdentifierEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkShaderModuleValidationCacheCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSharedPresentSurfaceCapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2: return DeepCopyStructSize(*reinterpret_cast<const VkSparseImageFormatProperties2*>(header), offset);
+        case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2: return DeepCopyStructSize(*reinterpret_cast<const VkSparseImageMemoryRequirements2*>(header), offset);
+#ifdef VK_USE_PLATFORM_GGP
+        case VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP: return DeepCopyStructSize(*reinterpret_cast<const VkStreamDescriptorSurfaceCreateInfoGGP*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_SUBMIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSubmitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBMIT_INFO_2: return DeepCopyStructSize(*reinterpret_cast<const VkSubmitInfo2*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassBeginInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassDependency2*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassDescription2*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassDescriptionDepthStencilResolve*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_END_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassEndInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassFragmentDensityMapOffsetEndInfoQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_RESOLVE_PERFORMANCE_QUERY_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassResolvePerformanceQueryEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI: return DeepCopyStructSize(*reinterpret_cast<const VkSubpassShadingPipelineCreateInfoHUAWEI*>(header), offset);
+        case VK_STRUCTURE_TYPE_SUBRESOURCE_LAYOUT_2_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSubresourceLayout2EXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceCapabilities2EXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceCapabilities2KHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceCapabilitiesFullScreenExclusiveEXT*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_BARRIER_NV: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceCapabilitiesPresentBarrierNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceFormat2KHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceFullScreenExclusiveInfoEXT*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceFullScreenExclusiveWin32InfoEXT*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_COMPATIBILITY_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfacePresentModeCompatibilityEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfacePresentModeEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_SCALING_CAPABILITIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSurfacePresentScalingCapabilitiesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSurfaceProtectedCapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainCounterCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainDisplayNativeHdrCreateInfoAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_BARRIER_CREATE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainPresentBarrierCreateInfoNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainPresentFenceInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainPresentModeInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODES_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainPresentModesCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_SCALING_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkSwapchainPresentScalingCreateInfoEXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA: return DeepCopyStructSize(*reinterpret_cast<const VkSysmemColorSpaceFUCHSIA*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD: return DeepCopyStructSize(*reinterpret_cast<const VkTextureLODGatherFormatPropertiesAMD*>(header), offset);
+        case VK_STRUCTURE_TYPE_TILE_PROPERTIES_QCOM: return DeepCopyStructSize(*reinterpret_cast<const VkTilePropertiesQCOM*>(header), offset);
+        case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO: return DeepCopyStructSize(*reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(header), offset);
+        case VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkValidationCacheCreateInfoEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkValidationFeaturesEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkValidationFlagsEXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVertexInputAttributeDescription2EXT*>(header), offset);
+        case VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVertexInputBindingDescription2EXT*>(header), offset);
+#ifdef VK_USE_PLATFORM_VI_NN
+        case VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN: return DeepCopyStructSize(*reinterpret_cast<const VkViSurfaceCreateInfoNN*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoBeginCodingInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoCapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoCodingControlInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeCapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH264CapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH264DpbSlotInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH264PictureInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH264ProfileInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH264SessionParametersAddInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH264SessionParametersCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH265CapabilitiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH265DpbSlotInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH265PictureInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH265ProfileInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH265SessionParametersAddInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeH265SessionParametersCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_USAGE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoDecodeUsageInfoKHR*>(header), offset);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeCapabilitiesKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264CapabilitiesEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264DpbSlotInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_GOP_REMAINING_FRAME_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264GopRemainingFrameInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264NaluSliceInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PICTURE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264PictureInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264ProfileInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUALITY_LEVEL_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264QualityLevelPropertiesEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264RateControlInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264RateControlLayerInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264SessionCreateInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264SessionParametersAddInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264SessionParametersCreateInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_FEEDBACK_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264SessionParametersFeedbackInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_GET_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH264SessionParametersGetInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265CapabilitiesEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265DpbSlotInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_GOP_REMAINING_FRAME_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265GopRemainingFrameInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_SEGMENT_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265NaluSliceSegmentInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PICTURE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265PictureInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265ProfileInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUALITY_LEVEL_PROPERTIES_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265QualityLevelPropertiesEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265RateControlInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265RateControlLayerInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265SessionCreateInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265SessionParametersAddInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265SessionParametersCreateInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_FEEDBACK_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265SessionParametersFeedbackInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_GET_INFO_EXT: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeH265SessionParametersGetInfoEXT*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeInfoKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeQualityLevelInfoKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeQualityLevelPropertiesKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeRateControlInfoKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeRateControlLayerInfoKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_FEEDBACK_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeSessionParametersFeedbackInfoKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_GET_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeSessionParametersGetInfoKHR*>(header), offset);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_USAGE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEncodeUsageInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoEndCodingInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoFormatPropertiesKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoPictureResourceInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoProfileInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_LIST_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoProfileListInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoReferenceSlotInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoSessionCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_MEMORY_REQUIREMENTS_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoSessionMemoryRequirementsKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoSessionParametersCreateInfoKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkVideoSessionParametersUpdateInfoKHR*>(header), offset);
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+        case VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkWaylandSurfaceCreateInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV: return DeepCopyStructSize(*reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkWin32SurfaceCreateInfoKHR*>(header), offset);
+#endif
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET: return DeepCopyStructSize(*reinterpret_cast<const VkWriteDescriptorSet*>(header), offset);
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(header), offset);
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV: return DeepCopyStructSize(*reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureNV*>(header), offset);
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK: return DeepCopyStructSize(*reinterpret_cast<const VkWriteDescriptorSetInlineUniformBlock*>(header), offset);
+#ifdef VK_USE_PLATFORM_XCB_KHR
+        case VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkXcbSurfaceCreateInfoKHR*>(header), offset);
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+        case VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR: return DeepCopyStructSize(*reinterpret_cast<const VkXlibSurfaceCreateInfoKHR*>(header), offset);
+#endif
+        default: break;
+      }
+    }
+  }
+
+  inline void* DeepCopyNext(const void* pNext, DeepCopyCursor& cursor) {
+    for (const VkBaseInStructure* header = static_cast<const VkBaseInStructure*>(pNext); header; header = header->pNext) {
+      switch (header->sType) {
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureBuildSizesInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureCaptureDescriptorDataInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureDeviceAddressInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureGeometryAabbsDataKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureGeometryInstancesDataKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureGeometryMotionTrianglesDataNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureGeometryTrianglesDataKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureMemoryRequirementsInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureMotionInfoNV*>(header), cursor);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_DISPLACEMENT_MICROMAP_NV: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureTrianglesDisplacementMicromapNV*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureTrianglesOpacityMicromapEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAccelerationStructureVersionInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAcquireNextImageInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAcquireProfilingLockInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_AMIGO_PROFILING_SUBMIT_INFO_SEC: return DeepCopyStruct(*reinterpret_cast<const VkAmigoProfilingSubmitInfoSEC*>(header), cursor);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkAndroidHardwareBufferFormatProperties2ANDROID*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkAndroidHardwareBufferFormatPropertiesANDROID*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkAndroidHardwareBufferPropertiesANDROID*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkAndroidHardwareBufferUsageANDROID*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkAndroidSurfaceCreateInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_APPLICATION_INFO: return DeepCopyStruct(*reinterpret_cast<const VkApplicationInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2: return DeepCopyStruct(*reinterpret_cast<const VkAttachmentDescription2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT: return DeepCopyStruct(*reinterpret_cast<const VkAttachmentDescriptionStencilLayout*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2: return DeepCopyStruct(*reinterpret_cast<const VkAttachmentReference2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT: return DeepCopyStruct(*reinterpret_cast<const VkAttachmentReferenceStencilLayout*>(header), cursor);
+        case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD: return DeepCopyStruct(*reinterpret_cast<const VkAttachmentSampleCountInfoAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkBindAccelerationStructureMemoryInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBindBufferMemoryDeviceGroupInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBindBufferMemoryInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBindImageMemoryDeviceGroupInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBindImageMemoryInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkBindImageMemorySwapchainInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBindImagePlaneMemoryInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBindSparseInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BIND_VIDEO_SESSION_MEMORY_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkBindVideoSessionMemoryInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkBlitImageInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkBufferCaptureDescriptorDataInfoEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkBufferCollectionBufferCreateInfoFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkBufferCollectionConstraintsInfoFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkBufferCollectionCreateInfoFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkBufferCollectionImageCreateInfoFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkBufferCollectionPropertiesFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkBufferConstraintsInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_BUFFER_COPY_2: return DeepCopyStruct(*reinterpret_cast<const VkBufferCopy2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBufferCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkBufferDeviceAddressCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBufferDeviceAddressInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2: return DeepCopyStruct(*reinterpret_cast<const VkBufferImageCopy2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER: return DeepCopyStruct(*reinterpret_cast<const VkBufferMemoryBarrier*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2: return DeepCopyStruct(*reinterpret_cast<const VkBufferMemoryBarrier2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkBufferMemoryRequirementsInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBufferOpaqueCaptureAddressCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkBufferViewCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkCalibratedTimestampInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV: return DeepCopyStruct(*reinterpret_cast<const VkCheckpointData2NV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV: return DeepCopyStruct(*reinterpret_cast<const VkCheckpointDataNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferInheritanceConditionalRenderingInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferInheritanceInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferInheritanceRenderPassTransformInfoQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferInheritanceRenderingInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferInheritanceViewportScissorInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkCommandBufferSubmitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkCommandPoolCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkComputePipelineCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkConditionalRenderingBeginInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkCooperativeMatrixPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkCopyAccelerationStructureInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkCopyAccelerationStructureToMemoryInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkCopyBufferInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkCopyBufferToImageInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkCopyCommandTransformInfoQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET: return DeepCopyStruct(*reinterpret_cast<const VkCopyDescriptorSet*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkCopyImageInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkCopyImageToBufferInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkCopyMemoryToAccelerationStructureInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_MICROMAP_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkCopyMemoryToMicromapInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_MICROMAP_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkCopyMicromapInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_COPY_MICROMAP_TO_MEMORY_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkCopyMicromapToMemoryInfoEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkD3D12FenceSubmitInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugMarkerMarkerInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugMarkerObjectNameInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugMarkerObjectTagInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugUtilsLabelEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugUtilsMessengerCallbackDataEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugUtilsObjectNameInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDebugUtilsObjectTagInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkDedicatedAllocationBufferCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkDedicatedAllocationImageCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEPENDENCY_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDependencyInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorAddressInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorBufferBindingInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorBufferBindingPushDescriptorBufferHandleEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorPoolCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorPoolInlineUniformBlockCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_BINDING_REFERENCE_VALVE: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetBindingReferenceVALVE*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetLayoutCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_HOST_MAPPING_INFO_VALVE: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetLayoutHostMappingInfoVALVE*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetLayoutSupport*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetVariableDescriptorCountAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorSetVariableDescriptorCountLayoutSupport*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDescriptorUpdateTemplateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_ADDRESS_BINDING_CALLBACK_DATA_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDeviceAddressBindingCallbackDataEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS: return DeepCopyStruct(*reinterpret_cast<const VkDeviceBufferMemoryRequirements*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDeviceDeviceMemoryReportCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkDeviceDiagnosticsConfigCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDeviceEventInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_FAULT_COUNTS_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDeviceFaultCountsEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupBindSparseInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupCommandBufferBeginInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupDeviceCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupPresentCapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupPresentInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupRenderPassBeginInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupSubmitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDeviceGroupSwapchainCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS: return DeepCopyStruct(*reinterpret_cast<const VkDeviceImageMemoryRequirements*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceMemoryOpaqueCaptureAddressInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD: return DeepCopyStruct(*reinterpret_cast<const VkDeviceMemoryOverallocationCreateInfoAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDeviceMemoryReportCallbackDataEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDevicePrivateDataCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkDeviceQueueCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDeviceQueueGlobalPriorityCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkDeviceQueueInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_INFO_LUNARG: return DeepCopyStruct(*reinterpret_cast<const VkDirectDriverLoadingInfoLUNARG*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_LIST_LUNARG: return DeepCopyStruct(*reinterpret_cast<const VkDirectDriverLoadingListLUNARG*>(header), cursor);
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+        case VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDirectFBSurfaceCreateInfoEXT*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDisplayEventInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayModeCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayModeProperties2KHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD: return DeepCopyStruct(*reinterpret_cast<const VkDisplayNativeHdrSurfaceCapabilitiesAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayPlaneCapabilities2KHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayPlaneInfo2KHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayPlaneProperties2KHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDisplayPowerInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayPresentInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplayProperties2KHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkDisplaySurfaceCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDrmFormatModifierPropertiesList2EXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT: return DeepCopyStruct(*reinterpret_cast<const VkDrmFormatModifierPropertiesListEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkEventCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkExportFenceCreateInfo*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkExportFenceWin32HandleInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkExportMemoryAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkExportMemoryAllocateInfoNV*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkExportMemoryWin32HandleInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkExportMemoryWin32HandleInfoNV*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalBufferInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_COMMAND_QUEUE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalCommandQueueInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_DEVICE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalDeviceInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalIOSurfaceInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalObjectCreateInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECTS_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalObjectsInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalSharedEventInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExportMetalTextureInfoEXT*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkExportSemaphoreCreateInfo*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkExportSemaphoreWin32HandleInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkExternalBufferProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkExternalFenceProperties*>(header), cursor);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkExternalFormatANDROID*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkExternalImageFormatProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT: return DeepCopyStruct(*reinterpret_cast<const VkExternalMemoryAcquireUnmodifiedEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkExternalMemoryBufferCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkExternalMemoryImageCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkExternalMemoryImageCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkExternalSemaphoreProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkFenceCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkFenceGetFdInfoKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkFenceGetWin32HandleInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkFilterCubicImageViewImageFormatPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2: return DeepCopyStruct(*reinterpret_cast<const VkFormatProperties2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3: return DeepCopyStruct(*reinterpret_cast<const VkFormatProperties3*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkFragmentShadingRateAttachmentInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkFramebufferAttachmentImageInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkFramebufferAttachmentsCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkFramebufferCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV: return DeepCopyStruct(*reinterpret_cast<const VkFramebufferMixedSamplesCombinationNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkGeneratedCommandsInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkGeneratedCommandsMemoryRequirementsInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV: return DeepCopyStruct(*reinterpret_cast<const VkGeometryAABBNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GEOMETRY_NV: return DeepCopyStruct(*reinterpret_cast<const VkGeometryNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV: return DeepCopyStruct(*reinterpret_cast<const VkGeometryTrianglesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkGraphicsPipelineCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkGraphicsPipelineLibraryCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkGraphicsPipelineShaderGroupsCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkGraphicsShaderGroupCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_HDR_METADATA_EXT: return DeepCopyStruct(*reinterpret_cast<const VkHdrMetadataEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkHeadlessSurfaceCreateInfoEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_IOS_MVK
+        case VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK: return DeepCopyStruct(*reinterpret_cast<const VkIOSSurfaceCreateInfoMVK*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_BLIT_2: return DeepCopyStruct(*reinterpret_cast<const VkImageBlit2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageCaptureDescriptorDataInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageCompressionControlEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageCompressionPropertiesEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkImageConstraintsInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_COPY_2: return DeepCopyStruct(*reinterpret_cast<const VkImageCopy2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkImageCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageDrmFormatModifierExplicitCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageDrmFormatModifierListCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageDrmFormatModifierPropertiesEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkImageFormatConstraintsInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkImageFormatListCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2: return DeepCopyStruct(*reinterpret_cast<const VkImageFormatProperties2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER: return DeepCopyStruct(*reinterpret_cast<const VkImageMemoryBarrier*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2: return DeepCopyStruct(*reinterpret_cast<const VkImageMemoryBarrier2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkImageMemoryRequirementsInfo2*>(header), cursor);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkImagePipeSurfaceCreateInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO: return DeepCopyStruct(*reinterpret_cast<const VkImagePlaneMemoryRequirementsInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2: return DeepCopyStruct(*reinterpret_cast<const VkImageResolve2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkImageSparseMemoryRequirementsInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkImageStencilUsageCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_SUBRESOURCE_2_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageSubresource2EXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImageSwapchainCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageViewASTCDecodeModeEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageViewCaptureDescriptorDataInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkImageViewCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageViewMinLodCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkImageViewSampleWeightCreateInfoQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImageViewSlicedCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkImageViewUsageCreateInfo*>(header), cursor);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkImportAndroidHardwareBufferInfoANDROID*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImportFenceFdInfoKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImportFenceWin32HandleInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkImportMemoryBufferCollectionFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImportMemoryFdInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImportMemoryHostPointerInfoEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImportMemoryWin32HandleInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkImportMemoryWin32HandleInfoNV*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkImportMemoryZirconHandleInfoFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_BUFFER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImportMetalBufferInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_IO_SURFACE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImportMetalIOSurfaceInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_SHARED_EVENT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImportMetalSharedEventInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_IMPORT_METAL_TEXTURE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkImportMetalTextureInfoEXT*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImportSemaphoreFdInfoKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkImportSemaphoreWin32HandleInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkImportSemaphoreZirconHandleInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkIndirectCommandsLayoutCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV: return DeepCopyStruct(*reinterpret_cast<const VkIndirectCommandsLayoutTokenNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkInitializePerformanceApiInfoINTEL*>(header), cursor);
+        case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkInstanceCreateInfo*>(header), cursor);
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+        case VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK: return DeepCopyStruct(*reinterpret_cast<const VkMacOSSurfaceCreateInfoMVK*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE: return DeepCopyStruct(*reinterpret_cast<const VkMappedMemoryRange*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO: return DeepCopyStruct(*reinterpret_cast<const VkMemoryAllocateFlagsInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkMemoryAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER: return DeepCopyStruct(*reinterpret_cast<const VkMemoryBarrier*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2: return DeepCopyStruct(*reinterpret_cast<const VkMemoryBarrier2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkMemoryDedicatedAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS: return DeepCopyStruct(*reinterpret_cast<const VkMemoryDedicatedRequirements*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkMemoryFdPropertiesKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+        case VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return DeepCopyStruct(*reinterpret_cast<const VkMemoryGetAndroidHardwareBufferInfoANDROID*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkMemoryGetFdInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkMemoryGetRemoteAddressInfoNV*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkMemoryGetWin32HandleInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkMemoryGetZirconHandleInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMemoryHostPointerPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_MAP_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkMemoryMapInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkMemoryOpaqueCaptureAddressAllocateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMemoryPriorityAllocateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2: return DeepCopyStruct(*reinterpret_cast<const VkMemoryRequirements2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkMemoryUnmapInfoKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkMemoryWin32HandlePropertiesKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkMemoryZirconHandlePropertiesFUCHSIA*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+        case VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMetalSurfaceCreateInfoEXT*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_MICROMAP_BUILD_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMicromapBuildInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MICROMAP_BUILD_SIZES_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMicromapBuildSizesInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MICROMAP_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMicromapCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MICROMAP_VERSION_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMicromapVersionInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMultisamplePropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMultisampledRenderToSingleSampledInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX: return DeepCopyStruct(*reinterpret_cast<const VkMultiviewPerViewAttributesInfoNVX*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_RENDER_AREAS_RENDER_PASS_BEGIN_INFO_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkMutableDescriptorTypeCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkOpaqueCaptureDescriptorDataCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_EXECUTE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkOpticalFlowExecuteInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkOpticalFlowImageFormatInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkOpticalFlowImageFormatPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkOpticalFlowSessionCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_PRIVATE_DATA_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkOpticalFlowSessionCreatePrivateDataInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceConfigurationAcquireInfoINTEL*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceCounterDescriptionKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceCounterKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceMarkerInfoINTEL*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceOverrideInfoINTEL*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceQuerySubmitInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkPerformanceStreamMarkerInfoINTEL*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevice16BitStorageFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevice4444FormatsFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevice8BitStorageFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceASTCDecodeFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceAccelerationStructureFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceAccelerationStructurePropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceAddressBindingReportFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_AMIGO_PROFILING_FEATURES_SEC: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceAmigoProfilingFeaturesSEC*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_DYNAMIC_STATE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceBorderColorSwizzleFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_FEATURES_HUAWEI: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_PROPERTIES_HUAWEI: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCoherentMemoryFeaturesAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceColorWriteEnableFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceConditionalRenderingFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceConservativeRasterizationPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCopyMemoryIndirectFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCopyMemoryIndirectPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCornerSampledImageFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCoverageReductionModeFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCustomBorderColorFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceCustomBorderColorPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDepthClampZeroOneFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDepthClipControlFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDepthClipEnableFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDepthStencilResolveProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_DENSITY_MAP_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDescriptorBufferFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDescriptorBufferPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDiagnosticsConfigFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDiscardRectanglePropertiesEXT*>(header), cursor);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDisplacementMicromapFeaturesNV*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDisplacementMicromapPropertiesNV*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDriverProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDrmPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDynamicRenderingFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExclusiveScissorFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState2FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicState3PropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExternalBufferInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExternalFenceInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExternalMemoryHostPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExternalMemoryRDMAFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceExternalSemaphoreInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFaultFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFeatures2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFloatControlsProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceFragmentShadingRatePropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceGroupProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceHostQueryResetFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceIDProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImage2DViewOf3DFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageCompressionControlFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageDrmFormatModifierInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageFormatInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_FEATURES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageProcessingFeaturesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_PROPERTIES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageProcessingPropertiesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageRobustnessFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_SLICED_VIEW_OF_3D_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageViewImageFormatInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImageViewMinLodFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceImagelessFramebufferFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceIndexTypeUint8FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceInheritedViewportScissorFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceInvocationMaskFeaturesHUAWEI*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceLegacyDitheringFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceLineRasterizationFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceLineRasterizationPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceLinearColorAttachmentFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMaintenance3Properties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMaintenance4Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMaintenance4Properties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMemoryBudgetPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMemoryDecompressionFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMemoryDecompressionPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMemoryPriorityFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMemoryProperties2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultiDrawFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultiDrawPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultiviewFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_RENDER_AREAS_FEATURES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_VIEWPORTS_FEATURES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMultiviewProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NON_SEAMLESS_CUBE_MAP_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceOpacityMicromapFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceOpacityMicromapPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceOpticalFlowFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceOpticalFlowPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePCIBusInfoPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePerformanceQueryFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePerformanceQueryPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelineCreationCacheControlFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_LIBRARY_GROUP_HANDLES_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROPERTIES_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelinePropertiesFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelineProtectedAccessFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelineRobustnessFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePipelineRobustnessPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePointClippingProperties*>(header), cursor);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePortabilitySubsetFeaturesKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePortabilitySubsetPropertiesKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_BARRIER_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePresentBarrierFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePresentIdFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePresentWaitFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePrivateDataFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceProperties2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceProtectedMemoryFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceProtectedMemoryProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceProvokingVertexFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceProvokingVertexPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDevicePushDescriptorPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayQueryFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MAINTENANCE_1_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingMotionBlurFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingPipelineFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingPipelinePropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_POSITION_FETCH_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRayTracingPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRobustness2FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceRobustness2PropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSampleLocationsPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSamplerFilterMinmaxProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSamplerYcbcrConversionFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceScalarBlockLayoutFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderAtomicInt64Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderClockFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_FEATURES_ARM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_PROPERTIES_ARM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderCoreProperties2AMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_ARM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesARM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderDrawParametersFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EARLY_AND_LATE_FRAGMENT_TESTS_FEATURES_AMD: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderFloat16Int8Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderImageFootprintFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderIntegerDotProductProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderObjectFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderObjectPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderTerminateInvocationFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderTileImageFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShaderTileImagePropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShadingRateImageFeaturesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceShadingRateImagePropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSparseImageFormatInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSubgroupProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSubpassShadingFeaturesHUAWEI*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSubpassShadingPropertiesHUAWEI*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSurfaceInfo2KHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceSynchronization2Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTextureCompressionASTCHDRFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_PROPERTIES_FEATURES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTilePropertiesFeaturesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceToolProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTransformFeedbackFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceTransformFeedbackPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceUniformBufferStandardLayoutFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVariablePointersFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT*>(header), cursor);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVideoFormatInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkan11Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkan11Properties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkan12Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkan12Properties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkan13Features*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkan13Properties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceVulkanMemoryModelFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES: return DeepCopyStruct(*reinterpret_cast<const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineCacheCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineColorBlendAdvancedStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineColorBlendStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineColorWriteCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD: return DeepCopyStruct(*reinterpret_cast<const VkPipelineCompilerControlCreateInfoAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineCoverageModulationStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineCoverageReductionStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineCoverageToColorStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineCreationFeedbackCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineDepthStencilStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineDiscardRectangleStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineDynamicStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineExecutableInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineExecutableInternalRepresentationKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineExecutablePropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineExecutableStatisticKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineFragmentShadingRateEnumStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineFragmentShadingRateStateCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineInputAssemblyStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineLayoutCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPipelineLibraryCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineMultisampleStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_PROPERTIES_IDENTIFIER_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelinePropertiesIdentifierEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationConservativeStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationDepthClipStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationLineStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationProvokingVertexStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationStateRasterizationOrderAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRasterizationStateStreamCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRenderingCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRepresentativeFragmentTestStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineRobustnessCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineSampleLocationsStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineShaderStageCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineShaderStageModuleIdentifierCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineTessellationDomainOriginStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineTessellationStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineVertexInputStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportDepthClipControlCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportExclusiveScissorStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportShadingRateImageStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportStateCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportSwizzleStateCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkPipelineViewportWScalingStateCreateInfoNV*>(header), cursor);
+#ifdef VK_USE_PLATFORM_GGP
+        case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP: return DeepCopyStruct(*reinterpret_cast<const VkPresentFrameTokenGGP*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_PRESENT_ID_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPresentIdKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPresentInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR: return DeepCopyStruct(*reinterpret_cast<const VkPresentRegionsKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE: return DeepCopyStruct(*reinterpret_cast<const VkPresentTimesInfoGOOGLE*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkPrivateDataSlotCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkProtectedSubmitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUERY_LOW_LATENCY_SUPPORT_NV: return DeepCopyStruct(*reinterpret_cast<const VkQueryLowLatencySupportNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkQueryPoolCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkQueryPoolPerformanceCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL: return DeepCopyStruct(*reinterpret_cast<const VkQueryPoolPerformanceQueryCreateInfoINTEL*>(header), cursor);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_QUERY_POOL_VIDEO_ENCODE_FEEDBACK_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkQueryPoolVideoEncodeFeedbackCreateInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV: return DeepCopyStruct(*reinterpret_cast<const VkQueueFamilyCheckpointProperties2NV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV: return DeepCopyStruct(*reinterpret_cast<const VkQueueFamilyCheckpointPropertiesNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkQueueFamilyGlobalPriorityPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2: return DeepCopyStruct(*reinterpret_cast<const VkQueueFamilyProperties2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkQueueFamilyQueryResultStatusPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkQueueFamilyVideoPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkRayTracingPipelineCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkRayTracingPipelineCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkRayTracingPipelineInterfaceCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkRayTracingShaderGroupCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkRayTracingShaderGroupCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RELEASE_SWAPCHAIN_IMAGES_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkReleaseSwapchainImagesInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassAttachmentBeginInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassBeginInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassCreateInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_CONTROL_EXT: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassCreationControlEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_FEEDBACK_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassCreationFeedbackCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassFragmentDensityMapCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassInputAttachmentAspectCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassMultiviewCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassSampleLocationsBeginInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SUBPASS_FEEDBACK_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassSubpassFeedbackCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkRenderPassTransformBeginInfoQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderingAttachmentInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkRenderingFragmentDensityMapAttachmentInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkRenderingFragmentShadingRateAttachmentInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RENDERING_INFO: return DeepCopyStruct(*reinterpret_cast<const VkRenderingInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkResolveImageInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSampleLocationsInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSamplerBorderColorComponentMappingCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSamplerCaptureDescriptorDataInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSamplerCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSamplerReductionModeCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSamplerYcbcrConversionCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES: return DeepCopyStruct(*reinterpret_cast<const VkSamplerYcbcrConversionImageFormatProperties*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSamplerYcbcrConversionInfo*>(header), cursor);
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+        case VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX: return DeepCopyStruct(*reinterpret_cast<const VkScreenSurfaceCreateInfoQNX*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreGetFdInfoKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreGetWin32HandleInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreGetZirconHandleInfoFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreSignalInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreSubmitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreTypeCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSemaphoreWaitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkShaderCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO: return DeepCopyStruct(*reinterpret_cast<const VkShaderModuleCreateInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT: return DeepCopyStruct(*reinterpret_cast<const VkShaderModuleIdentifierEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkShaderModuleValidationCacheCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSharedPresentSurfaceCapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2: return DeepCopyStruct(*reinterpret_cast<const VkSparseImageFormatProperties2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2: return DeepCopyStruct(*reinterpret_cast<const VkSparseImageMemoryRequirements2*>(header), cursor);
+#ifdef VK_USE_PLATFORM_GGP
+        case VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP: return DeepCopyStruct(*reinterpret_cast<const VkStreamDescriptorSurfaceCreateInfoGGP*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_SUBMIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSubmitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBMIT_INFO_2: return DeepCopyStruct(*reinterpret_cast<const VkSubmitInfo2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSubpassBeginInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2: return DeepCopyStruct(*reinterpret_cast<const VkSubpassDependency2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2: return DeepCopyStruct(*reinterpret_cast<const VkSubpassDescription2*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE: return DeepCopyStruct(*reinterpret_cast<const VkSubpassDescriptionDepthStencilResolve*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_END_INFO: return DeepCopyStruct(*reinterpret_cast<const VkSubpassEndInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkSubpassFragmentDensityMapOffsetEndInfoQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_RESOLVE_PERFORMANCE_QUERY_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSubpassResolvePerformanceQueryEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI: return DeepCopyStruct(*reinterpret_cast<const VkSubpassShadingPipelineCreateInfoHUAWEI*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SUBRESOURCE_LAYOUT_2_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSubresourceLayout2EXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceCapabilities2EXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceCapabilities2KHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceCapabilitiesFullScreenExclusiveEXT*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_BARRIER_NV: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceCapabilitiesPresentBarrierNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceFormat2KHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceFullScreenExclusiveInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceFullScreenExclusiveWin32InfoEXT*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_COMPATIBILITY_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfacePresentModeCompatibilityEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfacePresentModeEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SURFACE_PRESENT_SCALING_CAPABILITIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSurfacePresentScalingCapabilitiesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSurfaceProtectedCapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainCounterCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainDisplayNativeHdrCreateInfoAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_BARRIER_CREATE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainPresentBarrierCreateInfoNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainPresentFenceInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainPresentModeInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODES_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainPresentModesCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_SCALING_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkSwapchainPresentScalingCreateInfoEXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+        case VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA: return DeepCopyStruct(*reinterpret_cast<const VkSysmemColorSpaceFUCHSIA*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD: return DeepCopyStruct(*reinterpret_cast<const VkTextureLODGatherFormatPropertiesAMD*>(header), cursor);
+        case VK_STRUCTURE_TYPE_TILE_PROPERTIES_QCOM: return DeepCopyStruct(*reinterpret_cast<const VkTilePropertiesQCOM*>(header), cursor);
+        case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO: return DeepCopyStruct(*reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkValidationCacheCreateInfoEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkValidationFeaturesEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT: return DeepCopyStruct(*reinterpret_cast<const VkValidationFlagsEXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVertexInputAttributeDescription2EXT*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVertexInputBindingDescription2EXT*>(header), cursor);
+#ifdef VK_USE_PLATFORM_VI_NN
+        case VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN: return DeepCopyStruct(*reinterpret_cast<const VkViSurfaceCreateInfoNN*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoBeginCodingInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoCapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoCodingControlInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeCapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH264CapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH264DpbSlotInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH264PictureInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH264ProfileInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH264SessionParametersAddInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH264SessionParametersCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH265CapabilitiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH265DpbSlotInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH265PictureInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH265ProfileInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH265SessionParametersAddInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeH265SessionParametersCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_DECODE_USAGE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoDecodeUsageInfoKHR*>(header), cursor);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeCapabilitiesKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264CapabilitiesEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264DpbSlotInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_GOP_REMAINING_FRAME_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264GopRemainingFrameInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264NaluSliceInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PICTURE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264PictureInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264ProfileInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUALITY_LEVEL_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264QualityLevelPropertiesEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264RateControlInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264RateControlLayerInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264SessionCreateInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264SessionParametersAddInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264SessionParametersCreateInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_FEEDBACK_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264SessionParametersFeedbackInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_GET_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH264SessionParametersGetInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265CapabilitiesEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265DpbSlotInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_GOP_REMAINING_FRAME_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265GopRemainingFrameInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_SEGMENT_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265NaluSliceSegmentInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PICTURE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265PictureInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265ProfileInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUALITY_LEVEL_PROPERTIES_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265QualityLevelPropertiesEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265RateControlInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265RateControlLayerInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265SessionCreateInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265SessionParametersAddInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265SessionParametersCreateInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_FEEDBACK_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265SessionParametersFeedbackInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_GET_INFO_EXT: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeH265SessionParametersGetInfoEXT*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeQualityLevelInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeQualityLevelPropertiesKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeRateControlInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeRateControlLayerInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_FEEDBACK_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeSessionParametersFeedbackInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_GET_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeSessionParametersGetInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+        case VK_STRUCTURE_TYPE_VIDEO_ENCODE_USAGE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEncodeUsageInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoEndCodingInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoFormatPropertiesKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoPictureResourceInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoProfileInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_PROFILE_LIST_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoProfileListInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoReferenceSlotInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoSessionCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_MEMORY_REQUIREMENTS_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoSessionMemoryRequirementsKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoSessionParametersCreateInfoKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkVideoSessionParametersUpdateInfoKHR*>(header), cursor);
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+        case VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkWaylandSurfaceCreateInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV: return DeepCopyStruct(*reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+        case VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkWin32SurfaceCreateInfoKHR*>(header), cursor);
+#endif
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET: return DeepCopyStruct(*reinterpret_cast<const VkWriteDescriptorSet*>(header), cursor);
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR: return DeepCopyStruct(*reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(header), cursor);
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV: return DeepCopyStruct(*reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureNV*>(header), cursor);
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK: return DeepCopyStruct(*reinterpret_cast<const VkWriteDescriptorSetInlineUniformBlock*>(header), cursor);
+#ifdef VK_USE_PLATFORM_XCB_KHR
+        case VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkXcbSurfaceCreateInfoKHR*>(header), cursor);
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+        case VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR: return DeepCopyStruct(*reinterpret_cast<const VkXlibSurfaceCreateInfoKHR*>(header), cursor);
+#endif
+        default: break;
+      }
+    }
+    return nullptr;
+  }
+}
+
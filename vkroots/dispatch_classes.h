@@ -0,0 +1,6911 @@
+// Part of vkroots.h, generated by gen/make_vkroots.
+
+#pragma once
+
+#include "core.h"
+
+namespace vkroots {
+
+#ifndef VKROOTS_CACHE_LINE_SIZE
+#define VKROOTS_CACHE_LINE_SIZE 64
+#endif
+
+  namespace tables {
+
+    template <typename T>
+    class RawPointer {
+    public:
+      RawPointer(T* value = nullptr) : m_value(value) {}
+            T* get()       { return m_value; }
+      const T* get() const { return m_value; }
+    private:
+      T* m_value;
+    };
+
+    // Open-addressing hash map keyed on Vulkan handles.
+    // Slots are stored inline (a handle and a pointer-sized value), probed
+    // linearly and erased with backward shifting, so lookups touch one or two
+    // cache lines and there are no per-entry allocations or tombstones.
+    template <typename Key, typename Value>
+    class VkHandleMap {
+      static_assert(sizeof(Key) <= sizeof(uint64_t));
+    public:
+      Value* find(Key key) {
+        return const_cast<Value*>(std::as_const(*this).find(key));
+      }
+      const Value* find(Key key) const {
+        if (!m_size)
+          return nullptr;
+        for (size_t i = index(key); ; i = (i + 1) & mask()) {
+          const Slot& slot = m_slots[i];
+          if (slot.key == key)
+            return &slot.value;
+          if (slot.key == Key{})
+            return nullptr;
+        }
+      }
+      // Does not replace an existing entry, like std::unordered_map::insert.
+      bool insert(Key key, Value value) {
+        assert(key != Key{});
+        if ((m_size + 1) * 2 > m_slots.size())
+          rehash(std::max<size_t>(m_slots.size() * 2, 8));
+        for (size_t i = index(key); ; i = (i + 1) & mask()) {
+          Slot& slot = m_slots[i];
+          if (slot.key == key)
+            return false;
+          if (slot.key == Key{}) {
+            slot.key = key;
+            slot.value = std::move(value);
+            m_size++;
+            return true;
+          }
+        }
+      }
+      bool erase(Key key) {
+        if (!m_size)
+          return false;
+        size_t i = index(key);
+        for (; m_slots[i].key != key; i = (i + 1) & mask()) {
+          if (m_slots[i].key == Key{})
+            return false;
+        }
+        // Shift back any following entries that would no longer be reachable.
+        for (size_t j = (i + 1) & mask(); m_slots[j].key != Key{}; j = (j + 1) & mask()) {
+          const size_t ideal = index(m_slots[j].key);
+          if (((j - ideal) & mask()) >= ((j - i) & mask())) {
+            m_slots[i] = std::move(m_slots[j]);
+            i = j;
+          }
+        }
+        m_slots[i] = Slot{};
+        m_size--;
+        return true;
+      }
+      template <typename Func>
+      void forEach(Func func) const {
+        for (const Slot& slot : m_slots) {
+          if (slot.key != Key{})
+            func(slot.key, slot.value);
+        }
+      }
+      void reserve(size_t count) {
+        if (count * 2 > m_slots.size())
+          rehash(std::bit_ceil(std::max<size_t>(count * 2, 8)));
+      }
+      size_t size() const { return m_size; }
+    private:
+      struct Slot {
+        Key key{};
+        Value value{};
+      };
+
+      size_t mask() const { return m_slots.size() - 1; }
+
+      size_t index(Key key) const {
+        uint64_t value;
+        if constexpr (std::is_pointer<Key>::value)
+          value = reinterpret_cast<uintptr_t>(key);
+        else
+          value = static_cast<uint64_t>(key);
+        // Handles are heap allocations, the low alignment bits carry no information.
+        // Fibonacci hashing spreads the rest over the table.
+        return size_t(((value >> 4) * 0x9E3779B97F4A7C15ull) >> m_shift);
+      }
+
+      void rehash(size_t capacity) {
+        std::vector<Slot> slots(capacity);
+        std::swap(m_slots, slots);
+        m_shift = 64 - std::countr_zero(capacity);
+        m_size = 0;
+        for (Slot& slot : slots) {
+          if (slot.key != Key{})
+            insert(slot.key, std::move(slot.value));
+        }
+      }
+
+      std::vector<Slot> m_slots;
+      size_t m_size = 0;
+      uint32_t m_shift = 64;
+    };
+
+    // Bulk inserts take either one dispatch for every object or one per object.
+    template <typename DispatchType>
+    inline const DispatchType* dispatchAt(const DispatchType* dispatch, uint32_t) { return dispatch; }
+    template <typename DispatchType>
+    inline const DispatchType* dispatchAt(const DispatchType* const* ppDispatches, uint32_t i) { return ppDispatches[i]; }
+
+    template <typename Object, typename DispatchPtr, typename Dispatches>
+    inline void insertOrAssign(VkHandleMap<Object, DispatchPtr>& map, uint32_t count, const Object* pObjs, Dispatches dispatches) {
+      map.reserve(map.size() + count);
+      for (uint32_t i = 0; i < count; i++) {
+        assert(pObjs[i]);
+        if (DispatchPtr* val = map.find(pObjs[i]))
+          *val = DispatchPtr(dispatchAt(dispatches, i));
+        else
+          map.insert(pObjs[i], DispatchPtr(dispatchAt(dispatches, i)));
+      }
+    }
+
+#if VKROOTS_USE_RCU_DISPATCH_MAP
+    // Epoch based reclamation for VkDispatchTableMap snapshots.
+    // Each thread that reads a map owns a reader record which publishes the
+    // global epoch it observed while it is inside find.
+    // A retired snapshot is only freed once no reader is still inside an
+    // epoch that could have observed it.
+    class VkDispatchEpoch {
+      struct Reader {
+        std::atomic<uint64_t> epoch{ 0 };
+        std::atomic<bool> inUse{ true };
+        Reader* next = nullptr;
+      };
+
+    public:
+      class ReadGuard {
+      public:
+        ReadGuard() : m_reader{ VkDispatchEpoch::threadReader() } {
+          m_reader->epoch.store(s_epoch.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        }
+        ~ReadGuard() {
+          m_reader->epoch.store(0, std::memory_order_release);
+        }
+      private:
+        Reader* m_reader;
+      };
+
+      // Returns the epoch that things retired now are tagged with.
+      static uint64_t retire() {
+        return s_epoch.fetch_add(1, std::memory_order_seq_cst);
+      }
+
+      // Whether no reader can still be holding something retired in epoch.
+      static bool quiescent(uint64_t epoch) {
+        for (Reader* reader = s_readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+          uint64_t readerEpoch = reader->epoch.load(std::memory_order_seq_cst);
+          if (readerEpoch && readerEpoch <= epoch)
+            return false;
+        }
+        return true;
+      }
+    private:
+      // Records are never freed, only recycled when their thread exits.
+      static Reader* acquireReader() {
+        for (Reader* reader = s_readers.load(std::memory_order_acquire); reader; reader = reader->next) {
+          bool expected = false;
+          if (!reader->inUse.load(std::memory_order_relaxed) && reader->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            return reader;
+        }
+        Reader* reader = new Reader;
+        reader->next = s_readers.load(std::memory_order_relaxed);
+        while (!s_readers.compare_exchange_weak(reader->next, reader, std::memory_order_release, std::memory_order_relaxed))
+          ;
+        return reader;
+      }
+
+      struct ThreadReader {
+        Reader* reader = acquireReader();
+        ~ThreadReader() { reader->inUse.store(false, std::memory_order_release); }
+      };
+
+      static Reader* threadReader() {
+        static thread_local ThreadReader t_reader;
+        return t_reader.reader;
+      }
+
+      static inline std::atomic<uint64_t> s_epoch{ 1 };
+      static inline std::atomic<Reader*> s_readers{ nullptr };
+    };
+
+    // Copy-on-write dispatch map.
+    // find is a wait-free load of an immutable snapshot, insert and remove
+    // build and publish a new snapshot under the writer lock, and the old one
+    // is freed once every reader that could have seen it has left.
+    template <typename Object, typename DispatchType, typename DispatchPtr>
+    class VkDispatchTableMap {
+      using Snapshot = VkHandleMap<Object, const DispatchType*>;
+    public:
+      ~VkDispatchTableMap() {
+        delete m_snapshot.load(std::memory_order_relaxed);
+        for (auto& retired : m_retired)
+          delete retired.second;
+      }
+
+      const DispatchType* insert(Object obj, DispatchPtr ptr) {
+        assert(obj);
+        auto lock = std::unique_lock(m_mutex);
+        const DispatchType* val = ptr.get();
+        m_map.insert(obj, std::move(ptr));
+        publish();
+        return val;
+      }
+      void remove(Object obj) {
+        assert(obj);
+        auto lock = std::unique_lock(m_mutex);
+        if (m_map.erase(obj))
+          publish();
+      }
+      // Maps every object to the same dispatch, or each to its own, publishing once.
+      // Unlike the single insert, this replaces existing entries.
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* dispatch) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, dispatch);
+        publish();
+      }
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* const* ppDispatches) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, ppDispatches);
+        publish();
+      }
+      void remove(uint32_t count, const Object* pObjs) {
+        auto lock = std::unique_lock(m_mutex);
+        bool erased = false;
+        for (uint32_t i = 0; i < count; i++)
+          erased |= pObjs[i] && m_map.erase(pObjs[i]);
+        if (erased)
+          publish();
+      }
+      const DispatchType* find(Object obj) const {
+        if (!obj) return nullptr;
+        VkDispatchEpoch::ReadGuard guard;
+        const Snapshot* snapshot = m_snapshot.load(std::memory_order_seq_cst);
+        if (!snapshot)
+          return nullptr;
+        const DispatchType* const* val = snapshot->find(obj);
+        return val ? *val : nullptr;
+      }
+      // The only dispatch in the map, if there is exactly one.
+      const DispatchType* single() const {
+        return m_single.load(std::memory_order_acquire);
+      }
+    private:
+      static const DispatchType* onlyDispatch(const Snapshot& snapshot) {
+        const DispatchType* val = nullptr;
+        snapshot.forEach([&](Object, const DispatchType* dispatch) { val = dispatch; });
+        return val;
+      }
+
+      void publish() {
+        Snapshot* snapshot = new Snapshot;
+        snapshot->reserve(m_map.size());
+        m_map.forEach([&](Object obj, const DispatchPtr& ptr) { snapshot->insert(obj, ptr.get()); });
+        m_single.store(m_map.size() == 1 ? onlyDispatch(*snapshot) : nullptr, std::memory_order_release);
+        const Snapshot* old = m_snapshot.exchange(snapshot, std::memory_order_seq_cst);
+        if (old)
+          m_retired.emplace_back(VkDispatchEpoch::retire(), old);
+        std::erase_if(m_retired, [](const auto& retired) {
+          if (!VkDispatchEpoch::quiescent(retired.first))
+            return false;
+          delete retired.second;
+          return true;
+        });
+      }
+
+      VkHandleMap<Object, DispatchPtr> m_map;
+      std::atomic<const Snapshot*> m_snapshot{ nullptr };
+      std::atomic<const DispatchType*> m_single{ nullptr };
+      std::vector<std::pair<uint64_t, const Snapshot*>> m_retired;
+      std::mutex m_mutex;
+    };
+#else
+    template <typename Object, typename DispatchType, typename DispatchPtr>
+    class VkDispatchTableMap {
+    public:
+      const DispatchType* insert(Object obj, DispatchPtr ptr) {
+        assert(obj);
+        auto lock = std::unique_lock(m_mutex);
+        const DispatchType* val = ptr.get();
+        m_map.insert(obj, std::move(ptr));
+        updateSingle();
+        return val;
+      }
+      void remove(Object obj) {
+        assert(obj);
+        auto lock = std::unique_lock(m_mutex);
+        m_map.erase(obj);
+        updateSingle();
+      }
+      // Maps every object to the same dispatch, or each to its own, under one lock.
+      // Unlike the single insert, this replaces existing entries.
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* dispatch) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, dispatch);
+        updateSingle();
+      }
+      void insert(uint32_t count, const Object* pObjs, const DispatchType* const* ppDispatches) {
+        auto lock = std::unique_lock(m_mutex);
+        insertOrAssign(m_map, count, pObjs, ppDispatches);
+        updateSingle();
+      }
+      void remove(uint32_t count, const Object* pObjs) {
+        auto lock = std::unique_lock(m_mutex);
+        for (uint32_t i = 0; i < count; i++) {
+          if (pObjs[i])
+            m_map.erase(pObjs[i]);
+        }
+        updateSingle();
+      }
+      const DispatchType* find(Object obj) const {
+        if (!obj) return nullptr;
+        auto lock = std::unique_lock(m_mutex);
+        const DispatchPtr* val = m_map.find(obj);
+        return val ? val->get() : nullptr;
+      }
+      // The only dispatch in the map, if there is exactly one.
+      const DispatchType* single() const {
+        return m_single.load(std::memory_order_acquire);
+      }
+    private:
+      void updateSingle() {
+        const DispatchType* val = nullptr;
+        if (m_map.size() == 1)
+          m_map.forEach([&](Object, const DispatchPtr& ptr) { val = ptr.get(); });
+        m_single.store(val, std::memory_order_release);
+      }
+
+      VkHandleMap<Object, DispatchPtr> m_map;
+      std::atomic<const DispatchType*> m_single{ nullptr };
+      mutable std::mutex m_mutex;
+    };
+#endif
+
+#if VKROOTS_USE_DISPATCH_KEY
+#ifndef VKROOTS_DISPATCH_KEY_TABLE_SIZE
+#define VKROOTS_DISPATCH_KEY_TABLE_SIZE 64
+#endif
+
+    // Every dispatchable handle points to an object whose first member is the
+    // loader's dispatch table pointer, which is shared between an instance and
+    // its physical devices, and between a device and its queues/command buffers.
+    inline void* GetDispatchKey(const void* object) {
+      return *static_cast<void* const*>(object);
+    }
+
+    // Fixed size open-addressing table from dispatch key -> dispatch.
+    // Lookups are lock-free. A slot keeps its key forever once claimed,
+    // removing only clears the value, so the slot can be reused by the same key
+    // or reclaimed by a new key without ever breaking a probe chain.
+    // If the table is full, insert fails and lookups fall back to the
+    // VkDispatchTableMap.
+    template <typename DispatchType, size_t Size = VKROOTS_DISPATCH_KEY_TABLE_SIZE>
+    class VkDispatchKeyTable {
+      static_assert(std::has_single_bit(Size), "Dispatch key table size must be a power of two.");
+    public:
+      bool insert(const void* obj, const DispatchType* dispatch) {
+        assert(obj);
+        void* key = GetDispatchKey(obj);
+        auto lock = std::unique_lock(m_mutex);
+        Slot* freeSlot = nullptr;
+        for (size_t i = 0; i < Size; i++) {
+          Slot& slot = m_slots[(index(key) + i) & (Size - 1)];
+          void* slotKey = slot.key.load(std::memory_order_relaxed);
+          if (slotKey == key) {
+            slot.value.store(dispatch, std::memory_order_release);
+            return true;
+          }
+          if (!freeSlot && !slot.value.load(std::memory_order_relaxed))
+            freeSlot = &slot;
+          if (!slotKey)
+            break;
+        }
+        if (!freeSlot)
+          return false;
+        freeSlot->key.store(key, std::memory_order_release);
+        freeSlot->value.store(dispatch, std::memory_order_release);
+        return true;
+      }
+      void remove(const void* obj) {
+        assert(obj);
+        void* key = GetDispatchKey(obj);
+        auto lock = std::unique_lock(m_mutex);
+        if (Slot* slot = lookup(key))
+          slot->value.store(nullptr, std::memory_order_release);
+      }
+      const DispatchType* find(const void* obj) const {
+        if (!obj) return nullptr;
+        const Slot* slot = lookup(GetDispatchKey(obj));
+        return slot ? slot->value.load(std::memory_order_acquire) : nullptr;
+      }
+    private:
+      struct Slot {
+        std::atomic<void*> key{};
+        std::atomic<const DispatchType*> value{};
+      };
+
+      static size_t index(void* key) {
+        // Dispatch tables are heap allocated, the low bits are always zero.
+        return (reinterpret_cast<uintptr_t>(key) >> 4) & (Size - 1);
+      }
+
+      Slot* lookup(void* key) const {
+        for (size_t i = 0; i < Size; i++) {
+          Slot& slot = m_slots[(index(key) + i) & (Size - 1)];
+          void* slotKey = slot.key.load(std::memory_order_acquire);
+          if (slotKey == key)
+            return &slot;
+          if (!slotKey)
+            return nullptr;
+        }
+        return nullptr;
+      }
+
+      mutable std::array<Slot, Size> m_slots;
+      std::mutex m_mutex;
+    };
+
+    // One per dispatch type: VkInstanceDispatch, VkPhysicalDeviceDispatch and VkDeviceDispatch.
+    template <typename DispatchType>
+    inline VkDispatchKeyTable<DispatchType> KeyDispatches;
+#endif
+
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    // Bumped once an instance or device's dispatches are gone, so a cached handle
+    // whose value gets reused by a new object can never return a stale dispatch.
+    inline std::atomic<uint64_t> DispatchGeneration{ 0 };
+
+    // Per-thread cache of the last two handles looked up for a given map.
+    template <typename Object, typename DispatchType>
+    class VkDispatchCache {
+    public:
+      template <typename Func>
+      static const DispatchType* lookup(Object obj, Func func) {
+        Cache& cache = t_cache;
+        const uint64_t generation = DispatchGeneration.load(std::memory_order_acquire);
+        if (cache.generation == generation) {
+          if (cache.entries[0].obj == obj && obj)
+            return cache.entries[0].dispatch;
+          if (cache.entries[1].obj == obj && obj) {
+            std::swap(cache.entries[0], cache.entries[1]);
+            return cache.entries[0].dispatch;
+          }
+        } else {
+          cache = Cache{ generation };
+        }
+        const DispatchType* dispatch = func(obj);
+        if (dispatch) {
+          cache.entries[1] = cache.entries[0];
+          cache.entries[0] = Entry{ obj, dispatch };
+        }
+        return dispatch;
+      }
+    private:
+      struct Entry {
+        Object obj{};
+        const DispatchType* dispatch = nullptr;
+      };
+      struct Cache {
+        uint64_t generation = 0;
+        std::array<Entry, 2> entries{};
+      };
+      static inline thread_local Cache t_cache;
+    };
+#endif
+
+#if VKROOTS_USE_PROC_ADDR_CACHE
+    // Remembers what the next layer handed back for each name, so repeat
+    // resolutions never go back down the chain.
+    // Names are matched by their contents only. Matching on the pointer would
+    // skip hashing, but a buffer the app rewrites with another name (or a
+    // std::string on the stack) would then get the first name's function.
+    class VkProcAddrCache {
+    public:
+      template <typename Func>
+      PFN_vkVoidFunction resolve(const char* name, Func func) const {
+        const std::string_view view{ name };
+        {
+          std::shared_lock lock(m_mutex);
+          auto iter = m_entries.find(view);
+          if (iter != m_entries.end())
+            return iter->second;
+        }
+
+        // Don't hold the lock while calling down the chain.
+        PFN_vkVoidFunction result = func();
+        std::unique_lock lock(m_mutex);
+        return m_entries.try_emplace(std::string(view), result).first->second;
+      }
+    private:
+      struct NameHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view name) const { return std::hash<std::string_view>{}(name); }
+      };
+
+      mutable std::unordered_map<std::string, PFN_vkVoidFunction, NameHash, std::equal_to<>> m_entries;
+      mutable std::shared_mutex m_mutex;
+    };
+#endif
+
+#if VKROOTS_USE_LAZY_DISPATCH
+    // What the functions of a lazily populated VkDeviceDispatch get resolved with.
+    struct VkLazyResolver {
+      VkDevice Device;
+      PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+    };
+
+    // A VkDeviceDispatch function that only asks the next layer for its
+    // pointer the first time it is used, then keeps it.
+    // Converts to the function pointer, so calls and null checks look the same
+    // as with the eagerly populated table.
+    // Only the pointer is stored. Owner's LazyResolver is shared by all of its
+    // functions, each finds it from its own offset in Owner.
+    template <typename PFN, auto Func, typename Owner>
+    class VkLazyFunc {
+    public:
+      VkLazyFunc() = default;
+      VkLazyFunc(const VkLazyFunc&) = delete;
+      VkLazyFunc& operator=(const VkLazyFunc&) = delete;
+
+      operator PFN() const {
+        PFN func = m_func.load(std::memory_order_relaxed);
+        if (func == Unresolved()) [[unlikely]] {
+          constexpr size_t Offset = Owner::Offset(Func);
+          const VkLazyResolver& resolver = reinterpret_cast<const Owner*>(reinterpret_cast<const std::byte*>(this) - Offset)->LazyResolver;
+          // Racing threads all get the same pointer back, so whoever stores last is fine.
+          // Functions the device doesn't have are kept as NULL, so they are only asked for once too.
+          func = reinterpret_cast<PFN>(resolver.GetDeviceProcAddr(resolver.Device, FuncName(Func)));
+          m_func.store(func, std::memory_order_relaxed);
+        }
+        return func;
+      }
+    private:
+      // Never called, only stands in for "not asked for yet" as NULL is a valid answer.
+      static void VKAPI_CALL UnresolvedFunc() {}
+      static PFN Unresolved() { return reinterpret_cast<PFN>(&UnresolvedFunc); }
+
+      mutable std::atomic<PFN> m_func{ Unresolved() };
+    };
+#endif
+
+#if VKROOTS_USE_EXTENSION_AWARE_DISPATCH
+    // The core version and extensions a device was created with,
+    // VkDeviceDispatch only resolves the functions these provide.
+    template <typename Extension, Extension (*LookupExtension)(const char*)>
+    class VkEnabledFeatures {
+    public:
+      VkEnabledFeatures(uint32_t apiVersion, uint32_t extensionCount, const char* const* ppExtensionNames)
+        : m_apiVersion(apiVersion) {
+        for (uint32_t i = 0; i < extensionCount; i++) {
+          Extension extension = LookupExtension(ppExtensionNames[i]);
+          if (extension != Extension::Count)
+            m_extensions.set(size_t(extension));
+        }
+      }
+
+      bool Version(uint32_t apiVersion) const { return m_apiVersion >= apiVersion; }
+      bool Has(Extension extension) const { return m_extensions.test(size_t(extension)); }
+    private:
+      uint32_t m_apiVersion;
+      std::bitset<size_t(Extension::Count)> m_extensions;
+    };
+#endif
+
+#if VKROOTS_USE_CREATE_TIMINGS
+    // Where the time went while creating an instance or device.
+    struct VkCreateTimings {
+      // The downstream vkCreateInstance/vkCreateDevice.
+      // When the layer overrides the create, this is the whole override.
+      std::chrono::nanoseconds Create{};
+      // All of CreateDispatchTable, including the phases below.
+      std::chrono::nanoseconds CreateDispatchTable{};
+      // Constructing the dispatch (resolving every function) and registering it.
+      std::chrono::nanoseconds DispatchConstruction{};
+      // Instance only: enumerating and registering its physical devices.
+      std::chrono::nanoseconds PhysicalDeviceEnumeration{};
+      // Device only: GetDeviceQueue and registering each of its queues.
+      std::chrono::nanoseconds QueueRegistration{};
+    };
+
+    class VkCreateTimer {
+    public:
+      VkCreateTimer() = default;
+      // Stores the elapsed time into pOut once the timer goes out of scope.
+      explicit VkCreateTimer(std::chrono::nanoseconds* pOut) : m_pOut(pOut) {}
+      VkCreateTimer(const VkCreateTimer&) = delete;
+      VkCreateTimer& operator=(const VkCreateTimer&) = delete;
+      ~VkCreateTimer() { if (m_pOut) *m_pOut = Elapsed(); }
+
+      void StoreOnExit(std::chrono::nanoseconds* pOut) { m_pOut = pOut; }
+      std::chrono::nanoseconds Elapsed() const { return std::chrono::steady_clock::now() - m_start; }
+    private:
+      std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+      std::chrono::nanoseconds* m_pOut = nullptr;
+    };
+#endif
+
+    // All our dispatchables...
+    inline VkDispatchTableMap<VkInstance,       VkInstanceDispatch,       std::unique_ptr<const VkInstanceDispatch>>       InstanceDispatches;
+    inline VkDispatchTableMap<VkInstance,       VkPhysicalDeviceDispatch, std::unique_ptr<const VkPhysicalDeviceDispatch>> PhysicalDeviceInstanceDispatches;
+    inline VkDispatchTableMap<VkPhysicalDevice, VkPhysicalDeviceDispatch, RawPointer     <const VkPhysicalDeviceDispatch>> PhysicalDeviceDispatches;
+    inline VkDispatchTableMap<VkDevice,         VkDeviceDispatch,         std::unique_ptr<const VkDeviceDispatch>>         DeviceDispatches;
+    inline VkDispatchTableMap<VkQueue,          VkDeviceDispatch,         RawPointer     <const VkDeviceDispatch>>         QueueDispatches;
+    inline VkDispatchTableMap<VkCommandBuffer,  VkDeviceDispatch,         RawPointer     <const VkDeviceDispatch>>         CommandBufferDispatches;
+
+    // A command buffer's dispatch, followed by the layer's
+    // DeviceOverrides::CommandBufferState when it has one.
+    struct VkCommandBufferEntry {
+      const VkDeviceDispatch* dispatch;
+
+      template <typename State>
+      State& CommandBufferState() const;
+    };
+
+    // How to lay out and construct a VkCommandBufferStateEntry without knowing its State.
+    struct VkCommandBufferStateType {
+      size_t size;
+      size_t alignment;
+      VkCommandBufferEntry* (*construct)(void* pMemory, const VkDeviceDispatch* dispatch);
+      // Null when there is nothing to destroy.
+      void (*destroy)(VkCommandBufferEntry* entry);
+    };
+
+    template <typename State>
+    struct VkCommandBufferStateEntry : VkCommandBufferEntry {
+      // Command buffers are externally synchronized, so whoever is recording
+      // into one owns its state, no locking needed.
+      mutable State state{};
+
+      explicit VkCommandBufferStateEntry(const VkDeviceDispatch* dispatch) : VkCommandBufferEntry{ dispatch } {}
+
+      static constexpr VkCommandBufferStateType Type = {
+        sizeof(VkCommandBufferStateEntry),
+        alignof(VkCommandBufferStateEntry),
+        [](void* pMemory, const VkDeviceDispatch* dispatch) -> VkCommandBufferEntry* { return new (pMemory) VkCommandBufferStateEntry(dispatch); },
+        std::is_trivially_destructible<State>::value ? nullptr : +[](VkCommandBufferEntry* entry) { static_cast<VkCommandBufferStateEntry*>(entry)->~VkCommandBufferStateEntry(); },
+      };
+    };
+
+    template <typename State>
+    State& VkCommandBufferEntry::CommandBufferState() const {
+      return static_cast<const VkCommandBufferStateEntry<State>*>(this)->state;
+    }
+
+    template <typename DeviceOverrides>
+    constexpr const VkCommandBufferStateType* CommandBufferStateTypeOf() {
+      if constexpr (requires { typename DeviceOverrides::CommandBufferState; })
+        return &VkCommandBufferStateEntry<typename DeviceOverrides::CommandBufferState>::Type;
+      else
+        return nullptr;
+    }
+
+    // Fixed size blocks handed out of chunks that are only freed all at once,
+    // so entries never move. Freed blocks are kept on a list for reuse.
+    class VkCommandBufferSlab {
+    public:
+      explicit VkCommandBufferSlab(const VkCommandBufferStateType* type)
+        : m_blockSize(std::max(type->size, sizeof(void*))), m_alignment(std::max(type->alignment, alignof(void*))) {
+        m_blockSize = (m_blockSize + m_alignment - 1) & ~(m_alignment - 1);
+      }
+      VkCommandBufferSlab(const VkCommandBufferSlab&) = delete;
+      VkCommandBufferSlab& operator=(const VkCommandBufferSlab&) = delete;
+      ~VkCommandBufferSlab() {
+        for (void* chunk : m_chunks)
+          ::operator delete(chunk, std::align_val_t(m_alignment));
+      }
+
+      void* allocate() {
+        if (m_free) {
+          void* block = m_free;
+          m_free = *static_cast<void**>(block);
+          return block;
+        }
+        if (m_used == m_chunkBlocks) {
+          m_chunkBlocks = m_chunks.empty() ? MinChunkBlocks : std::min(m_chunkBlocks * 2, MaxChunkBlocks);
+          m_chunks.push_back(::operator new(m_blockSize * m_chunkBlocks, std::align_val_t(m_alignment)));
+          m_used = 0;
+        }
+        return static_cast<std::byte*>(m_chunks.back()) + m_blockSize * m_used++;
+      }
+      void free(void* block) {
+        *static_cast<void**>(block) = std::exchange(m_free, block);
+      }
+    private:
+      static constexpr size_t MinChunkBlocks = 16;
+      static constexpr size_t MaxChunkBlocks = 1024;
+
+      size_t m_blockSize;
+      size_t m_alignment;
+      std::vector<void*> m_chunks;
+      size_t m_chunkBlocks = 0;
+      size_t m_used = 0;
+      void* m_free = nullptr;
+    };
+
+    // Only filled in for layers with a DeviceOverrides::CommandBufferState.
+    inline VkDispatchTableMap<VkCommandBuffer, VkCommandBufferEntry, RawPointer<const VkCommandBufferEntry>> CommandBufferEntries;
+
+    // The command buffers allocated from each pool, which keeps CommandBufferDispatches
+    // in sync as they come and go.
+    // Pools are tracked per device, as the same non-dispatchable handle can be
+    // a different pool on each device.
+    // Destroying a pool takes its command buffers out of CommandBufferDispatches
+    // and CommandBufferEntries straight from the pool's own list, in one batch,
+    // so neither map is left holding a handle the driver could hand out again.
+    // Destroying a device does the same for all the pools it has left.
+    class VkCommandPoolRegistry {
+    public:
+      void insert(VkDevice device, const VkDeviceDispatch* dispatch, const VkCommandBufferStateType* stateType, VkCommandPool commandPool, uint32_t count, const VkCommandBuffer* pCommandBuffers) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        if (!pools) {
+          m_devices.insert(device, DevicePools{});
+          pools = m_devices.find(device);
+        }
+        std::unique_ptr<Pool>* pool = pools->find(commandPool);
+        if (!pool) {
+          pools->insert(commandPool, std::make_unique<Pool>(dispatch, stateType));
+          pool = pools->find(commandPool);
+        }
+        std::vector<const VkCommandBufferEntry*> entries;
+        if ((*pool)->slab)
+          entries.reserve(count);
+        (*pool)->commandBuffers.reserve((*pool)->commandBuffers.size() + count);
+        for (uint32_t i = 0; i < count; i++) {
+          VkCommandBufferEntry* entry = (*pool)->allocate(pCommandBuffers[i]);
+          if ((*pool)->slab)
+            entries.push_back(entry);
+        }
+        CommandBufferDispatches.insert(count, pCommandBuffers, dispatch);
+        if ((*pool)->slab)
+          CommandBufferEntries.insert(count, pCommandBuffers, entries.data());
+      }
+
+      void remove(VkDevice device, VkCommandPool commandPool, uint32_t count, const VkCommandBuffer* pCommandBuffers) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        std::unique_ptr<Pool>* pool = pools ? pools->find(commandPool) : nullptr;
+        if (pool) {
+          for (uint32_t i = 0; i < count; i++)
+            (*pool)->free(pCommandBuffers[i]);
+        }
+        CommandBufferDispatches.remove(count, pCommandBuffers);
+        if (pool && (*pool)->slab)
+          CommandBufferEntries.remove(count, pCommandBuffers);
+      }
+
+      // Returns whether the pool had any command buffers.
+      bool destroy(VkDevice device, VkCommandPool commandPool) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        std::unique_ptr<Pool>* pool = pools ? pools->find(commandPool) : nullptr;
+        if (!pool)
+          return false;
+        std::vector<VkCommandBuffer> commandBuffers;
+        const bool hasEntries = gather(**pool, commandBuffers);
+        // Out of the maps before the entries they point to are freed.
+        const bool any = unregister(commandBuffers, hasEntries);
+        pools->erase(commandPool);
+        return any;
+      }
+
+      // Returns whether the device's pools had any command buffers.
+      bool destroy(VkDevice device) {
+        auto lock = std::unique_lock(m_mutex);
+        DevicePools* pools = m_devices.find(device);
+        if (!pools)
+          return false;
+        std::vector<VkCommandBuffer> commandBuffers;
+        bool hasEntries = false;
+        pools->forEach([&](VkCommandPool, const std::unique_ptr<Pool>& pool) { hasEntries |= gather(*pool, commandBuffers); });
+        const bool any = unregister(commandBuffers, hasEntries);
+        m_devices.erase(device);
+        return any;
+      }
+    private:
+      class Pool {
+      public:
+        Pool(const VkDeviceDispatch* dispatch, const VkCommandBufferStateType* stateType)
+          : dispatch(dispatch), stateType(stateType) {
+          if (stateType)
+            slab.emplace(stateType);
+        }
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+        ~Pool() {
+          // Trivially destructible states are released with the slab in one go.
+          if (stateType && stateType->destroy)
+            commandBuffers.forEach([this](VkCommandBuffer, VkCommandBufferEntry* entry) { stateType->destroy(entry); });
+        }
+
+        VkCommandBufferEntry* allocate(VkCommandBuffer commandBuffer) {
+          VkCommandBufferEntry* entry = slab ? stateType->construct(slab->allocate(), dispatch) : nullptr;
+          if (VkCommandBufferEntry** existing = commandBuffers.find(commandBuffer)) {
+            release(*existing);
+            *existing = entry;
+          } else {
+            commandBuffers.insert(commandBuffer, entry);
+          }
+          return entry;
+        }
+        void free(VkCommandBuffer commandBuffer) {
+          VkCommandBufferEntry** entry = commandBuffer ? commandBuffers.find(commandBuffer) : nullptr;
+          if (!entry)
+            return;
+          release(*entry);
+          commandBuffers.erase(commandBuffer);
+        }
+
+        const VkDeviceDispatch* dispatch;
+        const VkCommandBufferStateType* stateType;
+        std::optional<VkCommandBufferSlab> slab;
+        // Null entries unless the layer has a CommandBufferState.
+        VkHandleMap<VkCommandBuffer, VkCommandBufferEntry*> commandBuffers;
+      private:
+        void release(VkCommandBufferEntry* entry) {
+          if (!entry)
+            return;
+          if (stateType->destroy)
+            stateType->destroy(entry);
+          slab->free(entry);
+        }
+      };
+
+      using DevicePools = VkHandleMap<VkCommandPool, std::unique_ptr<Pool>>;
+
+      // Appends the pool's command buffers, returns whether they have entries.
+      static bool gather(const Pool& pool, std::vector<VkCommandBuffer>& commandBuffers) {
+        commandBuffers.reserve(commandBuffers.size() + pool.commandBuffers.size());
+        pool.commandBuffers.forEach([&](VkCommandBuffer commandBuffer, VkCommandBufferEntry*) { commandBuffers.push_back(commandBuffer); });
+        return pool.slab.has_value();
+      }
+
+      static bool unregister(const std::vector<VkCommandBuffer>& commandBuffers, bool hasEntries) {
+        if (commandBuffers.empty())
+          return false;
+        CommandBufferDispatches.remove(uint32_t(commandBuffers.size()), commandBuffers.data());
+        if (hasEntries)
+          CommandBufferEntries.remove(uint32_t(commandBuffers.size()), commandBuffers.data());
+        return true;
+      }
+
+      VkHandleMap<VkDevice, DevicePools> m_devices;
+      std::mutex m_mutex;
+    };
+
+    inline VkCommandPoolRegistry CommandPools;
+
+    // While there is exactly one live instance or device, every physical device,
+    // queue and command buffer must belong to it, so skip the lookup entirely.
+    template <typename DispatchType, typename Object>
+    inline bool IsSingleDispatchFor(const DispatchType* dispatch, Object obj) {
+      if constexpr (std::is_same<Object, VkInstance>::value)
+        return dispatch->Instance == obj;
+      else if constexpr (std::is_same<Object, VkDevice>::value)
+        return dispatch->Device == obj;
+      else
+        return obj != VK_NULL_HANDLE;
+    }
+
+    template <typename Object, typename DispatchType, typename DispatchPtr, typename OwnerMap>
+    inline const DispatchType* LookupDispatch(const OwnerMap& owners, const VkDispatchTableMap<Object, DispatchType, DispatchPtr>& map, Object obj) {
+      if (const DispatchType* dispatch = owners.single(); dispatch && IsSingleDispatchFor(dispatch, obj))
+        return dispatch;
+
+      auto lookup = [&map](Object obj) -> const DispatchType* {
+#if VKROOTS_USE_DISPATCH_KEY
+        if (const DispatchType* dispatch = KeyDispatches<DispatchType>.find(obj))
+          return dispatch;
+#endif
+        return map.find(obj);
+      };
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+      return VkDispatchCache<Object, DispatchType>::lookup(obj, lookup);
+#else
+      return lookup(obj);
+#endif
+    }
+
+    inline const VkInstanceDispatch*       LookupInstanceDispatch      (VkInstance instance)             { return LookupDispatch(InstanceDispatches, InstanceDispatches, instance); }
+    inline const VkPhysicalDeviceDispatch* LookupPhysicalDeviceDispatch(VkInstance instance)             { return LookupDispatch(PhysicalDeviceInstanceDispatches, PhysicalDeviceInstanceDispatches, instance); }
+    inline const VkPhysicalDeviceDispatch* LookupPhysicalDeviceDispatch(VkPhysicalDevice physicalDevice) { return LookupDispatch(PhysicalDeviceInstanceDispatches, PhysicalDeviceDispatches, physicalDevice); }
+    inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkDevice device)                 { return LookupDispatch(DeviceDispatches, DeviceDispatches, device); }
+    inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkQueue device)                  { return LookupDispatch(DeviceDispatches, QueueDispatches, device); }
+    inline const VkDeviceDispatch*         LookupDeviceDispatch        (VkCommandBuffer cmdBuffer)       { return LookupDispatch(DeviceDispatches, CommandBufferDispatches, cmdBuffer); }
+
+    // Only for layers with a DeviceOverrides::CommandBufferState.
+    // Goes through the same per-thread cache as LookupDispatch. There is no
+    // dispatch key or single owner to go by, each command buffer has an entry
+    // of its own, and one that isn't tracked has to come back as null.
+    inline const VkCommandBufferEntry* LookupCommandBufferEntry(VkCommandBuffer cmdBuffer) {
+      auto lookup = [](VkCommandBuffer cmdBuffer) { return CommandBufferEntries.find(cmdBuffer); };
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+      return VkDispatchCache<VkCommandBuffer, VkCommandBufferEntry>::lookup(cmdBuffer, lookup);
+#else
+      return lookup(cmdBuffer);
+#endif
+    }
+
+    template <typename State>
+    inline State* LookupCommandBufferState(VkCommandBuffer cmdBuffer) {
+      const VkCommandBufferEntry* entry = LookupCommandBufferEntry(cmdBuffer);
+      return entry ? &entry->CommandBufferState<State>() : nullptr;
+    }
+
+    inline void CreateDispatchTable(PFN_vkGetInstanceProcAddr nextInstanceProcAddr, PFN_GetPhysicalDeviceProcAddr nextPhysDevProcAddr, VkInstance instance);
+    inline void CreateDispatchTable(const VkDeviceCreateInfo* pCreateInfo, PFN_vkGetDeviceProcAddr nextProcAddr, VkPhysicalDevice physicalDevice, VkDevice device);
+    inline void DestroyDispatchTable(VkInstance instance);
+    inline void DestroyDispatchTable(VkDevice device);
+    inline void RegisterCommandBuffers(const VkDeviceDispatch* deviceDispatch, const VkCommandBufferStateType* stateType, const VkCommandBufferAllocateInfo* pAllocateInfo, const VkCommandBuffer* pCommandBuffers);
+    inline void UnregisterCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers);
+    inline void UnregisterCommandPool(VkDevice device, VkCommandPool commandPool);
+  }
+
+  namespace procaddr {
+    // Minimal perfect hash over the entrypoint names, the tables are generated
+    // by make_vkroots. The name is hashed once, its bucket's seed picks the
+    // slot and a single compare confirms it.
+    // Must match proc_addr_hash and proc_addr_mix in gen/make_vkroots.
+    constexpr uint64_t Hash(const char* name) {
+      uint64_t hash = 0xcbf29ce484222325ull;
+      for (; *name; name++)
+        hash = (hash ^ uint8_t(*name)) * 0x100000001b3ull;
+      return hash;
+    }
+
+    constexpr uint32_t Mix(uint64_t hash, uint32_t seed, uint32_t count) {
+      hash ^= uint64_t(seed) * 0x9e3779b97f4a7c15ull;
+      hash ^= hash >> 32;
+      hash *= 0xd6e8feb86659fd93ull;
+      hash ^= hash >> 32;
+      return uint32_t(hash % count);
+    }
+
+    constexpr bool Equal(const char* a, const char* b) {
+      for (; *a && *a == *b; a++, b++)
+        ;
+      return *a == *b;
+    }
+
+    template <typename Func, size_t Count>
+    constexpr Func Lookup(const int32_t (&seeds)[Count], const char* const (&names)[Count], const char* name) {
+      const uint64_t hash = Hash(name);
+      const int32_t seed = seeds[Mix(hash, 0, Count)];
+      const uint32_t index = seed < 0 ? uint32_t(-(seed + 1)) : Mix(hash, uint32_t(seed), Count);
+      return Equal(names[index], name) ? Func(index) : Func::Count;
+    }
+
+    // A perfect hash like the generated one, but over only the functions
+    // IsHooked is true for, built at compile time. However many a layer
+    // hooks, a name it doesn't is turned away by a single compare, which for
+    // almost every name fails within the first few characters after "vk".
+    template <const auto& Names, auto IsHooked>
+    class HookedFuncTable {
+      template <typename T>
+      struct FuncOf;
+      template <typename T>
+      struct FuncOf<bool (*)(T)> { using Type = T; };
+      using Func = typename FuncOf<decltype(IsHooked)>::Type;
+
+      static constexpr uint32_t Count = uint32_t(Func::Count);
+
+      static constexpr uint32_t Size = [] {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < Count; i++)
+          count += IsHooked(Func(i)) ? 1 : 0;
+        return count;
+      }();
+
+      struct Table {
+        // Same scheme as build_perfect_hash in gen/make_vkroots: a negative
+        // seed is the slot of the only name in its bucket.
+        std::array<int32_t, Size> seeds{};
+        std::array<Func, Size> slots{};
+      };
+
+      static constexpr Table Build() {
+        std::array<uint64_t, Size> hashes{};
+        std::array<Func, Size> funcs{};
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < Count; i++) {
+          if (IsHooked(Func(i))) {
+            hashes[count] = Hash(Names[i]);
+            funcs[count++] = Func(i);
+          }
+        }
+
+        std::array<uint32_t, Size> bucketOf{};
+        std::array<uint32_t, Size> bucketSize{};
+        for (uint32_t i = 0; i < Size; i++)
+          bucketSize[bucketOf[i] = Mix(hashes[i], 0, Size)]++;
+
+        // Biggest buckets first, while most slots are still free.
+        std::array<uint32_t, Size> order{};
+        for (uint32_t i = 0; i < Size; i++)
+          order[i] = i;
+        std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+          if (bucketSize[bucketOf[a]] != bucketSize[bucketOf[b]])
+            return bucketSize[bucketOf[a]] > bucketSize[bucketOf[b]];
+          return bucketOf[a] < bucketOf[b];
+        });
+
+        Table table{};
+        std::array<bool, Size> used{};
+        uint32_t start = 0;
+        for (; start < Size && bucketSize[bucketOf[order[start]]] > 1; start += bucketSize[bucketOf[order[start]]]) {
+          const uint32_t bucket = bucketOf[order[start]];
+          const uint32_t size = bucketSize[bucket];
+          for (uint32_t seed = 1;; seed++) {
+            uint32_t placed = 0;
+            for (; placed < size; placed++) {
+              const uint32_t slot = Mix(hashes[order[start + placed]], seed, Size);
+              if (used[slot])
+                break;
+              used[slot] = true;
+            }
+            if (placed == size) {
+              for (uint32_t i = start; i < start + size; i++)
+                table.slots[Mix(hashes[order[i]], seed, Size)] = funcs[order[i]];
+              table.seeds[bucket] = int32_t(seed);
+              break;
+            }
+            while (placed--)
+              used[Mix(hashes[order[start + placed]], seed, Size)] = false;
+          }
+        }
+
+        uint32_t freeSlot = 0;
+        for (; start < Size; start++) {
+          while (used[freeSlot])
+            freeSlot++;
+          used[freeSlot] = true;
+          table.slots[freeSlot] = funcs[order[start]];
+          table.seeds[bucketOf[order[start]]] = -int32_t(freeSlot + 1);
+        }
+        return table;
+      }
+
+      static constexpr Table Hooked = Build();
+
+    public:
+      // Returns Func::Count for anything we don't hook, the caller falls through to the next layer.
+      static constexpr Func Find(const char* name) {
+        if constexpr (Size == 0) {
+          return Func::Count;
+        } else {
+          const uint64_t hash = Hash(name);
+          const int32_t seed = Hooked.seeds[Mix(hash, 0, Size)];
+          const Func func = Hooked.slots[seed < 0 ? uint32_t(-(seed + 1)) : Mix(hash, uint32_t(seed), Size)];
+          return Equal(Names[uint32_t(func)], name) ? func : Func::Count;
+        }
+      }
+    };
+  }
+
+  struct VkInstanceProcAddrFuncs {
+    PFN_vkGetInstanceProcAddr NextGetInstanceProcAddr;
+    PFN_vkGetPhysicalDeviceProcAddr NextGetPhysicalDeviceProcAddr;
+  };
+
+  inline VkResult GetProcAddrs(const VkInstanceCreateInfo* pInfo, VkInstanceProcAddrFuncs *pOutFuncs) {
+    const void* pNext = (const void*) pInfo;
+    const VkLayerInstanceCreateInfo* layerInfo;
+    while ((layerInfo = FindInChain<const VkLayerInstanceCreateInfo>(pNext)) && layerInfo->function != VK_LAYER_LINK_INFO)
+      pNext = layerInfo->pNext;
+    assert(layerInfo);
+    if (!layerInfo)
+      return VK_ERROR_INITIALIZATION_FAILED;
+    *pOutFuncs = VkInstanceProcAddrFuncs{ layerInfo->u.pLayerInfo->pfnNextGetInstanceProcAddr, layerInfo->u.pLayerInfo->pfnNextGetPhysicalDeviceProcAddr };
+    // Josh:
+    // It really sucks that we have to advance this ourselves given the const situation here... 
+    VkLayerInstanceCreateInfo* layerInfoMutable = const_cast<VkLayerInstanceCreateInfo *>(layerInfo);
+    layerInfoMutable->u.pLayerInfo = layerInfoMutable->u.pLayerInfo->pNext;
+    return VK_SUCCESS;
+  }
+
+  inline VkResult GetProcAddrs(const VkDeviceCreateInfo* pInfo, PFN_vkGetDeviceProcAddr *pOutAddr) {
+    const void* pNext = (const void*) pInfo;
+    const VkLayerDeviceCreateInfo* layerInfo;
+    while ((layerInfo = FindInChain<const VkLayerDeviceCreateInfo>(pNext)) && layerInfo->function != VK_LAYER_LINK_INFO)
+      pNext = layerInfo->pNext;
+    assert(layerInfo);
+    if (!layerInfo)
+      return VK_ERROR_INITIALIZATION_FAILED;
+    *pOutAddr = layerInfo->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+    // Josh:
+    // It really sucks that we have to advance this ourselves given the const situation here... 
+    VkLayerDeviceCreateInfo* layerInfoMutable = const_cast<VkLayerDeviceCreateInfo *>(layerInfo);
+    layerInfoMutable->u.pLayerInfo = layerInfoMutable->u.pLayerInfo->pNext;
+    return VK_SUCCESS;
+  }
+
+}
+namespace vkroots {
+  namespace procaddr {
+    enum class InstanceFunc : uint32_t {
+      CreateMetalSurfaceEXT = 0,
+      EnumeratePhysicalDevices = 1,
+      EnumerateDeviceExtensionProperties = 2,
+      CreateMacOSSurfaceMVK = 3,
+      DestroyDebugReportCallbackEXT = 4,
+      GetDisplayModePropertiesKHR = 5,
+      SubmitDebugUtilsMessageEXT = 6,
+      CreateDevice = 7,
+      GetInstanceProcAddr = 8,
+      GetPhysicalDeviceDisplayPropertiesKHR = 9,
+      CreateHeadlessSurfaceEXT = 10,
+      GetPhysicalDeviceSurfaceCapabilities2KHR = 11,
+      CreateStreamDescriptorSurfaceGGP = 12,
+      GetPhysicalDeviceWaylandPresentationSupportKHR = 13,
+      GetPhysicalDeviceSurfaceFormatsKHR = 14,
+      GetPhysicalDeviceSurfaceCapabilitiesKHR = 15,
+      DestroyInstance = 16,
+      CreateXcbSurfaceKHR = 17,
+      GetPhysicalDeviceSurfacePresentModesKHR = 18,
+      GetPhysicalDeviceXcbPresentationSupportKHR = 19,
+      CreateAndroidSurfaceKHR = 20,
+      EnumerateDeviceLayerProperties = 21,
+      GetPhysicalDeviceToolProperties = 22,
+      GetPhysicalDeviceProperties = 23,
+      GetPhysicalDeviceFeatures = 24,
+      CreateDisplayModeKHR = 25,
+      DebugReportMessageEXT = 26,
+      GetPhysicalDeviceMemoryProperties2 = 27,
+      GetPhysicalDeviceQueueFamilyProperties = 28,
+      GetPhysicalDeviceExternalSemaphoreProperties = 29,
+      GetPhysicalDeviceMemoryProperties = 30,
+      CreateViSurfaceNN = 31,
+      CreateScreenSurfaceQNX = 32,
+      CreateWaylandSurfaceKHR = 33,
+      GetPhysicalDeviceFeatures2 = 34,
+      CreateDirectFBSurfaceEXT = 35,
+      GetPhysicalDeviceImageFormatProperties2 = 36,
+      GetPhysicalDeviceProperties2 = 37,
+      GetPhysicalDevicePresentRectanglesKHR = 38,
+      GetPhysicalDeviceFormatProperties = 39,
+      GetPhysicalDeviceXlibPresentationSupportKHR = 40,
+      EnumeratePhysicalDeviceGroups = 41,
+      DestroyDebugUtilsMessengerEXT = 42,
+      GetPhysicalDeviceImageFormatProperties = 43,
+      GetPhysicalDeviceSurfaceSupportKHR = 44,
+      CreateDisplayPlaneSurfaceKHR = 45,
+      CreateDebugReportCallbackEXT = 46,
+      DestroySurfaceKHR = 47,
+      GetDisplayPlaneSupportedDisplaysKHR = 48,
+      EnumeratePhysicalDeviceGroupsKHR = 49,
+      GetDisplayPlaneCapabilitiesKHR = 50,
+      CreateDebugUtilsMessengerEXT = 51,
+      GetPhysicalDeviceDisplayPlanePropertiesKHR = 52,
+      GetPhysicalDeviceFormatProperties2 = 53,
+      GetPhysicalDeviceWin32PresentationSupportKHR = 54,
+      GetPhysicalDeviceSurfaceFormats2KHR = 55,
+      CreateXlibSurfaceKHR = 56,
+      GetPhysicalDeviceExternalBufferProperties = 57,
+      CreateIOSSurfaceMVK = 58,
+      GetPhysicalDeviceExternalFenceProperties = 59,
+      CreateImagePipeSurfaceFUCHSIA = 60,
+      GetPhysicalDeviceSparseImageFormatProperties2 = 61,
+      CreateWin32SurfaceKHR = 62,
+      GetPhysicalDeviceQueueFamilyProperties2 = 63,
+      GetPhysicalDeviceSparseImageFormatProperties = 64,
+      CreateInstance = 65,
+      Count = 66,
+    };
+
+    inline constexpr int32_t InstanceFuncSeeds[66] = {
+      -66, -65, 0, -63, -56, -50, -46, 0, -45, 1, -44, 1, -40, -38, 2, 0,
+      3, 5, -37, 5, 0, 4, 1, 1, -36, -35, 1, 0, 0, 0, -32, 1,
+      0, 5, 0, -31, 1, -30, 0, 4, 0, -27, 1, -25, -24, -23, 0, 0,
+      -19, -13, 0, -12, -10, -8, 0, -7, 0, 14, 0, -6, 0, 1, 0, 0,
+      0, -5,
+    };
+
+    inline constexpr const char* InstanceFuncNames[66] = {
+      "vkCreateMetalSurfaceEXT",
+      "vkEnumeratePhysicalDevices",
+      "vkEnumerateDeviceExtensionProperties",
+      "vkCreateMacOSSurfaceMVK",
+      "vkDestroyDebugReportCallbackEXT",
+      "vkGetDisplayModePropertiesKHR",
+      "vkSubmitDebugUtilsMessageEXT",
+      "vkCreateDevice",
+      "vkGetInstanceProcAddr",
+      "vkGetPhysicalDeviceDisplayPropertiesKHR",
+      "vkCreateHeadlessSurfaceEXT",
+      "vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+      "vkCreateStreamDescriptorSurfaceGGP",
+      "vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+      "vkGetPhysicalDeviceSurfaceFormatsKHR",
+      "vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+      "vkDestroyInstance",
+      "vkCreateXcbSurfaceKHR",
+      "vkGetPhysicalDeviceSurfacePresentModesKHR",
+      "vkGetPhysicalDeviceXcbPresentationSupportKHR",
+      "vkCreateAndroidSurfaceKHR",
+      "vkEnumerateDeviceLayerProperties",
+      "vkGetPhysicalDeviceToolProperties",
+      "vkGetPhysicalDeviceProperties",
+      "vkGetPhysicalDeviceFeatures",
+      "vkCreateDisplayModeKHR",
+      "vkDebugReportMessageEXT",
+      "vkGetPhysicalDeviceMemoryProperties2",
+      "vkGetPhysicalDeviceQueueFamilyProperties",
+      "vkGetPhysicalDeviceExternalSemaphoreProperties",
+      "vkGetPhysicalDeviceMemoryProperties",
+      "vkCreateViSurfaceNN",
+      "vkCreateScreenSurfaceQNX",
+      "vkCreateWaylandSurfaceKHR",
+      "vkGetPhysicalDeviceFeatures2",
+      "vkCreateDirectFBSurfaceEXT",
+      "vkGetPhysicalDeviceImageFormatProperties2",
+      "vkGetPhysicalDeviceProperties2",
+      "vkGetPhysicalDevicePresentRectanglesKHR",
+      "vkGetPhysicalDeviceFormatProperties",
+      "vkGetPhysicalDeviceXlibPresentationSupportKHR",
+      "vkEnumeratePhysicalDeviceGroups",
+      "vkDestroyDebugUtilsMessengerEXT",
+      "vkGetPhysicalDeviceImageFormatProperties",
+      "vkGetPhysicalDeviceSurfaceSupportKHR",
+      "vkCreateDisplayPlaneSurfaceKHR",
+      "vkCreateDebugReportCallbackEXT",
+      "vkDestroySurfaceKHR",
+      "vkGetDisplayPlaneSupportedDisplaysKHR",
+      "vkEnumeratePhysicalDeviceGroupsKHR",
+      "vkGetDisplayPlaneCapabilitiesKHR",
+      "vkCreateDebugUtilsMessengerEXT",
+      "vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+      "vkGetPhysicalDeviceFormatProperties2",
+      "vkGetPhysicalDeviceWin32PresentationSupportKHR",
+      "vkGetPhysicalDeviceSurfaceFormats2KHR",
+      "vkCreateXlibSurfaceKHR",
+      "vkGetPhysicalDeviceExternalBufferProperties",
+      "vkCreateIOSSurfaceMVK",
+      "vkGetPhysicalDeviceExternalFenceProperties",
+      "vkCreateImagePipeSurfaceFUCHSIA",
+      "vkGetPhysicalDeviceSparseImageFormatProperties2",
+      "vkCreateWin32SurfaceKHR",
+      "vkGetPhysicalDeviceQueueFamilyProperties2",
+      "vkGetPhysicalDeviceSparseImageFormatProperties",
+      "vkCreateInstance",
+    };
+
+    constexpr InstanceFunc LookupInstanceFunc(const char* name) {
+      return Lookup<InstanceFunc>(InstanceFuncSeeds, InstanceFuncNames, name);
+    }
+
+    constexpr const char* FuncName(InstanceFunc func) {
+      return InstanceFuncNames[uint32_t(func)];
+    }
+  }
+
+  namespace procaddr {
+    enum class PhysicalDeviceFunc : uint32_t {
+      GetPhysicalDeviceProperties2KHR = 0,
+      GetRandROutputDisplayEXT = 1,
+      GetDrmDisplayEXT = 2,
+      GetWinrtDisplayNV = 3,
+      GetPhysicalDeviceSurfacePresentModes2EXT = 4,
+      layerGetPhysicalDeviceProcAddr = 5,
+      AcquireWinrtDisplayNV = 6,
+      GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR = 7,
+      GetPhysicalDeviceSurfaceCapabilities2EXT = 8,
+      GetPhysicalDeviceSparseImageFormatProperties2KHR = 9,
+      GetPhysicalDeviceFragmentShadingRatesKHR = 10,
+      GetPhysicalDeviceFeatures2KHR = 11,
+      AcquireXlibDisplayEXT = 12,
+      GetPhysicalDeviceScreenPresentationSupportQNX = 13,
+      GetPhysicalDeviceQueueFamilyProperties2KHR = 14,
+      GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = 15,
+      AcquireDrmDisplayEXT = 16,
+      GetPhysicalDeviceExternalBufferPropertiesKHR = 17,
+      GetPhysicalDeviceMemoryProperties2KHR = 18,
+      GetPhysicalDeviceExternalSemaphorePropertiesKHR = 19,
+      GetPhysicalDeviceVideoCapabilitiesKHR = 20,
+      GetPhysicalDeviceExternalFencePropertiesKHR = 21,
+      GetPhysicalDeviceToolPropertiesEXT = 22,
+      GetPhysicalDeviceFormatProperties2KHR = 23,
+      ReleaseDisplayEXT = 24,
+      GetPhysicalDeviceDisplayPlaneProperties2KHR = 25,
+      GetPhysicalDeviceDirectFBPresentationSupportEXT = 26,
+      GetPhysicalDeviceImageFormatProperties2KHR = 27,
+      GetPhysicalDeviceMultisamplePropertiesEXT = 28,
+      GetDisplayPlaneCapabilities2KHR = 29,
+      GetPhysicalDeviceOpticalFlowImageFormatsNV = 30,
+      GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = 31,
+      EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = 32,
+      GetPhysicalDeviceExternalImageFormatPropertiesNV = 33,
+      GetPhysicalDeviceCooperativeMatrixPropertiesNV = 34,
+      GetPhysicalDeviceCalibrateableTimeDomainsEXT = 35,
+      GetPhysicalDeviceVideoFormatPropertiesKHR = 36,
+      GetPhysicalDeviceDisplayProperties2KHR = 37,
+      GetDisplayModeProperties2KHR = 38,
+      Count = 39,
+    };
+
+    inline constexpr int32_t PhysicalDeviceFuncSeeds[39] = {
+      0, 3, 0, 1, 2, 2, -39, -36, 1, -33, 0, 17, 0, -32, 4, 1,
+      -31, -30, 0, 0, 24, 1, 0, 0, 2, 0, -29, 0, -25, 0, 0, -12,
+      0, -10, -3, -1, 0, 0, 3,
+    };
+
+    inline constexpr const char* PhysicalDeviceFuncNames[39] = {
+      "vkGetPhysicalDeviceProperties2KHR",
+      "vkGetRandROutputDisplayEXT",
+      "vkGetDrmDisplayEXT",
+      "vkGetWinrtDisplayNV",
+      "vkGetPhysicalDeviceSurfacePresentModes2EXT",
+      "vk_layerGetPhysicalDeviceProcAddr",
+      "vkAcquireWinrtDisplayNV",
+      "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR",
+      "vkGetPhysicalDeviceSurfaceCapabilities2EXT",
+      "vkGetPhysicalDeviceSparseImageFormatProperties2KHR",
+      "vkGetPhysicalDeviceFragmentShadingRatesKHR",
+      "vkGetPhysicalDeviceFeatures2KHR",
+      "vkAcquireXlibDisplayEXT",
+      "vkGetPhysicalDeviceScreenPresentationSupportQNX",
+      "vkGetPhysicalDeviceQueueFamilyProperties2KHR",
+      "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR",
+      "vkAcquireDrmDisplayEXT",
+      "vkGetPhysicalDeviceExternalBufferPropertiesKHR",
+      "vkGetPhysicalDeviceMemoryProperties2KHR",
+      "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR",
+      "vkGetPhysicalDeviceVideoCapabilitiesKHR",
+      "vkGetPhysicalDeviceExternalFencePropertiesKHR",
+      "vkGetPhysicalDeviceToolPropertiesEXT",
+      "vkGetPhysicalDeviceFormatProperties2KHR",
+      "vkReleaseDisplayEXT",
+      "vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+      "vkGetPhysicalDeviceDirectFBPresentationSupportEXT",
+      "vkGetPhysicalDeviceImageFormatProperties2KHR",
+      "vkGetPhysicalDeviceMultisamplePropertiesEXT",
+      "vkGetDisplayPlaneCapabilities2KHR",
+      "vkGetPhysicalDeviceOpticalFlowImageFormatsNV",
+      "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV",
+      "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR",
+      "vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+      "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV",
+      "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT",
+      "vkGetPhysicalDeviceVideoFormatPropertiesKHR",
+      "vkGetPhysicalDeviceDisplayProperties2KHR",
+      "vkGetDisplayModeProperties2KHR",
+    };
+
+    constexpr PhysicalDeviceFunc LookupPhysicalDeviceFunc(const char* name) {
+      return Lookup<PhysicalDeviceFunc>(PhysicalDeviceFuncSeeds, PhysicalDeviceFuncNames, name);
+    }
+
+    constexpr const char* FuncName(PhysicalDeviceFunc func) {
+      return PhysicalDeviceFuncNames[uint32_t(func)];
+    }
+  }
+
+  namespace procaddr {
+    enum class DeviceFunc : uint32_t {
+      CmdSetColorWriteMaskEXT = 0,
+      SetPrivateDataEXT = 1,
+      ReleaseProfilingLockKHR = 2,
+      GetImageViewOpaqueCaptureDescriptorDataEXT = 3,
+      CmdSetSampleMaskEXT = 4,
+      CmdSetDescriptorBufferOffsetsEXT = 5,
+      CopyAccelerationStructureToMemoryKHR = 6,
+      BindBufferMemory2KHR = 7,
+      CmdSetStencilTestEnableEXT = 8,
+      DestroyDescriptorUpdateTemplateKHR = 9,
+      CmdEndVideoCodingKHR = 10,
+      DestroySwapchainKHR = 11,
+      CmdControlVideoCodingKHR = 12,
+      QueuePresentKHR = 13,
+      CmdSetDepthBias = 14,
+      CmdResolveImage2 = 15,
+      DestroyCommandPool = 16,
+      DestroyAccelerationStructureKHR = 17,
+      BuildAccelerationStructuresKHR = 18,
+      CmdBindIndexBuffer = 19,
+      QueueWaitIdle = 20,
+      CmdSetDepthBounds = 21,
+      BindBufferMemory2 = 22,
+      CmdDrawIndexedIndirectCountKHR = 23,
+      GetImageOpaqueCaptureDescriptorDataEXT = 24,
+      CmdSetPolygonModeEXT = 25,
+      CmdCopyAccelerationStructureKHR = 26,
+      DestroyPipeline = 27,
+      GetDeviceBufferMemoryRequirementsKHR = 28,
+      ResetCommandPool = 29,
+      CmdEndConditionalRenderingEXT = 30,
+      CmdBuildAccelerationStructuresIndirectKHR = 31,
+      CmdSetPatchControlPointsEXT = 32,
+      CmdCopyMemoryToImageIndirectNV = 33,
+      CmdSetRasterizationStreamEXT = 34,
+      CmdEndRenderPass = 35,
+      GetDescriptorSetLayoutHostMappingInfoVALVE = 36,
+      AcquireFullScreenExclusiveModeEXT = 37,
+      DestroySamplerYcbcrConversion = 38,
+      DebugMarkerSetObjectNameEXT = 39,
+      CmdSetDepthBiasEnable = 40,
+      BindImageMemory2KHR = 41,
+      CmdSetDepthBoundsTestEnableEXT = 42,
+      CmdSetCoverageModulationTableEnableNV = 43,
+      CmdSetColorBlendAdvancedEXT = 44,
+      WaitSemaphoresKHR = 45,
+      CreateSamplerYcbcrConversion = 46,
+      CmdSetColorWriteEnableEXT = 47,
+      GetSwapchainCounterEXT = 48,
+      MapMemory = 49,
+      CmdEndRenderPass2KHR = 50,
+      CmdWriteAccelerationStructuresPropertiesNV = 51,
+      CmdSetDiscardRectangleEXT = 52,
+      CmdSetDiscardRectangleModeEXT = 53,
+      GetMemoryHostPointerPropertiesEXT = 54,
+      AcquireProfilingLockKHR = 55,
+      GetEventStatus = 56,
+      CmdCopyImage2KHR = 57,
+      GetDeviceQueue2 = 58,
+      CmdBlitImage2 = 59,
+      CmdResolveImage = 60,
+      CreateRayTracingPipelinesKHR = 61,
+      GetValidationCacheDataEXT = 62,
+      CmdBindShadersEXT = 63,
+      CmdPipelineBarrier2KHR = 64,
+      CmdSetLineWidth = 65,
+      DestroyIndirectCommandsLayoutNV = 66,
+      GetPipelineCacheData = 67,
+      CmdResolveImage2KHR = 68,
+      GetShaderModuleCreateInfoIdentifierEXT = 69,
+      CmdSetCheckpointNV = 70,
+      GetAccelerationStructureDeviceAddressKHR = 71,
+      CmdDrawMeshTasksIndirectNV = 72,
+      CmdSetDepthTestEnableEXT = 73,
+      SignalSemaphoreKHR = 74,
+      CreateRayTracingPipelinesNV = 75,
+      DebugMarkerSetObjectTagEXT = 76,
+      DestroyValidationCacheEXT = 77,
+      CreateRenderPass2 = 78,
+      CmdSetStencilReference = 79,
+      GetDeviceMemoryOpaqueCaptureAddressKHR = 80,
+      CmdDrawMeshTasksIndirectCountEXT = 81,
+      CreateSampler = 82,
+      GetBufferOpaqueCaptureAddressKHR = 83,
+      CmdBindVertexBuffers2EXT = 84,
+      CreateOpticalFlowSessionNV = 85,
+      GetDynamicRenderingTilePropertiesQCOM = 86,
+      CmdBeginQuery = 87,
+      GetCalibratedTimestampsEXT = 88,
+      GetSemaphoreWin32HandleKHR = 89,
+      BindAccelerationStructureMemoryNV = 90,
+      CmdBlitImage = 91,
+      SetBufferCollectionImageConstraintsFUCHSIA = 92,
+      CmdOpticalFlowExecuteNV = 93,
+      CmdDispatchBaseKHR = 94,
+      DestroyDevice = 95,
+      CmdSetExtraPrimitiveOverestimationSizeEXT = 96,
+      QueueInsertDebugUtilsLabelEXT = 97,
+      WaitSemaphores = 98,
+      CreateCommandPool = 99,
+      CreateGraphicsPipelines = 100,
+      CmdSetViewportWithCountEXT = 101,
+      CreateVideoSessionParametersKHR = 102,
+      ReleaseSwapchainImagesEXT = 103,
+      CopyMicromapEXT = 104,
+      DestroyImageView = 105,
+      SetDebugUtilsObjectNameEXT = 106,
+      GetDeviceMemoryOpaqueCaptureAddress = 107,
+      MapMemory2KHR = 108,
+      CmdBlitImage2KHR = 109,
+      CreateDescriptorPool = 110,
+      GetImageSubresourceLayout = 111,
+      BindBufferMemory = 112,
+      GetSemaphoreCounterValue = 113,
+      CmdEndQuery = 114,
+      CreatePipelineCache = 115,
+      CreateImage = 116,
+      CmdSetFragmentShadingRateEnumNV = 117,
+      AcquireNextImageKHR = 118,
+      CmdPipelineBarrier = 119,
+      CmdSetTessellationDomainOriginEXT = 120,
+      WaitForPresentKHR = 121,
+      CreateSharedSwapchainsKHR = 122,
+      CmdBeginRendering = 123,
+      ImportSemaphoreZirconHandleFUCHSIA = 124,
+      DeviceWaitIdle = 125,
+      DestroyDescriptorUpdateTemplate = 126,
+      GetShaderBinaryDataEXT = 127,
+      CmdPushConstants = 128,
+      CmdDebugMarkerEndEXT = 129,
+      CmdSetCoverageReductionModeNV = 130,
+      GetDeviceProcAddr = 131,
+      CmdFillBuffer = 132,
+      GetDeviceBufferMemoryRequirements = 133,
+      MergePipelineCaches = 134,
+      GetEncodedVideoSessionParametersKHR = 135,
+      CmdBeginRenderPass2KHR = 136,
+      GetGeneratedCommandsMemoryRequirementsNV = 137,
+      CmdCopyAccelerationStructureToMemoryKHR = 138,
+      CmdDrawIndirectByteCountEXT = 139,
+      GetBufferMemoryRequirements = 140,
+      GetImageSparseMemoryRequirements = 141,
+      CmdBindDescriptorSets = 142,
+      CmdSetDepthBoundsTestEnable = 143,
+      GetSwapchainStatusKHR = 144,
+      ImportFenceFdKHR = 145,
+      GetDescriptorEXT = 146,
+      CreateRenderPass2KHR = 147,
+      BindImageMemory = 148,
+      CmdCopyImage2 = 149,
+      DestroyPipelineCache = 150,
+      DestroyDescriptorSetLayout = 151,
+      CmdSetRasterizerDiscardEnableEXT = 152,
+      CmdResetEvent = 153,
+      CmdSetDepthCompareOpEXT = 154,
+      CreateValidationCacheEXT = 155,
+      CreateQueryPool = 156,
+      GetMemoryRemoteAddressNV = 157,
+      SetDebugUtilsObjectTagEXT = 158,
+      CmdDispatchIndirect = 159,
+      CmdSetAlphaToCoverageEnableEXT = 160,
+      CreateAccelerationStructureKHR = 161,
+      CmdSetLineStippleEXT = 162,
+      CmdSetDepthBiasEnableEXT = 163,
+      SetPrivateData = 164,
+      DestroyShaderModule = 165,
+      CmdSetScissorWithCount = 166,
+      CmdSetLogicOpEnableEXT = 167,
+      CmdCopyMicromapEXT = 168,
+      CmdClearAttachments = 169,
+      CmdNextSubpass2 = 170,
+      CreateDeferredOperationKHR = 171,
+      GetRayTracingShaderGroupHandlesNV = 172,
+      CmdWaitEvents2KHR = 173,
+      DeferredOperationJoinKHR = 174,
+      CmdSetProvokingVertexModeEXT = 175,
+      BindImageMemory2 = 176,
+      GetFramebufferTilePropertiesQCOM = 177,
+      CreateSamplerYcbcrConversionKHR = 178,
+      CmdTraceRaysKHR = 179,
+      CreateBufferCollectionFUCHSIA = 180,
+      CmdCopyMemoryToAccelerationStructureKHR = 181,
+      CmdBeginQueryIndexedEXT = 182,
+      CreatePipelineLayout = 183,
+      CmdCopyMemoryIndirectNV = 184,
+      GetDescriptorSetLayoutBindingOffsetEXT = 185,
+      GetImageSubresourceLayout2EXT = 186,
+      CmdSetFragmentShadingRateKHR = 187,
+      GetBufferMemoryRequirements2 = 188,
+      UpdateDescriptorSetWithTemplate = 189,
+      CmdResetEvent2 = 190,
+      FlushMappedMemoryRanges = 191,
+      CmdCopyImageToBuffer = 192,
+      CmdInsertDebugUtilsLabelEXT = 193,
+      DisplayPowerControlEXT = 194,
+      CreateDescriptorUpdateTemplateKHR = 195,
+      GetQueryPoolResults = 196,
+      CmdSetDeviceMask = 197,
+      GetQueueCheckpointData2NV = 198,
+      CmdSetScissor = 199,
+      SignalSemaphore = 200,
+      GetPipelineExecutableStatisticsKHR = 201,
+      DestroySampler = 202,
+      CmdExecuteGeneratedCommandsNV = 203,
+      CmdSetPerformanceMarkerINTEL = 204,
+      CmdSetColorBlendEnableEXT = 205,
+      GetRayTracingShaderGroupHandlesKHR = 206,
+      CmdSetDepthClipEnableEXT = 207,
+      CmdDispatchBase = 208,
+      CmdWriteTimestamp = 209,
+      QueueEndDebugUtilsLabelEXT = 210,
+      GetSemaphoreFdKHR = 211,
+      CmdSetDepthClipNegativeOneToOneEXT = 212,
+      CmdCopyBufferToImage2KHR = 213,
+      GetShaderInfoAMD = 214,
+      CmdWriteBufferMarkerAMD = 215,
+      GetDeviceMemoryCommitment = 216,
+      DestroyQueryPool = 217,
+      BeginCommandBuffer = 218,
+      CmdDrawIndexedIndirectCountAMD = 219,
+      GetDeviceGroupSurfacePresentModesKHR = 220,
+      CmdSetRasterizerDiscardEnable = 221,
+      CmdDrawMeshTasksIndirectEXT = 222,
+      CmdBeginDebugUtilsLabelEXT = 223,
+      CmdEndDebugUtilsLabelEXT = 224,
+      DestroyBufferCollectionFUCHSIA = 225,
+      CmdSetLineStippleEnableEXT = 226,
+      ImportFenceWin32HandleKHR = 227,
+      WaitForFences = 228,
+      CmdWriteAccelerationStructuresPropertiesKHR = 229,
+      CmdDrawIndirectCountAMD = 230,
+      CmdPushDescriptorSetKHR = 231,
+      GetDeviceImageSparseMemoryRequirements = 232,
+      GetRayTracingShaderGroupStackSizeKHR = 233,
+      CmdDrawClusterHUAWEI = 234,
+      GetDeferredOperationMaxConcurrencyKHR = 235,
+      CmdDrawMeshTasksIndirectCountNV = 236,
+      AllocateCommandBuffers = 237,
+      CmdEncodeVideoKHR = 238,
+      CopyMemoryToMicromapEXT = 239,
+      CmdBuildAccelerationStructureNV = 240,
+      CmdDrawIndexed = 241,
+      GetMemoryWin32HandlePropertiesKHR = 242,
+      UpdateVideoSessionParametersKHR = 243,
+      CmdSetRasterizationSamplesEXT = 244,
+      ImportSemaphoreWin32HandleKHR = 245,
+      GetBufferOpaqueCaptureAddress = 246,
+      CmdSetDepthWriteEnableEXT = 247,
+      CmdSetStencilTestEnable = 248,
+      DestroyAccelerationStructureNV = 249,
+      CmdWaitEvents = 250,
+      CreateBuffer = 251,
+      GetDeviceFaultInfoEXT = 252,
+      CmdSetCoverageModulationModeNV = 253,
+      GetDeviceGroupPresentCapabilitiesKHR = 254,
+      CmdSetLineRasterizationModeEXT = 255,
+      CmdDecodeVideoKHR = 256,
+      CmdSetScissorWithCountEXT = 257,
+      CreateImageView = 258,
+      SetLocalDimmingAMD = 259,
+      CreateVideoSessionKHR = 260,
+      GetMicromapBuildSizesEXT = 261,
+      CreateShadersEXT = 262,
+      GetMemoryZirconHandleFUCHSIA = 263,
+      GetSemaphoreZirconHandleFUCHSIA = 264,
+      CmdBeginRenderPass2 = 265,
+      CmdBeginRenderingKHR = 266,
+      CmdBindDescriptorBufferEmbeddedSamplersEXT = 267,
+      CopyMicromapToMemoryEXT = 268,
+      TrimCommandPool = 269,
+      GetDeviceQueue = 270,
+      DestroyMicromapEXT = 271,
+      GetRefreshCycleDurationGOOGLE = 272,
+      DestroyPipelineLayout = 273,
+      DestroyVideoSessionParametersKHR = 274,
+      CmdPreprocessGeneratedCommandsNV = 275,
+      CmdSetCoverageToColorEnableNV = 276,
+      GetFenceStatus = 277,
+      GetVideoSessionMemoryRequirementsKHR = 278,
+      ResetFences = 279,
+      CmdSetDiscardRectangleEnableEXT = 280,
+      CmdDraw = 281,
+      GetPipelinePropertiesEXT = 282,
+      CmdPushDescriptorSetWithTemplateKHR = 283,
+      CmdSetEvent = 284,
+      CmdSetColorBlendEquationEXT = 285,
+      CmdClearColorImage = 286,
+      GetDescriptorSetLayoutSupportKHR = 287,
+      CmdSetViewport = 288,
+      DestroyShaderEXT = 289,
+      CmdTraceRaysNV = 290,
+      CmdSetPrimitiveTopology = 291,
+      GetBufferDeviceAddressKHR = 292,
+      GetDescriptorSetHostMappingVALVE = 293,
+      CmdSetDepthClampEnableEXT = 294,
+      CmdSetFrontFace = 295,
+      GetFenceWin32HandleKHR = 296,
+      CmdResetQueryPool = 297,
+      CmdDrawIndirectCount = 298,
+      CmdBindPipeline = 299,
+      DestroyDeferredOperationKHR = 300,
+      CmdSetLogicOpEXT = 301,
+      GetSamplerOpaqueCaptureDescriptorDataEXT = 302,
+      CmdSetDepthCompareOp = 303,
+      CmdDebugMarkerInsertEXT = 304,
+      BuildMicromapsEXT = 305,
+      UnmapMemory2KHR = 306,
+      WriteMicromapsPropertiesEXT = 307,
+      FreeCommandBuffers = 308,
+      CmdSetStencilWriteMask = 309,
+      CreateMicromapEXT = 310,
+      CmdSetConservativeRasterizationModeEXT = 311,
+      CmdEndRenderPass2 = 312,
+      CmdDrawClusterIndirectHUAWEI = 313,
+      GetPipelineExecutablePropertiesKHR = 314,
+      SetBufferCollectionBufferConstraintsFUCHSIA = 315,
+      CmdResetEvent2KHR = 316,
+      DestroyBufferView = 317,
+      CmdTraceRaysIndirect2KHR = 318,
+      CmdSetStencilOp = 319,
+      CompileDeferredNV = 320,
+      GetBufferDeviceAddressEXT = 321,
+      GetImageSparseMemoryRequirements2KHR = 322,
+      CmdSetPrimitiveTopologyEXT = 323,
+      CreateShaderModule = 324,
+      CmdSetFrontFaceEXT = 325,
+      GetImageMemoryRequirements2 = 326,
+      CreateEvent = 327,
+      GetMemoryZirconHandlePropertiesFUCHSIA = 328,
+      DestroyDescriptorPool = 329,
+      RegisterDeviceEventEXT = 330,
+      ReleasePerformanceConfigurationINTEL = 331,
+      CmdDrawMeshTasksEXT = 332,
+      BindVideoSessionMemoryKHR = 333,
+      CmdCopyMicromapToMemoryEXT = 334,
+      DestroyPrivateDataSlot = 335,
+      CmdSetEvent2KHR = 336,
+      GetDescriptorSetLayoutSizeEXT = 337,
+      CmdDebugMarkerBeginEXT = 338,
+      CmdWriteMicromapsPropertiesEXT = 339,
+      CopyAccelerationStructureKHR = 340,
+      DestroyPrivateDataSlotEXT = 341,
+      ResetEvent = 342,
+      CmdCopyImage = 343,
+      AllocateMemory = 344,
+      FreeMemory = 345,
+      CmdCopyBufferToImage2 = 346,
+      CmdSetAttachmentFeedbackLoopEnableEXT = 347,
+      SetHdrMetadataEXT = 348,
+      GetPastPresentationTimingGOOGLE = 349,
+      QueueSetPerformanceConfigurationINTEL = 350,
+      GetDeviceGroupPeerMemoryFeatures = 351,
+      CmdSetCullMode = 352,
+      CmdSetViewportWScalingNV = 353,
+      GetRenderAreaGranularity = 354,
+      CmdSetCoverageModulationTableNV = 355,
+      UpdateDescriptorSets = 356,
+      GetDeviceImageMemoryRequirements = 357,
+      DestroyFramebuffer = 358,
+      CmdCopyAccelerationStructureNV = 359,
+      CmdSetSampleLocationsEnableEXT = 360,
+      CmdEndQueryIndexedEXT = 361,
+      QueueSubmit2 = 362,
+      GetMemoryWin32HandleNV = 363,
+      GetDeviceMicromapCompatibilityEXT = 364,
+      GetAccelerationStructureHandleNV = 365,
+      CmdCopyBufferToImage = 366,
+      CopyMemoryToAccelerationStructureKHR = 367,
+      GetQueueCheckpointDataNV = 368,
+      GetImageDrmFormatModifierPropertiesEXT = 369,
+      UnmapMemory = 370,
+      CreateSwapchainKHR = 371,
+      CmdSetViewportWithCount = 372,
+      CmdCopyBuffer2KHR = 373,
+      CmdBeginVideoCodingKHR = 374,
+      GetDescriptorSetLayoutSupport = 375,
+      CmdSetCullModeEXT = 376,
+      CmdNextSubpass = 377,
+      DestroyFence = 378,
+      CmdBindVertexBuffers2 = 379,
+      CmdBindShadingRateImageNV = 380,
+      CmdBindPipelineShaderGroupNV = 381,
+      DestroyVideoSessionKHR = 382,
+      CmdSetEvent2 = 383,
+      CmdSetSampleLocationsEXT = 384,
+      CmdDrawMultiIndexedEXT = 385,
+      ResetQueryPool = 386,
+      CmdSetBlendConstants = 387,
+      CmdSetViewportShadingRatePaletteNV = 388,
+      GetPerformanceParameterINTEL = 389,
+      CmdSetDepthWriteEnable = 390,
+      CreateSemaphore = 391,
+      AcquireNextImage2KHR = 392,
+      CmdSetExclusiveScissorEnableNV = 393,
+      GetDeviceImageMemoryRequirementsKHR = 394,
+      ResetQueryPoolEXT = 395,
+      CmdWriteBufferMarker2AMD = 396,
+      CmdDrawMultiEXT = 397,
+      AcquirePerformanceConfigurationINTEL = 398,
+      CreateDescriptorSetLayout = 399,
+      ResetCommandBuffer = 400,
+      CmdDrawIndexedIndirect = 401,
+      CmdPipelineBarrier2 = 402,
+      CmdSetPerformanceStreamMarkerINTEL = 403,
+      CmdClearDepthStencilImage = 404,
+      CmdSetViewportWScalingEnableNV = 405,
+      CmdCopyMemoryToMicromapEXT = 406,
+      CmdWriteTimestamp2 = 407,
+      QueueBeginDebugUtilsLabelEXT = 408,
+      GetImageMemoryRequirements2KHR = 409,
+      CmdCopyBuffer2 = 410,
+      CmdEndRenderingKHR = 411,
+      CmdSetPrimitiveRestartEnable = 412,
+      CreateIndirectCommandsLayoutNV = 413,
+      CreateFence = 414,
+      AllocateDescriptorSets = 415,
+      CmdCopyBuffer = 416,
+      CmdSetShadingRateImageEnableNV = 417,
+      CmdSetPrimitiveRestartEnableEXT = 418,
+      QueueSubmit2KHR = 419,
+      GetRayTracingCaptureReplayShaderGroupHandlesKHR = 420,
+      DestroySemaphore = 421,
+      CmdSetDepthTestEnable = 422,
+      SetEvent = 423,
+      ResetDescriptorPool = 424,
+      CmdDrawIndirectCountKHR = 425,
+      CreateAccelerationStructureNV = 426,
+      CmdSetCoarseSampleOrderNV = 427,
+      CmdSetCoverageToColorLocationNV = 428,
+      CreateBufferView = 429,
+      CmdSetRayTracingPipelineStackSizeKHR = 430,
+      InitializePerformanceApiINTEL = 431,
+      GetShaderModuleIdentifierEXT = 432,
+      CmdEndTransformFeedbackEXT = 433,
+      DestroyEvent = 434,
+      DestroyOpticalFlowSessionNV = 435,
+      GetMemoryWin32HandleKHR = 436,
+      GetBufferDeviceAddress = 437,
+      RegisterDisplayEventEXT = 438,
+      MergeValidationCachesEXT = 439,
+      FreeDescriptorSets = 440,
+      CmdUpdateBuffer = 441,
+      GetAccelerationStructureMemoryRequirementsNV = 442,
+      TrimCommandPoolKHR = 443,
+      CmdDecompressMemoryNV = 444,
+      CmdSetDeviceMaskKHR = 445,
+      CmdCopyQueryPoolResults = 446,
+      CmdDrawMeshTasksNV = 447,
+      CmdSetViewportSwizzleNV = 448,
+      CreateFramebuffer = 449,
+      GetBufferCollectionPropertiesFUCHSIA = 450,
+      CmdEndRendering = 451,
+      CmdSetExclusiveScissorNV = 452,
+      GetAccelerationStructureOpaqueCaptureDescriptorDataEXT = 453,
+      CmdWriteTimestamp2KHR = 454,
+      QueueSubmit = 455,
+      GetDeviceAccelerationStructureCompatibilityKHR = 456,
+      DestroyRenderPass = 457,
+      CmdDrawIndirect = 458,
+      GetPrivateDataEXT = 459,
+      GetDeviceGroupSurfacePresentModes2EXT = 460,
+      CmdBuildMicromapsEXT = 461,
+      CmdDispatch = 462,
+      CmdDecompressMemoryIndirectCountNV = 463,
+      GetImageSparseMemoryRequirements2 = 464,
+      UninitializePerformanceApiINTEL = 465,
+      GetPipelineExecutableInternalRepresentationsKHR = 466,
+      ExportMetalObjectsEXT = 467,
+      CmdBuildAccelerationStructuresKHR = 468,
+      ReleaseFullScreenExclusiveModeEXT = 469,
+      GetSwapchainImagesKHR = 470,
+      CreatePrivateDataSlot = 471,
+      GetMemoryFdKHR = 472,
+      WriteAccelerationStructuresPropertiesKHR = 473,
+      GetAccelerationStructureBuildSizesKHR = 474,
+      CmdSetAlphaToOneEnableEXT = 475,
+      BindOpticalFlowSessionImageNV = 476,
+      GetDeferredOperationResultKHR = 477,
+      GetPrivateData = 478,
+      GetBufferMemoryRequirements2KHR = 479,
+      ImportSemaphoreFdKHR = 480,
+      GetMemoryAndroidHardwareBufferANDROID = 481,
+      GetSemaphoreCounterValueKHR = 482,
+      DestroyBuffer = 483,
+      CmdCopyImageToBuffer2 = 484,
+      CmdBindVertexBuffers = 485,
+      GetMemoryFdPropertiesKHR = 486,
+      DestroySamplerYcbcrConversionKHR = 487,
+      QueueBindSparse = 488,
+      CmdNextSubpass2KHR = 489,
+      CmdBindDescriptorBuffersEXT = 490,
+      CmdSubpassShadingHUAWEI = 491,
+      GetBufferOpaqueCaptureDescriptorDataEXT = 492,
+      CreateRenderPass = 493,
+      CmdSetRepresentativeFragmentTestEnableNV = 494,
+      CreateComputePipelines = 495,
+      CmdDrawIndexedIndirectCount = 496,
+      CreatePrivateDataSlotEXT = 497,
+      CmdWaitEvents2 = 498,
+      CreateDescriptorUpdateTemplate = 499,
+      SetDeviceMemoryPriorityEXT = 500,
+      CmdBeginTransformFeedbackEXT = 501,
+      InvalidateMappedMemoryRanges = 502,
+      GetDeviceImageSparseMemoryRequirementsKHR = 503,
+      CmdSetStencilCompareMask = 504,
+      CmdSetVertexInputEXT = 505,
+      CmdCopyImageToBuffer2KHR = 506,
+      CmdBeginRenderPass = 507,
+      GetImageMemoryRequirements = 508,
+      CmdBindInvocationMaskHUAWEI = 509,
+      UpdateDescriptorSetWithTemplateKHR = 510,
+      DestroyImage = 511,
+      CmdSetPerformanceOverrideINTEL = 512,
+      GetAndroidHardwareBufferPropertiesANDROID = 513,
+      GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = 514,
+      CmdExecuteCommands = 515,
+      GetFenceFdKHR = 516,
+      EndCommandBuffer = 517,
+      CmdBeginConditionalRenderingEXT = 518,
+      CmdTraceRaysIndirectKHR = 519,
+      CmdSetStencilOpEXT = 520,
+      GetDeviceGroupPeerMemoryFeaturesKHR = 521,
+      CmdBindTransformFeedbackBuffersEXT = 522,
+      Count = 523,
+    };
+
+    inline constexpr int32_t DeviceFuncSeeds[523] = {
+      0, 0, 0, 1, 1, 0, -514, 3, -509, 1, -507, 0, 1, -500, -499, 1,
+      -498, 0, 0, 0, -496, -493, 0, -492, 2, 0, -491, 0, -490, -489, -488, 0,
+      -487, 4, -486, 0, 0, 2, -485, -480, 0, -475, -474, 0, 0, -471, 0, 0,
+      0, 2, 0, -469, 0, 2, 1, 0, 0, 2, -464, 1, 0, 0, 1, -461,
+      -460, -459, 0, 0, -457, 1, -455, 0, 0, -454, 0, 2, -453, 0, 0, 0,
+      -446, 0, 7, 0, 0, -445, 1, 3, 0, 1, 0, -443, 0, 1, 0, 7,
+      1, 5, -441, 0, 1, -436, 0, 0, -435, -432, 1, 0, -428, 1, 0, 0,
+      0, 0, 0, 0, -426, 4, 2, 3, -425, 0, 1, -423, 0, 3, 0, 1,
+      0, 4, 0, 0, 0, 0, 6, 1, 0, 2, 2, 5, -415, -414, -410, -408,
+      -405, 1, 0, 1, -403, 1, 0, -400, 1, 0, 0, -399, 0, 4, 0, 2,
+      0, -398, -396, 0, -394, 0, 3, 4, -393, 2, 5, 1, 0, -391, 0, 0,
+      2, -388, -380, 0, 1, -379, -375, -374, 0, 1, -371, -370, 0, 10, -368, -364,
+      -361, 0, 2, -360, -358, -357, -356, -353, 0, 3, 0, 0, 0, -343, 0, 3,
+      -341, 0, -335, 7, 8, 1, -332, 0, -329, 0, 0, 2, -328, 1, -324, -322,
+      -318, -313, 0, -311, 0, 1, 0, 4, 1, 0, 1, -308, -305, -304, 0, 1,
+      0, -303, -301, 0, 0, -296, 1, 0, -294, 1, 0, 0, -293, 0, 0, 3,
+      0, 0, 0, -290, -288, 0, 0, 0, 0, 0, -285, 3, 1, 0, -282, -277,
+      0, 0, 4, 0, -275, 0, 1, 0, -265, -264, 0, 2, 0, 5, -262, -260,
+      -259, 1, 0, -255, -249, -248, 0, 0, -246, 3, -244, 0, 2, -241, -239, 2,
+      0, 0, 0, 2, -237, -235, -229, -227, 0, 0, -225, -223, -221, 0, 2, 0,
+      0, 1, -220, 0, -219, 10, 5, -218, 0, -217, 0, 0, -215, 0, -213, 1,
+      0, 2, 1, 4, -211, -209, -208, 0, 0, 3, 4, -204, 2, 3, 8, 0,
+      0, 0, 0, 0, -203, 1, 0, 0, 0, 0, 1, 0, -202, -201, 0, 9,
+      1, -198, 1, 9, -197, -194, 7, -190, 2, -188, -186, 3, 0, 0, 2, -181,
+      -180, 0, -179, -174, 2, 0, 0, -170, -167, -166, 1, -163, 5, 3, 10, 6,
+      0, -162, -159, -157, -156, -151, -148, 0, 1, 0, 2, 2, 3, 0, -141, -138,
+      3, 0, 0, 2, -137, 14, 7, 0, -130, 0, 0, 0, 6, 1, -122, -113,
+      0, 3, 1, -112, 1, 0, -110, 2, -109, -106, -104, -94, -90, 0, -88, 0,
+      0, -84, 0, 0, 0, -81, 6, 0, 33, 2, -77, 0, -76, 0, 0, -74,
+      0, -72, 0, 0, -71, 0, -67, 0, -65, -64, 0, 0, 19, 1, -53, -52,
+      4, -49, -48, 3, -47, 0, -44, 0, 1, 0, -43, 3, 24, 1, 8, 1,
+      3, 13, -31, 0, 0, 0, -27, 0, 0, 2, 9, -23, 0, -20, 0, -18,
+      -17, 3, 0, -13, 0, -7, -5, -3, 0, 1, 1,
+    };
+
+    inline constexpr const char* DeviceFuncNames[523] = {
+      "vkCmdSetColorWriteMaskEXT",
+      "vkSetPrivateDataEXT",
+      "vkReleaseProfilingLockKHR",
+      "vkGetImageViewOpaqueCaptureDescriptorDataEXT",
+      "vkCmdSetSampleMaskEXT",
+      "vkCmdSetDescriptorBufferOffsetsEXT",
+      "vkCopyAccelerationStructureToMemoryKHR",
+      "vkBindBufferMemory2KHR",
+      "vkCmdSetStencilTestEnableEXT",
+      "vkDestroyDescriptorUpdateTemplateKHR",
+      "vkCmdEndVideoCodingKHR",
+      "vkDestroySwapchainKHR",
+      "vkCmdControlVideoCodingKHR",
+      "vkQueuePresentKHR",
+      "vkCmdSetDepthBias",
+      "vkCmdResolveImage2",
+      "vkDestroyCommandPool",
+      "vkDestroyAccelerationStructureKHR",
+      "vkBuildAccelerationStructuresKHR",
+      "vkCmdBindIndexBuffer",
+      "vkQueueWaitIdle",
+      "vkCmdSetDepthBounds",
+      "vkBindBufferMemory2",
+      "vkCmdDrawIndexedIndirectCountKHR",
+      "vkGetImageOpaqueCaptureDescriptorDataEXT",
+      "vkCmdSetPolygonModeEXT",
+      "vkCmdCopyAccelerationStructureKHR",
+      "vkDestroyPipeline",
+      "vkGetDeviceBufferMemoryRequirementsKHR",
+      "vkResetCommandPool",
+      "vkCmdEndConditionalRenderingEXT",
+      "vkCmdBuildAccelerationStructuresIndirectKHR",
+      "vkCmdSetPatchControlPointsEXT",
+      "vkCmdCopyMemoryToImageIndirectNV",
+      "vkCmdSetRasterizationStreamEXT",
+      "vkCmdEndRenderPass",
+      "vkGetDescriptorSetLayoutHostMappingInfoVALVE",
+      "vkAcquireFullScreenExclusiveModeEXT",
+      "vkDestroySamplerYcbcrConversion",
+      "vkDebugMarkerSetObjectNameEXT",
+      "vkCmdSetDepthBiasEnable",
+      "vkBindImageMemory2KHR",
+      "vkCmdSetDepthBoundsTestEnableEXT",
+      "vkCmdSetCoverageModulationTableEnableNV",
+      "vkCmdSetColorBlendAdvancedEXT",
+      "vkWaitSemaphoresKHR",
+      "vkCreateSamplerYcbcrConversion",
+      "vkCmdSetColorWriteEnableEXT",
+      "vkGetSwapchainCounterEXT",
+      "vkMapMemory",
+      "vkCmdEndRenderPass2KHR",
+      "vkCmdWriteAccelerationStructuresPropertiesNV",
+      "vkCmdSetDiscardRectangleEXT",
+      "vkCmdSetDiscardRectangleModeEXT",
+      "vkGetMemoryHostPointerPropertiesEXT",
+      "vkAcquireProfilingLockKHR",
+      "vkGetEventStatus",
+      "vkCmdCopyImage2KHR",
+      "vkGetDeviceQueue2",
+      "vkCmdBlitImage2",
+      "vkCmdResolveImage",
+      "vkCreateRayTracingPipelinesKHR",
+      "vkGetValidationCacheDataEXT",
+      "vkCmdBindShadersEXT",
+      "vkCmdPipelineBarrier2KHR",
+      "vkCmdSetLineWidth",
+      "vkDestroyIndirectCommandsLayoutNV",
+      "vkGetPipelineCacheData",
+      "vkCmdResolveImage2KHR",
+      "vkGetShaderModuleCreateInfoIdentifierEXT",
+      "vkCmdSetCheckpointNV",
+      "vkGetAccelerationStructureDeviceAddressKHR",
+      "vkCmdDrawMeshTasksIndirectNV",
+      "vkCmdSetDepthTestEnableEXT",
+      "vkSignalSemaphoreKHR",
+      "vkCreateRayTracingPipelinesNV",
+      "vkDebugMarkerSetObjectTagEXT",
+      "vkDestroyValidationCacheEXT",
+      "vkCreateRenderPass2",
+      "vkCmdSetStencilReference",
+      "vkGetDeviceMemoryOpaqueCaptureAddressKHR",
+      "vkCmdDrawMeshTasksIndirectCountEXT",
+      "vkCreateSampler",
+      "vkGetBufferOpaqueCaptureAddressKHR",
+      "vkCmdBindVertexBuffers2EXT",
+      "vkCreateOpticalFlowSessionNV",
+      "vkGetDynamicRenderingTilePropertiesQCOM",
+      "vkCmdBeginQuery",
+      "vkGetCalibratedTimestampsEXT",
+      "vkGetSemaphoreWin32HandleKHR",
+      "vkBindAccelerationStructureMemoryNV",
+      "vkCmdBlitImage",
+      "vkSetBufferCollectionImageConstraintsFUCHSIA",
+      "vkCmdOpticalFlowExecuteNV",
+      "vkCmdDispatchBaseKHR",
+      "vkDestroyDevice",
+      "vkCmdSetExtraPrimitiveOverestimationSizeEXT",
+      "vkQueueInsertDebugUtilsLabelEXT",
+      "vkWaitSemaphores",
+      "vkCreateCommandPool",
+      "vkCreateGraphicsPipelines",
+      "vkCmdSetViewportWithCountEXT",
+      "vkCreateVideoSessionParametersKHR",
+      "vkReleaseSwapchainImagesEXT",
+      "vkCopyMicromapEXT",
+      "vkDestroyImageView",
+      "vkSetDebugUtilsObjectNameEXT",
+      "vkGetDeviceMemoryOpaqueCaptureAddress",
+      "vkMapMemory2KHR",
+      "vkCmdBlitImage2KHR",
+      "vkCreateDescriptorPool",
+      "vkGetImageSubresourceLayout",
+      "vkBindBufferMemory",
+      "vkGetSemaphoreCounterValue",
+      "vkCmdEndQuery",
+      "vkCreatePipelineCache",
+      "vkCreateImage",
+      "vkCmdSetFragmentShadingRateEnumNV",
+      "vkAcquireNextImageKHR",
+      "vkCmdPipelineBarrier",
+      "vkCmdSetTessellationDomainOriginEXT",
+      "vkWaitForPresentKHR",
+      "vkCreateSharedSwapchainsKHR",
+      "vkCmdBeginRendering",
+      "vkImportSemaphoreZirconHandleFUCHSIA",
+      "vkDeviceWaitIdle",
+      "vkDestroyDescriptorUpdateTemplate",
+      "vkGetShaderBinaryDataEXT",
+      "vkCmdPushConstants",
+      "vkCmdDebugMarkerEndEXT",
+      "vkCmdSetCoverageReductionModeNV",
+      "vkGetDeviceProcAddr",
+      "vkCmdFillBuffer",
+      "vkGetDeviceBufferMemoryRequirements",
+      "vkMergePipelineCaches",
+      "vkGetEncodedVideoSessionParametersKHR",
+      "vkCmdBeginRenderPass2KHR",
+      "vkGetGeneratedCommandsMemoryRequirementsNV",
+      "vkCmdCopyAccelerationStructureToMemoryKHR",
+      "vkCmdDrawIndirectByteCountEXT",
+      "vkGetBufferMemoryRequirements",
+      "vkGetImageSparseMemoryRequirements",
+      "vkCmdBindDescriptorSets",
+      "vkCmdSetDepthBoundsTestEnable",
+      "vkGetSwapchainStatusKHR",
+      "vkImportFenceFdKHR",
+      "vkGetDescriptorEXT",
+      "vkCreateRenderPass2KHR",
+      "vkBindImageMemory",
+      "vkCmdCopyImage2",
+      "vkDestroyPipelineCache",
+      "vkDestroyDescriptorSetLayout",
+      "vkCmdSetRasterizerDiscardEnableEXT",
+      "vkCmdResetEvent",
+      "vkCmdSetDepthCompareOpEXT",
+      "vkCreateValidationCacheEXT",
+      "vkCreateQueryPool",
+      "vkGetMemoryRemoteAddressNV",
+      "vkSetDebugUtilsObjectTagEXT",
+      "vkCmdDispatchIndirect",
+      "vkCmdSetAlphaToCoverageEnableEXT",
+      "vkCreateAccelerationStructureKHR",
+      "vkCmdSetLineStippleEXT",
+      "vkCmdSetDepthBiasEnableEXT",
+      "vkSetPrivateData",
+      "vkDestroyShaderModule",
+      "vkCmdSetScissorWithCount",
+      "vkCmdSetLogicOpEnableEXT",
+      "vkCmdCopyMicromapEXT",
+      "vkCmdClearAttachments",
+      "vkCmdNextSubpass2",
+      "vkCreateDeferredOperationKHR",
+      "vkGetRayTracingShaderGroupHandlesNV",
+      "vkCmdWaitEvents2KHR",
+      "vkDeferredOperationJoinKHR",
+      "vkCmdSetProvokingVertexModeEXT",
+      "vkBindImageMemory2",
+      "vkGetFramebufferTilePropertiesQCOM",
+      "vkCreateSamplerYcbcrConversionKHR",
+      "vkCmdTraceRaysKHR",
+      "vkCreateBufferCollectionFUCHSIA",
+      "vkCmdCopyMemoryToAccelerationStructureKHR",
+      "vkCmdBeginQueryIndexedEXT",
+      "vkCreatePipelineLayout",
+      "vkCmdCopyMemoryIndirectNV",
+      "vkGetDescriptorSetLayoutBindingOffsetEXT",
+      "vkGetImageSubresourceLayout2EXT",
+      "vkCmdSetFragmentShadingRateKHR",
+      "vkGetBufferMemoryRequirements2",
+      "vkUpdateDescriptorSetWithTemplate",
+      "vkCmdResetEvent2",
+      "vkFlushMappedMemoryRanges",
+      "vkCmdCopyImageToBuffer",
+      "vkCmdInsertDebugUtilsLabelEXT",
+      "vkDisplayPowerControlEXT",
+      "vkCreateDescriptorUpdateTemplateKHR",
+      "vkGetQueryPoolResults",
+      "vkCmdSetDeviceMask",
+      "vkGetQueueCheckpointData2NV",
+      "vkCmdSetScissor",
+      "vkSignalSemaphore",
+      "vkGetPipelineExecutableStatisticsKHR",
+      "vkDestroySampler",
+      "vkCmdExecuteGeneratedCommandsNV",
+      "vkCmdSetPerformanceMarkerINTEL",
+      "vkCmdSetColorBlendEnableEXT",
+      "vkGetRayTracingShaderGroupHandlesKHR",
+      "vkCmdSetDepthClipEnableEXT",
+      "vkCmdDispatchBase",
+      "vkCmdWriteTimestamp",
+      "vkQueueEndDebugUtilsLabelEXT",
+      "vkGetSemaphoreFdKHR",
+      "vkCmdSetDepthClipNegativeOneToOneEXT",
+      "vkCmdCopyBufferToImage2KHR",
+      "vkGetShaderInfoAMD",
+      "vkCmdWriteBufferMarkerAMD",
+      "vkGetDeviceMemoryCommitment",
+      "vkDestroyQueryPool",
+      "vkBeginCommandBuffer",
+      "vkCmdDrawIndexedIndirectCountAMD",
+      "vkGetDeviceGroupSurfacePresentModesKHR",
+      "vkCmdSetRasterizerDiscardEnable",
+      "vkCmdDrawMeshTasksIndirectEXT",
+      "vkCmdBeginDebugUtilsLabelEXT",
+      "vkCmdEndDebugUtilsLabelEXT",
+      "vkDestroyBufferCollectionFUCHSIA",
+      "vkCmdSetLineStippleEnableEXT",
+      "vkImportFenceWin32HandleKHR",
+      "vkWaitForFences",
+      "vkCmdWriteAccelerationStructuresPropertiesKHR",
+      "vkCmdDrawIndirectCountAMD",
+      "vkCmdPushDescriptorSetKHR",
+      "vkGetDeviceImageSparseMemoryRequirements",
+      "vkGetRayTracingShaderGroupStackSizeKHR",
+      "vkCmdDrawClusterHUAWEI",
+      "vkGetDeferredOperationMaxConcurrencyKHR",
+      "vkCmdDrawMeshTasksIndirectCountNV",
+      "vkAllocateCommandBuffers",
+      "vkCmdEncodeVideoKHR",
+      "vkCopyMemoryToMicromapEXT",
+      "vkCmdBuildAccelerationStructureNV",
+      "vkCmdDrawIndexed",
+      "vkGetMemoryWin32HandlePropertiesKHR",
+      "vkUpdateVideoSessionParametersKHR",
+      "vkCmdSetRasterizationSamplesEXT",
+      "vkImportSemaphoreWin32HandleKHR",
+      "vkGetBufferOpaqueCaptureAddress",
+      "vkCmdSetDepthWriteEnableEXT",
+      "vkCmdSetStencilTestEnable",
+      "vkDestroyAccelerationStructureNV",
+      "vkCmdWaitEvents",
+      "vkCreateBuffer",
+      "vkGetDeviceFaultInfoEXT",
+      "vkCmdSetCoverageModulationModeNV",
+      "vkGetDeviceGroupPresentCapabilitiesKHR",
+      "vkCmdSetLineRasterizationModeEXT",
+      "vkCmdDecodeVideoKHR",
+      "vkCmdSetScissorWithCountEXT",
+      "vkCreateImageView",
+      "vkSetLocalDimmingAMD",
+      "vkCreateVideoSessionKHR",
+      "vkGetMicromapBuildSizesEXT",
+      "vkCreateShadersEXT",
+      "vkGetMemoryZirconHandleFUCHSIA",
+      "vkGetSemaphoreZirconHandleFUCHSIA",
+      "vkCmdBeginRenderPass2",
+      "vkCmdBeginRenderingKHR",
+      "vkCmdBindDescriptorBufferEmbeddedSamplersEXT",
+      "vkCopyMicromapToMemoryEXT",
+      "vkTrimCommandPool",
+      "vkGetDeviceQueue",
+      "vkDestroyMicromapEXT",
+      "vkGetRefreshCycleDurationGOOGLE",
+      "vkDestroyPipelineLayout",
+      "vkDestroyVideoSessionParametersKHR",
+      "vkCmdPreprocessGeneratedCommandsNV",
+      "vkCmdSetCoverageToColorEnableNV",
+      "vkGetFenceStatus",
+      "vkGetVideoSessionMemoryRequirementsKHR",
+      "vkResetFences",
+      "vkCmdSetDiscardRectangleEnableEXT",
+      "vkCmdDraw",
+      "vkGetPipelinePropertiesEXT",
+      "vkCmdPushDescriptorSetWithTemplateKHR",
+      "vkCmdSetEvent",
+      "vkCmdSetColorBlendEquationEXT",
+      "vkCmdClearColorImage",
+      "vkGetDescriptorSetLayoutSupportKHR",
+      "vkCmdSetViewport",
+      "vkDestroyShaderEXT",
+      "vkCmdTraceRaysNV",
+      "vkCmdSetPrimitiveTopology",
+      "vkGetBufferDeviceAddressKHR",
+      "vkGetDescriptorSetHostMappingVALVE",
+      "vkCmdSetDepthClampEnableEXT",
+      "vkCmdSetFrontFace",
+      "vkGetFenceWin32HandleKHR",
+      "vkCmdResetQueryPool",
+      "vkCmdDrawIndirectCount",
+      "vkCmdBindPipeline",
+      "vkDestroyDeferredOperationKHR",
+      "vkCmdSetLogicOpEXT",
+      "vkGetSamplerOpaqueCaptureDescriptorDataEXT",
+      "vkCmdSetDepthCompareOp",
+      "vkCmdDebugMarkerInsertEXT",
+      "vkBuildMicromapsEXT",
+      "vkUnmapMemory2KHR",
+      "vkWriteMicromapsPropertiesEXT",
+      "vkFreeCommandBuffers",
+      "vkCmdSetStencilWriteMask",
+      "vkCreateMicromapEXT",
+      "vkCmdSetConservativeRasterizationModeEXT",
+      "vkCmdEndRenderPass2",
+      "vkCmdDrawClusterIndirectHUAWEI",
+      "vkGetPipelineExecutablePropertiesKHR",
+      "vkSetBufferCollectionBufferConstraintsFUCHSIA",
+      "vkCmdResetEvent2KHR",
+      "vkDestroyBufferView",
+      "vkCmdTraceRaysIndirect2KHR",
+      "vkCmdSetStencilOp",
+      "vkCompileDeferredNV",
+      "vkGetBufferDeviceAddressEXT",
+      "vkGetImageSparseMemoryRequirements2KHR",
+      "vkCmdSetPrimitiveTopologyEXT",
+      "vkCreateShaderModule",
+      "vkCmdSetFrontFaceEXT",
+      "vkGetImageMemoryRequirements2",
+      "vkCreateEvent",
+      "vkGetMemoryZirconHandlePropertiesFUCHSIA",
+      "vkDestroyDescriptorPool",
+      "vkRegisterDeviceEventEXT",
+      "vkReleasePerformanceConfigurationINTEL",
+      "vkCmdDrawMeshTasksEXT",
+      "vkBindVideoSessionMemoryKHR",
+      "vkCmdCopyMicromapToMemoryEXT",
+      "vkDestroyPrivateDataSlot",
+      "vkCmdSetEvent2KHR",
+      "vkGetDescriptorSetLayoutSizeEXT",
+      "vkCmdDebugMarkerBeginEXT",
+      "vkCmdWriteMicromapsPropertiesEXT",
+      "vkCopyAccelerationStructureKHR",
+      "vkDestroyPrivateDataSlotEXT",
+      "vkResetEvent",
+      "vkCmdCopyImage",
+      "vkAllocateMemory",
+      "vkFreeMemory",
+      "vkCmdCopyBufferToImage2",
+      "vkCmdSetAttachmentFeedbackLoopEnableEXT",
+      "vkSetHdrMetadataEXT",
+      "vkGetPastPresentationTimingGOOGLE",
+      "vkQueueSetPerformanceConfigurationINTEL",
+      "vkGetDeviceGroupPeerMemoryFeatures",
+      "vkCmdSetCullMode",
+      "vkCmdSetViewportWScalingNV",
+      "vkGetRenderAreaGranularity",
+      "vkCmdSetCoverageModulationTableNV",
+      "vkUpdateDescriptorSets",
+      "vkGetDeviceImageMemoryRequirements",
+      "vkDestroyFramebuffer",
+      "vkCmdCopyAccelerationStructureNV",
+      "vkCmdSetSampleLocationsEnableEXT",
+      "vkCmdEndQueryIndexedEXT",
+      "vkQueueSubmit2",
+      "vkGetMemoryWin32HandleNV",
+      "vkGetDeviceMicromapCompatibilityEXT",
+      "vkGetAccelerationStructureHandleNV",
+      "vkCmdCopyBufferToImage",
+      "vkCopyMemoryToAccelerationStructureKHR",
+      "vkGetQueueCheckpointDataNV",
+      "vkGetImageDrmFormatModifierPropertiesEXT",
+      "vkUnmapMemory",
+      "vkCreateSwapchainKHR",
+      "vkCmdSetViewportWithCount",
+      "vkCmdCopyBuffer2KHR",
+      "vkCmdBeginVideoCodingKHR",
+      "vkGetDescriptorSetLayoutSupport",
+      "vkCmdSetCullModeEXT",
+      "vkCmdNextSubpass",
+      "vkDestroyFence",
+      "vkCmdBindVertexBuffers2",
+      "vkCmdBindShadingRateImageNV",
+      "vkCmdBindPipelineShaderGroupNV",
+      "vkDestroyVideoSessionKHR",
+      "vkCmdSetEvent2",
+      "vkCmdSetSampleLocationsEXT",
+      "vkCmdDrawMultiIndexedEXT",
+      "vkResetQueryPool",
+      "vkCmdSetBlendConstants",
+      "vkCmdSetViewportShadingRatePaletteNV",
+      "vkGetPerformanceParameterINTEL",
+      "vkCmdSetDepthWriteEnable",
+      "vkCreateSemaphore",
+      "vkAcquireNextImage2KHR",
+      "vkCmdSetExclusiveScissorEnableNV",
+      "vkGetDeviceImageMemoryRequirementsKHR",
+      "vkResetQueryPoolEXT",
+      "vkCmdWriteBufferMarker2AMD",
+      "vkCmdDrawMultiEXT",
+      "vkAcquirePerformanceConfigurationINTEL",
+      "vkCreateDescriptorSetLayout",
+      "vkResetCommandBuffer",
+      "vkCmdDrawIndexedIndirect",
+      "vkCmdPipelineBarrier2",
+      "vkCmdSetPerformanceStreamMarkerINTEL",
+      "vkCmdClearDepthStencilImage",
+      "vkCmdSetViewportWScalingEnableNV",
+      "vkCmdCopyMemoryToMicromapEXT",
+      "vkCmdWriteTimestamp2",
+      "vkQueueBeginDebugUtilsLabelEXT",
+      "vkGetImageMemoryRequirements2KHR",
+      "vkCmdCopyBuffer2",
+      "vkCmdEndRenderingKHR",
+      "vkCmdSetPrimitiveRestartEnable",
+      "vkCreateIndirectCommandsLayoutNV",
+      "vkCreateFence",
+      "vkAllocateDescriptorSets",
+      "vkCmdCopyBuffer",
+      "vkCmdSetShadingRateImageEnableNV",
+      "vkCmdSetPrimitiveRestartEnableEXT",
+      "vkQueueSubmit2KHR",
+      "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR",
+      "vkDestroySemaphore",
+      "vkCmdSetDepthTestEnable",
+      "vkSetEvent",
+      "vkResetDescriptorPool",
+      "vkCmdDrawIndirectCountKHR",
+      "vkCreateAccelerationStructureNV",
+      "vkCmdSetCoarseSampleOrderNV",
+      "vkCmdSetCoverageToColorLocationNV",
+      "vkCreateBufferView",
+      "vkCmdSetRayTracingPipelineStackSizeKHR",
+      "vkInitializePerformanceApiINTEL",
+      "vkGetShaderModuleIdentifierEXT",
+      "vkCmdEndTransformFeedbackEXT",
+      "vkDestroyEvent",
+      "vkDestroyOpticalFlowSessionNV",
+      "vkGetMemoryWin32HandleKHR",
+      "vkGetBufferDeviceAddress",
+      "vkRegisterDisplayEventEXT",
+      "vkMergeValidationCachesEXT",
+      "vkFreeDescriptorSets",
+      "vkCmdUpdateBuffer",
+      "vkGetAccelerationStructureMemoryRequirementsNV",
+      "vkTrimCommandPoolKHR",
+      "vkCmdDecompressMemoryNV",
+      "vkCmdSetDeviceMaskKHR",
+      "vkCmdCopyQueryPoolResults",
+      "vkCmdDrawMeshTasksNV",
+      "vkCmdSetViewportSwizzleNV",
+      "vkCreateFramebuffer",
+      "vkGetBufferCollectionPropertiesFUCHSIA",
+      "vkCmdEndRendering",
+      "vkCmdSetExclusiveScissorNV",
+      "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT",
+      "vkCmdWriteTimestamp2KHR",
+      "vkQueueSubmit",
+      "vkGetDeviceAccelerationStructureCompatibilityKHR",
+      "vkDestroyRenderPass",
+      "vkCmdDrawIndirect",
+      "vkGetPrivateDataEXT",
+      "vkGetDeviceGroupSurfacePresentModes2EXT",
+      "vkCmdBuildMicromapsEXT",
+      "vkCmdDispatch",
+      "vkCmdDecompressMemoryIndirectCountNV",
+      "vkGetImageSparseMemoryRequirements2",
+      "vkUninitializePerformanceApiINTEL",
+      "vkGetPipelineExecutableInternalRepresentationsKHR",
+      "vkExportMetalObjectsEXT",
+      "vkCmdBuildAccelerationStructuresKHR",
+      "vkReleaseFullScreenExclusiveModeEXT",
+      "vkGetSwapchainImagesKHR",
+      "vkCreatePrivateDataSlot",
+      "vkGetMemoryFdKHR",
+      "vkWriteAccelerationStructuresPropertiesKHR",
+      "vkGetAccelerationStructureBuildSizesKHR",
+      "vkCmdSetAlphaToOneEnableEXT",
+      "vkBindOpticalFlowSessionImageNV",
+      "vkGetDeferredOperationResultKHR",
+      "vkGetPrivateData",
+      "vkGetBufferMemoryRequirements2KHR",
+      "vkImportSemaphoreFdKHR",
+      "vkGetMemoryAndroidHardwareBufferANDROID",
+      "vkGetSemaphoreCounterValueKHR",
+      "vkDestroyBuffer",
+      "vkCmdCopyImageToBuffer2",
+      "vkCmdBindVertexBuffers",
+      "vkGetMemoryFdPropertiesKHR",
+      "vkDestroySamplerYcbcrConversionKHR",
+      "vkQueueBindSparse",
+      "vkCmdNextSubpass2KHR",
+      "vkCmdBindDescriptorBuffersEXT",
+      "vkCmdSubpassShadingHUAWEI",
+      "vkGetBufferOpaqueCaptureDescriptorDataEXT",
+      "vkCreateRenderPass",
+      "vkCmdSetRepresentativeFragmentTestEnableNV",
+      "vkCreateComputePipelines",
+      "vkCmdDrawIndexedIndirectCount",
+      "vkCreatePrivateDataSlotEXT",
+      "vkCmdWaitEvents2",
+      "vkCreateDescriptorUpdateTemplate",
+      "vkSetDeviceMemoryPriorityEXT",
+      "vkCmdBeginTransformFeedbackEXT",
+      "vkInvalidateMappedMemoryRanges",
+      "vkGetDeviceImageSparseMemoryRequirementsKHR",
+      "vkCmdSetStencilCompareMask",
+      "vkCmdSetVertexInputEXT",
+      "vkCmdCopyImageToBuffer2KHR",
+      "vkCmdBeginRenderPass",
+      "vkGetImageMemoryRequirements",
+      "vkCmdBindInvocationMaskHUAWEI",
+      "vkUpdateDescriptorSetWithTemplateKHR",
+      "vkDestroyImage",
+      "vkCmdSetPerformanceOverrideINTEL",
+      "vkGetAndroidHardwareBufferPropertiesANDROID",
+      "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI",
+      "vkCmdExecuteCommands",
+      "vkGetFenceFdKHR",
+      "vkEndCommandBuffer",
+      "vkCmdBeginConditionalRenderingEXT",
+      "vkCmdTraceRaysIndirectKHR",
+      "vkCmdSetStencilOpEXT",
+      "vkGetDeviceGroupPeerMemoryFeaturesKHR",
+      "vkCmdBindTransformFeedbackBuffersEXT",
+    };
+
+    constexpr DeviceFunc LookupDeviceFunc(const char* name) {
+      return Lookup<DeviceFunc>(DeviceFuncSeeds, DeviceFuncNames, name);
+    }
+
+    constexpr const char* FuncName(DeviceFunc func) {
+      return DeviceFuncNames[uint32_t(func)];
+    }
+  }
+
+  namespace procaddr {
+    enum class DeviceExtension : uint32_t {
+      FUCHSIA_external_memory = 0,
+      EXT_color_write_enable = 1,
+      EXT_discard_rectangles = 2,
+      EXT_full_screen_exclusive = 3,
+      KHR_dynamic_rendering = 4,
+      EXT_pageable_device_local_memory = 5,
+      KHR_ray_tracing_pipeline = 6,
+      INTEL_performance_query = 7,
+      EXT_debug_marker = 8,
+      EXT_shader_object = 9,
+      KHR_external_memory_fd = 10,
+      KHR_push_descriptor = 11,
+      EXT_extended_dynamic_state2 = 12,
+      AMD_display_native_hdr = 13,
+      KHR_external_fence_win32 = 14,
+      KHR_copy_commands2 = 15,
+      KHR_map_memory2 = 16,
+      NV_external_memory_win32 = 17,
+      EXT_image_drm_format_modifier = 18,
+      KHR_acceleration_structure = 19,
+      EXT_extended_dynamic_state3 = 20,
+      HUAWEI_subpass_shading = 21,
+      AMD_shader_info = 22,
+      EXT_pipeline_properties = 23,
+      KHR_display_swapchain = 24,
+      AMD_draw_indirect_count = 25,
+      KHR_maintenance1 = 26,
+      KHR_draw_indirect_count = 27,
+      EXT_shader_module_identifier = 28,
+      EXT_display_control = 29,
+      EXT_vertex_input_dynamic_state = 30,
+      KHR_ray_tracing_maintenance1 = 31,
+      EXT_conditional_rendering = 32,
+      KHR_pipeline_executable_properties = 33,
+      EXT_sample_locations = 34,
+      KHR_descriptor_update_template = 35,
+      HUAWEI_cluster_culling_shader = 36,
+      KHR_get_memory_requirements2 = 37,
+      GOOGLE_display_timing = 38,
+      KHR_present_wait = 39,
+      KHR_shared_presentable_image = 40,
+      NV_ray_tracing = 41,
+      NV_copy_memory_indirect = 42,
+      NV_device_diagnostic_checkpoints = 43,
+      NV_shading_rate_image = 44,
+      EXT_hdr_metadata = 45,
+      KHR_fragment_shading_rate = 46,
+      EXT_device_fault = 47,
+      KHR_create_renderpass2 = 48,
+      NV_clip_space_w_scaling = 49,
+      EXT_validation_cache = 50,
+      KHR_maintenance4 = 51,
+      KHR_external_memory_win32 = 52,
+      QCOM_tile_properties = 53,
+      EXT_private_data = 54,
+      KHR_bind_memory2 = 55,
+      KHR_external_semaphore_win32 = 56,
+      HUAWEI_invocation_mask = 57,
+      AMD_buffer_marker = 58,
+      KHR_maintenance3 = 59,
+      NV_mesh_shader = 60,
+      FUCHSIA_buffer_collection = 61,
+      EXT_swapchain_maintenance1 = 62,
+      KHR_video_queue = 63,
+      EXT_descriptor_buffer = 64,
+      KHR_swapchain = 65,
+      KHR_device_group = 66,
+      EXT_attachment_feedback_loop_dynamic_state = 67,
+      KHR_buffer_device_address = 68,
+      EXT_line_rasterization = 69,
+      KHR_synchronization2 = 70,
+      NV_external_memory_rdma = 71,
+      EXT_buffer_device_address = 72,
+      EXT_mesh_shader = 73,
+      NV_memory_decompression = 74,
+      KHR_performance_query = 75,
+      NV_device_generated_commands = 76,
+      NV_scissor_exclusive = 77,
+      NV_fragment_shading_rate_enums = 78,
+      EXT_image_compression_control = 79,
+      ANDROID_external_memory_android_hardware_buffer = 80,
+      FUCHSIA_external_semaphore = 81,
+      VALVE_descriptor_set_host_mapping = 82,
+      EXT_external_memory_host = 83,
+      KHR_external_fence_fd = 84,
+      KHR_video_decode_queue = 85,
+      KHR_external_semaphore_fd = 86,
+      EXT_opacity_micromap = 87,
+      KHR_video_encode_queue = 88,
+      EXT_metal_objects = 89,
+      KHR_timeline_semaphore = 90,
+      EXT_extended_dynamic_state = 91,
+      KHR_deferred_host_operations = 92,
+      EXT_transform_feedback = 93,
+      EXT_host_query_reset = 94,
+      KHR_sampler_ycbcr_conversion = 95,
+      EXT_multi_draw = 96,
+      NV_optical_flow = 97,
+      EXT_calibrated_timestamps = 98,
+      Count = 99,
+    };
+
+    inline constexpr int32_t DeviceExtensionSeeds[99] = {
+      0, -99, 0, 0, -98, 0, -93, -85, 0, 0, 0, -84, 1, -82, -79, 0,
+      -76, 0, -75, -72, 0, 0, 3, 1, -61, 0, 0, 0, 2, 0, 0, 1,
+      -56, 0, -55, 1, 1, -52, 0, 1, 2, 0, 0, 0, -46, 0, 0, 1,
+      1, -45, 1, 0, 0, 0, 2, 3, 1, -42, 0, -39, 1, 0, 1, 3,
+      2, 0, 1, -38, -33, 1, -32, -30, -28, 5, 0, -27, 2, 0, -25, 0,
+      -22, -18, 0, 15, 0, 0, -16, -15, 0, 0, -14, 7, 2, -8, -4, 3,
+      -2, 0, 0,
+    };
+
+    inline constexpr const char* DeviceExtensionNames[99] = {
+      "VK_FUCHSIA_external_memory",
+      "VK_EXT_color_write_enable",
+      "VK_EXT_discard_rectangles",
+      "VK_EXT_full_screen_exclusive",
+      "VK_KHR_dynamic_rendering",
+      "VK_EXT_pageable_device_local_memory",
+      "VK_KHR_ray_tracing_pipeline",
+      "VK_INTEL_performance_query",
+      "VK_EXT_debug_marker",
+      "VK_EXT_shader_object",
+      "VK_KHR_external_memory_fd",
+      "VK_KHR_push_descriptor",
+      "VK_EXT_extended_dynamic_state2",
+      "VK_AMD_display_native_hdr",
+      "VK_KHR_external_fence_win32",
+      "VK_KHR_copy_commands2",
+      "VK_KHR_map_memory2",
+      "VK_NV_external_memory_win32",
+      "VK_EXT_image_drm_format_modifier",
+      "VK_KHR_acceleration_structure",
+      "VK_EXT_extended_dynamic_state3",
+      "VK_HUAWEI_subpass_shading",
+      "VK_AMD_shader_info",
+      "VK_EXT_pipeline_properties",
+      "VK_KHR_display_swapchain",
+      "VK_AMD_draw_indirect_count",
+      "VK_KHR_maintenance1",
+      "VK_KHR_draw_indirect_count",
+      "VK_EXT_shader_module_identifier",
+      "VK_EXT_display_control",
+      "VK_EXT_vertex_input_dynamic_state",
+      "VK_KHR_ray_tracing_maintenance1",
+      "VK_EXT_conditional_rendering",
+      "VK_KHR_pipeline_executable_properties",
+      "VK_EXT_sample_locations",
+      "VK_KHR_descriptor_update_template",
+      "VK_HUAWEI_cluster_culling_shader",
+      "VK_KHR_get_memory_requirements2",
+      "VK_GOOGLE_display_timing",
+      "VK_KHR_present_wait",
+      "VK_KHR_shared_presentable_image",
+      "VK_NV_ray_tracing",
+      "VK_NV_copy_memory_indirect",
+      "VK_NV_device_diagnostic_checkpoints",
+      "VK_NV_shading_rate_image",
+      "VK_EXT_hdr_metadata",
+      "VK_KHR_fragment_shading_rate",
+      "VK_EXT_device_fault",
+      "VK_KHR_create_renderpass2",
+      "VK_NV_clip_space_w_scaling",
+      "VK_EXT_validation_cache",
+      "VK_KHR_maintenance4",
+      "VK_KHR_external_memory_win32",
+      "VK_QCOM_tile_properties",
+      "VK_EXT_private_data",
+      "VK_KHR_bind_memory2",
+      "VK_KHR_external_semaphore_win32",
+      "VK_HUAWEI_invocation_mask",
+      "VK_AMD_buffer_marker",
+      "VK_KHR_maintenance3",
+      "VK_NV_mesh_shader",
+      "VK_FUCHSIA_buffer_collection",
+      "VK_EXT_swapchain_maintenance1",
+      "VK_KHR_video_queue",
+      "VK_EXT_descriptor_buffer",
+      "VK_KHR_swapchain",
+      "VK_KHR_device_group",
+      "VK_EXT_attachment_feedback_loop_dynamic_state",
+      "VK_KHR_buffer_device_address",
+      "VK_EXT_line_rasterization",
+      "VK_KHR_synchronization2",
+      "VK_NV_external_memory_rdma",
+      "VK_EXT_buffer_device_address",
+      "VK_EXT_mesh_shader",
+      "VK_NV_memory_decompression",
+      "VK_KHR_performance_query",
+      "VK_NV_device_generated_commands",
+      "VK_NV_scissor_exclusive",
+      "VK_NV_fragment_shading_rate_enums",
+      "VK_EXT_image_compression_control",
+      "VK_ANDROID_external_memory_android_hardware_buffer",
+      "VK_FUCHSIA_external_semaphore",
+      "VK_VALVE_descriptor_set_host_mapping",
+      "VK_EXT_external_memory_host",
+      "VK_KHR_external_fence_fd",
+      "VK_KHR_video_decode_queue",
+      "VK_KHR_external_semaphore_fd",
+      "VK_EXT_opacity_micromap",
+      "VK_KHR_video_encode_queue",
+      "VK_EXT_metal_objects",
+      "VK_KHR_timeline_semaphore",
+      "VK_EXT_extended_dynamic_state",
+      "VK_KHR_deferred_host_operations",
+      "VK_EXT_transform_feedback",
+      "VK_EXT_host_query_reset",
+      "VK_KHR_sampler_ycbcr_conversion",
+      "VK_EXT_multi_draw",
+      "VK_NV_optical_flow",
+      "VK_EXT_calibrated_timestamps",
+    };
+
+    constexpr DeviceExtension LookupDeviceExtension(const char* name) {
+      return Lookup<DeviceExtension>(DeviceExtensionSeeds, DeviceExtensionNames, name);
+    }
+  }
+
+  class alignas(VKROOTS_CACHE_LINE_SIZE) VkInstanceDispatch {
+  public:
+    VkInstanceDispatch(PFN_vkGetInstanceProcAddr NextGetInstanceProcAddr, VkInstance instance) {
+      this->Instance = instance;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      CreateAndroidSurfaceKHR = (PFN_vkCreateAndroidSurfaceKHR) NextGetInstanceProcAddr(instance, "vkCreateAndroidSurfaceKHR");
+#endif
+      CreateDebugReportCallbackEXT = (PFN_vkCreateDebugReportCallbackEXT) NextGetInstanceProcAddr(instance, "vkCreateDebugReportCallbackEXT");
+      CreateDebugUtilsMessengerEXT = (PFN_vkCreateDebugUtilsMessengerEXT) NextGetInstanceProcAddr(instance, "vkCreateDebugUtilsMessengerEXT");
+      CreateDevice = (PFN_vkCreateDevice) NextGetInstanceProcAddr(instance, "vkCreateDevice");
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      CreateDirectFBSurfaceEXT = (PFN_vkCreateDirectFBSurfaceEXT) NextGetInstanceProcAddr(instance, "vkCreateDirectFBSurfaceEXT");
+#endif
+      CreateDisplayModeKHR = (PFN_vkCreateDisplayModeKHR) NextGetInstanceProcAddr(instance, "vkCreateDisplayModeKHR");
+      CreateDisplayPlaneSurfaceKHR = (PFN_vkCreateDisplayPlaneSurfaceKHR) NextGetInstanceProcAddr(instance, "vkCreateDisplayPlaneSurfaceKHR");
+      CreateHeadlessSurfaceEXT = (PFN_vkCreateHeadlessSurfaceEXT) NextGetInstanceProcAddr(instance, "vkCreateHeadlessSurfaceEXT");
+#ifdef VK_USE_PLATFORM_IOS_MVK
+      CreateIOSSurfaceMVK = (PFN_vkCreateIOSSurfaceMVK) NextGetInstanceProcAddr(instance, "vkCreateIOSSurfaceMVK");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      CreateImagePipeSurfaceFUCHSIA = (PFN_vkCreateImagePipeSurfaceFUCHSIA) NextGetInstanceProcAddr(instance, "vkCreateImagePipeSurfaceFUCHSIA");
+#endif
+      CreateInstance = (PFN_vkCreateInstance) NextGetInstanceProcAddr(instance, "vkCreateInstance");
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+      CreateMacOSSurfaceMVK = (PFN_vkCreateMacOSSurfaceMVK) NextGetInstanceProcAddr(instance, "vkCreateMacOSSurfaceMVK");
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      CreateMetalSurfaceEXT = (PFN_vkCreateMetalSurfaceEXT) NextGetInstanceProcAddr(instance, "vkCreateMetalSurfaceEXT");
+#endif
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      CreateScreenSurfaceQNX = (PFN_vkCreateScreenSurfaceQNX) NextGetInstanceProcAddr(instance, "vkCreateScreenSurfaceQNX");
+#endif
+#ifdef VK_USE_PLATFORM_GGP
+      CreateStreamDescriptorSurfaceGGP = (PFN_vkCreateStreamDescriptorSurfaceGGP) NextGetInstanceProcAddr(instance, "vkCreateStreamDescriptorSurfaceGGP");
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+      CreateViSurfaceNN = (PFN_vkCreateViSurfaceNN) NextGetInstanceProcAddr(instance, "vkCreateViSurfaceNN");
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      CreateWaylandSurfaceKHR = (PFN_vkCreateWaylandSurfaceKHR) NextGetInstanceProcAddr(instance, "vkCreateWaylandSurfaceKHR");
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      CreateWin32SurfaceKHR = (PFN_vkCreateWin32SurfaceKHR) NextGetInstanceProcAddr(instance, "vkCreateWin32SurfaceKHR");
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      CreateXcbSurfaceKHR = (PFN_vkCreateXcbSurfaceKHR) NextGetInstanceProcAddr(instance, "vkCreateXcbSurfaceKHR");
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      CreateXlibSurfaceKHR = (PFN_vkCreateXlibSurfaceKHR) NextGetInstanceProcAddr(instance, "vkCreateXlibSurfaceKHR");
+#endif
+      DebugReportMessageEXT = (PFN_vkDebugReportMessageEXT) NextGetInstanceProcAddr(instance, "vkDebugReportMessageEXT");
+      DestroyDebugReportCallbackEXT = (PFN_vkDestroyDebugReportCallbackEXT) NextGetInstanceProcAddr(instance, "vkDestroyDebugReportCallbackEXT");
+      DestroyDebugUtilsMessengerEXT = (PFN_vkDestroyDebugUtilsMessengerEXT) NextGetInstanceProcAddr(instance, "vkDestroyDebugUtilsMessengerEXT");
+      DestroyInstanceReal = (PFN_vkDestroyInstance) NextGetInstanceProcAddr(instance, "vkDestroyInstance");
+      DestroyInstance = (PFN_vkDestroyInstance) DestroyInstanceWrapper;
+      DestroySurfaceKHR = (PFN_vkDestroySurfaceKHR) NextGetInstanceProcAddr(instance, "vkDestroySurfaceKHR");
+      EnumerateDeviceExtensionProperties = (PFN_vkEnumerateDeviceExtensionProperties) NextGetInstanceProcAddr(instance, "vkEnumerateDeviceExtensionProperties");
+      EnumerateDeviceLayerProperties = (PFN_vkEnumerateDeviceLayerProperties) NextGetInstanceProcAddr(instance, "vkEnumerateDeviceLayerProperties");
+      EnumeratePhysicalDeviceGroups = (PFN_vkEnumeratePhysicalDeviceGroups) NextGetInstanceProcAddr(instance, "vkEnumeratePhysicalDeviceGroups");
+      EnumeratePhysicalDeviceGroupsKHR = (PFN_vkEnumeratePhysicalDeviceGroupsKHR) NextGetInstanceProcAddr(instance, "vkEnumeratePhysicalDeviceGroupsKHR");
+      EnumeratePhysicalDevices = (PFN_vkEnumeratePhysicalDevices) NextGetInstanceProcAddr(instance, "vkEnumeratePhysicalDevices");
+      GetDisplayModePropertiesKHR = (PFN_vkGetDisplayModePropertiesKHR) NextGetInstanceProcAddr(instance, "vkGetDisplayModePropertiesKHR");
+      GetDisplayPlaneCapabilitiesKHR = (PFN_vkGetDisplayPlaneCapabilitiesKHR) NextGetInstanceProcAddr(instance, "vkGetDisplayPlaneCapabilitiesKHR");
+      GetDisplayPlaneSupportedDisplaysKHR = (PFN_vkGetDisplayPlaneSupportedDisplaysKHR) NextGetInstanceProcAddr(instance, "vkGetDisplayPlaneSupportedDisplaysKHR");
+      GetInstanceProcAddr = NextGetInstanceProcAddr;
+      GetPhysicalDeviceDisplayPlanePropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+      GetPhysicalDeviceDisplayPropertiesKHR = (PFN_vkGetPhysicalDeviceDisplayPropertiesKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+      GetPhysicalDeviceExternalBufferProperties = (PFN_vkGetPhysicalDeviceExternalBufferProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceExternalBufferProperties");
+      GetPhysicalDeviceExternalFenceProperties = (PFN_vkGetPhysicalDeviceExternalFenceProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceExternalFenceProperties");
+      GetPhysicalDeviceExternalSemaphoreProperties = (PFN_vkGetPhysicalDeviceExternalSemaphoreProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceExternalSemaphoreProperties");
+      GetPhysicalDeviceFeatures = (PFN_vkGetPhysicalDeviceFeatures) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures");
+      GetPhysicalDeviceFeatures2 = (PFN_vkGetPhysicalDeviceFeatures2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFeatures2");
+      GetPhysicalDeviceFormatProperties = (PFN_vkGetPhysicalDeviceFormatProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties");
+      GetPhysicalDeviceFormatProperties2 = (PFN_vkGetPhysicalDeviceFormatProperties2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties2");
+      GetPhysicalDeviceImageFormatProperties = (PFN_vkGetPhysicalDeviceImageFormatProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties");
+      GetPhysicalDeviceImageFormatProperties2 = (PFN_vkGetPhysicalDeviceImageFormatProperties2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties2");
+      GetPhysicalDeviceMemoryProperties = (PFN_vkGetPhysicalDeviceMemoryProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties");
+      GetPhysicalDeviceMemoryProperties2 = (PFN_vkGetPhysicalDeviceMemoryProperties2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties2");
+      GetPhysicalDevicePresentRectanglesKHR = (PFN_vkGetPhysicalDevicePresentRectanglesKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDevicePresentRectanglesKHR");
+      GetPhysicalDeviceProperties = (PFN_vkGetPhysicalDeviceProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties");
+      GetPhysicalDeviceProperties2 = (PFN_vkGetPhysicalDeviceProperties2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceProperties2");
+      GetPhysicalDeviceQueueFamilyProperties = (PFN_vkGetPhysicalDeviceQueueFamilyProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties");
+      GetPhysicalDeviceQueueFamilyProperties2 = (PFN_vkGetPhysicalDeviceQueueFamilyProperties2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties2");
+      GetPhysicalDeviceSparseImageFormatProperties = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties");
+      GetPhysicalDeviceSparseImageFormatProperties2 = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties2) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties2");
+      GetPhysicalDeviceSurfaceCapabilities2KHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+      GetPhysicalDeviceSurfaceCapabilitiesKHR = (PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+      GetPhysicalDeviceSurfaceFormats2KHR = (PFN_vkGetPhysicalDeviceSurfaceFormats2KHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormats2KHR");
+      GetPhysicalDeviceSurfaceFormatsKHR = (PFN_vkGetPhysicalDeviceSurfaceFormatsKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+      GetPhysicalDeviceSurfacePresentModesKHR = (PFN_vkGetPhysicalDeviceSurfacePresentModesKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+      GetPhysicalDeviceSurfaceSupportKHR = (PFN_vkGetPhysicalDeviceSurfaceSupportKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceSurfaceSupportKHR");
+      GetPhysicalDeviceToolProperties = (PFN_vkGetPhysicalDeviceToolProperties) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceToolProperties");
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      GetPhysicalDeviceWaylandPresentationSupportKHR = (PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetPhysicalDeviceWin32PresentationSupportKHR = (PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      GetPhysicalDeviceXcbPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      GetPhysicalDeviceXlibPresentationSupportKHR = (PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR) NextGetInstanceProcAddr(instance, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+#endif
+      SubmitDebugUtilsMessageEXT = (PFN_vkSubmitDebugUtilsMessageEXT) NextGetInstanceProcAddr(instance, "vkSubmitDebugUtilsMessageEXT");
+    }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    PFN_vkCreateAndroidSurfaceKHR CreateAndroidSurfaceKHR;
+#endif
+    PFN_vkCreateDebugReportCallbackEXT CreateDebugReportCallbackEXT;
+    PFN_vkCreateDebugUtilsMessengerEXT CreateDebugUtilsMessengerEXT;
+    PFN_vkCreateDevice CreateDevice;
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    PFN_vkCreateDirectFBSurfaceEXT CreateDirectFBSurfaceEXT;
+#endif
+    PFN_vkCreateDisplayModeKHR CreateDisplayModeKHR;
+    PFN_vkCreateDisplayPlaneSurfaceKHR CreateDisplayPlaneSurfaceKHR;
+    PFN_vkCreateHeadlessSurfaceEXT CreateHeadlessSurfaceEXT;
+    PFN_vkCreateInstance CreateInstance;
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    PFN_vkCreateMetalSurfaceEXT CreateMetalSurfaceEXT;
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    PFN_vkCreateWaylandSurfaceKHR CreateWaylandSurfaceKHR;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkCreateWin32SurfaceKHR CreateWin32SurfaceKHR;
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    PFN_vkCreateXcbSurfaceKHR CreateXcbSurfaceKHR;
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    PFN_vkCreateXlibSurfaceKHR CreateXlibSurfaceKHR;
+#endif
+    PFN_vkDebugReportMessageEXT DebugReportMessageEXT;
+    PFN_vkDestroyDebugReportCallbackEXT DestroyDebugReportCallbackEXT;
+    PFN_vkDestroyDebugUtilsMessengerEXT DestroyDebugUtilsMessengerEXT;
+    PFN_vkDestroyInstance DestroyInstance;
+    PFN_vkDestroySurfaceKHR DestroySurfaceKHR;
+    PFN_vkEnumerateDeviceExtensionProperties EnumerateDeviceExtensionProperties;
+    PFN_vkEnumerateDeviceLayerProperties EnumerateDeviceLayerProperties;
+    PFN_vkEnumeratePhysicalDeviceGroups EnumeratePhysicalDeviceGroups;
+    PFN_vkEnumeratePhysicalDeviceGroupsKHR EnumeratePhysicalDeviceGroupsKHR;
+    PFN_vkEnumeratePhysicalDevices EnumeratePhysicalDevices;
+    PFN_vkGetDisplayModePropertiesKHR GetDisplayModePropertiesKHR;
+    PFN_vkGetDisplayPlaneCapabilitiesKHR GetDisplayPlaneCapabilitiesKHR;
+    PFN_vkGetDisplayPlaneSupportedDisplaysKHR GetDisplayPlaneSupportedDisplaysKHR;
+    PFN_vkGetInstanceProcAddr GetInstanceProcAddr;
+    PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR GetPhysicalDeviceDisplayPlanePropertiesKHR;
+    PFN_vkGetPhysicalDeviceDisplayPropertiesKHR GetPhysicalDeviceDisplayPropertiesKHR;
+    PFN_vkGetPhysicalDeviceExternalBufferProperties GetPhysicalDeviceExternalBufferProperties;
+    PFN_vkGetPhysicalDeviceExternalFenceProperties GetPhysicalDeviceExternalFenceProperties;
+    PFN_vkGetPhysicalDeviceExternalSemaphoreProperties GetPhysicalDeviceExternalSemaphoreProperties;
+    PFN_vkGetPhysicalDeviceFeatures GetPhysicalDeviceFeatures;
+    PFN_vkGetPhysicalDeviceFeatures2 GetPhysicalDeviceFeatures2;
+    PFN_vkGetPhysicalDeviceFormatProperties GetPhysicalDeviceFormatProperties;
+    PFN_vkGetPhysicalDeviceFormatProperties2 GetPhysicalDeviceFormatProperties2;
+    PFN_vkGetPhysicalDeviceImageFormatProperties GetPhysicalDeviceImageFormatProperties;
+    PFN_vkGetPhysicalDeviceImageFormatProperties2 GetPhysicalDeviceImageFormatProperties2;
+    PFN_vkGetPhysicalDeviceMemoryProperties GetPhysicalDeviceMemoryProperties;
+    PFN_vkGetPhysicalDeviceMemoryProperties2 GetPhysicalDeviceMemoryProperties2;
+    PFN_vkGetPhysicalDevicePresentRectanglesKHR GetPhysicalDevicePresentRectanglesKHR;
+    PFN_vkGetPhysicalDeviceProperties GetPhysicalDeviceProperties;
+    PFN_vkGetPhysicalDeviceProperties2 GetPhysicalDeviceProperties2;
+    PFN_vkGetPhysicalDeviceQueueFamilyProperties GetPhysicalDeviceQueueFamilyProperties;
+    PFN_vkGetPhysicalDeviceQueueFamilyProperties2 GetPhysicalDeviceQueueFamilyProperties2;
+    PFN_vkGetPhysicalDeviceSparseImageFormatProperties GetPhysicalDeviceSparseImageFormatProperties;
+    PFN_vkGetPhysicalDeviceSparseImageFormatProperties2 GetPhysicalDeviceSparseImageFormatProperties2;
+    PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR GetPhysicalDeviceSurfaceCapabilities2KHR;
+    PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR GetPhysicalDeviceSurfaceCapabilitiesKHR;
+    PFN_vkGetPhysicalDeviceSurfaceFormats2KHR GetPhysicalDeviceSurfaceFormats2KHR;
+    PFN_vkGetPhysicalDeviceSurfaceFormatsKHR GetPhysicalDeviceSurfaceFormatsKHR;
+    PFN_vkGetPhysicalDeviceSurfacePresentModesKHR GetPhysicalDeviceSurfacePresentModesKHR;
+    PFN_vkGetPhysicalDeviceSurfaceSupportKHR GetPhysicalDeviceSurfaceSupportKHR;
+    PFN_vkGetPhysicalDeviceToolProperties GetPhysicalDeviceToolProperties;
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+    PFN_vkGetPhysicalDeviceWaylandPresentationSupportKHR GetPhysicalDeviceWaylandPresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetPhysicalDeviceWin32PresentationSupportKHR GetPhysicalDeviceWin32PresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+    PFN_vkGetPhysicalDeviceXcbPresentationSupportKHR GetPhysicalDeviceXcbPresentationSupportKHR;
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+    PFN_vkGetPhysicalDeviceXlibPresentationSupportKHR GetPhysicalDeviceXlibPresentationSupportKHR;
+#endif
+    PFN_vkSubmitDebugUtilsMessageEXT SubmitDebugUtilsMessageEXT;
+#ifdef VK_USE_PLATFORM_IOS_MVK
+    PFN_vkCreateIOSSurfaceMVK CreateIOSSurfaceMVK;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkCreateImagePipeSurfaceFUCHSIA CreateImagePipeSurfaceFUCHSIA;
+#endif
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+    PFN_vkCreateMacOSSurfaceMVK CreateMacOSSurfaceMVK;
+#endif
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    PFN_vkCreateScreenSurfaceQNX CreateScreenSurfaceQNX;
+#endif
+#ifdef VK_USE_PLATFORM_GGP
+    PFN_vkCreateStreamDescriptorSurfaceGGP CreateStreamDescriptorSurfaceGGP;
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+    PFN_vkCreateViSurfaceNN CreateViSurfaceNN;
+#endif
+    mutable uint64_t UserData = 0;
+#if VKROOTS_USE_CREATE_TIMINGS
+    mutable tables::VkCreateTimings CreateTimings;
+#endif
+    VkInstance Instance;
+  private:
+    PFN_vkDestroyInstance DestroyInstanceReal;
+    static void DestroyInstanceWrapper(VkInstance object, const VkAllocationCallbacks* pAllocator) {
+      auto dispatch = vkroots::tables::LookupInstanceDispatch(object);
+      auto destroyFunc = dispatch->DestroyInstanceReal;
+      vkroots::tables::DestroyDispatchTable(object);
+      destroyFunc(object, pAllocator);
+    }
+  };
+
+  class alignas(VKROOTS_CACHE_LINE_SIZE) VkPhysicalDeviceDispatch {
+  public:
+    VkPhysicalDeviceDispatch(PFN_vkGetPhysicalDeviceProcAddr NextGetPhysicalDeviceProcAddr, VkInstance instance, const VkInstanceDispatch* pInstanceDispatch) {
+      this->Instance = instance;
+      this->pInstanceDispatch = pInstanceDispatch;
+      this->GetPhysicalDeviceProcAddr = NextGetPhysicalDeviceProcAddr;
+      AcquireDrmDisplayEXT = (PFN_vkAcquireDrmDisplayEXT) NextGetPhysicalDeviceProcAddr(instance, "vkAcquireDrmDisplayEXT");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      AcquireWinrtDisplayNV = (PFN_vkAcquireWinrtDisplayNV) NextGetPhysicalDeviceProcAddr(instance, "vkAcquireWinrtDisplayNV");
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+      AcquireXlibDisplayEXT = (PFN_vkAcquireXlibDisplayEXT) NextGetPhysicalDeviceProcAddr(instance, "vkAcquireXlibDisplayEXT");
+#endif
+      EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = (PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR) NextGetPhysicalDeviceProcAddr(instance, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+      GetDisplayModeProperties2KHR = (PFN_vkGetDisplayModeProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetDisplayModeProperties2KHR");
+      GetDisplayPlaneCapabilities2KHR = (PFN_vkGetDisplayPlaneCapabilities2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetDisplayPlaneCapabilities2KHR");
+      GetDrmDisplayEXT = (PFN_vkGetDrmDisplayEXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetDrmDisplayEXT");
+      GetPhysicalDeviceCalibrateableTimeDomainsEXT = (PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+      GetPhysicalDeviceCooperativeMatrixPropertiesNV = (PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      GetPhysicalDeviceDirectFBPresentationSupportEXT = (PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+#endif
+      GetPhysicalDeviceDisplayPlaneProperties2KHR = (PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+      GetPhysicalDeviceDisplayProperties2KHR = (PFN_vkGetPhysicalDeviceDisplayProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceDisplayProperties2KHR");
+      GetPhysicalDeviceExternalBufferPropertiesKHR = (PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+      GetPhysicalDeviceExternalFencePropertiesKHR = (PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
+      GetPhysicalDeviceExternalImageFormatPropertiesNV = (PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+      GetPhysicalDeviceExternalSemaphorePropertiesKHR = (PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+      GetPhysicalDeviceFeatures2KHR = (PFN_vkGetPhysicalDeviceFeatures2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceFeatures2KHR");
+      GetPhysicalDeviceFormatProperties2KHR = (PFN_vkGetPhysicalDeviceFormatProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceFormatProperties2KHR");
+      GetPhysicalDeviceFragmentShadingRatesKHR = (PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
+      GetPhysicalDeviceImageFormatProperties2KHR = (PFN_vkGetPhysicalDeviceImageFormatProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceImageFormatProperties2KHR");
+      GetPhysicalDeviceMemoryProperties2KHR = (PFN_vkGetPhysicalDeviceMemoryProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceMemoryProperties2KHR");
+      GetPhysicalDeviceMultisamplePropertiesEXT = (PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+      GetPhysicalDeviceOpticalFlowImageFormatsNV = (PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
+      GetPhysicalDeviceProperties2KHR = (PFN_vkGetPhysicalDeviceProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceProperties2KHR");
+      GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = (PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+      GetPhysicalDeviceQueueFamilyProperties2KHR = (PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      GetPhysicalDeviceScreenPresentationSupportQNX = (PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
+#endif
+      GetPhysicalDeviceSparseImageFormatProperties2KHR = (PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+      GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = (PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+      GetPhysicalDeviceSurfaceCapabilities2EXT = (PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetPhysicalDeviceSurfacePresentModes2EXT = (PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+#endif
+      GetPhysicalDeviceToolPropertiesEXT = (PFN_vkGetPhysicalDeviceToolPropertiesEXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceToolPropertiesEXT");
+      GetPhysicalDeviceVideoCapabilitiesKHR = (PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR = (PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
+#endif
+      GetPhysicalDeviceVideoFormatPropertiesKHR = (PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR) NextGetPhysicalDeviceProcAddr(instance, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+      GetRandROutputDisplayEXT = (PFN_vkGetRandROutputDisplayEXT) NextGetPhysicalDeviceProcAddr(instance, "vkGetRandROutputDisplayEXT");
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetWinrtDisplayNV = (PFN_vkGetWinrtDisplayNV) NextGetPhysicalDeviceProcAddr(instance, "vkGetWinrtDisplayNV");
+#endif
+      ReleaseDisplayEXT = (PFN_vkReleaseDisplayEXT) NextGetPhysicalDeviceProcAddr(instance, "vkReleaseDisplayEXT");
+    }
+
+    PFN_vkAcquireDrmDisplayEXT AcquireDrmDisplayEXT;
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    PFN_vkAcquireXlibDisplayEXT AcquireXlibDisplayEXT;
+#endif
+    PFN_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+    PFN_vkGetDisplayModeProperties2KHR GetDisplayModeProperties2KHR;
+    PFN_vkGetDisplayPlaneCapabilities2KHR GetDisplayPlaneCapabilities2KHR;
+    PFN_vkGetDrmDisplayEXT GetDrmDisplayEXT;
+    PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT GetPhysicalDeviceCalibrateableTimeDomainsEXT;
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+    PFN_vkGetPhysicalDeviceDirectFBPresentationSupportEXT GetPhysicalDeviceDirectFBPresentationSupportEXT;
+#endif
+    PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR GetPhysicalDeviceDisplayPlaneProperties2KHR;
+    PFN_vkGetPhysicalDeviceDisplayProperties2KHR GetPhysicalDeviceDisplayProperties2KHR;
+    PFN_vkGetPhysicalDeviceExternalBufferPropertiesKHR GetPhysicalDeviceExternalBufferPropertiesKHR;
+    PFN_vkGetPhysicalDeviceExternalFencePropertiesKHR GetPhysicalDeviceExternalFencePropertiesKHR;
+    PFN_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR GetPhysicalDeviceExternalSemaphorePropertiesKHR;
+    PFN_vkGetPhysicalDeviceFeatures2KHR GetPhysicalDeviceFeatures2KHR;
+    PFN_vkGetPhysicalDeviceFormatProperties2KHR GetPhysicalDeviceFormatProperties2KHR;
+    PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR GetPhysicalDeviceFragmentShadingRatesKHR;
+    PFN_vkGetPhysicalDeviceImageFormatProperties2KHR GetPhysicalDeviceImageFormatProperties2KHR;
+    PFN_vkGetPhysicalDeviceMemoryProperties2KHR GetPhysicalDeviceMemoryProperties2KHR;
+    PFN_vkGetPhysicalDeviceMultisamplePropertiesEXT GetPhysicalDeviceMultisamplePropertiesEXT;
+    PFN_vkGetPhysicalDeviceProperties2KHR GetPhysicalDeviceProperties2KHR;
+    PFN_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+    PFN_vkGetPhysicalDeviceQueueFamilyProperties2KHR GetPhysicalDeviceQueueFamilyProperties2KHR;
+    PFN_vkGetPhysicalDeviceSparseImageFormatProperties2KHR GetPhysicalDeviceSparseImageFormatProperties2KHR;
+    PFN_vkGetPhysicalDeviceSurfaceCapabilities2EXT GetPhysicalDeviceSurfaceCapabilities2EXT;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetPhysicalDeviceSurfacePresentModes2EXT GetPhysicalDeviceSurfacePresentModes2EXT;
+#endif
+    PFN_vkGetPhysicalDeviceToolPropertiesEXT GetPhysicalDeviceToolPropertiesEXT;
+    PFN_vkGetPhysicalDeviceVideoCapabilitiesKHR GetPhysicalDeviceVideoCapabilitiesKHR;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    PFN_vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR;
+#endif
+    PFN_vkGetPhysicalDeviceVideoFormatPropertiesKHR GetPhysicalDeviceVideoFormatPropertiesKHR;
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+    PFN_vkGetRandROutputDisplayEXT GetRandROutputDisplayEXT;
+#endif
+    PFN_vkReleaseDisplayEXT ReleaseDisplayEXT;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkAcquireWinrtDisplayNV AcquireWinrtDisplayNV;
+#endif
+    PFN_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV GetPhysicalDeviceCooperativeMatrixPropertiesNV;
+    PFN_vkGetPhysicalDeviceExternalImageFormatPropertiesNV GetPhysicalDeviceExternalImageFormatPropertiesNV;
+    PFN_vkGetPhysicalDeviceOpticalFlowImageFormatsNV GetPhysicalDeviceOpticalFlowImageFormatsNV;
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+    PFN_vkGetPhysicalDeviceScreenPresentationSupportQNX GetPhysicalDeviceScreenPresentationSupportQNX;
+#endif
+    PFN_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetWinrtDisplayNV GetWinrtDisplayNV;
+#endif
+    mutable uint64_t UserData = 0;
+    VkInstance Instance;
+    const VkInstanceDispatch* pInstanceDispatch;
+    PFN_GetPhysicalDeviceProcAddr GetPhysicalDeviceProcAddr;
+  private:
+  };
+
+  namespace tables {
+    inline const VkInstanceDispatch* LookupInstanceDispatch(VkPhysicalDevice physicalDevice) { return LookupPhysicalDeviceDispatch(physicalDevice)->pInstanceDispatch; }
+  }
+#if VKROOTS_USE_LAZY_DISPATCH
+  namespace tables {
+    struct VkLazyDeviceFuncs {
+      VkLazyFunc<PFN_vkAcquireNextImage2KHR, procaddr::DeviceFunc::AcquireNextImage2KHR, VkLazyDeviceFuncs> AcquireNextImage2KHR;
+      VkLazyFunc<PFN_vkAcquireNextImageKHR, procaddr::DeviceFunc::AcquireNextImageKHR, VkLazyDeviceFuncs> AcquireNextImageKHR;
+      VkLazyFunc<PFN_vkAllocateDescriptorSets, procaddr::DeviceFunc::AllocateDescriptorSets, VkLazyDeviceFuncs> AllocateDescriptorSets;
+      VkLazyFunc<PFN_vkBeginCommandBuffer, procaddr::DeviceFunc::BeginCommandBuffer, VkLazyDeviceFuncs> BeginCommandBuffer;
+      VkLazyFunc<PFN_vkCmdBeginQuery, procaddr::DeviceFunc::CmdBeginQuery, VkLazyDeviceFuncs> CmdBeginQuery;
+      VkLazyFunc<PFN_vkCmdBeginRenderPass, procaddr::DeviceFunc::CmdBeginRenderPass, VkLazyDeviceFuncs> CmdBeginRenderPass;
+      VkLazyFunc<PFN_vkCmdBeginRenderPass2, procaddr::DeviceFunc::CmdBeginRenderPass2, VkLazyDeviceFuncs> CmdBeginRenderPass2;
+      VkLazyFunc<PFN_vkCmdBeginRendering, procaddr::DeviceFunc::CmdBeginRendering, VkLazyDeviceFuncs> CmdBeginRendering;
+      VkLazyFunc<PFN_vkCmdBeginRenderingKHR, procaddr::DeviceFunc::CmdBeginRenderingKHR, VkLazyDeviceFuncs> CmdBeginRenderingKHR;
+      VkLazyFunc<PFN_vkCmdBindDescriptorSets, procaddr::DeviceFunc::CmdBindDescriptorSets, VkLazyDeviceFuncs> CmdBindDescriptorSets;
+      VkLazyFunc<PFN_vkCmdBindIndexBuffer, procaddr::DeviceFunc::CmdBindIndexBuffer, VkLazyDeviceFuncs> CmdBindIndexBuffer;
+      VkLazyFunc<PFN_vkCmdBindPipeline, procaddr::DeviceFunc::CmdBindPipeline, VkLazyDeviceFuncs> CmdBindPipeline;
+      VkLazyFunc<PFN_vkCmdBindVertexBuffers, procaddr::DeviceFunc::CmdBindVertexBuffers, VkLazyDeviceFuncs> CmdBindVertexBuffers;
+      VkLazyFunc<PFN_vkCmdBlitImage, procaddr::DeviceFunc::CmdBlitImage, VkLazyDeviceFuncs> CmdBlitImage;
+      VkLazyFunc<PFN_vkCmdClearAttachments, procaddr::DeviceFunc::CmdClearAttachments, VkLazyDeviceFuncs> CmdClearAttachments;
+      VkLazyFunc<PFN_vkCmdClearColorImage, procaddr::DeviceFunc::CmdClearColorImage, VkLazyDeviceFuncs> CmdClearColorImage;
+      VkLazyFunc<PFN_vkCmdCopyBuffer, procaddr::DeviceFunc::CmdCopyBuffer, VkLazyDeviceFuncs> CmdCopyBuffer;
+      VkLazyFunc<PFN_vkCmdCopyBufferToImage, procaddr::DeviceFunc::CmdCopyBufferToImage, VkLazyDeviceFuncs> CmdCopyBufferToImage;
+      VkLazyFunc<PFN_vkCmdCopyImage, procaddr::DeviceFunc::CmdCopyImage, VkLazyDeviceFuncs> CmdCopyImage;
+      VkLazyFunc<PFN_vkCmdDispatch, procaddr::DeviceFunc::CmdDispatch, VkLazyDeviceFuncs> CmdDispatch;
+      VkLazyFunc<PFN_vkCmdDispatchIndirect, procaddr::DeviceFunc::CmdDispatchIndirect, VkLazyDeviceFuncs> CmdDispatchIndirect;
+      VkLazyFunc<PFN_vkCmdDraw, procaddr::DeviceFunc::CmdDraw, VkLazyDeviceFuncs> CmdDraw;
+      VkLazyFunc<PFN_vkCmdDrawIndexed, procaddr::DeviceFunc::CmdDrawIndexed, VkLazyDeviceFuncs> CmdDrawIndexed;
+      VkLazyFunc<PFN_vkCmdDrawIndexedIndirect, procaddr::DeviceFunc::CmdDrawIndexedIndirect, VkLazyDeviceFuncs> CmdDrawIndexedIndirect;
+      VkLazyFunc<PFN_vkCmdDrawIndexedIndirectCount, procaddr::DeviceFunc::CmdDrawIndexedIndirectCount, VkLazyDeviceFuncs> CmdDrawIndexedIndirectCount;
+      VkLazyFunc<PFN_vkCmdDrawIndirect, procaddr::DeviceFunc::CmdDrawIndirect, VkLazyDeviceFuncs> CmdDrawIndirect;
+      VkLazyFunc<PFN_vkCmdDrawIndirectCount, procaddr::DeviceFunc::CmdDrawIndirectCount, VkLazyDeviceFuncs> CmdDrawIndirectCount;
+      VkLazyFunc<PFN_vkCmdEndQuery, procaddr::DeviceFunc::CmdEndQuery, VkLazyDeviceFuncs> CmdEndQuery;
+      VkLazyFunc<PFN_vkCmdEndRenderPass, procaddr::DeviceFunc::CmdEndRenderPass, VkLazyDeviceFuncs> CmdEndRenderPass;
+      VkLazyFunc<PFN_vkCmdEndRenderPass2, procaddr::DeviceFunc::CmdEndRenderPass2, VkLazyDeviceFuncs> CmdEndRenderPass2;
+      VkLazyFunc<PFN_vkCmdEndRendering, procaddr::DeviceFunc::CmdEndRendering, VkLazyDeviceFuncs> CmdEndRendering;
+      VkLazyFunc<PFN_vkCmdEndRenderingKHR, procaddr::DeviceFunc::CmdEndRenderingKHR, VkLazyDeviceFuncs> CmdEndRenderingKHR;
+      VkLazyFunc<PFN_vkCmdExecuteCommands, procaddr::DeviceFunc::CmdExecuteCommands, VkLazyDeviceFuncs> CmdExecuteCommands;
+      VkLazyFunc<PFN_vkCmdNextSubpass, procaddr::DeviceFunc::CmdNextSubpass, VkLazyDeviceFuncs> CmdNextSubpass;
+      VkLazyFunc<PFN_vkCmdPipelineBarrier, procaddr::DeviceFunc::CmdPipelineBarrier, VkLazyDeviceFuncs> CmdPipelineBarrier;
+      VkLazyFunc<PFN_vkCmdPipelineBarrier2, procaddr::DeviceFunc::CmdPipelineBarrier2, VkLazyDeviceFuncs> CmdPipelineBarrier2;
+      VkLazyFunc<PFN_vkCmdPipelineBarrier2KHR, procaddr::DeviceFunc::CmdPipelineBarrier2KHR, VkLazyDeviceFuncs> CmdPipelineBarrier2KHR;
+      VkLazyFunc<PFN_vkCmdPushConstants, procaddr::DeviceFunc::CmdPushConstants, VkLazyDeviceFuncs> CmdPushConstants;
+      VkLazyFunc<PFN_vkCmdPushDescriptorSetKHR, procaddr::DeviceFunc::CmdPushDescriptorSetKHR, VkLazyDeviceFuncs> CmdPushDescriptorSetKHR;
+      VkLazyFunc<PFN_vkCmdResetQueryPool, procaddr::DeviceFunc::CmdResetQueryPool, VkLazyDeviceFuncs> CmdResetQueryPool;
+      VkLazyFunc<PFN_vkCmdSetEvent, procaddr::DeviceFunc::CmdSetEvent, VkLazyDeviceFuncs> CmdSetEvent;
+      VkLazyFunc<PFN_vkCmdSetScissor, procaddr::DeviceFunc::CmdSetScissor, VkLazyDeviceFuncs> CmdSetScissor;
+      VkLazyFunc<PFN_vkCmdSetViewport, procaddr::DeviceFunc::CmdSetViewport, VkLazyDeviceFuncs> CmdSetViewport;
+      VkLazyFunc<PFN_vkCmdWaitEvents, procaddr::DeviceFunc::CmdWaitEvents, VkLazyDeviceFuncs> CmdWaitEvents;
+      VkLazyFunc<PFN_vkCmdWriteTimestamp, procaddr::DeviceFunc::CmdWriteTimestamp, VkLazyDeviceFuncs> CmdWriteTimestamp;
+      VkLazyFunc<PFN_vkEndCommandBuffer, procaddr::DeviceFunc::EndCommandBuffer, VkLazyDeviceFuncs> EndCommandBuffer;
+      VkLazyFunc<PFN_vkGetFenceStatus, procaddr::DeviceFunc::GetFenceStatus, VkLazyDeviceFuncs> GetFenceStatus;
+      VkLazyFunc<PFN_vkGetSemaphoreCounterValue, procaddr::DeviceFunc::GetSemaphoreCounterValue, VkLazyDeviceFuncs> GetSemaphoreCounterValue;
+      VkLazyFunc<PFN_vkGetSemaphoreCounterValueKHR, procaddr::DeviceFunc::GetSemaphoreCounterValueKHR, VkLazyDeviceFuncs> GetSemaphoreCounterValueKHR;
+      VkLazyFunc<PFN_vkQueuePresentKHR, procaddr::DeviceFunc::QueuePresentKHR, VkLazyDeviceFuncs> QueuePresentKHR;
+      VkLazyFunc<PFN_vkQueueSubmit, procaddr::DeviceFunc::QueueSubmit, VkLazyDeviceFuncs> QueueSubmit;
+      VkLazyFunc<PFN_vkQueueSubmit2, procaddr::DeviceFunc::QueueSubmit2, VkLazyDeviceFuncs> QueueSubmit2;
+      VkLazyFunc<PFN_vkQueueSubmit2KHR, procaddr::DeviceFunc::QueueSubmit2KHR, VkLazyDeviceFuncs> QueueSubmit2KHR;
+      VkLazyFunc<PFN_vkResetCommandBuffer, procaddr::DeviceFunc::ResetCommandBuffer, VkLazyDeviceFuncs> ResetCommandBuffer;
+      VkLazyFunc<PFN_vkResetCommandPool, procaddr::DeviceFunc::ResetCommandPool, VkLazyDeviceFuncs> ResetCommandPool;
+      VkLazyFunc<PFN_vkResetDescriptorPool, procaddr::DeviceFunc::ResetDescriptorPool, VkLazyDeviceFuncs> ResetDescriptorPool;
+      VkLazyFunc<PFN_vkResetFences, procaddr::DeviceFunc::ResetFences, VkLazyDeviceFuncs> ResetFences;
+      VkLazyFunc<PFN_vkSignalSemaphore, procaddr::DeviceFunc::SignalSemaphore, VkLazyDeviceFuncs> SignalSemaphore;
+      VkLazyFunc<PFN_vkUpdateDescriptorSets, procaddr::DeviceFunc::UpdateDescriptorSets, VkLazyDeviceFuncs> UpdateDescriptorSets;
+      VkLazyFunc<PFN_vkWaitForFences, procaddr::DeviceFunc::WaitForFences, VkLazyDeviceFuncs> WaitForFences;
+      VkLazyFunc<PFN_vkWaitSemaphores, procaddr::DeviceFunc::WaitSemaphores, VkLazyDeviceFuncs> WaitSemaphores;
+      VkLazyFunc<PFN_vkWaitSemaphoresKHR, procaddr::DeviceFunc::WaitSemaphoresKHR, VkLazyDeviceFuncs> WaitSemaphoresKHR;
+      VkLazyFunc<PFN_vkCmdBeginConditionalRenderingEXT, procaddr::DeviceFunc::CmdBeginConditionalRenderingEXT, VkLazyDeviceFuncs> CmdBeginConditionalRenderingEXT;
+      VkLazyFunc<PFN_vkCmdBeginDebugUtilsLabelEXT, procaddr::DeviceFunc::CmdBeginDebugUtilsLabelEXT, VkLazyDeviceFuncs> CmdBeginDebugUtilsLabelEXT;
+      VkLazyFunc<PFN_vkCmdBeginQueryIndexedEXT, procaddr::DeviceFunc::CmdBeginQueryIndexedEXT, VkLazyDeviceFuncs> CmdBeginQueryIndexedEXT;
+      VkLazyFunc<PFN_vkCmdBeginRenderPass2KHR, procaddr::DeviceFunc::CmdBeginRenderPass2KHR, VkLazyDeviceFuncs> CmdBeginRenderPass2KHR;
+      VkLazyFunc<PFN_vkCmdBeginTransformFeedbackEXT, procaddr::DeviceFunc::CmdBeginTransformFeedbackEXT, VkLazyDeviceFuncs> CmdBeginTransformFeedbackEXT;
+      VkLazyFunc<PFN_vkCmdBeginVideoCodingKHR, procaddr::DeviceFunc::CmdBeginVideoCodingKHR, VkLazyDeviceFuncs> CmdBeginVideoCodingKHR;
+      VkLazyFunc<PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT, procaddr::DeviceFunc::CmdBindDescriptorBufferEmbeddedSamplersEXT, VkLazyDeviceFuncs> CmdBindDescriptorBufferEmbeddedSamplersEXT;
+      VkLazyFunc<PFN_vkCmdBindDescriptorBuffersEXT, procaddr::DeviceFunc::CmdBindDescriptorBuffersEXT, VkLazyDeviceFuncs> CmdBindDescriptorBuffersEXT;
+      VkLazyFunc<PFN_vkCmdBindShadersEXT, procaddr::DeviceFunc::CmdBindShadersEXT, VkLazyDeviceFuncs> CmdBindShadersEXT;
+      VkLazyFunc<PFN_vkCmdBindTransformFeedbackBuffersEXT, procaddr::DeviceFunc::CmdBindTransformFeedbackBuffersEXT, VkLazyDeviceFuncs> CmdBindTransformFeedbackBuffersEXT;
+      VkLazyFunc<PFN_vkCmdBindVertexBuffers2, procaddr::DeviceFunc::CmdBindVertexBuffers2, VkLazyDeviceFuncs> CmdBindVertexBuffers2;
+      VkLazyFunc<PFN_vkCmdBindVertexBuffers2EXT, procaddr::DeviceFunc::CmdBindVertexBuffers2EXT, VkLazyDeviceFuncs> CmdBindVertexBuffers2EXT;
+      VkLazyFunc<PFN_vkCmdBlitImage2, procaddr::DeviceFunc::CmdBlitImage2, VkLazyDeviceFuncs> CmdBlitImage2;
+      VkLazyFunc<PFN_vkCmdBlitImage2KHR, procaddr::DeviceFunc::CmdBlitImage2KHR, VkLazyDeviceFuncs> CmdBlitImage2KHR;
+      VkLazyFunc<PFN_vkCmdBuildAccelerationStructuresIndirectKHR, procaddr::DeviceFunc::CmdBuildAccelerationStructuresIndirectKHR, VkLazyDeviceFuncs> CmdBuildAccelerationStructuresIndirectKHR;
+      VkLazyFunc<PFN_vkCmdBuildAccelerationStructuresKHR, procaddr::DeviceFunc::CmdBuildAccelerationStructuresKHR, VkLazyDeviceFuncs> CmdBuildAccelerationStructuresKHR;
+      VkLazyFunc<PFN_vkCmdBuildMicromapsEXT, procaddr::DeviceFunc::CmdBuildMicromapsEXT, VkLazyDeviceFuncs> CmdBuildMicromapsEXT;
+      VkLazyFunc<PFN_vkCmdClearDepthStencilImage, procaddr::DeviceFunc::CmdClearDepthStencilImage, VkLazyDeviceFuncs> CmdClearDepthStencilImage;
+      VkLazyFunc<PFN_vkCmdControlVideoCodingKHR, procaddr::DeviceFunc::CmdControlVideoCodingKHR, VkLazyDeviceFuncs> CmdControlVideoCodingKHR;
+      VkLazyFunc<PFN_vkCmdCopyAccelerationStructureKHR, procaddr::DeviceFunc::CmdCopyAccelerationStructureKHR, VkLazyDeviceFuncs> CmdCopyAccelerationStructureKHR;
+      VkLazyFunc<PFN_vkCmdCopyAccelerationStructureToMemoryKHR, procaddr::DeviceFunc::CmdCopyAccelerationStructureToMemoryKHR, VkLazyDeviceFuncs> CmdCopyAccelerationStructureToMemoryKHR;
+      VkLazyFunc<PFN_vkCmdCopyBuffer2, procaddr::DeviceFunc::CmdCopyBuffer2, VkLazyDeviceFuncs> CmdCopyBuffer2;
+      VkLazyFunc<PFN_vkCmdCopyBuffer2KHR, procaddr::DeviceFunc::CmdCopyBuffer2KHR, VkLazyDeviceFuncs> CmdCopyBuffer2KHR;
+      VkLazyFunc<PFN_vkCmdCopyBufferToImage2, procaddr::DeviceFunc::CmdCopyBufferToImage2, VkLazyDeviceFuncs> CmdCopyBufferToImage2;
+      VkLazyFunc<PFN_vkCmdCopyBufferToImage2KHR, procaddr::DeviceFunc::CmdCopyBufferToImage2KHR, VkLazyDeviceFuncs> CmdCopyBufferToImage2KHR;
+      VkLazyFunc<PFN_vkCmdCopyImage2, procaddr::DeviceFunc::CmdCopyImage2, VkLazyDeviceFuncs> CmdCopyImage2;
+      VkLazyFunc<PFN_vkCmdCopyImage2KHR, procaddr::DeviceFunc::CmdCopyImage2KHR, VkLazyDeviceFuncs> CmdCopyImage2KHR;
+      VkLazyFunc<PFN_vkCmdCopyImageToBuffer, procaddr::DeviceFunc::CmdCopyImageToBuffer, VkLazyDeviceFuncs> CmdCopyImageToBuffer;
+      VkLazyFunc<PFN_vkCmdCopyImageToBuffer2, procaddr::DeviceFunc::CmdCopyImageToBuffer2, VkLazyDeviceFuncs> CmdCopyImageToBuffer2;
+      VkLazyFunc<PFN_vkCmdCopyImageToBuffer2KHR, procaddr::DeviceFunc::CmdCopyImageToBuffer2KHR, VkLazyDeviceFuncs> CmdCopyImageToBuffer2KHR;
+      VkLazyFunc<PFN_vkCmdCopyMemoryToAccelerationStructureKHR, procaddr::DeviceFunc::CmdCopyMemoryToAccelerationStructureKHR, VkLazyDeviceFuncs> CmdCopyMemoryToAccelerationStructureKHR;
+      VkLazyFunc<PFN_vkCmdCopyMemoryToMicromapEXT, procaddr::DeviceFunc::CmdCopyMemoryToMicromapEXT, VkLazyDeviceFuncs> CmdCopyMemoryToMicromapEXT;
+      VkLazyFunc<PFN_vkCmdCopyMicromapEXT, procaddr::DeviceFunc::CmdCopyMicromapEXT, VkLazyDeviceFuncs> CmdCopyMicromapEXT;
+      VkLazyFunc<PFN_vkCmdCopyMicromapToMemoryEXT, procaddr::DeviceFunc::CmdCopyMicromapToMemoryEXT, VkLazyDeviceFuncs> CmdCopyMicromapToMemoryEXT;
+      VkLazyFunc<PFN_vkCmdCopyQueryPoolResults, procaddr::DeviceFunc::CmdCopyQueryPoolResults, VkLazyDeviceFuncs> CmdCopyQueryPoolResults;
+      VkLazyFunc<PFN_vkCmdDebugMarkerBeginEXT, procaddr::DeviceFunc::CmdDebugMarkerBeginEXT, VkLazyDeviceFuncs> CmdDebugMarkerBeginEXT;
+      VkLazyFunc<PFN_vkCmdDebugMarkerEndEXT, procaddr::DeviceFunc::CmdDebugMarkerEndEXT, VkLazyDeviceFuncs> CmdDebugMarkerEndEXT;
+      VkLazyFunc<PFN_vkCmdDebugMarkerInsertEXT, procaddr::DeviceFunc::CmdDebugMarkerInsertEXT, VkLazyDeviceFuncs> CmdDebugMarkerInsertEXT;
+      VkLazyFunc<PFN_vkCmdDecodeVideoKHR, procaddr::DeviceFunc::CmdDecodeVideoKHR, VkLazyDeviceFuncs> CmdDecodeVideoKHR;
+      VkLazyFunc<PFN_vkCmdDispatchBase, procaddr::DeviceFunc::CmdDispatchBase, VkLazyDeviceFuncs> CmdDispatchBase;
+      VkLazyFunc<PFN_vkCmdDispatchBaseKHR, procaddr::DeviceFunc::CmdDispatchBaseKHR, VkLazyDeviceFuncs> CmdDispatchBaseKHR;
+      VkLazyFunc<PFN_vkCmdDrawIndexedIndirectCountKHR, procaddr::DeviceFunc::CmdDrawIndexedIndirectCountKHR, VkLazyDeviceFuncs> CmdDrawIndexedIndirectCountKHR;
+      VkLazyFunc<PFN_vkCmdDrawIndirectByteCountEXT, procaddr::DeviceFunc::CmdDrawIndirectByteCountEXT, VkLazyDeviceFuncs> CmdDrawIndirectByteCountEXT;
+      VkLazyFunc<PFN_vkCmdDrawIndirectCountKHR, procaddr::DeviceFunc::CmdDrawIndirectCountKHR, VkLazyDeviceFuncs> CmdDrawIndirectCountKHR;
+      VkLazyFunc<PFN_vkCmdDrawMeshTasksEXT, procaddr::DeviceFunc::CmdDrawMeshTasksEXT, VkLazyDeviceFuncs> CmdDrawMeshTasksEXT;
+      VkLazyFunc<PFN_vkCmdDrawMeshTasksIndirectCountEXT, procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountEXT, VkLazyDeviceFuncs> CmdDrawMeshTasksIndirectCountEXT;
+      VkLazyFunc<PFN_vkCmdDrawMeshTasksIndirectEXT, procaddr::DeviceFunc::CmdDrawMeshTasksIndirectEXT, VkLazyDeviceFuncs> CmdDrawMeshTasksIndirectEXT;
+      VkLazyFunc<PFN_vkCmdDrawMultiEXT, procaddr::DeviceFunc::CmdDrawMultiEXT, VkLazyDeviceFuncs> CmdDrawMultiEXT;
+      VkLazyFunc<PFN_vkCmdDrawMultiIndexedEXT, procaddr::DeviceFunc::CmdDrawMultiIndexedEXT, VkLazyDeviceFuncs> CmdDrawMultiIndexedEXT;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      VkLazyFunc<PFN_vkCmdEncodeVideoKHR, procaddr::DeviceFunc::CmdEncodeVideoKHR, VkLazyDeviceFuncs> CmdEncodeVideoKHR;
+#endif
+      VkLazyFunc<PFN_vkCmdEndConditionalRenderingEXT, procaddr::DeviceFunc::CmdEndConditionalRenderingEXT, VkLazyDeviceFuncs> CmdEndConditionalRenderingEXT;
+      VkLazyFunc<PFN_vkCmdEndDebugUtilsLabelEXT, procaddr::DeviceFunc::CmdEndDebugUtilsLabelEXT, VkLazyDeviceFuncs> CmdEndDebugUtilsLabelEXT;
+      VkLazyFunc<PFN_vkCmdEndQueryIndexedEXT, procaddr::DeviceFunc::CmdEndQueryIndexedEXT, VkLazyDeviceFuncs> CmdEndQueryIndexedEXT;
+      VkLazyFunc<PFN_vkCmdEndRenderPass2KHR, procaddr::DeviceFunc::CmdEndRenderPass2KHR, VkLazyDeviceFuncs> CmdEndRenderPass2KHR;
+      VkLazyFunc<PFN_vkCmdEndTransformFeedbackEXT, procaddr::DeviceFunc::CmdEndTransformFeedbackEXT, VkLazyDeviceFuncs> CmdEndTransformFeedbackEXT;
+      VkLazyFunc<PFN_vkCmdEndVideoCodingKHR, procaddr::DeviceFunc::CmdEndVideoCodingKHR, VkLazyDeviceFuncs> CmdEndVideoCodingKHR;
+      VkLazyFunc<PFN_vkCmdFillBuffer, procaddr::DeviceFunc::CmdFillBuffer, VkLazyDeviceFuncs> CmdFillBuffer;
+      VkLazyFunc<PFN_vkCmdInsertDebugUtilsLabelEXT, procaddr::DeviceFunc::CmdInsertDebugUtilsLabelEXT, VkLazyDeviceFuncs> CmdInsertDebugUtilsLabelEXT;
+      VkLazyFunc<PFN_vkCmdNextSubpass2, procaddr::DeviceFunc::CmdNextSubpass2, VkLazyDeviceFuncs> CmdNextSubpass2;
+      VkLazyFunc<PFN_vkCmdNextSubpass2KHR, procaddr::DeviceFunc::CmdNextSubpass2KHR, VkLazyDeviceFuncs> CmdNextSubpass2KHR;
+      VkLazyFunc<PFN_vkCmdPushDescriptorSetWithTemplateKHR, procaddr::DeviceFunc::CmdPushDescriptorSetWithTemplateKHR, VkLazyDeviceFuncs> CmdPushDescriptorSetWithTemplateKHR;
+      VkLazyFunc<PFN_vkCmdResetEvent, procaddr::DeviceFunc::CmdResetEvent, VkLazyDeviceFuncs> CmdResetEvent;
+      VkLazyFunc<PFN_vkCmdResetEvent2, procaddr::DeviceFunc::CmdResetEvent2, VkLazyDeviceFuncs> CmdResetEvent2;
+      VkLazyFunc<PFN_vkCmdResetEvent2KHR, procaddr::DeviceFunc::CmdResetEvent2KHR, VkLazyDeviceFuncs> CmdResetEvent2KHR;
+      VkLazyFunc<PFN_vkCmdResolveImage, procaddr::DeviceFunc::CmdResolveImage, VkLazyDeviceFuncs> CmdResolveImage;
+      VkLazyFunc<PFN_vkCmdResolveImage2, procaddr::DeviceFunc::CmdResolveImage2, VkLazyDeviceFuncs> CmdResolveImage2;
+      VkLazyFunc<PFN_vkCmdResolveImage2KHR, procaddr::DeviceFunc::CmdResolveImage2KHR, VkLazyDeviceFuncs> CmdResolveImage2KHR;
+      VkLazyFunc<PFN_vkCmdSetAlphaToCoverageEnableEXT, procaddr::DeviceFunc::CmdSetAlphaToCoverageEnableEXT, VkLazyDeviceFuncs> CmdSetAlphaToCoverageEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetAlphaToOneEnableEXT, procaddr::DeviceFunc::CmdSetAlphaToOneEnableEXT, VkLazyDeviceFuncs> CmdSetAlphaToOneEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT, procaddr::DeviceFunc::CmdSetAttachmentFeedbackLoopEnableEXT, VkLazyDeviceFuncs> CmdSetAttachmentFeedbackLoopEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetBlendConstants, procaddr::DeviceFunc::CmdSetBlendConstants, VkLazyDeviceFuncs> CmdSetBlendConstants;
+      VkLazyFunc<PFN_vkCmdSetColorBlendAdvancedEXT, procaddr::DeviceFunc::CmdSetColorBlendAdvancedEXT, VkLazyDeviceFuncs> CmdSetColorBlendAdvancedEXT;
+      VkLazyFunc<PFN_vkCmdSetColorBlendEnableEXT, procaddr::DeviceFunc::CmdSetColorBlendEnableEXT, VkLazyDeviceFuncs> CmdSetColorBlendEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetColorBlendEquationEXT, procaddr::DeviceFunc::CmdSetColorBlendEquationEXT, VkLazyDeviceFuncs> CmdSetColorBlendEquationEXT;
+      VkLazyFunc<PFN_vkCmdSetColorWriteEnableEXT, procaddr::DeviceFunc::CmdSetColorWriteEnableEXT, VkLazyDeviceFuncs> CmdSetColorWriteEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetColorWriteMaskEXT, procaddr::DeviceFunc::CmdSetColorWriteMaskEXT, VkLazyDeviceFuncs> CmdSetColorWriteMaskEXT;
+      VkLazyFunc<PFN_vkCmdSetConservativeRasterizationModeEXT, procaddr::DeviceFunc::CmdSetConservativeRasterizationModeEXT, VkLazyDeviceFuncs> CmdSetConservativeRasterizationModeEXT;
+      VkLazyFunc<PFN_vkCmdSetCullMode, procaddr::DeviceFunc::CmdSetCullMode, VkLazyDeviceFuncs> CmdSetCullMode;
+      VkLazyFunc<PFN_vkCmdSetCullModeEXT, procaddr::DeviceFunc::CmdSetCullModeEXT, VkLazyDeviceFuncs> CmdSetCullModeEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthBias, procaddr::DeviceFunc::CmdSetDepthBias, VkLazyDeviceFuncs> CmdSetDepthBias;
+      VkLazyFunc<PFN_vkCmdSetDepthBiasEnable, procaddr::DeviceFunc::CmdSetDepthBiasEnable, VkLazyDeviceFuncs> CmdSetDepthBiasEnable;
+      VkLazyFunc<PFN_vkCmdSetDepthBiasEnableEXT, procaddr::DeviceFunc::CmdSetDepthBiasEnableEXT, VkLazyDeviceFuncs> CmdSetDepthBiasEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthBounds, procaddr::DeviceFunc::CmdSetDepthBounds, VkLazyDeviceFuncs> CmdSetDepthBounds;
+      VkLazyFunc<PFN_vkCmdSetDepthBoundsTestEnable, procaddr::DeviceFunc::CmdSetDepthBoundsTestEnable, VkLazyDeviceFuncs> CmdSetDepthBoundsTestEnable;
+      VkLazyFunc<PFN_vkCmdSetDepthBoundsTestEnableEXT, procaddr::DeviceFunc::CmdSetDepthBoundsTestEnableEXT, VkLazyDeviceFuncs> CmdSetDepthBoundsTestEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthClampEnableEXT, procaddr::DeviceFunc::CmdSetDepthClampEnableEXT, VkLazyDeviceFuncs> CmdSetDepthClampEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthClipEnableEXT, procaddr::DeviceFunc::CmdSetDepthClipEnableEXT, VkLazyDeviceFuncs> CmdSetDepthClipEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthClipNegativeOneToOneEXT, procaddr::DeviceFunc::CmdSetDepthClipNegativeOneToOneEXT, VkLazyDeviceFuncs> CmdSetDepthClipNegativeOneToOneEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthCompareOp, procaddr::DeviceFunc::CmdSetDepthCompareOp, VkLazyDeviceFuncs> CmdSetDepthCompareOp;
+      VkLazyFunc<PFN_vkCmdSetDepthCompareOpEXT, procaddr::DeviceFunc::CmdSetDepthCompareOpEXT, VkLazyDeviceFuncs> CmdSetDepthCompareOpEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthTestEnable, procaddr::DeviceFunc::CmdSetDepthTestEnable, VkLazyDeviceFuncs> CmdSetDepthTestEnable;
+      VkLazyFunc<PFN_vkCmdSetDepthTestEnableEXT, procaddr::DeviceFunc::CmdSetDepthTestEnableEXT, VkLazyDeviceFuncs> CmdSetDepthTestEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDepthWriteEnable, procaddr::DeviceFunc::CmdSetDepthWriteEnable, VkLazyDeviceFuncs> CmdSetDepthWriteEnable;
+      VkLazyFunc<PFN_vkCmdSetDepthWriteEnableEXT, procaddr::DeviceFunc::CmdSetDepthWriteEnableEXT, VkLazyDeviceFuncs> CmdSetDepthWriteEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDescriptorBufferOffsetsEXT, procaddr::DeviceFunc::CmdSetDescriptorBufferOffsetsEXT, VkLazyDeviceFuncs> CmdSetDescriptorBufferOffsetsEXT;
+      VkLazyFunc<PFN_vkCmdSetDeviceMask, procaddr::DeviceFunc::CmdSetDeviceMask, VkLazyDeviceFuncs> CmdSetDeviceMask;
+      VkLazyFunc<PFN_vkCmdSetDeviceMaskKHR, procaddr::DeviceFunc::CmdSetDeviceMaskKHR, VkLazyDeviceFuncs> CmdSetDeviceMaskKHR;
+      VkLazyFunc<PFN_vkCmdSetDiscardRectangleEXT, procaddr::DeviceFunc::CmdSetDiscardRectangleEXT, VkLazyDeviceFuncs> CmdSetDiscardRectangleEXT;
+      VkLazyFunc<PFN_vkCmdSetDiscardRectangleEnableEXT, procaddr::DeviceFunc::CmdSetDiscardRectangleEnableEXT, VkLazyDeviceFuncs> CmdSetDiscardRectangleEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetDiscardRectangleModeEXT, procaddr::DeviceFunc::CmdSetDiscardRectangleModeEXT, VkLazyDeviceFuncs> CmdSetDiscardRectangleModeEXT;
+      VkLazyFunc<PFN_vkCmdSetEvent2, procaddr::DeviceFunc::CmdSetEvent2, VkLazyDeviceFuncs> CmdSetEvent2;
+      VkLazyFunc<PFN_vkCmdSetEvent2KHR, procaddr::DeviceFunc::CmdSetEvent2KHR, VkLazyDeviceFuncs> CmdSetEvent2KHR;
+      VkLazyFunc<PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT, procaddr::DeviceFunc::CmdSetExtraPrimitiveOverestimationSizeEXT, VkLazyDeviceFuncs> CmdSetExtraPrimitiveOverestimationSizeEXT;
+      VkLazyFunc<PFN_vkCmdSetFragmentShadingRateKHR, procaddr::DeviceFunc::CmdSetFragmentShadingRateKHR, VkLazyDeviceFuncs> CmdSetFragmentShadingRateKHR;
+      VkLazyFunc<PFN_vkCmdSetFrontFace, procaddr::DeviceFunc::CmdSetFrontFace, VkLazyDeviceFuncs> CmdSetFrontFace;
+      VkLazyFunc<PFN_vkCmdSetFrontFaceEXT, procaddr::DeviceFunc::CmdSetFrontFaceEXT, VkLazyDeviceFuncs> CmdSetFrontFaceEXT;
+      VkLazyFunc<PFN_vkCmdSetLineRasterizationModeEXT, procaddr::DeviceFunc::CmdSetLineRasterizationModeEXT, VkLazyDeviceFuncs> CmdSetLineRasterizationModeEXT;
+      VkLazyFunc<PFN_vkCmdSetLineStippleEXT, procaddr::DeviceFunc::CmdSetLineStippleEXT, VkLazyDeviceFuncs> CmdSetLineStippleEXT;
+      VkLazyFunc<PFN_vkCmdSetLineStippleEnableEXT, procaddr::DeviceFunc::CmdSetLineStippleEnableEXT, VkLazyDeviceFuncs> CmdSetLineStippleEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetLineWidth, procaddr::DeviceFunc::CmdSetLineWidth, VkLazyDeviceFuncs> CmdSetLineWidth;
+      VkLazyFunc<PFN_vkCmdSetLogicOpEXT, procaddr::DeviceFunc::CmdSetLogicOpEXT, VkLazyDeviceFuncs> CmdSetLogicOpEXT;
+      VkLazyFunc<PFN_vkCmdSetLogicOpEnableEXT, procaddr::DeviceFunc::CmdSetLogicOpEnableEXT, VkLazyDeviceFuncs> CmdSetLogicOpEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetPatchControlPointsEXT, procaddr::DeviceFunc::CmdSetPatchControlPointsEXT, VkLazyDeviceFuncs> CmdSetPatchControlPointsEXT;
+      VkLazyFunc<PFN_vkCmdSetPolygonModeEXT, procaddr::DeviceFunc::CmdSetPolygonModeEXT, VkLazyDeviceFuncs> CmdSetPolygonModeEXT;
+      VkLazyFunc<PFN_vkCmdSetPrimitiveRestartEnable, procaddr::DeviceFunc::CmdSetPrimitiveRestartEnable, VkLazyDeviceFuncs> CmdSetPrimitiveRestartEnable;
+      VkLazyFunc<PFN_vkCmdSetPrimitiveRestartEnableEXT, procaddr::DeviceFunc::CmdSetPrimitiveRestartEnableEXT, VkLazyDeviceFuncs> CmdSetPrimitiveRestartEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetPrimitiveTopology, procaddr::DeviceFunc::CmdSetPrimitiveTopology, VkLazyDeviceFuncs> CmdSetPrimitiveTopology;
+      VkLazyFunc<PFN_vkCmdSetPrimitiveTopologyEXT, procaddr::DeviceFunc::CmdSetPrimitiveTopologyEXT, VkLazyDeviceFuncs> CmdSetPrimitiveTopologyEXT;
+      VkLazyFunc<PFN_vkCmdSetProvokingVertexModeEXT, procaddr::DeviceFunc::CmdSetProvokingVertexModeEXT, VkLazyDeviceFuncs> CmdSetProvokingVertexModeEXT;
+      VkLazyFunc<PFN_vkCmdSetRasterizationSamplesEXT, procaddr::DeviceFunc::CmdSetRasterizationSamplesEXT, VkLazyDeviceFuncs> CmdSetRasterizationSamplesEXT;
+      VkLazyFunc<PFN_vkCmdSetRasterizationStreamEXT, procaddr::DeviceFunc::CmdSetRasterizationStreamEXT, VkLazyDeviceFuncs> CmdSetRasterizationStreamEXT;
+      VkLazyFunc<PFN_vkCmdSetRasterizerDiscardEnable, procaddr::DeviceFunc::CmdSetRasterizerDiscardEnable, VkLazyDeviceFuncs> CmdSetRasterizerDiscardEnable;
+      VkLazyFunc<PFN_vkCmdSetRasterizerDiscardEnableEXT, procaddr::DeviceFunc::CmdSetRasterizerDiscardEnableEXT, VkLazyDeviceFuncs> CmdSetRasterizerDiscardEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetRayTracingPipelineStackSizeKHR, procaddr::DeviceFunc::CmdSetRayTracingPipelineStackSizeKHR, VkLazyDeviceFuncs> CmdSetRayTracingPipelineStackSizeKHR;
+      VkLazyFunc<PFN_vkCmdSetSampleLocationsEXT, procaddr::DeviceFunc::CmdSetSampleLocationsEXT, VkLazyDeviceFuncs> CmdSetSampleLocationsEXT;
+      VkLazyFunc<PFN_vkCmdSetSampleLocationsEnableEXT, procaddr::DeviceFunc::CmdSetSampleLocationsEnableEXT, VkLazyDeviceFuncs> CmdSetSampleLocationsEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetSampleMaskEXT, procaddr::DeviceFunc::CmdSetSampleMaskEXT, VkLazyDeviceFuncs> CmdSetSampleMaskEXT;
+      VkLazyFunc<PFN_vkCmdSetScissorWithCount, procaddr::DeviceFunc::CmdSetScissorWithCount, VkLazyDeviceFuncs> CmdSetScissorWithCount;
+      VkLazyFunc<PFN_vkCmdSetScissorWithCountEXT, procaddr::DeviceFunc::CmdSetScissorWithCountEXT, VkLazyDeviceFuncs> CmdSetScissorWithCountEXT;
+      VkLazyFunc<PFN_vkCmdSetStencilCompareMask, procaddr::DeviceFunc::CmdSetStencilCompareMask, VkLazyDeviceFuncs> CmdSetStencilCompareMask;
+      VkLazyFunc<PFN_vkCmdSetStencilOp, procaddr::DeviceFunc::CmdSetStencilOp, VkLazyDeviceFuncs> CmdSetStencilOp;
+      VkLazyFunc<PFN_vkCmdSetStencilOpEXT, procaddr::DeviceFunc::CmdSetStencilOpEXT, VkLazyDeviceFuncs> CmdSetStencilOpEXT;
+      VkLazyFunc<PFN_vkCmdSetStencilReference, procaddr::DeviceFunc::CmdSetStencilReference, VkLazyDeviceFuncs> CmdSetStencilReference;
+      VkLazyFunc<PFN_vkCmdSetStencilTestEnable, procaddr::DeviceFunc::CmdSetStencilTestEnable, VkLazyDeviceFuncs> CmdSetStencilTestEnable;
+      VkLazyFunc<PFN_vkCmdSetStencilTestEnableEXT, procaddr::DeviceFunc::CmdSetStencilTestEnableEXT, VkLazyDeviceFuncs> CmdSetStencilTestEnableEXT;
+      VkLazyFunc<PFN_vkCmdSetStencilWriteMask, procaddr::DeviceFunc::CmdSetStencilWriteMask, VkLazyDeviceFuncs> CmdSetStencilWriteMask;
+      VkLazyFunc<PFN_vkCmdSetTessellationDomainOriginEXT, procaddr::DeviceFunc::CmdSetTessellationDomainOriginEXT, VkLazyDeviceFuncs> CmdSetTessellationDomainOriginEXT;
+      VkLazyFunc<PFN_vkCmdSetVertexInputEXT, procaddr::DeviceFunc::CmdSetVertexInputEXT, VkLazyDeviceFuncs> CmdSetVertexInputEXT;
+      VkLazyFunc<PFN_vkCmdSetViewportWithCount, procaddr::DeviceFunc::CmdSetViewportWithCount, VkLazyDeviceFuncs> CmdSetViewportWithCount;
+      VkLazyFunc<PFN_vkCmdSetViewportWithCountEXT, procaddr::DeviceFunc::CmdSetViewportWithCountEXT, VkLazyDeviceFuncs> CmdSetViewportWithCountEXT;
+      VkLazyFunc<PFN_vkCmdTraceRaysIndirect2KHR, procaddr::DeviceFunc::CmdTraceRaysIndirect2KHR, VkLazyDeviceFuncs> CmdTraceRaysIndirect2KHR;
+      VkLazyFunc<PFN_vkCmdTraceRaysIndirectKHR, procaddr::DeviceFunc::CmdTraceRaysIndirectKHR, VkLazyDeviceFuncs> CmdTraceRaysIndirectKHR;
+      VkLazyFunc<PFN_vkCmdTraceRaysKHR, procaddr::DeviceFunc::CmdTraceRaysKHR, VkLazyDeviceFuncs> CmdTraceRaysKHR;
+      VkLazyFunc<PFN_vkCmdUpdateBuffer, procaddr::DeviceFunc::CmdUpdateBuffer, VkLazyDeviceFuncs> CmdUpdateBuffer;
+      VkLazyFunc<PFN_vkCmdWaitEvents2, procaddr::DeviceFunc::CmdWaitEvents2, VkLazyDeviceFuncs> CmdWaitEvents2;
+      VkLazyFunc<PFN_vkCmdWaitEvents2KHR, procaddr::DeviceFunc::CmdWaitEvents2KHR, VkLazyDeviceFuncs> CmdWaitEvents2KHR;
+      VkLazyFunc<PFN_vkCmdWriteAccelerationStructuresPropertiesKHR, procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesKHR, VkLazyDeviceFuncs> CmdWriteAccelerationStructuresPropertiesKHR;
+      VkLazyFunc<PFN_vkCmdWriteMicromapsPropertiesEXT, procaddr::DeviceFunc::CmdWriteMicromapsPropertiesEXT, VkLazyDeviceFuncs> CmdWriteMicromapsPropertiesEXT;
+      VkLazyFunc<PFN_vkCmdWriteTimestamp2, procaddr::DeviceFunc::CmdWriteTimestamp2, VkLazyDeviceFuncs> CmdWriteTimestamp2;
+      VkLazyFunc<PFN_vkCmdWriteTimestamp2KHR, procaddr::DeviceFunc::CmdWriteTimestamp2KHR, VkLazyDeviceFuncs> CmdWriteTimestamp2KHR;
+      VkLazyFunc<PFN_vkQueueBeginDebugUtilsLabelEXT, procaddr::DeviceFunc::QueueBeginDebugUtilsLabelEXT, VkLazyDeviceFuncs> QueueBeginDebugUtilsLabelEXT;
+      VkLazyFunc<PFN_vkQueueBindSparse, procaddr::DeviceFunc::QueueBindSparse, VkLazyDeviceFuncs> QueueBindSparse;
+      VkLazyFunc<PFN_vkQueueEndDebugUtilsLabelEXT, procaddr::DeviceFunc::QueueEndDebugUtilsLabelEXT, VkLazyDeviceFuncs> QueueEndDebugUtilsLabelEXT;
+      VkLazyFunc<PFN_vkQueueInsertDebugUtilsLabelEXT, procaddr::DeviceFunc::QueueInsertDebugUtilsLabelEXT, VkLazyDeviceFuncs> QueueInsertDebugUtilsLabelEXT;
+      VkLazyFunc<PFN_vkQueueWaitIdle, procaddr::DeviceFunc::QueueWaitIdle, VkLazyDeviceFuncs> QueueWaitIdle;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkAcquireFullScreenExclusiveModeEXT, procaddr::DeviceFunc::AcquireFullScreenExclusiveModeEXT, VkLazyDeviceFuncs> AcquireFullScreenExclusiveModeEXT;
+#endif
+      VkLazyFunc<PFN_vkAcquireProfilingLockKHR, procaddr::DeviceFunc::AcquireProfilingLockKHR, VkLazyDeviceFuncs> AcquireProfilingLockKHR;
+      VkLazyFunc<PFN_vkAllocateCommandBuffers, procaddr::DeviceFunc::AllocateCommandBuffers, VkLazyDeviceFuncs> AllocateCommandBuffers;
+      VkLazyFunc<PFN_vkAllocateMemory, procaddr::DeviceFunc::AllocateMemory, VkLazyDeviceFuncs> AllocateMemory;
+      VkLazyFunc<PFN_vkBindBufferMemory, procaddr::DeviceFunc::BindBufferMemory, VkLazyDeviceFuncs> BindBufferMemory;
+      VkLazyFunc<PFN_vkBindBufferMemory2, procaddr::DeviceFunc::BindBufferMemory2, VkLazyDeviceFuncs> BindBufferMemory2;
+      VkLazyFunc<PFN_vkBindBufferMemory2KHR, procaddr::DeviceFunc::BindBufferMemory2KHR, VkLazyDeviceFuncs> BindBufferMemory2KHR;
+      VkLazyFunc<PFN_vkBindImageMemory, procaddr::DeviceFunc::BindImageMemory, VkLazyDeviceFuncs> BindImageMemory;
+      VkLazyFunc<PFN_vkBindImageMemory2, procaddr::DeviceFunc::BindImageMemory2, VkLazyDeviceFuncs> BindImageMemory2;
+      VkLazyFunc<PFN_vkBindImageMemory2KHR, procaddr::DeviceFunc::BindImageMemory2KHR, VkLazyDeviceFuncs> BindImageMemory2KHR;
+      VkLazyFunc<PFN_vkBindVideoSessionMemoryKHR, procaddr::DeviceFunc::BindVideoSessionMemoryKHR, VkLazyDeviceFuncs> BindVideoSessionMemoryKHR;
+      VkLazyFunc<PFN_vkBuildAccelerationStructuresKHR, procaddr::DeviceFunc::BuildAccelerationStructuresKHR, VkLazyDeviceFuncs> BuildAccelerationStructuresKHR;
+      VkLazyFunc<PFN_vkBuildMicromapsEXT, procaddr::DeviceFunc::BuildMicromapsEXT, VkLazyDeviceFuncs> BuildMicromapsEXT;
+      VkLazyFunc<PFN_vkCopyAccelerationStructureKHR, procaddr::DeviceFunc::CopyAccelerationStructureKHR, VkLazyDeviceFuncs> CopyAccelerationStructureKHR;
+      VkLazyFunc<PFN_vkCopyAccelerationStructureToMemoryKHR, procaddr::DeviceFunc::CopyAccelerationStructureToMemoryKHR, VkLazyDeviceFuncs> CopyAccelerationStructureToMemoryKHR;
+      VkLazyFunc<PFN_vkCopyMemoryToAccelerationStructureKHR, procaddr::DeviceFunc::CopyMemoryToAccelerationStructureKHR, VkLazyDeviceFuncs> CopyMemoryToAccelerationStructureKHR;
+      VkLazyFunc<PFN_vkCopyMemoryToMicromapEXT, procaddr::DeviceFunc::CopyMemoryToMicromapEXT, VkLazyDeviceFuncs> CopyMemoryToMicromapEXT;
+      VkLazyFunc<PFN_vkCopyMicromapEXT, procaddr::DeviceFunc::CopyMicromapEXT, VkLazyDeviceFuncs> CopyMicromapEXT;
+      VkLazyFunc<PFN_vkCopyMicromapToMemoryEXT, procaddr::DeviceFunc::CopyMicromapToMemoryEXT, VkLazyDeviceFuncs> CopyMicromapToMemoryEXT;
+      VkLazyFunc<PFN_vkCreateAccelerationStructureKHR, procaddr::DeviceFunc::CreateAccelerationStructureKHR, VkLazyDeviceFuncs> CreateAccelerationStructureKHR;
+      VkLazyFunc<PFN_vkCreateBuffer, procaddr::DeviceFunc::CreateBuffer, VkLazyDeviceFuncs> CreateBuffer;
+      VkLazyFunc<PFN_vkCreateBufferView, procaddr::DeviceFunc::CreateBufferView, VkLazyDeviceFuncs> CreateBufferView;
+      VkLazyFunc<PFN_vkCreateCommandPool, procaddr::DeviceFunc::CreateCommandPool, VkLazyDeviceFuncs> CreateCommandPool;
+      VkLazyFunc<PFN_vkCreateComputePipelines, procaddr::DeviceFunc::CreateComputePipelines, VkLazyDeviceFuncs> CreateComputePipelines;
+      VkLazyFunc<PFN_vkCreateDeferredOperationKHR, procaddr::DeviceFunc::CreateDeferredOperationKHR, VkLazyDeviceFuncs> CreateDeferredOperationKHR;
+      VkLazyFunc<PFN_vkCreateDescriptorPool, procaddr::DeviceFunc::CreateDescriptorPool, VkLazyDeviceFuncs> CreateDescriptorPool;
+      VkLazyFunc<PFN_vkCreateDescriptorSetLayout, procaddr::DeviceFunc::CreateDescriptorSetLayout, VkLazyDeviceFuncs> CreateDescriptorSetLayout;
+      VkLazyFunc<PFN_vkCreateDescriptorUpdateTemplate, procaddr::DeviceFunc::CreateDescriptorUpdateTemplate, VkLazyDeviceFuncs> CreateDescriptorUpdateTemplate;
+      VkLazyFunc<PFN_vkCreateDescriptorUpdateTemplateKHR, procaddr::DeviceFunc::CreateDescriptorUpdateTemplateKHR, VkLazyDeviceFuncs> CreateDescriptorUpdateTemplateKHR;
+      VkLazyFunc<PFN_vkCreateEvent, procaddr::DeviceFunc::CreateEvent, VkLazyDeviceFuncs> CreateEvent;
+      VkLazyFunc<PFN_vkCreateFence, procaddr::DeviceFunc::CreateFence, VkLazyDeviceFuncs> CreateFence;
+      VkLazyFunc<PFN_vkCreateFramebuffer, procaddr::DeviceFunc::CreateFramebuffer, VkLazyDeviceFuncs> CreateFramebuffer;
+      VkLazyFunc<PFN_vkCreateGraphicsPipelines, procaddr::DeviceFunc::CreateGraphicsPipelines, VkLazyDeviceFuncs> CreateGraphicsPipelines;
+      VkLazyFunc<PFN_vkCreateImage, procaddr::DeviceFunc::CreateImage, VkLazyDeviceFuncs> CreateImage;
+      VkLazyFunc<PFN_vkCreateImageView, procaddr::DeviceFunc::CreateImageView, VkLazyDeviceFuncs> CreateImageView;
+      VkLazyFunc<PFN_vkCreateMicromapEXT, procaddr::DeviceFunc::CreateMicromapEXT, VkLazyDeviceFuncs> CreateMicromapEXT;
+      VkLazyFunc<PFN_vkCreatePipelineCache, procaddr::DeviceFunc::CreatePipelineCache, VkLazyDeviceFuncs> CreatePipelineCache;
+      VkLazyFunc<PFN_vkCreatePipelineLayout, procaddr::DeviceFunc::CreatePipelineLayout, VkLazyDeviceFuncs> CreatePipelineLayout;
+      VkLazyFunc<PFN_vkCreatePrivateDataSlot, procaddr::DeviceFunc::CreatePrivateDataSlot, VkLazyDeviceFuncs> CreatePrivateDataSlot;
+      VkLazyFunc<PFN_vkCreatePrivateDataSlotEXT, procaddr::DeviceFunc::CreatePrivateDataSlotEXT, VkLazyDeviceFuncs> CreatePrivateDataSlotEXT;
+      VkLazyFunc<PFN_vkCreateQueryPool, procaddr::DeviceFunc::CreateQueryPool, VkLazyDeviceFuncs> CreateQueryPool;
+      VkLazyFunc<PFN_vkCreateRayTracingPipelinesKHR, procaddr::DeviceFunc::CreateRayTracingPipelinesKHR, VkLazyDeviceFuncs> CreateRayTracingPipelinesKHR;
+      VkLazyFunc<PFN_vkCreateRenderPass, procaddr::DeviceFunc::CreateRenderPass, VkLazyDeviceFuncs> CreateRenderPass;
+      VkLazyFunc<PFN_vkCreateRenderPass2, procaddr::DeviceFunc::CreateRenderPass2, VkLazyDeviceFuncs> CreateRenderPass2;
+      VkLazyFunc<PFN_vkCreateRenderPass2KHR, procaddr::DeviceFunc::CreateRenderPass2KHR, VkLazyDeviceFuncs> CreateRenderPass2KHR;
+      VkLazyFunc<PFN_vkCreateSampler, procaddr::DeviceFunc::CreateSampler, VkLazyDeviceFuncs> CreateSampler;
+      VkLazyFunc<PFN_vkCreateSamplerYcbcrConversion, procaddr::DeviceFunc::CreateSamplerYcbcrConversion, VkLazyDeviceFuncs> CreateSamplerYcbcrConversion;
+      VkLazyFunc<PFN_vkCreateSamplerYcbcrConversionKHR, procaddr::DeviceFunc::CreateSamplerYcbcrConversionKHR, VkLazyDeviceFuncs> CreateSamplerYcbcrConversionKHR;
+      VkLazyFunc<PFN_vkCreateSemaphore, procaddr::DeviceFunc::CreateSemaphore, VkLazyDeviceFuncs> CreateSemaphore;
+      VkLazyFunc<PFN_vkCreateShaderModule, procaddr::DeviceFunc::CreateShaderModule, VkLazyDeviceFuncs> CreateShaderModule;
+      VkLazyFunc<PFN_vkCreateShadersEXT, procaddr::DeviceFunc::CreateShadersEXT, VkLazyDeviceFuncs> CreateShadersEXT;
+      VkLazyFunc<PFN_vkCreateSharedSwapchainsKHR, procaddr::DeviceFunc::CreateSharedSwapchainsKHR, VkLazyDeviceFuncs> CreateSharedSwapchainsKHR;
+      VkLazyFunc<PFN_vkCreateSwapchainKHR, procaddr::DeviceFunc::CreateSwapchainKHR, VkLazyDeviceFuncs> CreateSwapchainKHR;
+      VkLazyFunc<PFN_vkCreateValidationCacheEXT, procaddr::DeviceFunc::CreateValidationCacheEXT, VkLazyDeviceFuncs> CreateValidationCacheEXT;
+      VkLazyFunc<PFN_vkCreateVideoSessionKHR, procaddr::DeviceFunc::CreateVideoSessionKHR, VkLazyDeviceFuncs> CreateVideoSessionKHR;
+      VkLazyFunc<PFN_vkCreateVideoSessionParametersKHR, procaddr::DeviceFunc::CreateVideoSessionParametersKHR, VkLazyDeviceFuncs> CreateVideoSessionParametersKHR;
+      VkLazyFunc<PFN_vkDebugMarkerSetObjectNameEXT, procaddr::DeviceFunc::DebugMarkerSetObjectNameEXT, VkLazyDeviceFuncs> DebugMarkerSetObjectNameEXT;
+      VkLazyFunc<PFN_vkDebugMarkerSetObjectTagEXT, procaddr::DeviceFunc::DebugMarkerSetObjectTagEXT, VkLazyDeviceFuncs> DebugMarkerSetObjectTagEXT;
+      VkLazyFunc<PFN_vkDeferredOperationJoinKHR, procaddr::DeviceFunc::DeferredOperationJoinKHR, VkLazyDeviceFuncs> DeferredOperationJoinKHR;
+      VkLazyFunc<PFN_vkDestroyAccelerationStructureKHR, procaddr::DeviceFunc::DestroyAccelerationStructureKHR, VkLazyDeviceFuncs> DestroyAccelerationStructureKHR;
+      VkLazyFunc<PFN_vkDestroyBuffer, procaddr::DeviceFunc::DestroyBuffer, VkLazyDeviceFuncs> DestroyBuffer;
+      VkLazyFunc<PFN_vkDestroyBufferView, procaddr::DeviceFunc::DestroyBufferView, VkLazyDeviceFuncs> DestroyBufferView;
+      VkLazyFunc<PFN_vkDestroyCommandPool, procaddr::DeviceFunc::DestroyCommandPool, VkLazyDeviceFuncs> DestroyCommandPool;
+      VkLazyFunc<PFN_vkDestroyDeferredOperationKHR, procaddr::DeviceFunc::DestroyDeferredOperationKHR, VkLazyDeviceFuncs> DestroyDeferredOperationKHR;
+      VkLazyFunc<PFN_vkDestroyDescriptorPool, procaddr::DeviceFunc::DestroyDescriptorPool, VkLazyDeviceFuncs> DestroyDescriptorPool;
+      VkLazyFunc<PFN_vkDestroyDescriptorSetLayout, procaddr::DeviceFunc::DestroyDescriptorSetLayout, VkLazyDeviceFuncs> DestroyDescriptorSetLayout;
+      VkLazyFunc<PFN_vkDestroyDescriptorUpdateTemplate, procaddr::DeviceFunc::DestroyDescriptorUpdateTemplate, VkLazyDeviceFuncs> DestroyDescriptorUpdateTemplate;
+      VkLazyFunc<PFN_vkDestroyDescriptorUpdateTemplateKHR, procaddr::DeviceFunc::DestroyDescriptorUpdateTemplateKHR, VkLazyDeviceFuncs> DestroyDescriptorUpdateTemplateKHR;
+      VkLazyFunc<PFN_vkDestroyEvent, procaddr::DeviceFunc::DestroyEvent, VkLazyDeviceFuncs> DestroyEvent;
+      VkLazyFunc<PFN_vkDestroyFence, procaddr::DeviceFunc::DestroyFence, VkLazyDeviceFuncs> DestroyFence;
+      VkLazyFunc<PFN_vkDestroyFramebuffer, procaddr::DeviceFunc::DestroyFramebuffer, VkLazyDeviceFuncs> DestroyFramebuffer;
+      VkLazyFunc<PFN_vkDestroyImage, procaddr::DeviceFunc::DestroyImage, VkLazyDeviceFuncs> DestroyImage;
+      VkLazyFunc<PFN_vkDestroyImageView, procaddr::DeviceFunc::DestroyImageView, VkLazyDeviceFuncs> DestroyImageView;
+      VkLazyFunc<PFN_vkDestroyMicromapEXT, procaddr::DeviceFunc::DestroyMicromapEXT, VkLazyDeviceFuncs> DestroyMicromapEXT;
+      VkLazyFunc<PFN_vkDestroyPipeline, procaddr::DeviceFunc::DestroyPipeline, VkLazyDeviceFuncs> DestroyPipeline;
+      VkLazyFunc<PFN_vkDestroyPipelineCache, procaddr::DeviceFunc::DestroyPipelineCache, VkLazyDeviceFuncs> DestroyPipelineCache;
+      VkLazyFunc<PFN_vkDestroyPipelineLayout, procaddr::DeviceFunc::DestroyPipelineLayout, VkLazyDeviceFuncs> DestroyPipelineLayout;
+      VkLazyFunc<PFN_vkDestroyPrivateDataSlot, procaddr::DeviceFunc::DestroyPrivateDataSlot, VkLazyDeviceFuncs> DestroyPrivateDataSlot;
+      VkLazyFunc<PFN_vkDestroyPrivateDataSlotEXT, procaddr::DeviceFunc::DestroyPrivateDataSlotEXT, VkLazyDeviceFuncs> DestroyPrivateDataSlotEXT;
+      VkLazyFunc<PFN_vkDestroyQueryPool, procaddr::DeviceFunc::DestroyQueryPool, VkLazyDeviceFuncs> DestroyQueryPool;
+      VkLazyFunc<PFN_vkDestroyRenderPass, procaddr::DeviceFunc::DestroyRenderPass, VkLazyDeviceFuncs> DestroyRenderPass;
+      VkLazyFunc<PFN_vkDestroySampler, procaddr::DeviceFunc::DestroySampler, VkLazyDeviceFuncs> DestroySampler;
+      VkLazyFunc<PFN_vkDestroySamplerYcbcrConversion, procaddr::DeviceFunc::DestroySamplerYcbcrConversion, VkLazyDeviceFuncs> DestroySamplerYcbcrConversion;
+      VkLazyFunc<PFN_vkDestroySamplerYcbcrConversionKHR, procaddr::DeviceFunc::DestroySamplerYcbcrConversionKHR, VkLazyDeviceFuncs> DestroySamplerYcbcrConversionKHR;
+      VkLazyFunc<PFN_vkDestroySemaphore, procaddr::DeviceFunc::DestroySemaphore, VkLazyDeviceFuncs> DestroySemaphore;
+      VkLazyFunc<PFN_vkDestroyShaderEXT, procaddr::DeviceFunc::DestroyShaderEXT, VkLazyDeviceFuncs> DestroyShaderEXT;
+      VkLazyFunc<PFN_vkDestroyShaderModule, procaddr::DeviceFunc::DestroyShaderModule, VkLazyDeviceFuncs> DestroyShaderModule;
+      VkLazyFunc<PFN_vkDestroySwapchainKHR, procaddr::DeviceFunc::DestroySwapchainKHR, VkLazyDeviceFuncs> DestroySwapchainKHR;
+      VkLazyFunc<PFN_vkDestroyValidationCacheEXT, procaddr::DeviceFunc::DestroyValidationCacheEXT, VkLazyDeviceFuncs> DestroyValidationCacheEXT;
+      VkLazyFunc<PFN_vkDestroyVideoSessionKHR, procaddr::DeviceFunc::DestroyVideoSessionKHR, VkLazyDeviceFuncs> DestroyVideoSessionKHR;
+      VkLazyFunc<PFN_vkDestroyVideoSessionParametersKHR, procaddr::DeviceFunc::DestroyVideoSessionParametersKHR, VkLazyDeviceFuncs> DestroyVideoSessionParametersKHR;
+      VkLazyFunc<PFN_vkDeviceWaitIdle, procaddr::DeviceFunc::DeviceWaitIdle, VkLazyDeviceFuncs> DeviceWaitIdle;
+      VkLazyFunc<PFN_vkDisplayPowerControlEXT, procaddr::DeviceFunc::DisplayPowerControlEXT, VkLazyDeviceFuncs> DisplayPowerControlEXT;
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      VkLazyFunc<PFN_vkExportMetalObjectsEXT, procaddr::DeviceFunc::ExportMetalObjectsEXT, VkLazyDeviceFuncs> ExportMetalObjectsEXT;
+#endif
+      VkLazyFunc<PFN_vkFlushMappedMemoryRanges, procaddr::DeviceFunc::FlushMappedMemoryRanges, VkLazyDeviceFuncs> FlushMappedMemoryRanges;
+      VkLazyFunc<PFN_vkFreeCommandBuffers, procaddr::DeviceFunc::FreeCommandBuffers, VkLazyDeviceFuncs> FreeCommandBuffers;
+      VkLazyFunc<PFN_vkFreeDescriptorSets, procaddr::DeviceFunc::FreeDescriptorSets, VkLazyDeviceFuncs> FreeDescriptorSets;
+      VkLazyFunc<PFN_vkFreeMemory, procaddr::DeviceFunc::FreeMemory, VkLazyDeviceFuncs> FreeMemory;
+      VkLazyFunc<PFN_vkGetAccelerationStructureBuildSizesKHR, procaddr::DeviceFunc::GetAccelerationStructureBuildSizesKHR, VkLazyDeviceFuncs> GetAccelerationStructureBuildSizesKHR;
+      VkLazyFunc<PFN_vkGetAccelerationStructureDeviceAddressKHR, procaddr::DeviceFunc::GetAccelerationStructureDeviceAddressKHR, VkLazyDeviceFuncs> GetAccelerationStructureDeviceAddressKHR;
+      VkLazyFunc<PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT, procaddr::DeviceFunc::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT, VkLazyDeviceFuncs> GetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+      VkLazyFunc<PFN_vkGetBufferDeviceAddress, procaddr::DeviceFunc::GetBufferDeviceAddress, VkLazyDeviceFuncs> GetBufferDeviceAddress;
+      VkLazyFunc<PFN_vkGetBufferDeviceAddressEXT, procaddr::DeviceFunc::GetBufferDeviceAddressEXT, VkLazyDeviceFuncs> GetBufferDeviceAddressEXT;
+      VkLazyFunc<PFN_vkGetBufferDeviceAddressKHR, procaddr::DeviceFunc::GetBufferDeviceAddressKHR, VkLazyDeviceFuncs> GetBufferDeviceAddressKHR;
+      VkLazyFunc<PFN_vkGetBufferMemoryRequirements, procaddr::DeviceFunc::GetBufferMemoryRequirements, VkLazyDeviceFuncs> GetBufferMemoryRequirements;
+      VkLazyFunc<PFN_vkGetBufferMemoryRequirements2, procaddr::DeviceFunc::GetBufferMemoryRequirements2, VkLazyDeviceFuncs> GetBufferMemoryRequirements2;
+      VkLazyFunc<PFN_vkGetBufferMemoryRequirements2KHR, procaddr::DeviceFunc::GetBufferMemoryRequirements2KHR, VkLazyDeviceFuncs> GetBufferMemoryRequirements2KHR;
+      VkLazyFunc<PFN_vkGetBufferOpaqueCaptureAddress, procaddr::DeviceFunc::GetBufferOpaqueCaptureAddress, VkLazyDeviceFuncs> GetBufferOpaqueCaptureAddress;
+      VkLazyFunc<PFN_vkGetBufferOpaqueCaptureAddressKHR, procaddr::DeviceFunc::GetBufferOpaqueCaptureAddressKHR, VkLazyDeviceFuncs> GetBufferOpaqueCaptureAddressKHR;
+      VkLazyFunc<PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT, procaddr::DeviceFunc::GetBufferOpaqueCaptureDescriptorDataEXT, VkLazyDeviceFuncs> GetBufferOpaqueCaptureDescriptorDataEXT;
+      VkLazyFunc<PFN_vkGetCalibratedTimestampsEXT, procaddr::DeviceFunc::GetCalibratedTimestampsEXT, VkLazyDeviceFuncs> GetCalibratedTimestampsEXT;
+      VkLazyFunc<PFN_vkGetDeferredOperationMaxConcurrencyKHR, procaddr::DeviceFunc::GetDeferredOperationMaxConcurrencyKHR, VkLazyDeviceFuncs> GetDeferredOperationMaxConcurrencyKHR;
+      VkLazyFunc<PFN_vkGetDeferredOperationResultKHR, procaddr::DeviceFunc::GetDeferredOperationResultKHR, VkLazyDeviceFuncs> GetDeferredOperationResultKHR;
+      VkLazyFunc<PFN_vkGetDescriptorEXT, procaddr::DeviceFunc::GetDescriptorEXT, VkLazyDeviceFuncs> GetDescriptorEXT;
+      VkLazyFunc<PFN_vkGetDescriptorSetLayoutBindingOffsetEXT, procaddr::DeviceFunc::GetDescriptorSetLayoutBindingOffsetEXT, VkLazyDeviceFuncs> GetDescriptorSetLayoutBindingOffsetEXT;
+      VkLazyFunc<PFN_vkGetDescriptorSetLayoutSizeEXT, procaddr::DeviceFunc::GetDescriptorSetLayoutSizeEXT, VkLazyDeviceFuncs> GetDescriptorSetLayoutSizeEXT;
+      VkLazyFunc<PFN_vkGetDescriptorSetLayoutSupport, procaddr::DeviceFunc::GetDescriptorSetLayoutSupport, VkLazyDeviceFuncs> GetDescriptorSetLayoutSupport;
+      VkLazyFunc<PFN_vkGetDescriptorSetLayoutSupportKHR, procaddr::DeviceFunc::GetDescriptorSetLayoutSupportKHR, VkLazyDeviceFuncs> GetDescriptorSetLayoutSupportKHR;
+      VkLazyFunc<PFN_vkGetDeviceAccelerationStructureCompatibilityKHR, procaddr::DeviceFunc::GetDeviceAccelerationStructureCompatibilityKHR, VkLazyDeviceFuncs> GetDeviceAccelerationStructureCompatibilityKHR;
+      VkLazyFunc<PFN_vkGetDeviceBufferMemoryRequirements, procaddr::DeviceFunc::GetDeviceBufferMemoryRequirements, VkLazyDeviceFuncs> GetDeviceBufferMemoryRequirements;
+      VkLazyFunc<PFN_vkGetDeviceBufferMemoryRequirementsKHR, procaddr::DeviceFunc::GetDeviceBufferMemoryRequirementsKHR, VkLazyDeviceFuncs> GetDeviceBufferMemoryRequirementsKHR;
+      VkLazyFunc<PFN_vkGetDeviceFaultInfoEXT, procaddr::DeviceFunc::GetDeviceFaultInfoEXT, VkLazyDeviceFuncs> GetDeviceFaultInfoEXT;
+      VkLazyFunc<PFN_vkGetDeviceGroupPeerMemoryFeatures, procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeatures, VkLazyDeviceFuncs> GetDeviceGroupPeerMemoryFeatures;
+      VkLazyFunc<PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR, procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeaturesKHR, VkLazyDeviceFuncs> GetDeviceGroupPeerMemoryFeaturesKHR;
+      VkLazyFunc<PFN_vkGetDeviceGroupPresentCapabilitiesKHR, procaddr::DeviceFunc::GetDeviceGroupPresentCapabilitiesKHR, VkLazyDeviceFuncs> GetDeviceGroupPresentCapabilitiesKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkGetDeviceGroupSurfacePresentModes2EXT, procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModes2EXT, VkLazyDeviceFuncs> GetDeviceGroupSurfacePresentModes2EXT;
+#endif
+      VkLazyFunc<PFN_vkGetDeviceGroupSurfacePresentModesKHR, procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModesKHR, VkLazyDeviceFuncs> GetDeviceGroupSurfacePresentModesKHR;
+      VkLazyFunc<PFN_vkGetDeviceImageMemoryRequirements, procaddr::DeviceFunc::GetDeviceImageMemoryRequirements, VkLazyDeviceFuncs> GetDeviceImageMemoryRequirements;
+      VkLazyFunc<PFN_vkGetDeviceImageMemoryRequirementsKHR, procaddr::DeviceFunc::GetDeviceImageMemoryRequirementsKHR, VkLazyDeviceFuncs> GetDeviceImageMemoryRequirementsKHR;
+      VkLazyFunc<PFN_vkGetDeviceImageSparseMemoryRequirements, procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirements, VkLazyDeviceFuncs> GetDeviceImageSparseMemoryRequirements;
+      VkLazyFunc<PFN_vkGetDeviceImageSparseMemoryRequirementsKHR, procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirementsKHR, VkLazyDeviceFuncs> GetDeviceImageSparseMemoryRequirementsKHR;
+      VkLazyFunc<PFN_vkGetDeviceMemoryCommitment, procaddr::DeviceFunc::GetDeviceMemoryCommitment, VkLazyDeviceFuncs> GetDeviceMemoryCommitment;
+      VkLazyFunc<PFN_vkGetDeviceMemoryOpaqueCaptureAddress, procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddress, VkLazyDeviceFuncs> GetDeviceMemoryOpaqueCaptureAddress;
+      VkLazyFunc<PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR, procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddressKHR, VkLazyDeviceFuncs> GetDeviceMemoryOpaqueCaptureAddressKHR;
+      VkLazyFunc<PFN_vkGetDeviceMicromapCompatibilityEXT, procaddr::DeviceFunc::GetDeviceMicromapCompatibilityEXT, VkLazyDeviceFuncs> GetDeviceMicromapCompatibilityEXT;
+      VkLazyFunc<PFN_vkGetDeviceQueue, procaddr::DeviceFunc::GetDeviceQueue, VkLazyDeviceFuncs> GetDeviceQueue;
+      VkLazyFunc<PFN_vkGetDeviceQueue2, procaddr::DeviceFunc::GetDeviceQueue2, VkLazyDeviceFuncs> GetDeviceQueue2;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      VkLazyFunc<PFN_vkGetEncodedVideoSessionParametersKHR, procaddr::DeviceFunc::GetEncodedVideoSessionParametersKHR, VkLazyDeviceFuncs> GetEncodedVideoSessionParametersKHR;
+#endif
+      VkLazyFunc<PFN_vkGetEventStatus, procaddr::DeviceFunc::GetEventStatus, VkLazyDeviceFuncs> GetEventStatus;
+      VkLazyFunc<PFN_vkGetFenceFdKHR, procaddr::DeviceFunc::GetFenceFdKHR, VkLazyDeviceFuncs> GetFenceFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkGetFenceWin32HandleKHR, procaddr::DeviceFunc::GetFenceWin32HandleKHR, VkLazyDeviceFuncs> GetFenceWin32HandleKHR;
+#endif
+      VkLazyFunc<PFN_vkGetImageDrmFormatModifierPropertiesEXT, procaddr::DeviceFunc::GetImageDrmFormatModifierPropertiesEXT, VkLazyDeviceFuncs> GetImageDrmFormatModifierPropertiesEXT;
+      VkLazyFunc<PFN_vkGetImageMemoryRequirements, procaddr::DeviceFunc::GetImageMemoryRequirements, VkLazyDeviceFuncs> GetImageMemoryRequirements;
+      VkLazyFunc<PFN_vkGetImageMemoryRequirements2, procaddr::DeviceFunc::GetImageMemoryRequirements2, VkLazyDeviceFuncs> GetImageMemoryRequirements2;
+      VkLazyFunc<PFN_vkGetImageMemoryRequirements2KHR, procaddr::DeviceFunc::GetImageMemoryRequirements2KHR, VkLazyDeviceFuncs> GetImageMemoryRequirements2KHR;
+      VkLazyFunc<PFN_vkGetImageOpaqueCaptureDescriptorDataEXT, procaddr::DeviceFunc::GetImageOpaqueCaptureDescriptorDataEXT, VkLazyDeviceFuncs> GetImageOpaqueCaptureDescriptorDataEXT;
+      VkLazyFunc<PFN_vkGetImageSparseMemoryRequirements, procaddr::DeviceFunc::GetImageSparseMemoryRequirements, VkLazyDeviceFuncs> GetImageSparseMemoryRequirements;
+      VkLazyFunc<PFN_vkGetImageSparseMemoryRequirements2, procaddr::DeviceFunc::GetImageSparseMemoryRequirements2, VkLazyDeviceFuncs> GetImageSparseMemoryRequirements2;
+      VkLazyFunc<PFN_vkGetImageSparseMemoryRequirements2KHR, procaddr::DeviceFunc::GetImageSparseMemoryRequirements2KHR, VkLazyDeviceFuncs> GetImageSparseMemoryRequirements2KHR;
+      VkLazyFunc<PFN_vkGetImageSubresourceLayout, procaddr::DeviceFunc::GetImageSubresourceLayout, VkLazyDeviceFuncs> GetImageSubresourceLayout;
+      VkLazyFunc<PFN_vkGetImageSubresourceLayout2EXT, procaddr::DeviceFunc::GetImageSubresourceLayout2EXT, VkLazyDeviceFuncs> GetImageSubresourceLayout2EXT;
+      VkLazyFunc<PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT, procaddr::DeviceFunc::GetImageViewOpaqueCaptureDescriptorDataEXT, VkLazyDeviceFuncs> GetImageViewOpaqueCaptureDescriptorDataEXT;
+      VkLazyFunc<PFN_vkGetMemoryFdKHR, procaddr::DeviceFunc::GetMemoryFdKHR, VkLazyDeviceFuncs> GetMemoryFdKHR;
+      VkLazyFunc<PFN_vkGetMemoryFdPropertiesKHR, procaddr::DeviceFunc::GetMemoryFdPropertiesKHR, VkLazyDeviceFuncs> GetMemoryFdPropertiesKHR;
+      VkLazyFunc<PFN_vkGetMemoryHostPointerPropertiesEXT, procaddr::DeviceFunc::GetMemoryHostPointerPropertiesEXT, VkLazyDeviceFuncs> GetMemoryHostPointerPropertiesEXT;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkGetMemoryWin32HandleKHR, procaddr::DeviceFunc::GetMemoryWin32HandleKHR, VkLazyDeviceFuncs> GetMemoryWin32HandleKHR;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkGetMemoryWin32HandlePropertiesKHR, procaddr::DeviceFunc::GetMemoryWin32HandlePropertiesKHR, VkLazyDeviceFuncs> GetMemoryWin32HandlePropertiesKHR;
+#endif
+      VkLazyFunc<PFN_vkGetMicromapBuildSizesEXT, procaddr::DeviceFunc::GetMicromapBuildSizesEXT, VkLazyDeviceFuncs> GetMicromapBuildSizesEXT;
+      VkLazyFunc<PFN_vkGetPipelineCacheData, procaddr::DeviceFunc::GetPipelineCacheData, VkLazyDeviceFuncs> GetPipelineCacheData;
+      VkLazyFunc<PFN_vkGetPipelineExecutableInternalRepresentationsKHR, procaddr::DeviceFunc::GetPipelineExecutableInternalRepresentationsKHR, VkLazyDeviceFuncs> GetPipelineExecutableInternalRepresentationsKHR;
+      VkLazyFunc<PFN_vkGetPipelineExecutablePropertiesKHR, procaddr::DeviceFunc::GetPipelineExecutablePropertiesKHR, VkLazyDeviceFuncs> GetPipelineExecutablePropertiesKHR;
+      VkLazyFunc<PFN_vkGetPipelineExecutableStatisticsKHR, procaddr::DeviceFunc::GetPipelineExecutableStatisticsKHR, VkLazyDeviceFuncs> GetPipelineExecutableStatisticsKHR;
+      VkLazyFunc<PFN_vkGetPipelinePropertiesEXT, procaddr::DeviceFunc::GetPipelinePropertiesEXT, VkLazyDeviceFuncs> GetPipelinePropertiesEXT;
+      VkLazyFunc<PFN_vkGetPrivateData, procaddr::DeviceFunc::GetPrivateData, VkLazyDeviceFuncs> GetPrivateData;
+      VkLazyFunc<PFN_vkGetPrivateDataEXT, procaddr::DeviceFunc::GetPrivateDataEXT, VkLazyDeviceFuncs> GetPrivateDataEXT;
+      VkLazyFunc<PFN_vkGetQueryPoolResults, procaddr::DeviceFunc::GetQueryPoolResults, VkLazyDeviceFuncs> GetQueryPoolResults;
+      VkLazyFunc<PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR, procaddr::DeviceFunc::GetRayTracingCaptureReplayShaderGroupHandlesKHR, VkLazyDeviceFuncs> GetRayTracingCaptureReplayShaderGroupHandlesKHR;
+      VkLazyFunc<PFN_vkGetRayTracingShaderGroupHandlesKHR, procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesKHR, VkLazyDeviceFuncs> GetRayTracingShaderGroupHandlesKHR;
+      VkLazyFunc<PFN_vkGetRayTracingShaderGroupStackSizeKHR, procaddr::DeviceFunc::GetRayTracingShaderGroupStackSizeKHR, VkLazyDeviceFuncs> GetRayTracingShaderGroupStackSizeKHR;
+      VkLazyFunc<PFN_vkGetRenderAreaGranularity, procaddr::DeviceFunc::GetRenderAreaGranularity, VkLazyDeviceFuncs> GetRenderAreaGranularity;
+      VkLazyFunc<PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT, procaddr::DeviceFunc::GetSamplerOpaqueCaptureDescriptorDataEXT, VkLazyDeviceFuncs> GetSamplerOpaqueCaptureDescriptorDataEXT;
+      VkLazyFunc<PFN_vkGetSemaphoreFdKHR, procaddr::DeviceFunc::GetSemaphoreFdKHR, VkLazyDeviceFuncs> GetSemaphoreFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkGetSemaphoreWin32HandleKHR, procaddr::DeviceFunc::GetSemaphoreWin32HandleKHR, VkLazyDeviceFuncs> GetSemaphoreWin32HandleKHR;
+#endif
+      VkLazyFunc<PFN_vkGetShaderBinaryDataEXT, procaddr::DeviceFunc::GetShaderBinaryDataEXT, VkLazyDeviceFuncs> GetShaderBinaryDataEXT;
+      VkLazyFunc<PFN_vkGetShaderModuleCreateInfoIdentifierEXT, procaddr::DeviceFunc::GetShaderModuleCreateInfoIdentifierEXT, VkLazyDeviceFuncs> GetShaderModuleCreateInfoIdentifierEXT;
+      VkLazyFunc<PFN_vkGetShaderModuleIdentifierEXT, procaddr::DeviceFunc::GetShaderModuleIdentifierEXT, VkLazyDeviceFuncs> GetShaderModuleIdentifierEXT;
+      VkLazyFunc<PFN_vkGetSwapchainCounterEXT, procaddr::DeviceFunc::GetSwapchainCounterEXT, VkLazyDeviceFuncs> GetSwapchainCounterEXT;
+      VkLazyFunc<PFN_vkGetSwapchainImagesKHR, procaddr::DeviceFunc::GetSwapchainImagesKHR, VkLazyDeviceFuncs> GetSwapchainImagesKHR;
+      VkLazyFunc<PFN_vkGetSwapchainStatusKHR, procaddr::DeviceFunc::GetSwapchainStatusKHR, VkLazyDeviceFuncs> GetSwapchainStatusKHR;
+      VkLazyFunc<PFN_vkGetValidationCacheDataEXT, procaddr::DeviceFunc::GetValidationCacheDataEXT, VkLazyDeviceFuncs> GetValidationCacheDataEXT;
+      VkLazyFunc<PFN_vkGetVideoSessionMemoryRequirementsKHR, procaddr::DeviceFunc::GetVideoSessionMemoryRequirementsKHR, VkLazyDeviceFuncs> GetVideoSessionMemoryRequirementsKHR;
+      VkLazyFunc<PFN_vkImportFenceFdKHR, procaddr::DeviceFunc::ImportFenceFdKHR, VkLazyDeviceFuncs> ImportFenceFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkImportFenceWin32HandleKHR, procaddr::DeviceFunc::ImportFenceWin32HandleKHR, VkLazyDeviceFuncs> ImportFenceWin32HandleKHR;
+#endif
+      VkLazyFunc<PFN_vkImportSemaphoreFdKHR, procaddr::DeviceFunc::ImportSemaphoreFdKHR, VkLazyDeviceFuncs> ImportSemaphoreFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkImportSemaphoreWin32HandleKHR, procaddr::DeviceFunc::ImportSemaphoreWin32HandleKHR, VkLazyDeviceFuncs> ImportSemaphoreWin32HandleKHR;
+#endif
+      VkLazyFunc<PFN_vkInvalidateMappedMemoryRanges, procaddr::DeviceFunc::InvalidateMappedMemoryRanges, VkLazyDeviceFuncs> InvalidateMappedMemoryRanges;
+      VkLazyFunc<PFN_vkMapMemory, procaddr::DeviceFunc::MapMemory, VkLazyDeviceFuncs> MapMemory;
+      VkLazyFunc<PFN_vkMapMemory2KHR, procaddr::DeviceFunc::MapMemory2KHR, VkLazyDeviceFuncs> MapMemory2KHR;
+      VkLazyFunc<PFN_vkMergePipelineCaches, procaddr::DeviceFunc::MergePipelineCaches, VkLazyDeviceFuncs> MergePipelineCaches;
+      VkLazyFunc<PFN_vkMergeValidationCachesEXT, procaddr::DeviceFunc::MergeValidationCachesEXT, VkLazyDeviceFuncs> MergeValidationCachesEXT;
+      VkLazyFunc<PFN_vkRegisterDeviceEventEXT, procaddr::DeviceFunc::RegisterDeviceEventEXT, VkLazyDeviceFuncs> RegisterDeviceEventEXT;
+      VkLazyFunc<PFN_vkRegisterDisplayEventEXT, procaddr::DeviceFunc::RegisterDisplayEventEXT, VkLazyDeviceFuncs> RegisterDisplayEventEXT;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkReleaseFullScreenExclusiveModeEXT, procaddr::DeviceFunc::ReleaseFullScreenExclusiveModeEXT, VkLazyDeviceFuncs> ReleaseFullScreenExclusiveModeEXT;
+#endif
+      VkLazyFunc<PFN_vkReleaseProfilingLockKHR, procaddr::DeviceFunc::ReleaseProfilingLockKHR, VkLazyDeviceFuncs> ReleaseProfilingLockKHR;
+      VkLazyFunc<PFN_vkReleaseSwapchainImagesEXT, procaddr::DeviceFunc::ReleaseSwapchainImagesEXT, VkLazyDeviceFuncs> ReleaseSwapchainImagesEXT;
+      VkLazyFunc<PFN_vkResetEvent, procaddr::DeviceFunc::ResetEvent, VkLazyDeviceFuncs> ResetEvent;
+      VkLazyFunc<PFN_vkResetQueryPool, procaddr::DeviceFunc::ResetQueryPool, VkLazyDeviceFuncs> ResetQueryPool;
+      VkLazyFunc<PFN_vkResetQueryPoolEXT, procaddr::DeviceFunc::ResetQueryPoolEXT, VkLazyDeviceFuncs> ResetQueryPoolEXT;
+      VkLazyFunc<PFN_vkSetDebugUtilsObjectNameEXT, procaddr::DeviceFunc::SetDebugUtilsObjectNameEXT, VkLazyDeviceFuncs> SetDebugUtilsObjectNameEXT;
+      VkLazyFunc<PFN_vkSetDebugUtilsObjectTagEXT, procaddr::DeviceFunc::SetDebugUtilsObjectTagEXT, VkLazyDeviceFuncs> SetDebugUtilsObjectTagEXT;
+      VkLazyFunc<PFN_vkSetDeviceMemoryPriorityEXT, procaddr::DeviceFunc::SetDeviceMemoryPriorityEXT, VkLazyDeviceFuncs> SetDeviceMemoryPriorityEXT;
+      VkLazyFunc<PFN_vkSetEvent, procaddr::DeviceFunc::SetEvent, VkLazyDeviceFuncs> SetEvent;
+      VkLazyFunc<PFN_vkSetHdrMetadataEXT, procaddr::DeviceFunc::SetHdrMetadataEXT, VkLazyDeviceFuncs> SetHdrMetadataEXT;
+      VkLazyFunc<PFN_vkSetPrivateData, procaddr::DeviceFunc::SetPrivateData, VkLazyDeviceFuncs> SetPrivateData;
+      VkLazyFunc<PFN_vkSetPrivateDataEXT, procaddr::DeviceFunc::SetPrivateDataEXT, VkLazyDeviceFuncs> SetPrivateDataEXT;
+      VkLazyFunc<PFN_vkSignalSemaphoreKHR, procaddr::DeviceFunc::SignalSemaphoreKHR, VkLazyDeviceFuncs> SignalSemaphoreKHR;
+      VkLazyFunc<PFN_vkTrimCommandPool, procaddr::DeviceFunc::TrimCommandPool, VkLazyDeviceFuncs> TrimCommandPool;
+      VkLazyFunc<PFN_vkTrimCommandPoolKHR, procaddr::DeviceFunc::TrimCommandPoolKHR, VkLazyDeviceFuncs> TrimCommandPoolKHR;
+      VkLazyFunc<PFN_vkUnmapMemory, procaddr::DeviceFunc::UnmapMemory, VkLazyDeviceFuncs> UnmapMemory;
+      VkLazyFunc<PFN_vkUnmapMemory2KHR, procaddr::DeviceFunc::UnmapMemory2KHR, VkLazyDeviceFuncs> UnmapMemory2KHR;
+      VkLazyFunc<PFN_vkUpdateDescriptorSetWithTemplate, procaddr::DeviceFunc::UpdateDescriptorSetWithTemplate, VkLazyDeviceFuncs> UpdateDescriptorSetWithTemplate;
+      VkLazyFunc<PFN_vkUpdateDescriptorSetWithTemplateKHR, procaddr::DeviceFunc::UpdateDescriptorSetWithTemplateKHR, VkLazyDeviceFuncs> UpdateDescriptorSetWithTemplateKHR;
+      VkLazyFunc<PFN_vkUpdateVideoSessionParametersKHR, procaddr::DeviceFunc::UpdateVideoSessionParametersKHR, VkLazyDeviceFuncs> UpdateVideoSessionParametersKHR;
+      VkLazyFunc<PFN_vkWaitForPresentKHR, procaddr::DeviceFunc::WaitForPresentKHR, VkLazyDeviceFuncs> WaitForPresentKHR;
+      VkLazyFunc<PFN_vkWriteAccelerationStructuresPropertiesKHR, procaddr::DeviceFunc::WriteAccelerationStructuresPropertiesKHR, VkLazyDeviceFuncs> WriteAccelerationStructuresPropertiesKHR;
+      VkLazyFunc<PFN_vkWriteMicromapsPropertiesEXT, procaddr::DeviceFunc::WriteMicromapsPropertiesEXT, VkLazyDeviceFuncs> WriteMicromapsPropertiesEXT;
+      VkLazyFunc<PFN_vkAcquirePerformanceConfigurationINTEL, procaddr::DeviceFunc::AcquirePerformanceConfigurationINTEL, VkLazyDeviceFuncs> AcquirePerformanceConfigurationINTEL;
+      VkLazyFunc<PFN_vkBindAccelerationStructureMemoryNV, procaddr::DeviceFunc::BindAccelerationStructureMemoryNV, VkLazyDeviceFuncs> BindAccelerationStructureMemoryNV;
+      VkLazyFunc<PFN_vkBindOpticalFlowSessionImageNV, procaddr::DeviceFunc::BindOpticalFlowSessionImageNV, VkLazyDeviceFuncs> BindOpticalFlowSessionImageNV;
+      VkLazyFunc<PFN_vkCmdBindInvocationMaskHUAWEI, procaddr::DeviceFunc::CmdBindInvocationMaskHUAWEI, VkLazyDeviceFuncs> CmdBindInvocationMaskHUAWEI;
+      VkLazyFunc<PFN_vkCmdBindPipelineShaderGroupNV, procaddr::DeviceFunc::CmdBindPipelineShaderGroupNV, VkLazyDeviceFuncs> CmdBindPipelineShaderGroupNV;
+      VkLazyFunc<PFN_vkCmdBindShadingRateImageNV, procaddr::DeviceFunc::CmdBindShadingRateImageNV, VkLazyDeviceFuncs> CmdBindShadingRateImageNV;
+      VkLazyFunc<PFN_vkCmdBuildAccelerationStructureNV, procaddr::DeviceFunc::CmdBuildAccelerationStructureNV, VkLazyDeviceFuncs> CmdBuildAccelerationStructureNV;
+      VkLazyFunc<PFN_vkCmdCopyAccelerationStructureNV, procaddr::DeviceFunc::CmdCopyAccelerationStructureNV, VkLazyDeviceFuncs> CmdCopyAccelerationStructureNV;
+      VkLazyFunc<PFN_vkCmdCopyMemoryIndirectNV, procaddr::DeviceFunc::CmdCopyMemoryIndirectNV, VkLazyDeviceFuncs> CmdCopyMemoryIndirectNV;
+      VkLazyFunc<PFN_vkCmdCopyMemoryToImageIndirectNV, procaddr::DeviceFunc::CmdCopyMemoryToImageIndirectNV, VkLazyDeviceFuncs> CmdCopyMemoryToImageIndirectNV;
+      VkLazyFunc<PFN_vkCmdDecompressMemoryIndirectCountNV, procaddr::DeviceFunc::CmdDecompressMemoryIndirectCountNV, VkLazyDeviceFuncs> CmdDecompressMemoryIndirectCountNV;
+      VkLazyFunc<PFN_vkCmdDecompressMemoryNV, procaddr::DeviceFunc::CmdDecompressMemoryNV, VkLazyDeviceFuncs> CmdDecompressMemoryNV;
+      VkLazyFunc<PFN_vkCmdDrawClusterHUAWEI, procaddr::DeviceFunc::CmdDrawClusterHUAWEI, VkLazyDeviceFuncs> CmdDrawClusterHUAWEI;
+      VkLazyFunc<PFN_vkCmdDrawClusterIndirectHUAWEI, procaddr::DeviceFunc::CmdDrawClusterIndirectHUAWEI, VkLazyDeviceFuncs> CmdDrawClusterIndirectHUAWEI;
+      VkLazyFunc<PFN_vkCmdDrawIndexedIndirectCountAMD, procaddr::DeviceFunc::CmdDrawIndexedIndirectCountAMD, VkLazyDeviceFuncs> CmdDrawIndexedIndirectCountAMD;
+      VkLazyFunc<PFN_vkCmdDrawIndirectCountAMD, procaddr::DeviceFunc::CmdDrawIndirectCountAMD, VkLazyDeviceFuncs> CmdDrawIndirectCountAMD;
+      VkLazyFunc<PFN_vkCmdDrawMeshTasksIndirectCountNV, procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountNV, VkLazyDeviceFuncs> CmdDrawMeshTasksIndirectCountNV;
+      VkLazyFunc<PFN_vkCmdDrawMeshTasksIndirectNV, procaddr::DeviceFunc::CmdDrawMeshTasksIndirectNV, VkLazyDeviceFuncs> CmdDrawMeshTasksIndirectNV;
+      VkLazyFunc<PFN_vkCmdDrawMeshTasksNV, procaddr::DeviceFunc::CmdDrawMeshTasksNV, VkLazyDeviceFuncs> CmdDrawMeshTasksNV;
+      VkLazyFunc<PFN_vkCmdExecuteGeneratedCommandsNV, procaddr::DeviceFunc::CmdExecuteGeneratedCommandsNV, VkLazyDeviceFuncs> CmdExecuteGeneratedCommandsNV;
+      VkLazyFunc<PFN_vkCmdOpticalFlowExecuteNV, procaddr::DeviceFunc::CmdOpticalFlowExecuteNV, VkLazyDeviceFuncs> CmdOpticalFlowExecuteNV;
+      VkLazyFunc<PFN_vkCmdPreprocessGeneratedCommandsNV, procaddr::DeviceFunc::CmdPreprocessGeneratedCommandsNV, VkLazyDeviceFuncs> CmdPreprocessGeneratedCommandsNV;
+      VkLazyFunc<PFN_vkCmdSetCheckpointNV, procaddr::DeviceFunc::CmdSetCheckpointNV, VkLazyDeviceFuncs> CmdSetCheckpointNV;
+      VkLazyFunc<PFN_vkCmdSetCoarseSampleOrderNV, procaddr::DeviceFunc::CmdSetCoarseSampleOrderNV, VkLazyDeviceFuncs> CmdSetCoarseSampleOrderNV;
+      VkLazyFunc<PFN_vkCmdSetCoverageModulationModeNV, procaddr::DeviceFunc::CmdSetCoverageModulationModeNV, VkLazyDeviceFuncs> CmdSetCoverageModulationModeNV;
+      VkLazyFunc<PFN_vkCmdSetCoverageModulationTableEnableNV, procaddr::DeviceFunc::CmdSetCoverageModulationTableEnableNV, VkLazyDeviceFuncs> CmdSetCoverageModulationTableEnableNV;
+      VkLazyFunc<PFN_vkCmdSetCoverageModulationTableNV, procaddr::DeviceFunc::CmdSetCoverageModulationTableNV, VkLazyDeviceFuncs> CmdSetCoverageModulationTableNV;
+      VkLazyFunc<PFN_vkCmdSetCoverageReductionModeNV, procaddr::DeviceFunc::CmdSetCoverageReductionModeNV, VkLazyDeviceFuncs> CmdSetCoverageReductionModeNV;
+      VkLazyFunc<PFN_vkCmdSetCoverageToColorEnableNV, procaddr::DeviceFunc::CmdSetCoverageToColorEnableNV, VkLazyDeviceFuncs> CmdSetCoverageToColorEnableNV;
+      VkLazyFunc<PFN_vkCmdSetCoverageToColorLocationNV, procaddr::DeviceFunc::CmdSetCoverageToColorLocationNV, VkLazyDeviceFuncs> CmdSetCoverageToColorLocationNV;
+      VkLazyFunc<PFN_vkCmdSetExclusiveScissorEnableNV, procaddr::DeviceFunc::CmdSetExclusiveScissorEnableNV, VkLazyDeviceFuncs> CmdSetExclusiveScissorEnableNV;
+      VkLazyFunc<PFN_vkCmdSetExclusiveScissorNV, procaddr::DeviceFunc::CmdSetExclusiveScissorNV, VkLazyDeviceFuncs> CmdSetExclusiveScissorNV;
+      VkLazyFunc<PFN_vkCmdSetFragmentShadingRateEnumNV, procaddr::DeviceFunc::CmdSetFragmentShadingRateEnumNV, VkLazyDeviceFuncs> CmdSetFragmentShadingRateEnumNV;
+      VkLazyFunc<PFN_vkCmdSetPerformanceMarkerINTEL, procaddr::DeviceFunc::CmdSetPerformanceMarkerINTEL, VkLazyDeviceFuncs> CmdSetPerformanceMarkerINTEL;
+      VkLazyFunc<PFN_vkCmdSetPerformanceOverrideINTEL, procaddr::DeviceFunc::CmdSetPerformanceOverrideINTEL, VkLazyDeviceFuncs> CmdSetPerformanceOverrideINTEL;
+      VkLazyFunc<PFN_vkCmdSetPerformanceStreamMarkerINTEL, procaddr::DeviceFunc::CmdSetPerformanceStreamMarkerINTEL, VkLazyDeviceFuncs> CmdSetPerformanceStreamMarkerINTEL;
+      VkLazyFunc<PFN_vkCmdSetRepresentativeFragmentTestEnableNV, procaddr::DeviceFunc::CmdSetRepresentativeFragmentTestEnableNV, VkLazyDeviceFuncs> CmdSetRepresentativeFragmentTestEnableNV;
+      VkLazyFunc<PFN_vkCmdSetShadingRateImageEnableNV, procaddr::DeviceFunc::CmdSetShadingRateImageEnableNV, VkLazyDeviceFuncs> CmdSetShadingRateImageEnableNV;
+      VkLazyFunc<PFN_vkCmdSetViewportShadingRatePaletteNV, procaddr::DeviceFunc::CmdSetViewportShadingRatePaletteNV, VkLazyDeviceFuncs> CmdSetViewportShadingRatePaletteNV;
+      VkLazyFunc<PFN_vkCmdSetViewportSwizzleNV, procaddr::DeviceFunc::CmdSetViewportSwizzleNV, VkLazyDeviceFuncs> CmdSetViewportSwizzleNV;
+      VkLazyFunc<PFN_vkCmdSetViewportWScalingEnableNV, procaddr::DeviceFunc::CmdSetViewportWScalingEnableNV, VkLazyDeviceFuncs> CmdSetViewportWScalingEnableNV;
+      VkLazyFunc<PFN_vkCmdSetViewportWScalingNV, procaddr::DeviceFunc::CmdSetViewportWScalingNV, VkLazyDeviceFuncs> CmdSetViewportWScalingNV;
+      VkLazyFunc<PFN_vkCmdSubpassShadingHUAWEI, procaddr::DeviceFunc::CmdSubpassShadingHUAWEI, VkLazyDeviceFuncs> CmdSubpassShadingHUAWEI;
+      VkLazyFunc<PFN_vkCmdTraceRaysNV, procaddr::DeviceFunc::CmdTraceRaysNV, VkLazyDeviceFuncs> CmdTraceRaysNV;
+      VkLazyFunc<PFN_vkCmdWriteAccelerationStructuresPropertiesNV, procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesNV, VkLazyDeviceFuncs> CmdWriteAccelerationStructuresPropertiesNV;
+      VkLazyFunc<PFN_vkCmdWriteBufferMarker2AMD, procaddr::DeviceFunc::CmdWriteBufferMarker2AMD, VkLazyDeviceFuncs> CmdWriteBufferMarker2AMD;
+      VkLazyFunc<PFN_vkCmdWriteBufferMarkerAMD, procaddr::DeviceFunc::CmdWriteBufferMarkerAMD, VkLazyDeviceFuncs> CmdWriteBufferMarkerAMD;
+      VkLazyFunc<PFN_vkCompileDeferredNV, procaddr::DeviceFunc::CompileDeferredNV, VkLazyDeviceFuncs> CompileDeferredNV;
+      VkLazyFunc<PFN_vkCreateAccelerationStructureNV, procaddr::DeviceFunc::CreateAccelerationStructureNV, VkLazyDeviceFuncs> CreateAccelerationStructureNV;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkCreateBufferCollectionFUCHSIA, procaddr::DeviceFunc::CreateBufferCollectionFUCHSIA, VkLazyDeviceFuncs> CreateBufferCollectionFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkCreateIndirectCommandsLayoutNV, procaddr::DeviceFunc::CreateIndirectCommandsLayoutNV, VkLazyDeviceFuncs> CreateIndirectCommandsLayoutNV;
+      VkLazyFunc<PFN_vkCreateOpticalFlowSessionNV, procaddr::DeviceFunc::CreateOpticalFlowSessionNV, VkLazyDeviceFuncs> CreateOpticalFlowSessionNV;
+      VkLazyFunc<PFN_vkCreateRayTracingPipelinesNV, procaddr::DeviceFunc::CreateRayTracingPipelinesNV, VkLazyDeviceFuncs> CreateRayTracingPipelinesNV;
+      VkLazyFunc<PFN_vkDestroyAccelerationStructureNV, procaddr::DeviceFunc::DestroyAccelerationStructureNV, VkLazyDeviceFuncs> DestroyAccelerationStructureNV;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkDestroyBufferCollectionFUCHSIA, procaddr::DeviceFunc::DestroyBufferCollectionFUCHSIA, VkLazyDeviceFuncs> DestroyBufferCollectionFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkDestroyIndirectCommandsLayoutNV, procaddr::DeviceFunc::DestroyIndirectCommandsLayoutNV, VkLazyDeviceFuncs> DestroyIndirectCommandsLayoutNV;
+      VkLazyFunc<PFN_vkDestroyOpticalFlowSessionNV, procaddr::DeviceFunc::DestroyOpticalFlowSessionNV, VkLazyDeviceFuncs> DestroyOpticalFlowSessionNV;
+      VkLazyFunc<PFN_vkGetAccelerationStructureHandleNV, procaddr::DeviceFunc::GetAccelerationStructureHandleNV, VkLazyDeviceFuncs> GetAccelerationStructureHandleNV;
+      VkLazyFunc<PFN_vkGetAccelerationStructureMemoryRequirementsNV, procaddr::DeviceFunc::GetAccelerationStructureMemoryRequirementsNV, VkLazyDeviceFuncs> GetAccelerationStructureMemoryRequirementsNV;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      VkLazyFunc<PFN_vkGetAndroidHardwareBufferPropertiesANDROID, procaddr::DeviceFunc::GetAndroidHardwareBufferPropertiesANDROID, VkLazyDeviceFuncs> GetAndroidHardwareBufferPropertiesANDROID;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkGetBufferCollectionPropertiesFUCHSIA, procaddr::DeviceFunc::GetBufferCollectionPropertiesFUCHSIA, VkLazyDeviceFuncs> GetBufferCollectionPropertiesFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkGetDescriptorSetHostMappingVALVE, procaddr::DeviceFunc::GetDescriptorSetHostMappingVALVE, VkLazyDeviceFuncs> GetDescriptorSetHostMappingVALVE;
+      VkLazyFunc<PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE, procaddr::DeviceFunc::GetDescriptorSetLayoutHostMappingInfoVALVE, VkLazyDeviceFuncs> GetDescriptorSetLayoutHostMappingInfoVALVE;
+      VkLazyFunc<PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI, procaddr::DeviceFunc::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI, VkLazyDeviceFuncs> GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+      VkLazyFunc<PFN_vkGetDynamicRenderingTilePropertiesQCOM, procaddr::DeviceFunc::GetDynamicRenderingTilePropertiesQCOM, VkLazyDeviceFuncs> GetDynamicRenderingTilePropertiesQCOM;
+      VkLazyFunc<PFN_vkGetFramebufferTilePropertiesQCOM, procaddr::DeviceFunc::GetFramebufferTilePropertiesQCOM, VkLazyDeviceFuncs> GetFramebufferTilePropertiesQCOM;
+      VkLazyFunc<PFN_vkGetGeneratedCommandsMemoryRequirementsNV, procaddr::DeviceFunc::GetGeneratedCommandsMemoryRequirementsNV, VkLazyDeviceFuncs> GetGeneratedCommandsMemoryRequirementsNV;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      VkLazyFunc<PFN_vkGetMemoryAndroidHardwareBufferANDROID, procaddr::DeviceFunc::GetMemoryAndroidHardwareBufferANDROID, VkLazyDeviceFuncs> GetMemoryAndroidHardwareBufferANDROID;
+#endif
+      VkLazyFunc<PFN_vkGetMemoryRemoteAddressNV, procaddr::DeviceFunc::GetMemoryRemoteAddressNV, VkLazyDeviceFuncs> GetMemoryRemoteAddressNV;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      VkLazyFunc<PFN_vkGetMemoryWin32HandleNV, procaddr::DeviceFunc::GetMemoryWin32HandleNV, VkLazyDeviceFuncs> GetMemoryWin32HandleNV;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkGetMemoryZirconHandleFUCHSIA, procaddr::DeviceFunc::GetMemoryZirconHandleFUCHSIA, VkLazyDeviceFuncs> GetMemoryZirconHandleFUCHSIA;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA, procaddr::DeviceFunc::GetMemoryZirconHandlePropertiesFUCHSIA, VkLazyDeviceFuncs> GetMemoryZirconHandlePropertiesFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkGetPastPresentationTimingGOOGLE, procaddr::DeviceFunc::GetPastPresentationTimingGOOGLE, VkLazyDeviceFuncs> GetPastPresentationTimingGOOGLE;
+      VkLazyFunc<PFN_vkGetPerformanceParameterINTEL, procaddr::DeviceFunc::GetPerformanceParameterINTEL, VkLazyDeviceFuncs> GetPerformanceParameterINTEL;
+      VkLazyFunc<PFN_vkGetQueueCheckpointData2NV, procaddr::DeviceFunc::GetQueueCheckpointData2NV, VkLazyDeviceFuncs> GetQueueCheckpointData2NV;
+      VkLazyFunc<PFN_vkGetQueueCheckpointDataNV, procaddr::DeviceFunc::GetQueueCheckpointDataNV, VkLazyDeviceFuncs> GetQueueCheckpointDataNV;
+      VkLazyFunc<PFN_vkGetRayTracingShaderGroupHandlesNV, procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesNV, VkLazyDeviceFuncs> GetRayTracingShaderGroupHandlesNV;
+      VkLazyFunc<PFN_vkGetRefreshCycleDurationGOOGLE, procaddr::DeviceFunc::GetRefreshCycleDurationGOOGLE, VkLazyDeviceFuncs> GetRefreshCycleDurationGOOGLE;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkGetSemaphoreZirconHandleFUCHSIA, procaddr::DeviceFunc::GetSemaphoreZirconHandleFUCHSIA, VkLazyDeviceFuncs> GetSemaphoreZirconHandleFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkGetShaderInfoAMD, procaddr::DeviceFunc::GetShaderInfoAMD, VkLazyDeviceFuncs> GetShaderInfoAMD;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkImportSemaphoreZirconHandleFUCHSIA, procaddr::DeviceFunc::ImportSemaphoreZirconHandleFUCHSIA, VkLazyDeviceFuncs> ImportSemaphoreZirconHandleFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkInitializePerformanceApiINTEL, procaddr::DeviceFunc::InitializePerformanceApiINTEL, VkLazyDeviceFuncs> InitializePerformanceApiINTEL;
+      VkLazyFunc<PFN_vkQueueSetPerformanceConfigurationINTEL, procaddr::DeviceFunc::QueueSetPerformanceConfigurationINTEL, VkLazyDeviceFuncs> QueueSetPerformanceConfigurationINTEL;
+      VkLazyFunc<PFN_vkReleasePerformanceConfigurationINTEL, procaddr::DeviceFunc::ReleasePerformanceConfigurationINTEL, VkLazyDeviceFuncs> ReleasePerformanceConfigurationINTEL;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA, procaddr::DeviceFunc::SetBufferCollectionBufferConstraintsFUCHSIA, VkLazyDeviceFuncs> SetBufferCollectionBufferConstraintsFUCHSIA;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      VkLazyFunc<PFN_vkSetBufferCollectionImageConstraintsFUCHSIA, procaddr::DeviceFunc::SetBufferCollectionImageConstraintsFUCHSIA, VkLazyDeviceFuncs> SetBufferCollectionImageConstraintsFUCHSIA;
+#endif
+      VkLazyFunc<PFN_vkSetLocalDimmingAMD, procaddr::DeviceFunc::SetLocalDimmingAMD, VkLazyDeviceFuncs> SetLocalDimmingAMD;
+      VkLazyFunc<PFN_vkUninitializePerformanceApiINTEL, procaddr::DeviceFunc::UninitializePerformanceApiINTEL, VkLazyDeviceFuncs> UninitializePerformanceApiINTEL;
+      VkLazyResolver LazyResolver;
+
+      static constexpr size_t Offset(procaddr::DeviceFunc func) {
+        switch (func) {
+          case procaddr::DeviceFunc::AcquireNextImage2KHR: return offsetof(VkLazyDeviceFuncs, AcquireNextImage2KHR);
+          case procaddr::DeviceFunc::AcquireNextImageKHR: return offsetof(VkLazyDeviceFuncs, AcquireNextImageKHR);
+          case procaddr::DeviceFunc::AllocateDescriptorSets: return offsetof(VkLazyDeviceFuncs, AllocateDescriptorSets);
+          case procaddr::DeviceFunc::BeginCommandBuffer: return offsetof(VkLazyDeviceFuncs, BeginCommandBuffer);
+          case procaddr::DeviceFunc::CmdBeginQuery: return offsetof(VkLazyDeviceFuncs, CmdBeginQuery);
+          case procaddr::DeviceFunc::CmdBeginRenderPass: return offsetof(VkLazyDeviceFuncs, CmdBeginRenderPass);
+          case procaddr::DeviceFunc::CmdBeginRenderPass2: return offsetof(VkLazyDeviceFuncs, CmdBeginRenderPass2);
+          case procaddr::DeviceFunc::CmdBeginRendering: return offsetof(VkLazyDeviceFuncs, CmdBeginRendering);
+          case procaddr::DeviceFunc::CmdBeginRenderingKHR: return offsetof(VkLazyDeviceFuncs, CmdBeginRenderingKHR);
+          case procaddr::DeviceFunc::CmdBindDescriptorSets: return offsetof(VkLazyDeviceFuncs, CmdBindDescriptorSets);
+          case procaddr::DeviceFunc::CmdBindIndexBuffer: return offsetof(VkLazyDeviceFuncs, CmdBindIndexBuffer);
+          case procaddr::DeviceFunc::CmdBindPipeline: return offsetof(VkLazyDeviceFuncs, CmdBindPipeline);
+          case procaddr::DeviceFunc::CmdBindVertexBuffers: return offsetof(VkLazyDeviceFuncs, CmdBindVertexBuffers);
+          case procaddr::DeviceFunc::CmdBlitImage: return offsetof(VkLazyDeviceFuncs, CmdBlitImage);
+          case procaddr::DeviceFunc::CmdClearAttachments: return offsetof(VkLazyDeviceFuncs, CmdClearAttachments);
+          case procaddr::DeviceFunc::CmdClearColorImage: return offsetof(VkLazyDeviceFuncs, CmdClearColorImage);
+          case procaddr::DeviceFunc::CmdCopyBuffer: return offsetof(VkLazyDeviceFuncs, CmdCopyBuffer);
+          case procaddr::DeviceFunc::CmdCopyBufferToImage: return offsetof(VkLazyDeviceFuncs, CmdCopyBufferToImage);
+          case procaddr::DeviceFunc::CmdCopyImage: return offsetof(VkLazyDeviceFuncs, CmdCopyImage);
+          case procaddr::DeviceFunc::CmdDispatch: return offsetof(VkLazyDeviceFuncs, CmdDispatch);
+          case procaddr::DeviceFunc::CmdDispatchIndirect: return offsetof(VkLazyDeviceFuncs, CmdDispatchIndirect);
+          case procaddr::DeviceFunc::CmdDraw: return offsetof(VkLazyDeviceFuncs, CmdDraw);
+          case procaddr::DeviceFunc::CmdDrawIndexed: return offsetof(VkLazyDeviceFuncs, CmdDrawIndexed);
+          case procaddr::DeviceFunc::CmdDrawIndexedIndirect: return offsetof(VkLazyDeviceFuncs, CmdDrawIndexedIndirect);
+          case procaddr::DeviceFunc::CmdDrawIndexedIndirectCount: return offsetof(VkLazyDeviceFuncs, CmdDrawIndexedIndirectCount);
+          case procaddr::DeviceFunc::CmdDrawIndirect: return offsetof(VkLazyDeviceFuncs, CmdDrawIndirect);
+          case procaddr::DeviceFunc::CmdDrawIndirectCount: return offsetof(VkLazyDeviceFuncs, CmdDrawIndirectCount);
+          case procaddr::DeviceFunc::CmdEndQuery: return offsetof(VkLazyDeviceFuncs, CmdEndQuery);
+          case procaddr::DeviceFunc::CmdEndRenderPass: return offsetof(VkLazyDeviceFuncs, CmdEndRenderPass);
+          case procaddr::DeviceFunc::CmdEndRenderPass2: return offsetof(VkLazyDeviceFuncs, CmdEndRenderPass2);
+          case procaddr::DeviceFunc::CmdEndRendering: return offsetof(VkLazyDeviceFuncs, CmdEndRendering);
+          case procaddr::DeviceFunc::CmdEndRenderingKHR: return offsetof(VkLazyDeviceFuncs, CmdEndRenderingKHR);
+          case procaddr::DeviceFunc::CmdExecuteCommands: return offsetof(VkLazyDeviceFuncs, CmdExecuteCommands);
+          case procaddr::DeviceFunc::CmdNextSubpass: return offsetof(VkLazyDeviceFuncs, CmdNextSubpass);
+          case procaddr::DeviceFunc::CmdPipelineBarrier: return offsetof(VkLazyDeviceFuncs, CmdPipelineBarrier);
+          case procaddr::DeviceFunc::CmdPipelineBarrier2: return offsetof(VkLazyDeviceFuncs, CmdPipelineBarrier2);
+          case procaddr::DeviceFunc::CmdPipelineBarrier2KHR: return offsetof(VkLazyDeviceFuncs, CmdPipelineBarrier2KHR);
+          case procaddr::DeviceFunc::CmdPushConstants: return offsetof(VkLazyDeviceFuncs, CmdPushConstants);
+          case procaddr::DeviceFunc::CmdPushDescriptorSetKHR: return offsetof(VkLazyDeviceFuncs, CmdPushDescriptorSetKHR);
+          case procaddr::DeviceFunc::CmdResetQueryPool: return offsetof(VkLazyDeviceFuncs, CmdResetQueryPool);
+          case procaddr::DeviceFunc::CmdSetEvent: return offsetof(VkLazyDeviceFuncs, CmdSetEvent);
+          case procaddr::DeviceFunc::CmdSetScissor: return offsetof(VkLazyDeviceFuncs, CmdSetScissor);
+          case procaddr::DeviceFunc::CmdSetViewport: return offsetof(VkLazyDeviceFuncs, CmdSetViewport);
+          case procaddr::DeviceFunc::CmdWaitEvents: return offsetof(VkLazyDeviceFuncs, CmdWaitEvents);
+          case procaddr::DeviceFunc::CmdWriteTimestamp: return offsetof(VkLazyDeviceFuncs, CmdWriteTimestamp);
+          case procaddr::DeviceFunc::EndCommandBuffer: return offsetof(VkLazyDeviceFuncs, EndCommandBuffer);
+          case procaddr::DeviceFunc::GetFenceStatus: return offsetof(VkLazyDeviceFuncs, GetFenceStatus);
+          case procaddr::DeviceFunc::GetSemaphoreCounterValue: return offsetof(VkLazyDeviceFuncs, GetSemaphoreCounterValue);
+          case procaddr::DeviceFunc::GetSemaphoreCounterValueKHR: return offsetof(VkLazyDeviceFuncs, GetSemaphoreCounterValueKHR);
+          case procaddr::DeviceFunc::QueuePresentKHR: return offsetof(VkLazyDeviceFuncs, QueuePresentKHR);
+          case procaddr::DeviceFunc::QueueSubmit: return offsetof(VkLazyDeviceFuncs, QueueSubmit);
+          case procaddr::DeviceFunc::QueueSubmit2: return offsetof(VkLazyDeviceFuncs, QueueSubmit2);
+          case procaddr::DeviceFunc::QueueSubmit2KHR: return offsetof(VkLazyDeviceFuncs, QueueSubmit2KHR);
+          case procaddr::DeviceFunc::ResetCommandBuffer: return offsetof(VkLazyDeviceFuncs, ResetCommandBuffer);
+          case procaddr::DeviceFunc::ResetCommandPool: return offsetof(VkLazyDeviceFuncs, ResetCommandPool);
+          case procaddr::DeviceFunc::ResetDescriptorPool: return offsetof(VkLazyDeviceFuncs, ResetDescriptorPool);
+          case procaddr::DeviceFunc::ResetFences: return offsetof(VkLazyDeviceFuncs, ResetFences);
+          case procaddr::DeviceFunc::SignalSemaphore: return offsetof(VkLazyDeviceFuncs, SignalSemaphore);
+          case procaddr::DeviceFunc::UpdateDescriptorSets: return offsetof(VkLazyDeviceFuncs, UpdateDescriptorSets);
+          case procaddr::DeviceFunc::WaitForFences: return offsetof(VkLazyDeviceFuncs, WaitForFences);
+          case procaddr::DeviceFunc::WaitSemaphores: return offsetof(VkLazyDeviceFuncs, WaitSemaphores);
+          case procaddr::DeviceFunc::WaitSemaphoresKHR: return offsetof(VkLazyDeviceFuncs, WaitSemaphoresKHR);
+          case procaddr::DeviceFunc::CmdBeginConditionalRenderingEXT: return offsetof(VkLazyDeviceFuncs, CmdBeginConditionalRenderingEXT);
+          case procaddr::DeviceFunc::CmdBeginDebugUtilsLabelEXT: return offsetof(VkLazyDeviceFuncs, CmdBeginDebugUtilsLabelEXT);
+          case procaddr::DeviceFunc::CmdBeginQueryIndexedEXT: return offsetof(VkLazyDeviceFuncs, CmdBeginQueryIndexedEXT);
+          case procaddr::DeviceFunc::CmdBeginRenderPass2KHR: return offsetof(VkLazyDeviceFuncs, CmdBeginRenderPass2KHR);
+          case procaddr::DeviceFunc::CmdBeginTransformFeedbackEXT: return offsetof(VkLazyDeviceFuncs, CmdBeginTransformFeedbackEXT);
+          case procaddr::DeviceFunc::CmdBeginVideoCodingKHR: return offsetof(VkLazyDeviceFuncs, CmdBeginVideoCodingKHR);
+          case procaddr::DeviceFunc::CmdBindDescriptorBufferEmbeddedSamplersEXT: return offsetof(VkLazyDeviceFuncs, CmdBindDescriptorBufferEmbeddedSamplersEXT);
+          case procaddr::DeviceFunc::CmdBindDescriptorBuffersEXT: return offsetof(VkLazyDeviceFuncs, CmdBindDescriptorBuffersEXT);
+          case procaddr::DeviceFunc::CmdBindShadersEXT: return offsetof(VkLazyDeviceFuncs, CmdBindShadersEXT);
+          case procaddr::DeviceFunc::CmdBindTransformFeedbackBuffersEXT: return offsetof(VkLazyDeviceFuncs, CmdBindTransformFeedbackBuffersEXT);
+          case procaddr::DeviceFunc::CmdBindVertexBuffers2: return offsetof(VkLazyDeviceFuncs, CmdBindVertexBuffers2);
+          case procaddr::DeviceFunc::CmdBindVertexBuffers2EXT: return offsetof(VkLazyDeviceFuncs, CmdBindVertexBuffers2EXT);
+          case procaddr::DeviceFunc::CmdBlitImage2: return offsetof(VkLazyDeviceFuncs, CmdBlitImage2);
+          case procaddr::DeviceFunc::CmdBlitImage2KHR: return offsetof(VkLazyDeviceFuncs, CmdBlitImage2KHR);
+          case procaddr::DeviceFunc::CmdBuildAccelerationStructuresIndirectKHR: return offsetof(VkLazyDeviceFuncs, CmdBuildAccelerationStructuresIndirectKHR);
+          case procaddr::DeviceFunc::CmdBuildAccelerationStructuresKHR: return offsetof(VkLazyDeviceFuncs, CmdBuildAccelerationStructuresKHR);
+          case procaddr::DeviceFunc::CmdBuildMicromapsEXT: return offsetof(VkLazyDeviceFuncs, CmdBuildMicromapsEXT);
+          case procaddr::DeviceFunc::CmdClearDepthStencilImage: return offsetof(VkLazyDeviceFuncs, CmdClearDepthStencilImage);
+          case procaddr::DeviceFunc::CmdControlVideoCodingKHR: return offsetof(VkLazyDeviceFuncs, CmdControlVideoCodingKHR);
+          case procaddr::DeviceFunc::CmdCopyAccelerationStructureKHR: return offsetof(VkLazyDeviceFuncs, CmdCopyAccelerationStructureKHR);
+          case procaddr::DeviceFunc::CmdCopyAccelerationStructureToMemoryKHR: return offsetof(VkLazyDeviceFuncs, CmdCopyAccelerationStructureToMemoryKHR);
+          case procaddr::DeviceFunc::CmdCopyBuffer2: return offsetof(VkLazyDeviceFuncs, CmdCopyBuffer2);
+          case procaddr::DeviceFunc::CmdCopyBuffer2KHR: return offsetof(VkLazyDeviceFuncs, CmdCopyBuffer2KHR);
+          case procaddr::DeviceFunc::CmdCopyBufferToImage2: return offsetof(VkLazyDeviceFuncs, CmdCopyBufferToImage2);
+          case procaddr::DeviceFunc::CmdCopyBufferToImage2KHR: return offsetof(VkLazyDeviceFuncs, CmdCopyBufferToImage2KHR);
+          case procaddr::DeviceFunc::CmdCopyImage2: return offsetof(VkLazyDeviceFuncs, CmdCopyImage2);
+          case procaddr::DeviceFunc::CmdCopyImage2KHR: return offsetof(VkLazyDeviceFuncs, CmdCopyImage2KHR);
+          case procaddr::DeviceFunc::CmdCopyImageToBuffer: return offsetof(VkLazyDeviceFuncs, CmdCopyImageToBuffer);
+          case procaddr::DeviceFunc::CmdCopyImageToBuffer2: return offsetof(VkLazyDeviceFuncs, CmdCopyImageToBuffer2);
+          case procaddr::DeviceFunc::CmdCopyImageToBuffer2KHR: return offsetof(VkLazyDeviceFuncs, CmdCopyImageToBuffer2KHR);
+          case procaddr::DeviceFunc::CmdCopyMemoryToAccelerationStructureKHR: return offsetof(VkLazyDeviceFuncs, CmdCopyMemoryToAccelerationStructureKHR);
+          case procaddr::DeviceFunc::CmdCopyMemoryToMicromapEXT: return offsetof(VkLazyDeviceFuncs, CmdCopyMemoryToMicromapEXT);
+          case procaddr::DeviceFunc::CmdCopyMicromapEXT: return offsetof(VkLazyDeviceFuncs, CmdCopyMicromapEXT);
+          case procaddr::DeviceFunc::CmdCopyMicromapToMemoryEXT: return offsetof(VkLazyDeviceFuncs, CmdCopyMicromapToMemoryEXT);
+          case procaddr::DeviceFunc::CmdCopyQueryPoolResults: return offsetof(VkLazyDeviceFuncs, CmdCopyQueryPoolResults);
+          case procaddr::DeviceFunc::CmdDebugMarkerBeginEXT: return offsetof(VkLazyDeviceFuncs, CmdDebugMarkerBeginEXT);
+          case procaddr::DeviceFunc::CmdDebugMarkerEndEXT: return offsetof(VkLazyDeviceFuncs, CmdDebugMarkerEndEXT);
+          case procaddr::DeviceFunc::CmdDebugMarkerInsertEXT: return offsetof(VkLazyDeviceFuncs, CmdDebugMarkerInsertEXT);
+          case procaddr::DeviceFunc::CmdDecodeVideoKHR: return offsetof(VkLazyDeviceFuncs, CmdDecodeVideoKHR);
+          case procaddr::DeviceFunc::CmdDispatchBase: return offsetof(VkLazyDeviceFuncs, CmdDispatchBase);
+          case procaddr::DeviceFunc::CmdDispatchBaseKHR: return offsetof(VkLazyDeviceFuncs, CmdDispatchBaseKHR);
+          case procaddr::DeviceFunc::CmdDrawIndexedIndirectCountKHR: return offsetof(VkLazyDeviceFuncs, CmdDrawIndexedIndirectCountKHR);
+          case procaddr::DeviceFunc::CmdDrawIndirectByteCountEXT: return offsetof(VkLazyDeviceFuncs, CmdDrawIndirectByteCountEXT);
+          case procaddr::DeviceFunc::CmdDrawIndirectCountKHR: return offsetof(VkLazyDeviceFuncs, CmdDrawIndirectCountKHR);
+          case procaddr::DeviceFunc::CmdDrawMeshTasksEXT: return offsetof(VkLazyDeviceFuncs, CmdDrawMeshTasksEXT);
+          case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountEXT: return offsetof(VkLazyDeviceFuncs, CmdDrawMeshTasksIndirectCountEXT);
+          case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectEXT: return offsetof(VkLazyDeviceFuncs, CmdDrawMeshTasksIndirectEXT);
+          case procaddr::DeviceFunc::CmdDrawMultiEXT: return offsetof(VkLazyDeviceFuncs, CmdDrawMultiEXT);
+          case procaddr::DeviceFunc::CmdDrawMultiIndexedEXT: return offsetof(VkLazyDeviceFuncs, CmdDrawMultiIndexedEXT);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+          case procaddr::DeviceFunc::CmdEncodeVideoKHR: return offsetof(VkLazyDeviceFuncs, CmdEncodeVideoKHR);
+#endif
+          case procaddr::DeviceFunc::CmdEndConditionalRenderingEXT: return offsetof(VkLazyDeviceFuncs, CmdEndConditionalRenderingEXT);
+          case procaddr::DeviceFunc::CmdEndDebugUtilsLabelEXT: return offsetof(VkLazyDeviceFuncs, CmdEndDebugUtilsLabelEXT);
+          case procaddr::DeviceFunc::CmdEndQueryIndexedEXT: return offsetof(VkLazyDeviceFuncs, CmdEndQueryIndexedEXT);
+          case procaddr::DeviceFunc::CmdEndRenderPass2KHR: return offsetof(VkLazyDeviceFuncs, CmdEndRenderPass2KHR);
+          case procaddr::DeviceFunc::CmdEndTransformFeedbackEXT: return offsetof(VkLazyDeviceFuncs, CmdEndTransformFeedbackEXT);
+          case procaddr::DeviceFunc::CmdEndVideoCodingKHR: return offsetof(VkLazyDeviceFuncs, CmdEndVideoCodingKHR);
+          case procaddr::DeviceFunc::CmdFillBuffer: return offsetof(VkLazyDeviceFuncs, CmdFillBuffer);
+          case procaddr::DeviceFunc::CmdInsertDebugUtilsLabelEXT: return offsetof(VkLazyDeviceFuncs, CmdInsertDebugUtilsLabelEXT);
+          case procaddr::DeviceFunc::CmdNextSubpass2: return offsetof(VkLazyDeviceFuncs, CmdNextSubpass2);
+          case procaddr::DeviceFunc::CmdNextSubpass2KHR: return offsetof(VkLazyDeviceFuncs, CmdNextSubpass2KHR);
+          case procaddr::DeviceFunc::CmdPushDescriptorSetWithTemplateKHR: return offsetof(VkLazyDeviceFuncs, CmdPushDescriptorSetWithTemplateKHR);
+          case procaddr::DeviceFunc::CmdResetEvent: return offsetof(VkLazyDeviceFuncs, CmdResetEvent);
+          case procaddr::DeviceFunc::CmdResetEvent2: return offsetof(VkLazyDeviceFuncs, CmdResetEvent2);
+          case procaddr::DeviceFunc::CmdResetEvent2KHR: return offsetof(VkLazyDeviceFuncs, CmdResetEvent2KHR);
+          case procaddr::DeviceFunc::CmdResolveImage: return offsetof(VkLazyDeviceFuncs, CmdResolveImage);
+          case procaddr::DeviceFunc::CmdResolveImage2: return offsetof(VkLazyDeviceFuncs, CmdResolveImage2);
+          case procaddr::DeviceFunc::CmdResolveImage2KHR: return offsetof(VkLazyDeviceFuncs, CmdResolveImage2KHR);
+          case procaddr::DeviceFunc::CmdSetAlphaToCoverageEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetAlphaToCoverageEnableEXT);
+          case procaddr::DeviceFunc::CmdSetAlphaToOneEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetAlphaToOneEnableEXT);
+          case procaddr::DeviceFunc::CmdSetAttachmentFeedbackLoopEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetAttachmentFeedbackLoopEnableEXT);
+          case procaddr::DeviceFunc::CmdSetBlendConstants: return offsetof(VkLazyDeviceFuncs, CmdSetBlendConstants);
+          case procaddr::DeviceFunc::CmdSetColorBlendAdvancedEXT: return offsetof(VkLazyDeviceFuncs, CmdSetColorBlendAdvancedEXT);
+          case procaddr::DeviceFunc::CmdSetColorBlendEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetColorBlendEnableEXT);
+          case procaddr::DeviceFunc::CmdSetColorBlendEquationEXT: return offsetof(VkLazyDeviceFuncs, CmdSetColorBlendEquationEXT);
+          case procaddr::DeviceFunc::CmdSetColorWriteEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetColorWriteEnableEXT);
+          case procaddr::DeviceFunc::CmdSetColorWriteMaskEXT: return offsetof(VkLazyDeviceFuncs, CmdSetColorWriteMaskEXT);
+          case procaddr::DeviceFunc::CmdSetConservativeRasterizationModeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetConservativeRasterizationModeEXT);
+          case procaddr::DeviceFunc::CmdSetCullMode: return offsetof(VkLazyDeviceFuncs, CmdSetCullMode);
+          case procaddr::DeviceFunc::CmdSetCullModeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetCullModeEXT);
+          case procaddr::DeviceFunc::CmdSetDepthBias: return offsetof(VkLazyDeviceFuncs, CmdSetDepthBias);
+          case procaddr::DeviceFunc::CmdSetDepthBiasEnable: return offsetof(VkLazyDeviceFuncs, CmdSetDepthBiasEnable);
+          case procaddr::DeviceFunc::CmdSetDepthBiasEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthBiasEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDepthBounds: return offsetof(VkLazyDeviceFuncs, CmdSetDepthBounds);
+          case procaddr::DeviceFunc::CmdSetDepthBoundsTestEnable: return offsetof(VkLazyDeviceFuncs, CmdSetDepthBoundsTestEnable);
+          case procaddr::DeviceFunc::CmdSetDepthBoundsTestEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthBoundsTestEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDepthClampEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthClampEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDepthClipEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthClipEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDepthClipNegativeOneToOneEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthClipNegativeOneToOneEXT);
+          case procaddr::DeviceFunc::CmdSetDepthCompareOp: return offsetof(VkLazyDeviceFuncs, CmdSetDepthCompareOp);
+          case procaddr::DeviceFunc::CmdSetDepthCompareOpEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthCompareOpEXT);
+          case procaddr::DeviceFunc::CmdSetDepthTestEnable: return offsetof(VkLazyDeviceFuncs, CmdSetDepthTestEnable);
+          case procaddr::DeviceFunc::CmdSetDepthTestEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthTestEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDepthWriteEnable: return offsetof(VkLazyDeviceFuncs, CmdSetDepthWriteEnable);
+          case procaddr::DeviceFunc::CmdSetDepthWriteEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDepthWriteEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDescriptorBufferOffsetsEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDescriptorBufferOffsetsEXT);
+          case procaddr::DeviceFunc::CmdSetDeviceMask: return offsetof(VkLazyDeviceFuncs, CmdSetDeviceMask);
+          case procaddr::DeviceFunc::CmdSetDeviceMaskKHR: return offsetof(VkLazyDeviceFuncs, CmdSetDeviceMaskKHR);
+          case procaddr::DeviceFunc::CmdSetDiscardRectangleEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDiscardRectangleEXT);
+          case procaddr::DeviceFunc::CmdSetDiscardRectangleEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDiscardRectangleEnableEXT);
+          case procaddr::DeviceFunc::CmdSetDiscardRectangleModeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetDiscardRectangleModeEXT);
+          case procaddr::DeviceFunc::CmdSetEvent2: return offsetof(VkLazyDeviceFuncs, CmdSetEvent2);
+          case procaddr::DeviceFunc::CmdSetEvent2KHR: return offsetof(VkLazyDeviceFuncs, CmdSetEvent2KHR);
+          case procaddr::DeviceFunc::CmdSetExtraPrimitiveOverestimationSizeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetExtraPrimitiveOverestimationSizeEXT);
+          case procaddr::DeviceFunc::CmdSetFragmentShadingRateKHR: return offsetof(VkLazyDeviceFuncs, CmdSetFragmentShadingRateKHR);
+          case procaddr::DeviceFunc::CmdSetFrontFace: return offsetof(VkLazyDeviceFuncs, CmdSetFrontFace);
+          case procaddr::DeviceFunc::CmdSetFrontFaceEXT: return offsetof(VkLazyDeviceFuncs, CmdSetFrontFaceEXT);
+          case procaddr::DeviceFunc::CmdSetLineRasterizationModeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetLineRasterizationModeEXT);
+          case procaddr::DeviceFunc::CmdSetLineStippleEXT: return offsetof(VkLazyDeviceFuncs, CmdSetLineStippleEXT);
+          case procaddr::DeviceFunc::CmdSetLineStippleEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetLineStippleEnableEXT);
+          case procaddr::DeviceFunc::CmdSetLineWidth: return offsetof(VkLazyDeviceFuncs, CmdSetLineWidth);
+          case procaddr::DeviceFunc::CmdSetLogicOpEXT: return offsetof(VkLazyDeviceFuncs, CmdSetLogicOpEXT);
+          case procaddr::DeviceFunc::CmdSetLogicOpEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetLogicOpEnableEXT);
+          case procaddr::DeviceFunc::CmdSetPatchControlPointsEXT: return offsetof(VkLazyDeviceFuncs, CmdSetPatchControlPointsEXT);
+          case procaddr::DeviceFunc::CmdSetPolygonModeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetPolygonModeEXT);
+          case procaddr::DeviceFunc::CmdSetPrimitiveRestartEnable: return offsetof(VkLazyDeviceFuncs, CmdSetPrimitiveRestartEnable);
+          case procaddr::DeviceFunc::CmdSetPrimitiveRestartEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetPrimitiveRestartEnableEXT);
+          case procaddr::DeviceFunc::CmdSetPrimitiveTopology: return offsetof(VkLazyDeviceFuncs, CmdSetPrimitiveTopology);
+          case procaddr::DeviceFunc::CmdSetPrimitiveTopologyEXT: return offsetof(VkLazyDeviceFuncs, CmdSetPrimitiveTopologyEXT);
+          case procaddr::DeviceFunc::CmdSetProvokingVertexModeEXT: return offsetof(VkLazyDeviceFuncs, CmdSetProvokingVertexModeEXT);
+          case procaddr::DeviceFunc::CmdSetRasterizationSamplesEXT: return offsetof(VkLazyDeviceFuncs, CmdSetRasterizationSamplesEXT);
+          case procaddr::DeviceFunc::CmdSetRasterizationStreamEXT: return offsetof(VkLazyDeviceFuncs, CmdSetRasterizationStreamEXT);
+          case procaddr::DeviceFunc::CmdSetRasterizerDiscardEnable: return offsetof(VkLazyDeviceFuncs, CmdSetRasterizerDiscardEnable);
+          case procaddr::DeviceFunc::CmdSetRasterizerDiscardEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetRasterizerDiscardEnableEXT);
+          case procaddr::DeviceFunc::CmdSetRayTracingPipelineStackSizeKHR: return offsetof(VkLazyDeviceFuncs, CmdSetRayTracingPipelineStackSizeKHR);
+          case procaddr::DeviceFunc::CmdSetSampleLocationsEXT: return offsetof(VkLazyDeviceFuncs, CmdSetSampleLocationsEXT);
+          case procaddr::DeviceFunc::CmdSetSampleLocationsEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetSampleLocationsEnableEXT);
+          case procaddr::DeviceFunc::CmdSetSampleMaskEXT: return offsetof(VkLazyDeviceFuncs, CmdSetSampleMaskEXT);
+          case procaddr::DeviceFunc::CmdSetScissorWithCount: return offsetof(VkLazyDeviceFuncs, CmdSetScissorWithCount);
+          case procaddr::DeviceFunc::CmdSetScissorWithCountEXT: return offsetof(VkLazyDeviceFuncs, CmdSetScissorWithCountEXT);
+          case procaddr::DeviceFunc::CmdSetStencilCompareMask: return offsetof(VkLazyDeviceFuncs, CmdSetStencilCompareMask);
+          case procaddr::DeviceFunc::CmdSetStencilOp: return offsetof(VkLazyDeviceFuncs, CmdSetStencilOp);
+          case procaddr::DeviceFunc::CmdSetStencilOpEXT: return offsetof(VkLazyDeviceFuncs, CmdSetStencilOpEXT);
+          case procaddr::DeviceFunc::CmdSetStencilReference: return offsetof(VkLazyDeviceFuncs, CmdSetStencilReference);
+          case procaddr::DeviceFunc::CmdSetStencilTestEnable: return offsetof(VkLazyDeviceFuncs, CmdSetStencilTestEnable);
+          case procaddr::DeviceFunc::CmdSetStencilTestEnableEXT: return offsetof(VkLazyDeviceFuncs, CmdSetStencilTestEnableEXT);
+          case procaddr::DeviceFunc::CmdSetStencilWriteMask: return offsetof(VkLazyDeviceFuncs, CmdSetStencilWriteMask);
+          case procaddr::DeviceFunc::CmdSetTessellationDomainOriginEXT: return offsetof(VkLazyDeviceFuncs, CmdSetTessellationDomainOriginEXT);
+          case procaddr::DeviceFunc::CmdSetVertexInputEXT: return offsetof(VkLazyDeviceFuncs, CmdSetVertexInputEXT);
+          case procaddr::DeviceFunc::CmdSetViewportWithCount: return offsetof(VkLazyDeviceFuncs, CmdSetViewportWithCount);
+          case procaddr::DeviceFunc::CmdSetViewportWithCountEXT: return offsetof(VkLazyDeviceFuncs, CmdSetViewportWithCountEXT);
+          case procaddr::DeviceFunc::CmdTraceRaysIndirect2KHR: return offsetof(VkLazyDeviceFuncs, CmdTraceRaysIndirect2KHR);
+          case procaddr::DeviceFunc::CmdTraceRaysIndirectKHR: return offsetof(VkLazyDeviceFuncs, CmdTraceRaysIndirectKHR);
+          case procaddr::DeviceFunc::CmdTraceRaysKHR: return offsetof(VkLazyDeviceFuncs, CmdTraceRaysKHR);
+          case procaddr::DeviceFunc::CmdUpdateBuffer: return offsetof(VkLazyDeviceFuncs, CmdUpdateBuffer);
+          case procaddr::DeviceFunc::CmdWaitEvents2: return offsetof(VkLazyDeviceFuncs, CmdWaitEvents2);
+          case procaddr::DeviceFunc::CmdWaitEvents2KHR: return offsetof(VkLazyDeviceFuncs, CmdWaitEvents2KHR);
+          case procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesKHR: return offsetof(VkLazyDeviceFuncs, CmdWriteAccelerationStructuresPropertiesKHR);
+          case procaddr::DeviceFunc::CmdWriteMicromapsPropertiesEXT: return offsetof(VkLazyDeviceFuncs, CmdWriteMicromapsPropertiesEXT);
+          case procaddr::DeviceFunc::CmdWriteTimestamp2: return offsetof(VkLazyDeviceFuncs, CmdWriteTimestamp2);
+          case procaddr::DeviceFunc::CmdWriteTimestamp2KHR: return offsetof(VkLazyDeviceFuncs, CmdWriteTimestamp2KHR);
+          case procaddr::DeviceFunc::QueueBeginDebugUtilsLabelEXT: return offsetof(VkLazyDeviceFuncs, QueueBeginDebugUtilsLabelEXT);
+          case procaddr::DeviceFunc::QueueBindSparse: return offsetof(VkLazyDeviceFuncs, QueueBindSparse);
+          case procaddr::DeviceFunc::QueueEndDebugUtilsLabelEXT: return offsetof(VkLazyDeviceFuncs, QueueEndDebugUtilsLabelEXT);
+          case procaddr::DeviceFunc::QueueInsertDebugUtilsLabelEXT: return offsetof(VkLazyDeviceFuncs, QueueInsertDebugUtilsLabelEXT);
+          case procaddr::DeviceFunc::QueueWaitIdle: return offsetof(VkLazyDeviceFuncs, QueueWaitIdle);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::AcquireFullScreenExclusiveModeEXT: return offsetof(VkLazyDeviceFuncs, AcquireFullScreenExclusiveModeEXT);
+#endif
+          case procaddr::DeviceFunc::AcquireProfilingLockKHR: return offsetof(VkLazyDeviceFuncs, AcquireProfilingLockKHR);
+          case procaddr::DeviceFunc::AllocateCommandBuffers: return offsetof(VkLazyDeviceFuncs, AllocateCommandBuffers);
+          case procaddr::DeviceFunc::AllocateMemory: return offsetof(VkLazyDeviceFuncs, AllocateMemory);
+          case procaddr::DeviceFunc::BindBufferMemory: return offsetof(VkLazyDeviceFuncs, BindBufferMemory);
+          case procaddr::DeviceFunc::BindBufferMemory2: return offsetof(VkLazyDeviceFuncs, BindBufferMemory2);
+          case procaddr::DeviceFunc::BindBufferMemory2KHR: return offsetof(VkLazyDeviceFuncs, BindBufferMemory2KHR);
+          case procaddr::DeviceFunc::BindImageMemory: return offsetof(VkLazyDeviceFuncs, BindImageMemory);
+          case procaddr::DeviceFunc::BindImageMemory2: return offsetof(VkLazyDeviceFuncs, BindImageMemory2);
+          case procaddr::DeviceFunc::BindImageMemory2KHR: return offsetof(VkLazyDeviceFuncs, BindImageMemory2KHR);
+          case procaddr::DeviceFunc::BindVideoSessionMemoryKHR: return offsetof(VkLazyDeviceFuncs, BindVideoSessionMemoryKHR);
+          case procaddr::DeviceFunc::BuildAccelerationStructuresKHR: return offsetof(VkLazyDeviceFuncs, BuildAccelerationStructuresKHR);
+          case procaddr::DeviceFunc::BuildMicromapsEXT: return offsetof(VkLazyDeviceFuncs, BuildMicromapsEXT);
+          case procaddr::DeviceFunc::CopyAccelerationStructureKHR: return offsetof(VkLazyDeviceFuncs, CopyAccelerationStructureKHR);
+          case procaddr::DeviceFunc::CopyAccelerationStructureToMemoryKHR: return offsetof(VkLazyDeviceFuncs, CopyAccelerationStructureToMemoryKHR);
+          case procaddr::DeviceFunc::CopyMemoryToAccelerationStructureKHR: return offsetof(VkLazyDeviceFuncs, CopyMemoryToAccelerationStructureKHR);
+          case procaddr::DeviceFunc::CopyMemoryToMicromapEXT: return offsetof(VkLazyDeviceFuncs, CopyMemoryToMicromapEXT);
+          case procaddr::DeviceFunc::CopyMicromapEXT: return offsetof(VkLazyDeviceFuncs, CopyMicromapEXT);
+          case procaddr::DeviceFunc::CopyMicromapToMemoryEXT: return offsetof(VkLazyDeviceFuncs, CopyMicromapToMemoryEXT);
+          case procaddr::DeviceFunc::CreateAccelerationStructureKHR: return offsetof(VkLazyDeviceFuncs, CreateAccelerationStructureKHR);
+          case procaddr::DeviceFunc::CreateBuffer: return offsetof(VkLazyDeviceFuncs, CreateBuffer);
+          case procaddr::DeviceFunc::CreateBufferView: return offsetof(VkLazyDeviceFuncs, CreateBufferView);
+          case procaddr::DeviceFunc::CreateCommandPool: return offsetof(VkLazyDeviceFuncs, CreateCommandPool);
+          case procaddr::DeviceFunc::CreateComputePipelines: return offsetof(VkLazyDeviceFuncs, CreateComputePipelines);
+          case procaddr::DeviceFunc::CreateDeferredOperationKHR: return offsetof(VkLazyDeviceFuncs, CreateDeferredOperationKHR);
+          case procaddr::DeviceFunc::CreateDescriptorPool: return offsetof(VkLazyDeviceFuncs, CreateDescriptorPool);
+          case procaddr::DeviceFunc::CreateDescriptorSetLayout: return offsetof(VkLazyDeviceFuncs, CreateDescriptorSetLayout);
+          case procaddr::DeviceFunc::CreateDescriptorUpdateTemplate: return offsetof(VkLazyDeviceFuncs, CreateDescriptorUpdateTemplate);
+          case procaddr::DeviceFunc::CreateDescriptorUpdateTemplateKHR: return offsetof(VkLazyDeviceFuncs, CreateDescriptorUpdateTemplateKHR);
+          case procaddr::DeviceFunc::CreateEvent: return offsetof(VkLazyDeviceFuncs, CreateEvent);
+          case procaddr::DeviceFunc::CreateFence: return offsetof(VkLazyDeviceFuncs, CreateFence);
+          case procaddr::DeviceFunc::CreateFramebuffer: return offsetof(VkLazyDeviceFuncs, CreateFramebuffer);
+          case procaddr::DeviceFunc::CreateGraphicsPipelines: return offsetof(VkLazyDeviceFuncs, CreateGraphicsPipelines);
+          case procaddr::DeviceFunc::CreateImage: return offsetof(VkLazyDeviceFuncs, CreateImage);
+          case procaddr::DeviceFunc::CreateImageView: return offsetof(VkLazyDeviceFuncs, CreateImageView);
+          case procaddr::DeviceFunc::CreateMicromapEXT: return offsetof(VkLazyDeviceFuncs, CreateMicromapEXT);
+          case procaddr::DeviceFunc::CreatePipelineCache: return offsetof(VkLazyDeviceFuncs, CreatePipelineCache);
+          case procaddr::DeviceFunc::CreatePipelineLayout: return offsetof(VkLazyDeviceFuncs, CreatePipelineLayout);
+          case procaddr::DeviceFunc::CreatePrivateDataSlot: return offsetof(VkLazyDeviceFuncs, CreatePrivateDataSlot);
+          case procaddr::DeviceFunc::CreatePrivateDataSlotEXT: return offsetof(VkLazyDeviceFuncs, CreatePrivateDataSlotEXT);
+          case procaddr::DeviceFunc::CreateQueryPool: return offsetof(VkLazyDeviceFuncs, CreateQueryPool);
+          case procaddr::DeviceFunc::CreateRayTracingPipelinesKHR: return offsetof(VkLazyDeviceFuncs, CreateRayTracingPipelinesKHR);
+          case procaddr::DeviceFunc::CreateRenderPass: return offsetof(VkLazyDeviceFuncs, CreateRenderPass);
+          case procaddr::DeviceFunc::CreateRenderPass2: return offsetof(VkLazyDeviceFuncs, CreateRenderPass2);
+          case procaddr::DeviceFunc::CreateRenderPass2KHR: return offsetof(VkLazyDeviceFuncs, CreateRenderPass2KHR);
+          case procaddr::DeviceFunc::CreateSampler: return offsetof(VkLazyDeviceFuncs, CreateSampler);
+          case procaddr::DeviceFunc::CreateSamplerYcbcrConversion: return offsetof(VkLazyDeviceFuncs, CreateSamplerYcbcrConversion);
+          case procaddr::DeviceFunc::CreateSamplerYcbcrConversionKHR: return offsetof(VkLazyDeviceFuncs, CreateSamplerYcbcrConversionKHR);
+          case procaddr::DeviceFunc::CreateSemaphore: return offsetof(VkLazyDeviceFuncs, CreateSemaphore);
+          case procaddr::DeviceFunc::CreateShaderModule: return offsetof(VkLazyDeviceFuncs, CreateShaderModule);
+          case procaddr::DeviceFunc::CreateShadersEXT: return offsetof(VkLazyDeviceFuncs, CreateShadersEXT);
+          case procaddr::DeviceFunc::CreateSharedSwapchainsKHR: return offsetof(VkLazyDeviceFuncs, CreateSharedSwapchainsKHR);
+          case procaddr::DeviceFunc::CreateSwapchainKHR: return offsetof(VkLazyDeviceFuncs, CreateSwapchainKHR);
+          case procaddr::DeviceFunc::CreateValidationCacheEXT: return offsetof(VkLazyDeviceFuncs, CreateValidationCacheEXT);
+          case procaddr::DeviceFunc::CreateVideoSessionKHR: return offsetof(VkLazyDeviceFuncs, CreateVideoSessionKHR);
+          case procaddr::DeviceFunc::CreateVideoSessionParametersKHR: return offsetof(VkLazyDeviceFuncs, CreateVideoSessionParametersKHR);
+          case procaddr::DeviceFunc::DebugMarkerSetObjectNameEXT: return offsetof(VkLazyDeviceFuncs, DebugMarkerSetObjectNameEXT);
+          case procaddr::DeviceFunc::DebugMarkerSetObjectTagEXT: return offsetof(VkLazyDeviceFuncs, DebugMarkerSetObjectTagEXT);
+          case procaddr::DeviceFunc::DeferredOperationJoinKHR: return offsetof(VkLazyDeviceFuncs, DeferredOperationJoinKHR);
+          case procaddr::DeviceFunc::DestroyAccelerationStructureKHR: return offsetof(VkLazyDeviceFuncs, DestroyAccelerationStructureKHR);
+          case procaddr::DeviceFunc::DestroyBuffer: return offsetof(VkLazyDeviceFuncs, DestroyBuffer);
+          case procaddr::DeviceFunc::DestroyBufferView: return offsetof(VkLazyDeviceFuncs, DestroyBufferView);
+          case procaddr::DeviceFunc::DestroyCommandPool: return offsetof(VkLazyDeviceFuncs, DestroyCommandPool);
+          case procaddr::DeviceFunc::DestroyDeferredOperationKHR: return offsetof(VkLazyDeviceFuncs, DestroyDeferredOperationKHR);
+          case procaddr::DeviceFunc::DestroyDescriptorPool: return offsetof(VkLazyDeviceFuncs, DestroyDescriptorPool);
+          case procaddr::DeviceFunc::DestroyDescriptorSetLayout: return offsetof(VkLazyDeviceFuncs, DestroyDescriptorSetLayout);
+          case procaddr::DeviceFunc::DestroyDescriptorUpdateTemplate: return offsetof(VkLazyDeviceFuncs, DestroyDescriptorUpdateTemplate);
+          case procaddr::DeviceFunc::DestroyDescriptorUpdateTemplateKHR: return offsetof(VkLazyDeviceFuncs, DestroyDescriptorUpdateTemplateKHR);
+          case procaddr::DeviceFunc::DestroyEvent: return offsetof(VkLazyDeviceFuncs, DestroyEvent);
+          case procaddr::DeviceFunc::DestroyFence: return offsetof(VkLazyDeviceFuncs, DestroyFence);
+          case procaddr::DeviceFunc::DestroyFramebuffer: return offsetof(VkLazyDeviceFuncs, DestroyFramebuffer);
+          case procaddr::DeviceFunc::DestroyImage: return offsetof(VkLazyDeviceFuncs, DestroyImage);
+          case procaddr::DeviceFunc::DestroyImageView: return offsetof(VkLazyDeviceFuncs, DestroyImageView);
+          case procaddr::DeviceFunc::DestroyMicromapEXT: return offsetof(VkLazyDeviceFuncs, DestroyMicromapEXT);
+          case procaddr::DeviceFunc::DestroyPipeline: return offsetof(VkLazyDeviceFuncs, DestroyPipeline);
+          case procaddr::DeviceFunc::DestroyPipelineCache: return offsetof(VkLazyDeviceFuncs, DestroyPipelineCache);
+          case procaddr::DeviceFunc::DestroyPipelineLayout: return offsetof(VkLazyDeviceFuncs, DestroyPipelineLayout);
+          case procaddr::DeviceFunc::DestroyPrivateDataSlot: return offsetof(VkLazyDeviceFuncs, DestroyPrivateDataSlot);
+          case procaddr::DeviceFunc::DestroyPrivateDataSlotEXT: return offsetof(VkLazyDeviceFuncs, DestroyPrivateDataSlotEXT);
+          case procaddr::DeviceFunc::DestroyQueryPool: return offsetof(VkLazyDeviceFuncs, DestroyQueryPool);
+          case procaddr::DeviceFunc::DestroyRenderPass: return offsetof(VkLazyDeviceFuncs, DestroyRenderPass);
+          case procaddr::DeviceFunc::DestroySampler: return offsetof(VkLazyDeviceFuncs, DestroySampler);
+          case procaddr::DeviceFunc::DestroySamplerYcbcrConversion: return offsetof(VkLazyDeviceFuncs, DestroySamplerYcbcrConversion);
+          case procaddr::DeviceFunc::DestroySamplerYcbcrConversionKHR: return offsetof(VkLazyDeviceFuncs, DestroySamplerYcbcrConversionKHR);
+          case procaddr::DeviceFunc::DestroySemaphore: return offsetof(VkLazyDeviceFuncs, DestroySemaphore);
+          case procaddr::DeviceFunc::DestroyShaderEXT: return offsetof(VkLazyDeviceFuncs, DestroyShaderEXT);
+          case procaddr::DeviceFunc::DestroyShaderModule: return offsetof(VkLazyDeviceFuncs, DestroyShaderModule);
+          case procaddr::DeviceFunc::DestroySwapchainKHR: return offsetof(VkLazyDeviceFuncs, DestroySwapchainKHR);
+          case procaddr::DeviceFunc::DestroyValidationCacheEXT: return offsetof(VkLazyDeviceFuncs, DestroyValidationCacheEXT);
+          case procaddr::DeviceFunc::DestroyVideoSessionKHR: return offsetof(VkLazyDeviceFuncs, DestroyVideoSessionKHR);
+          case procaddr::DeviceFunc::DestroyVideoSessionParametersKHR: return offsetof(VkLazyDeviceFuncs, DestroyVideoSessionParametersKHR);
+          case procaddr::DeviceFunc::DeviceWaitIdle: return offsetof(VkLazyDeviceFuncs, DeviceWaitIdle);
+          case procaddr::DeviceFunc::DisplayPowerControlEXT: return offsetof(VkLazyDeviceFuncs, DisplayPowerControlEXT);
+#ifdef VK_USE_PLATFORM_METAL_EXT
+          case procaddr::DeviceFunc::ExportMetalObjectsEXT: return offsetof(VkLazyDeviceFuncs, ExportMetalObjectsEXT);
+#endif
+          case procaddr::DeviceFunc::FlushMappedMemoryRanges: return offsetof(VkLazyDeviceFuncs, FlushMappedMemoryRanges);
+          case procaddr::DeviceFunc::FreeCommandBuffers: return offsetof(VkLazyDeviceFuncs, FreeCommandBuffers);
+          case procaddr::DeviceFunc::FreeDescriptorSets: return offsetof(VkLazyDeviceFuncs, FreeDescriptorSets);
+          case procaddr::DeviceFunc::FreeMemory: return offsetof(VkLazyDeviceFuncs, FreeMemory);
+          case procaddr::DeviceFunc::GetAccelerationStructureBuildSizesKHR: return offsetof(VkLazyDeviceFuncs, GetAccelerationStructureBuildSizesKHR);
+          case procaddr::DeviceFunc::GetAccelerationStructureDeviceAddressKHR: return offsetof(VkLazyDeviceFuncs, GetAccelerationStructureDeviceAddressKHR);
+          case procaddr::DeviceFunc::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT: return offsetof(VkLazyDeviceFuncs, GetAccelerationStructureOpaqueCaptureDescriptorDataEXT);
+          case procaddr::DeviceFunc::GetBufferDeviceAddress: return offsetof(VkLazyDeviceFuncs, GetBufferDeviceAddress);
+          case procaddr::DeviceFunc::GetBufferDeviceAddressEXT: return offsetof(VkLazyDeviceFuncs, GetBufferDeviceAddressEXT);
+          case procaddr::DeviceFunc::GetBufferDeviceAddressKHR: return offsetof(VkLazyDeviceFuncs, GetBufferDeviceAddressKHR);
+          case procaddr::DeviceFunc::GetBufferMemoryRequirements: return offsetof(VkLazyDeviceFuncs, GetBufferMemoryRequirements);
+          case procaddr::DeviceFunc::GetBufferMemoryRequirements2: return offsetof(VkLazyDeviceFuncs, GetBufferMemoryRequirements2);
+          case procaddr::DeviceFunc::GetBufferMemoryRequirements2KHR: return offsetof(VkLazyDeviceFuncs, GetBufferMemoryRequirements2KHR);
+          case procaddr::DeviceFunc::GetBufferOpaqueCaptureAddress: return offsetof(VkLazyDeviceFuncs, GetBufferOpaqueCaptureAddress);
+          case procaddr::DeviceFunc::GetBufferOpaqueCaptureAddressKHR: return offsetof(VkLazyDeviceFuncs, GetBufferOpaqueCaptureAddressKHR);
+          case procaddr::DeviceFunc::GetBufferOpaqueCaptureDescriptorDataEXT: return offsetof(VkLazyDeviceFuncs, GetBufferOpaqueCaptureDescriptorDataEXT);
+          case procaddr::DeviceFunc::GetCalibratedTimestampsEXT: return offsetof(VkLazyDeviceFuncs, GetCalibratedTimestampsEXT);
+          case procaddr::DeviceFunc::GetDeferredOperationMaxConcurrencyKHR: return offsetof(VkLazyDeviceFuncs, GetDeferredOperationMaxConcurrencyKHR);
+          case procaddr::DeviceFunc::GetDeferredOperationResultKHR: return offsetof(VkLazyDeviceFuncs, GetDeferredOperationResultKHR);
+          case procaddr::DeviceFunc::GetDescriptorEXT: return offsetof(VkLazyDeviceFuncs, GetDescriptorEXT);
+          case procaddr::DeviceFunc::GetDescriptorSetLayoutBindingOffsetEXT: return offsetof(VkLazyDeviceFuncs, GetDescriptorSetLayoutBindingOffsetEXT);
+          case procaddr::DeviceFunc::GetDescriptorSetLayoutSizeEXT: return offsetof(VkLazyDeviceFuncs, GetDescriptorSetLayoutSizeEXT);
+          case procaddr::DeviceFunc::GetDescriptorSetLayoutSupport: return offsetof(VkLazyDeviceFuncs, GetDescriptorSetLayoutSupport);
+          case procaddr::DeviceFunc::GetDescriptorSetLayoutSupportKHR: return offsetof(VkLazyDeviceFuncs, GetDescriptorSetLayoutSupportKHR);
+          case procaddr::DeviceFunc::GetDeviceAccelerationStructureCompatibilityKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceAccelerationStructureCompatibilityKHR);
+          case procaddr::DeviceFunc::GetDeviceBufferMemoryRequirements: return offsetof(VkLazyDeviceFuncs, GetDeviceBufferMemoryRequirements);
+          case procaddr::DeviceFunc::GetDeviceBufferMemoryRequirementsKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceBufferMemoryRequirementsKHR);
+          case procaddr::DeviceFunc::GetDeviceFaultInfoEXT: return offsetof(VkLazyDeviceFuncs, GetDeviceFaultInfoEXT);
+          case procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeatures: return offsetof(VkLazyDeviceFuncs, GetDeviceGroupPeerMemoryFeatures);
+          case procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeaturesKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceGroupPeerMemoryFeaturesKHR);
+          case procaddr::DeviceFunc::GetDeviceGroupPresentCapabilitiesKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceGroupPresentCapabilitiesKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModes2EXT: return offsetof(VkLazyDeviceFuncs, GetDeviceGroupSurfacePresentModes2EXT);
+#endif
+          case procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModesKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceGroupSurfacePresentModesKHR);
+          case procaddr::DeviceFunc::GetDeviceImageMemoryRequirements: return offsetof(VkLazyDeviceFuncs, GetDeviceImageMemoryRequirements);
+          case procaddr::DeviceFunc::GetDeviceImageMemoryRequirementsKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceImageMemoryRequirementsKHR);
+          case procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirements: return offsetof(VkLazyDeviceFuncs, GetDeviceImageSparseMemoryRequirements);
+          case procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirementsKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceImageSparseMemoryRequirementsKHR);
+          case procaddr::DeviceFunc::GetDeviceMemoryCommitment: return offsetof(VkLazyDeviceFuncs, GetDeviceMemoryCommitment);
+          case procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddress: return offsetof(VkLazyDeviceFuncs, GetDeviceMemoryOpaqueCaptureAddress);
+          case procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddressKHR: return offsetof(VkLazyDeviceFuncs, GetDeviceMemoryOpaqueCaptureAddressKHR);
+          case procaddr::DeviceFunc::GetDeviceMicromapCompatibilityEXT: return offsetof(VkLazyDeviceFuncs, GetDeviceMicromapCompatibilityEXT);
+          case procaddr::DeviceFunc::GetDeviceQueue: return offsetof(VkLazyDeviceFuncs, GetDeviceQueue);
+          case procaddr::DeviceFunc::GetDeviceQueue2: return offsetof(VkLazyDeviceFuncs, GetDeviceQueue2);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+          case procaddr::DeviceFunc::GetEncodedVideoSessionParametersKHR: return offsetof(VkLazyDeviceFuncs, GetEncodedVideoSessionParametersKHR);
+#endif
+          case procaddr::DeviceFunc::GetEventStatus: return offsetof(VkLazyDeviceFuncs, GetEventStatus);
+          case procaddr::DeviceFunc::GetFenceFdKHR: return offsetof(VkLazyDeviceFuncs, GetFenceFdKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::GetFenceWin32HandleKHR: return offsetof(VkLazyDeviceFuncs, GetFenceWin32HandleKHR);
+#endif
+          case procaddr::DeviceFunc::GetImageDrmFormatModifierPropertiesEXT: return offsetof(VkLazyDeviceFuncs, GetImageDrmFormatModifierPropertiesEXT);
+          case procaddr::DeviceFunc::GetImageMemoryRequirements: return offsetof(VkLazyDeviceFuncs, GetImageMemoryRequirements);
+          case procaddr::DeviceFunc::GetImageMemoryRequirements2: return offsetof(VkLazyDeviceFuncs, GetImageMemoryRequirements2);
+          case procaddr::DeviceFunc::GetImageMemoryRequirements2KHR: return offsetof(VkLazyDeviceFuncs, GetImageMemoryRequirements2KHR);
+          case procaddr::DeviceFunc::GetImageOpaqueCaptureDescriptorDataEXT: return offsetof(VkLazyDeviceFuncs, GetImageOpaqueCaptureDescriptorDataEXT);
+          case procaddr::DeviceFunc::GetImageSparseMemoryRequirements: return offsetof(VkLazyDeviceFuncs, GetImageSparseMemoryRequirements);
+          case procaddr::DeviceFunc::GetImageSparseMemoryRequirements2: return offsetof(VkLazyDeviceFuncs, GetImageSparseMemoryRequirements2);
+          case procaddr::DeviceFunc::GetImageSparseMemoryRequirements2KHR: return offsetof(VkLazyDeviceFuncs, GetImageSparseMemoryRequirements2KHR);
+          case procaddr::DeviceFunc::GetImageSubresourceLayout: return offsetof(VkLazyDeviceFuncs, GetImageSubresourceLayout);
+          case procaddr::DeviceFunc::GetImageSubresourceLayout2EXT: return offsetof(VkLazyDeviceFuncs, GetImageSubresourceLayout2EXT);
+          case procaddr::DeviceFunc::GetImageViewOpaqueCaptureDescriptorDataEXT: return offsetof(VkLazyDeviceFuncs, GetImageViewOpaqueCaptureDescriptorDataEXT);
+          case procaddr::DeviceFunc::GetMemoryFdKHR: return offsetof(VkLazyDeviceFuncs, GetMemoryFdKHR);
+          case procaddr::DeviceFunc::GetMemoryFdPropertiesKHR: return offsetof(VkLazyDeviceFuncs, GetMemoryFdPropertiesKHR);
+          case procaddr::DeviceFunc::GetMemoryHostPointerPropertiesEXT: return offsetof(VkLazyDeviceFuncs, GetMemoryHostPointerPropertiesEXT);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::GetMemoryWin32HandleKHR: return offsetof(VkLazyDeviceFuncs, GetMemoryWin32HandleKHR);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::GetMemoryWin32HandlePropertiesKHR: return offsetof(VkLazyDeviceFuncs, GetMemoryWin32HandlePropertiesKHR);
+#endif
+          case procaddr::DeviceFunc::GetMicromapBuildSizesEXT: return offsetof(VkLazyDeviceFuncs, GetMicromapBuildSizesEXT);
+          case procaddr::DeviceFunc::GetPipelineCacheData: return offsetof(VkLazyDeviceFuncs, GetPipelineCacheData);
+          case procaddr::DeviceFunc::GetPipelineExecutableInternalRepresentationsKHR: return offsetof(VkLazyDeviceFuncs, GetPipelineExecutableInternalRepresentationsKHR);
+          case procaddr::DeviceFunc::GetPipelineExecutablePropertiesKHR: return offsetof(VkLazyDeviceFuncs, GetPipelineExecutablePropertiesKHR);
+          case procaddr::DeviceFunc::GetPipelineExecutableStatisticsKHR: return offsetof(VkLazyDeviceFuncs, GetPipelineExecutableStatisticsKHR);
+          case procaddr::DeviceFunc::GetPipelinePropertiesEXT: return offsetof(VkLazyDeviceFuncs, GetPipelinePropertiesEXT);
+          case procaddr::DeviceFunc::GetPrivateData: return offsetof(VkLazyDeviceFuncs, GetPrivateData);
+          case procaddr::DeviceFunc::GetPrivateDataEXT: return offsetof(VkLazyDeviceFuncs, GetPrivateDataEXT);
+          case procaddr::DeviceFunc::GetQueryPoolResults: return offsetof(VkLazyDeviceFuncs, GetQueryPoolResults);
+          case procaddr::DeviceFunc::GetRayTracingCaptureReplayShaderGroupHandlesKHR: return offsetof(VkLazyDeviceFuncs, GetRayTracingCaptureReplayShaderGroupHandlesKHR);
+          case procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesKHR: return offsetof(VkLazyDeviceFuncs, GetRayTracingShaderGroupHandlesKHR);
+          case procaddr::DeviceFunc::GetRayTracingShaderGroupStackSizeKHR: return offsetof(VkLazyDeviceFuncs, GetRayTracingShaderGroupStackSizeKHR);
+          case procaddr::DeviceFunc::GetRenderAreaGranularity: return offsetof(VkLazyDeviceFuncs, GetRenderAreaGranularity);
+          case procaddr::DeviceFunc::GetSamplerOpaqueCaptureDescriptorDataEXT: return offsetof(VkLazyDeviceFuncs, GetSamplerOpaqueCaptureDescriptorDataEXT);
+          case procaddr::DeviceFunc::GetSemaphoreFdKHR: return offsetof(VkLazyDeviceFuncs, GetSemaphoreFdKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::GetSemaphoreWin32HandleKHR: return offsetof(VkLazyDeviceFuncs, GetSemaphoreWin32HandleKHR);
+#endif
+          case procaddr::DeviceFunc::GetShaderBinaryDataEXT: return offsetof(VkLazyDeviceFuncs, GetShaderBinaryDataEXT);
+          case procaddr::DeviceFunc::GetShaderModuleCreateInfoIdentifierEXT: return offsetof(VkLazyDeviceFuncs, GetShaderModuleCreateInfoIdentifierEXT);
+          case procaddr::DeviceFunc::GetShaderModuleIdentifierEXT: return offsetof(VkLazyDeviceFuncs, GetShaderModuleIdentifierEXT);
+          case procaddr::DeviceFunc::GetSwapchainCounterEXT: return offsetof(VkLazyDeviceFuncs, GetSwapchainCounterEXT);
+          case procaddr::DeviceFunc::GetSwapchainImagesKHR: return offsetof(VkLazyDeviceFuncs, GetSwapchainImagesKHR);
+          case procaddr::DeviceFunc::GetSwapchainStatusKHR: return offsetof(VkLazyDeviceFuncs, GetSwapchainStatusKHR);
+          case procaddr::DeviceFunc::GetValidationCacheDataEXT: return offsetof(VkLazyDeviceFuncs, GetValidationCacheDataEXT);
+          case procaddr::DeviceFunc::GetVideoSessionMemoryRequirementsKHR: return offsetof(VkLazyDeviceFuncs, GetVideoSessionMemoryRequirementsKHR);
+          case procaddr::DeviceFunc::ImportFenceFdKHR: return offsetof(VkLazyDeviceFuncs, ImportFenceFdKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::ImportFenceWin32HandleKHR: return offsetof(VkLazyDeviceFuncs, ImportFenceWin32HandleKHR);
+#endif
+          case procaddr::DeviceFunc::ImportSemaphoreFdKHR: return offsetof(VkLazyDeviceFuncs, ImportSemaphoreFdKHR);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::ImportSemaphoreWin32HandleKHR: return offsetof(VkLazyDeviceFuncs, ImportSemaphoreWin32HandleKHR);
+#endif
+          case procaddr::DeviceFunc::InvalidateMappedMemoryRanges: return offsetof(VkLazyDeviceFuncs, InvalidateMappedMemoryRanges);
+          case procaddr::DeviceFunc::MapMemory: return offsetof(VkLazyDeviceFuncs, MapMemory);
+          case procaddr::DeviceFunc::MapMemory2KHR: return offsetof(VkLazyDeviceFuncs, MapMemory2KHR);
+          case procaddr::DeviceFunc::MergePipelineCaches: return offsetof(VkLazyDeviceFuncs, MergePipelineCaches);
+          case procaddr::DeviceFunc::MergeValidationCachesEXT: return offsetof(VkLazyDeviceFuncs, MergeValidationCachesEXT);
+          case procaddr::DeviceFunc::RegisterDeviceEventEXT: return offsetof(VkLazyDeviceFuncs, RegisterDeviceEventEXT);
+          case procaddr::DeviceFunc::RegisterDisplayEventEXT: return offsetof(VkLazyDeviceFuncs, RegisterDisplayEventEXT);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::ReleaseFullScreenExclusiveModeEXT: return offsetof(VkLazyDeviceFuncs, ReleaseFullScreenExclusiveModeEXT);
+#endif
+          case procaddr::DeviceFunc::ReleaseProfilingLockKHR: return offsetof(VkLazyDeviceFuncs, ReleaseProfilingLockKHR);
+          case procaddr::DeviceFunc::ReleaseSwapchainImagesEXT: return offsetof(VkLazyDeviceFuncs, ReleaseSwapchainImagesEXT);
+          case procaddr::DeviceFunc::ResetEvent: return offsetof(VkLazyDeviceFuncs, ResetEvent);
+          case procaddr::DeviceFunc::ResetQueryPool: return offsetof(VkLazyDeviceFuncs, ResetQueryPool);
+          case procaddr::DeviceFunc::ResetQueryPoolEXT: return offsetof(VkLazyDeviceFuncs, ResetQueryPoolEXT);
+          case procaddr::DeviceFunc::SetDebugUtilsObjectNameEXT: return offsetof(VkLazyDeviceFuncs, SetDebugUtilsObjectNameEXT);
+          case procaddr::DeviceFunc::SetDebugUtilsObjectTagEXT: return offsetof(VkLazyDeviceFuncs, SetDebugUtilsObjectTagEXT);
+          case procaddr::DeviceFunc::SetDeviceMemoryPriorityEXT: return offsetof(VkLazyDeviceFuncs, SetDeviceMemoryPriorityEXT);
+          case procaddr::DeviceFunc::SetEvent: return offsetof(VkLazyDeviceFuncs, SetEvent);
+          case procaddr::DeviceFunc::SetHdrMetadataEXT: return offsetof(VkLazyDeviceFuncs, SetHdrMetadataEXT);
+          case procaddr::DeviceFunc::SetPrivateData: return offsetof(VkLazyDeviceFuncs, SetPrivateData);
+          case procaddr::DeviceFunc::SetPrivateDataEXT: return offsetof(VkLazyDeviceFuncs, SetPrivateDataEXT);
+          case procaddr::DeviceFunc::SignalSemaphoreKHR: return offsetof(VkLazyDeviceFuncs, SignalSemaphoreKHR);
+          case procaddr::DeviceFunc::TrimCommandPool: return offsetof(VkLazyDeviceFuncs, TrimCommandPool);
+          case procaddr::DeviceFunc::TrimCommandPoolKHR: return offsetof(VkLazyDeviceFuncs, TrimCommandPoolKHR);
+          case procaddr::DeviceFunc::UnmapMemory: return offsetof(VkLazyDeviceFuncs, UnmapMemory);
+          case procaddr::DeviceFunc::UnmapMemory2KHR: return offsetof(VkLazyDeviceFuncs, UnmapMemory2KHR);
+          case procaddr::DeviceFunc::UpdateDescriptorSetWithTemplate: return offsetof(VkLazyDeviceFuncs, UpdateDescriptorSetWithTemplate);
+          case procaddr::DeviceFunc::UpdateDescriptorSetWithTemplateKHR: return offsetof(VkLazyDeviceFuncs, UpdateDescriptorSetWithTemplateKHR);
+          case procaddr::DeviceFunc::UpdateVideoSessionParametersKHR: return offsetof(VkLazyDeviceFuncs, UpdateVideoSessionParametersKHR);
+          case procaddr::DeviceFunc::WaitForPresentKHR: return offsetof(VkLazyDeviceFuncs, WaitForPresentKHR);
+          case procaddr::DeviceFunc::WriteAccelerationStructuresPropertiesKHR: return offsetof(VkLazyDeviceFuncs, WriteAccelerationStructuresPropertiesKHR);
+          case procaddr::DeviceFunc::WriteMicromapsPropertiesEXT: return offsetof(VkLazyDeviceFuncs, WriteMicromapsPropertiesEXT);
+          case procaddr::DeviceFunc::AcquirePerformanceConfigurationINTEL: return offsetof(VkLazyDeviceFuncs, AcquirePerformanceConfigurationINTEL);
+          case procaddr::DeviceFunc::BindAccelerationStructureMemoryNV: return offsetof(VkLazyDeviceFuncs, BindAccelerationStructureMemoryNV);
+          case procaddr::DeviceFunc::BindOpticalFlowSessionImageNV: return offsetof(VkLazyDeviceFuncs, BindOpticalFlowSessionImageNV);
+          case procaddr::DeviceFunc::CmdBindInvocationMaskHUAWEI: return offsetof(VkLazyDeviceFuncs, CmdBindInvocationMaskHUAWEI);
+          case procaddr::DeviceFunc::CmdBindPipelineShaderGroupNV: return offsetof(VkLazyDeviceFuncs, CmdBindPipelineShaderGroupNV);
+          case procaddr::DeviceFunc::CmdBindShadingRateImageNV: return offsetof(VkLazyDeviceFuncs, CmdBindShadingRateImageNV);
+          case procaddr::DeviceFunc::CmdBuildAccelerationStructureNV: return offsetof(VkLazyDeviceFuncs, CmdBuildAccelerationStructureNV);
+          case procaddr::DeviceFunc::CmdCopyAccelerationStructureNV: return offsetof(VkLazyDeviceFuncs, CmdCopyAccelerationStructureNV);
+          case procaddr::DeviceFunc::CmdCopyMemoryIndirectNV: return offsetof(VkLazyDeviceFuncs, CmdCopyMemoryIndirectNV);
+          case procaddr::DeviceFunc::CmdCopyMemoryToImageIndirectNV: return offsetof(VkLazyDeviceFuncs, CmdCopyMemoryToImageIndirectNV);
+          case procaddr::DeviceFunc::CmdDecompressMemoryIndirectCountNV: return offsetof(VkLazyDeviceFuncs, CmdDecompressMemoryIndirectCountNV);
+          case procaddr::DeviceFunc::CmdDecompressMemoryNV: return offsetof(VkLazyDeviceFuncs, CmdDecompressMemoryNV);
+          case procaddr::DeviceFunc::CmdDrawClusterHUAWEI: return offsetof(VkLazyDeviceFuncs, CmdDrawClusterHUAWEI);
+          case procaddr::DeviceFunc::CmdDrawClusterIndirectHUAWEI: return offsetof(VkLazyDeviceFuncs, CmdDrawClusterIndirectHUAWEI);
+          case procaddr::DeviceFunc::CmdDrawIndexedIndirectCountAMD: return offsetof(VkLazyDeviceFuncs, CmdDrawIndexedIndirectCountAMD);
+          case procaddr::DeviceFunc::CmdDrawIndirectCountAMD: return offsetof(VkLazyDeviceFuncs, CmdDrawIndirectCountAMD);
+          case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountNV: return offsetof(VkLazyDeviceFuncs, CmdDrawMeshTasksIndirectCountNV);
+          case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectNV: return offsetof(VkLazyDeviceFuncs, CmdDrawMeshTasksIndirectNV);
+          case procaddr::DeviceFunc::CmdDrawMeshTasksNV: return offsetof(VkLazyDeviceFuncs, CmdDrawMeshTasksNV);
+          case procaddr::DeviceFunc::CmdExecuteGeneratedCommandsNV: return offsetof(VkLazyDeviceFuncs, CmdExecuteGeneratedCommandsNV);
+          case procaddr::DeviceFunc::CmdOpticalFlowExecuteNV: return offsetof(VkLazyDeviceFuncs, CmdOpticalFlowExecuteNV);
+          case procaddr::DeviceFunc::CmdPreprocessGeneratedCommandsNV: return offsetof(VkLazyDeviceFuncs, CmdPreprocessGeneratedCommandsNV);
+          case procaddr::DeviceFunc::CmdSetCheckpointNV: return offsetof(VkLazyDeviceFuncs, CmdSetCheckpointNV);
+          case procaddr::DeviceFunc::CmdSetCoarseSampleOrderNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoarseSampleOrderNV);
+          case procaddr::DeviceFunc::CmdSetCoverageModulationModeNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoverageModulationModeNV);
+          case procaddr::DeviceFunc::CmdSetCoverageModulationTableEnableNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoverageModulationTableEnableNV);
+          case procaddr::DeviceFunc::CmdSetCoverageModulationTableNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoverageModulationTableNV);
+          case procaddr::DeviceFunc::CmdSetCoverageReductionModeNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoverageReductionModeNV);
+          case procaddr::DeviceFunc::CmdSetCoverageToColorEnableNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoverageToColorEnableNV);
+          case procaddr::DeviceFunc::CmdSetCoverageToColorLocationNV: return offsetof(VkLazyDeviceFuncs, CmdSetCoverageToColorLocationNV);
+          case procaddr::DeviceFunc::CmdSetExclusiveScissorEnableNV: return offsetof(VkLazyDeviceFuncs, CmdSetExclusiveScissorEnableNV);
+          case procaddr::DeviceFunc::CmdSetExclusiveScissorNV: return offsetof(VkLazyDeviceFuncs, CmdSetExclusiveScissorNV);
+          case procaddr::DeviceFunc::CmdSetFragmentShadingRateEnumNV: return offsetof(VkLazyDeviceFuncs, CmdSetFragmentShadingRateEnumNV);
+          case procaddr::DeviceFunc::CmdSetPerformanceMarkerINTEL: return offsetof(VkLazyDeviceFuncs, CmdSetPerformanceMarkerINTEL);
+          case procaddr::DeviceFunc::CmdSetPerformanceOverrideINTEL: return offsetof(VkLazyDeviceFuncs, CmdSetPerformanceOverrideINTEL);
+          case procaddr::DeviceFunc::CmdSetPerformanceStreamMarkerINTEL: return offsetof(VkLazyDeviceFuncs, CmdSetPerformanceStreamMarkerINTEL);
+          case procaddr::DeviceFunc::CmdSetRepresentativeFragmentTestEnableNV: return offsetof(VkLazyDeviceFuncs, CmdSetRepresentativeFragmentTestEnableNV);
+          case procaddr::DeviceFunc::CmdSetShadingRateImageEnableNV: return offsetof(VkLazyDeviceFuncs, CmdSetShadingRateImageEnableNV);
+          case procaddr::DeviceFunc::CmdSetViewportShadingRatePaletteNV: return offsetof(VkLazyDeviceFuncs, CmdSetViewportShadingRatePaletteNV);
+          case procaddr::DeviceFunc::CmdSetViewportSwizzleNV: return offsetof(VkLazyDeviceFuncs, CmdSetViewportSwizzleNV);
+          case procaddr::DeviceFunc::CmdSetViewportWScalingEnableNV: return offsetof(VkLazyDeviceFuncs, CmdSetViewportWScalingEnableNV);
+          case procaddr::DeviceFunc::CmdSetViewportWScalingNV: return offsetof(VkLazyDeviceFuncs, CmdSetViewportWScalingNV);
+          case procaddr::DeviceFunc::CmdSubpassShadingHUAWEI: return offsetof(VkLazyDeviceFuncs, CmdSubpassShadingHUAWEI);
+          case procaddr::DeviceFunc::CmdTraceRaysNV: return offsetof(VkLazyDeviceFuncs, CmdTraceRaysNV);
+          case procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesNV: return offsetof(VkLazyDeviceFuncs, CmdWriteAccelerationStructuresPropertiesNV);
+          case procaddr::DeviceFunc::CmdWriteBufferMarker2AMD: return offsetof(VkLazyDeviceFuncs, CmdWriteBufferMarker2AMD);
+          case procaddr::DeviceFunc::CmdWriteBufferMarkerAMD: return offsetof(VkLazyDeviceFuncs, CmdWriteBufferMarkerAMD);
+          case procaddr::DeviceFunc::CompileDeferredNV: return offsetof(VkLazyDeviceFuncs, CompileDeferredNV);
+          case procaddr::DeviceFunc::CreateAccelerationStructureNV: return offsetof(VkLazyDeviceFuncs, CreateAccelerationStructureNV);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::CreateBufferCollectionFUCHSIA: return offsetof(VkLazyDeviceFuncs, CreateBufferCollectionFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::CreateIndirectCommandsLayoutNV: return offsetof(VkLazyDeviceFuncs, CreateIndirectCommandsLayoutNV);
+          case procaddr::DeviceFunc::CreateOpticalFlowSessionNV: return offsetof(VkLazyDeviceFuncs, CreateOpticalFlowSessionNV);
+          case procaddr::DeviceFunc::CreateRayTracingPipelinesNV: return offsetof(VkLazyDeviceFuncs, CreateRayTracingPipelinesNV);
+          case procaddr::DeviceFunc::DestroyAccelerationStructureNV: return offsetof(VkLazyDeviceFuncs, DestroyAccelerationStructureNV);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::DestroyBufferCollectionFUCHSIA: return offsetof(VkLazyDeviceFuncs, DestroyBufferCollectionFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::DestroyIndirectCommandsLayoutNV: return offsetof(VkLazyDeviceFuncs, DestroyIndirectCommandsLayoutNV);
+          case procaddr::DeviceFunc::DestroyOpticalFlowSessionNV: return offsetof(VkLazyDeviceFuncs, DestroyOpticalFlowSessionNV);
+          case procaddr::DeviceFunc::GetAccelerationStructureHandleNV: return offsetof(VkLazyDeviceFuncs, GetAccelerationStructureHandleNV);
+          case procaddr::DeviceFunc::GetAccelerationStructureMemoryRequirementsNV: return offsetof(VkLazyDeviceFuncs, GetAccelerationStructureMemoryRequirementsNV);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+          case procaddr::DeviceFunc::GetAndroidHardwareBufferPropertiesANDROID: return offsetof(VkLazyDeviceFuncs, GetAndroidHardwareBufferPropertiesANDROID);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::GetBufferCollectionPropertiesFUCHSIA: return offsetof(VkLazyDeviceFuncs, GetBufferCollectionPropertiesFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::GetDescriptorSetHostMappingVALVE: return offsetof(VkLazyDeviceFuncs, GetDescriptorSetHostMappingVALVE);
+          case procaddr::DeviceFunc::GetDescriptorSetLayoutHostMappingInfoVALVE: return offsetof(VkLazyDeviceFuncs, GetDescriptorSetLayoutHostMappingInfoVALVE);
+          case procaddr::DeviceFunc::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI: return offsetof(VkLazyDeviceFuncs, GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI);
+          case procaddr::DeviceFunc::GetDynamicRenderingTilePropertiesQCOM: return offsetof(VkLazyDeviceFuncs, GetDynamicRenderingTilePropertiesQCOM);
+          case procaddr::DeviceFunc::GetFramebufferTilePropertiesQCOM: return offsetof(VkLazyDeviceFuncs, GetFramebufferTilePropertiesQCOM);
+          case procaddr::DeviceFunc::GetGeneratedCommandsMemoryRequirementsNV: return offsetof(VkLazyDeviceFuncs, GetGeneratedCommandsMemoryRequirementsNV);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+          case procaddr::DeviceFunc::GetMemoryAndroidHardwareBufferANDROID: return offsetof(VkLazyDeviceFuncs, GetMemoryAndroidHardwareBufferANDROID);
+#endif
+          case procaddr::DeviceFunc::GetMemoryRemoteAddressNV: return offsetof(VkLazyDeviceFuncs, GetMemoryRemoteAddressNV);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+          case procaddr::DeviceFunc::GetMemoryWin32HandleNV: return offsetof(VkLazyDeviceFuncs, GetMemoryWin32HandleNV);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::GetMemoryZirconHandleFUCHSIA: return offsetof(VkLazyDeviceFuncs, GetMemoryZirconHandleFUCHSIA);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::GetMemoryZirconHandlePropertiesFUCHSIA: return offsetof(VkLazyDeviceFuncs, GetMemoryZirconHandlePropertiesFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::GetPastPresentationTimingGOOGLE: return offsetof(VkLazyDeviceFuncs, GetPastPresentationTimingGOOGLE);
+          case procaddr::DeviceFunc::GetPerformanceParameterINTEL: return offsetof(VkLazyDeviceFuncs, GetPerformanceParameterINTEL);
+          case procaddr::DeviceFunc::GetQueueCheckpointData2NV: return offsetof(VkLazyDeviceFuncs, GetQueueCheckpointData2NV);
+          case procaddr::DeviceFunc::GetQueueCheckpointDataNV: return offsetof(VkLazyDeviceFuncs, GetQueueCheckpointDataNV);
+          case procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesNV: return offsetof(VkLazyDeviceFuncs, GetRayTracingShaderGroupHandlesNV);
+          case procaddr::DeviceFunc::GetRefreshCycleDurationGOOGLE: return offsetof(VkLazyDeviceFuncs, GetRefreshCycleDurationGOOGLE);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::GetSemaphoreZirconHandleFUCHSIA: return offsetof(VkLazyDeviceFuncs, GetSemaphoreZirconHandleFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::GetShaderInfoAMD: return offsetof(VkLazyDeviceFuncs, GetShaderInfoAMD);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::ImportSemaphoreZirconHandleFUCHSIA: return offsetof(VkLazyDeviceFuncs, ImportSemaphoreZirconHandleFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::InitializePerformanceApiINTEL: return offsetof(VkLazyDeviceFuncs, InitializePerformanceApiINTEL);
+          case procaddr::DeviceFunc::QueueSetPerformanceConfigurationINTEL: return offsetof(VkLazyDeviceFuncs, QueueSetPerformanceConfigurationINTEL);
+          case procaddr::DeviceFunc::ReleasePerformanceConfigurationINTEL: return offsetof(VkLazyDeviceFuncs, ReleasePerformanceConfigurationINTEL);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::SetBufferCollectionBufferConstraintsFUCHSIA: return offsetof(VkLazyDeviceFuncs, SetBufferCollectionBufferConstraintsFUCHSIA);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+          case procaddr::DeviceFunc::SetBufferCollectionImageConstraintsFUCHSIA: return offsetof(VkLazyDeviceFuncs, SetBufferCollectionImageConstraintsFUCHSIA);
+#endif
+          case procaddr::DeviceFunc::SetLocalDimmingAMD: return offsetof(VkLazyDeviceFuncs, SetLocalDimmingAMD);
+          case procaddr::DeviceFunc::UninitializePerformanceApiINTEL: return offsetof(VkLazyDeviceFuncs, UninitializePerformanceApiINTEL);
+          default: return 0;
+        }
+      }
+    };
+    static_assert(std::is_standard_layout_v<VkLazyDeviceFuncs>);
+  }
+#endif
+  class alignas(VKROOTS_CACHE_LINE_SIZE) VkDeviceDispatch
+#if VKROOTS_USE_LAZY_DISPATCH
+    : public tables::VkLazyDeviceFuncs
+#endif
+  {
+  public:
+    VkDeviceDispatch(PFN_vkGetDeviceProcAddr NextGetDeviceProcAddr, VkDevice device, VkPhysicalDevice PhysicalDevice, const VkPhysicalDeviceDispatch* pPhysicalDeviceDispatch, const VkDeviceCreateInfo* pCreateInfo) {
+      this->PhysicalDevice = PhysicalDevice;
+      this->Device = device;
+      this->pPhysicalDeviceDispatch = pPhysicalDeviceDispatch;
+      for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; i++) {
+        VkDeviceQueueCreateInfo queueInfo = pCreateInfo->pQueueCreateInfos[i];
+        queueInfo.pNext = nullptr;
+        DeviceQueueInfos.push_back(queueInfo);
+      }
+#if VKROOTS_USE_LAZY_DISPATCH
+      this->LazyResolver = { device, NextGetDeviceProcAddr };
+      GetDeviceProcAddr = NextGetDeviceProcAddr;
+      DestroyDeviceReal = (PFN_vkDestroyDevice) NextGetDeviceProcAddr(device, "vkDestroyDevice");
+      DestroyDevice = (PFN_vkDestroyDevice) DestroyDeviceWrapper;
+#elif VKROOTS_USE_EXTENSION_AWARE_DISPATCH
+      uint32_t apiVersion = UINT32_MAX;
+      if (pPhysicalDeviceDispatch) {
+        VkPhysicalDeviceProperties properties;
+        pPhysicalDeviceDispatch->pInstanceDispatch->GetPhysicalDeviceProperties(PhysicalDevice, &properties);
+        apiVersion = properties.apiVersion;
+      }
+      const tables::VkEnabledFeatures<procaddr::DeviceExtension, &procaddr::LookupDeviceExtension> enabled(apiVersion, pCreateInfo->enabledExtensionCount, pCreateInfo->ppEnabledExtensionNames);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      AcquireFullScreenExclusiveModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_full_screen_exclusive)
+        ? (PFN_vkAcquireFullScreenExclusiveModeEXT) NextGetDeviceProcAddr(device, "vkAcquireFullScreenExclusiveModeEXT")
+        : nullptr;
+#endif
+      AcquireNextImage2KHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain) || enabled.Has(procaddr::DeviceExtension::KHR_device_group)
+        ? (PFN_vkAcquireNextImage2KHR) NextGetDeviceProcAddr(device, "vkAcquireNextImage2KHR")
+        : nullptr;
+      AcquireNextImageKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain)
+        ? (PFN_vkAcquireNextImageKHR) NextGetDeviceProcAddr(device, "vkAcquireNextImageKHR")
+        : nullptr;
+      AcquirePerformanceConfigurationINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkAcquirePerformanceConfigurationINTEL) NextGetDeviceProcAddr(device, "vkAcquirePerformanceConfigurationINTEL")
+        : nullptr;
+      AcquireProfilingLockKHR = enabled.Has(procaddr::DeviceExtension::KHR_performance_query)
+        ? (PFN_vkAcquireProfilingLockKHR) NextGetDeviceProcAddr(device, "vkAcquireProfilingLockKHR")
+        : nullptr;
+      AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) NextGetDeviceProcAddr(device, "vkAllocateCommandBuffers");
+      AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) NextGetDeviceProcAddr(device, "vkAllocateDescriptorSets");
+      AllocateMemory = (PFN_vkAllocateMemory) NextGetDeviceProcAddr(device, "vkAllocateMemory");
+      BeginCommandBuffer = (PFN_vkBeginCommandBuffer) NextGetDeviceProcAddr(device, "vkBeginCommandBuffer");
+      BindAccelerationStructureMemoryNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkBindAccelerationStructureMemoryNV) NextGetDeviceProcAddr(device, "vkBindAccelerationStructureMemoryNV")
+        : nullptr;
+      BindBufferMemory = (PFN_vkBindBufferMemory) NextGetDeviceProcAddr(device, "vkBindBufferMemory");
+      BindBufferMemory2 = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkBindBufferMemory2) NextGetDeviceProcAddr(device, "vkBindBufferMemory2")
+        : nullptr;
+      BindBufferMemory2KHR = enabled.Has(procaddr::DeviceExtension::KHR_bind_memory2)
+        ? (PFN_vkBindBufferMemory2KHR) NextGetDeviceProcAddr(device, "vkBindBufferMemory2KHR")
+        : nullptr;
+      BindImageMemory = (PFN_vkBindImageMemory) NextGetDeviceProcAddr(device, "vkBindImageMemory");
+      BindImageMemory2 = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkBindImageMemory2) NextGetDeviceProcAddr(device, "vkBindImageMemory2")
+        : nullptr;
+      BindImageMemory2KHR = enabled.Has(procaddr::DeviceExtension::KHR_bind_memory2)
+        ? (PFN_vkBindImageMemory2KHR) NextGetDeviceProcAddr(device, "vkBindImageMemory2KHR")
+        : nullptr;
+      BindOpticalFlowSessionImageNV = enabled.Has(procaddr::DeviceExtension::NV_optical_flow)
+        ? (PFN_vkBindOpticalFlowSessionImageNV) NextGetDeviceProcAddr(device, "vkBindOpticalFlowSessionImageNV")
+        : nullptr;
+      BindVideoSessionMemoryKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkBindVideoSessionMemoryKHR) NextGetDeviceProcAddr(device, "vkBindVideoSessionMemoryKHR")
+        : nullptr;
+      BuildAccelerationStructuresKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkBuildAccelerationStructuresKHR) NextGetDeviceProcAddr(device, "vkBuildAccelerationStructuresKHR")
+        : nullptr;
+      BuildMicromapsEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkBuildMicromapsEXT) NextGetDeviceProcAddr(device, "vkBuildMicromapsEXT")
+        : nullptr;
+      CmdBeginConditionalRenderingEXT = enabled.Has(procaddr::DeviceExtension::EXT_conditional_rendering)
+        ? (PFN_vkCmdBeginConditionalRenderingEXT) NextGetDeviceProcAddr(device, "vkCmdBeginConditionalRenderingEXT")
+        : nullptr;
+      CmdBeginDebugUtilsLabelEXT = (PFN_vkCmdBeginDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkCmdBeginDebugUtilsLabelEXT");
+      CmdBeginQuery = (PFN_vkCmdBeginQuery) NextGetDeviceProcAddr(device, "vkCmdBeginQuery");
+      CmdBeginQueryIndexedEXT = enabled.Has(procaddr::DeviceExtension::EXT_transform_feedback)
+        ? (PFN_vkCmdBeginQueryIndexedEXT) NextGetDeviceProcAddr(device, "vkCmdBeginQueryIndexedEXT")
+        : nullptr;
+      CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) NextGetDeviceProcAddr(device, "vkCmdBeginRenderPass");
+      CmdBeginRenderPass2 = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkCmdBeginRenderPass2) NextGetDeviceProcAddr(device, "vkCmdBeginRenderPass2")
+        : nullptr;
+      CmdBeginRenderPass2KHR = enabled.Has(procaddr::DeviceExtension::KHR_create_renderpass2)
+        ? (PFN_vkCmdBeginRenderPass2KHR) NextGetDeviceProcAddr(device, "vkCmdBeginRenderPass2KHR")
+        : nullptr;
+      CmdBeginRendering = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdBeginRendering) NextGetDeviceProcAddr(device, "vkCmdBeginRendering")
+        : nullptr;
+      CmdBeginRenderingKHR = enabled.Has(procaddr::DeviceExtension::KHR_dynamic_rendering)
+        ? (PFN_vkCmdBeginRenderingKHR) NextGetDeviceProcAddr(device, "vkCmdBeginRenderingKHR")
+        : nullptr;
+      CmdBeginTransformFeedbackEXT = enabled.Has(procaddr::DeviceExtension::EXT_transform_feedback)
+        ? (PFN_vkCmdBeginTransformFeedbackEXT) NextGetDeviceProcAddr(device, "vkCmdBeginTransformFeedbackEXT")
+        : nullptr;
+      CmdBeginVideoCodingKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkCmdBeginVideoCodingKHR) NextGetDeviceProcAddr(device, "vkCmdBeginVideoCodingKHR")
+        : nullptr;
+      CmdBindDescriptorBufferEmbeddedSamplersEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT) NextGetDeviceProcAddr(device, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT")
+        : nullptr;
+      CmdBindDescriptorBuffersEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkCmdBindDescriptorBuffersEXT) NextGetDeviceProcAddr(device, "vkCmdBindDescriptorBuffersEXT")
+        : nullptr;
+      CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) NextGetDeviceProcAddr(device, "vkCmdBindDescriptorSets");
+      CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) NextGetDeviceProcAddr(device, "vkCmdBindIndexBuffer");
+      CmdBindInvocationMaskHUAWEI = enabled.Has(procaddr::DeviceExtension::HUAWEI_invocation_mask)
+        ? (PFN_vkCmdBindInvocationMaskHUAWEI) NextGetDeviceProcAddr(device, "vkCmdBindInvocationMaskHUAWEI")
+        : nullptr;
+      CmdBindPipeline = (PFN_vkCmdBindPipeline) NextGetDeviceProcAddr(device, "vkCmdBindPipeline");
+      CmdBindPipelineShaderGroupNV = enabled.Has(procaddr::DeviceExtension::NV_device_generated_commands)
+        ? (PFN_vkCmdBindPipelineShaderGroupNV) NextGetDeviceProcAddr(device, "vkCmdBindPipelineShaderGroupNV")
+        : nullptr;
+      CmdBindShadersEXT = enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdBindShadersEXT) NextGetDeviceProcAddr(device, "vkCmdBindShadersEXT")
+        : nullptr;
+      CmdBindShadingRateImageNV = enabled.Has(procaddr::DeviceExtension::NV_shading_rate_image)
+        ? (PFN_vkCmdBindShadingRateImageNV) NextGetDeviceProcAddr(device, "vkCmdBindShadingRateImageNV")
+        : nullptr;
+      CmdBindTransformFeedbackBuffersEXT = enabled.Has(procaddr::DeviceExtension::EXT_transform_feedback)
+        ? (PFN_vkCmdBindTransformFeedbackBuffersEXT) NextGetDeviceProcAddr(device, "vkCmdBindTransformFeedbackBuffersEXT")
+        : nullptr;
+      CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) NextGetDeviceProcAddr(device, "vkCmdBindVertexBuffers");
+      CmdBindVertexBuffers2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdBindVertexBuffers2) NextGetDeviceProcAddr(device, "vkCmdBindVertexBuffers2")
+        : nullptr;
+      CmdBindVertexBuffers2EXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdBindVertexBuffers2EXT) NextGetDeviceProcAddr(device, "vkCmdBindVertexBuffers2EXT")
+        : nullptr;
+      CmdBlitImage = (PFN_vkCmdBlitImage) NextGetDeviceProcAddr(device, "vkCmdBlitImage");
+      CmdBlitImage2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdBlitImage2) NextGetDeviceProcAddr(device, "vkCmdBlitImage2")
+        : nullptr;
+      CmdBlitImage2KHR = enabled.Has(procaddr::DeviceExtension::KHR_copy_commands2)
+        ? (PFN_vkCmdBlitImage2KHR) NextGetDeviceProcAddr(device, "vkCmdBlitImage2KHR")
+        : nullptr;
+      CmdBuildAccelerationStructureNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCmdBuildAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkCmdBuildAccelerationStructureNV")
+        : nullptr;
+      CmdBuildAccelerationStructuresIndirectKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCmdBuildAccelerationStructuresIndirectKHR) NextGetDeviceProcAddr(device, "vkCmdBuildAccelerationStructuresIndirectKHR")
+        : nullptr;
+      CmdBuildAccelerationStructuresKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCmdBuildAccelerationStructuresKHR) NextGetDeviceProcAddr(device, "vkCmdBuildAccelerationStructuresKHR")
+        : nullptr;
+      CmdBuildMicromapsEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCmdBuildMicromapsEXT) NextGetDeviceProcAddr(device, "vkCmdBuildMicromapsEXT")
+        : nullptr;
+      CmdClearAttachments = (PFN_vkCmdClearAttachments) NextGetDeviceProcAddr(device, "vkCmdClearAttachments");
+      CmdClearColorImage = (PFN_vkCmdClearColorImage) NextGetDeviceProcAddr(device, "vkCmdClearColorImage");
+      CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) NextGetDeviceProcAddr(device, "vkCmdClearDepthStencilImage");
+      CmdControlVideoCodingKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkCmdControlVideoCodingKHR) NextGetDeviceProcAddr(device, "vkCmdControlVideoCodingKHR")
+        : nullptr;
+      CmdCopyAccelerationStructureKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCmdCopyAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCmdCopyAccelerationStructureKHR")
+        : nullptr;
+      CmdCopyAccelerationStructureNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCmdCopyAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkCmdCopyAccelerationStructureNV")
+        : nullptr;
+      CmdCopyAccelerationStructureToMemoryKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCmdCopyAccelerationStructureToMemoryKHR) NextGetDeviceProcAddr(device, "vkCmdCopyAccelerationStructureToMemoryKHR")
+        : nullptr;
+      CmdCopyBuffer = (PFN_vkCmdCopyBuffer) NextGetDeviceProcAddr(device, "vkCmdCopyBuffer");
+      CmdCopyBuffer2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdCopyBuffer2) NextGetDeviceProcAddr(device, "vkCmdCopyBuffer2")
+        : nullptr;
+      CmdCopyBuffer2KHR = enabled.Has(procaddr::DeviceExtension::KHR_copy_commands2)
+        ? (PFN_vkCmdCopyBuffer2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyBuffer2KHR")
+        : nullptr;
+      CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) NextGetDeviceProcAddr(device, "vkCmdCopyBufferToImage");
+      CmdCopyBufferToImage2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdCopyBufferToImage2) NextGetDeviceProcAddr(device, "vkCmdCopyBufferToImage2")
+        : nullptr;
+      CmdCopyBufferToImage2KHR = enabled.Has(procaddr::DeviceExtension::KHR_copy_commands2)
+        ? (PFN_vkCmdCopyBufferToImage2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyBufferToImage2KHR")
+        : nullptr;
+      CmdCopyImage = (PFN_vkCmdCopyImage) NextGetDeviceProcAddr(device, "vkCmdCopyImage");
+      CmdCopyImage2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdCopyImage2) NextGetDeviceProcAddr(device, "vkCmdCopyImage2")
+        : nullptr;
+      CmdCopyImage2KHR = enabled.Has(procaddr::DeviceExtension::KHR_copy_commands2)
+        ? (PFN_vkCmdCopyImage2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyImage2KHR")
+        : nullptr;
+      CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) NextGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer");
+      CmdCopyImageToBuffer2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdCopyImageToBuffer2) NextGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer2")
+        : nullptr;
+      CmdCopyImageToBuffer2KHR = enabled.Has(procaddr::DeviceExtension::KHR_copy_commands2)
+        ? (PFN_vkCmdCopyImageToBuffer2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer2KHR")
+        : nullptr;
+      CmdCopyMemoryIndirectNV = enabled.Has(procaddr::DeviceExtension::NV_copy_memory_indirect)
+        ? (PFN_vkCmdCopyMemoryIndirectNV) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryIndirectNV")
+        : nullptr;
+      CmdCopyMemoryToAccelerationStructureKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCmdCopyMemoryToAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryToAccelerationStructureKHR")
+        : nullptr;
+      CmdCopyMemoryToImageIndirectNV = enabled.Has(procaddr::DeviceExtension::NV_copy_memory_indirect)
+        ? (PFN_vkCmdCopyMemoryToImageIndirectNV) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryToImageIndirectNV")
+        : nullptr;
+      CmdCopyMemoryToMicromapEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCmdCopyMemoryToMicromapEXT) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryToMicromapEXT")
+        : nullptr;
+      CmdCopyMicromapEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCmdCopyMicromapEXT) NextGetDeviceProcAddr(device, "vkCmdCopyMicromapEXT")
+        : nullptr;
+      CmdCopyMicromapToMemoryEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCmdCopyMicromapToMemoryEXT) NextGetDeviceProcAddr(device, "vkCmdCopyMicromapToMemoryEXT")
+        : nullptr;
+      CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) NextGetDeviceProcAddr(device, "vkCmdCopyQueryPoolResults");
+      CmdDebugMarkerBeginEXT = enabled.Has(procaddr::DeviceExtension::EXT_debug_marker)
+        ? (PFN_vkCmdDebugMarkerBeginEXT) NextGetDeviceProcAddr(device, "vkCmdDebugMarkerBeginEXT")
+        : nullptr;
+      CmdDebugMarkerEndEXT = enabled.Has(procaddr::DeviceExtension::EXT_debug_marker)
+        ? (PFN_vkCmdDebugMarkerEndEXT) NextGetDeviceProcAddr(device, "vkCmdDebugMarkerEndEXT")
+        : nullptr;
+      CmdDebugMarkerInsertEXT = enabled.Has(procaddr::DeviceExtension::EXT_debug_marker)
+        ? (PFN_vkCmdDebugMarkerInsertEXT) NextGetDeviceProcAddr(device, "vkCmdDebugMarkerInsertEXT")
+        : nullptr;
+      CmdDecodeVideoKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_decode_queue)
+        ? (PFN_vkCmdDecodeVideoKHR) NextGetDeviceProcAddr(device, "vkCmdDecodeVideoKHR")
+        : nullptr;
+      CmdDecompressMemoryIndirectCountNV = enabled.Has(procaddr::DeviceExtension::NV_memory_decompression)
+        ? (PFN_vkCmdDecompressMemoryIndirectCountNV) NextGetDeviceProcAddr(device, "vkCmdDecompressMemoryIndirectCountNV")
+        : nullptr;
+      CmdDecompressMemoryNV = enabled.Has(procaddr::DeviceExtension::NV_memory_decompression)
+        ? (PFN_vkCmdDecompressMemoryNV) NextGetDeviceProcAddr(device, "vkCmdDecompressMemoryNV")
+        : nullptr;
+      CmdDispatch = (PFN_vkCmdDispatch) NextGetDeviceProcAddr(device, "vkCmdDispatch");
+      CmdDispatchBase = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkCmdDispatchBase) NextGetDeviceProcAddr(device, "vkCmdDispatchBase")
+        : nullptr;
+      CmdDispatchBaseKHR = enabled.Has(procaddr::DeviceExtension::KHR_device_group)
+        ? (PFN_vkCmdDispatchBaseKHR) NextGetDeviceProcAddr(device, "vkCmdDispatchBaseKHR")
+        : nullptr;
+      CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) NextGetDeviceProcAddr(device, "vkCmdDispatchIndirect");
+      CmdDraw = (PFN_vkCmdDraw) NextGetDeviceProcAddr(device, "vkCmdDraw");
+      CmdDrawClusterHUAWEI = enabled.Has(procaddr::DeviceExtension::HUAWEI_cluster_culling_shader)
+        ? (PFN_vkCmdDrawClusterHUAWEI) NextGetDeviceProcAddr(device, "vkCmdDrawClusterHUAWEI")
+        : nullptr;
+      CmdDrawClusterIndirectHUAWEI = enabled.Has(procaddr::DeviceExtension::HUAWEI_cluster_culling_shader)
+        ? (PFN_vkCmdDrawClusterIndirectHUAWEI) NextGetDeviceProcAddr(device, "vkCmdDrawClusterIndirectHUAWEI")
+        : nullptr;
+      CmdDrawIndexed = (PFN_vkCmdDrawIndexed) NextGetDeviceProcAddr(device, "vkCmdDrawIndexed");
+      CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirect");
+      CmdDrawIndexedIndirectCount = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkCmdDrawIndexedIndirectCount) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCount")
+        : nullptr;
+      CmdDrawIndexedIndirectCountAMD = enabled.Has(procaddr::DeviceExtension::AMD_draw_indirect_count)
+        ? (PFN_vkCmdDrawIndexedIndirectCountAMD) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCountAMD")
+        : nullptr;
+      CmdDrawIndexedIndirectCountKHR = enabled.Has(procaddr::DeviceExtension::KHR_draw_indirect_count)
+        ? (PFN_vkCmdDrawIndexedIndirectCountKHR) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCountKHR")
+        : nullptr;
+      CmdDrawIndirect = (PFN_vkCmdDrawIndirect) NextGetDeviceProcAddr(device, "vkCmdDrawIndirect");
+      CmdDrawIndirectByteCountEXT = enabled.Has(procaddr::DeviceExtension::EXT_transform_feedback)
+        ? (PFN_vkCmdDrawIndirectByteCountEXT) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectByteCountEXT")
+        : nullptr;
+      CmdDrawIndirectCount = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkCmdDrawIndirectCount) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectCount")
+        : nullptr;
+      CmdDrawIndirectCountAMD = enabled.Has(procaddr::DeviceExtension::AMD_draw_indirect_count)
+        ? (PFN_vkCmdDrawIndirectCountAMD) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectCountAMD")
+        : nullptr;
+      CmdDrawIndirectCountKHR = enabled.Has(procaddr::DeviceExtension::KHR_draw_indirect_count)
+        ? (PFN_vkCmdDrawIndirectCountKHR) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectCountKHR")
+        : nullptr;
+      CmdDrawMeshTasksEXT = enabled.Has(procaddr::DeviceExtension::EXT_mesh_shader)
+        ? (PFN_vkCmdDrawMeshTasksEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksEXT")
+        : nullptr;
+      CmdDrawMeshTasksIndirectCountEXT = enabled.Has(procaddr::DeviceExtension::EXT_mesh_shader)
+        ? (PFN_vkCmdDrawMeshTasksIndirectCountEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectCountEXT")
+        : nullptr;
+      CmdDrawMeshTasksIndirectCountNV = enabled.Has(procaddr::DeviceExtension::NV_mesh_shader)
+        ? (PFN_vkCmdDrawMeshTasksIndirectCountNV) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectCountNV")
+        : nullptr;
+      CmdDrawMeshTasksIndirectEXT = enabled.Has(procaddr::DeviceExtension::EXT_mesh_shader)
+        ? (PFN_vkCmdDrawMeshTasksIndirectEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectEXT")
+        : nullptr;
+      CmdDrawMeshTasksIndirectNV = enabled.Has(procaddr::DeviceExtension::NV_mesh_shader)
+        ? (PFN_vkCmdDrawMeshTasksIndirectNV) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectNV")
+        : nullptr;
+      CmdDrawMeshTasksNV = enabled.Has(procaddr::DeviceExtension::NV_mesh_shader)
+        ? (PFN_vkCmdDrawMeshTasksNV) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksNV")
+        : nullptr;
+      CmdDrawMultiEXT = enabled.Has(procaddr::DeviceExtension::EXT_multi_draw)
+        ? (PFN_vkCmdDrawMultiEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMultiEXT")
+        : nullptr;
+      CmdDrawMultiIndexedEXT = enabled.Has(procaddr::DeviceExtension::EXT_multi_draw)
+        ? (PFN_vkCmdDrawMultiIndexedEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMultiIndexedEXT")
+        : nullptr;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      CmdEncodeVideoKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_encode_queue)
+        ? (PFN_vkCmdEncodeVideoKHR) NextGetDeviceProcAddr(device, "vkCmdEncodeVideoKHR")
+        : nullptr;
+#endif
+      CmdEndConditionalRenderingEXT = enabled.Has(procaddr::DeviceExtension::EXT_conditional_rendering)
+        ? (PFN_vkCmdEndConditionalRenderingEXT) NextGetDeviceProcAddr(device, "vkCmdEndConditionalRenderingEXT")
+        : nullptr;
+      CmdEndDebugUtilsLabelEXT = (PFN_vkCmdEndDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkCmdEndDebugUtilsLabelEXT");
+      CmdEndQuery = (PFN_vkCmdEndQuery) NextGetDeviceProcAddr(device, "vkCmdEndQuery");
+      CmdEndQueryIndexedEXT = enabled.Has(procaddr::DeviceExtension::EXT_transform_feedback)
+        ? (PFN_vkCmdEndQueryIndexedEXT) NextGetDeviceProcAddr(device, "vkCmdEndQueryIndexedEXT")
+        : nullptr;
+      CmdEndRenderPass = (PFN_vkCmdEndRenderPass) NextGetDeviceProcAddr(device, "vkCmdEndRenderPass");
+      CmdEndRenderPass2 = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkCmdEndRenderPass2) NextGetDeviceProcAddr(device, "vkCmdEndRenderPass2")
+        : nullptr;
+      CmdEndRenderPass2KHR = enabled.Has(procaddr::DeviceExtension::KHR_create_renderpass2)
+        ? (PFN_vkCmdEndRenderPass2KHR) NextGetDeviceProcAddr(device, "vkCmdEndRenderPass2KHR")
+        : nullptr;
+      CmdEndRendering = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdEndRendering) NextGetDeviceProcAddr(device, "vkCmdEndRendering")
+        : nullptr;
+      CmdEndRenderingKHR = enabled.Has(procaddr::DeviceExtension::KHR_dynamic_rendering)
+        ? (PFN_vkCmdEndRenderingKHR) NextGetDeviceProcAddr(device, "vkCmdEndRenderingKHR")
+        : nullptr;
+      CmdEndTransformFeedbackEXT = enabled.Has(procaddr::DeviceExtension::EXT_transform_feedback)
+        ? (PFN_vkCmdEndTransformFeedbackEXT) NextGetDeviceProcAddr(device, "vkCmdEndTransformFeedbackEXT")
+        : nullptr;
+      CmdEndVideoCodingKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkCmdEndVideoCodingKHR) NextGetDeviceProcAddr(device, "vkCmdEndVideoCodingKHR")
+        : nullptr;
+      CmdExecuteCommands = (PFN_vkCmdExecuteCommands) NextGetDeviceProcAddr(device, "vkCmdExecuteCommands");
+      CmdExecuteGeneratedCommandsNV = enabled.Has(procaddr::DeviceExtension::NV_device_generated_commands)
+        ? (PFN_vkCmdExecuteGeneratedCommandsNV) NextGetDeviceProcAddr(device, "vkCmdExecuteGeneratedCommandsNV")
+        : nullptr;
+      CmdFillBuffer = (PFN_vkCmdFillBuffer) NextGetDeviceProcAddr(device, "vkCmdFillBuffer");
+      CmdInsertDebugUtilsLabelEXT = (PFN_vkCmdInsertDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkCmdInsertDebugUtilsLabelEXT");
+      CmdNextSubpass = (PFN_vkCmdNextSubpass) NextGetDeviceProcAddr(device, "vkCmdNextSubpass");
+      CmdNextSubpass2 = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkCmdNextSubpass2) NextGetDeviceProcAddr(device, "vkCmdNextSubpass2")
+        : nullptr;
+      CmdNextSubpass2KHR = enabled.Has(procaddr::DeviceExtension::KHR_create_renderpass2)
+        ? (PFN_vkCmdNextSubpass2KHR) NextGetDeviceProcAddr(device, "vkCmdNextSubpass2KHR")
+        : nullptr;
+      CmdOpticalFlowExecuteNV = enabled.Has(procaddr::DeviceExtension::NV_optical_flow)
+        ? (PFN_vkCmdOpticalFlowExecuteNV) NextGetDeviceProcAddr(device, "vkCmdOpticalFlowExecuteNV")
+        : nullptr;
+      CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) NextGetDeviceProcAddr(device, "vkCmdPipelineBarrier");
+      CmdPipelineBarrier2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdPipelineBarrier2) NextGetDeviceProcAddr(device, "vkCmdPipelineBarrier2")
+        : nullptr;
+      CmdPipelineBarrier2KHR = enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkCmdPipelineBarrier2KHR) NextGetDeviceProcAddr(device, "vkCmdPipelineBarrier2KHR")
+        : nullptr;
+      CmdPreprocessGeneratedCommandsNV = enabled.Has(procaddr::DeviceExtension::NV_device_generated_commands)
+        ? (PFN_vkCmdPreprocessGeneratedCommandsNV) NextGetDeviceProcAddr(device, "vkCmdPreprocessGeneratedCommandsNV")
+        : nullptr;
+      CmdPushConstants = (PFN_vkCmdPushConstants) NextGetDeviceProcAddr(device, "vkCmdPushConstants");
+      CmdPushDescriptorSetKHR = enabled.Has(procaddr::DeviceExtension::KHR_push_descriptor)
+        ? (PFN_vkCmdPushDescriptorSetKHR) NextGetDeviceProcAddr(device, "vkCmdPushDescriptorSetKHR")
+        : nullptr;
+      CmdPushDescriptorSetWithTemplateKHR = enabled.Has(procaddr::DeviceExtension::KHR_push_descriptor) || enabled.Has(procaddr::DeviceExtension::KHR_descriptor_update_template)
+        ? (PFN_vkCmdPushDescriptorSetWithTemplateKHR) NextGetDeviceProcAddr(device, "vkCmdPushDescriptorSetWithTemplateKHR")
+        : nullptr;
+      CmdResetEvent = (PFN_vkCmdResetEvent) NextGetDeviceProcAddr(device, "vkCmdResetEvent");
+      CmdResetEvent2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdResetEvent2) NextGetDeviceProcAddr(device, "vkCmdResetEvent2")
+        : nullptr;
+      CmdResetEvent2KHR = enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkCmdResetEvent2KHR) NextGetDeviceProcAddr(device, "vkCmdResetEvent2KHR")
+        : nullptr;
+      CmdResetQueryPool = (PFN_vkCmdResetQueryPool) NextGetDeviceProcAddr(device, "vkCmdResetQueryPool");
+      CmdResolveImage = (PFN_vkCmdResolveImage) NextGetDeviceProcAddr(device, "vkCmdResolveImage");
+      CmdResolveImage2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdResolveImage2) NextGetDeviceProcAddr(device, "vkCmdResolveImage2")
+        : nullptr;
+      CmdResolveImage2KHR = enabled.Has(procaddr::DeviceExtension::KHR_copy_commands2)
+        ? (PFN_vkCmdResolveImage2KHR) NextGetDeviceProcAddr(device, "vkCmdResolveImage2KHR")
+        : nullptr;
+      CmdSetAlphaToCoverageEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetAlphaToCoverageEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetAlphaToCoverageEnableEXT")
+        : nullptr;
+      CmdSetAlphaToOneEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetAlphaToOneEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetAlphaToOneEnableEXT")
+        : nullptr;
+      CmdSetAttachmentFeedbackLoopEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_attachment_feedback_loop_dynamic_state)
+        ? (PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetAttachmentFeedbackLoopEnableEXT")
+        : nullptr;
+      CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) NextGetDeviceProcAddr(device, "vkCmdSetBlendConstants");
+      CmdSetCheckpointNV = enabled.Has(procaddr::DeviceExtension::NV_device_diagnostic_checkpoints)
+        ? (PFN_vkCmdSetCheckpointNV) NextGetDeviceProcAddr(device, "vkCmdSetCheckpointNV")
+        : nullptr;
+      CmdSetCoarseSampleOrderNV = enabled.Has(procaddr::DeviceExtension::NV_shading_rate_image)
+        ? (PFN_vkCmdSetCoarseSampleOrderNV) NextGetDeviceProcAddr(device, "vkCmdSetCoarseSampleOrderNV")
+        : nullptr;
+      CmdSetColorBlendAdvancedEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetColorBlendAdvancedEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorBlendAdvancedEXT")
+        : nullptr;
+      CmdSetColorBlendEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetColorBlendEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorBlendEnableEXT")
+        : nullptr;
+      CmdSetColorBlendEquationEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetColorBlendEquationEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorBlendEquationEXT")
+        : nullptr;
+      CmdSetColorWriteEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_color_write_enable)
+        ? (PFN_vkCmdSetColorWriteEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorWriteEnableEXT")
+        : nullptr;
+      CmdSetColorWriteMaskEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetColorWriteMaskEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorWriteMaskEXT")
+        : nullptr;
+      CmdSetConservativeRasterizationModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetConservativeRasterizationModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetConservativeRasterizationModeEXT")
+        : nullptr;
+      CmdSetCoverageModulationModeNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCoverageModulationModeNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageModulationModeNV")
+        : nullptr;
+      CmdSetCoverageModulationTableEnableNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCoverageModulationTableEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageModulationTableEnableNV")
+        : nullptr;
+      CmdSetCoverageModulationTableNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCoverageModulationTableNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageModulationTableNV")
+        : nullptr;
+      CmdSetCoverageReductionModeNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCoverageReductionModeNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageReductionModeNV")
+        : nullptr;
+      CmdSetCoverageToColorEnableNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCoverageToColorEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageToColorEnableNV")
+        : nullptr;
+      CmdSetCoverageToColorLocationNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCoverageToColorLocationNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageToColorLocationNV")
+        : nullptr;
+      CmdSetCullMode = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetCullMode) NextGetDeviceProcAddr(device, "vkCmdSetCullMode")
+        : nullptr;
+      CmdSetCullModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetCullModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetCullModeEXT")
+        : nullptr;
+      CmdSetDepthBias = (PFN_vkCmdSetDepthBias) NextGetDeviceProcAddr(device, "vkCmdSetDepthBias");
+      CmdSetDepthBiasEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetDepthBiasEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthBiasEnable")
+        : nullptr;
+      CmdSetDepthBiasEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state2) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthBiasEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthBiasEnableEXT")
+        : nullptr;
+      CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) NextGetDeviceProcAddr(device, "vkCmdSetDepthBounds");
+      CmdSetDepthBoundsTestEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetDepthBoundsTestEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthBoundsTestEnable")
+        : nullptr;
+      CmdSetDepthBoundsTestEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthBoundsTestEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthBoundsTestEnableEXT")
+        : nullptr;
+      CmdSetDepthClampEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthClampEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthClampEnableEXT")
+        : nullptr;
+      CmdSetDepthClipEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthClipEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthClipEnableEXT")
+        : nullptr;
+      CmdSetDepthClipNegativeOneToOneEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthClipNegativeOneToOneEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthClipNegativeOneToOneEXT")
+        : nullptr;
+      CmdSetDepthCompareOp = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetDepthCompareOp) NextGetDeviceProcAddr(device, "vkCmdSetDepthCompareOp")
+        : nullptr;
+      CmdSetDepthCompareOpEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthCompareOpEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthCompareOpEXT")
+        : nullptr;
+      CmdSetDepthTestEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetDepthTestEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthTestEnable")
+        : nullptr;
+      CmdSetDepthTestEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthTestEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthTestEnableEXT")
+        : nullptr;
+      CmdSetDepthWriteEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetDepthWriteEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthWriteEnable")
+        : nullptr;
+      CmdSetDepthWriteEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetDepthWriteEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthWriteEnableEXT")
+        : nullptr;
+      CmdSetDescriptorBufferOffsetsEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkCmdSetDescriptorBufferOffsetsEXT) NextGetDeviceProcAddr(device, "vkCmdSetDescriptorBufferOffsetsEXT")
+        : nullptr;
+      CmdSetDeviceMask = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkCmdSetDeviceMask) NextGetDeviceProcAddr(device, "vkCmdSetDeviceMask")
+        : nullptr;
+      CmdSetDeviceMaskKHR = enabled.Has(procaddr::DeviceExtension::KHR_device_group)
+        ? (PFN_vkCmdSetDeviceMaskKHR) NextGetDeviceProcAddr(device, "vkCmdSetDeviceMaskKHR")
+        : nullptr;
+      CmdSetDiscardRectangleEXT = enabled.Has(procaddr::DeviceExtension::EXT_discard_rectangles)
+        ? (PFN_vkCmdSetDiscardRectangleEXT) NextGetDeviceProcAddr(device, "vkCmdSetDiscardRectangleEXT")
+        : nullptr;
+      CmdSetDiscardRectangleEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_discard_rectangles)
+        ? (PFN_vkCmdSetDiscardRectangleEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDiscardRectangleEnableEXT")
+        : nullptr;
+      CmdSetDiscardRectangleModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_discard_rectangles)
+        ? (PFN_vkCmdSetDiscardRectangleModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetDiscardRectangleModeEXT")
+        : nullptr;
+      CmdSetEvent = (PFN_vkCmdSetEvent) NextGetDeviceProcAddr(device, "vkCmdSetEvent");
+      CmdSetEvent2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetEvent2) NextGetDeviceProcAddr(device, "vkCmdSetEvent2")
+        : nullptr;
+      CmdSetEvent2KHR = enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkCmdSetEvent2KHR) NextGetDeviceProcAddr(device, "vkCmdSetEvent2KHR")
+        : nullptr;
+      CmdSetExclusiveScissorEnableNV = enabled.Has(procaddr::DeviceExtension::NV_scissor_exclusive)
+        ? (PFN_vkCmdSetExclusiveScissorEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetExclusiveScissorEnableNV")
+        : nullptr;
+      CmdSetExclusiveScissorNV = enabled.Has(procaddr::DeviceExtension::NV_scissor_exclusive)
+        ? (PFN_vkCmdSetExclusiveScissorNV) NextGetDeviceProcAddr(device, "vkCmdSetExclusiveScissorNV")
+        : nullptr;
+      CmdSetExtraPrimitiveOverestimationSizeEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT) NextGetDeviceProcAddr(device, "vkCmdSetExtraPrimitiveOverestimationSizeEXT")
+        : nullptr;
+      CmdSetFragmentShadingRateEnumNV = enabled.Has(procaddr::DeviceExtension::NV_fragment_shading_rate_enums)
+        ? (PFN_vkCmdSetFragmentShadingRateEnumNV) NextGetDeviceProcAddr(device, "vkCmdSetFragmentShadingRateEnumNV")
+        : nullptr;
+      CmdSetFragmentShadingRateKHR = enabled.Has(procaddr::DeviceExtension::KHR_fragment_shading_rate)
+        ? (PFN_vkCmdSetFragmentShadingRateKHR) NextGetDeviceProcAddr(device, "vkCmdSetFragmentShadingRateKHR")
+        : nullptr;
+      CmdSetFrontFace = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetFrontFace) NextGetDeviceProcAddr(device, "vkCmdSetFrontFace")
+        : nullptr;
+      CmdSetFrontFaceEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetFrontFaceEXT) NextGetDeviceProcAddr(device, "vkCmdSetFrontFaceEXT")
+        : nullptr;
+      CmdSetLineRasterizationModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetLineRasterizationModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetLineRasterizationModeEXT")
+        : nullptr;
+      CmdSetLineStippleEXT = enabled.Has(procaddr::DeviceExtension::EXT_line_rasterization)
+        ? (PFN_vkCmdSetLineStippleEXT) NextGetDeviceProcAddr(device, "vkCmdSetLineStippleEXT")
+        : nullptr;
+      CmdSetLineStippleEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetLineStippleEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetLineStippleEnableEXT")
+        : nullptr;
+      CmdSetLineWidth = (PFN_vkCmdSetLineWidth) NextGetDeviceProcAddr(device, "vkCmdSetLineWidth");
+      CmdSetLogicOpEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state2) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetLogicOpEXT) NextGetDeviceProcAddr(device, "vkCmdSetLogicOpEXT")
+        : nullptr;
+      CmdSetLogicOpEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetLogicOpEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetLogicOpEnableEXT")
+        : nullptr;
+      CmdSetPatchControlPointsEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state2) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetPatchControlPointsEXT) NextGetDeviceProcAddr(device, "vkCmdSetPatchControlPointsEXT")
+        : nullptr;
+      CmdSetPerformanceMarkerINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkCmdSetPerformanceMarkerINTEL) NextGetDeviceProcAddr(device, "vkCmdSetPerformanceMarkerINTEL")
+        : nullptr;
+      CmdSetPerformanceOverrideINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkCmdSetPerformanceOverrideINTEL) NextGetDeviceProcAddr(device, "vkCmdSetPerformanceOverrideINTEL")
+        : nullptr;
+      CmdSetPerformanceStreamMarkerINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkCmdSetPerformanceStreamMarkerINTEL) NextGetDeviceProcAddr(device, "vkCmdSetPerformanceStreamMarkerINTEL")
+        : nullptr;
+      CmdSetPolygonModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetPolygonModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetPolygonModeEXT")
+        : nullptr;
+      CmdSetPrimitiveRestartEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetPrimitiveRestartEnable) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveRestartEnable")
+        : nullptr;
+      CmdSetPrimitiveRestartEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state2) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetPrimitiveRestartEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveRestartEnableEXT")
+        : nullptr;
+      CmdSetPrimitiveTopology = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetPrimitiveTopology) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveTopology")
+        : nullptr;
+      CmdSetPrimitiveTopologyEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetPrimitiveTopologyEXT) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveTopologyEXT")
+        : nullptr;
+      CmdSetProvokingVertexModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetProvokingVertexModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetProvokingVertexModeEXT")
+        : nullptr;
+      CmdSetRasterizationSamplesEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetRasterizationSamplesEXT) NextGetDeviceProcAddr(device, "vkCmdSetRasterizationSamplesEXT")
+        : nullptr;
+      CmdSetRasterizationStreamEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetRasterizationStreamEXT) NextGetDeviceProcAddr(device, "vkCmdSetRasterizationStreamEXT")
+        : nullptr;
+      CmdSetRasterizerDiscardEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetRasterizerDiscardEnable) NextGetDeviceProcAddr(device, "vkCmdSetRasterizerDiscardEnable")
+        : nullptr;
+      CmdSetRasterizerDiscardEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state2) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetRasterizerDiscardEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetRasterizerDiscardEnableEXT")
+        : nullptr;
+      CmdSetRayTracingPipelineStackSizeKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkCmdSetRayTracingPipelineStackSizeKHR) NextGetDeviceProcAddr(device, "vkCmdSetRayTracingPipelineStackSizeKHR")
+        : nullptr;
+      CmdSetRepresentativeFragmentTestEnableNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetRepresentativeFragmentTestEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetRepresentativeFragmentTestEnableNV")
+        : nullptr;
+      CmdSetSampleLocationsEXT = enabled.Has(procaddr::DeviceExtension::EXT_sample_locations)
+        ? (PFN_vkCmdSetSampleLocationsEXT) NextGetDeviceProcAddr(device, "vkCmdSetSampleLocationsEXT")
+        : nullptr;
+      CmdSetSampleLocationsEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetSampleLocationsEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetSampleLocationsEnableEXT")
+        : nullptr;
+      CmdSetSampleMaskEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetSampleMaskEXT) NextGetDeviceProcAddr(device, "vkCmdSetSampleMaskEXT")
+        : nullptr;
+      CmdSetScissor = (PFN_vkCmdSetScissor) NextGetDeviceProcAddr(device, "vkCmdSetScissor");
+      CmdSetScissorWithCount = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetScissorWithCount) NextGetDeviceProcAddr(device, "vkCmdSetScissorWithCount")
+        : nullptr;
+      CmdSetScissorWithCountEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetScissorWithCountEXT) NextGetDeviceProcAddr(device, "vkCmdSetScissorWithCountEXT")
+        : nullptr;
+      CmdSetShadingRateImageEnableNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetShadingRateImageEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetShadingRateImageEnableNV")
+        : nullptr;
+      CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) NextGetDeviceProcAddr(device, "vkCmdSetStencilCompareMask");
+      CmdSetStencilOp = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetStencilOp) NextGetDeviceProcAddr(device, "vkCmdSetStencilOp")
+        : nullptr;
+      CmdSetStencilOpEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetStencilOpEXT) NextGetDeviceProcAddr(device, "vkCmdSetStencilOpEXT")
+        : nullptr;
+      CmdSetStencilReference = (PFN_vkCmdSetStencilReference) NextGetDeviceProcAddr(device, "vkCmdSetStencilReference");
+      CmdSetStencilTestEnable = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetStencilTestEnable) NextGetDeviceProcAddr(device, "vkCmdSetStencilTestEnable")
+        : nullptr;
+      CmdSetStencilTestEnableEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetStencilTestEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetStencilTestEnableEXT")
+        : nullptr;
+      CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) NextGetDeviceProcAddr(device, "vkCmdSetStencilWriteMask");
+      CmdSetTessellationDomainOriginEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetTessellationDomainOriginEXT) NextGetDeviceProcAddr(device, "vkCmdSetTessellationDomainOriginEXT")
+        : nullptr;
+      CmdSetVertexInputEXT = enabled.Has(procaddr::DeviceExtension::EXT_vertex_input_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetVertexInputEXT) NextGetDeviceProcAddr(device, "vkCmdSetVertexInputEXT")
+        : nullptr;
+      CmdSetViewport = (PFN_vkCmdSetViewport) NextGetDeviceProcAddr(device, "vkCmdSetViewport");
+      CmdSetViewportShadingRatePaletteNV = enabled.Has(procaddr::DeviceExtension::NV_shading_rate_image)
+        ? (PFN_vkCmdSetViewportShadingRatePaletteNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportShadingRatePaletteNV")
+        : nullptr;
+      CmdSetViewportSwizzleNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetViewportSwizzleNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportSwizzleNV")
+        : nullptr;
+      CmdSetViewportWScalingEnableNV = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state3) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetViewportWScalingEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportWScalingEnableNV")
+        : nullptr;
+      CmdSetViewportWScalingNV = enabled.Has(procaddr::DeviceExtension::NV_clip_space_w_scaling)
+        ? (PFN_vkCmdSetViewportWScalingNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportWScalingNV")
+        : nullptr;
+      CmdSetViewportWithCount = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdSetViewportWithCount) NextGetDeviceProcAddr(device, "vkCmdSetViewportWithCount")
+        : nullptr;
+      CmdSetViewportWithCountEXT = enabled.Has(procaddr::DeviceExtension::EXT_extended_dynamic_state) || enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCmdSetViewportWithCountEXT) NextGetDeviceProcAddr(device, "vkCmdSetViewportWithCountEXT")
+        : nullptr;
+      CmdSubpassShadingHUAWEI = enabled.Has(procaddr::DeviceExtension::HUAWEI_subpass_shading)
+        ? (PFN_vkCmdSubpassShadingHUAWEI) NextGetDeviceProcAddr(device, "vkCmdSubpassShadingHUAWEI")
+        : nullptr;
+      CmdTraceRaysIndirect2KHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_maintenance1)
+        ? (PFN_vkCmdTraceRaysIndirect2KHR) NextGetDeviceProcAddr(device, "vkCmdTraceRaysIndirect2KHR")
+        : nullptr;
+      CmdTraceRaysIndirectKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkCmdTraceRaysIndirectKHR) NextGetDeviceProcAddr(device, "vkCmdTraceRaysIndirectKHR")
+        : nullptr;
+      CmdTraceRaysKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkCmdTraceRaysKHR) NextGetDeviceProcAddr(device, "vkCmdTraceRaysKHR")
+        : nullptr;
+      CmdTraceRaysNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCmdTraceRaysNV) NextGetDeviceProcAddr(device, "vkCmdTraceRaysNV")
+        : nullptr;
+      CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) NextGetDeviceProcAddr(device, "vkCmdUpdateBuffer");
+      CmdWaitEvents = (PFN_vkCmdWaitEvents) NextGetDeviceProcAddr(device, "vkCmdWaitEvents");
+      CmdWaitEvents2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdWaitEvents2) NextGetDeviceProcAddr(device, "vkCmdWaitEvents2")
+        : nullptr;
+      CmdWaitEvents2KHR = enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkCmdWaitEvents2KHR) NextGetDeviceProcAddr(device, "vkCmdWaitEvents2KHR")
+        : nullptr;
+      CmdWriteAccelerationStructuresPropertiesKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCmdWriteAccelerationStructuresPropertiesKHR) NextGetDeviceProcAddr(device, "vkCmdWriteAccelerationStructuresPropertiesKHR")
+        : nullptr;
+      CmdWriteAccelerationStructuresPropertiesNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCmdWriteAccelerationStructuresPropertiesNV) NextGetDeviceProcAddr(device, "vkCmdWriteAccelerationStructuresPropertiesNV")
+        : nullptr;
+      CmdWriteBufferMarker2AMD = enabled.Has(procaddr::DeviceExtension::AMD_buffer_marker) || enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkCmdWriteBufferMarker2AMD) NextGetDeviceProcAddr(device, "vkCmdWriteBufferMarker2AMD")
+        : nullptr;
+      CmdWriteBufferMarkerAMD = enabled.Has(procaddr::DeviceExtension::AMD_buffer_marker)
+        ? (PFN_vkCmdWriteBufferMarkerAMD) NextGetDeviceProcAddr(device, "vkCmdWriteBufferMarkerAMD")
+        : nullptr;
+      CmdWriteMicromapsPropertiesEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCmdWriteMicromapsPropertiesEXT) NextGetDeviceProcAddr(device, "vkCmdWriteMicromapsPropertiesEXT")
+        : nullptr;
+      CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) NextGetDeviceProcAddr(device, "vkCmdWriteTimestamp");
+      CmdWriteTimestamp2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCmdWriteTimestamp2) NextGetDeviceProcAddr(device, "vkCmdWriteTimestamp2")
+        : nullptr;
+      CmdWriteTimestamp2KHR = enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkCmdWriteTimestamp2KHR) NextGetDeviceProcAddr(device, "vkCmdWriteTimestamp2KHR")
+        : nullptr;
+      CompileDeferredNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCompileDeferredNV) NextGetDeviceProcAddr(device, "vkCompileDeferredNV")
+        : nullptr;
+      CopyAccelerationStructureKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCopyAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCopyAccelerationStructureKHR")
+        : nullptr;
+      CopyAccelerationStructureToMemoryKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCopyAccelerationStructureToMemoryKHR) NextGetDeviceProcAddr(device, "vkCopyAccelerationStructureToMemoryKHR")
+        : nullptr;
+      CopyMemoryToAccelerationStructureKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCopyMemoryToAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCopyMemoryToAccelerationStructureKHR")
+        : nullptr;
+      CopyMemoryToMicromapEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCopyMemoryToMicromapEXT) NextGetDeviceProcAddr(device, "vkCopyMemoryToMicromapEXT")
+        : nullptr;
+      CopyMicromapEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCopyMicromapEXT) NextGetDeviceProcAddr(device, "vkCopyMicromapEXT")
+        : nullptr;
+      CopyMicromapToMemoryEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCopyMicromapToMemoryEXT) NextGetDeviceProcAddr(device, "vkCopyMicromapToMemoryEXT")
+        : nullptr;
+      CreateAccelerationStructureKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkCreateAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCreateAccelerationStructureKHR")
+        : nullptr;
+      CreateAccelerationStructureNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCreateAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkCreateAccelerationStructureNV")
+        : nullptr;
+      CreateBuffer = (PFN_vkCreateBuffer) NextGetDeviceProcAddr(device, "vkCreateBuffer");
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      CreateBufferCollectionFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_buffer_collection)
+        ? (PFN_vkCreateBufferCollectionFUCHSIA) NextGetDeviceProcAddr(device, "vkCreateBufferCollectionFUCHSIA")
+        : nullptr;
+#endif
+      CreateBufferView = (PFN_vkCreateBufferView) NextGetDeviceProcAddr(device, "vkCreateBufferView");
+      CreateCommandPool = (PFN_vkCreateCommandPool) NextGetDeviceProcAddr(device, "vkCreateCommandPool");
+      CreateComputePipelines = (PFN_vkCreateComputePipelines) NextGetDeviceProcAddr(device, "vkCreateComputePipelines");
+      CreateDeferredOperationKHR = enabled.Has(procaddr::DeviceExtension::KHR_deferred_host_operations)
+        ? (PFN_vkCreateDeferredOperationKHR) NextGetDeviceProcAddr(device, "vkCreateDeferredOperationKHR")
+        : nullptr;
+      CreateDescriptorPool = (PFN_vkCreateDescriptorPool) NextGetDeviceProcAddr(device, "vkCreateDescriptorPool");
+      CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) NextGetDeviceProcAddr(device, "vkCreateDescriptorSetLayout");
+      CreateDescriptorUpdateTemplate = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkCreateDescriptorUpdateTemplate) NextGetDeviceProcAddr(device, "vkCreateDescriptorUpdateTemplate")
+        : nullptr;
+      CreateDescriptorUpdateTemplateKHR = enabled.Has(procaddr::DeviceExtension::KHR_descriptor_update_template)
+        ? (PFN_vkCreateDescriptorUpdateTemplateKHR) NextGetDeviceProcAddr(device, "vkCreateDescriptorUpdateTemplateKHR")
+        : nullptr;
+      CreateEvent = (PFN_vkCreateEvent) NextGetDeviceProcAddr(device, "vkCreateEvent");
+      CreateFence = (PFN_vkCreateFence) NextGetDeviceProcAddr(device, "vkCreateFence");
+      CreateFramebuffer = (PFN_vkCreateFramebuffer) NextGetDeviceProcAddr(device, "vkCreateFramebuffer");
+      CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) NextGetDeviceProcAddr(device, "vkCreateGraphicsPipelines");
+      CreateImage = (PFN_vkCreateImage) NextGetDeviceProcAddr(device, "vkCreateImage");
+      CreateImageView = (PFN_vkCreateImageView) NextGetDeviceProcAddr(device, "vkCreateImageView");
+      CreateIndirectCommandsLayoutNV = enabled.Has(procaddr::DeviceExtension::NV_device_generated_commands)
+        ? (PFN_vkCreateIndirectCommandsLayoutNV) NextGetDeviceProcAddr(device, "vkCreateIndirectCommandsLayoutNV")
+        : nullptr;
+      CreateMicromapEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkCreateMicromapEXT) NextGetDeviceProcAddr(device, "vkCreateMicromapEXT")
+        : nullptr;
+      CreateOpticalFlowSessionNV = enabled.Has(procaddr::DeviceExtension::NV_optical_flow)
+        ? (PFN_vkCreateOpticalFlowSessionNV) NextGetDeviceProcAddr(device, "vkCreateOpticalFlowSessionNV")
+        : nullptr;
+      CreatePipelineCache = (PFN_vkCreatePipelineCache) NextGetDeviceProcAddr(device, "vkCreatePipelineCache");
+      CreatePipelineLayout = (PFN_vkCreatePipelineLayout) NextGetDeviceProcAddr(device, "vkCreatePipelineLayout");
+      CreatePrivateDataSlot = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkCreatePrivateDataSlot) NextGetDeviceProcAddr(device, "vkCreatePrivateDataSlot")
+        : nullptr;
+      CreatePrivateDataSlotEXT = enabled.Has(procaddr::DeviceExtension::EXT_private_data)
+        ? (PFN_vkCreatePrivateDataSlotEXT) NextGetDeviceProcAddr(device, "vkCreatePrivateDataSlotEXT")
+        : nullptr;
+      CreateQueryPool = (PFN_vkCreateQueryPool) NextGetDeviceProcAddr(device, "vkCreateQueryPool");
+      CreateRayTracingPipelinesKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkCreateRayTracingPipelinesKHR) NextGetDeviceProcAddr(device, "vkCreateRayTracingPipelinesKHR")
+        : nullptr;
+      CreateRayTracingPipelinesNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkCreateRayTracingPipelinesNV) NextGetDeviceProcAddr(device, "vkCreateRayTracingPipelinesNV")
+        : nullptr;
+      CreateRenderPass = (PFN_vkCreateRenderPass) NextGetDeviceProcAddr(device, "vkCreateRenderPass");
+      CreateRenderPass2 = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkCreateRenderPass2) NextGetDeviceProcAddr(device, "vkCreateRenderPass2")
+        : nullptr;
+      CreateRenderPass2KHR = enabled.Has(procaddr::DeviceExtension::KHR_create_renderpass2)
+        ? (PFN_vkCreateRenderPass2KHR) NextGetDeviceProcAddr(device, "vkCreateRenderPass2KHR")
+        : nullptr;
+      CreateSampler = (PFN_vkCreateSampler) NextGetDeviceProcAddr(device, "vkCreateSampler");
+      CreateSamplerYcbcrConversion = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkCreateSamplerYcbcrConversion) NextGetDeviceProcAddr(device, "vkCreateSamplerYcbcrConversion")
+        : nullptr;
+      CreateSamplerYcbcrConversionKHR = enabled.Has(procaddr::DeviceExtension::KHR_sampler_ycbcr_conversion)
+        ? (PFN_vkCreateSamplerYcbcrConversionKHR) NextGetDeviceProcAddr(device, "vkCreateSamplerYcbcrConversionKHR")
+        : nullptr;
+      CreateSemaphore = (PFN_vkCreateSemaphore) NextGetDeviceProcAddr(device, "vkCreateSemaphore");
+      CreateShaderModule = (PFN_vkCreateShaderModule) NextGetDeviceProcAddr(device, "vkCreateShaderModule");
+      CreateShadersEXT = enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkCreateShadersEXT) NextGetDeviceProcAddr(device, "vkCreateShadersEXT")
+        : nullptr;
+      CreateSharedSwapchainsKHR = enabled.Has(procaddr::DeviceExtension::KHR_display_swapchain)
+        ? (PFN_vkCreateSharedSwapchainsKHR) NextGetDeviceProcAddr(device, "vkCreateSharedSwapchainsKHR")
+        : nullptr;
+      CreateSwapchainKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain)
+        ? (PFN_vkCreateSwapchainKHR) NextGetDeviceProcAddr(device, "vkCreateSwapchainKHR")
+        : nullptr;
+      CreateValidationCacheEXT = enabled.Has(procaddr::DeviceExtension::EXT_validation_cache)
+        ? (PFN_vkCreateValidationCacheEXT) NextGetDeviceProcAddr(device, "vkCreateValidationCacheEXT")
+        : nullptr;
+      CreateVideoSessionKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkCreateVideoSessionKHR) NextGetDeviceProcAddr(device, "vkCreateVideoSessionKHR")
+        : nullptr;
+      CreateVideoSessionParametersKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkCreateVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkCreateVideoSessionParametersKHR")
+        : nullptr;
+      DebugMarkerSetObjectNameEXT = enabled.Has(procaddr::DeviceExtension::EXT_debug_marker)
+        ? (PFN_vkDebugMarkerSetObjectNameEXT) NextGetDeviceProcAddr(device, "vkDebugMarkerSetObjectNameEXT")
+        : nullptr;
+      DebugMarkerSetObjectTagEXT = enabled.Has(procaddr::DeviceExtension::EXT_debug_marker)
+        ? (PFN_vkDebugMarkerSetObjectTagEXT) NextGetDeviceProcAddr(device, "vkDebugMarkerSetObjectTagEXT")
+        : nullptr;
+      DeferredOperationJoinKHR = enabled.Has(procaddr::DeviceExtension::KHR_deferred_host_operations)
+        ? (PFN_vkDeferredOperationJoinKHR) NextGetDeviceProcAddr(device, "vkDeferredOperationJoinKHR")
+        : nullptr;
+      DestroyAccelerationStructureKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkDestroyAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkDestroyAccelerationStructureKHR")
+        : nullptr;
+      DestroyAccelerationStructureNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkDestroyAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkDestroyAccelerationStructureNV")
+        : nullptr;
+      DestroyBuffer = (PFN_vkDestroyBuffer) NextGetDeviceProcAddr(device, "vkDestroyBuffer");
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      DestroyBufferCollectionFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_buffer_collection)
+        ? (PFN_vkDestroyBufferCollectionFUCHSIA) NextGetDeviceProcAddr(device, "vkDestroyBufferCollectionFUCHSIA")
+        : nullptr;
+#endif
+      DestroyBufferView = (PFN_vkDestroyBufferView) NextGetDeviceProcAddr(device, "vkDestroyBufferView");
+      DestroyCommandPool = (PFN_vkDestroyCommandPool) NextGetDeviceProcAddr(device, "vkDestroyCommandPool");
+      DestroyDeferredOperationKHR = enabled.Has(procaddr::DeviceExtension::KHR_deferred_host_operations)
+        ? (PFN_vkDestroyDeferredOperationKHR) NextGetDeviceProcAddr(device, "vkDestroyDeferredOperationKHR")
+        : nullptr;
+      DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) NextGetDeviceProcAddr(device, "vkDestroyDescriptorPool");
+      DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) NextGetDeviceProcAddr(device, "vkDestroyDescriptorSetLayout");
+      DestroyDescriptorUpdateTemplate = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkDestroyDescriptorUpdateTemplate) NextGetDeviceProcAddr(device, "vkDestroyDescriptorUpdateTemplate")
+        : nullptr;
+      DestroyDescriptorUpdateTemplateKHR = enabled.Has(procaddr::DeviceExtension::KHR_descriptor_update_template)
+        ? (PFN_vkDestroyDescriptorUpdateTemplateKHR) NextGetDeviceProcAddr(device, "vkDestroyDescriptorUpdateTemplateKHR")
+        : nullptr;
+      DestroyDeviceReal = (PFN_vkDestroyDevice) NextGetDeviceProcAddr(device, "vkDestroyDevice");
+      DestroyDevice = (PFN_vkDestroyDevice) DestroyDeviceWrapper;
+      DestroyEvent = (PFN_vkDestroyEvent) NextGetDeviceProcAddr(device, "vkDestroyEvent");
+      DestroyFence = (PFN_vkDestroyFence) NextGetDeviceProcAddr(device, "vkDestroyFence");
+      DestroyFramebuffer = (PFN_vkDestroyFramebuffer) NextGetDeviceProcAddr(device, "vkDestroyFramebuffer");
+      DestroyImage = (PFN_vkDestroyImage) NextGetDeviceProcAddr(device, "vkDestroyImage");
+      DestroyImageView = (PFN_vkDestroyImageView) NextGetDeviceProcAddr(device, "vkDestroyImageView");
+      DestroyIndirectCommandsLayoutNV = enabled.Has(procaddr::DeviceExtension::NV_device_generated_commands)
+        ? (PFN_vkDestroyIndirectCommandsLayoutNV) NextGetDeviceProcAddr(device, "vkDestroyIndirectCommandsLayoutNV")
+        : nullptr;
+      DestroyMicromapEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkDestroyMicromapEXT) NextGetDeviceProcAddr(device, "vkDestroyMicromapEXT")
+        : nullptr;
+      DestroyOpticalFlowSessionNV = enabled.Has(procaddr::DeviceExtension::NV_optical_flow)
+        ? (PFN_vkDestroyOpticalFlowSessionNV) NextGetDeviceProcAddr(device, "vkDestroyOpticalFlowSessionNV")
+        : nullptr;
+      DestroyPipeline = (PFN_vkDestroyPipeline) NextGetDeviceProcAddr(device, "vkDestroyPipeline");
+      DestroyPipelineCache = (PFN_vkDestroyPipelineCache) NextGetDeviceProcAddr(device, "vkDestroyPipelineCache");
+      DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) NextGetDeviceProcAddr(device, "vkDestroyPipelineLayout");
+      DestroyPrivateDataSlot = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkDestroyPrivateDataSlot) NextGetDeviceProcAddr(device, "vkDestroyPrivateDataSlot")
+        : nullptr;
+      DestroyPrivateDataSlotEXT = enabled.Has(procaddr::DeviceExtension::EXT_private_data)
+        ? (PFN_vkDestroyPrivateDataSlotEXT) NextGetDeviceProcAddr(device, "vkDestroyPrivateDataSlotEXT")
+        : nullptr;
+      DestroyQueryPool = (PFN_vkDestroyQueryPool) NextGetDeviceProcAddr(device, "vkDestroyQueryPool");
+      DestroyRenderPass = (PFN_vkDestroyRenderPass) NextGetDeviceProcAddr(device, "vkDestroyRenderPass");
+      DestroySampler = (PFN_vkDestroySampler) NextGetDeviceProcAddr(device, "vkDestroySampler");
+      DestroySamplerYcbcrConversion = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkDestroySamplerYcbcrConversion) NextGetDeviceProcAddr(device, "vkDestroySamplerYcbcrConversion")
+        : nullptr;
+      DestroySamplerYcbcrConversionKHR = enabled.Has(procaddr::DeviceExtension::KHR_sampler_ycbcr_conversion)
+        ? (PFN_vkDestroySamplerYcbcrConversionKHR) NextGetDeviceProcAddr(device, "vkDestroySamplerYcbcrConversionKHR")
+        : nullptr;
+      DestroySemaphore = (PFN_vkDestroySemaphore) NextGetDeviceProcAddr(device, "vkDestroySemaphore");
+      DestroyShaderEXT = enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkDestroyShaderEXT) NextGetDeviceProcAddr(device, "vkDestroyShaderEXT")
+        : nullptr;
+      DestroyShaderModule = (PFN_vkDestroyShaderModule) NextGetDeviceProcAddr(device, "vkDestroyShaderModule");
+      DestroySwapchainKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain)
+        ? (PFN_vkDestroySwapchainKHR) NextGetDeviceProcAddr(device, "vkDestroySwapchainKHR")
+        : nullptr;
+      DestroyValidationCacheEXT = enabled.Has(procaddr::DeviceExtension::EXT_validation_cache)
+        ? (PFN_vkDestroyValidationCacheEXT) NextGetDeviceProcAddr(device, "vkDestroyValidationCacheEXT")
+        : nullptr;
+      DestroyVideoSessionKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkDestroyVideoSessionKHR) NextGetDeviceProcAddr(device, "vkDestroyVideoSessionKHR")
+        : nullptr;
+      DestroyVideoSessionParametersKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkDestroyVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkDestroyVideoSessionParametersKHR")
+        : nullptr;
+      DeviceWaitIdle = (PFN_vkDeviceWaitIdle) NextGetDeviceProcAddr(device, "vkDeviceWaitIdle");
+      DisplayPowerControlEXT = enabled.Has(procaddr::DeviceExtension::EXT_display_control)
+        ? (PFN_vkDisplayPowerControlEXT) NextGetDeviceProcAddr(device, "vkDisplayPowerControlEXT")
+        : nullptr;
+      EndCommandBuffer = (PFN_vkEndCommandBuffer) NextGetDeviceProcAddr(device, "vkEndCommandBuffer");
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      ExportMetalObjectsEXT = enabled.Has(procaddr::DeviceExtension::EXT_metal_objects)
+        ? (PFN_vkExportMetalObjectsEXT) NextGetDeviceProcAddr(device, "vkExportMetalObjectsEXT")
+        : nullptr;
+#endif
+      FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) NextGetDeviceProcAddr(device, "vkFlushMappedMemoryRanges");
+      FreeCommandBuffers = (PFN_vkFreeCommandBuffers) NextGetDeviceProcAddr(device, "vkFreeCommandBuffers");
+      FreeDescriptorSets = (PFN_vkFreeDescriptorSets) NextGetDeviceProcAddr(device, "vkFreeDescriptorSets");
+      FreeMemory = (PFN_vkFreeMemory) NextGetDeviceProcAddr(device, "vkFreeMemory");
+      GetAccelerationStructureBuildSizesKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkGetAccelerationStructureBuildSizesKHR) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureBuildSizesKHR")
+        : nullptr;
+      GetAccelerationStructureDeviceAddressKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkGetAccelerationStructureDeviceAddressKHR) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureDeviceAddressKHR")
+        : nullptr;
+      GetAccelerationStructureHandleNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkGetAccelerationStructureHandleNV) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureHandleNV")
+        : nullptr;
+      GetAccelerationStructureMemoryRequirementsNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkGetAccelerationStructureMemoryRequirementsNV) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureMemoryRequirementsNV")
+        : nullptr;
+      GetAccelerationStructureOpaqueCaptureDescriptorDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      GetAndroidHardwareBufferPropertiesANDROID = enabled.Has(procaddr::DeviceExtension::ANDROID_external_memory_android_hardware_buffer)
+        ? (PFN_vkGetAndroidHardwareBufferPropertiesANDROID) NextGetDeviceProcAddr(device, "vkGetAndroidHardwareBufferPropertiesANDROID")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetBufferCollectionPropertiesFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_buffer_collection)
+        ? (PFN_vkGetBufferCollectionPropertiesFUCHSIA) NextGetDeviceProcAddr(device, "vkGetBufferCollectionPropertiesFUCHSIA")
+        : nullptr;
+#endif
+      GetBufferDeviceAddress = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkGetBufferDeviceAddress) NextGetDeviceProcAddr(device, "vkGetBufferDeviceAddress")
+        : nullptr;
+      GetBufferDeviceAddressEXT = enabled.Has(procaddr::DeviceExtension::EXT_buffer_device_address)
+        ? (PFN_vkGetBufferDeviceAddressEXT) NextGetDeviceProcAddr(device, "vkGetBufferDeviceAddressEXT")
+        : nullptr;
+      GetBufferDeviceAddressKHR = enabled.Has(procaddr::DeviceExtension::KHR_buffer_device_address)
+        ? (PFN_vkGetBufferDeviceAddressKHR) NextGetDeviceProcAddr(device, "vkGetBufferDeviceAddressKHR")
+        : nullptr;
+      GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
+      GetBufferMemoryRequirements2 = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkGetBufferMemoryRequirements2) NextGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements2")
+        : nullptr;
+      GetBufferMemoryRequirements2KHR = enabled.Has(procaddr::DeviceExtension::KHR_get_memory_requirements2)
+        ? (PFN_vkGetBufferMemoryRequirements2KHR) NextGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements2KHR")
+        : nullptr;
+      GetBufferOpaqueCaptureAddress = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkGetBufferOpaqueCaptureAddress) NextGetDeviceProcAddr(device, "vkGetBufferOpaqueCaptureAddress")
+        : nullptr;
+      GetBufferOpaqueCaptureAddressKHR = enabled.Has(procaddr::DeviceExtension::KHR_buffer_device_address)
+        ? (PFN_vkGetBufferOpaqueCaptureAddressKHR) NextGetDeviceProcAddr(device, "vkGetBufferOpaqueCaptureAddressKHR")
+        : nullptr;
+      GetBufferOpaqueCaptureDescriptorDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetBufferOpaqueCaptureDescriptorDataEXT")
+        : nullptr;
+      GetCalibratedTimestampsEXT = enabled.Has(procaddr::DeviceExtension::EXT_calibrated_timestamps)
+        ? (PFN_vkGetCalibratedTimestampsEXT) NextGetDeviceProcAddr(device, "vkGetCalibratedTimestampsEXT")
+        : nullptr;
+      GetDeferredOperationMaxConcurrencyKHR = enabled.Has(procaddr::DeviceExtension::KHR_deferred_host_operations)
+        ? (PFN_vkGetDeferredOperationMaxConcurrencyKHR) NextGetDeviceProcAddr(device, "vkGetDeferredOperationMaxConcurrencyKHR")
+        : nullptr;
+      GetDeferredOperationResultKHR = enabled.Has(procaddr::DeviceExtension::KHR_deferred_host_operations)
+        ? (PFN_vkGetDeferredOperationResultKHR) NextGetDeviceProcAddr(device, "vkGetDeferredOperationResultKHR")
+        : nullptr;
+      GetDescriptorEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetDescriptorEXT) NextGetDeviceProcAddr(device, "vkGetDescriptorEXT")
+        : nullptr;
+      GetDescriptorSetHostMappingVALVE = enabled.Has(procaddr::DeviceExtension::VALVE_descriptor_set_host_mapping)
+        ? (PFN_vkGetDescriptorSetHostMappingVALVE) NextGetDeviceProcAddr(device, "vkGetDescriptorSetHostMappingVALVE")
+        : nullptr;
+      GetDescriptorSetLayoutBindingOffsetEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetDescriptorSetLayoutBindingOffsetEXT) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutBindingOffsetEXT")
+        : nullptr;
+      GetDescriptorSetLayoutHostMappingInfoVALVE = enabled.Has(procaddr::DeviceExtension::VALVE_descriptor_set_host_mapping)
+        ? (PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutHostMappingInfoVALVE")
+        : nullptr;
+      GetDescriptorSetLayoutSizeEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetDescriptorSetLayoutSizeEXT) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSizeEXT")
+        : nullptr;
+      GetDescriptorSetLayoutSupport = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkGetDescriptorSetLayoutSupport) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSupport")
+        : nullptr;
+      GetDescriptorSetLayoutSupportKHR = enabled.Has(procaddr::DeviceExtension::KHR_maintenance3)
+        ? (PFN_vkGetDescriptorSetLayoutSupportKHR) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSupportKHR")
+        : nullptr;
+      GetDeviceAccelerationStructureCompatibilityKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkGetDeviceAccelerationStructureCompatibilityKHR) NextGetDeviceProcAddr(device, "vkGetDeviceAccelerationStructureCompatibilityKHR")
+        : nullptr;
+      GetDeviceBufferMemoryRequirements = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkGetDeviceBufferMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetDeviceBufferMemoryRequirements")
+        : nullptr;
+      GetDeviceBufferMemoryRequirementsKHR = enabled.Has(procaddr::DeviceExtension::KHR_maintenance4)
+        ? (PFN_vkGetDeviceBufferMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetDeviceBufferMemoryRequirementsKHR")
+        : nullptr;
+      GetDeviceFaultInfoEXT = enabled.Has(procaddr::DeviceExtension::EXT_device_fault)
+        ? (PFN_vkGetDeviceFaultInfoEXT) NextGetDeviceProcAddr(device, "vkGetDeviceFaultInfoEXT")
+        : nullptr;
+      GetDeviceGroupPeerMemoryFeatures = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkGetDeviceGroupPeerMemoryFeatures) NextGetDeviceProcAddr(device, "vkGetDeviceGroupPeerMemoryFeatures")
+        : nullptr;
+      GetDeviceGroupPeerMemoryFeaturesKHR = enabled.Has(procaddr::DeviceExtension::KHR_device_group)
+        ? (PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR) NextGetDeviceProcAddr(device, "vkGetDeviceGroupPeerMemoryFeaturesKHR")
+        : nullptr;
+      GetDeviceGroupPresentCapabilitiesKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain) || enabled.Has(procaddr::DeviceExtension::KHR_device_group)
+        ? (PFN_vkGetDeviceGroupPresentCapabilitiesKHR) NextGetDeviceProcAddr(device, "vkGetDeviceGroupPresentCapabilitiesKHR")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetDeviceGroupSurfacePresentModes2EXT = enabled.Has(procaddr::DeviceExtension::EXT_full_screen_exclusive)
+        ? (PFN_vkGetDeviceGroupSurfacePresentModes2EXT) NextGetDeviceProcAddr(device, "vkGetDeviceGroupSurfacePresentModes2EXT")
+        : nullptr;
+#endif
+      GetDeviceGroupSurfacePresentModesKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain) || enabled.Has(procaddr::DeviceExtension::KHR_device_group)
+        ? (PFN_vkGetDeviceGroupSurfacePresentModesKHR) NextGetDeviceProcAddr(device, "vkGetDeviceGroupSurfacePresentModesKHR")
+        : nullptr;
+      GetDeviceImageMemoryRequirements = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkGetDeviceImageMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetDeviceImageMemoryRequirements")
+        : nullptr;
+      GetDeviceImageMemoryRequirementsKHR = enabled.Has(procaddr::DeviceExtension::KHR_maintenance4)
+        ? (PFN_vkGetDeviceImageMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetDeviceImageMemoryRequirementsKHR")
+        : nullptr;
+      GetDeviceImageSparseMemoryRequirements = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkGetDeviceImageSparseMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetDeviceImageSparseMemoryRequirements")
+        : nullptr;
+      GetDeviceImageSparseMemoryRequirementsKHR = enabled.Has(procaddr::DeviceExtension::KHR_maintenance4)
+        ? (PFN_vkGetDeviceImageSparseMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetDeviceImageSparseMemoryRequirementsKHR")
+        : nullptr;
+      GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) NextGetDeviceProcAddr(device, "vkGetDeviceMemoryCommitment");
+      GetDeviceMemoryOpaqueCaptureAddress = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkGetDeviceMemoryOpaqueCaptureAddress) NextGetDeviceProcAddr(device, "vkGetDeviceMemoryOpaqueCaptureAddress")
+        : nullptr;
+      GetDeviceMemoryOpaqueCaptureAddressKHR = enabled.Has(procaddr::DeviceExtension::KHR_buffer_device_address)
+        ? (PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR) NextGetDeviceProcAddr(device, "vkGetDeviceMemoryOpaqueCaptureAddressKHR")
+        : nullptr;
+      GetDeviceMicromapCompatibilityEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkGetDeviceMicromapCompatibilityEXT) NextGetDeviceProcAddr(device, "vkGetDeviceMicromapCompatibilityEXT")
+        : nullptr;
+      GetDeviceProcAddr = NextGetDeviceProcAddr;
+      GetDeviceQueue = (PFN_vkGetDeviceQueue) NextGetDeviceProcAddr(device, "vkGetDeviceQueue");
+      GetDeviceQueue2 = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkGetDeviceQueue2) NextGetDeviceProcAddr(device, "vkGetDeviceQueue2")
+        : nullptr;
+      GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = enabled.Has(procaddr::DeviceExtension::HUAWEI_subpass_shading)
+        ? (PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI) NextGetDeviceProcAddr(device, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI")
+        : nullptr;
+      GetDynamicRenderingTilePropertiesQCOM = enabled.Has(procaddr::DeviceExtension::QCOM_tile_properties)
+        ? (PFN_vkGetDynamicRenderingTilePropertiesQCOM) NextGetDeviceProcAddr(device, "vkGetDynamicRenderingTilePropertiesQCOM")
+        : nullptr;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      GetEncodedVideoSessionParametersKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_encode_queue)
+        ? (PFN_vkGetEncodedVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkGetEncodedVideoSessionParametersKHR")
+        : nullptr;
+#endif
+      GetEventStatus = (PFN_vkGetEventStatus) NextGetDeviceProcAddr(device, "vkGetEventStatus");
+      GetFenceFdKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_fence_fd)
+        ? (PFN_vkGetFenceFdKHR) NextGetDeviceProcAddr(device, "vkGetFenceFdKHR")
+        : nullptr;
+      GetFenceStatus = (PFN_vkGetFenceStatus) NextGetDeviceProcAddr(device, "vkGetFenceStatus");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetFenceWin32HandleKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_fence_win32)
+        ? (PFN_vkGetFenceWin32HandleKHR) NextGetDeviceProcAddr(device, "vkGetFenceWin32HandleKHR")
+        : nullptr;
+#endif
+      GetFramebufferTilePropertiesQCOM = enabled.Has(procaddr::DeviceExtension::QCOM_tile_properties)
+        ? (PFN_vkGetFramebufferTilePropertiesQCOM) NextGetDeviceProcAddr(device, "vkGetFramebufferTilePropertiesQCOM")
+        : nullptr;
+      GetGeneratedCommandsMemoryRequirementsNV = enabled.Has(procaddr::DeviceExtension::NV_device_generated_commands)
+        ? (PFN_vkGetGeneratedCommandsMemoryRequirementsNV) NextGetDeviceProcAddr(device, "vkGetGeneratedCommandsMemoryRequirementsNV")
+        : nullptr;
+      GetImageDrmFormatModifierPropertiesEXT = enabled.Has(procaddr::DeviceExtension::EXT_image_drm_format_modifier)
+        ? (PFN_vkGetImageDrmFormatModifierPropertiesEXT) NextGetDeviceProcAddr(device, "vkGetImageDrmFormatModifierPropertiesEXT")
+        : nullptr;
+      GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetImageMemoryRequirements");
+      GetImageMemoryRequirements2 = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkGetImageMemoryRequirements2) NextGetDeviceProcAddr(device, "vkGetImageMemoryRequirements2")
+        : nullptr;
+      GetImageMemoryRequirements2KHR = enabled.Has(procaddr::DeviceExtension::KHR_get_memory_requirements2)
+        ? (PFN_vkGetImageMemoryRequirements2KHR) NextGetDeviceProcAddr(device, "vkGetImageMemoryRequirements2KHR")
+        : nullptr;
+      GetImageOpaqueCaptureDescriptorDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetImageOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetImageOpaqueCaptureDescriptorDataEXT")
+        : nullptr;
+      GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements");
+      GetImageSparseMemoryRequirements2 = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkGetImageSparseMemoryRequirements2) NextGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements2")
+        : nullptr;
+      GetImageSparseMemoryRequirements2KHR = enabled.Has(procaddr::DeviceExtension::KHR_get_memory_requirements2)
+        ? (PFN_vkGetImageSparseMemoryRequirements2KHR) NextGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements2KHR")
+        : nullptr;
+      GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) NextGetDeviceProcAddr(device, "vkGetImageSubresourceLayout");
+      GetImageSubresourceLayout2EXT = enabled.Has(procaddr::DeviceExtension::EXT_image_compression_control)
+        ? (PFN_vkGetImageSubresourceLayout2EXT) NextGetDeviceProcAddr(device, "vkGetImageSubresourceLayout2EXT")
+        : nullptr;
+      GetImageViewOpaqueCaptureDescriptorDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetImageViewOpaqueCaptureDescriptorDataEXT")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      GetMemoryAndroidHardwareBufferANDROID = enabled.Has(procaddr::DeviceExtension::ANDROID_external_memory_android_hardware_buffer)
+        ? (PFN_vkGetMemoryAndroidHardwareBufferANDROID) NextGetDeviceProcAddr(device, "vkGetMemoryAndroidHardwareBufferANDROID")
+        : nullptr;
+#endif
+      GetMemoryFdKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_memory_fd)
+        ? (PFN_vkGetMemoryFdKHR) NextGetDeviceProcAddr(device, "vkGetMemoryFdKHR")
+        : nullptr;
+      GetMemoryFdPropertiesKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_memory_fd)
+        ? (PFN_vkGetMemoryFdPropertiesKHR) NextGetDeviceProcAddr(device, "vkGetMemoryFdPropertiesKHR")
+        : nullptr;
+      GetMemoryHostPointerPropertiesEXT = enabled.Has(procaddr::DeviceExtension::EXT_external_memory_host)
+        ? (PFN_vkGetMemoryHostPointerPropertiesEXT) NextGetDeviceProcAddr(device, "vkGetMemoryHostPointerPropertiesEXT")
+        : nullptr;
+      GetMemoryRemoteAddressNV = enabled.Has(procaddr::DeviceExtension::NV_external_memory_rdma)
+        ? (PFN_vkGetMemoryRemoteAddressNV) NextGetDeviceProcAddr(device, "vkGetMemoryRemoteAddressNV")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetMemoryWin32HandleKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_memory_win32)
+        ? (PFN_vkGetMemoryWin32HandleKHR) NextGetDeviceProcAddr(device, "vkGetMemoryWin32HandleKHR")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetMemoryWin32HandleNV = enabled.Has(procaddr::DeviceExtension::NV_external_memory_win32)
+        ? (PFN_vkGetMemoryWin32HandleNV) NextGetDeviceProcAddr(device, "vkGetMemoryWin32HandleNV")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetMemoryWin32HandlePropertiesKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_memory_win32)
+        ? (PFN_vkGetMemoryWin32HandlePropertiesKHR) NextGetDeviceProcAddr(device, "vkGetMemoryWin32HandlePropertiesKHR")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetMemoryZirconHandleFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_external_memory)
+        ? (PFN_vkGetMemoryZirconHandleFUCHSIA) NextGetDeviceProcAddr(device, "vkGetMemoryZirconHandleFUCHSIA")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetMemoryZirconHandlePropertiesFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_external_memory)
+        ? (PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA) NextGetDeviceProcAddr(device, "vkGetMemoryZirconHandlePropertiesFUCHSIA")
+        : nullptr;
+#endif
+      GetMicromapBuildSizesEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkGetMicromapBuildSizesEXT) NextGetDeviceProcAddr(device, "vkGetMicromapBuildSizesEXT")
+        : nullptr;
+      GetPastPresentationTimingGOOGLE = enabled.Has(procaddr::DeviceExtension::GOOGLE_display_timing)
+        ? (PFN_vkGetPastPresentationTimingGOOGLE) NextGetDeviceProcAddr(device, "vkGetPastPresentationTimingGOOGLE")
+        : nullptr;
+      GetPerformanceParameterINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkGetPerformanceParameterINTEL) NextGetDeviceProcAddr(device, "vkGetPerformanceParameterINTEL")
+        : nullptr;
+      GetPipelineCacheData = (PFN_vkGetPipelineCacheData) NextGetDeviceProcAddr(device, "vkGetPipelineCacheData");
+      GetPipelineExecutableInternalRepresentationsKHR = enabled.Has(procaddr::DeviceExtension::KHR_pipeline_executable_properties)
+        ? (PFN_vkGetPipelineExecutableInternalRepresentationsKHR) NextGetDeviceProcAddr(device, "vkGetPipelineExecutableInternalRepresentationsKHR")
+        : nullptr;
+      GetPipelineExecutablePropertiesKHR = enabled.Has(procaddr::DeviceExtension::KHR_pipeline_executable_properties)
+        ? (PFN_vkGetPipelineExecutablePropertiesKHR) NextGetDeviceProcAddr(device, "vkGetPipelineExecutablePropertiesKHR")
+        : nullptr;
+      GetPipelineExecutableStatisticsKHR = enabled.Has(procaddr::DeviceExtension::KHR_pipeline_executable_properties)
+        ? (PFN_vkGetPipelineExecutableStatisticsKHR) NextGetDeviceProcAddr(device, "vkGetPipelineExecutableStatisticsKHR")
+        : nullptr;
+      GetPipelinePropertiesEXT = enabled.Has(procaddr::DeviceExtension::EXT_pipeline_properties)
+        ? (PFN_vkGetPipelinePropertiesEXT) NextGetDeviceProcAddr(device, "vkGetPipelinePropertiesEXT")
+        : nullptr;
+      GetPrivateData = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkGetPrivateData) NextGetDeviceProcAddr(device, "vkGetPrivateData")
+        : nullptr;
+      GetPrivateDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_private_data)
+        ? (PFN_vkGetPrivateDataEXT) NextGetDeviceProcAddr(device, "vkGetPrivateDataEXT")
+        : nullptr;
+      GetQueryPoolResults = (PFN_vkGetQueryPoolResults) NextGetDeviceProcAddr(device, "vkGetQueryPoolResults");
+      GetQueueCheckpointData2NV = enabled.Has(procaddr::DeviceExtension::NV_device_diagnostic_checkpoints) || enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkGetQueueCheckpointData2NV) NextGetDeviceProcAddr(device, "vkGetQueueCheckpointData2NV")
+        : nullptr;
+      GetQueueCheckpointDataNV = enabled.Has(procaddr::DeviceExtension::NV_device_diagnostic_checkpoints)
+        ? (PFN_vkGetQueueCheckpointDataNV) NextGetDeviceProcAddr(device, "vkGetQueueCheckpointDataNV")
+        : nullptr;
+      GetRayTracingCaptureReplayShaderGroupHandlesKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR) NextGetDeviceProcAddr(device, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR")
+        : nullptr;
+      GetRayTracingShaderGroupHandlesKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkGetRayTracingShaderGroupHandlesKHR) NextGetDeviceProcAddr(device, "vkGetRayTracingShaderGroupHandlesKHR")
+        : nullptr;
+      GetRayTracingShaderGroupHandlesNV = enabled.Has(procaddr::DeviceExtension::NV_ray_tracing)
+        ? (PFN_vkGetRayTracingShaderGroupHandlesNV) NextGetDeviceProcAddr(device, "vkGetRayTracingShaderGroupHandlesNV")
+        : nullptr;
+      GetRayTracingShaderGroupStackSizeKHR = enabled.Has(procaddr::DeviceExtension::KHR_ray_tracing_pipeline)
+        ? (PFN_vkGetRayTracingShaderGroupStackSizeKHR) NextGetDeviceProcAddr(device, "vkGetRayTracingShaderGroupStackSizeKHR")
+        : nullptr;
+      GetRefreshCycleDurationGOOGLE = enabled.Has(procaddr::DeviceExtension::GOOGLE_display_timing)
+        ? (PFN_vkGetRefreshCycleDurationGOOGLE) NextGetDeviceProcAddr(device, "vkGetRefreshCycleDurationGOOGLE")
+        : nullptr;
+      GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) NextGetDeviceProcAddr(device, "vkGetRenderAreaGranularity");
+      GetSamplerOpaqueCaptureDescriptorDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_descriptor_buffer)
+        ? (PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetSamplerOpaqueCaptureDescriptorDataEXT")
+        : nullptr;
+      GetSemaphoreCounterValue = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkGetSemaphoreCounterValue) NextGetDeviceProcAddr(device, "vkGetSemaphoreCounterValue")
+        : nullptr;
+      GetSemaphoreCounterValueKHR = enabled.Has(procaddr::DeviceExtension::KHR_timeline_semaphore)
+        ? (PFN_vkGetSemaphoreCounterValueKHR) NextGetDeviceProcAddr(device, "vkGetSemaphoreCounterValueKHR")
+        : nullptr;
+      GetSemaphoreFdKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_semaphore_fd)
+        ? (PFN_vkGetSemaphoreFdKHR) NextGetDeviceProcAddr(device, "vkGetSemaphoreFdKHR")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetSemaphoreWin32HandleKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_semaphore_win32)
+        ? (PFN_vkGetSemaphoreWin32HandleKHR) NextGetDeviceProcAddr(device, "vkGetSemaphoreWin32HandleKHR")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetSemaphoreZirconHandleFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_external_semaphore)
+        ? (PFN_vkGetSemaphoreZirconHandleFUCHSIA) NextGetDeviceProcAddr(device, "vkGetSemaphoreZirconHandleFUCHSIA")
+        : nullptr;
+#endif
+      GetShaderBinaryDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_shader_object)
+        ? (PFN_vkGetShaderBinaryDataEXT) NextGetDeviceProcAddr(device, "vkGetShaderBinaryDataEXT")
+        : nullptr;
+      GetShaderInfoAMD = enabled.Has(procaddr::DeviceExtension::AMD_shader_info)
+        ? (PFN_vkGetShaderInfoAMD) NextGetDeviceProcAddr(device, "vkGetShaderInfoAMD")
+        : nullptr;
+      GetShaderModuleCreateInfoIdentifierEXT = enabled.Has(procaddr::DeviceExtension::EXT_shader_module_identifier)
+        ? (PFN_vkGetShaderModuleCreateInfoIdentifierEXT) NextGetDeviceProcAddr(device, "vkGetShaderModuleCreateInfoIdentifierEXT")
+        : nullptr;
+      GetShaderModuleIdentifierEXT = enabled.Has(procaddr::DeviceExtension::EXT_shader_module_identifier)
+        ? (PFN_vkGetShaderModuleIdentifierEXT) NextGetDeviceProcAddr(device, "vkGetShaderModuleIdentifierEXT")
+        : nullptr;
+      GetSwapchainCounterEXT = enabled.Has(procaddr::DeviceExtension::EXT_display_control)
+        ? (PFN_vkGetSwapchainCounterEXT) NextGetDeviceProcAddr(device, "vkGetSwapchainCounterEXT")
+        : nullptr;
+      GetSwapchainImagesKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain)
+        ? (PFN_vkGetSwapchainImagesKHR) NextGetDeviceProcAddr(device, "vkGetSwapchainImagesKHR")
+        : nullptr;
+      GetSwapchainStatusKHR = enabled.Has(procaddr::DeviceExtension::KHR_shared_presentable_image)
+        ? (PFN_vkGetSwapchainStatusKHR) NextGetDeviceProcAddr(device, "vkGetSwapchainStatusKHR")
+        : nullptr;
+      GetValidationCacheDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_validation_cache)
+        ? (PFN_vkGetValidationCacheDataEXT) NextGetDeviceProcAddr(device, "vkGetValidationCacheDataEXT")
+        : nullptr;
+      GetVideoSessionMemoryRequirementsKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkGetVideoSessionMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetVideoSessionMemoryRequirementsKHR")
+        : nullptr;
+      ImportFenceFdKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_fence_fd)
+        ? (PFN_vkImportFenceFdKHR) NextGetDeviceProcAddr(device, "vkImportFenceFdKHR")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      ImportFenceWin32HandleKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_fence_win32)
+        ? (PFN_vkImportFenceWin32HandleKHR) NextGetDeviceProcAddr(device, "vkImportFenceWin32HandleKHR")
+        : nullptr;
+#endif
+      ImportSemaphoreFdKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_semaphore_fd)
+        ? (PFN_vkImportSemaphoreFdKHR) NextGetDeviceProcAddr(device, "vkImportSemaphoreFdKHR")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      ImportSemaphoreWin32HandleKHR = enabled.Has(procaddr::DeviceExtension::KHR_external_semaphore_win32)
+        ? (PFN_vkImportSemaphoreWin32HandleKHR) NextGetDeviceProcAddr(device, "vkImportSemaphoreWin32HandleKHR")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      ImportSemaphoreZirconHandleFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_external_semaphore)
+        ? (PFN_vkImportSemaphoreZirconHandleFUCHSIA) NextGetDeviceProcAddr(device, "vkImportSemaphoreZirconHandleFUCHSIA")
+        : nullptr;
+#endif
+      InitializePerformanceApiINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkInitializePerformanceApiINTEL) NextGetDeviceProcAddr(device, "vkInitializePerformanceApiINTEL")
+        : nullptr;
+      InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) NextGetDeviceProcAddr(device, "vkInvalidateMappedMemoryRanges");
+      MapMemory = (PFN_vkMapMemory) NextGetDeviceProcAddr(device, "vkMapMemory");
+      MapMemory2KHR = enabled.Has(procaddr::DeviceExtension::KHR_map_memory2)
+        ? (PFN_vkMapMemory2KHR) NextGetDeviceProcAddr(device, "vkMapMemory2KHR")
+        : nullptr;
+      MergePipelineCaches = (PFN_vkMergePipelineCaches) NextGetDeviceProcAddr(device, "vkMergePipelineCaches");
+      MergeValidationCachesEXT = enabled.Has(procaddr::DeviceExtension::EXT_validation_cache)
+        ? (PFN_vkMergeValidationCachesEXT) NextGetDeviceProcAddr(device, "vkMergeValidationCachesEXT")
+        : nullptr;
+      QueueBeginDebugUtilsLabelEXT = (PFN_vkQueueBeginDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkQueueBeginDebugUtilsLabelEXT");
+      QueueBindSparse = (PFN_vkQueueBindSparse) NextGetDeviceProcAddr(device, "vkQueueBindSparse");
+      QueueEndDebugUtilsLabelEXT = (PFN_vkQueueEndDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkQueueEndDebugUtilsLabelEXT");
+      QueueInsertDebugUtilsLabelEXT = (PFN_vkQueueInsertDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkQueueInsertDebugUtilsLabelEXT");
+      QueuePresentKHR = enabled.Has(procaddr::DeviceExtension::KHR_swapchain)
+        ? (PFN_vkQueuePresentKHR) NextGetDeviceProcAddr(device, "vkQueuePresentKHR")
+        : nullptr;
+      QueueSetPerformanceConfigurationINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkQueueSetPerformanceConfigurationINTEL) NextGetDeviceProcAddr(device, "vkQueueSetPerformanceConfigurationINTEL")
+        : nullptr;
+      QueueSubmit = (PFN_vkQueueSubmit) NextGetDeviceProcAddr(device, "vkQueueSubmit");
+      QueueSubmit2 = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkQueueSubmit2) NextGetDeviceProcAddr(device, "vkQueueSubmit2")
+        : nullptr;
+      QueueSubmit2KHR = enabled.Has(procaddr::DeviceExtension::KHR_synchronization2)
+        ? (PFN_vkQueueSubmit2KHR) NextGetDeviceProcAddr(device, "vkQueueSubmit2KHR")
+        : nullptr;
+      QueueWaitIdle = (PFN_vkQueueWaitIdle) NextGetDeviceProcAddr(device, "vkQueueWaitIdle");
+      RegisterDeviceEventEXT = enabled.Has(procaddr::DeviceExtension::EXT_display_control)
+        ? (PFN_vkRegisterDeviceEventEXT) NextGetDeviceProcAddr(device, "vkRegisterDeviceEventEXT")
+        : nullptr;
+      RegisterDisplayEventEXT = enabled.Has(procaddr::DeviceExtension::EXT_display_control)
+        ? (PFN_vkRegisterDisplayEventEXT) NextGetDeviceProcAddr(device, "vkRegisterDisplayEventEXT")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      ReleaseFullScreenExclusiveModeEXT = enabled.Has(procaddr::DeviceExtension::EXT_full_screen_exclusive)
+        ? (PFN_vkReleaseFullScreenExclusiveModeEXT) NextGetDeviceProcAddr(device, "vkReleaseFullScreenExclusiveModeEXT")
+        : nullptr;
+#endif
+      ReleasePerformanceConfigurationINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkReleasePerformanceConfigurationINTEL) NextGetDeviceProcAddr(device, "vkReleasePerformanceConfigurationINTEL")
+        : nullptr;
+      ReleaseProfilingLockKHR = enabled.Has(procaddr::DeviceExtension::KHR_performance_query)
+        ? (PFN_vkReleaseProfilingLockKHR) NextGetDeviceProcAddr(device, "vkReleaseProfilingLockKHR")
+        : nullptr;
+      ReleaseSwapchainImagesEXT = enabled.Has(procaddr::DeviceExtension::EXT_swapchain_maintenance1)
+        ? (PFN_vkReleaseSwapchainImagesEXT) NextGetDeviceProcAddr(device, "vkReleaseSwapchainImagesEXT")
+        : nullptr;
+      ResetCommandBuffer = (PFN_vkResetCommandBuffer) NextGetDeviceProcAddr(device, "vkResetCommandBuffer");
+      ResetCommandPool = (PFN_vkResetCommandPool) NextGetDeviceProcAddr(device, "vkResetCommandPool");
+      ResetDescriptorPool = (PFN_vkResetDescriptorPool) NextGetDeviceProcAddr(device, "vkResetDescriptorPool");
+      ResetEvent = (PFN_vkResetEvent) NextGetDeviceProcAddr(device, "vkResetEvent");
+      ResetFences = (PFN_vkResetFences) NextGetDeviceProcAddr(device, "vkResetFences");
+      ResetQueryPool = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkResetQueryPool) NextGetDeviceProcAddr(device, "vkResetQueryPool")
+        : nullptr;
+      ResetQueryPoolEXT = enabled.Has(procaddr::DeviceExtension::EXT_host_query_reset)
+        ? (PFN_vkResetQueryPoolEXT) NextGetDeviceProcAddr(device, "vkResetQueryPoolEXT")
+        : nullptr;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      SetBufferCollectionBufferConstraintsFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_buffer_collection)
+        ? (PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA) NextGetDeviceProcAddr(device, "vkSetBufferCollectionBufferConstraintsFUCHSIA")
+        : nullptr;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      SetBufferCollectionImageConstraintsFUCHSIA = enabled.Has(procaddr::DeviceExtension::FUCHSIA_buffer_collection)
+        ? (PFN_vkSetBufferCollectionImageConstraintsFUCHSIA) NextGetDeviceProcAddr(device, "vkSetBufferCollectionImageConstraintsFUCHSIA")
+        : nullptr;
+#endif
+      SetDebugUtilsObjectNameEXT = (PFN_vkSetDebugUtilsObjectNameEXT) NextGetDeviceProcAddr(device, "vkSetDebugUtilsObjectNameEXT");
+      SetDebugUtilsObjectTagEXT = (PFN_vkSetDebugUtilsObjectTagEXT) NextGetDeviceProcAddr(device, "vkSetDebugUtilsObjectTagEXT");
+      SetDeviceMemoryPriorityEXT = enabled.Has(procaddr::DeviceExtension::EXT_pageable_device_local_memory)
+        ? (PFN_vkSetDeviceMemoryPriorityEXT) NextGetDeviceProcAddr(device, "vkSetDeviceMemoryPriorityEXT")
+        : nullptr;
+      SetEvent = (PFN_vkSetEvent) NextGetDeviceProcAddr(device, "vkSetEvent");
+      SetHdrMetadataEXT = enabled.Has(procaddr::DeviceExtension::EXT_hdr_metadata)
+        ? (PFN_vkSetHdrMetadataEXT) NextGetDeviceProcAddr(device, "vkSetHdrMetadataEXT")
+        : nullptr;
+      SetLocalDimmingAMD = enabled.Has(procaddr::DeviceExtension::AMD_display_native_hdr)
+        ? (PFN_vkSetLocalDimmingAMD) NextGetDeviceProcAddr(device, "vkSetLocalDimmingAMD")
+        : nullptr;
+      SetPrivateData = enabled.Version(VK_API_VERSION_1_3)
+        ? (PFN_vkSetPrivateData) NextGetDeviceProcAddr(device, "vkSetPrivateData")
+        : nullptr;
+      SetPrivateDataEXT = enabled.Has(procaddr::DeviceExtension::EXT_private_data)
+        ? (PFN_vkSetPrivateDataEXT) NextGetDeviceProcAddr(device, "vkSetPrivateDataEXT")
+        : nullptr;
+      SignalSemaphore = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkSignalSemaphore) NextGetDeviceProcAddr(device, "vkSignalSemaphore")
+        : nullptr;
+      SignalSemaphoreKHR = enabled.Has(procaddr::DeviceExtension::KHR_timeline_semaphore)
+        ? (PFN_vkSignalSemaphoreKHR) NextGetDeviceProcAddr(device, "vkSignalSemaphoreKHR")
+        : nullptr;
+      TrimCommandPool = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkTrimCommandPool) NextGetDeviceProcAddr(device, "vkTrimCommandPool")
+        : nullptr;
+      TrimCommandPoolKHR = enabled.Has(procaddr::DeviceExtension::KHR_maintenance1)
+        ? (PFN_vkTrimCommandPoolKHR) NextGetDeviceProcAddr(device, "vkTrimCommandPoolKHR")
+        : nullptr;
+      UninitializePerformanceApiINTEL = enabled.Has(procaddr::DeviceExtension::INTEL_performance_query)
+        ? (PFN_vkUninitializePerformanceApiINTEL) NextGetDeviceProcAddr(device, "vkUninitializePerformanceApiINTEL")
+        : nullptr;
+      UnmapMemory = (PFN_vkUnmapMemory) NextGetDeviceProcAddr(device, "vkUnmapMemory");
+      UnmapMemory2KHR = enabled.Has(procaddr::DeviceExtension::KHR_map_memory2)
+        ? (PFN_vkUnmapMemory2KHR) NextGetDeviceProcAddr(device, "vkUnmapMemory2KHR")
+        : nullptr;
+      UpdateDescriptorSetWithTemplate = enabled.Version(VK_API_VERSION_1_1)
+        ? (PFN_vkUpdateDescriptorSetWithTemplate) NextGetDeviceProcAddr(device, "vkUpdateDescriptorSetWithTemplate")
+        : nullptr;
+      UpdateDescriptorSetWithTemplateKHR = enabled.Has(procaddr::DeviceExtension::KHR_descriptor_update_template)
+        ? (PFN_vkUpdateDescriptorSetWithTemplateKHR) NextGetDeviceProcAddr(device, "vkUpdateDescriptorSetWithTemplateKHR")
+        : nullptr;
+      UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) NextGetDeviceProcAddr(device, "vkUpdateDescriptorSets");
+      UpdateVideoSessionParametersKHR = enabled.Has(procaddr::DeviceExtension::KHR_video_queue)
+        ? (PFN_vkUpdateVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkUpdateVideoSessionParametersKHR")
+        : nullptr;
+      WaitForFences = (PFN_vkWaitForFences) NextGetDeviceProcAddr(device, "vkWaitForFences");
+      WaitForPresentKHR = enabled.Has(procaddr::DeviceExtension::KHR_present_wait)
+        ? (PFN_vkWaitForPresentKHR) NextGetDeviceProcAddr(device, "vkWaitForPresentKHR")
+        : nullptr;
+      WaitSemaphores = enabled.Version(VK_API_VERSION_1_2)
+        ? (PFN_vkWaitSemaphores) NextGetDeviceProcAddr(device, "vkWaitSemaphores")
+        : nullptr;
+      WaitSemaphoresKHR = enabled.Has(procaddr::DeviceExtension::KHR_timeline_semaphore)
+        ? (PFN_vkWaitSemaphoresKHR) NextGetDeviceProcAddr(device, "vkWaitSemaphoresKHR")
+        : nullptr;
+      WriteAccelerationStructuresPropertiesKHR = enabled.Has(procaddr::DeviceExtension::KHR_acceleration_structure)
+        ? (PFN_vkWriteAccelerationStructuresPropertiesKHR) NextGetDeviceProcAddr(device, "vkWriteAccelerationStructuresPropertiesKHR")
+        : nullptr;
+      WriteMicromapsPropertiesEXT = enabled.Has(procaddr::DeviceExtension::EXT_opacity_micromap)
+        ? (PFN_vkWriteMicromapsPropertiesEXT) NextGetDeviceProcAddr(device, "vkWriteMicromapsPropertiesEXT")
+        : nullptr;
+#else
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      AcquireFullScreenExclusiveModeEXT = (PFN_vkAcquireFullScreenExclusiveModeEXT) NextGetDeviceProcAddr(device, "vkAcquireFullScreenExclusiveModeEXT");
+#endif
+      AcquireNextImage2KHR = (PFN_vkAcquireNextImage2KHR) NextGetDeviceProcAddr(device, "vkAcquireNextImage2KHR");
+      AcquireNextImageKHR = (PFN_vkAcquireNextImageKHR) NextGetDeviceProcAddr(device, "vkAcquireNextImageKHR");
+      AcquirePerformanceConfigurationINTEL = (PFN_vkAcquirePerformanceConfigurationINTEL) NextGetDeviceProcAddr(device, "vkAcquirePerformanceConfigurationINTEL");
+      AcquireProfilingLockKHR = (PFN_vkAcquireProfilingLockKHR) NextGetDeviceProcAddr(device, "vkAcquireProfilingLockKHR");
+      AllocateCommandBuffers = (PFN_vkAllocateCommandBuffers) NextGetDeviceProcAddr(device, "vkAllocateCommandBuffers");
+      AllocateDescriptorSets = (PFN_vkAllocateDescriptorSets) NextGetDeviceProcAddr(device, "vkAllocateDescriptorSets");
+      AllocateMemory = (PFN_vkAllocateMemory) NextGetDeviceProcAddr(device, "vkAllocateMemory");
+      BeginCommandBuffer = (PFN_vkBeginCommandBuffer) NextGetDeviceProcAddr(device, "vkBeginCommandBuffer");
+      BindAccelerationStructureMemoryNV = (PFN_vkBindAccelerationStructureMemoryNV) NextGetDeviceProcAddr(device, "vkBindAccelerationStructureMemoryNV");
+      BindBufferMemory = (PFN_vkBindBufferMemory) NextGetDeviceProcAddr(device, "vkBindBufferMemory");
+      BindBufferMemory2 = (PFN_vkBindBufferMemory2) NextGetDeviceProcAddr(device, "vkBindBufferMemory2");
+      BindBufferMemory2KHR = (PFN_vkBindBufferMemory2KHR) NextGetDeviceProcAddr(device, "vkBindBufferMemory2KHR");
+      BindImageMemory = (PFN_vkBindImageMemory) NextGetDeviceProcAddr(device, "vkBindImageMemory");
+      BindImageMemory2 = (PFN_vkBindImageMemory2) NextGetDeviceProcAddr(device, "vkBindImageMemory2");
+      BindImageMemory2KHR = (PFN_vkBindImageMemory2KHR) NextGetDeviceProcAddr(device, "vkBindImageMemory2KHR");
+      BindOpticalFlowSessionImageNV = (PFN_vkBindOpticalFlowSessionImageNV) NextGetDeviceProcAddr(device, "vkBindOpticalFlowSessionImageNV");
+      BindVideoSessionMemoryKHR = (PFN_vkBindVideoSessionMemoryKHR) NextGetDeviceProcAddr(device, "vkBindVideoSessionMemoryKHR");
+      BuildAccelerationStructuresKHR = (PFN_vkBuildAccelerationStructuresKHR) NextGetDeviceProcAddr(device, "vkBuildAccelerationStructuresKHR");
+      BuildMicromapsEXT = (PFN_vkBuildMicromapsEXT) NextGetDeviceProcAddr(device, "vkBuildMicromapsEXT");
+      CmdBeginConditionalRenderingEXT = (PFN_vkCmdBeginConditionalRenderingEXT) NextGetDeviceProcAddr(device, "vkCmdBeginConditionalRenderingEXT");
+      CmdBeginDebugUtilsLabelEXT = (PFN_vkCmdBeginDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkCmdBeginDebugUtilsLabelEXT");
+      CmdBeginQuery = (PFN_vkCmdBeginQuery) NextGetDeviceProcAddr(device, "vkCmdBeginQuery");
+      CmdBeginQueryIndexedEXT = (PFN_vkCmdBeginQueryIndexedEXT) NextGetDeviceProcAddr(device, "vkCmdBeginQueryIndexedEXT");
+      CmdBeginRenderPass = (PFN_vkCmdBeginRenderPass) NextGetDeviceProcAddr(device, "vkCmdBeginRenderPass");
+      CmdBeginRenderPass2 = (PFN_vkCmdBeginRenderPass2) NextGetDeviceProcAddr(device, "vkCmdBeginRenderPass2");
+      CmdBeginRenderPass2KHR = (PFN_vkCmdBeginRenderPass2KHR) NextGetDeviceProcAddr(device, "vkCmdBeginRenderPass2KHR");
+      CmdBeginRendering = (PFN_vkCmdBeginRendering) NextGetDeviceProcAddr(device, "vkCmdBeginRendering");
+      CmdBeginRenderingKHR = (PFN_vkCmdBeginRenderingKHR) NextGetDeviceProcAddr(device, "vkCmdBeginRenderingKHR");
+      CmdBeginTransformFeedbackEXT = (PFN_vkCmdBeginTransformFeedbackEXT) NextGetDeviceProcAddr(device, "vkCmdBeginTransformFeedbackEXT");
+      CmdBeginVideoCodingKHR = (PFN_vkCmdBeginVideoCodingKHR) NextGetDeviceProcAddr(device, "vkCmdBeginVideoCodingKHR");
+      CmdBindDescriptorBufferEmbeddedSamplersEXT = (PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT) NextGetDeviceProcAddr(device, "vkCmdBindDescriptorBufferEmbeddedSamplersEXT");
+      CmdBindDescriptorBuffersEXT = (PFN_vkCmdBindDescriptorBuffersEXT) NextGetDeviceProcAddr(device, "vkCmdBindDescriptorBuffersEXT");
+      CmdBindDescriptorSets = (PFN_vkCmdBindDescriptorSets) NextGetDeviceProcAddr(device, "vkCmdBindDescriptorSets");
+      CmdBindIndexBuffer = (PFN_vkCmdBindIndexBuffer) NextGetDeviceProcAddr(device, "vkCmdBindIndexBuffer");
+      CmdBindInvocationMaskHUAWEI = (PFN_vkCmdBindInvocationMaskHUAWEI) NextGetDeviceProcAddr(device, "vkCmdBindInvocationMaskHUAWEI");
+      CmdBindPipeline = (PFN_vkCmdBindPipeline) NextGetDeviceProcAddr(device, "vkCmdBindPipeline");
+      CmdBindPipelineShaderGroupNV = (PFN_vkCmdBindPipelineShaderGroupNV) NextGetDeviceProcAddr(device, "vkCmdBindPipelineShaderGroupNV");
+      CmdBindShadersEXT = (PFN_vkCmdBindShadersEXT) NextGetDeviceProcAddr(device, "vkCmdBindShadersEXT");
+      CmdBindShadingRateImageNV = (PFN_vkCmdBindShadingRateImageNV) NextGetDeviceProcAddr(device, "vkCmdBindShadingRateImageNV");
+      CmdBindTransformFeedbackBuffersEXT = (PFN_vkCmdBindTransformFeedbackBuffersEXT) NextGetDeviceProcAddr(device, "vkCmdBindTransformFeedbackBuffersEXT");
+      CmdBindVertexBuffers = (PFN_vkCmdBindVertexBuffers) NextGetDeviceProcAddr(device, "vkCmdBindVertexBuffers");
+      CmdBindVertexBuffers2 = (PFN_vkCmdBindVertexBuffers2) NextGetDeviceProcAddr(device, "vkCmdBindVertexBuffers2");
+      CmdBindVertexBuffers2EXT = (PFN_vkCmdBindVertexBuffers2EXT) NextGetDeviceProcAddr(device, "vkCmdBindVertexBuffers2EXT");
+      CmdBlitImage = (PFN_vkCmdBlitImage) NextGetDeviceProcAddr(device, "vkCmdBlitImage");
+      CmdBlitImage2 = (PFN_vkCmdBlitImage2) NextGetDeviceProcAddr(device, "vkCmdBlitImage2");
+      CmdBlitImage2KHR = (PFN_vkCmdBlitImage2KHR) NextGetDeviceProcAddr(device, "vkCmdBlitImage2KHR");
+      CmdBuildAccelerationStructureNV = (PFN_vkCmdBuildAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkCmdBuildAccelerationStructureNV");
+      CmdBuildAccelerationStructuresIndirectKHR = (PFN_vkCmdBuildAccelerationStructuresIndirectKHR) NextGetDeviceProcAddr(device, "vkCmdBuildAccelerationStructuresIndirectKHR");
+      CmdBuildAccelerationStructuresKHR = (PFN_vkCmdBuildAccelerationStructuresKHR) NextGetDeviceProcAddr(device, "vkCmdBuildAccelerationStructuresKHR");
+      CmdBuildMicromapsEXT = (PFN_vkCmdBuildMicromapsEXT) NextGetDeviceProcAddr(device, "vkCmdBuildMicromapsEXT");
+      CmdClearAttachments = (PFN_vkCmdClearAttachments) NextGetDeviceProcAddr(device, "vkCmdClearAttachments");
+      CmdClearColorImage = (PFN_vkCmdClearColorImage) NextGetDeviceProcAddr(device, "vkCmdClearColorImage");
+      CmdClearDepthStencilImage = (PFN_vkCmdClearDepthStencilImage) NextGetDeviceProcAddr(device, "vkCmdClearDepthStencilImage");
+      CmdControlVideoCodingKHR = (PFN_vkCmdControlVideoCodingKHR) NextGetDeviceProcAddr(device, "vkCmdControlVideoCodingKHR");
+      CmdCopyAccelerationStructureKHR = (PFN_vkCmdCopyAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCmdCopyAccelerationStructureKHR");
+      CmdCopyAccelerationStructureNV = (PFN_vkCmdCopyAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkCmdCopyAccelerationStructureNV");
+      CmdCopyAccelerationStructureToMemoryKHR = (PFN_vkCmdCopyAccelerationStructureToMemoryKHR) NextGetDeviceProcAddr(device, "vkCmdCopyAccelerationStructureToMemoryKHR");
+      CmdCopyBuffer = (PFN_vkCmdCopyBuffer) NextGetDeviceProcAddr(device, "vkCmdCopyBuffer");
+      CmdCopyBuffer2 = (PFN_vkCmdCopyBuffer2) NextGetDeviceProcAddr(device, "vkCmdCopyBuffer2");
+      CmdCopyBuffer2KHR = (PFN_vkCmdCopyBuffer2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyBuffer2KHR");
+      CmdCopyBufferToImage = (PFN_vkCmdCopyBufferToImage) NextGetDeviceProcAddr(device, "vkCmdCopyBufferToImage");
+      CmdCopyBufferToImage2 = (PFN_vkCmdCopyBufferToImage2) NextGetDeviceProcAddr(device, "vkCmdCopyBufferToImage2");
+      CmdCopyBufferToImage2KHR = (PFN_vkCmdCopyBufferToImage2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyBufferToImage2KHR");
+      CmdCopyImage = (PFN_vkCmdCopyImage) NextGetDeviceProcAddr(device, "vkCmdCopyImage");
+      CmdCopyImage2 = (PFN_vkCmdCopyImage2) NextGetDeviceProcAddr(device, "vkCmdCopyImage2");
+      CmdCopyImage2KHR = (PFN_vkCmdCopyImage2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyImage2KHR");
+      CmdCopyImageToBuffer = (PFN_vkCmdCopyImageToBuffer) NextGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer");
+      CmdCopyImageToBuffer2 = (PFN_vkCmdCopyImageToBuffer2) NextGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer2");
+      CmdCopyImageToBuffer2KHR = (PFN_vkCmdCopyImageToBuffer2KHR) NextGetDeviceProcAddr(device, "vkCmdCopyImageToBuffer2KHR");
+      CmdCopyMemoryIndirectNV = (PFN_vkCmdCopyMemoryIndirectNV) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryIndirectNV");
+      CmdCopyMemoryToAccelerationStructureKHR = (PFN_vkCmdCopyMemoryToAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryToAccelerationStructureKHR");
+      CmdCopyMemoryToImageIndirectNV = (PFN_vkCmdCopyMemoryToImageIndirectNV) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryToImageIndirectNV");
+      CmdCopyMemoryToMicromapEXT = (PFN_vkCmdCopyMemoryToMicromapEXT) NextGetDeviceProcAddr(device, "vkCmdCopyMemoryToMicromapEXT");
+      CmdCopyMicromapEXT = (PFN_vkCmdCopyMicromapEXT) NextGetDeviceProcAddr(device, "vkCmdCopyMicromapEXT");
+      CmdCopyMicromapToMemoryEXT = (PFN_vkCmdCopyMicromapToMemoryEXT) NextGetDeviceProcAddr(device, "vkCmdCopyMicromapToMemoryEXT");
+      CmdCopyQueryPoolResults = (PFN_vkCmdCopyQueryPoolResults) NextGetDeviceProcAddr(device, "vkCmdCopyQueryPoolResults");
+      CmdDebugMarkerBeginEXT = (PFN_vkCmdDebugMarkerBeginEXT) NextGetDeviceProcAddr(device, "vkCmdDebugMarkerBeginEXT");
+      CmdDebugMarkerEndEXT = (PFN_vkCmdDebugMarkerEndEXT) NextGetDeviceProcAddr(device, "vkCmdDebugMarkerEndEXT");
+      CmdDebugMarkerInsertEXT = (PFN_vkCmdDebugMarkerInsertEXT) NextGetDeviceProcAddr(device, "vkCmdDebugMarkerInsertEXT");
+      CmdDecodeVideoKHR = (PFN_vkCmdDecodeVideoKHR) NextGetDeviceProcAddr(device, "vkCmdDecodeVideoKHR");
+      CmdDecompressMemoryIndirectCountNV = (PFN_vkCmdDecompressMemoryIndirectCountNV) NextGetDeviceProcAddr(device, "vkCmdDecompressMemoryIndirectCountNV");
+      CmdDecompressMemoryNV = (PFN_vkCmdDecompressMemoryNV) NextGetDeviceProcAddr(device, "vkCmdDecompressMemoryNV");
+      CmdDispatch = (PFN_vkCmdDispatch) NextGetDeviceProcAddr(device, "vkCmdDispatch");
+      CmdDispatchBase = (PFN_vkCmdDispatchBase) NextGetDeviceProcAddr(device, "vkCmdDispatchBase");
+      CmdDispatchBaseKHR = (PFN_vkCmdDispatchBaseKHR) NextGetDeviceProcAddr(device, "vkCmdDispatchBaseKHR");
+      CmdDispatchIndirect = (PFN_vkCmdDispatchIndirect) NextGetDeviceProcAddr(device, "vkCmdDispatchIndirect");
+      CmdDraw = (PFN_vkCmdDraw) NextGetDeviceProcAddr(device, "vkCmdDraw");
+      CmdDrawClusterHUAWEI = (PFN_vkCmdDrawClusterHUAWEI) NextGetDeviceProcAddr(device, "vkCmdDrawClusterHUAWEI");
+      CmdDrawClusterIndirectHUAWEI = (PFN_vkCmdDrawClusterIndirectHUAWEI) NextGetDeviceProcAddr(device, "vkCmdDrawClusterIndirectHUAWEI");
+      CmdDrawIndexed = (PFN_vkCmdDrawIndexed) NextGetDeviceProcAddr(device, "vkCmdDrawIndexed");
+      CmdDrawIndexedIndirect = (PFN_vkCmdDrawIndexedIndirect) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirect");
+      CmdDrawIndexedIndirectCount = (PFN_vkCmdDrawIndexedIndirectCount) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCount");
+      CmdDrawIndexedIndirectCountAMD = (PFN_vkCmdDrawIndexedIndirectCountAMD) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCountAMD");
+      CmdDrawIndexedIndirectCountKHR = (PFN_vkCmdDrawIndexedIndirectCountKHR) NextGetDeviceProcAddr(device, "vkCmdDrawIndexedIndirectCountKHR");
+      CmdDrawIndirect = (PFN_vkCmdDrawIndirect) NextGetDeviceProcAddr(device, "vkCmdDrawIndirect");
+      CmdDrawIndirectByteCountEXT = (PFN_vkCmdDrawIndirectByteCountEXT) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectByteCountEXT");
+      CmdDrawIndirectCount = (PFN_vkCmdDrawIndirectCount) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectCount");
+      CmdDrawIndirectCountAMD = (PFN_vkCmdDrawIndirectCountAMD) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectCountAMD");
+      CmdDrawIndirectCountKHR = (PFN_vkCmdDrawIndirectCountKHR) NextGetDeviceProcAddr(device, "vkCmdDrawIndirectCountKHR");
+      CmdDrawMeshTasksEXT = (PFN_vkCmdDrawMeshTasksEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksEXT");
+      CmdDrawMeshTasksIndirectCountEXT = (PFN_vkCmdDrawMeshTasksIndirectCountEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectCountEXT");
+      CmdDrawMeshTasksIndirectCountNV = (PFN_vkCmdDrawMeshTasksIndirectCountNV) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectCountNV");
+      CmdDrawMeshTasksIndirectEXT = (PFN_vkCmdDrawMeshTasksIndirectEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectEXT");
+      CmdDrawMeshTasksIndirectNV = (PFN_vkCmdDrawMeshTasksIndirectNV) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksIndirectNV");
+      CmdDrawMeshTasksNV = (PFN_vkCmdDrawMeshTasksNV) NextGetDeviceProcAddr(device, "vkCmdDrawMeshTasksNV");
+      CmdDrawMultiEXT = (PFN_vkCmdDrawMultiEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMultiEXT");
+      CmdDrawMultiIndexedEXT = (PFN_vkCmdDrawMultiIndexedEXT) NextGetDeviceProcAddr(device, "vkCmdDrawMultiIndexedEXT");
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      CmdEncodeVideoKHR = (PFN_vkCmdEncodeVideoKHR) NextGetDeviceProcAddr(device, "vkCmdEncodeVideoKHR");
+#endif
+      CmdEndConditionalRenderingEXT = (PFN_vkCmdEndConditionalRenderingEXT) NextGetDeviceProcAddr(device, "vkCmdEndConditionalRenderingEXT");
+      CmdEndDebugUtilsLabelEXT = (PFN_vkCmdEndDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkCmdEndDebugUtilsLabelEXT");
+      CmdEndQuery = (PFN_vkCmdEndQuery) NextGetDeviceProcAddr(device, "vkCmdEndQuery");
+      CmdEndQueryIndexedEXT = (PFN_vkCmdEndQueryIndexedEXT) NextGetDeviceProcAddr(device, "vkCmdEndQueryIndexedEXT");
+      CmdEndRenderPass = (PFN_vkCmdEndRenderPass) NextGetDeviceProcAddr(device, "vkCmdEndRenderPass");
+      CmdEndRenderPass2 = (PFN_vkCmdEndRenderPass2) NextGetDeviceProcAddr(device, "vkCmdEndRenderPass2");
+      CmdEndRenderPass2KHR = (PFN_vkCmdEndRenderPass2KHR) NextGetDeviceProcAddr(device, "vkCmdEndRenderPass2KHR");
+      CmdEndRendering = (PFN_vkCmdEndRendering) NextGetDeviceProcAddr(device, "vkCmdEndRendering");
+      CmdEndRenderingKHR = (PFN_vkCmdEndRenderingKHR) NextGetDeviceProcAddr(device, "vkCmdEndRenderingKHR");
+      CmdEndTransformFeedbackEXT = (PFN_vkCmdEndTransformFeedbackEXT) NextGetDeviceProcAddr(device, "vkCmdEndTransformFeedbackEXT");
+      CmdEndVideoCodingKHR = (PFN_vkCmdEndVideoCodingKHR) NextGetDeviceProcAddr(device, "vkCmdEndVideoCodingKHR");
+      CmdExecuteCommands = (PFN_vkCmdExecuteCommands) NextGetDeviceProcAddr(device, "vkCmdExecuteCommands");
+      CmdExecuteGeneratedCommandsNV = (PFN_vkCmdExecuteGeneratedCommandsNV) NextGetDeviceProcAddr(device, "vkCmdExecuteGeneratedCommandsNV");
+      CmdFillBuffer = (PFN_vkCmdFillBuffer) NextGetDeviceProcAddr(device, "vkCmdFillBuffer");
+      CmdInsertDebugUtilsLabelEXT = (PFN_vkCmdInsertDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkCmdInsertDebugUtilsLabelEXT");
+      CmdNextSubpass = (PFN_vkCmdNextSubpass) NextGetDeviceProcAddr(device, "vkCmdNextSubpass");
+      CmdNextSubpass2 = (PFN_vkCmdNextSubpass2) NextGetDeviceProcAddr(device, "vkCmdNextSubpass2");
+      CmdNextSubpass2KHR = (PFN_vkCmdNextSubpass2KHR) NextGetDeviceProcAddr(device, "vkCmdNextSubpass2KHR");
+      CmdOpticalFlowExecuteNV = (PFN_vkCmdOpticalFlowExecuteNV) NextGetDeviceProcAddr(device, "vkCmdOpticalFlowExecuteNV");
+      CmdPipelineBarrier = (PFN_vkCmdPipelineBarrier) NextGetDeviceProcAddr(device, "vkCmdPipelineBarrier");
+      CmdPipelineBarrier2 = (PFN_vkCmdPipelineBarrier2) NextGetDeviceProcAddr(device, "vkCmdPipelineBarrier2");
+      CmdPipelineBarrier2KHR = (PFN_vkCmdPipelineBarrier2KHR) NextGetDeviceProcAddr(device, "vkCmdPipelineBarrier2KHR");
+      CmdPreprocessGeneratedCommandsNV = (PFN_vkCmdPreprocessGeneratedCommandsNV) NextGetDeviceProcAddr(device, "vkCmdPreprocessGeneratedCommandsNV");
+      CmdPushConstants = (PFN_vkCmdPushConstants) NextGetDeviceProcAddr(device, "vkCmdPushConstants");
+      CmdPushDescriptorSetKHR = (PFN_vkCmdPushDescriptorSetKHR) NextGetDeviceProcAddr(device, "vkCmdPushDescriptorSetKHR");
+      CmdPushDescriptorSetWithTemplateKHR = (PFN_vkCmdPushDescriptorSetWithTemplateKHR) NextGetDeviceProcAddr(device, "vkCmdPushDescriptorSetWithTemplateKHR");
+      CmdResetEvent = (PFN_vkCmdResetEvent) NextGetDeviceProcAddr(device, "vkCmdResetEvent");
+      CmdResetEvent2 = (PFN_vkCmdResetEvent2) NextGetDeviceProcAddr(device, "vkCmdResetEvent2");
+      CmdResetEvent2KHR = (PFN_vkCmdResetEvent2KHR) NextGetDeviceProcAddr(device, "vkCmdResetEvent2KHR");
+      CmdResetQueryPool = (PFN_vkCmdResetQueryPool) NextGetDeviceProcAddr(device, "vkCmdResetQueryPool");
+      CmdResolveImage = (PFN_vkCmdResolveImage) NextGetDeviceProcAddr(device, "vkCmdResolveImage");
+      CmdResolveImage2 = (PFN_vkCmdResolveImage2) NextGetDeviceProcAddr(device, "vkCmdResolveImage2");
+      CmdResolveImage2KHR = (PFN_vkCmdResolveImage2KHR) NextGetDeviceProcAddr(device, "vkCmdResolveImage2KHR");
+      CmdSetAlphaToCoverageEnableEXT = (PFN_vkCmdSetAlphaToCoverageEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetAlphaToCoverageEnableEXT");
+      CmdSetAlphaToOneEnableEXT = (PFN_vkCmdSetAlphaToOneEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetAlphaToOneEnableEXT");
+      CmdSetAttachmentFeedbackLoopEnableEXT = (PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
+      CmdSetBlendConstants = (PFN_vkCmdSetBlendConstants) NextGetDeviceProcAddr(device, "vkCmdSetBlendConstants");
+      CmdSetCheckpointNV = (PFN_vkCmdSetCheckpointNV) NextGetDeviceProcAddr(device, "vkCmdSetCheckpointNV");
+      CmdSetCoarseSampleOrderNV = (PFN_vkCmdSetCoarseSampleOrderNV) NextGetDeviceProcAddr(device, "vkCmdSetCoarseSampleOrderNV");
+      CmdSetColorBlendAdvancedEXT = (PFN_vkCmdSetColorBlendAdvancedEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorBlendAdvancedEXT");
+      CmdSetColorBlendEnableEXT = (PFN_vkCmdSetColorBlendEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorBlendEnableEXT");
+      CmdSetColorBlendEquationEXT = (PFN_vkCmdSetColorBlendEquationEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorBlendEquationEXT");
+      CmdSetColorWriteEnableEXT = (PFN_vkCmdSetColorWriteEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorWriteEnableEXT");
+      CmdSetColorWriteMaskEXT = (PFN_vkCmdSetColorWriteMaskEXT) NextGetDeviceProcAddr(device, "vkCmdSetColorWriteMaskEXT");
+      CmdSetConservativeRasterizationModeEXT = (PFN_vkCmdSetConservativeRasterizationModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetConservativeRasterizationModeEXT");
+      CmdSetCoverageModulationModeNV = (PFN_vkCmdSetCoverageModulationModeNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageModulationModeNV");
+      CmdSetCoverageModulationTableEnableNV = (PFN_vkCmdSetCoverageModulationTableEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageModulationTableEnableNV");
+      CmdSetCoverageModulationTableNV = (PFN_vkCmdSetCoverageModulationTableNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageModulationTableNV");
+      CmdSetCoverageReductionModeNV = (PFN_vkCmdSetCoverageReductionModeNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageReductionModeNV");
+      CmdSetCoverageToColorEnableNV = (PFN_vkCmdSetCoverageToColorEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageToColorEnableNV");
+      CmdSetCoverageToColorLocationNV = (PFN_vkCmdSetCoverageToColorLocationNV) NextGetDeviceProcAddr(device, "vkCmdSetCoverageToColorLocationNV");
+      CmdSetCullMode = (PFN_vkCmdSetCullMode) NextGetDeviceProcAddr(device, "vkCmdSetCullMode");
+      CmdSetCullModeEXT = (PFN_vkCmdSetCullModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetCullModeEXT");
+      CmdSetDepthBias = (PFN_vkCmdSetDepthBias) NextGetDeviceProcAddr(device, "vkCmdSetDepthBias");
+      CmdSetDepthBiasEnable = (PFN_vkCmdSetDepthBiasEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthBiasEnable");
+      CmdSetDepthBiasEnableEXT = (PFN_vkCmdSetDepthBiasEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthBiasEnableEXT");
+      CmdSetDepthBounds = (PFN_vkCmdSetDepthBounds) NextGetDeviceProcAddr(device, "vkCmdSetDepthBounds");
+      CmdSetDepthBoundsTestEnable = (PFN_vkCmdSetDepthBoundsTestEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthBoundsTestEnable");
+      CmdSetDepthBoundsTestEnableEXT = (PFN_vkCmdSetDepthBoundsTestEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthBoundsTestEnableEXT");
+      CmdSetDepthClampEnableEXT = (PFN_vkCmdSetDepthClampEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthClampEnableEXT");
+      CmdSetDepthClipEnableEXT = (PFN_vkCmdSetDepthClipEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthClipEnableEXT");
+      CmdSetDepthClipNegativeOneToOneEXT = (PFN_vkCmdSetDepthClipNegativeOneToOneEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthClipNegativeOneToOneEXT");
+      CmdSetDepthCompareOp = (PFN_vkCmdSetDepthCompareOp) NextGetDeviceProcAddr(device, "vkCmdSetDepthCompareOp");
+      CmdSetDepthCompareOpEXT = (PFN_vkCmdSetDepthCompareOpEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthCompareOpEXT");
+      CmdSetDepthTestEnable = (PFN_vkCmdSetDepthTestEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthTestEnable");
+      CmdSetDepthTestEnableEXT = (PFN_vkCmdSetDepthTestEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthTestEnableEXT");
+      CmdSetDepthWriteEnable = (PFN_vkCmdSetDepthWriteEnable) NextGetDeviceProcAddr(device, "vkCmdSetDepthWriteEnable");
+      CmdSetDepthWriteEnableEXT = (PFN_vkCmdSetDepthWriteEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDepthWriteEnableEXT");
+      CmdSetDescriptorBufferOffsetsEXT = (PFN_vkCmdSetDescriptorBufferOffsetsEXT) NextGetDeviceProcAddr(device, "vkCmdSetDescriptorBufferOffsetsEXT");
+      CmdSetDeviceMask = (PFN_vkCmdSetDeviceMask) NextGetDeviceProcAddr(device, "vkCmdSetDeviceMask");
+      CmdSetDeviceMaskKHR = (PFN_vkCmdSetDeviceMaskKHR) NextGetDeviceProcAddr(device, "vkCmdSetDeviceMaskKHR");
+      CmdSetDiscardRectangleEXT = (PFN_vkCmdSetDiscardRectangleEXT) NextGetDeviceProcAddr(device, "vkCmdSetDiscardRectangleEXT");
+      CmdSetDiscardRectangleEnableEXT = (PFN_vkCmdSetDiscardRectangleEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetDiscardRectangleEnableEXT");
+      CmdSetDiscardRectangleModeEXT = (PFN_vkCmdSetDiscardRectangleModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetDiscardRectangleModeEXT");
+      CmdSetEvent = (PFN_vkCmdSetEvent) NextGetDeviceProcAddr(device, "vkCmdSetEvent");
+      CmdSetEvent2 = (PFN_vkCmdSetEvent2) NextGetDeviceProcAddr(device, "vkCmdSetEvent2");
+      CmdSetEvent2KHR = (PFN_vkCmdSetEvent2KHR) NextGetDeviceProcAddr(device, "vkCmdSetEvent2KHR");
+      CmdSetExclusiveScissorEnableNV = (PFN_vkCmdSetExclusiveScissorEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetExclusiveScissorEnableNV");
+      CmdSetExclusiveScissorNV = (PFN_vkCmdSetExclusiveScissorNV) NextGetDeviceProcAddr(device, "vkCmdSetExclusiveScissorNV");
+      CmdSetExtraPrimitiveOverestimationSizeEXT = (PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT) NextGetDeviceProcAddr(device, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
+      CmdSetFragmentShadingRateEnumNV = (PFN_vkCmdSetFragmentShadingRateEnumNV) NextGetDeviceProcAddr(device, "vkCmdSetFragmentShadingRateEnumNV");
+      CmdSetFragmentShadingRateKHR = (PFN_vkCmdSetFragmentShadingRateKHR) NextGetDeviceProcAddr(device, "vkCmdSetFragmentShadingRateKHR");
+      CmdSetFrontFace = (PFN_vkCmdSetFrontFace) NextGetDeviceProcAddr(device, "vkCmdSetFrontFace");
+      CmdSetFrontFaceEXT = (PFN_vkCmdSetFrontFaceEXT) NextGetDeviceProcAddr(device, "vkCmdSetFrontFaceEXT");
+      CmdSetLineRasterizationModeEXT = (PFN_vkCmdSetLineRasterizationModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetLineRasterizationModeEXT");
+      CmdSetLineStippleEXT = (PFN_vkCmdSetLineStippleEXT) NextGetDeviceProcAddr(device, "vkCmdSetLineStippleEXT");
+      CmdSetLineStippleEnableEXT = (PFN_vkCmdSetLineStippleEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetLineStippleEnableEXT");
+      CmdSetLineWidth = (PFN_vkCmdSetLineWidth) NextGetDeviceProcAddr(device, "vkCmdSetLineWidth");
+      CmdSetLogicOpEXT = (PFN_vkCmdSetLogicOpEXT) NextGetDeviceProcAddr(device, "vkCmdSetLogicOpEXT");
+      CmdSetLogicOpEnableEXT = (PFN_vkCmdSetLogicOpEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetLogicOpEnableEXT");
+      CmdSetPatchControlPointsEXT = (PFN_vkCmdSetPatchControlPointsEXT) NextGetDeviceProcAddr(device, "vkCmdSetPatchControlPointsEXT");
+      CmdSetPerformanceMarkerINTEL = (PFN_vkCmdSetPerformanceMarkerINTEL) NextGetDeviceProcAddr(device, "vkCmdSetPerformanceMarkerINTEL");
+      CmdSetPerformanceOverrideINTEL = (PFN_vkCmdSetPerformanceOverrideINTEL) NextGetDeviceProcAddr(device, "vkCmdSetPerformanceOverrideINTEL");
+      CmdSetPerformanceStreamMarkerINTEL = (PFN_vkCmdSetPerformanceStreamMarkerINTEL) NextGetDeviceProcAddr(device, "vkCmdSetPerformanceStreamMarkerINTEL");
+      CmdSetPolygonModeEXT = (PFN_vkCmdSetPolygonModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetPolygonModeEXT");
+      CmdSetPrimitiveRestartEnable = (PFN_vkCmdSetPrimitiveRestartEnable) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveRestartEnable");
+      CmdSetPrimitiveRestartEnableEXT = (PFN_vkCmdSetPrimitiveRestartEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveRestartEnableEXT");
+      CmdSetPrimitiveTopology = (PFN_vkCmdSetPrimitiveTopology) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveTopology");
+      CmdSetPrimitiveTopologyEXT = (PFN_vkCmdSetPrimitiveTopologyEXT) NextGetDeviceProcAddr(device, "vkCmdSetPrimitiveTopologyEXT");
+      CmdSetProvokingVertexModeEXT = (PFN_vkCmdSetProvokingVertexModeEXT) NextGetDeviceProcAddr(device, "vkCmdSetProvokingVertexModeEXT");
+      CmdSetRasterizationSamplesEXT = (PFN_vkCmdSetRasterizationSamplesEXT) NextGetDeviceProcAddr(device, "vkCmdSetRasterizationSamplesEXT");
+      CmdSetRasterizationStreamEXT = (PFN_vkCmdSetRasterizationStreamEXT) NextGetDeviceProcAddr(device, "vkCmdSetRasterizationStreamEXT");
+      CmdSetRasterizerDiscardEnable = (PFN_vkCmdSetRasterizerDiscardEnable) NextGetDeviceProcAddr(device, "vkCmdSetRasterizerDiscardEnable");
+      CmdSetRasterizerDiscardEnableEXT = (PFN_vkCmdSetRasterizerDiscardEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetRasterizerDiscardEnableEXT");
+      CmdSetRayTracingPipelineStackSizeKHR = (PFN_vkCmdSetRayTracingPipelineStackSizeKHR) NextGetDeviceProcAddr(device, "vkCmdSetRayTracingPipelineStackSizeKHR");
+      CmdSetRepresentativeFragmentTestEnableNV = (PFN_vkCmdSetRepresentativeFragmentTestEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetRepresentativeFragmentTestEnableNV");
+      CmdSetSampleLocationsEXT = (PFN_vkCmdSetSampleLocationsEXT) NextGetDeviceProcAddr(device, "vkCmdSetSampleLocationsEXT");
+      CmdSetSampleLocationsEnableEXT = (PFN_vkCmdSetSampleLocationsEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetSampleLocationsEnableEXT");
+      CmdSetSampleMaskEXT = (PFN_vkCmdSetSampleMaskEXT) NextGetDeviceProcAddr(device, "vkCmdSetSampleMaskEXT");
+      CmdSetScissor = (PFN_vkCmdSetScissor) NextGetDeviceProcAddr(device, "vkCmdSetScissor");
+      CmdSetScissorWithCount = (PFN_vkCmdSetScissorWithCount) NextGetDeviceProcAddr(device, "vkCmdSetScissorWithCount");
+      CmdSetScissorWithCountEXT = (PFN_vkCmdSetScissorWithCountEXT) NextGetDeviceProcAddr(device, "vkCmdSetScissorWithCountEXT");
+      CmdSetShadingRateImageEnableNV = (PFN_vkCmdSetShadingRateImageEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetShadingRateImageEnableNV");
+      CmdSetStencilCompareMask = (PFN_vkCmdSetStencilCompareMask) NextGetDeviceProcAddr(device, "vkCmdSetStencilCompareMask");
+      CmdSetStencilOp = (PFN_vkCmdSetStencilOp) NextGetDeviceProcAddr(device, "vkCmdSetStencilOp");
+      CmdSetStencilOpEXT = (PFN_vkCmdSetStencilOpEXT) NextGetDeviceProcAddr(device, "vkCmdSetStencilOpEXT");
+      CmdSetStencilReference = (PFN_vkCmdSetStencilReference) NextGetDeviceProcAddr(device, "vkCmdSetStencilReference");
+      CmdSetStencilTestEnable = (PFN_vkCmdSetStencilTestEnable) NextGetDeviceProcAddr(device, "vkCmdSetStencilTestEnable");
+      CmdSetStencilTestEnableEXT = (PFN_vkCmdSetStencilTestEnableEXT) NextGetDeviceProcAddr(device, "vkCmdSetStencilTestEnableEXT");
+      CmdSetStencilWriteMask = (PFN_vkCmdSetStencilWriteMask) NextGetDeviceProcAddr(device, "vkCmdSetStencilWriteMask");
+      CmdSetTessellationDomainOriginEXT = (PFN_vkCmdSetTessellationDomainOriginEXT) NextGetDeviceProcAddr(device, "vkCmdSetTessellationDomainOriginEXT");
+      CmdSetVertexInputEXT = (PFN_vkCmdSetVertexInputEXT) NextGetDeviceProcAddr(device, "vkCmdSetVertexInputEXT");
+      CmdSetViewport = (PFN_vkCmdSetViewport) NextGetDeviceProcAddr(device, "vkCmdSetViewport");
+      CmdSetViewportShadingRatePaletteNV = (PFN_vkCmdSetViewportShadingRatePaletteNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportShadingRatePaletteNV");
+      CmdSetViewportSwizzleNV = (PFN_vkCmdSetViewportSwizzleNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportSwizzleNV");
+      CmdSetViewportWScalingEnableNV = (PFN_vkCmdSetViewportWScalingEnableNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportWScalingEnableNV");
+      CmdSetViewportWScalingNV = (PFN_vkCmdSetViewportWScalingNV) NextGetDeviceProcAddr(device, "vkCmdSetViewportWScalingNV");
+      CmdSetViewportWithCount = (PFN_vkCmdSetViewportWithCount) NextGetDeviceProcAddr(device, "vkCmdSetViewportWithCount");
+      CmdSetViewportWithCountEXT = (PFN_vkCmdSetViewportWithCountEXT) NextGetDeviceProcAddr(device, "vkCmdSetViewportWithCountEXT");
+      CmdSubpassShadingHUAWEI = (PFN_vkCmdSubpassShadingHUAWEI) NextGetDeviceProcAddr(device, "vkCmdSubpassShadingHUAWEI");
+      CmdTraceRaysIndirect2KHR = (PFN_vkCmdTraceRaysIndirect2KHR) NextGetDeviceProcAddr(device, "vkCmdTraceRaysIndirect2KHR");
+      CmdTraceRaysIndirectKHR = (PFN_vkCmdTraceRaysIndirectKHR) NextGetDeviceProcAddr(device, "vkCmdTraceRaysIndirectKHR");
+      CmdTraceRaysKHR = (PFN_vkCmdTraceRaysKHR) NextGetDeviceProcAddr(device, "vkCmdTraceRaysKHR");
+      CmdTraceRaysNV = (PFN_vkCmdTraceRaysNV) NextGetDeviceProcAddr(device, "vkCmdTraceRaysNV");
+      CmdUpdateBuffer = (PFN_vkCmdUpdateBuffer) NextGetDeviceProcAddr(device, "vkCmdUpdateBuffer");
+      CmdWaitEvents = (PFN_vkCmdWaitEvents) NextGetDeviceProcAddr(device, "vkCmdWaitEvents");
+      CmdWaitEvents2 = (PFN_vkCmdWaitEvents2) NextGetDeviceProcAddr(device, "vkCmdWaitEvents2");
+      CmdWaitEvents2KHR = (PFN_vkCmdWaitEvents2KHR) NextGetDeviceProcAddr(device, "vkCmdWaitEvents2KHR");
+      CmdWriteAccelerationStructuresPropertiesKHR = (PFN_vkCmdWriteAccelerationStructuresPropertiesKHR) NextGetDeviceProcAddr(device, "vkCmdWriteAccelerationStructuresPropertiesKHR");
+      CmdWriteAccelerationStructuresPropertiesNV = (PFN_vkCmdWriteAccelerationStructuresPropertiesNV) NextGetDeviceProcAddr(device, "vkCmdWriteAccelerationStructuresPropertiesNV");
+      CmdWriteBufferMarker2AMD = (PFN_vkCmdWriteBufferMarker2AMD) NextGetDeviceProcAddr(device, "vkCmdWriteBufferMarker2AMD");
+      CmdWriteBufferMarkerAMD = (PFN_vkCmdWriteBufferMarkerAMD) NextGetDeviceProcAddr(device, "vkCmdWriteBufferMarkerAMD");
+      CmdWriteMicromapsPropertiesEXT = (PFN_vkCmdWriteMicromapsPropertiesEXT) NextGetDeviceProcAddr(device, "vkCmdWriteMicromapsPropertiesEXT");
+      CmdWriteTimestamp = (PFN_vkCmdWriteTimestamp) NextGetDeviceProcAddr(device, "vkCmdWriteTimestamp");
+      CmdWriteTimestamp2 = (PFN_vkCmdWriteTimestamp2) NextGetDeviceProcAddr(device, "vkCmdWriteTimestamp2");
+      CmdWriteTimestamp2KHR = (PFN_vkCmdWriteTimestamp2KHR) NextGetDeviceProcAddr(device, "vkCmdWriteTimestamp2KHR");
+      CompileDeferredNV = (PFN_vkCompileDeferredNV) NextGetDeviceProcAddr(device, "vkCompileDeferredNV");
+      CopyAccelerationStructureKHR = (PFN_vkCopyAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCopyAccelerationStructureKHR");
+      CopyAccelerationStructureToMemoryKHR = (PFN_vkCopyAccelerationStructureToMemoryKHR) NextGetDeviceProcAddr(device, "vkCopyAccelerationStructureToMemoryKHR");
+      CopyMemoryToAccelerationStructureKHR = (PFN_vkCopyMemoryToAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCopyMemoryToAccelerationStructureKHR");
+      CopyMemoryToMicromapEXT = (PFN_vkCopyMemoryToMicromapEXT) NextGetDeviceProcAddr(device, "vkCopyMemoryToMicromapEXT");
+      CopyMicromapEXT = (PFN_vkCopyMicromapEXT) NextGetDeviceProcAddr(device, "vkCopyMicromapEXT");
+      CopyMicromapToMemoryEXT = (PFN_vkCopyMicromapToMemoryEXT) NextGetDeviceProcAddr(device, "vkCopyMicromapToMemoryEXT");
+      CreateAccelerationStructureKHR = (PFN_vkCreateAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkCreateAccelerationStructureKHR");
+      CreateAccelerationStructureNV = (PFN_vkCreateAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkCreateAccelerationStructureNV");
+      CreateBuffer = (PFN_vkCreateBuffer) NextGetDeviceProcAddr(device, "vkCreateBuffer");
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      CreateBufferCollectionFUCHSIA = (PFN_vkCreateBufferCollectionFUCHSIA) NextGetDeviceProcAddr(device, "vkCreateBufferCollectionFUCHSIA");
+#endif
+      CreateBufferView = (PFN_vkCreateBufferView) NextGetDeviceProcAddr(device, "vkCreateBufferView");
+      CreateCommandPool = (PFN_vkCreateCommandPool) NextGetDeviceProcAddr(device, "vkCreateCommandPool");
+      CreateComputePipelines = (PFN_vkCreateComputePipelines) NextGetDeviceProcAddr(device, "vkCreateComputePipelines");
+      CreateDeferredOperationKHR = (PFN_vkCreateDeferredOperationKHR) NextGetDeviceProcAddr(device, "vkCreateDeferredOperationKHR");
+      CreateDescriptorPool = (PFN_vkCreateDescriptorPool) NextGetDeviceProcAddr(device, "vkCreateDescriptorPool");
+      CreateDescriptorSetLayout = (PFN_vkCreateDescriptorSetLayout) NextGetDeviceProcAddr(device, "vkCreateDescriptorSetLayout");
+      CreateDescriptorUpdateTemplate = (PFN_vkCreateDescriptorUpdateTemplate) NextGetDeviceProcAddr(device, "vkCreateDescriptorUpdateTemplate");
+      CreateDescriptorUpdateTemplateKHR = (PFN_vkCreateDescriptorUpdateTemplateKHR) NextGetDeviceProcAddr(device, "vkCreateDescriptorUpdateTemplateKHR");
+      CreateEvent = (PFN_vkCreateEvent) NextGetDeviceProcAddr(device, "vkCreateEvent");
+      CreateFence = (PFN_vkCreateFence) NextGetDeviceProcAddr(device, "vkCreateFence");
+      CreateFramebuffer = (PFN_vkCreateFramebuffer) NextGetDeviceProcAddr(device, "vkCreateFramebuffer");
+      CreateGraphicsPipelines = (PFN_vkCreateGraphicsPipelines) NextGetDeviceProcAddr(device, "vkCreateGraphicsPipelines");
+      CreateImage = (PFN_vkCreateImage) NextGetDeviceProcAddr(device, "vkCreateImage");
+      CreateImageView = (PFN_vkCreateImageView) NextGetDeviceProcAddr(device, "vkCreateImageView");
+      CreateIndirectCommandsLayoutNV = (PFN_vkCreateIndirectCommandsLayoutNV) NextGetDeviceProcAddr(device, "vkCreateIndirectCommandsLayoutNV");
+      CreateMicromapEXT = (PFN_vkCreateMicromapEXT) NextGetDeviceProcAddr(device, "vkCreateMicromapEXT");
+      CreateOpticalFlowSessionNV = (PFN_vkCreateOpticalFlowSessionNV) NextGetDeviceProcAddr(device, "vkCreateOpticalFlowSessionNV");
+      CreatePipelineCache = (PFN_vkCreatePipelineCache) NextGetDeviceProcAddr(device, "vkCreatePipelineCache");
+      CreatePipelineLayout = (PFN_vkCreatePipelineLayout) NextGetDeviceProcAddr(device, "vkCreatePipelineLayout");
+      CreatePrivateDataSlot = (PFN_vkCreatePrivateDataSlot) NextGetDeviceProcAddr(device, "vkCreatePrivateDataSlot");
+      CreatePrivateDataSlotEXT = (PFN_vkCreatePrivateDataSlotEXT) NextGetDeviceProcAddr(device, "vkCreatePrivateDataSlotEXT");
+      CreateQueryPool = (PFN_vkCreateQueryPool) NextGetDeviceProcAddr(device, "vkCreateQueryPool");
+      CreateRayTracingPipelinesKHR = (PFN_vkCreateRayTracingPipelinesKHR) NextGetDeviceProcAddr(device, "vkCreateRayTracingPipelinesKHR");
+      CreateRayTracingPipelinesNV = (PFN_vkCreateRayTracingPipelinesNV) NextGetDeviceProcAddr(device, "vkCreateRayTracingPipelinesNV");
+      CreateRenderPass = (PFN_vkCreateRenderPass) NextGetDeviceProcAddr(device, "vkCreateRenderPass");
+      CreateRenderPass2 = (PFN_vkCreateRenderPass2) NextGetDeviceProcAddr(device, "vkCreateRenderPass2");
+      CreateRenderPass2KHR = (PFN_vkCreateRenderPass2KHR) NextGetDeviceProcAddr(device, "vkCreateRenderPass2KHR");
+      CreateSampler = (PFN_vkCreateSampler) NextGetDeviceProcAddr(device, "vkCreateSampler");
+      CreateSamplerYcbcrConversion = (PFN_vkCreateSamplerYcbcrConversion) NextGetDeviceProcAddr(device, "vkCreateSamplerYcbcrConversion");
+      CreateSamplerYcbcrConversionKHR = (PFN_vkCreateSamplerYcbcrConversionKHR) NextGetDeviceProcAddr(device, "vkCreateSamplerYcbcrConversionKHR");
+      CreateSemaphore = (PFN_vkCreateSemaphore) NextGetDeviceProcAddr(device, "vkCreateSemaphore");
+      CreateShaderModule = (PFN_vkCreateShaderModule) NextGetDeviceProcAddr(device, "vkCreateShaderModule");
+      CreateShadersEXT = (PFN_vkCreateShadersEXT) NextGetDeviceProcAddr(device, "vkCreateShadersEXT");
+      CreateSharedSwapchainsKHR = (PFN_vkCreateSharedSwapchainsKHR) NextGetDeviceProcAddr(device, "vkCreateSharedSwapchainsKHR");
+      CreateSwapchainKHR = (PFN_vkCreateSwapchainKHR) NextGetDeviceProcAddr(device, "vkCreateSwapchainKHR");
+      CreateValidationCacheEXT = (PFN_vkCreateValidationCacheEXT) NextGetDeviceProcAddr(device, "vkCreateValidationCacheEXT");
+      CreateVideoSessionKHR = (PFN_vkCreateVideoSessionKHR) NextGetDeviceProcAddr(device, "vkCreateVideoSessionKHR");
+      CreateVideoSessionParametersKHR = (PFN_vkCreateVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkCreateVideoSessionParametersKHR");
+      DebugMarkerSetObjectNameEXT = (PFN_vkDebugMarkerSetObjectNameEXT) NextGetDeviceProcAddr(device, "vkDebugMarkerSetObjectNameEXT");
+      DebugMarkerSetObjectTagEXT = (PFN_vkDebugMarkerSetObjectTagEXT) NextGetDeviceProcAddr(device, "vkDebugMarkerSetObjectTagEXT");
+      DeferredOperationJoinKHR = (PFN_vkDeferredOperationJoinKHR) NextGetDeviceProcAddr(device, "vkDeferredOperationJoinKHR");
+      DestroyAccelerationStructureKHR = (PFN_vkDestroyAccelerationStructureKHR) NextGetDeviceProcAddr(device, "vkDestroyAccelerationStructureKHR");
+      DestroyAccelerationStructureNV = (PFN_vkDestroyAccelerationStructureNV) NextGetDeviceProcAddr(device, "vkDestroyAccelerationStructureNV");
+      DestroyBuffer = (PFN_vkDestroyBuffer) NextGetDeviceProcAddr(device, "vkDestroyBuffer");
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      DestroyBufferCollectionFUCHSIA = (PFN_vkDestroyBufferCollectionFUCHSIA) NextGetDeviceProcAddr(device, "vkDestroyBufferCollectionFUCHSIA");
+#endif
+      DestroyBufferView = (PFN_vkDestroyBufferView) NextGetDeviceProcAddr(device, "vkDestroyBufferView");
+      DestroyCommandPool = (PFN_vkDestroyCommandPool) NextGetDeviceProcAddr(device, "vkDestroyCommandPool");
+      DestroyDeferredOperationKHR = (PFN_vkDestroyDeferredOperationKHR) NextGetDeviceProcAddr(device, "vkDestroyDeferredOperationKHR");
+      DestroyDescriptorPool = (PFN_vkDestroyDescriptorPool) NextGetDeviceProcAddr(device, "vkDestroyDescriptorPool");
+      DestroyDescriptorSetLayout = (PFN_vkDestroyDescriptorSetLayout) NextGetDeviceProcAddr(device, "vkDestroyDescriptorSetLayout");
+      DestroyDescriptorUpdateTemplate = (PFN_vkDestroyDescriptorUpdateTemplate) NextGetDeviceProcAddr(device, "vkDestroyDescriptorUpdateTemplate");
+      DestroyDescriptorUpdateTemplateKHR = (PFN_vkDestroyDescriptorUpdateTemplateKHR) NextGetDeviceProcAddr(device, "vkDestroyDescriptorUpdateTemplateKHR");
+      DestroyDeviceReal = (PFN_vkDestroyDevice) NextGetDeviceProcAddr(device, "vkDestroyDevice");
+      DestroyDevice = (PFN_vkDestroyDevice) DestroyDeviceWrapper;
+      DestroyEvent = (PFN_vkDestroyEvent) NextGetDeviceProcAddr(device, "vkDestroyEvent");
+      DestroyFence = (PFN_vkDestroyFence) NextGetDeviceProcAddr(device, "vkDestroyFence");
+      DestroyFramebuffer = (PFN_vkDestroyFramebuffer) NextGetDeviceProcAddr(device, "vkDestroyFramebuffer");
+      DestroyImage = (PFN_vkDestroyImage) NextGetDeviceProcAddr(device, "vkDestroyImage");
+      DestroyImageView = (PFN_vkDestroyImageView) NextGetDeviceProcAddr(device, "vkDestroyImageView");
+      DestroyIndirectCommandsLayoutNV = (PFN_vkDestroyIndirectCommandsLayoutNV) NextGetDeviceProcAddr(device, "vkDestroyIndirectCommandsLayoutNV");
+      DestroyMicromapEXT = (PFN_vkDestroyMicromapEXT) NextGetDeviceProcAddr(device, "vkDestroyMicromapEXT");
+      DestroyOpticalFlowSessionNV = (PFN_vkDestroyOpticalFlowSessionNV) NextGetDeviceProcAddr(device, "vkDestroyOpticalFlowSessionNV");
+      DestroyPipeline = (PFN_vkDestroyPipeline) NextGetDeviceProcAddr(device, "vkDestroyPipeline");
+      DestroyPipelineCache = (PFN_vkDestroyPipelineCache) NextGetDeviceProcAddr(device, "vkDestroyPipelineCache");
+      DestroyPipelineLayout = (PFN_vkDestroyPipelineLayout) NextGetDeviceProcAddr(device, "vkDestroyPipelineLayout");
+      DestroyPrivateDataSlot = (PFN_vkDestroyPrivateDataSlot) NextGetDeviceProcAddr(device, "vkDestroyPrivateDataSlot");
+      DestroyPrivateDataSlotEXT = (PFN_vkDestroyPrivateDataSlotEXT) NextGetDeviceProcAddr(device, "vkDestroyPrivateDataSlotEXT");
+      DestroyQueryPool = (PFN_vkDestroyQueryPool) NextGetDeviceProcAddr(device, "vkDestroyQueryPool");
+      DestroyRenderPass = (PFN_vkDestroyRenderPass) NextGetDeviceProcAddr(device, "vkDestroyRenderPass");
+      DestroySampler = (PFN_vkDestroySampler) NextGetDeviceProcAddr(device, "vkDestroySampler");
+      DestroySamplerYcbcrConversion = (PFN_vkDestroySamplerYcbcrConversion) NextGetDeviceProcAddr(device, "vkDestroySamplerYcbcrConversion");
+      DestroySamplerYcbcrConversionKHR = (PFN_vkDestroySamplerYcbcrConversionKHR) NextGetDeviceProcAddr(device, "vkDestroySamplerYcbcrConversionKHR");
+      DestroySemaphore = (PFN_vkDestroySemaphore) NextGetDeviceProcAddr(device, "vkDestroySemaphore");
+      DestroyShaderEXT = (PFN_vkDestroyShaderEXT) NextGetDeviceProcAddr(device, "vkDestroyShaderEXT");
+      DestroyShaderModule = (PFN_vkDestroyShaderModule) NextGetDeviceProcAddr(device, "vkDestroyShaderModule");
+      DestroySwapchainKHR = (PFN_vkDestroySwapchainKHR) NextGetDeviceProcAddr(device, "vkDestroySwapchainKHR");
+      DestroyValidationCacheEXT = (PFN_vkDestroyValidationCacheEXT) NextGetDeviceProcAddr(device, "vkDestroyValidationCacheEXT");
+      DestroyVideoSessionKHR = (PFN_vkDestroyVideoSessionKHR) NextGetDeviceProcAddr(device, "vkDestroyVideoSessionKHR");
+      DestroyVideoSessionParametersKHR = (PFN_vkDestroyVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkDestroyVideoSessionParametersKHR");
+      DeviceWaitIdle = (PFN_vkDeviceWaitIdle) NextGetDeviceProcAddr(device, "vkDeviceWaitIdle");
+      DisplayPowerControlEXT = (PFN_vkDisplayPowerControlEXT) NextGetDeviceProcAddr(device, "vkDisplayPowerControlEXT");
+      EndCommandBuffer = (PFN_vkEndCommandBuffer) NextGetDeviceProcAddr(device, "vkEndCommandBuffer");
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      ExportMetalObjectsEXT = (PFN_vkExportMetalObjectsEXT) NextGetDeviceProcAddr(device, "vkExportMetalObjectsEXT");
+#endif
+      FlushMappedMemoryRanges = (PFN_vkFlushMappedMemoryRanges) NextGetDeviceProcAddr(device, "vkFlushMappedMemoryRanges");
+      FreeCommandBuffers = (PFN_vkFreeCommandBuffers) NextGetDeviceProcAddr(device, "vkFreeCommandBuffers");
+      FreeDescriptorSets = (PFN_vkFreeDescriptorSets) NextGetDeviceProcAddr(device, "vkFreeDescriptorSets");
+      FreeMemory = (PFN_vkFreeMemory) NextGetDeviceProcAddr(device, "vkFreeMemory");
+      GetAccelerationStructureBuildSizesKHR = (PFN_vkGetAccelerationStructureBuildSizesKHR) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureBuildSizesKHR");
+      GetAccelerationStructureDeviceAddressKHR = (PFN_vkGetAccelerationStructureDeviceAddressKHR) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureDeviceAddressKHR");
+      GetAccelerationStructureHandleNV = (PFN_vkGetAccelerationStructureHandleNV) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureHandleNV");
+      GetAccelerationStructureMemoryRequirementsNV = (PFN_vkGetAccelerationStructureMemoryRequirementsNV) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureMemoryRequirementsNV");
+      GetAccelerationStructureOpaqueCaptureDescriptorDataEXT = (PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT");
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      GetAndroidHardwareBufferPropertiesANDROID = (PFN_vkGetAndroidHardwareBufferPropertiesANDROID) NextGetDeviceProcAddr(device, "vkGetAndroidHardwareBufferPropertiesANDROID");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetBufferCollectionPropertiesFUCHSIA = (PFN_vkGetBufferCollectionPropertiesFUCHSIA) NextGetDeviceProcAddr(device, "vkGetBufferCollectionPropertiesFUCHSIA");
+#endif
+      GetBufferDeviceAddress = (PFN_vkGetBufferDeviceAddress) NextGetDeviceProcAddr(device, "vkGetBufferDeviceAddress");
+      GetBufferDeviceAddressEXT = (PFN_vkGetBufferDeviceAddressEXT) NextGetDeviceProcAddr(device, "vkGetBufferDeviceAddressEXT");
+      GetBufferDeviceAddressKHR = (PFN_vkGetBufferDeviceAddressKHR) NextGetDeviceProcAddr(device, "vkGetBufferDeviceAddressKHR");
+      GetBufferMemoryRequirements = (PFN_vkGetBufferMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements");
+      GetBufferMemoryRequirements2 = (PFN_vkGetBufferMemoryRequirements2) NextGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements2");
+      GetBufferMemoryRequirements2KHR = (PFN_vkGetBufferMemoryRequirements2KHR) NextGetDeviceProcAddr(device, "vkGetBufferMemoryRequirements2KHR");
+      GetBufferOpaqueCaptureAddress = (PFN_vkGetBufferOpaqueCaptureAddress) NextGetDeviceProcAddr(device, "vkGetBufferOpaqueCaptureAddress");
+      GetBufferOpaqueCaptureAddressKHR = (PFN_vkGetBufferOpaqueCaptureAddressKHR) NextGetDeviceProcAddr(device, "vkGetBufferOpaqueCaptureAddressKHR");
+      GetBufferOpaqueCaptureDescriptorDataEXT = (PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetBufferOpaqueCaptureDescriptorDataEXT");
+      GetCalibratedTimestampsEXT = (PFN_vkGetCalibratedTimestampsEXT) NextGetDeviceProcAddr(device, "vkGetCalibratedTimestampsEXT");
+      GetDeferredOperationMaxConcurrencyKHR = (PFN_vkGetDeferredOperationMaxConcurrencyKHR) NextGetDeviceProcAddr(device, "vkGetDeferredOperationMaxConcurrencyKHR");
+      GetDeferredOperationResultKHR = (PFN_vkGetDeferredOperationResultKHR) NextGetDeviceProcAddr(device, "vkGetDeferredOperationResultKHR");
+      GetDescriptorEXT = (PFN_vkGetDescriptorEXT) NextGetDeviceProcAddr(device, "vkGetDescriptorEXT");
+      GetDescriptorSetHostMappingVALVE = (PFN_vkGetDescriptorSetHostMappingVALVE) NextGetDeviceProcAddr(device, "vkGetDescriptorSetHostMappingVALVE");
+      GetDescriptorSetLayoutBindingOffsetEXT = (PFN_vkGetDescriptorSetLayoutBindingOffsetEXT) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutBindingOffsetEXT");
+      GetDescriptorSetLayoutHostMappingInfoVALVE = (PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
+      GetDescriptorSetLayoutSizeEXT = (PFN_vkGetDescriptorSetLayoutSizeEXT) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSizeEXT");
+      GetDescriptorSetLayoutSupport = (PFN_vkGetDescriptorSetLayoutSupport) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSupport");
+      GetDescriptorSetLayoutSupportKHR = (PFN_vkGetDescriptorSetLayoutSupportKHR) NextGetDeviceProcAddr(device, "vkGetDescriptorSetLayoutSupportKHR");
+      GetDeviceAccelerationStructureCompatibilityKHR = (PFN_vkGetDeviceAccelerationStructureCompatibilityKHR) NextGetDeviceProcAddr(device, "vkGetDeviceAccelerationStructureCompatibilityKHR");
+      GetDeviceBufferMemoryRequirements = (PFN_vkGetDeviceBufferMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetDeviceBufferMemoryRequirements");
+      GetDeviceBufferMemoryRequirementsKHR = (PFN_vkGetDeviceBufferMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetDeviceBufferMemoryRequirementsKHR");
+      GetDeviceFaultInfoEXT = (PFN_vkGetDeviceFaultInfoEXT) NextGetDeviceProcAddr(device, "vkGetDeviceFaultInfoEXT");
+      GetDeviceGroupPeerMemoryFeatures = (PFN_vkGetDeviceGroupPeerMemoryFeatures) NextGetDeviceProcAddr(device, "vkGetDeviceGroupPeerMemoryFeatures");
+      GetDeviceGroupPeerMemoryFeaturesKHR = (PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR) NextGetDeviceProcAddr(device, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+      GetDeviceGroupPresentCapabilitiesKHR = (PFN_vkGetDeviceGroupPresentCapabilitiesKHR) NextGetDeviceProcAddr(device, "vkGetDeviceGroupPresentCapabilitiesKHR");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetDeviceGroupSurfacePresentModes2EXT = (PFN_vkGetDeviceGroupSurfacePresentModes2EXT) NextGetDeviceProcAddr(device, "vkGetDeviceGroupSurfacePresentModes2EXT");
+#endif
+      GetDeviceGroupSurfacePresentModesKHR = (PFN_vkGetDeviceGroupSurfacePresentModesKHR) NextGetDeviceProcAddr(device, "vkGetDeviceGroupSurfacePresentModesKHR");
+      GetDeviceImageMemoryRequirements = (PFN_vkGetDeviceImageMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetDeviceImageMemoryRequirements");
+      GetDeviceImageMemoryRequirementsKHR = (PFN_vkGetDeviceImageMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetDeviceImageMemoryRequirementsKHR");
+      GetDeviceImageSparseMemoryRequirements = (PFN_vkGetDeviceImageSparseMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetDeviceImageSparseMemoryRequirements");
+      GetDeviceImageSparseMemoryRequirementsKHR = (PFN_vkGetDeviceImageSparseMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetDeviceImageSparseMemoryRequirementsKHR");
+      GetDeviceMemoryCommitment = (PFN_vkGetDeviceMemoryCommitment) NextGetDeviceProcAddr(device, "vkGetDeviceMemoryCommitment");
+      GetDeviceMemoryOpaqueCaptureAddress = (PFN_vkGetDeviceMemoryOpaqueCaptureAddress) NextGetDeviceProcAddr(device, "vkGetDeviceMemoryOpaqueCaptureAddress");
+      GetDeviceMemoryOpaqueCaptureAddressKHR = (PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR) NextGetDeviceProcAddr(device, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+      GetDeviceMicromapCompatibilityEXT = (PFN_vkGetDeviceMicromapCompatibilityEXT) NextGetDeviceProcAddr(device, "vkGetDeviceMicromapCompatibilityEXT");
+      GetDeviceProcAddr = NextGetDeviceProcAddr;
+      GetDeviceQueue = (PFN_vkGetDeviceQueue) NextGetDeviceProcAddr(device, "vkGetDeviceQueue");
+      GetDeviceQueue2 = (PFN_vkGetDeviceQueue2) NextGetDeviceProcAddr(device, "vkGetDeviceQueue2");
+      GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = (PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI) NextGetDeviceProcAddr(device, "vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI");
+      GetDynamicRenderingTilePropertiesQCOM = (PFN_vkGetDynamicRenderingTilePropertiesQCOM) NextGetDeviceProcAddr(device, "vkGetDynamicRenderingTilePropertiesQCOM");
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      GetEncodedVideoSessionParametersKHR = (PFN_vkGetEncodedVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkGetEncodedVideoSessionParametersKHR");
+#endif
+      GetEventStatus = (PFN_vkGetEventStatus) NextGetDeviceProcAddr(device, "vkGetEventStatus");
+      GetFenceFdKHR = (PFN_vkGetFenceFdKHR) NextGetDeviceProcAddr(device, "vkGetFenceFdKHR");
+      GetFenceStatus = (PFN_vkGetFenceStatus) NextGetDeviceProcAddr(device, "vkGetFenceStatus");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetFenceWin32HandleKHR = (PFN_vkGetFenceWin32HandleKHR) NextGetDeviceProcAddr(device, "vkGetFenceWin32HandleKHR");
+#endif
+      GetFramebufferTilePropertiesQCOM = (PFN_vkGetFramebufferTilePropertiesQCOM) NextGetDeviceProcAddr(device, "vkGetFramebufferTilePropertiesQCOM");
+      GetGeneratedCommandsMemoryRequirementsNV = (PFN_vkGetGeneratedCommandsMemoryRequirementsNV) NextGetDeviceProcAddr(device, "vkGetGeneratedCommandsMemoryRequirementsNV");
+      GetImageDrmFormatModifierPropertiesEXT = (PFN_vkGetImageDrmFormatModifierPropertiesEXT) NextGetDeviceProcAddr(device, "vkGetImageDrmFormatModifierPropertiesEXT");
+      GetImageMemoryRequirements = (PFN_vkGetImageMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetImageMemoryRequirements");
+      GetImageMemoryRequirements2 = (PFN_vkGetImageMemoryRequirements2) NextGetDeviceProcAddr(device, "vkGetImageMemoryRequirements2");
+      GetImageMemoryRequirements2KHR = (PFN_vkGetImageMemoryRequirements2KHR) NextGetDeviceProcAddr(device, "vkGetImageMemoryRequirements2KHR");
+      GetImageOpaqueCaptureDescriptorDataEXT = (PFN_vkGetImageOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetImageOpaqueCaptureDescriptorDataEXT");
+      GetImageSparseMemoryRequirements = (PFN_vkGetImageSparseMemoryRequirements) NextGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements");
+      GetImageSparseMemoryRequirements2 = (PFN_vkGetImageSparseMemoryRequirements2) NextGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements2");
+      GetImageSparseMemoryRequirements2KHR = (PFN_vkGetImageSparseMemoryRequirements2KHR) NextGetDeviceProcAddr(device, "vkGetImageSparseMemoryRequirements2KHR");
+      GetImageSubresourceLayout = (PFN_vkGetImageSubresourceLayout) NextGetDeviceProcAddr(device, "vkGetImageSubresourceLayout");
+      GetImageSubresourceLayout2EXT = (PFN_vkGetImageSubresourceLayout2EXT) NextGetDeviceProcAddr(device, "vkGetImageSubresourceLayout2EXT");
+      GetImageViewOpaqueCaptureDescriptorDataEXT = (PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetImageViewOpaqueCaptureDescriptorDataEXT");
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      GetMemoryAndroidHardwareBufferANDROID = (PFN_vkGetMemoryAndroidHardwareBufferANDROID) NextGetDeviceProcAddr(device, "vkGetMemoryAndroidHardwareBufferANDROID");
+#endif
+      GetMemoryFdKHR = (PFN_vkGetMemoryFdKHR) NextGetDeviceProcAddr(device, "vkGetMemoryFdKHR");
+      GetMemoryFdPropertiesKHR = (PFN_vkGetMemoryFdPropertiesKHR) NextGetDeviceProcAddr(device, "vkGetMemoryFdPropertiesKHR");
+      GetMemoryHostPointerPropertiesEXT = (PFN_vkGetMemoryHostPointerPropertiesEXT) NextGetDeviceProcAddr(device, "vkGetMemoryHostPointerPropertiesEXT");
+      GetMemoryRemoteAddressNV = (PFN_vkGetMemoryRemoteAddressNV) NextGetDeviceProcAddr(device, "vkGetMemoryRemoteAddressNV");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetMemoryWin32HandleKHR = (PFN_vkGetMemoryWin32HandleKHR) NextGetDeviceProcAddr(device, "vkGetMemoryWin32HandleKHR");
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetMemoryWin32HandleNV = (PFN_vkGetMemoryWin32HandleNV) NextGetDeviceProcAddr(device, "vkGetMemoryWin32HandleNV");
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetMemoryWin32HandlePropertiesKHR = (PFN_vkGetMemoryWin32HandlePropertiesKHR) NextGetDeviceProcAddr(device, "vkGetMemoryWin32HandlePropertiesKHR");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetMemoryZirconHandleFUCHSIA = (PFN_vkGetMemoryZirconHandleFUCHSIA) NextGetDeviceProcAddr(device, "vkGetMemoryZirconHandleFUCHSIA");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetMemoryZirconHandlePropertiesFUCHSIA = (PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA) NextGetDeviceProcAddr(device, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
+#endif
+      GetMicromapBuildSizesEXT = (PFN_vkGetMicromapBuildSizesEXT) NextGetDeviceProcAddr(device, "vkGetMicromapBuildSizesEXT");
+      GetPastPresentationTimingGOOGLE = (PFN_vkGetPastPresentationTimingGOOGLE) NextGetDeviceProcAddr(device, "vkGetPastPresentationTimingGOOGLE");
+      GetPerformanceParameterINTEL = (PFN_vkGetPerformanceParameterINTEL) NextGetDeviceProcAddr(device, "vkGetPerformanceParameterINTEL");
+      GetPipelineCacheData = (PFN_vkGetPipelineCacheData) NextGetDeviceProcAddr(device, "vkGetPipelineCacheData");
+      GetPipelineExecutableInternalRepresentationsKHR = (PFN_vkGetPipelineExecutableInternalRepresentationsKHR) NextGetDeviceProcAddr(device, "vkGetPipelineExecutableInternalRepresentationsKHR");
+      GetPipelineExecutablePropertiesKHR = (PFN_vkGetPipelineExecutablePropertiesKHR) NextGetDeviceProcAddr(device, "vkGetPipelineExecutablePropertiesKHR");
+      GetPipelineExecutableStatisticsKHR = (PFN_vkGetPipelineExecutableStatisticsKHR) NextGetDeviceProcAddr(device, "vkGetPipelineExecutableStatisticsKHR");
+      GetPipelinePropertiesEXT = (PFN_vkGetPipelinePropertiesEXT) NextGetDeviceProcAddr(device, "vkGetPipelinePropertiesEXT");
+      GetPrivateData = (PFN_vkGetPrivateData) NextGetDeviceProcAddr(device, "vkGetPrivateData");
+      GetPrivateDataEXT = (PFN_vkGetPrivateDataEXT) NextGetDeviceProcAddr(device, "vkGetPrivateDataEXT");
+      GetQueryPoolResults = (PFN_vkGetQueryPoolResults) NextGetDeviceProcAddr(device, "vkGetQueryPoolResults");
+      GetQueueCheckpointData2NV = (PFN_vkGetQueueCheckpointData2NV) NextGetDeviceProcAddr(device, "vkGetQueueCheckpointData2NV");
+      GetQueueCheckpointDataNV = (PFN_vkGetQueueCheckpointDataNV) NextGetDeviceProcAddr(device, "vkGetQueueCheckpointDataNV");
+      GetRayTracingCaptureReplayShaderGroupHandlesKHR = (PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR) NextGetDeviceProcAddr(device, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+      GetRayTracingShaderGroupHandlesKHR = (PFN_vkGetRayTracingShaderGroupHandlesKHR) NextGetDeviceProcAddr(device, "vkGetRayTracingShaderGroupHandlesKHR");
+      GetRayTracingShaderGroupHandlesNV = (PFN_vkGetRayTracingShaderGroupHandlesNV) NextGetDeviceProcAddr(device, "vkGetRayTracingShaderGroupHandlesNV");
+      GetRayTracingShaderGroupStackSizeKHR = (PFN_vkGetRayTracingShaderGroupStackSizeKHR) NextGetDeviceProcAddr(device, "vkGetRayTracingShaderGroupStackSizeKHR");
+      GetRefreshCycleDurationGOOGLE = (PFN_vkGetRefreshCycleDurationGOOGLE) NextGetDeviceProcAddr(device, "vkGetRefreshCycleDurationGOOGLE");
+      GetRenderAreaGranularity = (PFN_vkGetRenderAreaGranularity) NextGetDeviceProcAddr(device, "vkGetRenderAreaGranularity");
+      GetSamplerOpaqueCaptureDescriptorDataEXT = (PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT) NextGetDeviceProcAddr(device, "vkGetSamplerOpaqueCaptureDescriptorDataEXT");
+      GetSemaphoreCounterValue = (PFN_vkGetSemaphoreCounterValue) NextGetDeviceProcAddr(device, "vkGetSemaphoreCounterValue");
+      GetSemaphoreCounterValueKHR = (PFN_vkGetSemaphoreCounterValueKHR) NextGetDeviceProcAddr(device, "vkGetSemaphoreCounterValueKHR");
+      GetSemaphoreFdKHR = (PFN_vkGetSemaphoreFdKHR) NextGetDeviceProcAddr(device, "vkGetSemaphoreFdKHR");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      GetSemaphoreWin32HandleKHR = (PFN_vkGetSemaphoreWin32HandleKHR) NextGetDeviceProcAddr(device, "vkGetSemaphoreWin32HandleKHR");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      GetSemaphoreZirconHandleFUCHSIA = (PFN_vkGetSemaphoreZirconHandleFUCHSIA) NextGetDeviceProcAddr(device, "vkGetSemaphoreZirconHandleFUCHSIA");
+#endif
+      GetShaderBinaryDataEXT = (PFN_vkGetShaderBinaryDataEXT) NextGetDeviceProcAddr(device, "vkGetShaderBinaryDataEXT");
+      GetShaderInfoAMD = (PFN_vkGetShaderInfoAMD) NextGetDeviceProcAddr(device, "vkGetShaderInfoAMD");
+      GetShaderModuleCreateInfoIdentifierEXT = (PFN_vkGetShaderModuleCreateInfoIdentifierEXT) NextGetDeviceProcAddr(device, "vkGetShaderModuleCreateInfoIdentifierEXT");
+      GetShaderModuleIdentifierEXT = (PFN_vkGetShaderModuleIdentifierEXT) NextGetDeviceProcAddr(device, "vkGetShaderModuleIdentifierEXT");
+      GetSwapchainCounterEXT = (PFN_vkGetSwapchainCounterEXT) NextGetDeviceProcAddr(device, "vkGetSwapchainCounterEXT");
+      GetSwapchainImagesKHR = (PFN_vkGetSwapchainImagesKHR) NextGetDeviceProcAddr(device, "vkGetSwapchainImagesKHR");
+      GetSwapchainStatusKHR = (PFN_vkGetSwapchainStatusKHR) NextGetDeviceProcAddr(device, "vkGetSwapchainStatusKHR");
+      GetValidationCacheDataEXT = (PFN_vkGetValidationCacheDataEXT) NextGetDeviceProcAddr(device, "vkGetValidationCacheDataEXT");
+      GetVideoSessionMemoryRequirementsKHR = (PFN_vkGetVideoSessionMemoryRequirementsKHR) NextGetDeviceProcAddr(device, "vkGetVideoSessionMemoryRequirementsKHR");
+      ImportFenceFdKHR = (PFN_vkImportFenceFdKHR) NextGetDeviceProcAddr(device, "vkImportFenceFdKHR");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      ImportFenceWin32HandleKHR = (PFN_vkImportFenceWin32HandleKHR) NextGetDeviceProcAddr(device, "vkImportFenceWin32HandleKHR");
+#endif
+      ImportSemaphoreFdKHR = (PFN_vkImportSemaphoreFdKHR) NextGetDeviceProcAddr(device, "vkImportSemaphoreFdKHR");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      ImportSemaphoreWin32HandleKHR = (PFN_vkImportSemaphoreWin32HandleKHR) NextGetDeviceProcAddr(device, "vkImportSemaphoreWin32HandleKHR");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      ImportSemaphoreZirconHandleFUCHSIA = (PFN_vkImportSemaphoreZirconHandleFUCHSIA) NextGetDeviceProcAddr(device, "vkImportSemaphoreZirconHandleFUCHSIA");
+#endif
+      InitializePerformanceApiINTEL = (PFN_vkInitializePerformanceApiINTEL) NextGetDeviceProcAddr(device, "vkInitializePerformanceApiINTEL");
+      InvalidateMappedMemoryRanges = (PFN_vkInvalidateMappedMemoryRanges) NextGetDeviceProcAddr(device, "vkInvalidateMappedMemoryRanges");
+      MapMemory = (PFN_vkMapMemory) NextGetDeviceProcAddr(device, "vkMapMemory");
+      MapMemory2KHR = (PFN_vkMapMemory2KHR) NextGetDeviceProcAddr(device, "vkMapMemory2KHR");
+      MergePipelineCaches = (PFN_vkMergePipelineCaches) NextGetDeviceProcAddr(device, "vkMergePipelineCaches");
+      MergeValidationCachesEXT = (PFN_vkMergeValidationCachesEXT) NextGetDeviceProcAddr(device, "vkMergeValidationCachesEXT");
+      QueueBeginDebugUtilsLabelEXT = (PFN_vkQueueBeginDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkQueueBeginDebugUtilsLabelEXT");
+      QueueBindSparse = (PFN_vkQueueBindSparse) NextGetDeviceProcAddr(device, "vkQueueBindSparse");
+      QueueEndDebugUtilsLabelEXT = (PFN_vkQueueEndDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkQueueEndDebugUtilsLabelEXT");
+      QueueInsertDebugUtilsLabelEXT = (PFN_vkQueueInsertDebugUtilsLabelEXT) NextGetDeviceProcAddr(device, "vkQueueInsertDebugUtilsLabelEXT");
+      QueuePresentKHR = (PFN_vkQueuePresentKHR) NextGetDeviceProcAddr(device, "vkQueuePresentKHR");
+      QueueSetPerformanceConfigurationINTEL = (PFN_vkQueueSetPerformanceConfigurationINTEL) NextGetDeviceProcAddr(device, "vkQueueSetPerformanceConfigurationINTEL");
+      QueueSubmit = (PFN_vkQueueSubmit) NextGetDeviceProcAddr(device, "vkQueueSubmit");
+      QueueSubmit2 = (PFN_vkQueueSubmit2) NextGetDeviceProcAddr(device, "vkQueueSubmit2");
+      QueueSubmit2KHR = (PFN_vkQueueSubmit2KHR) NextGetDeviceProcAddr(device, "vkQueueSubmit2KHR");
+      QueueWaitIdle = (PFN_vkQueueWaitIdle) NextGetDeviceProcAddr(device, "vkQueueWaitIdle");
+      RegisterDeviceEventEXT = (PFN_vkRegisterDeviceEventEXT) NextGetDeviceProcAddr(device, "vkRegisterDeviceEventEXT");
+      RegisterDisplayEventEXT = (PFN_vkRegisterDisplayEventEXT) NextGetDeviceProcAddr(device, "vkRegisterDisplayEventEXT");
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      ReleaseFullScreenExclusiveModeEXT = (PFN_vkReleaseFullScreenExclusiveModeEXT) NextGetDeviceProcAddr(device, "vkReleaseFullScreenExclusiveModeEXT");
+#endif
+      ReleasePerformanceConfigurationINTEL = (PFN_vkReleasePerformanceConfigurationINTEL) NextGetDeviceProcAddr(device, "vkReleasePerformanceConfigurationINTEL");
+      ReleaseProfilingLockKHR = (PFN_vkReleaseProfilingLockKHR) NextGetDeviceProcAddr(device, "vkReleaseProfilingLockKHR");
+      ReleaseSwapchainImagesEXT = (PFN_vkReleaseSwapchainImagesEXT) NextGetDeviceProcAddr(device, "vkReleaseSwapchainImagesEXT");
+      ResetCommandBuffer = (PFN_vkResetCommandBuffer) NextGetDeviceProcAddr(device, "vkResetCommandBuffer");
+      ResetCommandPool = (PFN_vkResetCommandPool) NextGetDeviceProcAddr(device, "vkResetCommandPool");
+      ResetDescriptorPool = (PFN_vkResetDescriptorPool) NextGetDeviceProcAddr(device, "vkResetDescriptorPool");
+      ResetEvent = (PFN_vkResetEvent) NextGetDeviceProcAddr(device, "vkResetEvent");
+      ResetFences = (PFN_vkResetFences) NextGetDeviceProcAddr(device, "vkResetFences");
+      ResetQueryPool = (PFN_vkResetQueryPool) NextGetDeviceProcAddr(device, "vkResetQueryPool");
+      ResetQueryPoolEXT = (PFN_vkResetQueryPoolEXT) NextGetDeviceProcAddr(device, "vkResetQueryPoolEXT");
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      SetBufferCollectionBufferConstraintsFUCHSIA = (PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA) NextGetDeviceProcAddr(device, "vkSetBufferCollectionBufferConstraintsFUCHSIA");
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      SetBufferCollectionImageConstraintsFUCHSIA = (PFN_vkSetBufferCollectionImageConstraintsFUCHSIA) NextGetDeviceProcAddr(device, "vkSetBufferCollectionImageConstraintsFUCHSIA");
+#endif
+      SetDebugUtilsObjectNameEXT = (PFN_vkSetDebugUtilsObjectNameEXT) NextGetDeviceProcAddr(device, "vkSetDebugUtilsObjectNameEXT");
+      SetDebugUtilsObjectTagEXT = (PFN_vkSetDebugUtilsObjectTagEXT) NextGetDeviceProcAddr(device, "vkSetDebugUtilsObjectTagEXT");
+      SetDeviceMemoryPriorityEXT = (PFN_vkSetDeviceMemoryPriorityEXT) NextGetDeviceProcAddr(device, "vkSetDeviceMemoryPriorityEXT");
+      SetEvent = (PFN_vkSetEvent) NextGetDeviceProcAddr(device, "vkSetEvent");
+      SetHdrMetadataEXT = (PFN_vkSetHdrMetadataEXT) NextGetDeviceProcAddr(device, "vkSetHdrMetadataEXT");
+      SetLocalDimmingAMD = (PFN_vkSetLocalDimmingAMD) NextGetDeviceProcAddr(device, "vkSetLocalDimmingAMD");
+      SetPrivateData = (PFN_vkSetPrivateData) NextGetDeviceProcAddr(device, "vkSetPrivateData");
+      SetPrivateDataEXT = (PFN_vkSetPrivateDataEXT) NextGetDeviceProcAddr(device, "vkSetPrivateDataEXT");
+      SignalSemaphore = (PFN_vkSignalSemaphore) NextGetDeviceProcAddr(device, "vkSignalSemaphore");
+      SignalSemaphoreKHR = (PFN_vkSignalSemaphoreKHR) NextGetDeviceProcAddr(device, "vkSignalSemaphoreKHR");
+      TrimCommandPool = (PFN_vkTrimCommandPool) NextGetDeviceProcAddr(device, "vkTrimCommandPool");
+      TrimCommandPoolKHR = (PFN_vkTrimCommandPoolKHR) NextGetDeviceProcAddr(device, "vkTrimCommandPoolKHR");
+      UninitializePerformanceApiINTEL = (PFN_vkUninitializePerformanceApiINTEL) NextGetDeviceProcAddr(device, "vkUninitializePerformanceApiINTEL");
+      UnmapMemory = (PFN_vkUnmapMemory) NextGetDeviceProcAddr(device, "vkUnmapMemory");
+      UnmapMemory2KHR = (PFN_vkUnmapMemory2KHR) NextGetDeviceProcAddr(device, "vkUnmapMemory2KHR");
+      UpdateDescriptorSetWithTemplate = (PFN_vkUpdateDescriptorSetWithTemplate) NextGetDeviceProcAddr(device, "vkUpdateDescriptorSetWithTemplate");
+      UpdateDescriptorSetWithTemplateKHR = (PFN_vkUpdateDescriptorSetWithTemplateKHR) NextGetDeviceProcAddr(device, "vkUpdateDescriptorSetWithTemplateKHR");
+      UpdateDescriptorSets = (PFN_vkUpdateDescriptorSets) NextGetDeviceProcAddr(device, "vkUpdateDescriptorSets");
+      UpdateVideoSessionParametersKHR = (PFN_vkUpdateVideoSessionParametersKHR) NextGetDeviceProcAddr(device, "vkUpdateVideoSessionParametersKHR");
+      WaitForFences = (PFN_vkWaitForFences) NextGetDeviceProcAddr(device, "vkWaitForFences");
+      WaitForPresentKHR = (PFN_vkWaitForPresentKHR) NextGetDeviceProcAddr(device, "vkWaitForPresentKHR");
+      WaitSemaphores = (PFN_vkWaitSemaphores) NextGetDeviceProcAddr(device, "vkWaitSemaphores");
+      WaitSemaphoresKHR = (PFN_vkWaitSemaphoresKHR) NextGetDeviceProcAddr(device, "vkWaitSemaphoresKHR");
+      WriteAccelerationStructuresPropertiesKHR = (PFN_vkWriteAccelerationStructuresPropertiesKHR) NextGetDeviceProcAddr(device, "vkWriteAccelerationStructuresPropertiesKHR");
+      WriteMicromapsPropertiesEXT = (PFN_vkWriteMicromapsPropertiesEXT) NextGetDeviceProcAddr(device, "vkWriteMicromapsPropertiesEXT");
+#endif
+    }
+
+#if VKROOTS_USE_LAZY_DISPATCH
+    PFN_vkDestroyDevice DestroyDevice;
+    PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+#else
+    PFN_vkAcquireNextImage2KHR AcquireNextImage2KHR;
+    PFN_vkAcquireNextImageKHR AcquireNextImageKHR;
+    PFN_vkAllocateDescriptorSets AllocateDescriptorSets;
+    PFN_vkBeginCommandBuffer BeginCommandBuffer;
+    PFN_vkCmdBeginQuery CmdBeginQuery;
+    PFN_vkCmdBeginRenderPass CmdBeginRenderPass;
+    PFN_vkCmdBeginRenderPass2 CmdBeginRenderPass2;
+    PFN_vkCmdBeginRendering CmdBeginRendering;
+    PFN_vkCmdBeginRenderingKHR CmdBeginRenderingKHR;
+    PFN_vkCmdBindDescriptorSets CmdBindDescriptorSets;
+    PFN_vkCmdBindIndexBuffer CmdBindIndexBuffer;
+    PFN_vkCmdBindPipeline CmdBindPipeline;
+    PFN_vkCmdBindVertexBuffers CmdBindVertexBuffers;
+    PFN_vkCmdBlitImage CmdBlitImage;
+    PFN_vkCmdClearAttachments CmdClearAttachments;
+    PFN_vkCmdClearColorImage CmdClearColorImage;
+    PFN_vkCmdCopyBuffer CmdCopyBuffer;
+    PFN_vkCmdCopyBufferToImage CmdCopyBufferToImage;
+    PFN_vkCmdCopyImage CmdCopyImage;
+    PFN_vkCmdDispatch CmdDispatch;
+    PFN_vkCmdDispatchIndirect CmdDispatchIndirect;
+    PFN_vkCmdDraw CmdDraw;
+    PFN_vkCmdDrawIndexed CmdDrawIndexed;
+    PFN_vkCmdDrawIndexedIndirect CmdDrawIndexedIndirect;
+    PFN_vkCmdDrawIndexedIndirectCount CmdDrawIndexedIndirectCount;
+    PFN_vkCmdDrawIndirect CmdDrawIndirect;
+    PFN_vkCmdDrawIndirectCount CmdDrawIndirectCount;
+    PFN_vkCmdEndQuery CmdEndQuery;
+    PFN_vkCmdEndRenderPass CmdEndRenderPass;
+    PFN_vkCmdEndRenderPass2 CmdEndRenderPass2;
+    PFN_vkCmdEndRendering CmdEndRendering;
+    PFN_vkCmdEndRenderingKHR CmdEndRenderingKHR;
+    PFN_vkCmdExecuteCommands CmdExecuteCommands;
+    PFN_vkCmdNextSubpass CmdNextSubpass;
+    PFN_vkCmdPipelineBarrier CmdPipelineBarrier;
+    PFN_vkCmdPipelineBarrier2 CmdPipelineBarrier2;
+    PFN_vkCmdPipelineBarrier2KHR CmdPipelineBarrier2KHR;
+    PFN_vkCmdPushConstants CmdPushConstants;
+    PFN_vkCmdPushDescriptorSetKHR CmdPushDescriptorSetKHR;
+    PFN_vkCmdResetQueryPool CmdResetQueryPool;
+    PFN_vkCmdSetEvent CmdSetEvent;
+    PFN_vkCmdSetScissor CmdSetScissor;
+    PFN_vkCmdSetViewport CmdSetViewport;
+    PFN_vkCmdWaitEvents CmdWaitEvents;
+    PFN_vkCmdWriteTimestamp CmdWriteTimestamp;
+    PFN_vkEndCommandBuffer EndCommandBuffer;
+    PFN_vkGetFenceStatus GetFenceStatus;
+    PFN_vkGetSemaphoreCounterValue GetSemaphoreCounterValue;
+    PFN_vkGetSemaphoreCounterValueKHR GetSemaphoreCounterValueKHR;
+    PFN_vkQueuePresentKHR QueuePresentKHR;
+    PFN_vkQueueSubmit QueueSubmit;
+    PFN_vkQueueSubmit2 QueueSubmit2;
+    PFN_vkQueueSubmit2KHR QueueSubmit2KHR;
+    PFN_vkResetCommandBuffer ResetCommandBuffer;
+    PFN_vkResetCommandPool ResetCommandPool;
+    PFN_vkResetDescriptorPool ResetDescriptorPool;
+    PFN_vkResetFences ResetFences;
+    PFN_vkSignalSemaphore SignalSemaphore;
+    PFN_vkUpdateDescriptorSets UpdateDescriptorSets;
+    PFN_vkWaitForFences WaitForFences;
+    PFN_vkWaitSemaphores WaitSemaphores;
+    PFN_vkWaitSemaphoresKHR WaitSemaphoresKHR;
+    PFN_vkCmdBeginConditionalRenderingEXT CmdBeginConditionalRenderingEXT;
+    PFN_vkCmdBeginDebugUtilsLabelEXT CmdBeginDebugUtilsLabelEXT;
+    PFN_vkCmdBeginQueryIndexedEXT CmdBeginQueryIndexedEXT;
+    PFN_vkCmdBeginRenderPass2KHR CmdBeginRenderPass2KHR;
+    PFN_vkCmdBeginTransformFeedbackEXT CmdBeginTransformFeedbackEXT;
+    PFN_vkCmdBeginVideoCodingKHR CmdBeginVideoCodingKHR;
+    PFN_vkCmdBindDescriptorBufferEmbeddedSamplersEXT CmdBindDescriptorBufferEmbeddedSamplersEXT;
+    PFN_vkCmdBindDescriptorBuffersEXT CmdBindDescriptorBuffersEXT;
+    PFN_vkCmdBindShadersEXT CmdBindShadersEXT;
+    PFN_vkCmdBindTransformFeedbackBuffersEXT CmdBindTransformFeedbackBuffersEXT;
+    PFN_vkCmdBindVertexBuffers2 CmdBindVertexBuffers2;
+    PFN_vkCmdBindVertexBuffers2EXT CmdBindVertexBuffers2EXT;
+    PFN_vkCmdBlitImage2 CmdBlitImage2;
+    PFN_vkCmdBlitImage2KHR CmdBlitImage2KHR;
+    PFN_vkCmdBuildAccelerationStructuresIndirectKHR CmdBuildAccelerationStructuresIndirectKHR;
+    PFN_vkCmdBuildAccelerationStructuresKHR CmdBuildAccelerationStructuresKHR;
+    PFN_vkCmdBuildMicromapsEXT CmdBuildMicromapsEXT;
+    PFN_vkCmdClearDepthStencilImage CmdClearDepthStencilImage;
+    PFN_vkCmdControlVideoCodingKHR CmdControlVideoCodingKHR;
+    PFN_vkCmdCopyAccelerationStructureKHR CmdCopyAccelerationStructureKHR;
+    PFN_vkCmdCopyAccelerationStructureToMemoryKHR CmdCopyAccelerationStructureToMemoryKHR;
+    PFN_vkCmdCopyBuffer2 CmdCopyBuffer2;
+    PFN_vkCmdCopyBuffer2KHR CmdCopyBuffer2KHR;
+    PFN_vkCmdCopyBufferToImage2 CmdCopyBufferToImage2;
+    PFN_vkCmdCopyBufferToImage2KHR CmdCopyBufferToImage2KHR;
+    PFN_vkCmdCopyImage2 CmdCopyImage2;
+    PFN_vkCmdCopyImage2KHR CmdCopyImage2KHR;
+    PFN_vkCmdCopyImageToBuffer CmdCopyImageToBuffer;
+    PFN_vkCmdCopyImageToBuffer2 CmdCopyImageToBuffer2;
+    PFN_vkCmdCopyImageToBuffer2KHR CmdCopyImageToBuffer2KHR;
+    PFN_vkCmdCopyMemoryToAccelerationStructureKHR CmdCopyMemoryToAccelerationStructureKHR;
+    PFN_vkCmdCopyMemoryToMicromapEXT CmdCopyMemoryToMicromapEXT;
+    PFN_vkCmdCopyMicromapEXT CmdCopyMicromapEXT;
+    PFN_vkCmdCopyMicromapToMemoryEXT CmdCopyMicromapToMemoryEXT;
+    PFN_vkCmdCopyQueryPoolResults CmdCopyQueryPoolResults;
+    PFN_vkCmdDebugMarkerBeginEXT CmdDebugMarkerBeginEXT;
+    PFN_vkCmdDebugMarkerEndEXT CmdDebugMarkerEndEXT;
+    PFN_vkCmdDebugMarkerInsertEXT CmdDebugMarkerInsertEXT;
+    PFN_vkCmdDecodeVideoKHR CmdDecodeVideoKHR;
+    PFN_vkCmdDispatchBase CmdDispatchBase;
+    PFN_vkCmdDispatchBaseKHR CmdDispatchBaseKHR;
+    PFN_vkCmdDrawIndexedIndirectCountKHR CmdDrawIndexedIndirectCountKHR;
+    PFN_vkCmdDrawIndirectByteCountEXT CmdDrawIndirectByteCountEXT;
+    PFN_vkCmdDrawIndirectCountKHR CmdDrawIndirectCountKHR;
+    PFN_vkCmdDrawMeshTasksEXT CmdDrawMeshTasksEXT;
+    PFN_vkCmdDrawMeshTasksIndirectCountEXT CmdDrawMeshTasksIndirectCountEXT;
+    PFN_vkCmdDrawMeshTasksIndirectEXT CmdDrawMeshTasksIndirectEXT;
+    PFN_vkCmdDrawMultiEXT CmdDrawMultiEXT;
+    PFN_vkCmdDrawMultiIndexedEXT CmdDrawMultiIndexedEXT;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    PFN_vkCmdEncodeVideoKHR CmdEncodeVideoKHR;
+#endif
+    PFN_vkCmdEndConditionalRenderingEXT CmdEndConditionalRenderingEXT;
+    PFN_vkCmdEndDebugUtilsLabelEXT CmdEndDebugUtilsLabelEXT;
+    PFN_vkCmdEndQueryIndexedEXT CmdEndQueryIndexedEXT;
+    PFN_vkCmdEndRenderPass2KHR CmdEndRenderPass2KHR;
+    PFN_vkCmdEndTransformFeedbackEXT CmdEndTransformFeedbackEXT;
+    PFN_vkCmdEndVideoCodingKHR CmdEndVideoCodingKHR;
+    PFN_vkCmdFillBuffer CmdFillBuffer;
+    PFN_vkCmdInsertDebugUtilsLabelEXT CmdInsertDebugUtilsLabelEXT;
+    PFN_vkCmdNextSubpass2 CmdNextSubpass2;
+    PFN_vkCmdNextSubpass2KHR CmdNextSubpass2KHR;
+    PFN_vkCmdPushDescriptorSetWithTemplateKHR CmdPushDescriptorSetWithTemplateKHR;
+    PFN_vkCmdResetEvent CmdResetEvent;
+    PFN_vkCmdResetEvent2 CmdResetEvent2;
+    PFN_vkCmdResetEvent2KHR CmdResetEvent2KHR;
+    PFN_vkCmdResolveImage CmdResolveImage;
+    PFN_vkCmdResolveImage2 CmdResolveImage2;
+    PFN_vkCmdResolveImage2KHR CmdResolveImage2KHR;
+    PFN_vkCmdSetAlphaToCoverageEnableEXT CmdSetAlphaToCoverageEnableEXT;
+    PFN_vkCmdSetAlphaToOneEnableEXT CmdSetAlphaToOneEnableEXT;
+    PFN_vkCmdSetAttachmentFeedbackLoopEnableEXT CmdSetAttachmentFeedbackLoopEnableEXT;
+    PFN_vkCmdSetBlendConstants CmdSetBlendConstants;
+    PFN_vkCmdSetColorBlendAdvancedEXT CmdSetColorBlendAdvancedEXT;
+    PFN_vkCmdSetColorBlendEnableEXT CmdSetColorBlendEnableEXT;
+    PFN_vkCmdSetColorBlendEquationEXT CmdSetColorBlendEquationEXT;
+    PFN_vkCmdSetColorWriteEnableEXT CmdSetColorWriteEnableEXT;
+    PFN_vkCmdSetColorWriteMaskEXT CmdSetColorWriteMaskEXT;
+    PFN_vkCmdSetConservativeRasterizationModeEXT CmdSetConservativeRasterizationModeEXT;
+    PFN_vkCmdSetCullMode CmdSetCullMode;
+    PFN_vkCmdSetCullModeEXT CmdSetCullModeEXT;
+    PFN_vkCmdSetDepthBias CmdSetDepthBias;
+    PFN_vkCmdSetDepthBiasEnable CmdSetDepthBiasEnable;
+    PFN_vkCmdSetDepthBiasEnableEXT CmdSetDepthBiasEnableEXT;
+    PFN_vkCmdSetDepthBounds CmdSetDepthBounds;
+    PFN_vkCmdSetDepthBoundsTestEnable CmdSetDepthBoundsTestEnable;
+    PFN_vkCmdSetDepthBoundsTestEnableEXT CmdSetDepthBoundsTestEnableEXT;
+    PFN_vkCmdSetDepthClampEnableEXT CmdSetDepthClampEnableEXT;
+    PFN_vkCmdSetDepthClipEnableEXT CmdSetDepthClipEnableEXT;
+    PFN_vkCmdSetDepthClipNegativeOneToOneEXT CmdSetDepthClipNegativeOneToOneEXT;
+    PFN_vkCmdSetDepthCompareOp CmdSetDepthCompareOp;
+    PFN_vkCmdSetDepthCompareOpEXT CmdSetDepthCompareOpEXT;
+    PFN_vkCmdSetDepthTestEnable CmdSetDepthTestEnable;
+    PFN_vkCmdSetDepthTestEnableEXT CmdSetDepthTestEnableEXT;
+    PFN_vkCmdSetDepthWriteEnable CmdSetDepthWriteEnable;
+    PFN_vkCmdSetDepthWriteEnableEXT CmdSetDepthWriteEnableEXT;
+    PFN_vkCmdSetDescriptorBufferOffsetsEXT CmdSetDescriptorBufferOffsetsEXT;
+    PFN_vkCmdSetDeviceMask CmdSetDeviceMask;
+    PFN_vkCmdSetDeviceMaskKHR CmdSetDeviceMaskKHR;
+    PFN_vkCmdSetDiscardRectangleEXT CmdSetDiscardRectangleEXT;
+    PFN_vkCmdSetDiscardRectangleEnableEXT CmdSetDiscardRectangleEnableEXT;
+    PFN_vkCmdSetDiscardRectangleModeEXT CmdSetDiscardRectangleModeEXT;
+    PFN_vkCmdSetEvent2 CmdSetEvent2;
+    PFN_vkCmdSetEvent2KHR CmdSetEvent2KHR;
+    PFN_vkCmdSetExtraPrimitiveOverestimationSizeEXT CmdSetExtraPrimitiveOverestimationSizeEXT;
+    PFN_vkCmdSetFragmentShadingRateKHR CmdSetFragmentShadingRateKHR;
+    PFN_vkCmdSetFrontFace CmdSetFrontFace;
+    PFN_vkCmdSetFrontFaceEXT CmdSetFrontFaceEXT;
+    PFN_vkCmdSetLineRasterizationModeEXT CmdSetLineRasterizationModeEXT;
+    PFN_vkCmdSetLineStippleEXT CmdSetLineStippleEXT;
+    PFN_vkCmdSetLineStippleEnableEXT CmdSetLineStippleEnableEXT;
+    PFN_vkCmdSetLineWidth CmdSetLineWidth;
+    PFN_vkCmdSetLogicOpEXT CmdSetLogicOpEXT;
+    PFN_vkCmdSetLogicOpEnableEXT CmdSetLogicOpEnableEXT;
+    PFN_vkCmdSetPatchControlPointsEXT CmdSetPatchControlPointsEXT;
+    PFN_vkCmdSetPolygonModeEXT CmdSetPolygonModeEXT;
+    PFN_vkCmdSetPrimitiveRestartEnable CmdSetPrimitiveRestartEnable;
+    PFN_vkCmdSetPrimitiveRestartEnableEXT CmdSetPrimitiveRestartEnableEXT;
+    PFN_vkCmdSetPrimitiveTopology CmdSetPrimitiveTopology;
+    PFN_vkCmdSetPrimitiveTopologyEXT CmdSetPrimitiveTopologyEXT;
+    PFN_vkCmdSetProvokingVertexModeEXT CmdSetProvokingVertexModeEXT;
+    PFN_vkCmdSetRasterizationSamplesEXT CmdSetRasterizationSamplesEXT;
+    PFN_vkCmdSetRasterizationStreamEXT CmdSetRasterizationStreamEXT;
+    PFN_vkCmdSetRasterizerDiscardEnable CmdSetRasterizerDiscardEnable;
+    PFN_vkCmdSetRasterizerDiscardEnableEXT CmdSetRasterizerDiscardEnableEXT;
+    PFN_vkCmdSetRayTracingPipelineStackSizeKHR CmdSetRayTracingPipelineStackSizeKHR;
+    PFN_vkCmdSetSampleLocationsEXT CmdSetSampleLocationsEXT;
+    PFN_vkCmdSetSampleLocationsEnableEXT CmdSetSampleLocationsEnableEXT;
+    PFN_vkCmdSetSampleMaskEXT CmdSetSampleMaskEXT;
+    PFN_vkCmdSetScissorWithCount CmdSetScissorWithCount;
+    PFN_vkCmdSetScissorWithCountEXT CmdSetScissorWithCountEXT;
+    PFN_vkCmdSetStencilCompareMask CmdSetStencilCompareMask;
+    PFN_vkCmdSetStencilOp CmdSetStencilOp;
+    PFN_vkCmdSetStencilOpEXT CmdSetStencilOpEXT;
+    PFN_vkCmdSetStencilReference CmdSetStencilReference;
+    PFN_vkCmdSetStencilTestEnable CmdSetStencilTestEnable;
+    PFN_vkCmdSetStencilTestEnableEXT CmdSetStencilTestEnableEXT;
+    PFN_vkCmdSetStencilWriteMask CmdSetStencilWriteMask;
+    PFN_vkCmdSetTessellationDomainOriginEXT CmdSetTessellationDomainOriginEXT;
+    PFN_vkCmdSetVertexInputEXT CmdSetVertexInputEXT;
+    PFN_vkCmdSetViewportWithCount CmdSetViewportWithCount;
+    PFN_vkCmdSetViewportWithCountEXT CmdSetViewportWithCountEXT;
+    PFN_vkCmdTraceRaysIndirect2KHR CmdTraceRaysIndirect2KHR;
+    PFN_vkCmdTraceRaysIndirectKHR CmdTraceRaysIndirectKHR;
+    PFN_vkCmdTraceRaysKHR CmdTraceRaysKHR;
+    PFN_vkCmdUpdateBuffer CmdUpdateBuffer;
+    PFN_vkCmdWaitEvents2 CmdWaitEvents2;
+    PFN_vkCmdWaitEvents2KHR CmdWaitEvents2KHR;
+    PFN_vkCmdWriteAccelerationStructuresPropertiesKHR CmdWriteAccelerationStructuresPropertiesKHR;
+    PFN_vkCmdWriteMicromapsPropertiesEXT CmdWriteMicromapsPropertiesEXT;
+    PFN_vkCmdWriteTimestamp2 CmdWriteTimestamp2;
+    PFN_vkCmdWriteTimestamp2KHR CmdWriteTimestamp2KHR;
+    PFN_vkQueueBeginDebugUtilsLabelEXT QueueBeginDebugUtilsLabelEXT;
+    PFN_vkQueueBindSparse QueueBindSparse;
+    PFN_vkQueueEndDebugUtilsLabelEXT QueueEndDebugUtilsLabelEXT;
+    PFN_vkQueueInsertDebugUtilsLabelEXT QueueInsertDebugUtilsLabelEXT;
+    PFN_vkQueueWaitIdle QueueWaitIdle;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkAcquireFullScreenExclusiveModeEXT AcquireFullScreenExclusiveModeEXT;
+#endif
+    PFN_vkAcquireProfilingLockKHR AcquireProfilingLockKHR;
+    PFN_vkAllocateCommandBuffers AllocateCommandBuffers;
+    PFN_vkAllocateMemory AllocateMemory;
+    PFN_vkBindBufferMemory BindBufferMemory;
+    PFN_vkBindBufferMemory2 BindBufferMemory2;
+    PFN_vkBindBufferMemory2KHR BindBufferMemory2KHR;
+    PFN_vkBindImageMemory BindImageMemory;
+    PFN_vkBindImageMemory2 BindImageMemory2;
+    PFN_vkBindImageMemory2KHR BindImageMemory2KHR;
+    PFN_vkBindVideoSessionMemoryKHR BindVideoSessionMemoryKHR;
+    PFN_vkBuildAccelerationStructuresKHR BuildAccelerationStructuresKHR;
+    PFN_vkBuildMicromapsEXT BuildMicromapsEXT;
+    PFN_vkCopyAccelerationStructureKHR CopyAccelerationStructureKHR;
+    PFN_vkCopyAccelerationStructureToMemoryKHR CopyAccelerationStructureToMemoryKHR;
+    PFN_vkCopyMemoryToAccelerationStructureKHR CopyMemoryToAccelerationStructureKHR;
+    PFN_vkCopyMemoryToMicromapEXT CopyMemoryToMicromapEXT;
+    PFN_vkCopyMicromapEXT CopyMicromapEXT;
+    PFN_vkCopyMicromapToMemoryEXT CopyMicromapToMemoryEXT;
+    PFN_vkCreateAccelerationStructureKHR CreateAccelerationStructureKHR;
+    PFN_vkCreateBuffer CreateBuffer;
+    PFN_vkCreateBufferView CreateBufferView;
+    PFN_vkCreateCommandPool CreateCommandPool;
+    PFN_vkCreateComputePipelines CreateComputePipelines;
+    PFN_vkCreateDeferredOperationKHR CreateDeferredOperationKHR;
+    PFN_vkCreateDescriptorPool CreateDescriptorPool;
+    PFN_vkCreateDescriptorSetLayout CreateDescriptorSetLayout;
+    PFN_vkCreateDescriptorUpdateTemplate CreateDescriptorUpdateTemplate;
+    PFN_vkCreateDescriptorUpdateTemplateKHR CreateDescriptorUpdateTemplateKHR;
+    PFN_vkCreateEvent CreateEvent;
+    PFN_vkCreateFence CreateFence;
+    PFN_vkCreateFramebuffer CreateFramebuffer;
+    PFN_vkCreateGraphicsPipelines CreateGraphicsPipelines;
+    PFN_vkCreateImage CreateImage;
+    PFN_vkCreateImageView CreateImageView;
+    PFN_vkCreateMicromapEXT CreateMicromapEXT;
+    PFN_vkCreatePipelineCache CreatePipelineCache;
+    PFN_vkCreatePipelineLayout CreatePipelineLayout;
+    PFN_vkCreatePrivateDataSlot CreatePrivateDataSlot;
+    PFN_vkCreatePrivateDataSlotEXT CreatePrivateDataSlotEXT;
+    PFN_vkCreateQueryPool CreateQueryPool;
+    PFN_vkCreateRayTracingPipelinesKHR CreateRayTracingPipelinesKHR;
+    PFN_vkCreateRenderPass CreateRenderPass;
+    PFN_vkCreateRenderPass2 CreateRenderPass2;
+    PFN_vkCreateRenderPass2KHR CreateRenderPass2KHR;
+    PFN_vkCreateSampler CreateSampler;
+    PFN_vkCreateSamplerYcbcrConversion CreateSamplerYcbcrConversion;
+    PFN_vkCreateSamplerYcbcrConversionKHR CreateSamplerYcbcrConversionKHR;
+    PFN_vkCreateSemaphore CreateSemaphore;
+    PFN_vkCreateShaderModule CreateShaderModule;
+    PFN_vkCreateShadersEXT CreateShadersEXT;
+    PFN_vkCreateSharedSwapchainsKHR CreateSharedSwapchainsKHR;
+    PFN_vkCreateSwapchainKHR CreateSwapchainKHR;
+    PFN_vkCreateValidationCacheEXT CreateValidationCacheEXT;
+    PFN_vkCreateVideoSessionKHR CreateVideoSessionKHR;
+    PFN_vkCreateVideoSessionParametersKHR CreateVideoSessionParametersKHR;
+    PFN_vkDebugMarkerSetObjectNameEXT DebugMarkerSetObjectNameEXT;
+    PFN_vkDebugMarkerSetObjectTagEXT DebugMarkerSetObjectTagEXT;
+    PFN_vkDeferredOperationJoinKHR DeferredOperationJoinKHR;
+    PFN_vkDestroyAccelerationStructureKHR DestroyAccelerationStructureKHR;
+    PFN_vkDestroyBuffer DestroyBuffer;
+    PFN_vkDestroyBufferView DestroyBufferView;
+    PFN_vkDestroyCommandPool DestroyCommandPool;
+    PFN_vkDestroyDeferredOperationKHR DestroyDeferredOperationKHR;
+    PFN_vkDestroyDescriptorPool DestroyDescriptorPool;
+    PFN_vkDestroyDescriptorSetLayout DestroyDescriptorSetLayout;
+    PFN_vkDestroyDescriptorUpdateTemplate DestroyDescriptorUpdateTemplate;
+    PFN_vkDestroyDescriptorUpdateTemplateKHR DestroyDescriptorUpdateTemplateKHR;
+    PFN_vkDestroyDevice DestroyDevice;
+    PFN_vkDestroyEvent DestroyEvent;
+    PFN_vkDestroyFence DestroyFence;
+    PFN_vkDestroyFramebuffer DestroyFramebuffer;
+    PFN_vkDestroyImage DestroyImage;
+    PFN_vkDestroyImageView DestroyImageView;
+    PFN_vkDestroyMicromapEXT DestroyMicromapEXT;
+    PFN_vkDestroyPipeline DestroyPipeline;
+    PFN_vkDestroyPipelineCache DestroyPipelineCache;
+    PFN_vkDestroyPipelineLayout DestroyPipelineLayout;
+    PFN_vkDestroyPrivateDataSlot DestroyPrivateDataSlot;
+    PFN_vkDestroyPrivateDataSlotEXT DestroyPrivateDataSlotEXT;
+    PFN_vkDestroyQueryPool DestroyQueryPool;
+    PFN_vkDestroyRenderPass DestroyRenderPass;
+    PFN_vkDestroySampler DestroySampler;
+    PFN_vkDestroySamplerYcbcrConversion DestroySamplerYcbcrConversion;
+    PFN_vkDestroySamplerYcbcrConversionKHR DestroySamplerYcbcrConversionKHR;
+    PFN_vkDestroySemaphore DestroySemaphore;
+    PFN_vkDestroyShaderEXT DestroyShaderEXT;
+    PFN_vkDestroyShaderModule DestroyShaderModule;
+    PFN_vkDestroySwapchainKHR DestroySwapchainKHR;
+    PFN_vkDestroyValidationCacheEXT DestroyValidationCacheEXT;
+    PFN_vkDestroyVideoSessionKHR DestroyVideoSessionKHR;
+    PFN_vkDestroyVideoSessionParametersKHR DestroyVideoSessionParametersKHR;
+    PFN_vkDeviceWaitIdle DeviceWaitIdle;
+    PFN_vkDisplayPowerControlEXT DisplayPowerControlEXT;
+#ifdef VK_USE_PLATFORM_METAL_EXT
+    PFN_vkExportMetalObjectsEXT ExportMetalObjectsEXT;
+#endif
+    PFN_vkFlushMappedMemoryRanges FlushMappedMemoryRanges;
+    PFN_vkFreeCommandBuffers FreeCommandBuffers;
+    PFN_vkFreeDescriptorSets FreeDescriptorSets;
+    PFN_vkFreeMemory FreeMemory;
+    PFN_vkGetAccelerationStructureBuildSizesKHR GetAccelerationStructureBuildSizesKHR;
+    PFN_vkGetAccelerationStructureDeviceAddressKHR GetAccelerationStructureDeviceAddressKHR;
+    PFN_vkGetAccelerationStructureOpaqueCaptureDescriptorDataEXT GetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+    PFN_vkGetBufferDeviceAddress GetBufferDeviceAddress;
+    PFN_vkGetBufferDeviceAddressEXT GetBufferDeviceAddressEXT;
+    PFN_vkGetBufferDeviceAddressKHR GetBufferDeviceAddressKHR;
+    PFN_vkGetBufferMemoryRequirements GetBufferMemoryRequirements;
+    PFN_vkGetBufferMemoryRequirements2 GetBufferMemoryRequirements2;
+    PFN_vkGetBufferMemoryRequirements2KHR GetBufferMemoryRequirements2KHR;
+    PFN_vkGetBufferOpaqueCaptureAddress GetBufferOpaqueCaptureAddress;
+    PFN_vkGetBufferOpaqueCaptureAddressKHR GetBufferOpaqueCaptureAddressKHR;
+    PFN_vkGetBufferOpaqueCaptureDescriptorDataEXT GetBufferOpaqueCaptureDescriptorDataEXT;
+    PFN_vkGetCalibratedTimestampsEXT GetCalibratedTimestampsEXT;
+    PFN_vkGetDeferredOperationMaxConcurrencyKHR GetDeferredOperationMaxConcurrencyKHR;
+    PFN_vkGetDeferredOperationResultKHR GetDeferredOperationResultKHR;
+    PFN_vkGetDescriptorEXT GetDescriptorEXT;
+    PFN_vkGetDescriptorSetLayoutBindingOffsetEXT GetDescriptorSetLayoutBindingOffsetEXT;
+    PFN_vkGetDescriptorSetLayoutSizeEXT GetDescriptorSetLayoutSizeEXT;
+    PFN_vkGetDescriptorSetLayoutSupport GetDescriptorSetLayoutSupport;
+    PFN_vkGetDescriptorSetLayoutSupportKHR GetDescriptorSetLayoutSupportKHR;
+    PFN_vkGetDeviceAccelerationStructureCompatibilityKHR GetDeviceAccelerationStructureCompatibilityKHR;
+    PFN_vkGetDeviceBufferMemoryRequirements GetDeviceBufferMemoryRequirements;
+    PFN_vkGetDeviceBufferMemoryRequirementsKHR GetDeviceBufferMemoryRequirementsKHR;
+    PFN_vkGetDeviceFaultInfoEXT GetDeviceFaultInfoEXT;
+    PFN_vkGetDeviceGroupPeerMemoryFeatures GetDeviceGroupPeerMemoryFeatures;
+    PFN_vkGetDeviceGroupPeerMemoryFeaturesKHR GetDeviceGroupPeerMemoryFeaturesKHR;
+    PFN_vkGetDeviceGroupPresentCapabilitiesKHR GetDeviceGroupPresentCapabilitiesKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetDeviceGroupSurfacePresentModes2EXT GetDeviceGroupSurfacePresentModes2EXT;
+#endif
+    PFN_vkGetDeviceGroupSurfacePresentModesKHR GetDeviceGroupSurfacePresentModesKHR;
+    PFN_vkGetDeviceImageMemoryRequirements GetDeviceImageMemoryRequirements;
+    PFN_vkGetDeviceImageMemoryRequirementsKHR GetDeviceImageMemoryRequirementsKHR;
+    PFN_vkGetDeviceImageSparseMemoryRequirements GetDeviceImageSparseMemoryRequirements;
+    PFN_vkGetDeviceImageSparseMemoryRequirementsKHR GetDeviceImageSparseMemoryRequirementsKHR;
+    PFN_vkGetDeviceMemoryCommitment GetDeviceMemoryCommitment;
+    PFN_vkGetDeviceMemoryOpaqueCaptureAddress GetDeviceMemoryOpaqueCaptureAddress;
+    PFN_vkGetDeviceMemoryOpaqueCaptureAddressKHR GetDeviceMemoryOpaqueCaptureAddressKHR;
+    PFN_vkGetDeviceMicromapCompatibilityEXT GetDeviceMicromapCompatibilityEXT;
+    PFN_vkGetDeviceProcAddr GetDeviceProcAddr;
+    PFN_vkGetDeviceQueue GetDeviceQueue;
+    PFN_vkGetDeviceQueue2 GetDeviceQueue2;
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+    PFN_vkGetEncodedVideoSessionParametersKHR GetEncodedVideoSessionParametersKHR;
+#endif
+    PFN_vkGetEventStatus GetEventStatus;
+    PFN_vkGetFenceFdKHR GetFenceFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetFenceWin32HandleKHR GetFenceWin32HandleKHR;
+#endif
+    PFN_vkGetImageDrmFormatModifierPropertiesEXT GetImageDrmFormatModifierPropertiesEXT;
+    PFN_vkGetImageMemoryRequirements GetImageMemoryRequirements;
+    PFN_vkGetImageMemoryRequirements2 GetImageMemoryRequirements2;
+    PFN_vkGetImageMemoryRequirements2KHR GetImageMemoryRequirements2KHR;
+    PFN_vkGetImageOpaqueCaptureDescriptorDataEXT GetImageOpaqueCaptureDescriptorDataEXT;
+    PFN_vkGetImageSparseMemoryRequirements GetImageSparseMemoryRequirements;
+    PFN_vkGetImageSparseMemoryRequirements2 GetImageSparseMemoryRequirements2;
+    PFN_vkGetImageSparseMemoryRequirements2KHR GetImageSparseMemoryRequirements2KHR;
+    PFN_vkGetImageSubresourceLayout GetImageSubresourceLayout;
+    PFN_vkGetImageSubresourceLayout2EXT GetImageSubresourceLayout2EXT;
+    PFN_vkGetImageViewOpaqueCaptureDescriptorDataEXT GetImageViewOpaqueCaptureDescriptorDataEXT;
+    PFN_vkGetMemoryFdKHR GetMemoryFdKHR;
+    PFN_vkGetMemoryFdPropertiesKHR GetMemoryFdPropertiesKHR;
+    PFN_vkGetMemoryHostPointerPropertiesEXT GetMemoryHostPointerPropertiesEXT;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetMemoryWin32HandleKHR GetMemoryWin32HandleKHR;
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetMemoryWin32HandlePropertiesKHR GetMemoryWin32HandlePropertiesKHR;
+#endif
+    PFN_vkGetMicromapBuildSizesEXT GetMicromapBuildSizesEXT;
+    PFN_vkGetPipelineCacheData GetPipelineCacheData;
+    PFN_vkGetPipelineExecutableInternalRepresentationsKHR GetPipelineExecutableInternalRepresentationsKHR;
+    PFN_vkGetPipelineExecutablePropertiesKHR GetPipelineExecutablePropertiesKHR;
+    PFN_vkGetPipelineExecutableStatisticsKHR GetPipelineExecutableStatisticsKHR;
+    PFN_vkGetPipelinePropertiesEXT GetPipelinePropertiesEXT;
+    PFN_vkGetPrivateData GetPrivateData;
+    PFN_vkGetPrivateDataEXT GetPrivateDataEXT;
+    PFN_vkGetQueryPoolResults GetQueryPoolResults;
+    PFN_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR GetRayTracingCaptureReplayShaderGroupHandlesKHR;
+    PFN_vkGetRayTracingShaderGroupHandlesKHR GetRayTracingShaderGroupHandlesKHR;
+    PFN_vkGetRayTracingShaderGroupStackSizeKHR GetRayTracingShaderGroupStackSizeKHR;
+    PFN_vkGetRenderAreaGranularity GetRenderAreaGranularity;
+    PFN_vkGetSamplerOpaqueCaptureDescriptorDataEXT GetSamplerOpaqueCaptureDescriptorDataEXT;
+    PFN_vkGetSemaphoreFdKHR GetSemaphoreFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetSemaphoreWin32HandleKHR GetSemaphoreWin32HandleKHR;
+#endif
+    PFN_vkGetShaderBinaryDataEXT GetShaderBinaryDataEXT;
+    PFN_vkGetShaderModuleCreateInfoIdentifierEXT GetShaderModuleCreateInfoIdentifierEXT;
+    PFN_vkGetShaderModuleIdentifierEXT GetShaderModuleIdentifierEXT;
+    PFN_vkGetSwapchainCounterEXT GetSwapchainCounterEXT;
+    PFN_vkGetSwapchainImagesKHR GetSwapchainImagesKHR;
+    PFN_vkGetSwapchainStatusKHR GetSwapchainStatusKHR;
+    PFN_vkGetValidationCacheDataEXT GetValidationCacheDataEXT;
+    PFN_vkGetVideoSessionMemoryRequirementsKHR GetVideoSessionMemoryRequirementsKHR;
+    PFN_vkImportFenceFdKHR ImportFenceFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkImportFenceWin32HandleKHR ImportFenceWin32HandleKHR;
+#endif
+    PFN_vkImportSemaphoreFdKHR ImportSemaphoreFdKHR;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkImportSemaphoreWin32HandleKHR ImportSemaphoreWin32HandleKHR;
+#endif
+    PFN_vkInvalidateMappedMemoryRanges InvalidateMappedMemoryRanges;
+    PFN_vkMapMemory MapMemory;
+    PFN_vkMapMemory2KHR MapMemory2KHR;
+    PFN_vkMergePipelineCaches MergePipelineCaches;
+    PFN_vkMergeValidationCachesEXT MergeValidationCachesEXT;
+    PFN_vkRegisterDeviceEventEXT RegisterDeviceEventEXT;
+    PFN_vkRegisterDisplayEventEXT RegisterDisplayEventEXT;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkReleaseFullScreenExclusiveModeEXT ReleaseFullScreenExclusiveModeEXT;
+#endif
+    PFN_vkReleaseProfilingLockKHR ReleaseProfilingLockKHR;
+    PFN_vkReleaseSwapchainImagesEXT ReleaseSwapchainImagesEXT;
+    PFN_vkResetEvent ResetEvent;
+    PFN_vkResetQueryPool ResetQueryPool;
+    PFN_vkResetQueryPoolEXT ResetQueryPoolEXT;
+    PFN_vkSetDebugUtilsObjectNameEXT SetDebugUtilsObjectNameEXT;
+    PFN_vkSetDebugUtilsObjectTagEXT SetDebugUtilsObjectTagEXT;
+    PFN_vkSetDeviceMemoryPriorityEXT SetDeviceMemoryPriorityEXT;
+    PFN_vkSetEvent SetEvent;
+    PFN_vkSetHdrMetadataEXT SetHdrMetadataEXT;
+    PFN_vkSetPrivateData SetPrivateData;
+    PFN_vkSetPrivateDataEXT SetPrivateDataEXT;
+    PFN_vkSignalSemaphoreKHR SignalSemaphoreKHR;
+    PFN_vkTrimCommandPool TrimCommandPool;
+    PFN_vkTrimCommandPoolKHR TrimCommandPoolKHR;
+    PFN_vkUnmapMemory UnmapMemory;
+    PFN_vkUnmapMemory2KHR UnmapMemory2KHR;
+    PFN_vkUpdateDescriptorSetWithTemplate UpdateDescriptorSetWithTemplate;
+    PFN_vkUpdateDescriptorSetWithTemplateKHR UpdateDescriptorSetWithTemplateKHR;
+    PFN_vkUpdateVideoSessionParametersKHR UpdateVideoSessionParametersKHR;
+    PFN_vkWaitForPresentKHR WaitForPresentKHR;
+    PFN_vkWriteAccelerationStructuresPropertiesKHR WriteAccelerationStructuresPropertiesKHR;
+    PFN_vkWriteMicromapsPropertiesEXT WriteMicromapsPropertiesEXT;
+    PFN_vkAcquirePerformanceConfigurationINTEL AcquirePerformanceConfigurationINTEL;
+    PFN_vkBindAccelerationStructureMemoryNV BindAccelerationStructureMemoryNV;
+    PFN_vkBindOpticalFlowSessionImageNV BindOpticalFlowSessionImageNV;
+    PFN_vkCmdBindInvocationMaskHUAWEI CmdBindInvocationMaskHUAWEI;
+    PFN_vkCmdBindPipelineShaderGroupNV CmdBindPipelineShaderGroupNV;
+    PFN_vkCmdBindShadingRateImageNV CmdBindShadingRateImageNV;
+    PFN_vkCmdBuildAccelerationStructureNV CmdBuildAccelerationStructureNV;
+    PFN_vkCmdCopyAccelerationStructureNV CmdCopyAccelerationStructureNV;
+    PFN_vkCmdCopyMemoryIndirectNV CmdCopyMemoryIndirectNV;
+    PFN_vkCmdCopyMemoryToImageIndirectNV CmdCopyMemoryToImageIndirectNV;
+    PFN_vkCmdDecompressMemoryIndirectCountNV CmdDecompressMemoryIndirectCountNV;
+    PFN_vkCmdDecompressMemoryNV CmdDecompressMemoryNV;
+    PFN_vkCmdDrawClusterHUAWEI CmdDrawClusterHUAWEI;
+    PFN_vkCmdDrawClusterIndirectHUAWEI CmdDrawClusterIndirectHUAWEI;
+    PFN_vkCmdDrawIndexedIndirectCountAMD CmdDrawIndexedIndirectCountAMD;
+    PFN_vkCmdDrawIndirectCountAMD CmdDrawIndirectCountAMD;
+    PFN_vkCmdDrawMeshTasksIndirectCountNV CmdDrawMeshTasksIndirectCountNV;
+    PFN_vkCmdDrawMeshTasksIndirectNV CmdDrawMeshTasksIndirectNV;
+    PFN_vkCmdDrawMeshTasksNV CmdDrawMeshTasksNV;
+    PFN_vkCmdExecuteGeneratedCommandsNV CmdExecuteGeneratedCommandsNV;
+    PFN_vkCmdOpticalFlowExecuteNV CmdOpticalFlowExecuteNV;
+    PFN_vkCmdPreprocessGeneratedCommandsNV CmdPreprocessGeneratedCommandsNV;
+    PFN_vkCmdSetCheckpointNV CmdSetCheckpointNV;
+    PFN_vkCmdSetCoarseSampleOrderNV CmdSetCoarseSampleOrderNV;
+    PFN_vkCmdSetCoverageModulationModeNV CmdSetCoverageModulationModeNV;
+    PFN_vkCmdSetCoverageModulationTableEnableNV CmdSetCoverageModulationTableEnableNV;
+    PFN_vkCmdSetCoverageModulationTableNV CmdSetCoverageModulationTableNV;
+    PFN_vkCmdSetCoverageReductionModeNV CmdSetCoverageReductionModeNV;
+    PFN_vkCmdSetCoverageToColorEnableNV CmdSetCoverageToColorEnableNV;
+    PFN_vkCmdSetCoverageToColorLocationNV CmdSetCoverageToColorLocationNV;
+    PFN_vkCmdSetExclusiveScissorEnableNV CmdSetExclusiveScissorEnableNV;
+    PFN_vkCmdSetExclusiveScissorNV CmdSetExclusiveScissorNV;
+    PFN_vkCmdSetFragmentShadingRateEnumNV CmdSetFragmentShadingRateEnumNV;
+    PFN_vkCmdSetPerformanceMarkerINTEL CmdSetPerformanceMarkerINTEL;
+    PFN_vkCmdSetPerformanceOverrideINTEL CmdSetPerformanceOverrideINTEL;
+    PFN_vkCmdSetPerformanceStreamMarkerINTEL CmdSetPerformanceStreamMarkerINTEL;
+    PFN_vkCmdSetRepresentativeFragmentTestEnableNV CmdSetRepresentativeFragmentTestEnableNV;
+    PFN_vkCmdSetShadingRateImageEnableNV CmdSetShadingRateImageEnableNV;
+    PFN_vkCmdSetViewportShadingRatePaletteNV CmdSetViewportShadingRatePaletteNV;
+    PFN_vkCmdSetViewportSwizzleNV CmdSetViewportSwizzleNV;
+    PFN_vkCmdSetViewportWScalingEnableNV CmdSetViewportWScalingEnableNV;
+    PFN_vkCmdSetViewportWScalingNV CmdSetViewportWScalingNV;
+    PFN_vkCmdSubpassShadingHUAWEI CmdSubpassShadingHUAWEI;
+    PFN_vkCmdTraceRaysNV CmdTraceRaysNV;
+    PFN_vkCmdWriteAccelerationStructuresPropertiesNV CmdWriteAccelerationStructuresPropertiesNV;
+    PFN_vkCmdWriteBufferMarker2AMD CmdWriteBufferMarker2AMD;
+    PFN_vkCmdWriteBufferMarkerAMD CmdWriteBufferMarkerAMD;
+    PFN_vkCompileDeferredNV CompileDeferredNV;
+    PFN_vkCreateAccelerationStructureNV CreateAccelerationStructureNV;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkCreateBufferCollectionFUCHSIA CreateBufferCollectionFUCHSIA;
+#endif
+    PFN_vkCreateIndirectCommandsLayoutNV CreateIndirectCommandsLayoutNV;
+    PFN_vkCreateOpticalFlowSessionNV CreateOpticalFlowSessionNV;
+    PFN_vkCreateRayTracingPipelinesNV CreateRayTracingPipelinesNV;
+    PFN_vkDestroyAccelerationStructureNV DestroyAccelerationStructureNV;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkDestroyBufferCollectionFUCHSIA DestroyBufferCollectionFUCHSIA;
+#endif
+    PFN_vkDestroyIndirectCommandsLayoutNV DestroyIndirectCommandsLayoutNV;
+    PFN_vkDestroyOpticalFlowSessionNV DestroyOpticalFlowSessionNV;
+    PFN_vkGetAccelerationStructureHandleNV GetAccelerationStructureHandleNV;
+    PFN_vkGetAccelerationStructureMemoryRequirementsNV GetAccelerationStructureMemoryRequirementsNV;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    PFN_vkGetAndroidHardwareBufferPropertiesANDROID GetAndroidHardwareBufferPropertiesANDROID;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkGetBufferCollectionPropertiesFUCHSIA GetBufferCollectionPropertiesFUCHSIA;
+#endif
+    PFN_vkGetDescriptorSetHostMappingVALVE GetDescriptorSetHostMappingVALVE;
+    PFN_vkGetDescriptorSetLayoutHostMappingInfoVALVE GetDescriptorSetLayoutHostMappingInfoVALVE;
+    PFN_vkGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+    PFN_vkGetDynamicRenderingTilePropertiesQCOM GetDynamicRenderingTilePropertiesQCOM;
+    PFN_vkGetFramebufferTilePropertiesQCOM GetFramebufferTilePropertiesQCOM;
+    PFN_vkGetGeneratedCommandsMemoryRequirementsNV GetGeneratedCommandsMemoryRequirementsNV;
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+    PFN_vkGetMemoryAndroidHardwareBufferANDROID GetMemoryAndroidHardwareBufferANDROID;
+#endif
+    PFN_vkGetMemoryRemoteAddressNV GetMemoryRemoteAddressNV;
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+    PFN_vkGetMemoryWin32HandleNV GetMemoryWin32HandleNV;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkGetMemoryZirconHandleFUCHSIA GetMemoryZirconHandleFUCHSIA;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkGetMemoryZirconHandlePropertiesFUCHSIA GetMemoryZirconHandlePropertiesFUCHSIA;
+#endif
+    PFN_vkGetPastPresentationTimingGOOGLE GetPastPresentationTimingGOOGLE;
+    PFN_vkGetPerformanceParameterINTEL GetPerformanceParameterINTEL;
+    PFN_vkGetQueueCheckpointData2NV GetQueueCheckpointData2NV;
+    PFN_vkGetQueueCheckpointDataNV GetQueueCheckpointDataNV;
+    PFN_vkGetRayTracingShaderGroupHandlesNV GetRayTracingShaderGroupHandlesNV;
+    PFN_vkGetRefreshCycleDurationGOOGLE GetRefreshCycleDurationGOOGLE;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkGetSemaphoreZirconHandleFUCHSIA GetSemaphoreZirconHandleFUCHSIA;
+#endif
+    PFN_vkGetShaderInfoAMD GetShaderInfoAMD;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkImportSemaphoreZirconHandleFUCHSIA ImportSemaphoreZirconHandleFUCHSIA;
+#endif
+    PFN_vkInitializePerformanceApiINTEL InitializePerformanceApiINTEL;
+    PFN_vkQueueSetPerformanceConfigurationINTEL QueueSetPerformanceConfigurationINTEL;
+    PFN_vkReleasePerformanceConfigurationINTEL ReleasePerformanceConfigurationINTEL;
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkSetBufferCollectionBufferConstraintsFUCHSIA SetBufferCollectionBufferConstraintsFUCHSIA;
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+    PFN_vkSetBufferCollectionImageConstraintsFUCHSIA SetBufferCollectionImageConstraintsFUCHSIA;
+#endif
+    PFN_vkSetLocalDimmingAMD SetLocalDimmingAMD;
+    PFN_vkUninitializePerformanceApiINTEL UninitializePerformanceApiINTEL;
+#endif
+    mutable uint64_t UserData = 0;
+#if VKROOTS_USE_CREATE_TIMINGS
+    mutable tables::VkCreateTimings CreateTimings;
+#endif
+    VkDevice Device;
+    VkPhysicalDevice PhysicalDevice;
+    const VkPhysicalDeviceDispatch* pPhysicalDeviceDispatch;
+    std::vector<VkDeviceQueueCreateInfo> DeviceQueueInfos;
+#if VKROOTS_USE_PROC_ADDR_CACHE
+    tables::VkProcAddrCache ProcAddrCache;
+#endif
+  private:
+    PFN_vkDestroyDevice DestroyDeviceReal;
+    static void DestroyDeviceWrapper(VkDevice object, const VkAllocationCallbacks* pAllocator) {
+      auto dispatch = vkroots::tables::LookupDeviceDispatch(object);
+      auto destroyFunc = dispatch->DestroyDeviceReal;
+      vkroots::tables::DestroyDispatchTable(object);
+      destroyFunc(object, pAllocator);
+    }
+  };
+
+}
+
+namespace vkroots::tables {
+
+  inline void CreateDispatchTable(PFN_vkGetInstanceProcAddr nextInstanceProcAddr, PFN_GetPhysicalDeviceProcAddr nextPhysDevProcAddr, VkInstance instance) {
+#if VKROOTS_USE_CREATE_TIMINGS
+    VkCreateTimer totalTimer;
+#endif
+    auto instanceDispatch = InstanceDispatches.insert(instance, std::make_unique<VkInstanceDispatch>(nextInstanceProcAddr, instance));
+    auto physicalDeviceDispatch = PhysicalDeviceInstanceDispatches.insert(instance, std::make_unique<VkPhysicalDeviceDispatch>(nextPhysDevProcAddr, instance, instanceDispatch));
+#if VKROOTS_USE_DISPATCH_KEY
+    // Physical devices share the instance's dispatch key.
+    KeyDispatches<VkInstanceDispatch>.insert(instance, instanceDispatch);
+    KeyDispatches<VkPhysicalDeviceDispatch>.insert(instance, physicalDeviceDispatch);
+#endif
+#if VKROOTS_USE_CREATE_TIMINGS
+    instanceDispatch->CreateTimings.DispatchConstruction = totalTimer.Elapsed();
+    totalTimer.StoreOnExit(&instanceDispatch->CreateTimings.CreateDispatchTable);
+    VkCreateTimer enumerationTimer(&instanceDispatch->CreateTimings.PhysicalDeviceEnumeration);
+#endif
+
+    uint32_t physicalDeviceCount;
+    VkResult res = instanceDispatch->EnumeratePhysicalDevices(instance, &physicalDeviceCount, nullptr);
+    assert(res == VK_SUCCESS); // Not like we can do anything else with the result lol.
+    if (res != VK_SUCCESS) return;
+    std::vector<VkPhysicalDevice> physicalDevices(physicalDeviceCount);
+    res = instanceDispatch->EnumeratePhysicalDevices(instance, &physicalDeviceCount, physicalDevices.data());
+    assert(res == VK_SUCCESS); // Not like we can do anything else with the result lol.
+    if (res != VK_SUCCESS) return;
+
+    for (VkPhysicalDevice physicalDevice : physicalDevices)
+      PhysicalDeviceDispatches.insert(physicalDevice, RawPointer(physicalDeviceDispatch));
+  }
+
+  inline void CreateDispatchTable(const VkDeviceCreateInfo* pCreateInfo, PFN_vkGetDeviceProcAddr nextProcAddr, VkPhysicalDevice physicalDevice, VkDevice device) {
+#if VKROOTS_USE_CREATE_TIMINGS
+    VkCreateTimer totalTimer;
+#endif
+    auto physicalDeviceDispatch = vkroots::tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    auto deviceDispatch = DeviceDispatches.insert(device, std::make_unique<VkDeviceDispatch>(nextProcAddr, device, physicalDevice, physicalDeviceDispatch, pCreateInfo));
+#if VKROOTS_USE_DISPATCH_KEY
+    // Queues and command buffers share the device's dispatch key.
+    KeyDispatches<VkDeviceDispatch>.insert(device, deviceDispatch);
+#endif
+#if VKROOTS_USE_CREATE_TIMINGS
+    deviceDispatch->CreateTimings.DispatchConstruction = totalTimer.Elapsed();
+    totalTimer.StoreOnExit(&deviceDispatch->CreateTimings.CreateDispatchTable);
+    VkCreateTimer queueTimer(&deviceDispatch->CreateTimings.QueueRegistration);
+#endif
+
+    for (uint32_t i = 0; i < pCreateInfo->queueCreateInfoCount; i++) {
+      const auto &queueInfo = pCreateInfo->pQueueCreateInfos[i];
+      for (uint32_t j = 0; j < queueInfo.queueCount; j++) {
+        VkQueue queue;
+        deviceDispatch->GetDeviceQueue(device, queueInfo.queueFamilyIndex, j, &queue);
+
+        QueueDispatches.insert(queue, RawPointer(deviceDispatch));
+      }
+    }
+  }
+
+  inline void DestroyDispatchTable(VkInstance instance) {
+    const VkInstanceDispatch* instanceDispatch = InstanceDispatches.find(instance);
+    assert(instanceDispatch);
+    if (!instanceDispatch)
+      return;
+
+    uint32_t physicalDeviceCount;
+    VkResult res = instanceDispatch->EnumeratePhysicalDevices(instance, &physicalDeviceCount, nullptr);
+    assert(res == VK_SUCCESS); // Not like we can do anything else with the result lol.
+    if (res == VK_SUCCESS) {
+      std::vector<VkPhysicalDevice> physicalDevices(physicalDeviceCount);
+      res = instanceDispatch->EnumeratePhysicalDevices(instance, &physicalDeviceCount, physicalDevices.data());
+      assert(res == VK_SUCCESS); // Not like we can do anything else with the result lol.
+      if (res == VK_SUCCESS) {
+        for (VkPhysicalDevice physicalDevice : physicalDevices)
+          PhysicalDeviceDispatches.remove(physicalDevice);
+      }
+    }
+
+#if VKROOTS_USE_DISPATCH_KEY
+    KeyDispatches<VkPhysicalDeviceDispatch>.remove(instance);
+    KeyDispatches<VkInstanceDispatch>.remove(instance);
+#endif
+    PhysicalDeviceInstanceDispatches.remove(instance);
+    InstanceDispatches.remove(instance);
+
+    // Only once nothing can find them any more, or a lookup in between could
+    // cache them again under the new generation.
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    DispatchGeneration.fetch_add(1, std::memory_order_release);
+#endif
+  }
+
+  inline void DestroyDispatchTable(VkDevice device) {
+    const VkDeviceDispatch* deviceDispatch = DeviceDispatches.find(device);
+    assert(deviceDispatch);
+    if (!deviceDispatch)
+      return;
+
+    for (const auto& queueInfo : deviceDispatch->DeviceQueueInfos) {
+      for (uint32_t i = 0; i < queueInfo.queueCount; i++) {
+        VkQueue queue;
+        deviceDispatch->GetDeviceQueue(device, queueInfo.queueFamilyIndex, i, &queue);
+        QueueDispatches.remove(queue);
+      }
+    }
+
+#if VKROOTS_USE_DISPATCH_KEY
+    KeyDispatches<VkDeviceDispatch>.remove(device);
+#endif
+    DeviceDispatches.remove(device);
+    // Pools the app didn't destroy before the device.
+    CommandPools.destroy(device);
+
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    DispatchGeneration.fetch_add(1, std::memory_order_release);
+#endif
+  }
+
+  inline void RegisterCommandBuffers(const VkDeviceDispatch* deviceDispatch, const VkCommandBufferStateType* stateType, const VkCommandBufferAllocateInfo* pAllocateInfo, const VkCommandBuffer* pCommandBuffers) {
+    CommandPools.insert(deviceDispatch->Device, deviceDispatch, stateType, pAllocateInfo->commandPool, pAllocateInfo->commandBufferCount, pCommandBuffers);
+  }
+
+  inline void UnregisterCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer* pCommandBuffers) {
+    CommandPools.remove(device, commandPool, commandBufferCount, pCommandBuffers);
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    // The handles may come back for a command buffer on another device.
+    DispatchGeneration.fetch_add(1, std::memory_order_release);
+#endif
+  }
+
+  inline void UnregisterCommandPool(VkDevice device, VkCommandPool commandPool) {
+#if VKROOTS_USE_TLS_DISPATCH_CACHE
+    if (CommandPools.destroy(device, commandPool))
+      DispatchGeneration.fetch_add(1, std::memory_order_release);
+#else
+    CommandPools.destroy(device, commandPool);
+#endif
+  }
+
+}
+
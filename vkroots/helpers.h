@@ -0,0 +1,477 @@
+// Part of vkroots.h, generated by gen/make_vkroots.
+
+#pragma once
+
+#include "stypes.h"
+
+namespace vkroots {
+#ifdef __GNUC__
+  #define VKROOTS_INLINE_ATTR __attribute__((always_inline))
+  #define VKROOTS_FLATTEN_ATTR __attribute__((visibility("protected"), flatten))
+#else
+  #define VKROOTS_INLINE_ATTR
+  #define VKROOTS_FLATTEN_ATTR
+#endif
+
+  consteval decltype(auto) force_consteval(auto in) {
+    return in;
+  }
+
+  // Refers to a callable without owning or copying it, so it is the size of
+  // two pointers however big the callable is, and never allocates. The
+  // callable has to outlive it, as one passed as a function argument does for
+  // the duration of the call, which is all the ChainPatcher constructors
+  // take it for. Don't store one, use constexpr_function for that.
+  template <class R, class... TArgs>
+  class function_ref<R(TArgs...)> {
+  public:
+    template <class Fn> requires (std::invocable<Fn&, TArgs...> || ConceptNullFunc<Fn, R>) && (!std::is_same_v<std::remove_cvref_t<Fn>, function_ref>)
+    constexpr function_ref(Fn&& fn)
+      : m_obj{ std::addressof(fn) }
+      , m_pfnRun{ &Run<std::remove_reference_t<Fn>> } {
+    }
+
+    constexpr R VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const {
+      return m_pfnRun(m_obj, std::forward<TArgs>(args)...);
+    }
+
+    constexpr operator bool() {
+      return true;
+    }
+
+  private:
+    template <class Fn>
+    static constexpr R VKROOTS_INLINE_ATTR Run(const void* pObj, TArgs... args) {
+      return (*static_cast<Fn*>(const_cast<void*>(pObj)))(std::forward<TArgs>(args)...);
+    }
+
+    const void* m_obj;
+    R (*m_pfnRun)(const void*, TArgs...);
+  };
+
+  // Owns a copy of the callable, so unlike function_ref it can be stored and
+  // outlive what it was made from. The copy lives in an in-place buffer of
+  // Capacity bytes and is called through a plain function pointer, so it never
+  // allocates and has no virtual dispatch. A callable that doesn't fit is a
+  // compile error, give such one a bigger Capacity.
+  // Being type erased into raw storage, it can't be used in constant
+  // expressions, the in-place form below can.
+  template <size_t Capacity, class R, class... TArgs>
+  class constexpr_function<R(TArgs...), void, Capacity> {
+  public:
+    template <class Fn> requires std::invocable<Fn&, TArgs...> && (!std::is_same_v<std::remove_cvref_t<Fn>, constexpr_function>)
+    constexpr_function(Fn&& fn) {
+      using T = std::remove_cvref_t<Fn>;
+      static_assert(sizeof(T) <= Capacity, "Callable is too big for this constexpr_function's Capacity.");
+      static_assert(alignof(T) <= alignof(std::max_align_t), "Callable is over-aligned.");
+      ::new (static_cast<void*>(m_storage)) T(std::forward<Fn>(fn));
+      m_pfnRun    = &Run<T>;
+      m_pfnManage = &Manage<T>;
+    }
+
+    constexpr_function(const constexpr_function& other)
+      : m_pfnRun{ other.m_pfnRun }
+      , m_pfnManage{ other.m_pfnManage } {
+      if (m_pfnManage)
+        m_pfnManage(Op::Copy, m_storage, other.m_storage);
+    }
+
+    constexpr_function(constexpr_function&& other)
+      : m_pfnRun{ std::exchange(other.m_pfnRun, nullptr) }
+      , m_pfnManage{ std::exchange(other.m_pfnManage, nullptr) } {
+      if (m_pfnManage)
+        m_pfnManage(Op::Move, m_storage, other.m_storage);
+    }
+
+    constexpr_function& operator=(const constexpr_function& other) {
+      if (this != &other) {
+        this->~constexpr_function();
+        ::new (static_cast<void*>(this)) constexpr_function(other);
+      }
+      return *this;
+    }
+
+    constexpr_function& operator=(constexpr_function&& other) {
+      if (this != &other) {
+        this->~constexpr_function();
+        ::new (static_cast<void*>(this)) constexpr_function(std::move(other));
+      }
+      return *this;
+    }
+
+    ~constexpr_function() {
+      if (m_pfnManage)
+        m_pfnManage(Op::Destroy, m_storage, nullptr);
+    }
+
+    R VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const {
+      return m_pfnRun(m_storage, std::forward<TArgs>(args)...);
+    }
+
+    // Only a moved-from one is empty.
+    operator bool() const {
+      return m_pfnRun != nullptr;
+    }
+
+  private:
+    enum class Op {
+      Copy,
+      // Also destroys the source.
+      Move,
+      Destroy,
+    };
+
+    template <class T>
+    static R VKROOTS_INLINE_ATTR Run(void* pObj, TArgs... args) {
+      return (*static_cast<T*>(pObj))(std::forward<TArgs>(args)...);
+    }
+
+    template <class T>
+    static void Manage(Op op, void* pDst, void* pSrc) {
+      switch (op) {
+        case Op::Copy:
+          ::new (pDst) T(*static_cast<const T*>(pSrc));
+          break;
+        case Op::Move:
+          ::new (pDst) T(std::move(*static_cast<T*>(pSrc)));
+          static_cast<T*>(pSrc)->~T();
+          break;
+        case Op::Destroy:
+          static_cast<T*>(pDst)->~T();
+          break;
+      }
+    }
+
+    alignas(std::max_align_t) mutable std::byte m_storage[Capacity];
+    R (*m_pfnRun)(void*, TArgs...) = nullptr;
+    void (*m_pfnManage)(Op, void*, void*) = nullptr;
+  };
+
+  // Holds the callable in place, so it is exactly the size of the callable and
+  // calls it directly. This is what `constexpr_function f = [](...) { ... };`
+  // deduces to, and it converts to either of the above.
+  template <class R, class Fn, class... TArgs> requires (!std::is_void_v<Fn>)
+  class constexpr_function<R(TArgs...), Fn> {
+  public:
+    constexpr constexpr_function(Fn fn)
+      : m_fn{ std::move(fn) } {
+    }
+
+    constexpr R VKROOTS_FLATTEN_ATTR operator()(TArgs... args) const {
+      return m_fn(std::forward<TArgs>(args)...);
+    }
+
+    constexpr operator bool() {
+      return true;
+    }
+
+  private:
+    [[no_unique_address]] Fn m_fn;
+  };
+} // vkroots
+
+#undef VKROOTS_INLINE_ATTR
+#undef VKROOTS_FLATTEN_ATTR
+
+
+namespace vkroots::helpers {
+
+  template <typename Func>
+  inline void delimitStringView(std::string_view view, std::string_view delim, Func func) {
+    size_t pos = 0;
+    while ((pos = view.find(delim)) != std::string_view::npos) {
+      std::string_view token = view.substr(0, pos);
+      if (!func(token))
+        return;
+      view = view.substr(pos + 1);
+    }
+    func(view);
+  }
+
+  template <typename T, typename ArrType, typename Op>
+  inline VkResult array(ArrType& arr, uint32_t *pCount, T* pOut, Op func) {
+    const uint32_t count = uint32_t(arr.size());
+
+    if (!pOut) {
+      *pCount = count;
+      return VK_SUCCESS;
+    }
+
+    const uint32_t outCount = std::min(*pCount, count);
+    for (uint32_t i = 0; i < outCount; i++)
+      func(pOut[i], arr[i]);
+
+    *pCount = outCount;
+    return count != outCount
+      ? VK_INCOMPLETE
+      : VK_SUCCESS;
+  }
+
+  template <typename T, typename ArrType>
+  inline VkResult array(ArrType& arr, uint32_t *pCount, T* pOut) {
+    return array(arr, pCount, pOut, [](T& x, const T& y) { x = y; });
+  }
+
+  template <typename Func, typename OutArray, typename... Args>
+  uint32_t enumerate(Func function, OutArray& outArray, Args&&... arguments) {
+    uint32_t count = 0;
+    function(arguments..., &count, nullptr);
+
+    outArray.resize(count);
+    if (!count)
+        return 0;
+
+    function(std::forward<Args>(arguments)..., &count, outArray.data());
+    return count;
+  }
+
+  template <typename Func, typename InArray, typename OutType, typename... Args>
+  VkResult append(Func function, const InArray& inArray, uint32_t* pOutCount, OutType* pOut, Args&&... arguments) {
+    uint32_t baseCount = 0;
+    function(std::forward<Args>(arguments)..., &baseCount, nullptr);
+
+    const uint32_t totalCount = baseCount + uint32_t(inArray.size());
+    if (!pOut) {
+      *pOutCount = totalCount;
+      return VK_SUCCESS;
+    }
+
+    if (*pOutCount < totalCount) {
+      function(std::forward<Args>(arguments)..., pOutCount, pOut);
+      return VK_INCOMPLETE;
+    }
+
+    function(std::forward<Args>(arguments)..., &baseCount, pOut);
+    for (size_t i = 0; i < inArray.size(); i++)
+      pOut[baseCount + i] = inArray[i];
+    return VK_SUCCESS;
+  }
+
+  template <typename SearchType, VkStructureType StructureTypeEnum, typename ChainBaseType>
+  SearchType *chain(ChainBaseType* pNext) {
+    for (VkBaseOutStructure* pBaseOut = reinterpret_cast<VkBaseOutStructure*>(pNext); pBaseOut; pBaseOut = pBaseOut->pNext) {
+      if (pBaseOut->sType == StructureTypeEnum)
+        return reinterpret_cast<SearchType*>(pBaseOut);
+    }
+    return nullptr;
+  }
+
+  template <typename Key, typename Data>
+  class SynchronizedMapObject {
+  public:
+    using MapKey = Key;
+    using MapData = SynchronizedMapObject<Key, Data>;
+
+    SynchronizedMapObject(std::shared_ptr<Data> data)
+      : m_data{std::move(data)} {
+    }
+    SynchronizedMapObject(const SynchronizedMapObject<Key, Data>& other)
+      : m_data{other.m_data} {
+    }
+    SynchronizedMapObject(SynchronizedMapObject<Key, Data>&& other)
+      : m_data{std::move(other.m_data)} {
+    }
+    SynchronizedMapObject(std::nullptr_t) {
+    }
+
+    SynchronizedMapObject& operator = (std::nullptr_t) {
+      m_data = nullptr;
+      return *this;
+    }
+
+    SynchronizedMapObject& operator = (const SynchronizedMapObject& other) {
+      m_data = other.m_data;
+    }
+
+    SynchronizedMapObject& operator = (SynchronizedMapObject&& other) {
+      m_data = std::move(other.m_data);
+    }
+
+    static SynchronizedMapObject<Key, Data> get(const Key& key) {
+      std::unique_lock lock{ s_mutex };
+      auto iter = s_map.find(key);
+      if (iter == s_map.end())
+        return nullptr;
+      return iter->second;
+    }
+
+    static SynchronizedMapObject<Key, Data> create(const Key& key, Data data) {
+      std::unique_lock lock{ s_mutex };
+      auto val = s_map.emplace(
+        std::piecewise_construct,
+        std::forward_as_tuple(key),
+        std::forward_as_tuple(std::make_shared<Data>(std::move(data))));
+      return val.first->second;
+    }
+
+    static bool remove(const Key& key) {
+      std::unique_lock lock{ s_mutex };
+      auto iter = s_map.find(key);
+      if (iter == s_map.end())
+        return false;
+      s_map.erase(iter);
+      return true;
+    }
+
+    Data* get() {
+      return m_data.get();
+    }
+
+    const Data* get() const {
+      return m_data.get();
+    }
+
+    Data* operator->() {
+      return get();
+    }
+
+    const Data* operator->() const {
+      return get();
+    }
+
+    bool has() const {
+      return m_data != nullptr;
+    }
+
+    operator bool() const {
+      return has();
+    }
+
+  private:
+
+    std::shared_ptr<Data> m_data;
+
+    static std::mutex s_mutex;
+    static std::unordered_map<MapKey, MapData> s_map;
+  };
+
+#define VKROOTS_DEFINE_SYNCHRONIZED_MAP_TYPE(name, key) \
+  using name = ::vkroots::helpers::SynchronizedMapObject<key, name##Data>;
+
+#define VKROOTS_IMPLEMENT_SYNCHRONIZED_MAP_TYPE(x) \
+  template <> std::mutex x::s_mutex = {}; \
+  template <> std::unordered_map<x::MapKey, x::MapData> x::s_map = {};
+
+}
+
+namespace vkroots {
+#if VKROOTS_USE_CONSTEXPR_FUNC
+  #define VKROOTS_CHAINPATCHER_FUNC function_ref
+  #define VKROOTS_CHAINPATCHER_ATTR constexpr
+#else
+  #define VKROOTS_CHAINPATCHER_FUNC std::function
+  #define VKROOTS_CHAINPATCHER_ATTR
+#endif
+
+  template <typename Type, typename UserData = uint64_t>
+  class ChainPatcher {
+  public:
+    // Lambdas and other callables are called directly, without being type-erased.
+    template <typename AnyStruct, typename Fn> requires std::invocable<Fn&, UserData&, Type *>
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, Fn&& func) {
+      patch(obj, func);
+    }
+
+    template <typename AnyStruct, typename Fn> requires std::invocable<Fn&, Type *> && (!std::invocable<Fn&, UserData&, Type *>)
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, Fn&& func) {
+      patch(obj, [&func](UserData&, Type *obj) { return func(obj); });
+    }
+
+    template <typename AnyStruct>
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, VKROOTS_CHAINPATCHER_FUNC<bool(UserData&, Type *)> func) {
+      patch(obj, func);
+    }
+
+    template <typename AnyStruct>
+    VKROOTS_CHAINPATCHER_ATTR ChainPatcher(const AnyStruct * __restrict__ obj, VKROOTS_CHAINPATCHER_FUNC<bool(Type *)> func) {
+      patch(obj, [&func](UserData&, Type *obj) { return func(obj); });
+    }
+
+  private:
+    template <typename AnyStruct, typename Fn>
+    VKROOTS_CHAINPATCHER_ATTR void patch(const AnyStruct * __restrict__ obj, Fn&& func) {
+      const Type * __restrict__ type = vkroots::FindInChain<Type>(obj);
+      if (type) {
+        func(m_ctx, const_cast<Type *>(type));
+      } else {
+        if (func(m_ctx, &m_value)) {
+          AnyStruct *mutObj = const_cast<AnyStruct*>(obj);
+          m_value.sType = ResolveSType<Type>();
+          m_value.pNext = const_cast<void*>(std::exchange(mutObj->pNext, reinterpret_cast<const void*>(&m_value)));
+        }
+      }
+    }
+
+    Type m_value{};
+    UserData m_ctx;
+  };
+
+  // Finds or adds several structs in a pNext chain in one walk over it, with
+  // the added ones stored in the builder itself, eg.
+  //   vkroots::ChainBuilder<VkPhysicalDeviceVulkan12Features, VkPhysicalDeviceVulkan13Features> builder(pCreateInfo);
+  //   builder.get<VkPhysicalDeviceVulkan12Features>()->timelineSemaphore = VK_TRUE;
+  //   builder.get<VkPhysicalDeviceVulkan13Features>()->dynamicRendering = VK_TRUE;
+  //   return pDispatch->CreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+  // Structs that weren't in the chain are value-initialized and linked in
+  // after obj, whose original pNext is put back when the builder goes away.
+  template <typename... Types>
+  class ChainBuilder {
+  public:
+    static_assert(STypesAreUnique<Types...>(), "Each struct type can only be added once.");
+
+    template <typename AnyStruct>
+    ChainBuilder(const AnyStruct* obj) {
+      static_assert(TypeIsSinglePointer<decltype(obj)>());
+
+      size_t remaining = sizeof...(Types);
+      for (VkBaseOutStructure* header = reinterpret_cast<VkBaseOutStructure*>(const_cast<AnyStruct*>(obj))->pNext; header && remaining; header = header->pNext)
+        MatchInChain<Types...>(header, m_found, remaining, std::index_sequence_for<Types...>{});
+
+      if (remaining) {
+        m_pObj = reinterpret_cast<VkBaseOutStructure*>(const_cast<AnyStruct*>(obj));
+        m_pOriginalNext = m_pObj->pNext;
+        link(std::index_sequence_for<Types...>{});
+      }
+    }
+
+    ~ChainBuilder() {
+      if (m_pObj)
+        m_pObj->pNext = m_pOriginalNext;
+    }
+
+    ChainBuilder(const ChainBuilder&) = delete;
+    ChainBuilder& operator = (const ChainBuilder&) = delete;
+
+    template <typename Type>
+    Type* get() const {
+      return std::get<Type*>(m_found);
+    }
+
+    template <typename Type>
+    bool added() const {
+      return std::get<Type*>(m_found) == &std::get<Type>(m_values);
+    }
+
+  private:
+    template <size_t... Indices>
+    void link(std::index_sequence<Indices...>) {
+      auto add = [this]<size_t Index>(std::integral_constant<size_t, Index>) {
+        if (std::get<Index>(m_found))
+          return;
+        auto& value = std::get<Index>(m_values);
+        value.sType = ResolveSType<std::tuple_element_t<Index, std::tuple<Types...>>>();
+        value.pNext = std::exchange(m_pObj->pNext, reinterpret_cast<VkBaseOutStructure*>(&value));
+        std::get<Index>(m_found) = &value;
+      };
+      (add(std::integral_constant<size_t, Indices>{}), ...);
+    }
+
+    std::tuple<Types...> m_values{};
+    std::tuple<Types*...> m_found{};
+    VkBaseOutStructure* m_pObj = nullptr;
+    VkBaseOutStructure* m_pOriginalNext = nullptr;
+  };
+  
+  #undef VKROOTS_CHAINPATCHER_FUNC
+  #undef VKROOTS_CHAINPATCHER_ATTR
+}
@@ -0,0 +1,6628 @@
+// Part of vkroots.h, generated by gen/make_vkroots.
+
+#pragma once
+
+#include "wrappers.h"
+
+namespace vkroots {
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  constexpr bool IsInstanceFuncHooked(procaddr::InstanceFunc func) {
+    switch (func) {
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case procaddr::InstanceFunc::CreateAndroidSurfaceKHR: {
+        constexpr bool HasCreateAndroidSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateAndroidSurfaceKHR; };
+        return HasCreateAndroidSurfaceKHR;
+      }
+#endif
+      case procaddr::InstanceFunc::CreateDebugReportCallbackEXT: {
+        constexpr bool HasCreateDebugReportCallbackEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDebugReportCallbackEXT; };
+        return HasCreateDebugReportCallbackEXT;
+      }
+      case procaddr::InstanceFunc::CreateDebugUtilsMessengerEXT: {
+        constexpr bool HasCreateDebugUtilsMessengerEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDebugUtilsMessengerEXT; };
+        return HasCreateDebugUtilsMessengerEXT;
+      }
+      case procaddr::InstanceFunc::CreateDevice: {
+        constexpr bool HasCreateDevice = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDevice; };
+        return HasCreateDevice || !std::is_base_of<NoOverrides, DeviceOverrides>::value;
+      }
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      case procaddr::InstanceFunc::CreateDirectFBSurfaceEXT: {
+        constexpr bool HasCreateDirectFBSurfaceEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDirectFBSurfaceEXT; };
+        return HasCreateDirectFBSurfaceEXT;
+      }
+#endif
+      case procaddr::InstanceFunc::CreateDisplayModeKHR: {
+        constexpr bool HasCreateDisplayModeKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDisplayModeKHR; };
+        return HasCreateDisplayModeKHR;
+      }
+      case procaddr::InstanceFunc::CreateDisplayPlaneSurfaceKHR: {
+        constexpr bool HasCreateDisplayPlaneSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDisplayPlaneSurfaceKHR; };
+        return HasCreateDisplayPlaneSurfaceKHR;
+      }
+      case procaddr::InstanceFunc::CreateHeadlessSurfaceEXT: {
+        constexpr bool HasCreateHeadlessSurfaceEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateHeadlessSurfaceEXT; };
+        return HasCreateHeadlessSurfaceEXT;
+      }
+#ifdef VK_USE_PLATFORM_IOS_MVK
+      case procaddr::InstanceFunc::CreateIOSSurfaceMVK: {
+        constexpr bool HasCreateIOSSurfaceMVK = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateIOSSurfaceMVK; };
+        return HasCreateIOSSurfaceMVK;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::InstanceFunc::CreateImagePipeSurfaceFUCHSIA: {
+        constexpr bool HasCreateImagePipeSurfaceFUCHSIA = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateImagePipeSurfaceFUCHSIA; };
+        return HasCreateImagePipeSurfaceFUCHSIA;
+      }
+#endif
+      case procaddr::InstanceFunc::CreateInstance: {
+        return true;
+      }
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+      case procaddr::InstanceFunc::CreateMacOSSurfaceMVK: {
+        constexpr bool HasCreateMacOSSurfaceMVK = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateMacOSSurfaceMVK; };
+        return HasCreateMacOSSurfaceMVK;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case procaddr::InstanceFunc::CreateMetalSurfaceEXT: {
+        constexpr bool HasCreateMetalSurfaceEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateMetalSurfaceEXT; };
+        return HasCreateMetalSurfaceEXT;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      case procaddr::InstanceFunc::CreateScreenSurfaceQNX: {
+        constexpr bool HasCreateScreenSurfaceQNX = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateScreenSurfaceQNX; };
+        return HasCreateScreenSurfaceQNX;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_GGP
+      case procaddr::InstanceFunc::CreateStreamDescriptorSurfaceGGP: {
+        constexpr bool HasCreateStreamDescriptorSurfaceGGP = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateStreamDescriptorSurfaceGGP; };
+        return HasCreateStreamDescriptorSurfaceGGP;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+      case procaddr::InstanceFunc::CreateViSurfaceNN: {
+        constexpr bool HasCreateViSurfaceNN = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateViSurfaceNN; };
+        return HasCreateViSurfaceNN;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      case procaddr::InstanceFunc::CreateWaylandSurfaceKHR: {
+        constexpr bool HasCreateWaylandSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateWaylandSurfaceKHR; };
+        return HasCreateWaylandSurfaceKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::InstanceFunc::CreateWin32SurfaceKHR: {
+        constexpr bool HasCreateWin32SurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateWin32SurfaceKHR; };
+        return HasCreateWin32SurfaceKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      case procaddr::InstanceFunc::CreateXcbSurfaceKHR: {
+        constexpr bool HasCreateXcbSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateXcbSurfaceKHR; };
+        return HasCreateXcbSurfaceKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      case procaddr::InstanceFunc::CreateXlibSurfaceKHR: {
+        constexpr bool HasCreateXlibSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateXlibSurfaceKHR; };
+        return HasCreateXlibSurfaceKHR;
+      }
+#endif
+      case procaddr::InstanceFunc::DebugReportMessageEXT: {
+        constexpr bool HasDebugReportMessageEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::DebugReportMessageEXT; };
+        return HasDebugReportMessageEXT;
+      }
+      case procaddr::InstanceFunc::DestroyDebugReportCallbackEXT: {
+        constexpr bool HasDestroyDebugReportCallbackEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroyDebugReportCallbackEXT; };
+        return HasDestroyDebugReportCallbackEXT;
+      }
+      case procaddr::InstanceFunc::DestroyDebugUtilsMessengerEXT: {
+        constexpr bool HasDestroyDebugUtilsMessengerEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroyDebugUtilsMessengerEXT; };
+        return HasDestroyDebugUtilsMessengerEXT;
+      }
+      case procaddr::InstanceFunc::DestroyInstance: {
+        return true;
+      }
+      case procaddr::InstanceFunc::DestroySurfaceKHR: {
+        constexpr bool HasDestroySurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroySurfaceKHR; };
+        return HasDestroySurfaceKHR;
+      }
+      case procaddr::InstanceFunc::EnumerateDeviceExtensionProperties: {
+        constexpr bool HasEnumerateDeviceExtensionProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumerateDeviceExtensionProperties; };
+        return HasEnumerateDeviceExtensionProperties;
+      }
+      case procaddr::InstanceFunc::EnumerateDeviceLayerProperties: {
+        constexpr bool HasEnumerateDeviceLayerProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumerateDeviceLayerProperties; };
+        return HasEnumerateDeviceLayerProperties;
+      }
+      case procaddr::InstanceFunc::EnumeratePhysicalDeviceGroups: {
+        constexpr bool HasEnumeratePhysicalDeviceGroups = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumeratePhysicalDeviceGroups; };
+        return HasEnumeratePhysicalDeviceGroups;
+      }
+      case procaddr::InstanceFunc::EnumeratePhysicalDeviceGroupsKHR: {
+        constexpr bool HasEnumeratePhysicalDeviceGroupsKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumeratePhysicalDeviceGroupsKHR; };
+        return HasEnumeratePhysicalDeviceGroupsKHR;
+      }
+      case procaddr::InstanceFunc::EnumeratePhysicalDevices: {
+        constexpr bool HasEnumeratePhysicalDevices = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumeratePhysicalDevices; };
+        return HasEnumeratePhysicalDevices;
+      }
+      case procaddr::InstanceFunc::GetDisplayModePropertiesKHR: {
+        constexpr bool HasGetDisplayModePropertiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetDisplayModePropertiesKHR; };
+        return HasGetDisplayModePropertiesKHR;
+      }
+      case procaddr::InstanceFunc::GetDisplayPlaneCapabilitiesKHR: {
+        constexpr bool HasGetDisplayPlaneCapabilitiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetDisplayPlaneCapabilitiesKHR; };
+        return HasGetDisplayPlaneCapabilitiesKHR;
+      }
+      case procaddr::InstanceFunc::GetDisplayPlaneSupportedDisplaysKHR: {
+        constexpr bool HasGetDisplayPlaneSupportedDisplaysKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetDisplayPlaneSupportedDisplaysKHR; };
+        return HasGetDisplayPlaneSupportedDisplaysKHR;
+      }
+      case procaddr::InstanceFunc::GetInstanceProcAddr: {
+        return true;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceDisplayPlanePropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayPlanePropertiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceDisplayPlanePropertiesKHR; };
+        return HasGetPhysicalDeviceDisplayPlanePropertiesKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceDisplayPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayPropertiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceDisplayPropertiesKHR; };
+        return HasGetPhysicalDeviceDisplayPropertiesKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceExternalBufferProperties: {
+        constexpr bool HasGetPhysicalDeviceExternalBufferProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceExternalBufferProperties; };
+        return HasGetPhysicalDeviceExternalBufferProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceExternalFenceProperties: {
+        constexpr bool HasGetPhysicalDeviceExternalFenceProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceExternalFenceProperties; };
+        return HasGetPhysicalDeviceExternalFenceProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceExternalSemaphoreProperties: {
+        constexpr bool HasGetPhysicalDeviceExternalSemaphoreProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceExternalSemaphoreProperties; };
+        return HasGetPhysicalDeviceExternalSemaphoreProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFeatures: {
+        constexpr bool HasGetPhysicalDeviceFeatures = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFeatures; };
+        return HasGetPhysicalDeviceFeatures;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFeatures2: {
+        constexpr bool HasGetPhysicalDeviceFeatures2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFeatures2; };
+        return HasGetPhysicalDeviceFeatures2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFormatProperties: {
+        constexpr bool HasGetPhysicalDeviceFormatProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFormatProperties; };
+        return HasGetPhysicalDeviceFormatProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFormatProperties2: {
+        constexpr bool HasGetPhysicalDeviceFormatProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFormatProperties2; };
+        return HasGetPhysicalDeviceFormatProperties2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceImageFormatProperties: {
+        constexpr bool HasGetPhysicalDeviceImageFormatProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceImageFormatProperties; };
+        return HasGetPhysicalDeviceImageFormatProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceImageFormatProperties2: {
+        constexpr bool HasGetPhysicalDeviceImageFormatProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceImageFormatProperties2; };
+        return HasGetPhysicalDeviceImageFormatProperties2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceMemoryProperties: {
+        constexpr bool HasGetPhysicalDeviceMemoryProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceMemoryProperties; };
+        return HasGetPhysicalDeviceMemoryProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceMemoryProperties2: {
+        constexpr bool HasGetPhysicalDeviceMemoryProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceMemoryProperties2; };
+        return HasGetPhysicalDeviceMemoryProperties2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDevicePresentRectanglesKHR: {
+        constexpr bool HasGetPhysicalDevicePresentRectanglesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDevicePresentRectanglesKHR; };
+        return HasGetPhysicalDevicePresentRectanglesKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceProperties: {
+        constexpr bool HasGetPhysicalDeviceProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceProperties; };
+        return HasGetPhysicalDeviceProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceProperties2: {
+        constexpr bool HasGetPhysicalDeviceProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceProperties2; };
+        return HasGetPhysicalDeviceProperties2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceQueueFamilyProperties: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceQueueFamilyProperties; };
+        return HasGetPhysicalDeviceQueueFamilyProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceQueueFamilyProperties2: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceQueueFamilyProperties2; };
+        return HasGetPhysicalDeviceQueueFamilyProperties2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSparseImageFormatProperties: {
+        constexpr bool HasGetPhysicalDeviceSparseImageFormatProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSparseImageFormatProperties; };
+        return HasGetPhysicalDeviceSparseImageFormatProperties;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSparseImageFormatProperties2: {
+        constexpr bool HasGetPhysicalDeviceSparseImageFormatProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSparseImageFormatProperties2; };
+        return HasGetPhysicalDeviceSparseImageFormatProperties2;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceCapabilities2KHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceCapabilities2KHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceCapabilities2KHR; };
+        return HasGetPhysicalDeviceSurfaceCapabilities2KHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceCapabilitiesKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceCapabilitiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceCapabilitiesKHR; };
+        return HasGetPhysicalDeviceSurfaceCapabilitiesKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceFormats2KHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceFormats2KHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceFormats2KHR; };
+        return HasGetPhysicalDeviceSurfaceFormats2KHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceFormatsKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceFormatsKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceFormatsKHR; };
+        return HasGetPhysicalDeviceSurfaceFormatsKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfacePresentModesKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfacePresentModesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfacePresentModesKHR; };
+        return HasGetPhysicalDeviceSurfacePresentModesKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceSupportKHR; };
+        return HasGetPhysicalDeviceSurfaceSupportKHR;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceToolProperties: {
+        constexpr bool HasGetPhysicalDeviceToolProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceToolProperties; };
+        return HasGetPhysicalDeviceToolProperties;
+      }
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceWaylandPresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceWaylandPresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceWaylandPresentationSupportKHR; };
+        return HasGetPhysicalDeviceWaylandPresentationSupportKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceWin32PresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceWin32PresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceWin32PresentationSupportKHR; };
+        return HasGetPhysicalDeviceWin32PresentationSupportKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceXcbPresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceXcbPresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceXcbPresentationSupportKHR; };
+        return HasGetPhysicalDeviceXcbPresentationSupportKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceXlibPresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceXlibPresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceXlibPresentationSupportKHR; };
+        return HasGetPhysicalDeviceXlibPresentationSupportKHR;
+      }
+#endif
+      case procaddr::InstanceFunc::SubmitDebugUtilsMessageEXT: {
+        constexpr bool HasSubmitDebugUtilsMessageEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::SubmitDebugUtilsMessageEXT; };
+        return HasSubmitDebugUtilsMessageEXT;
+      }
+      default:
+        return false;
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  PFN_vkVoidFunction GetInstanceProcAddr(VkInstance instance, const char* name) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    using HookedFuncs = procaddr::HookedFuncTable<procaddr::InstanceFuncNames, &IsInstanceFuncHooked<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>>;
+    switch (HookedFuncs::Find(name)) {
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case procaddr::InstanceFunc::CreateAndroidSurfaceKHR: {
+        constexpr bool HasCreateAndroidSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateAndroidSurfaceKHR; };
+        if constexpr (HasCreateAndroidSurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateAndroidSurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::InstanceFunc::CreateDebugReportCallbackEXT: {
+        constexpr bool HasCreateDebugReportCallbackEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDebugReportCallbackEXT; };
+        if constexpr (HasCreateDebugReportCallbackEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateDebugReportCallbackEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::CreateDebugUtilsMessengerEXT: {
+        constexpr bool HasCreateDebugUtilsMessengerEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDebugUtilsMessengerEXT; };
+        if constexpr (HasCreateDebugUtilsMessengerEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateDebugUtilsMessengerEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::CreateDevice: {
+        constexpr bool HasCreateDevice = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDevice; };
+        if constexpr (HasCreateDevice)
+          return (PFN_vkVoidFunction) &wrap_CreateDevice<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else if constexpr (!std::is_base_of<NoOverrides, DeviceOverrides>::value)
+          return (PFN_vkVoidFunction) &implicit_wrap_CreateDevice<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      case procaddr::InstanceFunc::CreateDirectFBSurfaceEXT: {
+        constexpr bool HasCreateDirectFBSurfaceEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDirectFBSurfaceEXT; };
+        if constexpr (HasCreateDirectFBSurfaceEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateDirectFBSurfaceEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::InstanceFunc::CreateDisplayModeKHR: {
+        constexpr bool HasCreateDisplayModeKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDisplayModeKHR; };
+        if constexpr (HasCreateDisplayModeKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateDisplayModeKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::CreateDisplayPlaneSurfaceKHR: {
+        constexpr bool HasCreateDisplayPlaneSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateDisplayPlaneSurfaceKHR; };
+        if constexpr (HasCreateDisplayPlaneSurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateDisplayPlaneSurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::CreateHeadlessSurfaceEXT: {
+        constexpr bool HasCreateHeadlessSurfaceEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateHeadlessSurfaceEXT; };
+        if constexpr (HasCreateHeadlessSurfaceEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateHeadlessSurfaceEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_IOS_MVK
+      case procaddr::InstanceFunc::CreateIOSSurfaceMVK: {
+        constexpr bool HasCreateIOSSurfaceMVK = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateIOSSurfaceMVK; };
+        if constexpr (HasCreateIOSSurfaceMVK)
+          return (PFN_vkVoidFunction) &wrap_CreateIOSSurfaceMVK<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::InstanceFunc::CreateImagePipeSurfaceFUCHSIA: {
+        constexpr bool HasCreateImagePipeSurfaceFUCHSIA = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateImagePipeSurfaceFUCHSIA; };
+        if constexpr (HasCreateImagePipeSurfaceFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_CreateImagePipeSurfaceFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::InstanceFunc::CreateInstance: {
+        constexpr bool HasCreateInstance = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateInstance; };
+        if constexpr (HasCreateInstance)
+          return (PFN_vkVoidFunction) &wrap_CreateInstance<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else
+          return (PFN_vkVoidFunction) &implicit_wrap_CreateInstance<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+      case procaddr::InstanceFunc::CreateMacOSSurfaceMVK: {
+        constexpr bool HasCreateMacOSSurfaceMVK = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateMacOSSurfaceMVK; };
+        if constexpr (HasCreateMacOSSurfaceMVK)
+          return (PFN_vkVoidFunction) &wrap_CreateMacOSSurfaceMVK<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case procaddr::InstanceFunc::CreateMetalSurfaceEXT: {
+        constexpr bool HasCreateMetalSurfaceEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateMetalSurfaceEXT; };
+        if constexpr (HasCreateMetalSurfaceEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateMetalSurfaceEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      case procaddr::InstanceFunc::CreateScreenSurfaceQNX: {
+        constexpr bool HasCreateScreenSurfaceQNX = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateScreenSurfaceQNX; };
+        if constexpr (HasCreateScreenSurfaceQNX)
+          return (PFN_vkVoidFunction) &wrap_CreateScreenSurfaceQNX<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_GGP
+      case procaddr::InstanceFunc::CreateStreamDescriptorSurfaceGGP: {
+        constexpr bool HasCreateStreamDescriptorSurfaceGGP = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateStreamDescriptorSurfaceGGP; };
+        if constexpr (HasCreateStreamDescriptorSurfaceGGP)
+          return (PFN_vkVoidFunction) &wrap_CreateStreamDescriptorSurfaceGGP<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+      case procaddr::InstanceFunc::CreateViSurfaceNN: {
+        constexpr bool HasCreateViSurfaceNN = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateViSurfaceNN; };
+        if constexpr (HasCreateViSurfaceNN)
+          return (PFN_vkVoidFunction) &wrap_CreateViSurfaceNN<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      case procaddr::InstanceFunc::CreateWaylandSurfaceKHR: {
+        constexpr bool HasCreateWaylandSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateWaylandSurfaceKHR; };
+        if constexpr (HasCreateWaylandSurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateWaylandSurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::InstanceFunc::CreateWin32SurfaceKHR: {
+        constexpr bool HasCreateWin32SurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateWin32SurfaceKHR; };
+        if constexpr (HasCreateWin32SurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateWin32SurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      case procaddr::InstanceFunc::CreateXcbSurfaceKHR: {
+        constexpr bool HasCreateXcbSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateXcbSurfaceKHR; };
+        if constexpr (HasCreateXcbSurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateXcbSurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      case procaddr::InstanceFunc::CreateXlibSurfaceKHR: {
+        constexpr bool HasCreateXlibSurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::CreateXlibSurfaceKHR; };
+        if constexpr (HasCreateXlibSurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateXlibSurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::InstanceFunc::DebugReportMessageEXT: {
+        constexpr bool HasDebugReportMessageEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::DebugReportMessageEXT; };
+        if constexpr (HasDebugReportMessageEXT)
+          return (PFN_vkVoidFunction) &wrap_DebugReportMessageEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::DestroyDebugReportCallbackEXT: {
+        constexpr bool HasDestroyDebugReportCallbackEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroyDebugReportCallbackEXT; };
+        if constexpr (HasDestroyDebugReportCallbackEXT)
+          return (PFN_vkVoidFunction) &wrap_DestroyDebugReportCallbackEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::DestroyDebugUtilsMessengerEXT: {
+        constexpr bool HasDestroyDebugUtilsMessengerEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroyDebugUtilsMessengerEXT; };
+        if constexpr (HasDestroyDebugUtilsMessengerEXT)
+          return (PFN_vkVoidFunction) &wrap_DestroyDebugUtilsMessengerEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::DestroyInstance: {
+        constexpr bool HasDestroyInstance = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroyInstance; };
+        if constexpr (HasDestroyInstance)
+          return (PFN_vkVoidFunction) &wrap_DestroyInstance<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else
+          return (PFN_vkVoidFunction) &implicit_wrap_DestroyInstance<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::DestroySurfaceKHR: {
+        constexpr bool HasDestroySurfaceKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::DestroySurfaceKHR; };
+        if constexpr (HasDestroySurfaceKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroySurfaceKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::EnumerateDeviceExtensionProperties: {
+        constexpr bool HasEnumerateDeviceExtensionProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumerateDeviceExtensionProperties; };
+        if constexpr (HasEnumerateDeviceExtensionProperties)
+          return (PFN_vkVoidFunction) &wrap_EnumerateDeviceExtensionProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::EnumerateDeviceLayerProperties: {
+        constexpr bool HasEnumerateDeviceLayerProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumerateDeviceLayerProperties; };
+        if constexpr (HasEnumerateDeviceLayerProperties)
+          return (PFN_vkVoidFunction) &wrap_EnumerateDeviceLayerProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::EnumeratePhysicalDeviceGroups: {
+        constexpr bool HasEnumeratePhysicalDeviceGroups = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumeratePhysicalDeviceGroups; };
+        if constexpr (HasEnumeratePhysicalDeviceGroups)
+          return (PFN_vkVoidFunction) &wrap_EnumeratePhysicalDeviceGroups<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::EnumeratePhysicalDeviceGroupsKHR: {
+        constexpr bool HasEnumeratePhysicalDeviceGroupsKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumeratePhysicalDeviceGroupsKHR; };
+        if constexpr (HasEnumeratePhysicalDeviceGroupsKHR)
+          return (PFN_vkVoidFunction) &wrap_EnumeratePhysicalDeviceGroupsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::EnumeratePhysicalDevices: {
+        constexpr bool HasEnumeratePhysicalDevices = requires(const InstanceOverrides& t) { &InstanceOverrides::EnumeratePhysicalDevices; };
+        if constexpr (HasEnumeratePhysicalDevices)
+          return (PFN_vkVoidFunction) &wrap_EnumeratePhysicalDevices<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetDisplayModePropertiesKHR: {
+        constexpr bool HasGetDisplayModePropertiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetDisplayModePropertiesKHR; };
+        if constexpr (HasGetDisplayModePropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDisplayModePropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetDisplayPlaneCapabilitiesKHR: {
+        constexpr bool HasGetDisplayPlaneCapabilitiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetDisplayPlaneCapabilitiesKHR; };
+        if constexpr (HasGetDisplayPlaneCapabilitiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDisplayPlaneCapabilitiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetDisplayPlaneSupportedDisplaysKHR: {
+        constexpr bool HasGetDisplayPlaneSupportedDisplaysKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetDisplayPlaneSupportedDisplaysKHR; };
+        if constexpr (HasGetDisplayPlaneSupportedDisplaysKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDisplayPlaneSupportedDisplaysKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetInstanceProcAddr: {
+        return (PFN_vkVoidFunction) &GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceDisplayPlanePropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayPlanePropertiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceDisplayPlanePropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceDisplayPlanePropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceDisplayPlanePropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceDisplayPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayPropertiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceDisplayPropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceDisplayPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceDisplayPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceExternalBufferProperties: {
+        constexpr bool HasGetPhysicalDeviceExternalBufferProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceExternalBufferProperties; };
+        if constexpr (HasGetPhysicalDeviceExternalBufferProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalBufferProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceExternalFenceProperties: {
+        constexpr bool HasGetPhysicalDeviceExternalFenceProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceExternalFenceProperties; };
+        if constexpr (HasGetPhysicalDeviceExternalFenceProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalFenceProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceExternalSemaphoreProperties: {
+        constexpr bool HasGetPhysicalDeviceExternalSemaphoreProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceExternalSemaphoreProperties; };
+        if constexpr (HasGetPhysicalDeviceExternalSemaphoreProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalSemaphoreProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFeatures: {
+        constexpr bool HasGetPhysicalDeviceFeatures = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFeatures; };
+        if constexpr (HasGetPhysicalDeviceFeatures)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFeatures<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFeatures2: {
+        constexpr bool HasGetPhysicalDeviceFeatures2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFeatures2; };
+        if constexpr (HasGetPhysicalDeviceFeatures2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFeatures2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFormatProperties: {
+        constexpr bool HasGetPhysicalDeviceFormatProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFormatProperties; };
+        if constexpr (HasGetPhysicalDeviceFormatProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFormatProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceFormatProperties2: {
+        constexpr bool HasGetPhysicalDeviceFormatProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceFormatProperties2; };
+        if constexpr (HasGetPhysicalDeviceFormatProperties2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFormatProperties2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceImageFormatProperties: {
+        constexpr bool HasGetPhysicalDeviceImageFormatProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceImageFormatProperties; };
+        if constexpr (HasGetPhysicalDeviceImageFormatProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceImageFormatProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceImageFormatProperties2: {
+        constexpr bool HasGetPhysicalDeviceImageFormatProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceImageFormatProperties2; };
+        if constexpr (HasGetPhysicalDeviceImageFormatProperties2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceImageFormatProperties2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceMemoryProperties: {
+        constexpr bool HasGetPhysicalDeviceMemoryProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceMemoryProperties; };
+        if constexpr (HasGetPhysicalDeviceMemoryProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceMemoryProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceMemoryProperties2: {
+        constexpr bool HasGetPhysicalDeviceMemoryProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceMemoryProperties2; };
+        if constexpr (HasGetPhysicalDeviceMemoryProperties2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceMemoryProperties2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDevicePresentRectanglesKHR: {
+        constexpr bool HasGetPhysicalDevicePresentRectanglesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDevicePresentRectanglesKHR; };
+        if constexpr (HasGetPhysicalDevicePresentRectanglesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDevicePresentRectanglesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceProperties: {
+        constexpr bool HasGetPhysicalDeviceProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceProperties; };
+        if constexpr (HasGetPhysicalDeviceProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceProperties2: {
+        constexpr bool HasGetPhysicalDeviceProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceProperties2; };
+        if constexpr (HasGetPhysicalDeviceProperties2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceProperties2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceQueueFamilyProperties: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceQueueFamilyProperties; };
+        if constexpr (HasGetPhysicalDeviceQueueFamilyProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceQueueFamilyProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceQueueFamilyProperties2: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceQueueFamilyProperties2; };
+        if constexpr (HasGetPhysicalDeviceQueueFamilyProperties2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceQueueFamilyProperties2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSparseImageFormatProperties: {
+        constexpr bool HasGetPhysicalDeviceSparseImageFormatProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSparseImageFormatProperties; };
+        if constexpr (HasGetPhysicalDeviceSparseImageFormatProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSparseImageFormatProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSparseImageFormatProperties2: {
+        constexpr bool HasGetPhysicalDeviceSparseImageFormatProperties2 = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSparseImageFormatProperties2; };
+        if constexpr (HasGetPhysicalDeviceSparseImageFormatProperties2)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSparseImageFormatProperties2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceCapabilities2KHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceCapabilities2KHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceCapabilities2KHR; };
+        if constexpr (HasGetPhysicalDeviceSurfaceCapabilities2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfaceCapabilities2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceCapabilitiesKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceCapabilitiesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceCapabilitiesKHR; };
+        if constexpr (HasGetPhysicalDeviceSurfaceCapabilitiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfaceCapabilitiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceFormats2KHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceFormats2KHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceFormats2KHR; };
+        if constexpr (HasGetPhysicalDeviceSurfaceFormats2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfaceFormats2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceFormatsKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceFormatsKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceFormatsKHR; };
+        if constexpr (HasGetPhysicalDeviceSurfaceFormatsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfaceFormatsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfacePresentModesKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfacePresentModesKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfacePresentModesKHR; };
+        if constexpr (HasGetPhysicalDeviceSurfacePresentModesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfacePresentModesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceSurfaceSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceSurfaceSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceSurfaceSupportKHR; };
+        if constexpr (HasGetPhysicalDeviceSurfaceSupportKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfaceSupportKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::InstanceFunc::GetPhysicalDeviceToolProperties: {
+        constexpr bool HasGetPhysicalDeviceToolProperties = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceToolProperties; };
+        if constexpr (HasGetPhysicalDeviceToolProperties)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceToolProperties<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceWaylandPresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceWaylandPresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceWaylandPresentationSupportKHR; };
+        if constexpr (HasGetPhysicalDeviceWaylandPresentationSupportKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceWaylandPresentationSupportKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceWin32PresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceWin32PresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceWin32PresentationSupportKHR; };
+        if constexpr (HasGetPhysicalDeviceWin32PresentationSupportKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceWin32PresentationSupportKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceXcbPresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceXcbPresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceXcbPresentationSupportKHR; };
+        if constexpr (HasGetPhysicalDeviceXcbPresentationSupportKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceXcbPresentationSupportKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      case procaddr::InstanceFunc::GetPhysicalDeviceXlibPresentationSupportKHR: {
+        constexpr bool HasGetPhysicalDeviceXlibPresentationSupportKHR = requires(const InstanceOverrides& t) { &InstanceOverrides::GetPhysicalDeviceXlibPresentationSupportKHR; };
+        if constexpr (HasGetPhysicalDeviceXlibPresentationSupportKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceXlibPresentationSupportKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::InstanceFunc::SubmitDebugUtilsMessageEXT: {
+        constexpr bool HasSubmitDebugUtilsMessageEXT = requires(const InstanceOverrides& t) { &InstanceOverrides::SubmitDebugUtilsMessageEXT; };
+        if constexpr (HasSubmitDebugUtilsMessageEXT)
+          return (PFN_vkVoidFunction) &wrap_SubmitDebugUtilsMessageEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      default:
+        break;
+    }
+
+    if (dispatch)
+      return dispatch->GetInstanceProcAddr(instance, name);
+    else
+      return NULL;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  constexpr bool IsPhysicalDeviceFuncHooked(procaddr::PhysicalDeviceFunc func) {
+    switch (func) {
+      case procaddr::PhysicalDeviceFunc::AcquireDrmDisplayEXT: {
+        constexpr bool HasAcquireDrmDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::AcquireDrmDisplayEXT; };
+        return HasAcquireDrmDisplayEXT;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::PhysicalDeviceFunc::AcquireWinrtDisplayNV: {
+        constexpr bool HasAcquireWinrtDisplayNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::AcquireWinrtDisplayNV; };
+        return HasAcquireWinrtDisplayNV;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+      case procaddr::PhysicalDeviceFunc::AcquireXlibDisplayEXT: {
+        constexpr bool HasAcquireXlibDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::AcquireXlibDisplayEXT; };
+        return HasAcquireXlibDisplayEXT;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR: {
+        constexpr bool HasEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR; };
+        return HasEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetDisplayModeProperties2KHR: {
+        constexpr bool HasGetDisplayModeProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetDisplayModeProperties2KHR; };
+        return HasGetDisplayModeProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetDisplayPlaneCapabilities2KHR: {
+        constexpr bool HasGetDisplayPlaneCapabilities2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetDisplayPlaneCapabilities2KHR; };
+        return HasGetDisplayPlaneCapabilities2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetDrmDisplayEXT: {
+        constexpr bool HasGetDrmDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetDrmDisplayEXT; };
+        return HasGetDrmDisplayEXT;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceCalibrateableTimeDomainsEXT: {
+        constexpr bool HasGetPhysicalDeviceCalibrateableTimeDomainsEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceCalibrateableTimeDomainsEXT; };
+        return HasGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceCooperativeMatrixPropertiesNV: {
+        constexpr bool HasGetPhysicalDeviceCooperativeMatrixPropertiesNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceCooperativeMatrixPropertiesNV; };
+        return HasGetPhysicalDeviceCooperativeMatrixPropertiesNV;
+      }
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceDirectFBPresentationSupportEXT: {
+        constexpr bool HasGetPhysicalDeviceDirectFBPresentationSupportEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceDirectFBPresentationSupportEXT; };
+        return HasGetPhysicalDeviceDirectFBPresentationSupportEXT;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceDisplayPlaneProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayPlaneProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceDisplayPlaneProperties2KHR; };
+        return HasGetPhysicalDeviceDisplayPlaneProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceDisplayProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceDisplayProperties2KHR; };
+        return HasGetPhysicalDeviceDisplayProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalBufferPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceExternalBufferPropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalBufferPropertiesKHR; };
+        return HasGetPhysicalDeviceExternalBufferPropertiesKHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalFencePropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceExternalFencePropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalFencePropertiesKHR; };
+        return HasGetPhysicalDeviceExternalFencePropertiesKHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalImageFormatPropertiesNV: {
+        constexpr bool HasGetPhysicalDeviceExternalImageFormatPropertiesNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalImageFormatPropertiesNV; };
+        return HasGetPhysicalDeviceExternalImageFormatPropertiesNV;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalSemaphorePropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceExternalSemaphorePropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalSemaphorePropertiesKHR; };
+        return HasGetPhysicalDeviceExternalSemaphorePropertiesKHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceFeatures2KHR: {
+        constexpr bool HasGetPhysicalDeviceFeatures2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceFeatures2KHR; };
+        return HasGetPhysicalDeviceFeatures2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceFormatProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceFormatProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceFormatProperties2KHR; };
+        return HasGetPhysicalDeviceFormatProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceFragmentShadingRatesKHR: {
+        constexpr bool HasGetPhysicalDeviceFragmentShadingRatesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceFragmentShadingRatesKHR; };
+        return HasGetPhysicalDeviceFragmentShadingRatesKHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceImageFormatProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceImageFormatProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceImageFormatProperties2KHR; };
+        return HasGetPhysicalDeviceImageFormatProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceMemoryProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceMemoryProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceMemoryProperties2KHR; };
+        return HasGetPhysicalDeviceMemoryProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceMultisamplePropertiesEXT: {
+        constexpr bool HasGetPhysicalDeviceMultisamplePropertiesEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceMultisamplePropertiesEXT; };
+        return HasGetPhysicalDeviceMultisamplePropertiesEXT;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceOpticalFlowImageFormatsNV: {
+        constexpr bool HasGetPhysicalDeviceOpticalFlowImageFormatsNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceOpticalFlowImageFormatsNV; };
+        return HasGetPhysicalDeviceOpticalFlowImageFormatsNV;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceProperties2KHR; };
+        return HasGetPhysicalDeviceProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR; };
+        return HasGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceQueueFamilyProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceQueueFamilyProperties2KHR; };
+        return HasGetPhysicalDeviceQueueFamilyProperties2KHR;
+      }
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceScreenPresentationSupportQNX: {
+        constexpr bool HasGetPhysicalDeviceScreenPresentationSupportQNX = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceScreenPresentationSupportQNX; };
+        return HasGetPhysicalDeviceScreenPresentationSupportQNX;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSparseImageFormatProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceSparseImageFormatProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSparseImageFormatProperties2KHR; };
+        return HasGetPhysicalDeviceSparseImageFormatProperties2KHR;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV: {
+        constexpr bool HasGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV; };
+        return HasGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSurfaceCapabilities2EXT: {
+        constexpr bool HasGetPhysicalDeviceSurfaceCapabilities2EXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSurfaceCapabilities2EXT; };
+        return HasGetPhysicalDeviceSurfaceCapabilities2EXT;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSurfacePresentModes2EXT: {
+        constexpr bool HasGetPhysicalDeviceSurfacePresentModes2EXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSurfacePresentModes2EXT; };
+        return HasGetPhysicalDeviceSurfacePresentModes2EXT;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceToolPropertiesEXT: {
+        constexpr bool HasGetPhysicalDeviceToolPropertiesEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceToolPropertiesEXT; };
+        return HasGetPhysicalDeviceToolPropertiesEXT;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceVideoCapabilitiesKHR: {
+        constexpr bool HasGetPhysicalDeviceVideoCapabilitiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceVideoCapabilitiesKHR; };
+        return HasGetPhysicalDeviceVideoCapabilitiesKHR;
+      }
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR; };
+        return HasGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceVideoFormatPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceVideoFormatPropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceVideoFormatPropertiesKHR; };
+        return HasGetPhysicalDeviceVideoFormatPropertiesKHR;
+      }
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+      case procaddr::PhysicalDeviceFunc::GetRandROutputDisplayEXT: {
+        constexpr bool HasGetRandROutputDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetRandROutputDisplayEXT; };
+        return HasGetRandROutputDisplayEXT;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::PhysicalDeviceFunc::GetWinrtDisplayNV: {
+        constexpr bool HasGetWinrtDisplayNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetWinrtDisplayNV; };
+        return HasGetWinrtDisplayNV;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::ReleaseDisplayEXT: {
+        constexpr bool HasReleaseDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::ReleaseDisplayEXT; };
+        return HasReleaseDisplayEXT;
+      }
+      case procaddr::PhysicalDeviceFunc::layerGetPhysicalDeviceProcAddr: {
+        return !std::is_base_of<NoOverrides, PhysicalDeviceOverrides>::value || !std::is_base_of<NoOverrides, DeviceOverrides>::value;
+      }
+      default:
+        return false;
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  PFN_vkVoidFunction GetPhysicalDeviceProcAddr(VkInstance instance, const char* name) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(instance);
+    using HookedFuncs = procaddr::HookedFuncTable<procaddr::PhysicalDeviceFuncNames, &IsPhysicalDeviceFuncHooked<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>>;
+    switch (HookedFuncs::Find(name)) {
+      case procaddr::PhysicalDeviceFunc::AcquireDrmDisplayEXT: {
+        constexpr bool HasAcquireDrmDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::AcquireDrmDisplayEXT; };
+        if constexpr (HasAcquireDrmDisplayEXT)
+          return (PFN_vkVoidFunction) &wrap_AcquireDrmDisplayEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::PhysicalDeviceFunc::AcquireWinrtDisplayNV: {
+        constexpr bool HasAcquireWinrtDisplayNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::AcquireWinrtDisplayNV; };
+        if constexpr (HasAcquireWinrtDisplayNV)
+          return (PFN_vkVoidFunction) &wrap_AcquireWinrtDisplayNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+      case procaddr::PhysicalDeviceFunc::AcquireXlibDisplayEXT: {
+        constexpr bool HasAcquireXlibDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::AcquireXlibDisplayEXT; };
+        if constexpr (HasAcquireXlibDisplayEXT)
+          return (PFN_vkVoidFunction) &wrap_AcquireXlibDisplayEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR: {
+        constexpr bool HasEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR; };
+        if constexpr (HasEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR)
+          return (PFN_vkVoidFunction) &wrap_EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetDisplayModeProperties2KHR: {
+        constexpr bool HasGetDisplayModeProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetDisplayModeProperties2KHR; };
+        if constexpr (HasGetDisplayModeProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetDisplayModeProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetDisplayPlaneCapabilities2KHR: {
+        constexpr bool HasGetDisplayPlaneCapabilities2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetDisplayPlaneCapabilities2KHR; };
+        if constexpr (HasGetDisplayPlaneCapabilities2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetDisplayPlaneCapabilities2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetDrmDisplayEXT: {
+        constexpr bool HasGetDrmDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetDrmDisplayEXT; };
+        if constexpr (HasGetDrmDisplayEXT)
+          return (PFN_vkVoidFunction) &wrap_GetDrmDisplayEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceCalibrateableTimeDomainsEXT: {
+        constexpr bool HasGetPhysicalDeviceCalibrateableTimeDomainsEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceCalibrateableTimeDomainsEXT; };
+        if constexpr (HasGetPhysicalDeviceCalibrateableTimeDomainsEXT)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceCalibrateableTimeDomainsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceCooperativeMatrixPropertiesNV: {
+        constexpr bool HasGetPhysicalDeviceCooperativeMatrixPropertiesNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceCooperativeMatrixPropertiesNV; };
+        if constexpr (HasGetPhysicalDeviceCooperativeMatrixPropertiesNV)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceCooperativeMatrixPropertiesNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceDirectFBPresentationSupportEXT: {
+        constexpr bool HasGetPhysicalDeviceDirectFBPresentationSupportEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceDirectFBPresentationSupportEXT; };
+        if constexpr (HasGetPhysicalDeviceDirectFBPresentationSupportEXT)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceDirectFBPresentationSupportEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceDisplayPlaneProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayPlaneProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceDisplayPlaneProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceDisplayPlaneProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceDisplayPlaneProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceDisplayProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceDisplayProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceDisplayProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceDisplayProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceDisplayProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalBufferPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceExternalBufferPropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalBufferPropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceExternalBufferPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalBufferPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalFencePropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceExternalFencePropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalFencePropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceExternalFencePropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalFencePropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalImageFormatPropertiesNV: {
+        constexpr bool HasGetPhysicalDeviceExternalImageFormatPropertiesNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalImageFormatPropertiesNV; };
+        if constexpr (HasGetPhysicalDeviceExternalImageFormatPropertiesNV)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalImageFormatPropertiesNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceExternalSemaphorePropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceExternalSemaphorePropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceExternalSemaphorePropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceExternalSemaphorePropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceExternalSemaphorePropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceFeatures2KHR: {
+        constexpr bool HasGetPhysicalDeviceFeatures2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceFeatures2KHR; };
+        if constexpr (HasGetPhysicalDeviceFeatures2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFeatures2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceFormatProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceFormatProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceFormatProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceFormatProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFormatProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceFragmentShadingRatesKHR: {
+        constexpr bool HasGetPhysicalDeviceFragmentShadingRatesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceFragmentShadingRatesKHR; };
+        if constexpr (HasGetPhysicalDeviceFragmentShadingRatesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceFragmentShadingRatesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceImageFormatProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceImageFormatProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceImageFormatProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceImageFormatProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceImageFormatProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceMemoryProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceMemoryProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceMemoryProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceMemoryProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceMemoryProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceMultisamplePropertiesEXT: {
+        constexpr bool HasGetPhysicalDeviceMultisamplePropertiesEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceMultisamplePropertiesEXT; };
+        if constexpr (HasGetPhysicalDeviceMultisamplePropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceMultisamplePropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceOpticalFlowImageFormatsNV: {
+        constexpr bool HasGetPhysicalDeviceOpticalFlowImageFormatsNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceOpticalFlowImageFormatsNV; };
+        if constexpr (HasGetPhysicalDeviceOpticalFlowImageFormatsNV)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceOpticalFlowImageFormatsNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR; };
+        if constexpr (HasGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceQueueFamilyProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceQueueFamilyProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceQueueFamilyProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceQueueFamilyProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceQueueFamilyProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceScreenPresentationSupportQNX: {
+        constexpr bool HasGetPhysicalDeviceScreenPresentationSupportQNX = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceScreenPresentationSupportQNX; };
+        if constexpr (HasGetPhysicalDeviceScreenPresentationSupportQNX)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceScreenPresentationSupportQNX<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSparseImageFormatProperties2KHR: {
+        constexpr bool HasGetPhysicalDeviceSparseImageFormatProperties2KHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSparseImageFormatProperties2KHR; };
+        if constexpr (HasGetPhysicalDeviceSparseImageFormatProperties2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSparseImageFormatProperties2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV: {
+        constexpr bool HasGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV; };
+        if constexpr (HasGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSurfaceCapabilities2EXT: {
+        constexpr bool HasGetPhysicalDeviceSurfaceCapabilities2EXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSurfaceCapabilities2EXT; };
+        if constexpr (HasGetPhysicalDeviceSurfaceCapabilities2EXT)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfaceCapabilities2EXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceSurfacePresentModes2EXT: {
+        constexpr bool HasGetPhysicalDeviceSurfacePresentModes2EXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceSurfacePresentModes2EXT; };
+        if constexpr (HasGetPhysicalDeviceSurfacePresentModes2EXT)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceSurfacePresentModes2EXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceToolPropertiesEXT: {
+        constexpr bool HasGetPhysicalDeviceToolPropertiesEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceToolPropertiesEXT; };
+        if constexpr (HasGetPhysicalDeviceToolPropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceToolPropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceVideoCapabilitiesKHR: {
+        constexpr bool HasGetPhysicalDeviceVideoCapabilitiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceVideoCapabilitiesKHR; };
+        if constexpr (HasGetPhysicalDeviceVideoCapabilitiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceVideoCapabilitiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::GetPhysicalDeviceVideoFormatPropertiesKHR: {
+        constexpr bool HasGetPhysicalDeviceVideoFormatPropertiesKHR = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetPhysicalDeviceVideoFormatPropertiesKHR; };
+        if constexpr (HasGetPhysicalDeviceVideoFormatPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPhysicalDeviceVideoFormatPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+      case procaddr::PhysicalDeviceFunc::GetRandROutputDisplayEXT: {
+        constexpr bool HasGetRandROutputDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetRandROutputDisplayEXT; };
+        if constexpr (HasGetRandROutputDisplayEXT)
+          return (PFN_vkVoidFunction) &wrap_GetRandROutputDisplayEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::PhysicalDeviceFunc::GetWinrtDisplayNV: {
+        constexpr bool HasGetWinrtDisplayNV = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::GetWinrtDisplayNV; };
+        if constexpr (HasGetWinrtDisplayNV)
+          return (PFN_vkVoidFunction) &wrap_GetWinrtDisplayNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::PhysicalDeviceFunc::ReleaseDisplayEXT: {
+        constexpr bool HasReleaseDisplayEXT = requires(const PhysicalDeviceOverrides& t) { &PhysicalDeviceOverrides::ReleaseDisplayEXT; };
+        if constexpr (HasReleaseDisplayEXT)
+          return (PFN_vkVoidFunction) &wrap_ReleaseDisplayEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::PhysicalDeviceFunc::layerGetPhysicalDeviceProcAddr: {
+        if constexpr (!std::is_base_of<NoOverrides, PhysicalDeviceOverrides>::value || !std::is_base_of<NoOverrides, DeviceOverrides>::value)
+          return (PFN_vkVoidFunction) &GetPhysicalDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      default:
+        break;
+    }
+
+    if (dispatch)
+      return dispatch->GetPhysicalDeviceProcAddr(instance, name);
+    else
+      return NULL;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  constexpr bool IsDeviceFuncHooked(procaddr::DeviceFunc func) {
+    switch (func) {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::AcquireFullScreenExclusiveModeEXT: {
+        constexpr bool HasAcquireFullScreenExclusiveModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireFullScreenExclusiveModeEXT; };
+        return HasAcquireFullScreenExclusiveModeEXT;
+      }
+#endif
+      case procaddr::DeviceFunc::AcquireNextImage2KHR: {
+        constexpr bool HasAcquireNextImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireNextImage2KHR; };
+        return HasAcquireNextImage2KHR;
+      }
+      case procaddr::DeviceFunc::AcquireNextImageKHR: {
+        constexpr bool HasAcquireNextImageKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireNextImageKHR; };
+        return HasAcquireNextImageKHR;
+      }
+      case procaddr::DeviceFunc::AcquirePerformanceConfigurationINTEL: {
+        constexpr bool HasAcquirePerformanceConfigurationINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquirePerformanceConfigurationINTEL; };
+        return HasAcquirePerformanceConfigurationINTEL;
+      }
+      case procaddr::DeviceFunc::AcquireProfilingLockKHR: {
+        constexpr bool HasAcquireProfilingLockKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireProfilingLockKHR; };
+        return HasAcquireProfilingLockKHR;
+      }
+      case procaddr::DeviceFunc::AllocateCommandBuffers: {
+        constexpr bool HasAllocateCommandBuffers = requires(const DeviceOverrides& t) { &DeviceOverrides::AllocateCommandBuffers; };
+        return HasAllocateCommandBuffers || !std::is_base_of<NoOverrides, DeviceOverrides>::value;
+      }
+      case procaddr::DeviceFunc::AllocateDescriptorSets: {
+        constexpr bool HasAllocateDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::AllocateDescriptorSets; };
+        return HasAllocateDescriptorSets;
+      }
+      case procaddr::DeviceFunc::AllocateMemory: {
+        constexpr bool HasAllocateMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::AllocateMemory; };
+        return HasAllocateMemory;
+      }
+      case procaddr::DeviceFunc::BeginCommandBuffer: {
+        constexpr bool HasBeginCommandBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::BeginCommandBuffer; };
+        return HasBeginCommandBuffer;
+      }
+      case procaddr::DeviceFunc::BindAccelerationStructureMemoryNV: {
+        constexpr bool HasBindAccelerationStructureMemoryNV = requires(const DeviceOverrides& t) { &DeviceOverrides::BindAccelerationStructureMemoryNV; };
+        return HasBindAccelerationStructureMemoryNV;
+      }
+      case procaddr::DeviceFunc::BindBufferMemory: {
+        constexpr bool HasBindBufferMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::BindBufferMemory; };
+        return HasBindBufferMemory;
+      }
+      case procaddr::DeviceFunc::BindBufferMemory2: {
+        constexpr bool HasBindBufferMemory2 = requires(const DeviceOverrides& t) { &DeviceOverrides::BindBufferMemory2; };
+        return HasBindBufferMemory2;
+      }
+      case procaddr::DeviceFunc::BindBufferMemory2KHR: {
+        constexpr bool HasBindBufferMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BindBufferMemory2KHR; };
+        return HasBindBufferMemory2KHR;
+      }
+      case procaddr::DeviceFunc::BindImageMemory: {
+        constexpr bool HasBindImageMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::BindImageMemory; };
+        return HasBindImageMemory;
+      }
+      case procaddr::DeviceFunc::BindImageMemory2: {
+        constexpr bool HasBindImageMemory2 = requires(const DeviceOverrides& t) { &DeviceOverrides::BindImageMemory2; };
+        return HasBindImageMemory2;
+      }
+      case procaddr::DeviceFunc::BindImageMemory2KHR: {
+        constexpr bool HasBindImageMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BindImageMemory2KHR; };
+        return HasBindImageMemory2KHR;
+      }
+      case procaddr::DeviceFunc::BindOpticalFlowSessionImageNV: {
+        constexpr bool HasBindOpticalFlowSessionImageNV = requires(const DeviceOverrides& t) { &DeviceOverrides::BindOpticalFlowSessionImageNV; };
+        return HasBindOpticalFlowSessionImageNV;
+      }
+      case procaddr::DeviceFunc::BindVideoSessionMemoryKHR: {
+        constexpr bool HasBindVideoSessionMemoryKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BindVideoSessionMemoryKHR; };
+        return HasBindVideoSessionMemoryKHR;
+      }
+      case procaddr::DeviceFunc::BuildAccelerationStructuresKHR: {
+        constexpr bool HasBuildAccelerationStructuresKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BuildAccelerationStructuresKHR; };
+        return HasBuildAccelerationStructuresKHR;
+      }
+      case procaddr::DeviceFunc::BuildMicromapsEXT: {
+        constexpr bool HasBuildMicromapsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::BuildMicromapsEXT; };
+        return HasBuildMicromapsEXT;
+      }
+      case procaddr::DeviceFunc::CmdBeginConditionalRenderingEXT: {
+        constexpr bool HasCmdBeginConditionalRenderingEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginConditionalRenderingEXT; };
+        return HasCmdBeginConditionalRenderingEXT;
+      }
+      case procaddr::DeviceFunc::CmdBeginDebugUtilsLabelEXT: {
+        constexpr bool HasCmdBeginDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginDebugUtilsLabelEXT; };
+        return HasCmdBeginDebugUtilsLabelEXT;
+      }
+      case procaddr::DeviceFunc::CmdBeginQuery: {
+        constexpr bool HasCmdBeginQuery = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginQuery; };
+        return HasCmdBeginQuery;
+      }
+      case procaddr::DeviceFunc::CmdBeginQueryIndexedEXT: {
+        constexpr bool HasCmdBeginQueryIndexedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginQueryIndexedEXT; };
+        return HasCmdBeginQueryIndexedEXT;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderPass: {
+        constexpr bool HasCmdBeginRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderPass; };
+        return HasCmdBeginRenderPass;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderPass2: {
+        constexpr bool HasCmdBeginRenderPass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderPass2; };
+        return HasCmdBeginRenderPass2;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderPass2KHR: {
+        constexpr bool HasCmdBeginRenderPass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderPass2KHR; };
+        return HasCmdBeginRenderPass2KHR;
+      }
+      case procaddr::DeviceFunc::CmdBeginRendering: {
+        constexpr bool HasCmdBeginRendering = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRendering; };
+        return HasCmdBeginRendering;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderingKHR: {
+        constexpr bool HasCmdBeginRenderingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderingKHR; };
+        return HasCmdBeginRenderingKHR;
+      }
+      case procaddr::DeviceFunc::CmdBeginTransformFeedbackEXT: {
+        constexpr bool HasCmdBeginTransformFeedbackEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginTransformFeedbackEXT; };
+        return HasCmdBeginTransformFeedbackEXT;
+      }
+      case procaddr::DeviceFunc::CmdBeginVideoCodingKHR: {
+        constexpr bool HasCmdBeginVideoCodingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginVideoCodingKHR; };
+        return HasCmdBeginVideoCodingKHR;
+      }
+      case procaddr::DeviceFunc::CmdBindDescriptorBufferEmbeddedSamplersEXT: {
+        constexpr bool HasCmdBindDescriptorBufferEmbeddedSamplersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindDescriptorBufferEmbeddedSamplersEXT; };
+        return HasCmdBindDescriptorBufferEmbeddedSamplersEXT;
+      }
+      case procaddr::DeviceFunc::CmdBindDescriptorBuffersEXT: {
+        constexpr bool HasCmdBindDescriptorBuffersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindDescriptorBuffersEXT; };
+        return HasCmdBindDescriptorBuffersEXT;
+      }
+      case procaddr::DeviceFunc::CmdBindDescriptorSets: {
+        constexpr bool HasCmdBindDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindDescriptorSets; };
+        return HasCmdBindDescriptorSets;
+      }
+      case procaddr::DeviceFunc::CmdBindIndexBuffer: {
+        constexpr bool HasCmdBindIndexBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindIndexBuffer; };
+        return HasCmdBindIndexBuffer;
+      }
+      case procaddr::DeviceFunc::CmdBindInvocationMaskHUAWEI: {
+        constexpr bool HasCmdBindInvocationMaskHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindInvocationMaskHUAWEI; };
+        return HasCmdBindInvocationMaskHUAWEI;
+      }
+      case procaddr::DeviceFunc::CmdBindPipeline: {
+        constexpr bool HasCmdBindPipeline = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindPipeline; };
+        return HasCmdBindPipeline;
+      }
+      case procaddr::DeviceFunc::CmdBindPipelineShaderGroupNV: {
+        constexpr bool HasCmdBindPipelineShaderGroupNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindPipelineShaderGroupNV; };
+        return HasCmdBindPipelineShaderGroupNV;
+      }
+      case procaddr::DeviceFunc::CmdBindShadersEXT: {
+        constexpr bool HasCmdBindShadersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindShadersEXT; };
+        return HasCmdBindShadersEXT;
+      }
+      case procaddr::DeviceFunc::CmdBindShadingRateImageNV: {
+        constexpr bool HasCmdBindShadingRateImageNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindShadingRateImageNV; };
+        return HasCmdBindShadingRateImageNV;
+      }
+      case procaddr::DeviceFunc::CmdBindTransformFeedbackBuffersEXT: {
+        constexpr bool HasCmdBindTransformFeedbackBuffersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindTransformFeedbackBuffersEXT; };
+        return HasCmdBindTransformFeedbackBuffersEXT;
+      }
+      case procaddr::DeviceFunc::CmdBindVertexBuffers: {
+        constexpr bool HasCmdBindVertexBuffers = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindVertexBuffers; };
+        return HasCmdBindVertexBuffers;
+      }
+      case procaddr::DeviceFunc::CmdBindVertexBuffers2: {
+        constexpr bool HasCmdBindVertexBuffers2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindVertexBuffers2; };
+        return HasCmdBindVertexBuffers2;
+      }
+      case procaddr::DeviceFunc::CmdBindVertexBuffers2EXT: {
+        constexpr bool HasCmdBindVertexBuffers2EXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindVertexBuffers2EXT; };
+        return HasCmdBindVertexBuffers2EXT;
+      }
+      case procaddr::DeviceFunc::CmdBlitImage: {
+        constexpr bool HasCmdBlitImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBlitImage; };
+        return HasCmdBlitImage;
+      }
+      case procaddr::DeviceFunc::CmdBlitImage2: {
+        constexpr bool HasCmdBlitImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBlitImage2; };
+        return HasCmdBlitImage2;
+      }
+      case procaddr::DeviceFunc::CmdBlitImage2KHR: {
+        constexpr bool HasCmdBlitImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBlitImage2KHR; };
+        return HasCmdBlitImage2KHR;
+      }
+      case procaddr::DeviceFunc::CmdBuildAccelerationStructureNV: {
+        constexpr bool HasCmdBuildAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildAccelerationStructureNV; };
+        return HasCmdBuildAccelerationStructureNV;
+      }
+      case procaddr::DeviceFunc::CmdBuildAccelerationStructuresIndirectKHR: {
+        constexpr bool HasCmdBuildAccelerationStructuresIndirectKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildAccelerationStructuresIndirectKHR; };
+        return HasCmdBuildAccelerationStructuresIndirectKHR;
+      }
+      case procaddr::DeviceFunc::CmdBuildAccelerationStructuresKHR: {
+        constexpr bool HasCmdBuildAccelerationStructuresKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildAccelerationStructuresKHR; };
+        return HasCmdBuildAccelerationStructuresKHR;
+      }
+      case procaddr::DeviceFunc::CmdBuildMicromapsEXT: {
+        constexpr bool HasCmdBuildMicromapsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildMicromapsEXT; };
+        return HasCmdBuildMicromapsEXT;
+      }
+      case procaddr::DeviceFunc::CmdClearAttachments: {
+        constexpr bool HasCmdClearAttachments = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdClearAttachments; };
+        return HasCmdClearAttachments;
+      }
+      case procaddr::DeviceFunc::CmdClearColorImage: {
+        constexpr bool HasCmdClearColorImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdClearColorImage; };
+        return HasCmdClearColorImage;
+      }
+      case procaddr::DeviceFunc::CmdClearDepthStencilImage: {
+        constexpr bool HasCmdClearDepthStencilImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdClearDepthStencilImage; };
+        return HasCmdClearDepthStencilImage;
+      }
+      case procaddr::DeviceFunc::CmdControlVideoCodingKHR: {
+        constexpr bool HasCmdControlVideoCodingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdControlVideoCodingKHR; };
+        return HasCmdControlVideoCodingKHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyAccelerationStructureKHR: {
+        constexpr bool HasCmdCopyAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyAccelerationStructureKHR; };
+        return HasCmdCopyAccelerationStructureKHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyAccelerationStructureNV: {
+        constexpr bool HasCmdCopyAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyAccelerationStructureNV; };
+        return HasCmdCopyAccelerationStructureNV;
+      }
+      case procaddr::DeviceFunc::CmdCopyAccelerationStructureToMemoryKHR: {
+        constexpr bool HasCmdCopyAccelerationStructureToMemoryKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyAccelerationStructureToMemoryKHR; };
+        return HasCmdCopyAccelerationStructureToMemoryKHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyBuffer: {
+        constexpr bool HasCmdCopyBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBuffer; };
+        return HasCmdCopyBuffer;
+      }
+      case procaddr::DeviceFunc::CmdCopyBuffer2: {
+        constexpr bool HasCmdCopyBuffer2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBuffer2; };
+        return HasCmdCopyBuffer2;
+      }
+      case procaddr::DeviceFunc::CmdCopyBuffer2KHR: {
+        constexpr bool HasCmdCopyBuffer2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBuffer2KHR; };
+        return HasCmdCopyBuffer2KHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyBufferToImage: {
+        constexpr bool HasCmdCopyBufferToImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBufferToImage; };
+        return HasCmdCopyBufferToImage;
+      }
+      case procaddr::DeviceFunc::CmdCopyBufferToImage2: {
+        constexpr bool HasCmdCopyBufferToImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBufferToImage2; };
+        return HasCmdCopyBufferToImage2;
+      }
+      case procaddr::DeviceFunc::CmdCopyBufferToImage2KHR: {
+        constexpr bool HasCmdCopyBufferToImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBufferToImage2KHR; };
+        return HasCmdCopyBufferToImage2KHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyImage: {
+        constexpr bool HasCmdCopyImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImage; };
+        return HasCmdCopyImage;
+      }
+      case procaddr::DeviceFunc::CmdCopyImage2: {
+        constexpr bool HasCmdCopyImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImage2; };
+        return HasCmdCopyImage2;
+      }
+      case procaddr::DeviceFunc::CmdCopyImage2KHR: {
+        constexpr bool HasCmdCopyImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImage2KHR; };
+        return HasCmdCopyImage2KHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyImageToBuffer: {
+        constexpr bool HasCmdCopyImageToBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImageToBuffer; };
+        return HasCmdCopyImageToBuffer;
+      }
+      case procaddr::DeviceFunc::CmdCopyImageToBuffer2: {
+        constexpr bool HasCmdCopyImageToBuffer2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImageToBuffer2; };
+        return HasCmdCopyImageToBuffer2;
+      }
+      case procaddr::DeviceFunc::CmdCopyImageToBuffer2KHR: {
+        constexpr bool HasCmdCopyImageToBuffer2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImageToBuffer2KHR; };
+        return HasCmdCopyImageToBuffer2KHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryIndirectNV: {
+        constexpr bool HasCmdCopyMemoryIndirectNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryIndirectNV; };
+        return HasCmdCopyMemoryIndirectNV;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryToAccelerationStructureKHR: {
+        constexpr bool HasCmdCopyMemoryToAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryToAccelerationStructureKHR; };
+        return HasCmdCopyMemoryToAccelerationStructureKHR;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryToImageIndirectNV: {
+        constexpr bool HasCmdCopyMemoryToImageIndirectNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryToImageIndirectNV; };
+        return HasCmdCopyMemoryToImageIndirectNV;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryToMicromapEXT: {
+        constexpr bool HasCmdCopyMemoryToMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryToMicromapEXT; };
+        return HasCmdCopyMemoryToMicromapEXT;
+      }
+      case procaddr::DeviceFunc::CmdCopyMicromapEXT: {
+        constexpr bool HasCmdCopyMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMicromapEXT; };
+        return HasCmdCopyMicromapEXT;
+      }
+      case procaddr::DeviceFunc::CmdCopyMicromapToMemoryEXT: {
+        constexpr bool HasCmdCopyMicromapToMemoryEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMicromapToMemoryEXT; };
+        return HasCmdCopyMicromapToMemoryEXT;
+      }
+      case procaddr::DeviceFunc::CmdCopyQueryPoolResults: {
+        constexpr bool HasCmdCopyQueryPoolResults = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyQueryPoolResults; };
+        return HasCmdCopyQueryPoolResults;
+      }
+      case procaddr::DeviceFunc::CmdDebugMarkerBeginEXT: {
+        constexpr bool HasCmdDebugMarkerBeginEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDebugMarkerBeginEXT; };
+        return HasCmdDebugMarkerBeginEXT;
+      }
+      case procaddr::DeviceFunc::CmdDebugMarkerEndEXT: {
+        constexpr bool HasCmdDebugMarkerEndEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDebugMarkerEndEXT; };
+        return HasCmdDebugMarkerEndEXT;
+      }
+      case procaddr::DeviceFunc::CmdDebugMarkerInsertEXT: {
+        constexpr bool HasCmdDebugMarkerInsertEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDebugMarkerInsertEXT; };
+        return HasCmdDebugMarkerInsertEXT;
+      }
+      case procaddr::DeviceFunc::CmdDecodeVideoKHR: {
+        constexpr bool HasCmdDecodeVideoKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDecodeVideoKHR; };
+        return HasCmdDecodeVideoKHR;
+      }
+      case procaddr::DeviceFunc::CmdDecompressMemoryIndirectCountNV: {
+        constexpr bool HasCmdDecompressMemoryIndirectCountNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDecompressMemoryIndirectCountNV; };
+        return HasCmdDecompressMemoryIndirectCountNV;
+      }
+      case procaddr::DeviceFunc::CmdDecompressMemoryNV: {
+        constexpr bool HasCmdDecompressMemoryNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDecompressMemoryNV; };
+        return HasCmdDecompressMemoryNV;
+      }
+      case procaddr::DeviceFunc::CmdDispatch: {
+        constexpr bool HasCmdDispatch = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatch; };
+        return HasCmdDispatch;
+      }
+      case procaddr::DeviceFunc::CmdDispatchBase: {
+        constexpr bool HasCmdDispatchBase = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatchBase; };
+        return HasCmdDispatchBase;
+      }
+      case procaddr::DeviceFunc::CmdDispatchBaseKHR: {
+        constexpr bool HasCmdDispatchBaseKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatchBaseKHR; };
+        return HasCmdDispatchBaseKHR;
+      }
+      case procaddr::DeviceFunc::CmdDispatchIndirect: {
+        constexpr bool HasCmdDispatchIndirect = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatchIndirect; };
+        return HasCmdDispatchIndirect;
+      }
+      case procaddr::DeviceFunc::CmdDraw: {
+        constexpr bool HasCmdDraw = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDraw; };
+        return HasCmdDraw;
+      }
+      case procaddr::DeviceFunc::CmdDrawClusterHUAWEI: {
+        constexpr bool HasCmdDrawClusterHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawClusterHUAWEI; };
+        return HasCmdDrawClusterHUAWEI;
+      }
+      case procaddr::DeviceFunc::CmdDrawClusterIndirectHUAWEI: {
+        constexpr bool HasCmdDrawClusterIndirectHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawClusterIndirectHUAWEI; };
+        return HasCmdDrawClusterIndirectHUAWEI;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexed: {
+        constexpr bool HasCmdDrawIndexed = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexed; };
+        return HasCmdDrawIndexed;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirect: {
+        constexpr bool HasCmdDrawIndexedIndirect = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirect; };
+        return HasCmdDrawIndexedIndirect;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirectCount: {
+        constexpr bool HasCmdDrawIndexedIndirectCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirectCount; };
+        return HasCmdDrawIndexedIndirectCount;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirectCountAMD: {
+        constexpr bool HasCmdDrawIndexedIndirectCountAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirectCountAMD; };
+        return HasCmdDrawIndexedIndirectCountAMD;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirectCountKHR: {
+        constexpr bool HasCmdDrawIndexedIndirectCountKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirectCountKHR; };
+        return HasCmdDrawIndexedIndirectCountKHR;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirect: {
+        constexpr bool HasCmdDrawIndirect = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirect; };
+        return HasCmdDrawIndirect;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectByteCountEXT: {
+        constexpr bool HasCmdDrawIndirectByteCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectByteCountEXT; };
+        return HasCmdDrawIndirectByteCountEXT;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectCount: {
+        constexpr bool HasCmdDrawIndirectCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectCount; };
+        return HasCmdDrawIndirectCount;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectCountAMD: {
+        constexpr bool HasCmdDrawIndirectCountAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectCountAMD; };
+        return HasCmdDrawIndirectCountAMD;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectCountKHR: {
+        constexpr bool HasCmdDrawIndirectCountKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectCountKHR; };
+        return HasCmdDrawIndirectCountKHR;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksEXT: {
+        constexpr bool HasCmdDrawMeshTasksEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksEXT; };
+        return HasCmdDrawMeshTasksEXT;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountEXT: {
+        constexpr bool HasCmdDrawMeshTasksIndirectCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectCountEXT; };
+        return HasCmdDrawMeshTasksIndirectCountEXT;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountNV: {
+        constexpr bool HasCmdDrawMeshTasksIndirectCountNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectCountNV; };
+        return HasCmdDrawMeshTasksIndirectCountNV;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectEXT: {
+        constexpr bool HasCmdDrawMeshTasksIndirectEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectEXT; };
+        return HasCmdDrawMeshTasksIndirectEXT;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectNV: {
+        constexpr bool HasCmdDrawMeshTasksIndirectNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectNV; };
+        return HasCmdDrawMeshTasksIndirectNV;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksNV: {
+        constexpr bool HasCmdDrawMeshTasksNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksNV; };
+        return HasCmdDrawMeshTasksNV;
+      }
+      case procaddr::DeviceFunc::CmdDrawMultiEXT: {
+        constexpr bool HasCmdDrawMultiEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMultiEXT; };
+        return HasCmdDrawMultiEXT;
+      }
+      case procaddr::DeviceFunc::CmdDrawMultiIndexedEXT: {
+        constexpr bool HasCmdDrawMultiIndexedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMultiIndexedEXT; };
+        return HasCmdDrawMultiIndexedEXT;
+      }
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case procaddr::DeviceFunc::CmdEncodeVideoKHR: {
+        constexpr bool HasCmdEncodeVideoKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEncodeVideoKHR; };
+        return HasCmdEncodeVideoKHR;
+      }
+#endif
+      case procaddr::DeviceFunc::CmdEndConditionalRenderingEXT: {
+        constexpr bool HasCmdEndConditionalRenderingEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndConditionalRenderingEXT; };
+        return HasCmdEndConditionalRenderingEXT;
+      }
+      case procaddr::DeviceFunc::CmdEndDebugUtilsLabelEXT: {
+        constexpr bool HasCmdEndDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndDebugUtilsLabelEXT; };
+        return HasCmdEndDebugUtilsLabelEXT;
+      }
+      case procaddr::DeviceFunc::CmdEndQuery: {
+        constexpr bool HasCmdEndQuery = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndQuery; };
+        return HasCmdEndQuery;
+      }
+      case procaddr::DeviceFunc::CmdEndQueryIndexedEXT: {
+        constexpr bool HasCmdEndQueryIndexedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndQueryIndexedEXT; };
+        return HasCmdEndQueryIndexedEXT;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderPass: {
+        constexpr bool HasCmdEndRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderPass; };
+        return HasCmdEndRenderPass;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderPass2: {
+        constexpr bool HasCmdEndRenderPass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderPass2; };
+        return HasCmdEndRenderPass2;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderPass2KHR: {
+        constexpr bool HasCmdEndRenderPass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderPass2KHR; };
+        return HasCmdEndRenderPass2KHR;
+      }
+      case procaddr::DeviceFunc::CmdEndRendering: {
+        constexpr bool HasCmdEndRendering = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRendering; };
+        return HasCmdEndRendering;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderingKHR: {
+        constexpr bool HasCmdEndRenderingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderingKHR; };
+        return HasCmdEndRenderingKHR;
+      }
+      case procaddr::DeviceFunc::CmdEndTransformFeedbackEXT: {
+        constexpr bool HasCmdEndTransformFeedbackEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndTransformFeedbackEXT; };
+        return HasCmdEndTransformFeedbackEXT;
+      }
+      case procaddr::DeviceFunc::CmdEndVideoCodingKHR: {
+        constexpr bool HasCmdEndVideoCodingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndVideoCodingKHR; };
+        return HasCmdEndVideoCodingKHR;
+      }
+      case procaddr::DeviceFunc::CmdExecuteCommands: {
+        constexpr bool HasCmdExecuteCommands = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdExecuteCommands; };
+        return HasCmdExecuteCommands;
+      }
+      case procaddr::DeviceFunc::CmdExecuteGeneratedCommandsNV: {
+        constexpr bool HasCmdExecuteGeneratedCommandsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdExecuteGeneratedCommandsNV; };
+        return HasCmdExecuteGeneratedCommandsNV;
+      }
+      case procaddr::DeviceFunc::CmdFillBuffer: {
+        constexpr bool HasCmdFillBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdFillBuffer; };
+        return HasCmdFillBuffer;
+      }
+      case procaddr::DeviceFunc::CmdInsertDebugUtilsLabelEXT: {
+        constexpr bool HasCmdInsertDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdInsertDebugUtilsLabelEXT; };
+        return HasCmdInsertDebugUtilsLabelEXT;
+      }
+      case procaddr::DeviceFunc::CmdNextSubpass: {
+        constexpr bool HasCmdNextSubpass = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdNextSubpass; };
+        return HasCmdNextSubpass;
+      }
+      case procaddr::DeviceFunc::CmdNextSubpass2: {
+        constexpr bool HasCmdNextSubpass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdNextSubpass2; };
+        return HasCmdNextSubpass2;
+      }
+      case procaddr::DeviceFunc::CmdNextSubpass2KHR: {
+        constexpr bool HasCmdNextSubpass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdNextSubpass2KHR; };
+        return HasCmdNextSubpass2KHR;
+      }
+      case procaddr::DeviceFunc::CmdOpticalFlowExecuteNV: {
+        constexpr bool HasCmdOpticalFlowExecuteNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdOpticalFlowExecuteNV; };
+        return HasCmdOpticalFlowExecuteNV;
+      }
+      case procaddr::DeviceFunc::CmdPipelineBarrier: {
+        constexpr bool HasCmdPipelineBarrier = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPipelineBarrier; };
+        return HasCmdPipelineBarrier;
+      }
+      case procaddr::DeviceFunc::CmdPipelineBarrier2: {
+        constexpr bool HasCmdPipelineBarrier2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPipelineBarrier2; };
+        return HasCmdPipelineBarrier2;
+      }
+      case procaddr::DeviceFunc::CmdPipelineBarrier2KHR: {
+        constexpr bool HasCmdPipelineBarrier2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPipelineBarrier2KHR; };
+        return HasCmdPipelineBarrier2KHR;
+      }
+      case procaddr::DeviceFunc::CmdPreprocessGeneratedCommandsNV: {
+        constexpr bool HasCmdPreprocessGeneratedCommandsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPreprocessGeneratedCommandsNV; };
+        return HasCmdPreprocessGeneratedCommandsNV;
+      }
+      case procaddr::DeviceFunc::CmdPushConstants: {
+        constexpr bool HasCmdPushConstants = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPushConstants; };
+        return HasCmdPushConstants;
+      }
+      case procaddr::DeviceFunc::CmdPushDescriptorSetKHR: {
+        constexpr bool HasCmdPushDescriptorSetKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPushDescriptorSetKHR; };
+        return HasCmdPushDescriptorSetKHR;
+      }
+      case procaddr::DeviceFunc::CmdPushDescriptorSetWithTemplateKHR: {
+        constexpr bool HasCmdPushDescriptorSetWithTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPushDescriptorSetWithTemplateKHR; };
+        return HasCmdPushDescriptorSetWithTemplateKHR;
+      }
+      case procaddr::DeviceFunc::CmdResetEvent: {
+        constexpr bool HasCmdResetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetEvent; };
+        return HasCmdResetEvent;
+      }
+      case procaddr::DeviceFunc::CmdResetEvent2: {
+        constexpr bool HasCmdResetEvent2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetEvent2; };
+        return HasCmdResetEvent2;
+      }
+      case procaddr::DeviceFunc::CmdResetEvent2KHR: {
+        constexpr bool HasCmdResetEvent2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetEvent2KHR; };
+        return HasCmdResetEvent2KHR;
+      }
+      case procaddr::DeviceFunc::CmdResetQueryPool: {
+        constexpr bool HasCmdResetQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetQueryPool; };
+        return HasCmdResetQueryPool;
+      }
+      case procaddr::DeviceFunc::CmdResolveImage: {
+        constexpr bool HasCmdResolveImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResolveImage; };
+        return HasCmdResolveImage;
+      }
+      case procaddr::DeviceFunc::CmdResolveImage2: {
+        constexpr bool HasCmdResolveImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResolveImage2; };
+        return HasCmdResolveImage2;
+      }
+      case procaddr::DeviceFunc::CmdResolveImage2KHR: {
+        constexpr bool HasCmdResolveImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResolveImage2KHR; };
+        return HasCmdResolveImage2KHR;
+      }
+      case procaddr::DeviceFunc::CmdSetAlphaToCoverageEnableEXT: {
+        constexpr bool HasCmdSetAlphaToCoverageEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetAlphaToCoverageEnableEXT; };
+        return HasCmdSetAlphaToCoverageEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetAlphaToOneEnableEXT: {
+        constexpr bool HasCmdSetAlphaToOneEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetAlphaToOneEnableEXT; };
+        return HasCmdSetAlphaToOneEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetAttachmentFeedbackLoopEnableEXT: {
+        constexpr bool HasCmdSetAttachmentFeedbackLoopEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetAttachmentFeedbackLoopEnableEXT; };
+        return HasCmdSetAttachmentFeedbackLoopEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetBlendConstants: {
+        constexpr bool HasCmdSetBlendConstants = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetBlendConstants; };
+        return HasCmdSetBlendConstants;
+      }
+      case procaddr::DeviceFunc::CmdSetCheckpointNV: {
+        constexpr bool HasCmdSetCheckpointNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCheckpointNV; };
+        return HasCmdSetCheckpointNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCoarseSampleOrderNV: {
+        constexpr bool HasCmdSetCoarseSampleOrderNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoarseSampleOrderNV; };
+        return HasCmdSetCoarseSampleOrderNV;
+      }
+      case procaddr::DeviceFunc::CmdSetColorBlendAdvancedEXT: {
+        constexpr bool HasCmdSetColorBlendAdvancedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorBlendAdvancedEXT; };
+        return HasCmdSetColorBlendAdvancedEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetColorBlendEnableEXT: {
+        constexpr bool HasCmdSetColorBlendEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorBlendEnableEXT; };
+        return HasCmdSetColorBlendEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetColorBlendEquationEXT: {
+        constexpr bool HasCmdSetColorBlendEquationEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorBlendEquationEXT; };
+        return HasCmdSetColorBlendEquationEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetColorWriteEnableEXT: {
+        constexpr bool HasCmdSetColorWriteEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorWriteEnableEXT; };
+        return HasCmdSetColorWriteEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetColorWriteMaskEXT: {
+        constexpr bool HasCmdSetColorWriteMaskEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorWriteMaskEXT; };
+        return HasCmdSetColorWriteMaskEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetConservativeRasterizationModeEXT: {
+        constexpr bool HasCmdSetConservativeRasterizationModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetConservativeRasterizationModeEXT; };
+        return HasCmdSetConservativeRasterizationModeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageModulationModeNV: {
+        constexpr bool HasCmdSetCoverageModulationModeNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageModulationModeNV; };
+        return HasCmdSetCoverageModulationModeNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageModulationTableEnableNV: {
+        constexpr bool HasCmdSetCoverageModulationTableEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageModulationTableEnableNV; };
+        return HasCmdSetCoverageModulationTableEnableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageModulationTableNV: {
+        constexpr bool HasCmdSetCoverageModulationTableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageModulationTableNV; };
+        return HasCmdSetCoverageModulationTableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageReductionModeNV: {
+        constexpr bool HasCmdSetCoverageReductionModeNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageReductionModeNV; };
+        return HasCmdSetCoverageReductionModeNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageToColorEnableNV: {
+        constexpr bool HasCmdSetCoverageToColorEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageToColorEnableNV; };
+        return HasCmdSetCoverageToColorEnableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageToColorLocationNV: {
+        constexpr bool HasCmdSetCoverageToColorLocationNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageToColorLocationNV; };
+        return HasCmdSetCoverageToColorLocationNV;
+      }
+      case procaddr::DeviceFunc::CmdSetCullMode: {
+        constexpr bool HasCmdSetCullMode = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCullMode; };
+        return HasCmdSetCullMode;
+      }
+      case procaddr::DeviceFunc::CmdSetCullModeEXT: {
+        constexpr bool HasCmdSetCullModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCullModeEXT; };
+        return HasCmdSetCullModeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBias: {
+        constexpr bool HasCmdSetDepthBias = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBias; };
+        return HasCmdSetDepthBias;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBiasEnable: {
+        constexpr bool HasCmdSetDepthBiasEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBiasEnable; };
+        return HasCmdSetDepthBiasEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBiasEnableEXT: {
+        constexpr bool HasCmdSetDepthBiasEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBiasEnableEXT; };
+        return HasCmdSetDepthBiasEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBounds: {
+        constexpr bool HasCmdSetDepthBounds = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBounds; };
+        return HasCmdSetDepthBounds;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBoundsTestEnable: {
+        constexpr bool HasCmdSetDepthBoundsTestEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBoundsTestEnable; };
+        return HasCmdSetDepthBoundsTestEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBoundsTestEnableEXT: {
+        constexpr bool HasCmdSetDepthBoundsTestEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBoundsTestEnableEXT; };
+        return HasCmdSetDepthBoundsTestEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthClampEnableEXT: {
+        constexpr bool HasCmdSetDepthClampEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthClampEnableEXT; };
+        return HasCmdSetDepthClampEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthClipEnableEXT: {
+        constexpr bool HasCmdSetDepthClipEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthClipEnableEXT; };
+        return HasCmdSetDepthClipEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthClipNegativeOneToOneEXT: {
+        constexpr bool HasCmdSetDepthClipNegativeOneToOneEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthClipNegativeOneToOneEXT; };
+        return HasCmdSetDepthClipNegativeOneToOneEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthCompareOp: {
+        constexpr bool HasCmdSetDepthCompareOp = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthCompareOp; };
+        return HasCmdSetDepthCompareOp;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthCompareOpEXT: {
+        constexpr bool HasCmdSetDepthCompareOpEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthCompareOpEXT; };
+        return HasCmdSetDepthCompareOpEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthTestEnable: {
+        constexpr bool HasCmdSetDepthTestEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthTestEnable; };
+        return HasCmdSetDepthTestEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthTestEnableEXT: {
+        constexpr bool HasCmdSetDepthTestEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthTestEnableEXT; };
+        return HasCmdSetDepthTestEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthWriteEnable: {
+        constexpr bool HasCmdSetDepthWriteEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthWriteEnable; };
+        return HasCmdSetDepthWriteEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthWriteEnableEXT: {
+        constexpr bool HasCmdSetDepthWriteEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthWriteEnableEXT; };
+        return HasCmdSetDepthWriteEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDescriptorBufferOffsetsEXT: {
+        constexpr bool HasCmdSetDescriptorBufferOffsetsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDescriptorBufferOffsetsEXT; };
+        return HasCmdSetDescriptorBufferOffsetsEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDeviceMask: {
+        constexpr bool HasCmdSetDeviceMask = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDeviceMask; };
+        return HasCmdSetDeviceMask;
+      }
+      case procaddr::DeviceFunc::CmdSetDeviceMaskKHR: {
+        constexpr bool HasCmdSetDeviceMaskKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDeviceMaskKHR; };
+        return HasCmdSetDeviceMaskKHR;
+      }
+      case procaddr::DeviceFunc::CmdSetDiscardRectangleEXT: {
+        constexpr bool HasCmdSetDiscardRectangleEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDiscardRectangleEXT; };
+        return HasCmdSetDiscardRectangleEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDiscardRectangleEnableEXT: {
+        constexpr bool HasCmdSetDiscardRectangleEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDiscardRectangleEnableEXT; };
+        return HasCmdSetDiscardRectangleEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetDiscardRectangleModeEXT: {
+        constexpr bool HasCmdSetDiscardRectangleModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDiscardRectangleModeEXT; };
+        return HasCmdSetDiscardRectangleModeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetEvent: {
+        constexpr bool HasCmdSetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetEvent; };
+        return HasCmdSetEvent;
+      }
+      case procaddr::DeviceFunc::CmdSetEvent2: {
+        constexpr bool HasCmdSetEvent2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetEvent2; };
+        return HasCmdSetEvent2;
+      }
+      case procaddr::DeviceFunc::CmdSetEvent2KHR: {
+        constexpr bool HasCmdSetEvent2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetEvent2KHR; };
+        return HasCmdSetEvent2KHR;
+      }
+      case procaddr::DeviceFunc::CmdSetExclusiveScissorEnableNV: {
+        constexpr bool HasCmdSetExclusiveScissorEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetExclusiveScissorEnableNV; };
+        return HasCmdSetExclusiveScissorEnableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetExclusiveScissorNV: {
+        constexpr bool HasCmdSetExclusiveScissorNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetExclusiveScissorNV; };
+        return HasCmdSetExclusiveScissorNV;
+      }
+      case procaddr::DeviceFunc::CmdSetExtraPrimitiveOverestimationSizeEXT: {
+        constexpr bool HasCmdSetExtraPrimitiveOverestimationSizeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetExtraPrimitiveOverestimationSizeEXT; };
+        return HasCmdSetExtraPrimitiveOverestimationSizeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetFragmentShadingRateEnumNV: {
+        constexpr bool HasCmdSetFragmentShadingRateEnumNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFragmentShadingRateEnumNV; };
+        return HasCmdSetFragmentShadingRateEnumNV;
+      }
+      case procaddr::DeviceFunc::CmdSetFragmentShadingRateKHR: {
+        constexpr bool HasCmdSetFragmentShadingRateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFragmentShadingRateKHR; };
+        return HasCmdSetFragmentShadingRateKHR;
+      }
+      case procaddr::DeviceFunc::CmdSetFrontFace: {
+        constexpr bool HasCmdSetFrontFace = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFrontFace; };
+        return HasCmdSetFrontFace;
+      }
+      case procaddr::DeviceFunc::CmdSetFrontFaceEXT: {
+        constexpr bool HasCmdSetFrontFaceEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFrontFaceEXT; };
+        return HasCmdSetFrontFaceEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetLineRasterizationModeEXT: {
+        constexpr bool HasCmdSetLineRasterizationModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineRasterizationModeEXT; };
+        return HasCmdSetLineRasterizationModeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetLineStippleEXT: {
+        constexpr bool HasCmdSetLineStippleEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineStippleEXT; };
+        return HasCmdSetLineStippleEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetLineStippleEnableEXT: {
+        constexpr bool HasCmdSetLineStippleEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineStippleEnableEXT; };
+        return HasCmdSetLineStippleEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetLineWidth: {
+        constexpr bool HasCmdSetLineWidth = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineWidth; };
+        return HasCmdSetLineWidth;
+      }
+      case procaddr::DeviceFunc::CmdSetLogicOpEXT: {
+        constexpr bool HasCmdSetLogicOpEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLogicOpEXT; };
+        return HasCmdSetLogicOpEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetLogicOpEnableEXT: {
+        constexpr bool HasCmdSetLogicOpEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLogicOpEnableEXT; };
+        return HasCmdSetLogicOpEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetPatchControlPointsEXT: {
+        constexpr bool HasCmdSetPatchControlPointsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPatchControlPointsEXT; };
+        return HasCmdSetPatchControlPointsEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetPerformanceMarkerINTEL: {
+        constexpr bool HasCmdSetPerformanceMarkerINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPerformanceMarkerINTEL; };
+        return HasCmdSetPerformanceMarkerINTEL;
+      }
+      case procaddr::DeviceFunc::CmdSetPerformanceOverrideINTEL: {
+        constexpr bool HasCmdSetPerformanceOverrideINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPerformanceOverrideINTEL; };
+        return HasCmdSetPerformanceOverrideINTEL;
+      }
+      case procaddr::DeviceFunc::CmdSetPerformanceStreamMarkerINTEL: {
+        constexpr bool HasCmdSetPerformanceStreamMarkerINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPerformanceStreamMarkerINTEL; };
+        return HasCmdSetPerformanceStreamMarkerINTEL;
+      }
+      case procaddr::DeviceFunc::CmdSetPolygonModeEXT: {
+        constexpr bool HasCmdSetPolygonModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPolygonModeEXT; };
+        return HasCmdSetPolygonModeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveRestartEnable: {
+        constexpr bool HasCmdSetPrimitiveRestartEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveRestartEnable; };
+        return HasCmdSetPrimitiveRestartEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveRestartEnableEXT: {
+        constexpr bool HasCmdSetPrimitiveRestartEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveRestartEnableEXT; };
+        return HasCmdSetPrimitiveRestartEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveTopology: {
+        constexpr bool HasCmdSetPrimitiveTopology = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveTopology; };
+        return HasCmdSetPrimitiveTopology;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveTopologyEXT: {
+        constexpr bool HasCmdSetPrimitiveTopologyEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveTopologyEXT; };
+        return HasCmdSetPrimitiveTopologyEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetProvokingVertexModeEXT: {
+        constexpr bool HasCmdSetProvokingVertexModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetProvokingVertexModeEXT; };
+        return HasCmdSetProvokingVertexModeEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizationSamplesEXT: {
+        constexpr bool HasCmdSetRasterizationSamplesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizationSamplesEXT; };
+        return HasCmdSetRasterizationSamplesEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizationStreamEXT: {
+        constexpr bool HasCmdSetRasterizationStreamEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizationStreamEXT; };
+        return HasCmdSetRasterizationStreamEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizerDiscardEnable: {
+        constexpr bool HasCmdSetRasterizerDiscardEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizerDiscardEnable; };
+        return HasCmdSetRasterizerDiscardEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizerDiscardEnableEXT: {
+        constexpr bool HasCmdSetRasterizerDiscardEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizerDiscardEnableEXT; };
+        return HasCmdSetRasterizerDiscardEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetRayTracingPipelineStackSizeKHR: {
+        constexpr bool HasCmdSetRayTracingPipelineStackSizeKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRayTracingPipelineStackSizeKHR; };
+        return HasCmdSetRayTracingPipelineStackSizeKHR;
+      }
+      case procaddr::DeviceFunc::CmdSetRepresentativeFragmentTestEnableNV: {
+        constexpr bool HasCmdSetRepresentativeFragmentTestEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRepresentativeFragmentTestEnableNV; };
+        return HasCmdSetRepresentativeFragmentTestEnableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetSampleLocationsEXT: {
+        constexpr bool HasCmdSetSampleLocationsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetSampleLocationsEXT; };
+        return HasCmdSetSampleLocationsEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetSampleLocationsEnableEXT: {
+        constexpr bool HasCmdSetSampleLocationsEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetSampleLocationsEnableEXT; };
+        return HasCmdSetSampleLocationsEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetSampleMaskEXT: {
+        constexpr bool HasCmdSetSampleMaskEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetSampleMaskEXT; };
+        return HasCmdSetSampleMaskEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetScissor: {
+        constexpr bool HasCmdSetScissor = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetScissor; };
+        return HasCmdSetScissor;
+      }
+      case procaddr::DeviceFunc::CmdSetScissorWithCount: {
+        constexpr bool HasCmdSetScissorWithCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetScissorWithCount; };
+        return HasCmdSetScissorWithCount;
+      }
+      case procaddr::DeviceFunc::CmdSetScissorWithCountEXT: {
+        constexpr bool HasCmdSetScissorWithCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetScissorWithCountEXT; };
+        return HasCmdSetScissorWithCountEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetShadingRateImageEnableNV: {
+        constexpr bool HasCmdSetShadingRateImageEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetShadingRateImageEnableNV; };
+        return HasCmdSetShadingRateImageEnableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilCompareMask: {
+        constexpr bool HasCmdSetStencilCompareMask = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilCompareMask; };
+        return HasCmdSetStencilCompareMask;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilOp: {
+        constexpr bool HasCmdSetStencilOp = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilOp; };
+        return HasCmdSetStencilOp;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilOpEXT: {
+        constexpr bool HasCmdSetStencilOpEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilOpEXT; };
+        return HasCmdSetStencilOpEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilReference: {
+        constexpr bool HasCmdSetStencilReference = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilReference; };
+        return HasCmdSetStencilReference;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilTestEnable: {
+        constexpr bool HasCmdSetStencilTestEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilTestEnable; };
+        return HasCmdSetStencilTestEnable;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilTestEnableEXT: {
+        constexpr bool HasCmdSetStencilTestEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilTestEnableEXT; };
+        return HasCmdSetStencilTestEnableEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilWriteMask: {
+        constexpr bool HasCmdSetStencilWriteMask = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilWriteMask; };
+        return HasCmdSetStencilWriteMask;
+      }
+      case procaddr::DeviceFunc::CmdSetTessellationDomainOriginEXT: {
+        constexpr bool HasCmdSetTessellationDomainOriginEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetTessellationDomainOriginEXT; };
+        return HasCmdSetTessellationDomainOriginEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetVertexInputEXT: {
+        constexpr bool HasCmdSetVertexInputEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetVertexInputEXT; };
+        return HasCmdSetVertexInputEXT;
+      }
+      case procaddr::DeviceFunc::CmdSetViewport: {
+        constexpr bool HasCmdSetViewport = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewport; };
+        return HasCmdSetViewport;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportShadingRatePaletteNV: {
+        constexpr bool HasCmdSetViewportShadingRatePaletteNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportShadingRatePaletteNV; };
+        return HasCmdSetViewportShadingRatePaletteNV;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportSwizzleNV: {
+        constexpr bool HasCmdSetViewportSwizzleNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportSwizzleNV; };
+        return HasCmdSetViewportSwizzleNV;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWScalingEnableNV: {
+        constexpr bool HasCmdSetViewportWScalingEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWScalingEnableNV; };
+        return HasCmdSetViewportWScalingEnableNV;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWScalingNV: {
+        constexpr bool HasCmdSetViewportWScalingNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWScalingNV; };
+        return HasCmdSetViewportWScalingNV;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWithCount: {
+        constexpr bool HasCmdSetViewportWithCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWithCount; };
+        return HasCmdSetViewportWithCount;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWithCountEXT: {
+        constexpr bool HasCmdSetViewportWithCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWithCountEXT; };
+        return HasCmdSetViewportWithCountEXT;
+      }
+      case procaddr::DeviceFunc::CmdSubpassShadingHUAWEI: {
+        constexpr bool HasCmdSubpassShadingHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSubpassShadingHUAWEI; };
+        return HasCmdSubpassShadingHUAWEI;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysIndirect2KHR: {
+        constexpr bool HasCmdTraceRaysIndirect2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysIndirect2KHR; };
+        return HasCmdTraceRaysIndirect2KHR;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysIndirectKHR: {
+        constexpr bool HasCmdTraceRaysIndirectKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysIndirectKHR; };
+        return HasCmdTraceRaysIndirectKHR;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysKHR: {
+        constexpr bool HasCmdTraceRaysKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysKHR; };
+        return HasCmdTraceRaysKHR;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysNV: {
+        constexpr bool HasCmdTraceRaysNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysNV; };
+        return HasCmdTraceRaysNV;
+      }
+      case procaddr::DeviceFunc::CmdUpdateBuffer: {
+        constexpr bool HasCmdUpdateBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdUpdateBuffer; };
+        return HasCmdUpdateBuffer;
+      }
+      case procaddr::DeviceFunc::CmdWaitEvents: {
+        constexpr bool HasCmdWaitEvents = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWaitEvents; };
+        return HasCmdWaitEvents;
+      }
+      case procaddr::DeviceFunc::CmdWaitEvents2: {
+        constexpr bool HasCmdWaitEvents2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWaitEvents2; };
+        return HasCmdWaitEvents2;
+      }
+      case procaddr::DeviceFunc::CmdWaitEvents2KHR: {
+        constexpr bool HasCmdWaitEvents2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWaitEvents2KHR; };
+        return HasCmdWaitEvents2KHR;
+      }
+      case procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesKHR: {
+        constexpr bool HasCmdWriteAccelerationStructuresPropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteAccelerationStructuresPropertiesKHR; };
+        return HasCmdWriteAccelerationStructuresPropertiesKHR;
+      }
+      case procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesNV: {
+        constexpr bool HasCmdWriteAccelerationStructuresPropertiesNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteAccelerationStructuresPropertiesNV; };
+        return HasCmdWriteAccelerationStructuresPropertiesNV;
+      }
+      case procaddr::DeviceFunc::CmdWriteBufferMarker2AMD: {
+        constexpr bool HasCmdWriteBufferMarker2AMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteBufferMarker2AMD; };
+        return HasCmdWriteBufferMarker2AMD;
+      }
+      case procaddr::DeviceFunc::CmdWriteBufferMarkerAMD: {
+        constexpr bool HasCmdWriteBufferMarkerAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteBufferMarkerAMD; };
+        return HasCmdWriteBufferMarkerAMD;
+      }
+      case procaddr::DeviceFunc::CmdWriteMicromapsPropertiesEXT: {
+        constexpr bool HasCmdWriteMicromapsPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteMicromapsPropertiesEXT; };
+        return HasCmdWriteMicromapsPropertiesEXT;
+      }
+      case procaddr::DeviceFunc::CmdWriteTimestamp: {
+        constexpr bool HasCmdWriteTimestamp = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteTimestamp; };
+        return HasCmdWriteTimestamp;
+      }
+      case procaddr::DeviceFunc::CmdWriteTimestamp2: {
+        constexpr bool HasCmdWriteTimestamp2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteTimestamp2; };
+        return HasCmdWriteTimestamp2;
+      }
+      case procaddr::DeviceFunc::CmdWriteTimestamp2KHR: {
+        constexpr bool HasCmdWriteTimestamp2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteTimestamp2KHR; };
+        return HasCmdWriteTimestamp2KHR;
+      }
+      case procaddr::DeviceFunc::CompileDeferredNV: {
+        constexpr bool HasCompileDeferredNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CompileDeferredNV; };
+        return HasCompileDeferredNV;
+      }
+      case procaddr::DeviceFunc::CopyAccelerationStructureKHR: {
+        constexpr bool HasCopyAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyAccelerationStructureKHR; };
+        return HasCopyAccelerationStructureKHR;
+      }
+      case procaddr::DeviceFunc::CopyAccelerationStructureToMemoryKHR: {
+        constexpr bool HasCopyAccelerationStructureToMemoryKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyAccelerationStructureToMemoryKHR; };
+        return HasCopyAccelerationStructureToMemoryKHR;
+      }
+      case procaddr::DeviceFunc::CopyMemoryToAccelerationStructureKHR: {
+        constexpr bool HasCopyMemoryToAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMemoryToAccelerationStructureKHR; };
+        return HasCopyMemoryToAccelerationStructureKHR;
+      }
+      case procaddr::DeviceFunc::CopyMemoryToMicromapEXT: {
+        constexpr bool HasCopyMemoryToMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMemoryToMicromapEXT; };
+        return HasCopyMemoryToMicromapEXT;
+      }
+      case procaddr::DeviceFunc::CopyMicromapEXT: {
+        constexpr bool HasCopyMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMicromapEXT; };
+        return HasCopyMicromapEXT;
+      }
+      case procaddr::DeviceFunc::CopyMicromapToMemoryEXT: {
+        constexpr bool HasCopyMicromapToMemoryEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMicromapToMemoryEXT; };
+        return HasCopyMicromapToMemoryEXT;
+      }
+      case procaddr::DeviceFunc::CreateAccelerationStructureKHR: {
+        constexpr bool HasCreateAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateAccelerationStructureKHR; };
+        return HasCreateAccelerationStructureKHR;
+      }
+      case procaddr::DeviceFunc::CreateAccelerationStructureNV: {
+        constexpr bool HasCreateAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateAccelerationStructureNV; };
+        return HasCreateAccelerationStructureNV;
+      }
+      case procaddr::DeviceFunc::CreateBuffer: {
+        constexpr bool HasCreateBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateBuffer; };
+        return HasCreateBuffer;
+      }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::CreateBufferCollectionFUCHSIA: {
+        constexpr bool HasCreateBufferCollectionFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateBufferCollectionFUCHSIA; };
+        return HasCreateBufferCollectionFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::CreateBufferView: {
+        constexpr bool HasCreateBufferView = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateBufferView; };
+        return HasCreateBufferView;
+      }
+      case procaddr::DeviceFunc::CreateCommandPool: {
+        constexpr bool HasCreateCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateCommandPool; };
+        return HasCreateCommandPool;
+      }
+      case procaddr::DeviceFunc::CreateComputePipelines: {
+        constexpr bool HasCreateComputePipelines = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateComputePipelines; };
+        return HasCreateComputePipelines;
+      }
+      case procaddr::DeviceFunc::CreateDeferredOperationKHR: {
+        constexpr bool HasCreateDeferredOperationKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDeferredOperationKHR; };
+        return HasCreateDeferredOperationKHR;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorPool: {
+        constexpr bool HasCreateDescriptorPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorPool; };
+        return HasCreateDescriptorPool;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorSetLayout: {
+        constexpr bool HasCreateDescriptorSetLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorSetLayout; };
+        return HasCreateDescriptorSetLayout;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorUpdateTemplate: {
+        constexpr bool HasCreateDescriptorUpdateTemplate = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorUpdateTemplate; };
+        return HasCreateDescriptorUpdateTemplate;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorUpdateTemplateKHR: {
+        constexpr bool HasCreateDescriptorUpdateTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorUpdateTemplateKHR; };
+        return HasCreateDescriptorUpdateTemplateKHR;
+      }
+      case procaddr::DeviceFunc::CreateEvent: {
+        constexpr bool HasCreateEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateEvent; };
+        return HasCreateEvent;
+      }
+      case procaddr::DeviceFunc::CreateFence: {
+        constexpr bool HasCreateFence = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateFence; };
+        return HasCreateFence;
+      }
+      case procaddr::DeviceFunc::CreateFramebuffer: {
+        constexpr bool HasCreateFramebuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateFramebuffer; };
+        return HasCreateFramebuffer;
+      }
+      case procaddr::DeviceFunc::CreateGraphicsPipelines: {
+        constexpr bool HasCreateGraphicsPipelines = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateGraphicsPipelines; };
+        return HasCreateGraphicsPipelines;
+      }
+      case procaddr::DeviceFunc::CreateImage: {
+        constexpr bool HasCreateImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateImage; };
+        return HasCreateImage;
+      }
+      case procaddr::DeviceFunc::CreateImageView: {
+        constexpr bool HasCreateImageView = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateImageView; };
+        return HasCreateImageView;
+      }
+      case procaddr::DeviceFunc::CreateIndirectCommandsLayoutNV: {
+        constexpr bool HasCreateIndirectCommandsLayoutNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateIndirectCommandsLayoutNV; };
+        return HasCreateIndirectCommandsLayoutNV;
+      }
+      case procaddr::DeviceFunc::CreateMicromapEXT: {
+        constexpr bool HasCreateMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateMicromapEXT; };
+        return HasCreateMicromapEXT;
+      }
+      case procaddr::DeviceFunc::CreateOpticalFlowSessionNV: {
+        constexpr bool HasCreateOpticalFlowSessionNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateOpticalFlowSessionNV; };
+        return HasCreateOpticalFlowSessionNV;
+      }
+      case procaddr::DeviceFunc::CreatePipelineCache: {
+        constexpr bool HasCreatePipelineCache = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePipelineCache; };
+        return HasCreatePipelineCache;
+      }
+      case procaddr::DeviceFunc::CreatePipelineLayout: {
+        constexpr bool HasCreatePipelineLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePipelineLayout; };
+        return HasCreatePipelineLayout;
+      }
+      case procaddr::DeviceFunc::CreatePrivateDataSlot: {
+        constexpr bool HasCreatePrivateDataSlot = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePrivateDataSlot; };
+        return HasCreatePrivateDataSlot;
+      }
+      case procaddr::DeviceFunc::CreatePrivateDataSlotEXT: {
+        constexpr bool HasCreatePrivateDataSlotEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePrivateDataSlotEXT; };
+        return HasCreatePrivateDataSlotEXT;
+      }
+      case procaddr::DeviceFunc::CreateQueryPool: {
+        constexpr bool HasCreateQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateQueryPool; };
+        return HasCreateQueryPool;
+      }
+      case procaddr::DeviceFunc::CreateRayTracingPipelinesKHR: {
+        constexpr bool HasCreateRayTracingPipelinesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRayTracingPipelinesKHR; };
+        return HasCreateRayTracingPipelinesKHR;
+      }
+      case procaddr::DeviceFunc::CreateRayTracingPipelinesNV: {
+        constexpr bool HasCreateRayTracingPipelinesNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRayTracingPipelinesNV; };
+        return HasCreateRayTracingPipelinesNV;
+      }
+      case procaddr::DeviceFunc::CreateRenderPass: {
+        constexpr bool HasCreateRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRenderPass; };
+        return HasCreateRenderPass;
+      }
+      case procaddr::DeviceFunc::CreateRenderPass2: {
+        constexpr bool HasCreateRenderPass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRenderPass2; };
+        return HasCreateRenderPass2;
+      }
+      case procaddr::DeviceFunc::CreateRenderPass2KHR: {
+        constexpr bool HasCreateRenderPass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRenderPass2KHR; };
+        return HasCreateRenderPass2KHR;
+      }
+      case procaddr::DeviceFunc::CreateSampler: {
+        constexpr bool HasCreateSampler = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSampler; };
+        return HasCreateSampler;
+      }
+      case procaddr::DeviceFunc::CreateSamplerYcbcrConversion: {
+        constexpr bool HasCreateSamplerYcbcrConversion = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSamplerYcbcrConversion; };
+        return HasCreateSamplerYcbcrConversion;
+      }
+      case procaddr::DeviceFunc::CreateSamplerYcbcrConversionKHR: {
+        constexpr bool HasCreateSamplerYcbcrConversionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSamplerYcbcrConversionKHR; };
+        return HasCreateSamplerYcbcrConversionKHR;
+      }
+      case procaddr::DeviceFunc::CreateSemaphore: {
+        constexpr bool HasCreateSemaphore = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSemaphore; };
+        return HasCreateSemaphore;
+      }
+      case procaddr::DeviceFunc::CreateShaderModule: {
+        constexpr bool HasCreateShaderModule = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateShaderModule; };
+        return HasCreateShaderModule;
+      }
+      case procaddr::DeviceFunc::CreateShadersEXT: {
+        constexpr bool HasCreateShadersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateShadersEXT; };
+        return HasCreateShadersEXT;
+      }
+      case procaddr::DeviceFunc::CreateSharedSwapchainsKHR: {
+        constexpr bool HasCreateSharedSwapchainsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSharedSwapchainsKHR; };
+        return HasCreateSharedSwapchainsKHR;
+      }
+      case procaddr::DeviceFunc::CreateSwapchainKHR: {
+        constexpr bool HasCreateSwapchainKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSwapchainKHR; };
+        return HasCreateSwapchainKHR;
+      }
+      case procaddr::DeviceFunc::CreateValidationCacheEXT: {
+        constexpr bool HasCreateValidationCacheEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateValidationCacheEXT; };
+        return HasCreateValidationCacheEXT;
+      }
+      case procaddr::DeviceFunc::CreateVideoSessionKHR: {
+        constexpr bool HasCreateVideoSessionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateVideoSessionKHR; };
+        return HasCreateVideoSessionKHR;
+      }
+      case procaddr::DeviceFunc::CreateVideoSessionParametersKHR: {
+        constexpr bool HasCreateVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateVideoSessionParametersKHR; };
+        return HasCreateVideoSessionParametersKHR;
+      }
+      case procaddr::DeviceFunc::DebugMarkerSetObjectNameEXT: {
+        constexpr bool HasDebugMarkerSetObjectNameEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DebugMarkerSetObjectNameEXT; };
+        return HasDebugMarkerSetObjectNameEXT;
+      }
+      case procaddr::DeviceFunc::DebugMarkerSetObjectTagEXT: {
+        constexpr bool HasDebugMarkerSetObjectTagEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DebugMarkerSetObjectTagEXT; };
+        return HasDebugMarkerSetObjectTagEXT;
+      }
+      case procaddr::DeviceFunc::DeferredOperationJoinKHR: {
+        constexpr bool HasDeferredOperationJoinKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DeferredOperationJoinKHR; };
+        return HasDeferredOperationJoinKHR;
+      }
+      case procaddr::DeviceFunc::DestroyAccelerationStructureKHR: {
+        constexpr bool HasDestroyAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyAccelerationStructureKHR; };
+        return HasDestroyAccelerationStructureKHR;
+      }
+      case procaddr::DeviceFunc::DestroyAccelerationStructureNV: {
+        constexpr bool HasDestroyAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyAccelerationStructureNV; };
+        return HasDestroyAccelerationStructureNV;
+      }
+      case procaddr::DeviceFunc::DestroyBuffer: {
+        constexpr bool HasDestroyBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyBuffer; };
+        return HasDestroyBuffer;
+      }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::DestroyBufferCollectionFUCHSIA: {
+        constexpr bool HasDestroyBufferCollectionFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyBufferCollectionFUCHSIA; };
+        return HasDestroyBufferCollectionFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::DestroyBufferView: {
+        constexpr bool HasDestroyBufferView = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyBufferView; };
+        return HasDestroyBufferView;
+      }
+      case procaddr::DeviceFunc::DestroyCommandPool: {
+        constexpr bool HasDestroyCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyCommandPool; };
+        return HasDestroyCommandPool || !std::is_base_of<NoOverrides, DeviceOverrides>::value;
+      }
+      case procaddr::DeviceFunc::DestroyDeferredOperationKHR: {
+        constexpr bool HasDestroyDeferredOperationKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDeferredOperationKHR; };
+        return HasDestroyDeferredOperationKHR;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorPool: {
+        constexpr bool HasDestroyDescriptorPool = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorPool; };
+        return HasDestroyDescriptorPool;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorSetLayout: {
+        constexpr bool HasDestroyDescriptorSetLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorSetLayout; };
+        return HasDestroyDescriptorSetLayout;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorUpdateTemplate: {
+        constexpr bool HasDestroyDescriptorUpdateTemplate = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorUpdateTemplate; };
+        return HasDestroyDescriptorUpdateTemplate;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorUpdateTemplateKHR: {
+        constexpr bool HasDestroyDescriptorUpdateTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorUpdateTemplateKHR; };
+        return HasDestroyDescriptorUpdateTemplateKHR;
+      }
+      case procaddr::DeviceFunc::DestroyDevice: {
+        return true;
+      }
+      case procaddr::DeviceFunc::DestroyEvent: {
+        constexpr bool HasDestroyEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyEvent; };
+        return HasDestroyEvent;
+      }
+      case procaddr::DeviceFunc::DestroyFence: {
+        constexpr bool HasDestroyFence = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyFence; };
+        return HasDestroyFence;
+      }
+      case procaddr::DeviceFunc::DestroyFramebuffer: {
+        constexpr bool HasDestroyFramebuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyFramebuffer; };
+        return HasDestroyFramebuffer;
+      }
+      case procaddr::DeviceFunc::DestroyImage: {
+        constexpr bool HasDestroyImage = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyImage; };
+        return HasDestroyImage;
+      }
+      case procaddr::DeviceFunc::DestroyImageView: {
+        constexpr bool HasDestroyImageView = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyImageView; };
+        return HasDestroyImageView;
+      }
+      case procaddr::DeviceFunc::DestroyIndirectCommandsLayoutNV: {
+        constexpr bool HasDestroyIndirectCommandsLayoutNV = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyIndirectCommandsLayoutNV; };
+        return HasDestroyIndirectCommandsLayoutNV;
+      }
+      case procaddr::DeviceFunc::DestroyMicromapEXT: {
+        constexpr bool HasDestroyMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyMicromapEXT; };
+        return HasDestroyMicromapEXT;
+      }
+      case procaddr::DeviceFunc::DestroyOpticalFlowSessionNV: {
+        constexpr bool HasDestroyOpticalFlowSessionNV = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyOpticalFlowSessionNV; };
+        return HasDestroyOpticalFlowSessionNV;
+      }
+      case procaddr::DeviceFunc::DestroyPipeline: {
+        constexpr bool HasDestroyPipeline = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPipeline; };
+        return HasDestroyPipeline;
+      }
+      case procaddr::DeviceFunc::DestroyPipelineCache: {
+        constexpr bool HasDestroyPipelineCache = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPipelineCache; };
+        return HasDestroyPipelineCache;
+      }
+      case procaddr::DeviceFunc::DestroyPipelineLayout: {
+        constexpr bool HasDestroyPipelineLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPipelineLayout; };
+        return HasDestroyPipelineLayout;
+      }
+      case procaddr::DeviceFunc::DestroyPrivateDataSlot: {
+        constexpr bool HasDestroyPrivateDataSlot = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPrivateDataSlot; };
+        return HasDestroyPrivateDataSlot;
+      }
+      case procaddr::DeviceFunc::DestroyPrivateDataSlotEXT: {
+        constexpr bool HasDestroyPrivateDataSlotEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPrivateDataSlotEXT; };
+        return HasDestroyPrivateDataSlotEXT;
+      }
+      case procaddr::DeviceFunc::DestroyQueryPool: {
+        constexpr bool HasDestroyQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyQueryPool; };
+        return HasDestroyQueryPool;
+      }
+      case procaddr::DeviceFunc::DestroyRenderPass: {
+        constexpr bool HasDestroyRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyRenderPass; };
+        return HasDestroyRenderPass;
+      }
+      case procaddr::DeviceFunc::DestroySampler: {
+        constexpr bool HasDestroySampler = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySampler; };
+        return HasDestroySampler;
+      }
+      case procaddr::DeviceFunc::DestroySamplerYcbcrConversion: {
+        constexpr bool HasDestroySamplerYcbcrConversion = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySamplerYcbcrConversion; };
+        return HasDestroySamplerYcbcrConversion;
+      }
+      case procaddr::DeviceFunc::DestroySamplerYcbcrConversionKHR: {
+        constexpr bool HasDestroySamplerYcbcrConversionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySamplerYcbcrConversionKHR; };
+        return HasDestroySamplerYcbcrConversionKHR;
+      }
+      case procaddr::DeviceFunc::DestroySemaphore: {
+        constexpr bool HasDestroySemaphore = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySemaphore; };
+        return HasDestroySemaphore;
+      }
+      case procaddr::DeviceFunc::DestroyShaderEXT: {
+        constexpr bool HasDestroyShaderEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyShaderEXT; };
+        return HasDestroyShaderEXT;
+      }
+      case procaddr::DeviceFunc::DestroyShaderModule: {
+        constexpr bool HasDestroyShaderModule = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyShaderModule; };
+        return HasDestroyShaderModule;
+      }
+      case procaddr::DeviceFunc::DestroySwapchainKHR: {
+        constexpr bool HasDestroySwapchainKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySwapchainKHR; };
+        return HasDestroySwapchainKHR;
+      }
+      case procaddr::DeviceFunc::DestroyValidationCacheEXT: {
+        constexpr bool HasDestroyValidationCacheEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyValidationCacheEXT; };
+        return HasDestroyValidationCacheEXT;
+      }
+      case procaddr::DeviceFunc::DestroyVideoSessionKHR: {
+        constexpr bool HasDestroyVideoSessionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyVideoSessionKHR; };
+        return HasDestroyVideoSessionKHR;
+      }
+      case procaddr::DeviceFunc::DestroyVideoSessionParametersKHR: {
+        constexpr bool HasDestroyVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyVideoSessionParametersKHR; };
+        return HasDestroyVideoSessionParametersKHR;
+      }
+      case procaddr::DeviceFunc::DeviceWaitIdle: {
+        constexpr bool HasDeviceWaitIdle = requires(const DeviceOverrides& t) { &DeviceOverrides::DeviceWaitIdle; };
+        return HasDeviceWaitIdle;
+      }
+      case procaddr::DeviceFunc::DisplayPowerControlEXT: {
+        constexpr bool HasDisplayPowerControlEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DisplayPowerControlEXT; };
+        return HasDisplayPowerControlEXT;
+      }
+      case procaddr::DeviceFunc::EndCommandBuffer: {
+        constexpr bool HasEndCommandBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::EndCommandBuffer; };
+        return HasEndCommandBuffer;
+      }
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case procaddr::DeviceFunc::ExportMetalObjectsEXT: {
+        constexpr bool HasExportMetalObjectsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ExportMetalObjectsEXT; };
+        return HasExportMetalObjectsEXT;
+      }
+#endif
+      case procaddr::DeviceFunc::FlushMappedMemoryRanges: {
+        constexpr bool HasFlushMappedMemoryRanges = requires(const DeviceOverrides& t) { &DeviceOverrides::FlushMappedMemoryRanges; };
+        return HasFlushMappedMemoryRanges;
+      }
+      case procaddr::DeviceFunc::FreeCommandBuffers: {
+        constexpr bool HasFreeCommandBuffers = requires(const DeviceOverrides& t) { &DeviceOverrides::FreeCommandBuffers; };
+        return HasFreeCommandBuffers || !std::is_base_of<NoOverrides, DeviceOverrides>::value;
+      }
+      case procaddr::DeviceFunc::FreeDescriptorSets: {
+        constexpr bool HasFreeDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::FreeDescriptorSets; };
+        return HasFreeDescriptorSets;
+      }
+      case procaddr::DeviceFunc::FreeMemory: {
+        constexpr bool HasFreeMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::FreeMemory; };
+        return HasFreeMemory;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureBuildSizesKHR: {
+        constexpr bool HasGetAccelerationStructureBuildSizesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureBuildSizesKHR; };
+        return HasGetAccelerationStructureBuildSizesKHR;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureDeviceAddressKHR: {
+        constexpr bool HasGetAccelerationStructureDeviceAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureDeviceAddressKHR; };
+        return HasGetAccelerationStructureDeviceAddressKHR;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureHandleNV: {
+        constexpr bool HasGetAccelerationStructureHandleNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureHandleNV; };
+        return HasGetAccelerationStructureHandleNV;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureMemoryRequirementsNV: {
+        constexpr bool HasGetAccelerationStructureMemoryRequirementsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureMemoryRequirementsNV; };
+        return HasGetAccelerationStructureMemoryRequirementsNV;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetAccelerationStructureOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT; };
+        return HasGetAccelerationStructureOpaqueCaptureDescriptorDataEXT;
+      }
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case procaddr::DeviceFunc::GetAndroidHardwareBufferPropertiesANDROID: {
+        constexpr bool HasGetAndroidHardwareBufferPropertiesANDROID = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAndroidHardwareBufferPropertiesANDROID; };
+        return HasGetAndroidHardwareBufferPropertiesANDROID;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetBufferCollectionPropertiesFUCHSIA: {
+        constexpr bool HasGetBufferCollectionPropertiesFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferCollectionPropertiesFUCHSIA; };
+        return HasGetBufferCollectionPropertiesFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::GetBufferDeviceAddress: {
+        constexpr bool HasGetBufferDeviceAddress = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferDeviceAddress; };
+        return HasGetBufferDeviceAddress;
+      }
+      case procaddr::DeviceFunc::GetBufferDeviceAddressEXT: {
+        constexpr bool HasGetBufferDeviceAddressEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferDeviceAddressEXT; };
+        return HasGetBufferDeviceAddressEXT;
+      }
+      case procaddr::DeviceFunc::GetBufferDeviceAddressKHR: {
+        constexpr bool HasGetBufferDeviceAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferDeviceAddressKHR; };
+        return HasGetBufferDeviceAddressKHR;
+      }
+      case procaddr::DeviceFunc::GetBufferMemoryRequirements: {
+        constexpr bool HasGetBufferMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferMemoryRequirements; };
+        return HasGetBufferMemoryRequirements;
+      }
+      case procaddr::DeviceFunc::GetBufferMemoryRequirements2: {
+        constexpr bool HasGetBufferMemoryRequirements2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferMemoryRequirements2; };
+        return HasGetBufferMemoryRequirements2;
+      }
+      case procaddr::DeviceFunc::GetBufferMemoryRequirements2KHR: {
+        constexpr bool HasGetBufferMemoryRequirements2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferMemoryRequirements2KHR; };
+        return HasGetBufferMemoryRequirements2KHR;
+      }
+      case procaddr::DeviceFunc::GetBufferOpaqueCaptureAddress: {
+        constexpr bool HasGetBufferOpaqueCaptureAddress = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferOpaqueCaptureAddress; };
+        return HasGetBufferOpaqueCaptureAddress;
+      }
+      case procaddr::DeviceFunc::GetBufferOpaqueCaptureAddressKHR: {
+        constexpr bool HasGetBufferOpaqueCaptureAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferOpaqueCaptureAddressKHR; };
+        return HasGetBufferOpaqueCaptureAddressKHR;
+      }
+      case procaddr::DeviceFunc::GetBufferOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetBufferOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferOpaqueCaptureDescriptorDataEXT; };
+        return HasGetBufferOpaqueCaptureDescriptorDataEXT;
+      }
+      case procaddr::DeviceFunc::GetCalibratedTimestampsEXT: {
+        constexpr bool HasGetCalibratedTimestampsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetCalibratedTimestampsEXT; };
+        return HasGetCalibratedTimestampsEXT;
+      }
+      case procaddr::DeviceFunc::GetDeferredOperationMaxConcurrencyKHR: {
+        constexpr bool HasGetDeferredOperationMaxConcurrencyKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeferredOperationMaxConcurrencyKHR; };
+        return HasGetDeferredOperationMaxConcurrencyKHR;
+      }
+      case procaddr::DeviceFunc::GetDeferredOperationResultKHR: {
+        constexpr bool HasGetDeferredOperationResultKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeferredOperationResultKHR; };
+        return HasGetDeferredOperationResultKHR;
+      }
+      case procaddr::DeviceFunc::GetDescriptorEXT: {
+        constexpr bool HasGetDescriptorEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorEXT; };
+        return HasGetDescriptorEXT;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetHostMappingVALVE: {
+        constexpr bool HasGetDescriptorSetHostMappingVALVE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetHostMappingVALVE; };
+        return HasGetDescriptorSetHostMappingVALVE;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutBindingOffsetEXT: {
+        constexpr bool HasGetDescriptorSetLayoutBindingOffsetEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutBindingOffsetEXT; };
+        return HasGetDescriptorSetLayoutBindingOffsetEXT;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutHostMappingInfoVALVE: {
+        constexpr bool HasGetDescriptorSetLayoutHostMappingInfoVALVE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutHostMappingInfoVALVE; };
+        return HasGetDescriptorSetLayoutHostMappingInfoVALVE;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutSizeEXT: {
+        constexpr bool HasGetDescriptorSetLayoutSizeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutSizeEXT; };
+        return HasGetDescriptorSetLayoutSizeEXT;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutSupport: {
+        constexpr bool HasGetDescriptorSetLayoutSupport = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutSupport; };
+        return HasGetDescriptorSetLayoutSupport;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutSupportKHR: {
+        constexpr bool HasGetDescriptorSetLayoutSupportKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutSupportKHR; };
+        return HasGetDescriptorSetLayoutSupportKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceAccelerationStructureCompatibilityKHR: {
+        constexpr bool HasGetDeviceAccelerationStructureCompatibilityKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceAccelerationStructureCompatibilityKHR; };
+        return HasGetDeviceAccelerationStructureCompatibilityKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceBufferMemoryRequirements: {
+        constexpr bool HasGetDeviceBufferMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceBufferMemoryRequirements; };
+        return HasGetDeviceBufferMemoryRequirements;
+      }
+      case procaddr::DeviceFunc::GetDeviceBufferMemoryRequirementsKHR: {
+        constexpr bool HasGetDeviceBufferMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceBufferMemoryRequirementsKHR; };
+        return HasGetDeviceBufferMemoryRequirementsKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceFaultInfoEXT: {
+        constexpr bool HasGetDeviceFaultInfoEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceFaultInfoEXT; };
+        return HasGetDeviceFaultInfoEXT;
+      }
+      case procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeatures: {
+        constexpr bool HasGetDeviceGroupPeerMemoryFeatures = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupPeerMemoryFeatures; };
+        return HasGetDeviceGroupPeerMemoryFeatures;
+      }
+      case procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeaturesKHR: {
+        constexpr bool HasGetDeviceGroupPeerMemoryFeaturesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupPeerMemoryFeaturesKHR; };
+        return HasGetDeviceGroupPeerMemoryFeaturesKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceGroupPresentCapabilitiesKHR: {
+        constexpr bool HasGetDeviceGroupPresentCapabilitiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupPresentCapabilitiesKHR; };
+        return HasGetDeviceGroupPresentCapabilitiesKHR;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModes2EXT: {
+        constexpr bool HasGetDeviceGroupSurfacePresentModes2EXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupSurfacePresentModes2EXT; };
+        return HasGetDeviceGroupSurfacePresentModes2EXT;
+      }
+#endif
+      case procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModesKHR: {
+        constexpr bool HasGetDeviceGroupSurfacePresentModesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupSurfacePresentModesKHR; };
+        return HasGetDeviceGroupSurfacePresentModesKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageMemoryRequirements: {
+        constexpr bool HasGetDeviceImageMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageMemoryRequirements; };
+        return HasGetDeviceImageMemoryRequirements;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageMemoryRequirementsKHR: {
+        constexpr bool HasGetDeviceImageMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageMemoryRequirementsKHR; };
+        return HasGetDeviceImageMemoryRequirementsKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirements: {
+        constexpr bool HasGetDeviceImageSparseMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageSparseMemoryRequirements; };
+        return HasGetDeviceImageSparseMemoryRequirements;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirementsKHR: {
+        constexpr bool HasGetDeviceImageSparseMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageSparseMemoryRequirementsKHR; };
+        return HasGetDeviceImageSparseMemoryRequirementsKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceMemoryCommitment: {
+        constexpr bool HasGetDeviceMemoryCommitment = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMemoryCommitment; };
+        return HasGetDeviceMemoryCommitment;
+      }
+      case procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddress: {
+        constexpr bool HasGetDeviceMemoryOpaqueCaptureAddress = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMemoryOpaqueCaptureAddress; };
+        return HasGetDeviceMemoryOpaqueCaptureAddress;
+      }
+      case procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddressKHR: {
+        constexpr bool HasGetDeviceMemoryOpaqueCaptureAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMemoryOpaqueCaptureAddressKHR; };
+        return HasGetDeviceMemoryOpaqueCaptureAddressKHR;
+      }
+      case procaddr::DeviceFunc::GetDeviceMicromapCompatibilityEXT: {
+        constexpr bool HasGetDeviceMicromapCompatibilityEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMicromapCompatibilityEXT; };
+        return HasGetDeviceMicromapCompatibilityEXT;
+      }
+      case procaddr::DeviceFunc::GetDeviceProcAddr: {
+        return true;
+      }
+      case procaddr::DeviceFunc::GetDeviceQueue: {
+        constexpr bool HasGetDeviceQueue = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceQueue; };
+        return HasGetDeviceQueue;
+      }
+      case procaddr::DeviceFunc::GetDeviceQueue2: {
+        constexpr bool HasGetDeviceQueue2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceQueue2; };
+        return HasGetDeviceQueue2;
+      }
+      case procaddr::DeviceFunc::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI: {
+        constexpr bool HasGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI; };
+        return HasGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI;
+      }
+      case procaddr::DeviceFunc::GetDynamicRenderingTilePropertiesQCOM: {
+        constexpr bool HasGetDynamicRenderingTilePropertiesQCOM = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDynamicRenderingTilePropertiesQCOM; };
+        return HasGetDynamicRenderingTilePropertiesQCOM;
+      }
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case procaddr::DeviceFunc::GetEncodedVideoSessionParametersKHR: {
+        constexpr bool HasGetEncodedVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetEncodedVideoSessionParametersKHR; };
+        return HasGetEncodedVideoSessionParametersKHR;
+      }
+#endif
+      case procaddr::DeviceFunc::GetEventStatus: {
+        constexpr bool HasGetEventStatus = requires(const DeviceOverrides& t) { &DeviceOverrides::GetEventStatus; };
+        return HasGetEventStatus;
+      }
+      case procaddr::DeviceFunc::GetFenceFdKHR: {
+        constexpr bool HasGetFenceFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFenceFdKHR; };
+        return HasGetFenceFdKHR;
+      }
+      case procaddr::DeviceFunc::GetFenceStatus: {
+        constexpr bool HasGetFenceStatus = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFenceStatus; };
+        return HasGetFenceStatus;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetFenceWin32HandleKHR: {
+        constexpr bool HasGetFenceWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFenceWin32HandleKHR; };
+        return HasGetFenceWin32HandleKHR;
+      }
+#endif
+      case procaddr::DeviceFunc::GetFramebufferTilePropertiesQCOM: {
+        constexpr bool HasGetFramebufferTilePropertiesQCOM = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFramebufferTilePropertiesQCOM; };
+        return HasGetFramebufferTilePropertiesQCOM;
+      }
+      case procaddr::DeviceFunc::GetGeneratedCommandsMemoryRequirementsNV: {
+        constexpr bool HasGetGeneratedCommandsMemoryRequirementsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetGeneratedCommandsMemoryRequirementsNV; };
+        return HasGetGeneratedCommandsMemoryRequirementsNV;
+      }
+      case procaddr::DeviceFunc::GetImageDrmFormatModifierPropertiesEXT: {
+        constexpr bool HasGetImageDrmFormatModifierPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageDrmFormatModifierPropertiesEXT; };
+        return HasGetImageDrmFormatModifierPropertiesEXT;
+      }
+      case procaddr::DeviceFunc::GetImageMemoryRequirements: {
+        constexpr bool HasGetImageMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageMemoryRequirements; };
+        return HasGetImageMemoryRequirements;
+      }
+      case procaddr::DeviceFunc::GetImageMemoryRequirements2: {
+        constexpr bool HasGetImageMemoryRequirements2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageMemoryRequirements2; };
+        return HasGetImageMemoryRequirements2;
+      }
+      case procaddr::DeviceFunc::GetImageMemoryRequirements2KHR: {
+        constexpr bool HasGetImageMemoryRequirements2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageMemoryRequirements2KHR; };
+        return HasGetImageMemoryRequirements2KHR;
+      }
+      case procaddr::DeviceFunc::GetImageOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetImageOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageOpaqueCaptureDescriptorDataEXT; };
+        return HasGetImageOpaqueCaptureDescriptorDataEXT;
+      }
+      case procaddr::DeviceFunc::GetImageSparseMemoryRequirements: {
+        constexpr bool HasGetImageSparseMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSparseMemoryRequirements; };
+        return HasGetImageSparseMemoryRequirements;
+      }
+      case procaddr::DeviceFunc::GetImageSparseMemoryRequirements2: {
+        constexpr bool HasGetImageSparseMemoryRequirements2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSparseMemoryRequirements2; };
+        return HasGetImageSparseMemoryRequirements2;
+      }
+      case procaddr::DeviceFunc::GetImageSparseMemoryRequirements2KHR: {
+        constexpr bool HasGetImageSparseMemoryRequirements2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSparseMemoryRequirements2KHR; };
+        return HasGetImageSparseMemoryRequirements2KHR;
+      }
+      case procaddr::DeviceFunc::GetImageSubresourceLayout: {
+        constexpr bool HasGetImageSubresourceLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSubresourceLayout; };
+        return HasGetImageSubresourceLayout;
+      }
+      case procaddr::DeviceFunc::GetImageSubresourceLayout2EXT: {
+        constexpr bool HasGetImageSubresourceLayout2EXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSubresourceLayout2EXT; };
+        return HasGetImageSubresourceLayout2EXT;
+      }
+      case procaddr::DeviceFunc::GetImageViewOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetImageViewOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageViewOpaqueCaptureDescriptorDataEXT; };
+        return HasGetImageViewOpaqueCaptureDescriptorDataEXT;
+      }
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case procaddr::DeviceFunc::GetMemoryAndroidHardwareBufferANDROID: {
+        constexpr bool HasGetMemoryAndroidHardwareBufferANDROID = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryAndroidHardwareBufferANDROID; };
+        return HasGetMemoryAndroidHardwareBufferANDROID;
+      }
+#endif
+      case procaddr::DeviceFunc::GetMemoryFdKHR: {
+        constexpr bool HasGetMemoryFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryFdKHR; };
+        return HasGetMemoryFdKHR;
+      }
+      case procaddr::DeviceFunc::GetMemoryFdPropertiesKHR: {
+        constexpr bool HasGetMemoryFdPropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryFdPropertiesKHR; };
+        return HasGetMemoryFdPropertiesKHR;
+      }
+      case procaddr::DeviceFunc::GetMemoryHostPointerPropertiesEXT: {
+        constexpr bool HasGetMemoryHostPointerPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryHostPointerPropertiesEXT; };
+        return HasGetMemoryHostPointerPropertiesEXT;
+      }
+      case procaddr::DeviceFunc::GetMemoryRemoteAddressNV: {
+        constexpr bool HasGetMemoryRemoteAddressNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryRemoteAddressNV; };
+        return HasGetMemoryRemoteAddressNV;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetMemoryWin32HandleKHR: {
+        constexpr bool HasGetMemoryWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryWin32HandleKHR; };
+        return HasGetMemoryWin32HandleKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetMemoryWin32HandleNV: {
+        constexpr bool HasGetMemoryWin32HandleNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryWin32HandleNV; };
+        return HasGetMemoryWin32HandleNV;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetMemoryWin32HandlePropertiesKHR: {
+        constexpr bool HasGetMemoryWin32HandlePropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryWin32HandlePropertiesKHR; };
+        return HasGetMemoryWin32HandlePropertiesKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetMemoryZirconHandleFUCHSIA: {
+        constexpr bool HasGetMemoryZirconHandleFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryZirconHandleFUCHSIA; };
+        return HasGetMemoryZirconHandleFUCHSIA;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetMemoryZirconHandlePropertiesFUCHSIA: {
+        constexpr bool HasGetMemoryZirconHandlePropertiesFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryZirconHandlePropertiesFUCHSIA; };
+        return HasGetMemoryZirconHandlePropertiesFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::GetMicromapBuildSizesEXT: {
+        constexpr bool HasGetMicromapBuildSizesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMicromapBuildSizesEXT; };
+        return HasGetMicromapBuildSizesEXT;
+      }
+      case procaddr::DeviceFunc::GetPastPresentationTimingGOOGLE: {
+        constexpr bool HasGetPastPresentationTimingGOOGLE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPastPresentationTimingGOOGLE; };
+        return HasGetPastPresentationTimingGOOGLE;
+      }
+      case procaddr::DeviceFunc::GetPerformanceParameterINTEL: {
+        constexpr bool HasGetPerformanceParameterINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPerformanceParameterINTEL; };
+        return HasGetPerformanceParameterINTEL;
+      }
+      case procaddr::DeviceFunc::GetPipelineCacheData: {
+        constexpr bool HasGetPipelineCacheData = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineCacheData; };
+        return HasGetPipelineCacheData;
+      }
+      case procaddr::DeviceFunc::GetPipelineExecutableInternalRepresentationsKHR: {
+        constexpr bool HasGetPipelineExecutableInternalRepresentationsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineExecutableInternalRepresentationsKHR; };
+        return HasGetPipelineExecutableInternalRepresentationsKHR;
+      }
+      case procaddr::DeviceFunc::GetPipelineExecutablePropertiesKHR: {
+        constexpr bool HasGetPipelineExecutablePropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineExecutablePropertiesKHR; };
+        return HasGetPipelineExecutablePropertiesKHR;
+      }
+      case procaddr::DeviceFunc::GetPipelineExecutableStatisticsKHR: {
+        constexpr bool HasGetPipelineExecutableStatisticsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineExecutableStatisticsKHR; };
+        return HasGetPipelineExecutableStatisticsKHR;
+      }
+      case procaddr::DeviceFunc::GetPipelinePropertiesEXT: {
+        constexpr bool HasGetPipelinePropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelinePropertiesEXT; };
+        return HasGetPipelinePropertiesEXT;
+      }
+      case procaddr::DeviceFunc::GetPrivateData: {
+        constexpr bool HasGetPrivateData = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPrivateData; };
+        return HasGetPrivateData;
+      }
+      case procaddr::DeviceFunc::GetPrivateDataEXT: {
+        constexpr bool HasGetPrivateDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPrivateDataEXT; };
+        return HasGetPrivateDataEXT;
+      }
+      case procaddr::DeviceFunc::GetQueryPoolResults: {
+        constexpr bool HasGetQueryPoolResults = requires(const DeviceOverrides& t) { &DeviceOverrides::GetQueryPoolResults; };
+        return HasGetQueryPoolResults;
+      }
+      case procaddr::DeviceFunc::GetQueueCheckpointData2NV: {
+        constexpr bool HasGetQueueCheckpointData2NV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetQueueCheckpointData2NV; };
+        return HasGetQueueCheckpointData2NV;
+      }
+      case procaddr::DeviceFunc::GetQueueCheckpointDataNV: {
+        constexpr bool HasGetQueueCheckpointDataNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetQueueCheckpointDataNV; };
+        return HasGetQueueCheckpointDataNV;
+      }
+      case procaddr::DeviceFunc::GetRayTracingCaptureReplayShaderGroupHandlesKHR: {
+        constexpr bool HasGetRayTracingCaptureReplayShaderGroupHandlesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingCaptureReplayShaderGroupHandlesKHR; };
+        return HasGetRayTracingCaptureReplayShaderGroupHandlesKHR;
+      }
+      case procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesKHR: {
+        constexpr bool HasGetRayTracingShaderGroupHandlesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingShaderGroupHandlesKHR; };
+        return HasGetRayTracingShaderGroupHandlesKHR;
+      }
+      case procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesNV: {
+        constexpr bool HasGetRayTracingShaderGroupHandlesNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingShaderGroupHandlesNV; };
+        return HasGetRayTracingShaderGroupHandlesNV;
+      }
+      case procaddr::DeviceFunc::GetRayTracingShaderGroupStackSizeKHR: {
+        constexpr bool HasGetRayTracingShaderGroupStackSizeKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingShaderGroupStackSizeKHR; };
+        return HasGetRayTracingShaderGroupStackSizeKHR;
+      }
+      case procaddr::DeviceFunc::GetRefreshCycleDurationGOOGLE: {
+        constexpr bool HasGetRefreshCycleDurationGOOGLE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRefreshCycleDurationGOOGLE; };
+        return HasGetRefreshCycleDurationGOOGLE;
+      }
+      case procaddr::DeviceFunc::GetRenderAreaGranularity: {
+        constexpr bool HasGetRenderAreaGranularity = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRenderAreaGranularity; };
+        return HasGetRenderAreaGranularity;
+      }
+      case procaddr::DeviceFunc::GetSamplerOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetSamplerOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSamplerOpaqueCaptureDescriptorDataEXT; };
+        return HasGetSamplerOpaqueCaptureDescriptorDataEXT;
+      }
+      case procaddr::DeviceFunc::GetSemaphoreCounterValue: {
+        constexpr bool HasGetSemaphoreCounterValue = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreCounterValue; };
+        return HasGetSemaphoreCounterValue;
+      }
+      case procaddr::DeviceFunc::GetSemaphoreCounterValueKHR: {
+        constexpr bool HasGetSemaphoreCounterValueKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreCounterValueKHR; };
+        return HasGetSemaphoreCounterValueKHR;
+      }
+      case procaddr::DeviceFunc::GetSemaphoreFdKHR: {
+        constexpr bool HasGetSemaphoreFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreFdKHR; };
+        return HasGetSemaphoreFdKHR;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetSemaphoreWin32HandleKHR: {
+        constexpr bool HasGetSemaphoreWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreWin32HandleKHR; };
+        return HasGetSemaphoreWin32HandleKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetSemaphoreZirconHandleFUCHSIA: {
+        constexpr bool HasGetSemaphoreZirconHandleFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreZirconHandleFUCHSIA; };
+        return HasGetSemaphoreZirconHandleFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::GetShaderBinaryDataEXT: {
+        constexpr bool HasGetShaderBinaryDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderBinaryDataEXT; };
+        return HasGetShaderBinaryDataEXT;
+      }
+      case procaddr::DeviceFunc::GetShaderInfoAMD: {
+        constexpr bool HasGetShaderInfoAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderInfoAMD; };
+        return HasGetShaderInfoAMD;
+      }
+      case procaddr::DeviceFunc::GetShaderModuleCreateInfoIdentifierEXT: {
+        constexpr bool HasGetShaderModuleCreateInfoIdentifierEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderModuleCreateInfoIdentifierEXT; };
+        return HasGetShaderModuleCreateInfoIdentifierEXT;
+      }
+      case procaddr::DeviceFunc::GetShaderModuleIdentifierEXT: {
+        constexpr bool HasGetShaderModuleIdentifierEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderModuleIdentifierEXT; };
+        return HasGetShaderModuleIdentifierEXT;
+      }
+      case procaddr::DeviceFunc::GetSwapchainCounterEXT: {
+        constexpr bool HasGetSwapchainCounterEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSwapchainCounterEXT; };
+        return HasGetSwapchainCounterEXT;
+      }
+      case procaddr::DeviceFunc::GetSwapchainImagesKHR: {
+        constexpr bool HasGetSwapchainImagesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSwapchainImagesKHR; };
+        return HasGetSwapchainImagesKHR;
+      }
+      case procaddr::DeviceFunc::GetSwapchainStatusKHR: {
+        constexpr bool HasGetSwapchainStatusKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSwapchainStatusKHR; };
+        return HasGetSwapchainStatusKHR;
+      }
+      case procaddr::DeviceFunc::GetValidationCacheDataEXT: {
+        constexpr bool HasGetValidationCacheDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetValidationCacheDataEXT; };
+        return HasGetValidationCacheDataEXT;
+      }
+      case procaddr::DeviceFunc::GetVideoSessionMemoryRequirementsKHR: {
+        constexpr bool HasGetVideoSessionMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetVideoSessionMemoryRequirementsKHR; };
+        return HasGetVideoSessionMemoryRequirementsKHR;
+      }
+      case procaddr::DeviceFunc::ImportFenceFdKHR: {
+        constexpr bool HasImportFenceFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportFenceFdKHR; };
+        return HasImportFenceFdKHR;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::ImportFenceWin32HandleKHR: {
+        constexpr bool HasImportFenceWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportFenceWin32HandleKHR; };
+        return HasImportFenceWin32HandleKHR;
+      }
+#endif
+      case procaddr::DeviceFunc::ImportSemaphoreFdKHR: {
+        constexpr bool HasImportSemaphoreFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportSemaphoreFdKHR; };
+        return HasImportSemaphoreFdKHR;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::ImportSemaphoreWin32HandleKHR: {
+        constexpr bool HasImportSemaphoreWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportSemaphoreWin32HandleKHR; };
+        return HasImportSemaphoreWin32HandleKHR;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::ImportSemaphoreZirconHandleFUCHSIA: {
+        constexpr bool HasImportSemaphoreZirconHandleFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportSemaphoreZirconHandleFUCHSIA; };
+        return HasImportSemaphoreZirconHandleFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::InitializePerformanceApiINTEL: {
+        constexpr bool HasInitializePerformanceApiINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::InitializePerformanceApiINTEL; };
+        return HasInitializePerformanceApiINTEL;
+      }
+      case procaddr::DeviceFunc::InvalidateMappedMemoryRanges: {
+        constexpr bool HasInvalidateMappedMemoryRanges = requires(const DeviceOverrides& t) { &DeviceOverrides::InvalidateMappedMemoryRanges; };
+        return HasInvalidateMappedMemoryRanges;
+      }
+      case procaddr::DeviceFunc::MapMemory: {
+        constexpr bool HasMapMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::MapMemory; };
+        return HasMapMemory;
+      }
+      case procaddr::DeviceFunc::MapMemory2KHR: {
+        constexpr bool HasMapMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::MapMemory2KHR; };
+        return HasMapMemory2KHR;
+      }
+      case procaddr::DeviceFunc::MergePipelineCaches: {
+        constexpr bool HasMergePipelineCaches = requires(const DeviceOverrides& t) { &DeviceOverrides::MergePipelineCaches; };
+        return HasMergePipelineCaches;
+      }
+      case procaddr::DeviceFunc::MergeValidationCachesEXT: {
+        constexpr bool HasMergeValidationCachesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::MergeValidationCachesEXT; };
+        return HasMergeValidationCachesEXT;
+      }
+      case procaddr::DeviceFunc::QueueBeginDebugUtilsLabelEXT: {
+        constexpr bool HasQueueBeginDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueBeginDebugUtilsLabelEXT; };
+        return HasQueueBeginDebugUtilsLabelEXT;
+      }
+      case procaddr::DeviceFunc::QueueBindSparse: {
+        constexpr bool HasQueueBindSparse = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueBindSparse; };
+        return HasQueueBindSparse;
+      }
+      case procaddr::DeviceFunc::QueueEndDebugUtilsLabelEXT: {
+        constexpr bool HasQueueEndDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueEndDebugUtilsLabelEXT; };
+        return HasQueueEndDebugUtilsLabelEXT;
+      }
+      case procaddr::DeviceFunc::QueueInsertDebugUtilsLabelEXT: {
+        constexpr bool HasQueueInsertDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueInsertDebugUtilsLabelEXT; };
+        return HasQueueInsertDebugUtilsLabelEXT;
+      }
+      case procaddr::DeviceFunc::QueuePresentKHR: {
+        constexpr bool HasQueuePresentKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::QueuePresentKHR; };
+        return HasQueuePresentKHR;
+      }
+      case procaddr::DeviceFunc::QueueSetPerformanceConfigurationINTEL: {
+        constexpr bool HasQueueSetPerformanceConfigurationINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSetPerformanceConfigurationINTEL; };
+        return HasQueueSetPerformanceConfigurationINTEL;
+      }
+      case procaddr::DeviceFunc::QueueSubmit: {
+        constexpr bool HasQueueSubmit = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSubmit; };
+        return HasQueueSubmit;
+      }
+      case procaddr::DeviceFunc::QueueSubmit2: {
+        constexpr bool HasQueueSubmit2 = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSubmit2; };
+        return HasQueueSubmit2;
+      }
+      case procaddr::DeviceFunc::QueueSubmit2KHR: {
+        constexpr bool HasQueueSubmit2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSubmit2KHR; };
+        return HasQueueSubmit2KHR;
+      }
+      case procaddr::DeviceFunc::QueueWaitIdle: {
+        constexpr bool HasQueueWaitIdle = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueWaitIdle; };
+        return HasQueueWaitIdle;
+      }
+      case procaddr::DeviceFunc::RegisterDeviceEventEXT: {
+        constexpr bool HasRegisterDeviceEventEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::RegisterDeviceEventEXT; };
+        return HasRegisterDeviceEventEXT;
+      }
+      case procaddr::DeviceFunc::RegisterDisplayEventEXT: {
+        constexpr bool HasRegisterDisplayEventEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::RegisterDisplayEventEXT; };
+        return HasRegisterDisplayEventEXT;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::ReleaseFullScreenExclusiveModeEXT: {
+        constexpr bool HasReleaseFullScreenExclusiveModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleaseFullScreenExclusiveModeEXT; };
+        return HasReleaseFullScreenExclusiveModeEXT;
+      }
+#endif
+      case procaddr::DeviceFunc::ReleasePerformanceConfigurationINTEL: {
+        constexpr bool HasReleasePerformanceConfigurationINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleasePerformanceConfigurationINTEL; };
+        return HasReleasePerformanceConfigurationINTEL;
+      }
+      case procaddr::DeviceFunc::ReleaseProfilingLockKHR: {
+        constexpr bool HasReleaseProfilingLockKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleaseProfilingLockKHR; };
+        return HasReleaseProfilingLockKHR;
+      }
+      case procaddr::DeviceFunc::ReleaseSwapchainImagesEXT: {
+        constexpr bool HasReleaseSwapchainImagesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleaseSwapchainImagesEXT; };
+        return HasReleaseSwapchainImagesEXT;
+      }
+      case procaddr::DeviceFunc::ResetCommandBuffer: {
+        constexpr bool HasResetCommandBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetCommandBuffer; };
+        return HasResetCommandBuffer;
+      }
+      case procaddr::DeviceFunc::ResetCommandPool: {
+        constexpr bool HasResetCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetCommandPool; };
+        return HasResetCommandPool;
+      }
+      case procaddr::DeviceFunc::ResetDescriptorPool: {
+        constexpr bool HasResetDescriptorPool = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetDescriptorPool; };
+        return HasResetDescriptorPool;
+      }
+      case procaddr::DeviceFunc::ResetEvent: {
+        constexpr bool HasResetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetEvent; };
+        return HasResetEvent;
+      }
+      case procaddr::DeviceFunc::ResetFences: {
+        constexpr bool HasResetFences = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetFences; };
+        return HasResetFences;
+      }
+      case procaddr::DeviceFunc::ResetQueryPool: {
+        constexpr bool HasResetQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetQueryPool; };
+        return HasResetQueryPool;
+      }
+      case procaddr::DeviceFunc::ResetQueryPoolEXT: {
+        constexpr bool HasResetQueryPoolEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetQueryPoolEXT; };
+        return HasResetQueryPoolEXT;
+      }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::SetBufferCollectionBufferConstraintsFUCHSIA: {
+        constexpr bool HasSetBufferCollectionBufferConstraintsFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::SetBufferCollectionBufferConstraintsFUCHSIA; };
+        return HasSetBufferCollectionBufferConstraintsFUCHSIA;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::SetBufferCollectionImageConstraintsFUCHSIA: {
+        constexpr bool HasSetBufferCollectionImageConstraintsFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::SetBufferCollectionImageConstraintsFUCHSIA; };
+        return HasSetBufferCollectionImageConstraintsFUCHSIA;
+      }
+#endif
+      case procaddr::DeviceFunc::SetDebugUtilsObjectNameEXT: {
+        constexpr bool HasSetDebugUtilsObjectNameEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetDebugUtilsObjectNameEXT; };
+        return HasSetDebugUtilsObjectNameEXT;
+      }
+      case procaddr::DeviceFunc::SetDebugUtilsObjectTagEXT: {
+        constexpr bool HasSetDebugUtilsObjectTagEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetDebugUtilsObjectTagEXT; };
+        return HasSetDebugUtilsObjectTagEXT;
+      }
+      case procaddr::DeviceFunc::SetDeviceMemoryPriorityEXT: {
+        constexpr bool HasSetDeviceMemoryPriorityEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetDeviceMemoryPriorityEXT; };
+        return HasSetDeviceMemoryPriorityEXT;
+      }
+      case procaddr::DeviceFunc::SetEvent: {
+        constexpr bool HasSetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::SetEvent; };
+        return HasSetEvent;
+      }
+      case procaddr::DeviceFunc::SetHdrMetadataEXT: {
+        constexpr bool HasSetHdrMetadataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetHdrMetadataEXT; };
+        return HasSetHdrMetadataEXT;
+      }
+      case procaddr::DeviceFunc::SetLocalDimmingAMD: {
+        constexpr bool HasSetLocalDimmingAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::SetLocalDimmingAMD; };
+        return HasSetLocalDimmingAMD;
+      }
+      case procaddr::DeviceFunc::SetPrivateData: {
+        constexpr bool HasSetPrivateData = requires(const DeviceOverrides& t) { &DeviceOverrides::SetPrivateData; };
+        return HasSetPrivateData;
+      }
+      case procaddr::DeviceFunc::SetPrivateDataEXT: {
+        constexpr bool HasSetPrivateDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetPrivateDataEXT; };
+        return HasSetPrivateDataEXT;
+      }
+      case procaddr::DeviceFunc::SignalSemaphore: {
+        constexpr bool HasSignalSemaphore = requires(const DeviceOverrides& t) { &DeviceOverrides::SignalSemaphore; };
+        return HasSignalSemaphore;
+      }
+      case procaddr::DeviceFunc::SignalSemaphoreKHR: {
+        constexpr bool HasSignalSemaphoreKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::SignalSemaphoreKHR; };
+        return HasSignalSemaphoreKHR;
+      }
+      case procaddr::DeviceFunc::TrimCommandPool: {
+        constexpr bool HasTrimCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::TrimCommandPool; };
+        return HasTrimCommandPool;
+      }
+      case procaddr::DeviceFunc::TrimCommandPoolKHR: {
+        constexpr bool HasTrimCommandPoolKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::TrimCommandPoolKHR; };
+        return HasTrimCommandPoolKHR;
+      }
+      case procaddr::DeviceFunc::UninitializePerformanceApiINTEL: {
+        constexpr bool HasUninitializePerformanceApiINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::UninitializePerformanceApiINTEL; };
+        return HasUninitializePerformanceApiINTEL;
+      }
+      case procaddr::DeviceFunc::UnmapMemory: {
+        constexpr bool HasUnmapMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::UnmapMemory; };
+        return HasUnmapMemory;
+      }
+      case procaddr::DeviceFunc::UnmapMemory2KHR: {
+        constexpr bool HasUnmapMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::UnmapMemory2KHR; };
+        return HasUnmapMemory2KHR;
+      }
+      case procaddr::DeviceFunc::UpdateDescriptorSetWithTemplate: {
+        constexpr bool HasUpdateDescriptorSetWithTemplate = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateDescriptorSetWithTemplate; };
+        return HasUpdateDescriptorSetWithTemplate;
+      }
+      case procaddr::DeviceFunc::UpdateDescriptorSetWithTemplateKHR: {
+        constexpr bool HasUpdateDescriptorSetWithTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateDescriptorSetWithTemplateKHR; };
+        return HasUpdateDescriptorSetWithTemplateKHR;
+      }
+      case procaddr::DeviceFunc::UpdateDescriptorSets: {
+        constexpr bool HasUpdateDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateDescriptorSets; };
+        return HasUpdateDescriptorSets;
+      }
+      case procaddr::DeviceFunc::UpdateVideoSessionParametersKHR: {
+        constexpr bool HasUpdateVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateVideoSessionParametersKHR; };
+        return HasUpdateVideoSessionParametersKHR;
+      }
+      case procaddr::DeviceFunc::WaitForFences: {
+        constexpr bool HasWaitForFences = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitForFences; };
+        return HasWaitForFences;
+      }
+      case procaddr::DeviceFunc::WaitForPresentKHR: {
+        constexpr bool HasWaitForPresentKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitForPresentKHR; };
+        return HasWaitForPresentKHR;
+      }
+      case procaddr::DeviceFunc::WaitSemaphores: {
+        constexpr bool HasWaitSemaphores = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitSemaphores; };
+        return HasWaitSemaphores;
+      }
+      case procaddr::DeviceFunc::WaitSemaphoresKHR: {
+        constexpr bool HasWaitSemaphoresKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitSemaphoresKHR; };
+        return HasWaitSemaphoresKHR;
+      }
+      case procaddr::DeviceFunc::WriteAccelerationStructuresPropertiesKHR: {
+        constexpr bool HasWriteAccelerationStructuresPropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::WriteAccelerationStructuresPropertiesKHR; };
+        return HasWriteAccelerationStructuresPropertiesKHR;
+      }
+      case procaddr::DeviceFunc::WriteMicromapsPropertiesEXT: {
+        constexpr bool HasWriteMicromapsPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::WriteMicromapsPropertiesEXT; };
+        return HasWriteMicromapsPropertiesEXT;
+      }
+      default:
+        return false;
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  PFN_vkVoidFunction GetDeviceProcAddr(VkDevice device, const char* name) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    using HookedFuncs = procaddr::HookedFuncTable<procaddr::DeviceFuncNames, &IsDeviceFuncHooked<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>>;
+    switch (HookedFuncs::Find(name)) {
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::AcquireFullScreenExclusiveModeEXT: {
+        constexpr bool HasAcquireFullScreenExclusiveModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireFullScreenExclusiveModeEXT; };
+        if constexpr (HasAcquireFullScreenExclusiveModeEXT)
+          return (PFN_vkVoidFunction) &wrap_AcquireFullScreenExclusiveModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::AcquireNextImage2KHR: {
+        constexpr bool HasAcquireNextImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireNextImage2KHR; };
+        if constexpr (HasAcquireNextImage2KHR)
+          return (PFN_vkVoidFunction) &wrap_AcquireNextImage2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::AcquireNextImageKHR: {
+        constexpr bool HasAcquireNextImageKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireNextImageKHR; };
+        if constexpr (HasAcquireNextImageKHR)
+          return (PFN_vkVoidFunction) &wrap_AcquireNextImageKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::AcquirePerformanceConfigurationINTEL: {
+        constexpr bool HasAcquirePerformanceConfigurationINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquirePerformanceConfigurationINTEL; };
+        if constexpr (HasAcquirePerformanceConfigurationINTEL)
+          return (PFN_vkVoidFunction) &wrap_AcquirePerformanceConfigurationINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::AcquireProfilingLockKHR: {
+        constexpr bool HasAcquireProfilingLockKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::AcquireProfilingLockKHR; };
+        if constexpr (HasAcquireProfilingLockKHR)
+          return (PFN_vkVoidFunction) &wrap_AcquireProfilingLockKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::AllocateCommandBuffers: {
+        constexpr bool HasAllocateCommandBuffers = requires(const DeviceOverrides& t) { &DeviceOverrides::AllocateCommandBuffers; };
+        if constexpr (HasAllocateCommandBuffers)
+          return (PFN_vkVoidFunction) &wrap_AllocateCommandBuffers<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else if constexpr (!std::is_base_of<NoOverrides, DeviceOverrides>::value)
+          return (PFN_vkVoidFunction) &implicit_wrap_AllocateCommandBuffers<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::AllocateDescriptorSets: {
+        constexpr bool HasAllocateDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::AllocateDescriptorSets; };
+        if constexpr (HasAllocateDescriptorSets)
+          return (PFN_vkVoidFunction) &wrap_AllocateDescriptorSets<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::AllocateMemory: {
+        constexpr bool HasAllocateMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::AllocateMemory; };
+        if constexpr (HasAllocateMemory)
+          return (PFN_vkVoidFunction) &wrap_AllocateMemory<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BeginCommandBuffer: {
+        constexpr bool HasBeginCommandBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::BeginCommandBuffer; };
+        if constexpr (HasBeginCommandBuffer)
+          return (PFN_vkVoidFunction) &wrap_BeginCommandBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindAccelerationStructureMemoryNV: {
+        constexpr bool HasBindAccelerationStructureMemoryNV = requires(const DeviceOverrides& t) { &DeviceOverrides::BindAccelerationStructureMemoryNV; };
+        if constexpr (HasBindAccelerationStructureMemoryNV)
+          return (PFN_vkVoidFunction) &wrap_BindAccelerationStructureMemoryNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindBufferMemory: {
+        constexpr bool HasBindBufferMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::BindBufferMemory; };
+        if constexpr (HasBindBufferMemory)
+          return (PFN_vkVoidFunction) &wrap_BindBufferMemory<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindBufferMemory2: {
+        constexpr bool HasBindBufferMemory2 = requires(const DeviceOverrides& t) { &DeviceOverrides::BindBufferMemory2; };
+        if constexpr (HasBindBufferMemory2)
+          return (PFN_vkVoidFunction) &wrap_BindBufferMemory2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindBufferMemory2KHR: {
+        constexpr bool HasBindBufferMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BindBufferMemory2KHR; };
+        if constexpr (HasBindBufferMemory2KHR)
+          return (PFN_vkVoidFunction) &wrap_BindBufferMemory2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindImageMemory: {
+        constexpr bool HasBindImageMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::BindImageMemory; };
+        if constexpr (HasBindImageMemory)
+          return (PFN_vkVoidFunction) &wrap_BindImageMemory<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindImageMemory2: {
+        constexpr bool HasBindImageMemory2 = requires(const DeviceOverrides& t) { &DeviceOverrides::BindImageMemory2; };
+        if constexpr (HasBindImageMemory2)
+          return (PFN_vkVoidFunction) &wrap_BindImageMemory2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindImageMemory2KHR: {
+        constexpr bool HasBindImageMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BindImageMemory2KHR; };
+        if constexpr (HasBindImageMemory2KHR)
+          return (PFN_vkVoidFunction) &wrap_BindImageMemory2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindOpticalFlowSessionImageNV: {
+        constexpr bool HasBindOpticalFlowSessionImageNV = requires(const DeviceOverrides& t) { &DeviceOverrides::BindOpticalFlowSessionImageNV; };
+        if constexpr (HasBindOpticalFlowSessionImageNV)
+          return (PFN_vkVoidFunction) &wrap_BindOpticalFlowSessionImageNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BindVideoSessionMemoryKHR: {
+        constexpr bool HasBindVideoSessionMemoryKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BindVideoSessionMemoryKHR; };
+        if constexpr (HasBindVideoSessionMemoryKHR)
+          return (PFN_vkVoidFunction) &wrap_BindVideoSessionMemoryKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BuildAccelerationStructuresKHR: {
+        constexpr bool HasBuildAccelerationStructuresKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::BuildAccelerationStructuresKHR; };
+        if constexpr (HasBuildAccelerationStructuresKHR)
+          return (PFN_vkVoidFunction) &wrap_BuildAccelerationStructuresKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::BuildMicromapsEXT: {
+        constexpr bool HasBuildMicromapsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::BuildMicromapsEXT; };
+        if constexpr (HasBuildMicromapsEXT)
+          return (PFN_vkVoidFunction) &wrap_BuildMicromapsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginConditionalRenderingEXT: {
+        constexpr bool HasCmdBeginConditionalRenderingEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginConditionalRenderingEXT; };
+        if constexpr (HasCmdBeginConditionalRenderingEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginConditionalRenderingEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginDebugUtilsLabelEXT: {
+        constexpr bool HasCmdBeginDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginDebugUtilsLabelEXT; };
+        if constexpr (HasCmdBeginDebugUtilsLabelEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginDebugUtilsLabelEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginQuery: {
+        constexpr bool HasCmdBeginQuery = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginQuery; };
+        if constexpr (HasCmdBeginQuery)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginQuery<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginQueryIndexedEXT: {
+        constexpr bool HasCmdBeginQueryIndexedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginQueryIndexedEXT; };
+        if constexpr (HasCmdBeginQueryIndexedEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginQueryIndexedEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderPass: {
+        constexpr bool HasCmdBeginRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderPass; };
+        if constexpr (HasCmdBeginRenderPass)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginRenderPass<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderPass2: {
+        constexpr bool HasCmdBeginRenderPass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderPass2; };
+        if constexpr (HasCmdBeginRenderPass2)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginRenderPass2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderPass2KHR: {
+        constexpr bool HasCmdBeginRenderPass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderPass2KHR; };
+        if constexpr (HasCmdBeginRenderPass2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginRenderPass2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginRendering: {
+        constexpr bool HasCmdBeginRendering = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRendering; };
+        if constexpr (HasCmdBeginRendering)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginRendering<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginRenderingKHR: {
+        constexpr bool HasCmdBeginRenderingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginRenderingKHR; };
+        if constexpr (HasCmdBeginRenderingKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginRenderingKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginTransformFeedbackEXT: {
+        constexpr bool HasCmdBeginTransformFeedbackEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginTransformFeedbackEXT; };
+        if constexpr (HasCmdBeginTransformFeedbackEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginTransformFeedbackEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBeginVideoCodingKHR: {
+        constexpr bool HasCmdBeginVideoCodingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBeginVideoCodingKHR; };
+        if constexpr (HasCmdBeginVideoCodingKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdBeginVideoCodingKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindDescriptorBufferEmbeddedSamplersEXT: {
+        constexpr bool HasCmdBindDescriptorBufferEmbeddedSamplersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindDescriptorBufferEmbeddedSamplersEXT; };
+        if constexpr (HasCmdBindDescriptorBufferEmbeddedSamplersEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBindDescriptorBufferEmbeddedSamplersEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindDescriptorBuffersEXT: {
+        constexpr bool HasCmdBindDescriptorBuffersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindDescriptorBuffersEXT; };
+        if constexpr (HasCmdBindDescriptorBuffersEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBindDescriptorBuffersEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindDescriptorSets: {
+        constexpr bool HasCmdBindDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindDescriptorSets; };
+        if constexpr (HasCmdBindDescriptorSets)
+          return (PFN_vkVoidFunction) &wrap_CmdBindDescriptorSets<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindIndexBuffer: {
+        constexpr bool HasCmdBindIndexBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindIndexBuffer; };
+        if constexpr (HasCmdBindIndexBuffer)
+          return (PFN_vkVoidFunction) &wrap_CmdBindIndexBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindInvocationMaskHUAWEI: {
+        constexpr bool HasCmdBindInvocationMaskHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindInvocationMaskHUAWEI; };
+        if constexpr (HasCmdBindInvocationMaskHUAWEI)
+          return (PFN_vkVoidFunction) &wrap_CmdBindInvocationMaskHUAWEI<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindPipeline: {
+        constexpr bool HasCmdBindPipeline = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindPipeline; };
+        if constexpr (HasCmdBindPipeline)
+          return (PFN_vkVoidFunction) &wrap_CmdBindPipeline<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindPipelineShaderGroupNV: {
+        constexpr bool HasCmdBindPipelineShaderGroupNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindPipelineShaderGroupNV; };
+        if constexpr (HasCmdBindPipelineShaderGroupNV)
+          return (PFN_vkVoidFunction) &wrap_CmdBindPipelineShaderGroupNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindShadersEXT: {
+        constexpr bool HasCmdBindShadersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindShadersEXT; };
+        if constexpr (HasCmdBindShadersEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBindShadersEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindShadingRateImageNV: {
+        constexpr bool HasCmdBindShadingRateImageNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindShadingRateImageNV; };
+        if constexpr (HasCmdBindShadingRateImageNV)
+          return (PFN_vkVoidFunction) &wrap_CmdBindShadingRateImageNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindTransformFeedbackBuffersEXT: {
+        constexpr bool HasCmdBindTransformFeedbackBuffersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindTransformFeedbackBuffersEXT; };
+        if constexpr (HasCmdBindTransformFeedbackBuffersEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBindTransformFeedbackBuffersEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindVertexBuffers: {
+        constexpr bool HasCmdBindVertexBuffers = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindVertexBuffers; };
+        if constexpr (HasCmdBindVertexBuffers)
+          return (PFN_vkVoidFunction) &wrap_CmdBindVertexBuffers<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindVertexBuffers2: {
+        constexpr bool HasCmdBindVertexBuffers2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindVertexBuffers2; };
+        if constexpr (HasCmdBindVertexBuffers2)
+          return (PFN_vkVoidFunction) &wrap_CmdBindVertexBuffers2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBindVertexBuffers2EXT: {
+        constexpr bool HasCmdBindVertexBuffers2EXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBindVertexBuffers2EXT; };
+        if constexpr (HasCmdBindVertexBuffers2EXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBindVertexBuffers2EXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBlitImage: {
+        constexpr bool HasCmdBlitImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBlitImage; };
+        if constexpr (HasCmdBlitImage)
+          return (PFN_vkVoidFunction) &wrap_CmdBlitImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBlitImage2: {
+        constexpr bool HasCmdBlitImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBlitImage2; };
+        if constexpr (HasCmdBlitImage2)
+          return (PFN_vkVoidFunction) &wrap_CmdBlitImage2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBlitImage2KHR: {
+        constexpr bool HasCmdBlitImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBlitImage2KHR; };
+        if constexpr (HasCmdBlitImage2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdBlitImage2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBuildAccelerationStructureNV: {
+        constexpr bool HasCmdBuildAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildAccelerationStructureNV; };
+        if constexpr (HasCmdBuildAccelerationStructureNV)
+          return (PFN_vkVoidFunction) &wrap_CmdBuildAccelerationStructureNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBuildAccelerationStructuresIndirectKHR: {
+        constexpr bool HasCmdBuildAccelerationStructuresIndirectKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildAccelerationStructuresIndirectKHR; };
+        if constexpr (HasCmdBuildAccelerationStructuresIndirectKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdBuildAccelerationStructuresIndirectKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBuildAccelerationStructuresKHR: {
+        constexpr bool HasCmdBuildAccelerationStructuresKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildAccelerationStructuresKHR; };
+        if constexpr (HasCmdBuildAccelerationStructuresKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdBuildAccelerationStructuresKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdBuildMicromapsEXT: {
+        constexpr bool HasCmdBuildMicromapsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdBuildMicromapsEXT; };
+        if constexpr (HasCmdBuildMicromapsEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdBuildMicromapsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdClearAttachments: {
+        constexpr bool HasCmdClearAttachments = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdClearAttachments; };
+        if constexpr (HasCmdClearAttachments)
+          return (PFN_vkVoidFunction) &wrap_CmdClearAttachments<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdClearColorImage: {
+        constexpr bool HasCmdClearColorImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdClearColorImage; };
+        if constexpr (HasCmdClearColorImage)
+          return (PFN_vkVoidFunction) &wrap_CmdClearColorImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdClearDepthStencilImage: {
+        constexpr bool HasCmdClearDepthStencilImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdClearDepthStencilImage; };
+        if constexpr (HasCmdClearDepthStencilImage)
+          return (PFN_vkVoidFunction) &wrap_CmdClearDepthStencilImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdControlVideoCodingKHR: {
+        constexpr bool HasCmdControlVideoCodingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdControlVideoCodingKHR; };
+        if constexpr (HasCmdControlVideoCodingKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdControlVideoCodingKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyAccelerationStructureKHR: {
+        constexpr bool HasCmdCopyAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyAccelerationStructureKHR; };
+        if constexpr (HasCmdCopyAccelerationStructureKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyAccelerationStructureKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyAccelerationStructureNV: {
+        constexpr bool HasCmdCopyAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyAccelerationStructureNV; };
+        if constexpr (HasCmdCopyAccelerationStructureNV)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyAccelerationStructureNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyAccelerationStructureToMemoryKHR: {
+        constexpr bool HasCmdCopyAccelerationStructureToMemoryKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyAccelerationStructureToMemoryKHR; };
+        if constexpr (HasCmdCopyAccelerationStructureToMemoryKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyAccelerationStructureToMemoryKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyBuffer: {
+        constexpr bool HasCmdCopyBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBuffer; };
+        if constexpr (HasCmdCopyBuffer)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyBuffer2: {
+        constexpr bool HasCmdCopyBuffer2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBuffer2; };
+        if constexpr (HasCmdCopyBuffer2)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyBuffer2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyBuffer2KHR: {
+        constexpr bool HasCmdCopyBuffer2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBuffer2KHR; };
+        if constexpr (HasCmdCopyBuffer2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyBuffer2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyBufferToImage: {
+        constexpr bool HasCmdCopyBufferToImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBufferToImage; };
+        if constexpr (HasCmdCopyBufferToImage)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyBufferToImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyBufferToImage2: {
+        constexpr bool HasCmdCopyBufferToImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBufferToImage2; };
+        if constexpr (HasCmdCopyBufferToImage2)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyBufferToImage2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyBufferToImage2KHR: {
+        constexpr bool HasCmdCopyBufferToImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyBufferToImage2KHR; };
+        if constexpr (HasCmdCopyBufferToImage2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyBufferToImage2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyImage: {
+        constexpr bool HasCmdCopyImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImage; };
+        if constexpr (HasCmdCopyImage)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyImage2: {
+        constexpr bool HasCmdCopyImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImage2; };
+        if constexpr (HasCmdCopyImage2)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyImage2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyImage2KHR: {
+        constexpr bool HasCmdCopyImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImage2KHR; };
+        if constexpr (HasCmdCopyImage2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyImage2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyImageToBuffer: {
+        constexpr bool HasCmdCopyImageToBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImageToBuffer; };
+        if constexpr (HasCmdCopyImageToBuffer)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyImageToBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyImageToBuffer2: {
+        constexpr bool HasCmdCopyImageToBuffer2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImageToBuffer2; };
+        if constexpr (HasCmdCopyImageToBuffer2)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyImageToBuffer2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyImageToBuffer2KHR: {
+        constexpr bool HasCmdCopyImageToBuffer2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyImageToBuffer2KHR; };
+        if constexpr (HasCmdCopyImageToBuffer2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyImageToBuffer2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryIndirectNV: {
+        constexpr bool HasCmdCopyMemoryIndirectNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryIndirectNV; };
+        if constexpr (HasCmdCopyMemoryIndirectNV)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyMemoryIndirectNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryToAccelerationStructureKHR: {
+        constexpr bool HasCmdCopyMemoryToAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryToAccelerationStructureKHR; };
+        if constexpr (HasCmdCopyMemoryToAccelerationStructureKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyMemoryToAccelerationStructureKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryToImageIndirectNV: {
+        constexpr bool HasCmdCopyMemoryToImageIndirectNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryToImageIndirectNV; };
+        if constexpr (HasCmdCopyMemoryToImageIndirectNV)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyMemoryToImageIndirectNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyMemoryToMicromapEXT: {
+        constexpr bool HasCmdCopyMemoryToMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMemoryToMicromapEXT; };
+        if constexpr (HasCmdCopyMemoryToMicromapEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyMemoryToMicromapEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyMicromapEXT: {
+        constexpr bool HasCmdCopyMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMicromapEXT; };
+        if constexpr (HasCmdCopyMicromapEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyMicromapEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyMicromapToMemoryEXT: {
+        constexpr bool HasCmdCopyMicromapToMemoryEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyMicromapToMemoryEXT; };
+        if constexpr (HasCmdCopyMicromapToMemoryEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyMicromapToMemoryEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdCopyQueryPoolResults: {
+        constexpr bool HasCmdCopyQueryPoolResults = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdCopyQueryPoolResults; };
+        if constexpr (HasCmdCopyQueryPoolResults)
+          return (PFN_vkVoidFunction) &wrap_CmdCopyQueryPoolResults<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDebugMarkerBeginEXT: {
+        constexpr bool HasCmdDebugMarkerBeginEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDebugMarkerBeginEXT; };
+        if constexpr (HasCmdDebugMarkerBeginEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDebugMarkerBeginEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDebugMarkerEndEXT: {
+        constexpr bool HasCmdDebugMarkerEndEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDebugMarkerEndEXT; };
+        if constexpr (HasCmdDebugMarkerEndEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDebugMarkerEndEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDebugMarkerInsertEXT: {
+        constexpr bool HasCmdDebugMarkerInsertEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDebugMarkerInsertEXT; };
+        if constexpr (HasCmdDebugMarkerInsertEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDebugMarkerInsertEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDecodeVideoKHR: {
+        constexpr bool HasCmdDecodeVideoKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDecodeVideoKHR; };
+        if constexpr (HasCmdDecodeVideoKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdDecodeVideoKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDecompressMemoryIndirectCountNV: {
+        constexpr bool HasCmdDecompressMemoryIndirectCountNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDecompressMemoryIndirectCountNV; };
+        if constexpr (HasCmdDecompressMemoryIndirectCountNV)
+          return (PFN_vkVoidFunction) &wrap_CmdDecompressMemoryIndirectCountNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDecompressMemoryNV: {
+        constexpr bool HasCmdDecompressMemoryNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDecompressMemoryNV; };
+        if constexpr (HasCmdDecompressMemoryNV)
+          return (PFN_vkVoidFunction) &wrap_CmdDecompressMemoryNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDispatch: {
+        constexpr bool HasCmdDispatch = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatch; };
+        if constexpr (HasCmdDispatch)
+          return (PFN_vkVoidFunction) &wrap_CmdDispatch<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDispatchBase: {
+        constexpr bool HasCmdDispatchBase = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatchBase; };
+        if constexpr (HasCmdDispatchBase)
+          return (PFN_vkVoidFunction) &wrap_CmdDispatchBase<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDispatchBaseKHR: {
+        constexpr bool HasCmdDispatchBaseKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatchBaseKHR; };
+        if constexpr (HasCmdDispatchBaseKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdDispatchBaseKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDispatchIndirect: {
+        constexpr bool HasCmdDispatchIndirect = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDispatchIndirect; };
+        if constexpr (HasCmdDispatchIndirect)
+          return (PFN_vkVoidFunction) &wrap_CmdDispatchIndirect<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDraw: {
+        constexpr bool HasCmdDraw = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDraw; };
+        if constexpr (HasCmdDraw)
+          return (PFN_vkVoidFunction) &wrap_CmdDraw<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawClusterHUAWEI: {
+        constexpr bool HasCmdDrawClusterHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawClusterHUAWEI; };
+        if constexpr (HasCmdDrawClusterHUAWEI)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawClusterHUAWEI<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawClusterIndirectHUAWEI: {
+        constexpr bool HasCmdDrawClusterIndirectHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawClusterIndirectHUAWEI; };
+        if constexpr (HasCmdDrawClusterIndirectHUAWEI)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawClusterIndirectHUAWEI<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexed: {
+        constexpr bool HasCmdDrawIndexed = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexed; };
+        if constexpr (HasCmdDrawIndexed)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndexed<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirect: {
+        constexpr bool HasCmdDrawIndexedIndirect = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirect; };
+        if constexpr (HasCmdDrawIndexedIndirect)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndexedIndirect<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirectCount: {
+        constexpr bool HasCmdDrawIndexedIndirectCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirectCount; };
+        if constexpr (HasCmdDrawIndexedIndirectCount)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndexedIndirectCount<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirectCountAMD: {
+        constexpr bool HasCmdDrawIndexedIndirectCountAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirectCountAMD; };
+        if constexpr (HasCmdDrawIndexedIndirectCountAMD)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndexedIndirectCountAMD<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndexedIndirectCountKHR: {
+        constexpr bool HasCmdDrawIndexedIndirectCountKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndexedIndirectCountKHR; };
+        if constexpr (HasCmdDrawIndexedIndirectCountKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndexedIndirectCountKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirect: {
+        constexpr bool HasCmdDrawIndirect = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirect; };
+        if constexpr (HasCmdDrawIndirect)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndirect<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectByteCountEXT: {
+        constexpr bool HasCmdDrawIndirectByteCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectByteCountEXT; };
+        if constexpr (HasCmdDrawIndirectByteCountEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndirectByteCountEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectCount: {
+        constexpr bool HasCmdDrawIndirectCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectCount; };
+        if constexpr (HasCmdDrawIndirectCount)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndirectCount<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectCountAMD: {
+        constexpr bool HasCmdDrawIndirectCountAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectCountAMD; };
+        if constexpr (HasCmdDrawIndirectCountAMD)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndirectCountAMD<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawIndirectCountKHR: {
+        constexpr bool HasCmdDrawIndirectCountKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawIndirectCountKHR; };
+        if constexpr (HasCmdDrawIndirectCountKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawIndirectCountKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksEXT: {
+        constexpr bool HasCmdDrawMeshTasksEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksEXT; };
+        if constexpr (HasCmdDrawMeshTasksEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMeshTasksEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountEXT: {
+        constexpr bool HasCmdDrawMeshTasksIndirectCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectCountEXT; };
+        if constexpr (HasCmdDrawMeshTasksIndirectCountEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMeshTasksIndirectCountEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectCountNV: {
+        constexpr bool HasCmdDrawMeshTasksIndirectCountNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectCountNV; };
+        if constexpr (HasCmdDrawMeshTasksIndirectCountNV)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMeshTasksIndirectCountNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectEXT: {
+        constexpr bool HasCmdDrawMeshTasksIndirectEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectEXT; };
+        if constexpr (HasCmdDrawMeshTasksIndirectEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMeshTasksIndirectEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksIndirectNV: {
+        constexpr bool HasCmdDrawMeshTasksIndirectNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksIndirectNV; };
+        if constexpr (HasCmdDrawMeshTasksIndirectNV)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMeshTasksIndirectNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMeshTasksNV: {
+        constexpr bool HasCmdDrawMeshTasksNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMeshTasksNV; };
+        if constexpr (HasCmdDrawMeshTasksNV)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMeshTasksNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMultiEXT: {
+        constexpr bool HasCmdDrawMultiEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMultiEXT; };
+        if constexpr (HasCmdDrawMultiEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMultiEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdDrawMultiIndexedEXT: {
+        constexpr bool HasCmdDrawMultiIndexedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdDrawMultiIndexedEXT; };
+        if constexpr (HasCmdDrawMultiIndexedEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdDrawMultiIndexedEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case procaddr::DeviceFunc::CmdEncodeVideoKHR: {
+        constexpr bool HasCmdEncodeVideoKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEncodeVideoKHR; };
+        if constexpr (HasCmdEncodeVideoKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdEncodeVideoKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::CmdEndConditionalRenderingEXT: {
+        constexpr bool HasCmdEndConditionalRenderingEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndConditionalRenderingEXT; };
+        if constexpr (HasCmdEndConditionalRenderingEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdEndConditionalRenderingEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndDebugUtilsLabelEXT: {
+        constexpr bool HasCmdEndDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndDebugUtilsLabelEXT; };
+        if constexpr (HasCmdEndDebugUtilsLabelEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdEndDebugUtilsLabelEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndQuery: {
+        constexpr bool HasCmdEndQuery = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndQuery; };
+        if constexpr (HasCmdEndQuery)
+          return (PFN_vkVoidFunction) &wrap_CmdEndQuery<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndQueryIndexedEXT: {
+        constexpr bool HasCmdEndQueryIndexedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndQueryIndexedEXT; };
+        if constexpr (HasCmdEndQueryIndexedEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdEndQueryIndexedEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderPass: {
+        constexpr bool HasCmdEndRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderPass; };
+        if constexpr (HasCmdEndRenderPass)
+          return (PFN_vkVoidFunction) &wrap_CmdEndRenderPass<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderPass2: {
+        constexpr bool HasCmdEndRenderPass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderPass2; };
+        if constexpr (HasCmdEndRenderPass2)
+          return (PFN_vkVoidFunction) &wrap_CmdEndRenderPass2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderPass2KHR: {
+        constexpr bool HasCmdEndRenderPass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderPass2KHR; };
+        if constexpr (HasCmdEndRenderPass2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdEndRenderPass2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndRendering: {
+        constexpr bool HasCmdEndRendering = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRendering; };
+        if constexpr (HasCmdEndRendering)
+          return (PFN_vkVoidFunction) &wrap_CmdEndRendering<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndRenderingKHR: {
+        constexpr bool HasCmdEndRenderingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndRenderingKHR; };
+        if constexpr (HasCmdEndRenderingKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdEndRenderingKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndTransformFeedbackEXT: {
+        constexpr bool HasCmdEndTransformFeedbackEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndTransformFeedbackEXT; };
+        if constexpr (HasCmdEndTransformFeedbackEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdEndTransformFeedbackEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdEndVideoCodingKHR: {
+        constexpr bool HasCmdEndVideoCodingKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdEndVideoCodingKHR; };
+        if constexpr (HasCmdEndVideoCodingKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdEndVideoCodingKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdExecuteCommands: {
+        constexpr bool HasCmdExecuteCommands = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdExecuteCommands; };
+        if constexpr (HasCmdExecuteCommands)
+          return (PFN_vkVoidFunction) &wrap_CmdExecuteCommands<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdExecuteGeneratedCommandsNV: {
+        constexpr bool HasCmdExecuteGeneratedCommandsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdExecuteGeneratedCommandsNV; };
+        if constexpr (HasCmdExecuteGeneratedCommandsNV)
+          return (PFN_vkVoidFunction) &wrap_CmdExecuteGeneratedCommandsNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdFillBuffer: {
+        constexpr bool HasCmdFillBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdFillBuffer; };
+        if constexpr (HasCmdFillBuffer)
+          return (PFN_vkVoidFunction) &wrap_CmdFillBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdInsertDebugUtilsLabelEXT: {
+        constexpr bool HasCmdInsertDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdInsertDebugUtilsLabelEXT; };
+        if constexpr (HasCmdInsertDebugUtilsLabelEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdInsertDebugUtilsLabelEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdNextSubpass: {
+        constexpr bool HasCmdNextSubpass = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdNextSubpass; };
+        if constexpr (HasCmdNextSubpass)
+          return (PFN_vkVoidFunction) &wrap_CmdNextSubpass<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdNextSubpass2: {
+        constexpr bool HasCmdNextSubpass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdNextSubpass2; };
+        if constexpr (HasCmdNextSubpass2)
+          return (PFN_vkVoidFunction) &wrap_CmdNextSubpass2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdNextSubpass2KHR: {
+        constexpr bool HasCmdNextSubpass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdNextSubpass2KHR; };
+        if constexpr (HasCmdNextSubpass2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdNextSubpass2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdOpticalFlowExecuteNV: {
+        constexpr bool HasCmdOpticalFlowExecuteNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdOpticalFlowExecuteNV; };
+        if constexpr (HasCmdOpticalFlowExecuteNV)
+          return (PFN_vkVoidFunction) &wrap_CmdOpticalFlowExecuteNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPipelineBarrier: {
+        constexpr bool HasCmdPipelineBarrier = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPipelineBarrier; };
+        if constexpr (HasCmdPipelineBarrier)
+          return (PFN_vkVoidFunction) &wrap_CmdPipelineBarrier<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPipelineBarrier2: {
+        constexpr bool HasCmdPipelineBarrier2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPipelineBarrier2; };
+        if constexpr (HasCmdPipelineBarrier2)
+          return (PFN_vkVoidFunction) &wrap_CmdPipelineBarrier2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPipelineBarrier2KHR: {
+        constexpr bool HasCmdPipelineBarrier2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPipelineBarrier2KHR; };
+        if constexpr (HasCmdPipelineBarrier2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdPipelineBarrier2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPreprocessGeneratedCommandsNV: {
+        constexpr bool HasCmdPreprocessGeneratedCommandsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPreprocessGeneratedCommandsNV; };
+        if constexpr (HasCmdPreprocessGeneratedCommandsNV)
+          return (PFN_vkVoidFunction) &wrap_CmdPreprocessGeneratedCommandsNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPushConstants: {
+        constexpr bool HasCmdPushConstants = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPushConstants; };
+        if constexpr (HasCmdPushConstants)
+          return (PFN_vkVoidFunction) &wrap_CmdPushConstants<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPushDescriptorSetKHR: {
+        constexpr bool HasCmdPushDescriptorSetKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPushDescriptorSetKHR; };
+        if constexpr (HasCmdPushDescriptorSetKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdPushDescriptorSetKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdPushDescriptorSetWithTemplateKHR: {
+        constexpr bool HasCmdPushDescriptorSetWithTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdPushDescriptorSetWithTemplateKHR; };
+        if constexpr (HasCmdPushDescriptorSetWithTemplateKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdPushDescriptorSetWithTemplateKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResetEvent: {
+        constexpr bool HasCmdResetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetEvent; };
+        if constexpr (HasCmdResetEvent)
+          return (PFN_vkVoidFunction) &wrap_CmdResetEvent<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResetEvent2: {
+        constexpr bool HasCmdResetEvent2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetEvent2; };
+        if constexpr (HasCmdResetEvent2)
+          return (PFN_vkVoidFunction) &wrap_CmdResetEvent2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResetEvent2KHR: {
+        constexpr bool HasCmdResetEvent2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetEvent2KHR; };
+        if constexpr (HasCmdResetEvent2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdResetEvent2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResetQueryPool: {
+        constexpr bool HasCmdResetQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResetQueryPool; };
+        if constexpr (HasCmdResetQueryPool)
+          return (PFN_vkVoidFunction) &wrap_CmdResetQueryPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResolveImage: {
+        constexpr bool HasCmdResolveImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResolveImage; };
+        if constexpr (HasCmdResolveImage)
+          return (PFN_vkVoidFunction) &wrap_CmdResolveImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResolveImage2: {
+        constexpr bool HasCmdResolveImage2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResolveImage2; };
+        if constexpr (HasCmdResolveImage2)
+          return (PFN_vkVoidFunction) &wrap_CmdResolveImage2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdResolveImage2KHR: {
+        constexpr bool HasCmdResolveImage2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdResolveImage2KHR; };
+        if constexpr (HasCmdResolveImage2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdResolveImage2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetAlphaToCoverageEnableEXT: {
+        constexpr bool HasCmdSetAlphaToCoverageEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetAlphaToCoverageEnableEXT; };
+        if constexpr (HasCmdSetAlphaToCoverageEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetAlphaToCoverageEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetAlphaToOneEnableEXT: {
+        constexpr bool HasCmdSetAlphaToOneEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetAlphaToOneEnableEXT; };
+        if constexpr (HasCmdSetAlphaToOneEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetAlphaToOneEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetAttachmentFeedbackLoopEnableEXT: {
+        constexpr bool HasCmdSetAttachmentFeedbackLoopEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetAttachmentFeedbackLoopEnableEXT; };
+        if constexpr (HasCmdSetAttachmentFeedbackLoopEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetAttachmentFeedbackLoopEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetBlendConstants: {
+        constexpr bool HasCmdSetBlendConstants = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetBlendConstants; };
+        if constexpr (HasCmdSetBlendConstants)
+          return (PFN_vkVoidFunction) &wrap_CmdSetBlendConstants<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCheckpointNV: {
+        constexpr bool HasCmdSetCheckpointNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCheckpointNV; };
+        if constexpr (HasCmdSetCheckpointNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCheckpointNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoarseSampleOrderNV: {
+        constexpr bool HasCmdSetCoarseSampleOrderNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoarseSampleOrderNV; };
+        if constexpr (HasCmdSetCoarseSampleOrderNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoarseSampleOrderNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetColorBlendAdvancedEXT: {
+        constexpr bool HasCmdSetColorBlendAdvancedEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorBlendAdvancedEXT; };
+        if constexpr (HasCmdSetColorBlendAdvancedEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetColorBlendAdvancedEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetColorBlendEnableEXT: {
+        constexpr bool HasCmdSetColorBlendEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorBlendEnableEXT; };
+        if constexpr (HasCmdSetColorBlendEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetColorBlendEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetColorBlendEquationEXT: {
+        constexpr bool HasCmdSetColorBlendEquationEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorBlendEquationEXT; };
+        if constexpr (HasCmdSetColorBlendEquationEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetColorBlendEquationEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetColorWriteEnableEXT: {
+        constexpr bool HasCmdSetColorWriteEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorWriteEnableEXT; };
+        if constexpr (HasCmdSetColorWriteEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetColorWriteEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetColorWriteMaskEXT: {
+        constexpr bool HasCmdSetColorWriteMaskEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetColorWriteMaskEXT; };
+        if constexpr (HasCmdSetColorWriteMaskEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetColorWriteMaskEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetConservativeRasterizationModeEXT: {
+        constexpr bool HasCmdSetConservativeRasterizationModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetConservativeRasterizationModeEXT; };
+        if constexpr (HasCmdSetConservativeRasterizationModeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetConservativeRasterizationModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageModulationModeNV: {
+        constexpr bool HasCmdSetCoverageModulationModeNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageModulationModeNV; };
+        if constexpr (HasCmdSetCoverageModulationModeNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoverageModulationModeNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageModulationTableEnableNV: {
+        constexpr bool HasCmdSetCoverageModulationTableEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageModulationTableEnableNV; };
+        if constexpr (HasCmdSetCoverageModulationTableEnableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoverageModulationTableEnableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageModulationTableNV: {
+        constexpr bool HasCmdSetCoverageModulationTableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageModulationTableNV; };
+        if constexpr (HasCmdSetCoverageModulationTableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoverageModulationTableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageReductionModeNV: {
+        constexpr bool HasCmdSetCoverageReductionModeNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageReductionModeNV; };
+        if constexpr (HasCmdSetCoverageReductionModeNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoverageReductionModeNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageToColorEnableNV: {
+        constexpr bool HasCmdSetCoverageToColorEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageToColorEnableNV; };
+        if constexpr (HasCmdSetCoverageToColorEnableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoverageToColorEnableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCoverageToColorLocationNV: {
+        constexpr bool HasCmdSetCoverageToColorLocationNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCoverageToColorLocationNV; };
+        if constexpr (HasCmdSetCoverageToColorLocationNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCoverageToColorLocationNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCullMode: {
+        constexpr bool HasCmdSetCullMode = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCullMode; };
+        if constexpr (HasCmdSetCullMode)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCullMode<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetCullModeEXT: {
+        constexpr bool HasCmdSetCullModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetCullModeEXT; };
+        if constexpr (HasCmdSetCullModeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetCullModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBias: {
+        constexpr bool HasCmdSetDepthBias = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBias; };
+        if constexpr (HasCmdSetDepthBias)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthBias<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBiasEnable: {
+        constexpr bool HasCmdSetDepthBiasEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBiasEnable; };
+        if constexpr (HasCmdSetDepthBiasEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthBiasEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBiasEnableEXT: {
+        constexpr bool HasCmdSetDepthBiasEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBiasEnableEXT; };
+        if constexpr (HasCmdSetDepthBiasEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthBiasEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBounds: {
+        constexpr bool HasCmdSetDepthBounds = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBounds; };
+        if constexpr (HasCmdSetDepthBounds)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthBounds<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBoundsTestEnable: {
+        constexpr bool HasCmdSetDepthBoundsTestEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBoundsTestEnable; };
+        if constexpr (HasCmdSetDepthBoundsTestEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthBoundsTestEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthBoundsTestEnableEXT: {
+        constexpr bool HasCmdSetDepthBoundsTestEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthBoundsTestEnableEXT; };
+        if constexpr (HasCmdSetDepthBoundsTestEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthBoundsTestEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthClampEnableEXT: {
+        constexpr bool HasCmdSetDepthClampEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthClampEnableEXT; };
+        if constexpr (HasCmdSetDepthClampEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthClampEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthClipEnableEXT: {
+        constexpr bool HasCmdSetDepthClipEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthClipEnableEXT; };
+        if constexpr (HasCmdSetDepthClipEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthClipEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthClipNegativeOneToOneEXT: {
+        constexpr bool HasCmdSetDepthClipNegativeOneToOneEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthClipNegativeOneToOneEXT; };
+        if constexpr (HasCmdSetDepthClipNegativeOneToOneEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthClipNegativeOneToOneEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthCompareOp: {
+        constexpr bool HasCmdSetDepthCompareOp = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthCompareOp; };
+        if constexpr (HasCmdSetDepthCompareOp)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthCompareOp<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthCompareOpEXT: {
+        constexpr bool HasCmdSetDepthCompareOpEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthCompareOpEXT; };
+        if constexpr (HasCmdSetDepthCompareOpEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthCompareOpEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthTestEnable: {
+        constexpr bool HasCmdSetDepthTestEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthTestEnable; };
+        if constexpr (HasCmdSetDepthTestEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthTestEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthTestEnableEXT: {
+        constexpr bool HasCmdSetDepthTestEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthTestEnableEXT; };
+        if constexpr (HasCmdSetDepthTestEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthTestEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthWriteEnable: {
+        constexpr bool HasCmdSetDepthWriteEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthWriteEnable; };
+        if constexpr (HasCmdSetDepthWriteEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthWriteEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDepthWriteEnableEXT: {
+        constexpr bool HasCmdSetDepthWriteEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDepthWriteEnableEXT; };
+        if constexpr (HasCmdSetDepthWriteEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDepthWriteEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDescriptorBufferOffsetsEXT: {
+        constexpr bool HasCmdSetDescriptorBufferOffsetsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDescriptorBufferOffsetsEXT; };
+        if constexpr (HasCmdSetDescriptorBufferOffsetsEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDescriptorBufferOffsetsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDeviceMask: {
+        constexpr bool HasCmdSetDeviceMask = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDeviceMask; };
+        if constexpr (HasCmdSetDeviceMask)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDeviceMask<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDeviceMaskKHR: {
+        constexpr bool HasCmdSetDeviceMaskKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDeviceMaskKHR; };
+        if constexpr (HasCmdSetDeviceMaskKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDeviceMaskKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDiscardRectangleEXT: {
+        constexpr bool HasCmdSetDiscardRectangleEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDiscardRectangleEXT; };
+        if constexpr (HasCmdSetDiscardRectangleEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDiscardRectangleEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDiscardRectangleEnableEXT: {
+        constexpr bool HasCmdSetDiscardRectangleEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDiscardRectangleEnableEXT; };
+        if constexpr (HasCmdSetDiscardRectangleEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDiscardRectangleEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetDiscardRectangleModeEXT: {
+        constexpr bool HasCmdSetDiscardRectangleModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetDiscardRectangleModeEXT; };
+        if constexpr (HasCmdSetDiscardRectangleModeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetDiscardRectangleModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetEvent: {
+        constexpr bool HasCmdSetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetEvent; };
+        if constexpr (HasCmdSetEvent)
+          return (PFN_vkVoidFunction) &wrap_CmdSetEvent<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetEvent2: {
+        constexpr bool HasCmdSetEvent2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetEvent2; };
+        if constexpr (HasCmdSetEvent2)
+          return (PFN_vkVoidFunction) &wrap_CmdSetEvent2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetEvent2KHR: {
+        constexpr bool HasCmdSetEvent2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetEvent2KHR; };
+        if constexpr (HasCmdSetEvent2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdSetEvent2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetExclusiveScissorEnableNV: {
+        constexpr bool HasCmdSetExclusiveScissorEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetExclusiveScissorEnableNV; };
+        if constexpr (HasCmdSetExclusiveScissorEnableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetExclusiveScissorEnableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetExclusiveScissorNV: {
+        constexpr bool HasCmdSetExclusiveScissorNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetExclusiveScissorNV; };
+        if constexpr (HasCmdSetExclusiveScissorNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetExclusiveScissorNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetExtraPrimitiveOverestimationSizeEXT: {
+        constexpr bool HasCmdSetExtraPrimitiveOverestimationSizeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetExtraPrimitiveOverestimationSizeEXT; };
+        if constexpr (HasCmdSetExtraPrimitiveOverestimationSizeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetExtraPrimitiveOverestimationSizeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetFragmentShadingRateEnumNV: {
+        constexpr bool HasCmdSetFragmentShadingRateEnumNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFragmentShadingRateEnumNV; };
+        if constexpr (HasCmdSetFragmentShadingRateEnumNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetFragmentShadingRateEnumNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetFragmentShadingRateKHR: {
+        constexpr bool HasCmdSetFragmentShadingRateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFragmentShadingRateKHR; };
+        if constexpr (HasCmdSetFragmentShadingRateKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdSetFragmentShadingRateKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetFrontFace: {
+        constexpr bool HasCmdSetFrontFace = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFrontFace; };
+        if constexpr (HasCmdSetFrontFace)
+          return (PFN_vkVoidFunction) &wrap_CmdSetFrontFace<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetFrontFaceEXT: {
+        constexpr bool HasCmdSetFrontFaceEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetFrontFaceEXT; };
+        if constexpr (HasCmdSetFrontFaceEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetFrontFaceEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetLineRasterizationModeEXT: {
+        constexpr bool HasCmdSetLineRasterizationModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineRasterizationModeEXT; };
+        if constexpr (HasCmdSetLineRasterizationModeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetLineRasterizationModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetLineStippleEXT: {
+        constexpr bool HasCmdSetLineStippleEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineStippleEXT; };
+        if constexpr (HasCmdSetLineStippleEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetLineStippleEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetLineStippleEnableEXT: {
+        constexpr bool HasCmdSetLineStippleEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineStippleEnableEXT; };
+        if constexpr (HasCmdSetLineStippleEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetLineStippleEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetLineWidth: {
+        constexpr bool HasCmdSetLineWidth = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLineWidth; };
+        if constexpr (HasCmdSetLineWidth)
+          return (PFN_vkVoidFunction) &wrap_CmdSetLineWidth<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetLogicOpEXT: {
+        constexpr bool HasCmdSetLogicOpEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLogicOpEXT; };
+        if constexpr (HasCmdSetLogicOpEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetLogicOpEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetLogicOpEnableEXT: {
+        constexpr bool HasCmdSetLogicOpEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetLogicOpEnableEXT; };
+        if constexpr (HasCmdSetLogicOpEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetLogicOpEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPatchControlPointsEXT: {
+        constexpr bool HasCmdSetPatchControlPointsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPatchControlPointsEXT; };
+        if constexpr (HasCmdSetPatchControlPointsEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPatchControlPointsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPerformanceMarkerINTEL: {
+        constexpr bool HasCmdSetPerformanceMarkerINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPerformanceMarkerINTEL; };
+        if constexpr (HasCmdSetPerformanceMarkerINTEL)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPerformanceMarkerINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPerformanceOverrideINTEL: {
+        constexpr bool HasCmdSetPerformanceOverrideINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPerformanceOverrideINTEL; };
+        if constexpr (HasCmdSetPerformanceOverrideINTEL)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPerformanceOverrideINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPerformanceStreamMarkerINTEL: {
+        constexpr bool HasCmdSetPerformanceStreamMarkerINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPerformanceStreamMarkerINTEL; };
+        if constexpr (HasCmdSetPerformanceStreamMarkerINTEL)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPerformanceStreamMarkerINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPolygonModeEXT: {
+        constexpr bool HasCmdSetPolygonModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPolygonModeEXT; };
+        if constexpr (HasCmdSetPolygonModeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPolygonModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveRestartEnable: {
+        constexpr bool HasCmdSetPrimitiveRestartEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveRestartEnable; };
+        if constexpr (HasCmdSetPrimitiveRestartEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPrimitiveRestartEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveRestartEnableEXT: {
+        constexpr bool HasCmdSetPrimitiveRestartEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveRestartEnableEXT; };
+        if constexpr (HasCmdSetPrimitiveRestartEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPrimitiveRestartEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveTopology: {
+        constexpr bool HasCmdSetPrimitiveTopology = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveTopology; };
+        if constexpr (HasCmdSetPrimitiveTopology)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPrimitiveTopology<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetPrimitiveTopologyEXT: {
+        constexpr bool HasCmdSetPrimitiveTopologyEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetPrimitiveTopologyEXT; };
+        if constexpr (HasCmdSetPrimitiveTopologyEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetPrimitiveTopologyEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetProvokingVertexModeEXT: {
+        constexpr bool HasCmdSetProvokingVertexModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetProvokingVertexModeEXT; };
+        if constexpr (HasCmdSetProvokingVertexModeEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetProvokingVertexModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizationSamplesEXT: {
+        constexpr bool HasCmdSetRasterizationSamplesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizationSamplesEXT; };
+        if constexpr (HasCmdSetRasterizationSamplesEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetRasterizationSamplesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizationStreamEXT: {
+        constexpr bool HasCmdSetRasterizationStreamEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizationStreamEXT; };
+        if constexpr (HasCmdSetRasterizationStreamEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetRasterizationStreamEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizerDiscardEnable: {
+        constexpr bool HasCmdSetRasterizerDiscardEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizerDiscardEnable; };
+        if constexpr (HasCmdSetRasterizerDiscardEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetRasterizerDiscardEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetRasterizerDiscardEnableEXT: {
+        constexpr bool HasCmdSetRasterizerDiscardEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRasterizerDiscardEnableEXT; };
+        if constexpr (HasCmdSetRasterizerDiscardEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetRasterizerDiscardEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetRayTracingPipelineStackSizeKHR: {
+        constexpr bool HasCmdSetRayTracingPipelineStackSizeKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRayTracingPipelineStackSizeKHR; };
+        if constexpr (HasCmdSetRayTracingPipelineStackSizeKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdSetRayTracingPipelineStackSizeKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetRepresentativeFragmentTestEnableNV: {
+        constexpr bool HasCmdSetRepresentativeFragmentTestEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetRepresentativeFragmentTestEnableNV; };
+        if constexpr (HasCmdSetRepresentativeFragmentTestEnableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetRepresentativeFragmentTestEnableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetSampleLocationsEXT: {
+        constexpr bool HasCmdSetSampleLocationsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetSampleLocationsEXT; };
+        if constexpr (HasCmdSetSampleLocationsEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetSampleLocationsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetSampleLocationsEnableEXT: {
+        constexpr bool HasCmdSetSampleLocationsEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetSampleLocationsEnableEXT; };
+        if constexpr (HasCmdSetSampleLocationsEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetSampleLocationsEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetSampleMaskEXT: {
+        constexpr bool HasCmdSetSampleMaskEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetSampleMaskEXT; };
+        if constexpr (HasCmdSetSampleMaskEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetSampleMaskEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetScissor: {
+        constexpr bool HasCmdSetScissor = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetScissor; };
+        if constexpr (HasCmdSetScissor)
+          return (PFN_vkVoidFunction) &wrap_CmdSetScissor<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetScissorWithCount: {
+        constexpr bool HasCmdSetScissorWithCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetScissorWithCount; };
+        if constexpr (HasCmdSetScissorWithCount)
+          return (PFN_vkVoidFunction) &wrap_CmdSetScissorWithCount<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetScissorWithCountEXT: {
+        constexpr bool HasCmdSetScissorWithCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetScissorWithCountEXT; };
+        if constexpr (HasCmdSetScissorWithCountEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetScissorWithCountEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetShadingRateImageEnableNV: {
+        constexpr bool HasCmdSetShadingRateImageEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetShadingRateImageEnableNV; };
+        if constexpr (HasCmdSetShadingRateImageEnableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetShadingRateImageEnableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilCompareMask: {
+        constexpr bool HasCmdSetStencilCompareMask = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilCompareMask; };
+        if constexpr (HasCmdSetStencilCompareMask)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilCompareMask<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilOp: {
+        constexpr bool HasCmdSetStencilOp = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilOp; };
+        if constexpr (HasCmdSetStencilOp)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilOp<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilOpEXT: {
+        constexpr bool HasCmdSetStencilOpEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilOpEXT; };
+        if constexpr (HasCmdSetStencilOpEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilOpEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilReference: {
+        constexpr bool HasCmdSetStencilReference = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilReference; };
+        if constexpr (HasCmdSetStencilReference)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilReference<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilTestEnable: {
+        constexpr bool HasCmdSetStencilTestEnable = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilTestEnable; };
+        if constexpr (HasCmdSetStencilTestEnable)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilTestEnable<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilTestEnableEXT: {
+        constexpr bool HasCmdSetStencilTestEnableEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilTestEnableEXT; };
+        if constexpr (HasCmdSetStencilTestEnableEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilTestEnableEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetStencilWriteMask: {
+        constexpr bool HasCmdSetStencilWriteMask = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetStencilWriteMask; };
+        if constexpr (HasCmdSetStencilWriteMask)
+          return (PFN_vkVoidFunction) &wrap_CmdSetStencilWriteMask<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetTessellationDomainOriginEXT: {
+        constexpr bool HasCmdSetTessellationDomainOriginEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetTessellationDomainOriginEXT; };
+        if constexpr (HasCmdSetTessellationDomainOriginEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetTessellationDomainOriginEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetVertexInputEXT: {
+        constexpr bool HasCmdSetVertexInputEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetVertexInputEXT; };
+        if constexpr (HasCmdSetVertexInputEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetVertexInputEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewport: {
+        constexpr bool HasCmdSetViewport = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewport; };
+        if constexpr (HasCmdSetViewport)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewport<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportShadingRatePaletteNV: {
+        constexpr bool HasCmdSetViewportShadingRatePaletteNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportShadingRatePaletteNV; };
+        if constexpr (HasCmdSetViewportShadingRatePaletteNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewportShadingRatePaletteNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportSwizzleNV: {
+        constexpr bool HasCmdSetViewportSwizzleNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportSwizzleNV; };
+        if constexpr (HasCmdSetViewportSwizzleNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewportSwizzleNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWScalingEnableNV: {
+        constexpr bool HasCmdSetViewportWScalingEnableNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWScalingEnableNV; };
+        if constexpr (HasCmdSetViewportWScalingEnableNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewportWScalingEnableNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWScalingNV: {
+        constexpr bool HasCmdSetViewportWScalingNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWScalingNV; };
+        if constexpr (HasCmdSetViewportWScalingNV)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewportWScalingNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWithCount: {
+        constexpr bool HasCmdSetViewportWithCount = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWithCount; };
+        if constexpr (HasCmdSetViewportWithCount)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewportWithCount<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSetViewportWithCountEXT: {
+        constexpr bool HasCmdSetViewportWithCountEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSetViewportWithCountEXT; };
+        if constexpr (HasCmdSetViewportWithCountEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdSetViewportWithCountEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdSubpassShadingHUAWEI: {
+        constexpr bool HasCmdSubpassShadingHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdSubpassShadingHUAWEI; };
+        if constexpr (HasCmdSubpassShadingHUAWEI)
+          return (PFN_vkVoidFunction) &wrap_CmdSubpassShadingHUAWEI<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysIndirect2KHR: {
+        constexpr bool HasCmdTraceRaysIndirect2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysIndirect2KHR; };
+        if constexpr (HasCmdTraceRaysIndirect2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdTraceRaysIndirect2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysIndirectKHR: {
+        constexpr bool HasCmdTraceRaysIndirectKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysIndirectKHR; };
+        if constexpr (HasCmdTraceRaysIndirectKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdTraceRaysIndirectKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysKHR: {
+        constexpr bool HasCmdTraceRaysKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysKHR; };
+        if constexpr (HasCmdTraceRaysKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdTraceRaysKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdTraceRaysNV: {
+        constexpr bool HasCmdTraceRaysNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdTraceRaysNV; };
+        if constexpr (HasCmdTraceRaysNV)
+          return (PFN_vkVoidFunction) &wrap_CmdTraceRaysNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdUpdateBuffer: {
+        constexpr bool HasCmdUpdateBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdUpdateBuffer; };
+        if constexpr (HasCmdUpdateBuffer)
+          return (PFN_vkVoidFunction) &wrap_CmdUpdateBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWaitEvents: {
+        constexpr bool HasCmdWaitEvents = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWaitEvents; };
+        if constexpr (HasCmdWaitEvents)
+          return (PFN_vkVoidFunction) &wrap_CmdWaitEvents<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWaitEvents2: {
+        constexpr bool HasCmdWaitEvents2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWaitEvents2; };
+        if constexpr (HasCmdWaitEvents2)
+          return (PFN_vkVoidFunction) &wrap_CmdWaitEvents2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWaitEvents2KHR: {
+        constexpr bool HasCmdWaitEvents2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWaitEvents2KHR; };
+        if constexpr (HasCmdWaitEvents2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdWaitEvents2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesKHR: {
+        constexpr bool HasCmdWriteAccelerationStructuresPropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteAccelerationStructuresPropertiesKHR; };
+        if constexpr (HasCmdWriteAccelerationStructuresPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteAccelerationStructuresPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteAccelerationStructuresPropertiesNV: {
+        constexpr bool HasCmdWriteAccelerationStructuresPropertiesNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteAccelerationStructuresPropertiesNV; };
+        if constexpr (HasCmdWriteAccelerationStructuresPropertiesNV)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteAccelerationStructuresPropertiesNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteBufferMarker2AMD: {
+        constexpr bool HasCmdWriteBufferMarker2AMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteBufferMarker2AMD; };
+        if constexpr (HasCmdWriteBufferMarker2AMD)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteBufferMarker2AMD<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteBufferMarkerAMD: {
+        constexpr bool HasCmdWriteBufferMarkerAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteBufferMarkerAMD; };
+        if constexpr (HasCmdWriteBufferMarkerAMD)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteBufferMarkerAMD<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteMicromapsPropertiesEXT: {
+        constexpr bool HasCmdWriteMicromapsPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteMicromapsPropertiesEXT; };
+        if constexpr (HasCmdWriteMicromapsPropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteMicromapsPropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteTimestamp: {
+        constexpr bool HasCmdWriteTimestamp = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteTimestamp; };
+        if constexpr (HasCmdWriteTimestamp)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteTimestamp<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteTimestamp2: {
+        constexpr bool HasCmdWriteTimestamp2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteTimestamp2; };
+        if constexpr (HasCmdWriteTimestamp2)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteTimestamp2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CmdWriteTimestamp2KHR: {
+        constexpr bool HasCmdWriteTimestamp2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CmdWriteTimestamp2KHR; };
+        if constexpr (HasCmdWriteTimestamp2KHR)
+          return (PFN_vkVoidFunction) &wrap_CmdWriteTimestamp2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CompileDeferredNV: {
+        constexpr bool HasCompileDeferredNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CompileDeferredNV; };
+        if constexpr (HasCompileDeferredNV)
+          return (PFN_vkVoidFunction) &wrap_CompileDeferredNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CopyAccelerationStructureKHR: {
+        constexpr bool HasCopyAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyAccelerationStructureKHR; };
+        if constexpr (HasCopyAccelerationStructureKHR)
+          return (PFN_vkVoidFunction) &wrap_CopyAccelerationStructureKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CopyAccelerationStructureToMemoryKHR: {
+        constexpr bool HasCopyAccelerationStructureToMemoryKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyAccelerationStructureToMemoryKHR; };
+        if constexpr (HasCopyAccelerationStructureToMemoryKHR)
+          return (PFN_vkVoidFunction) &wrap_CopyAccelerationStructureToMemoryKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CopyMemoryToAccelerationStructureKHR: {
+        constexpr bool HasCopyMemoryToAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMemoryToAccelerationStructureKHR; };
+        if constexpr (HasCopyMemoryToAccelerationStructureKHR)
+          return (PFN_vkVoidFunction) &wrap_CopyMemoryToAccelerationStructureKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CopyMemoryToMicromapEXT: {
+        constexpr bool HasCopyMemoryToMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMemoryToMicromapEXT; };
+        if constexpr (HasCopyMemoryToMicromapEXT)
+          return (PFN_vkVoidFunction) &wrap_CopyMemoryToMicromapEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CopyMicromapEXT: {
+        constexpr bool HasCopyMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMicromapEXT; };
+        if constexpr (HasCopyMicromapEXT)
+          return (PFN_vkVoidFunction) &wrap_CopyMicromapEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CopyMicromapToMemoryEXT: {
+        constexpr bool HasCopyMicromapToMemoryEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CopyMicromapToMemoryEXT; };
+        if constexpr (HasCopyMicromapToMemoryEXT)
+          return (PFN_vkVoidFunction) &wrap_CopyMicromapToMemoryEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateAccelerationStructureKHR: {
+        constexpr bool HasCreateAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateAccelerationStructureKHR; };
+        if constexpr (HasCreateAccelerationStructureKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateAccelerationStructureKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateAccelerationStructureNV: {
+        constexpr bool HasCreateAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateAccelerationStructureNV; };
+        if constexpr (HasCreateAccelerationStructureNV)
+          return (PFN_vkVoidFunction) &wrap_CreateAccelerationStructureNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateBuffer: {
+        constexpr bool HasCreateBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateBuffer; };
+        if constexpr (HasCreateBuffer)
+          return (PFN_vkVoidFunction) &wrap_CreateBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::CreateBufferCollectionFUCHSIA: {
+        constexpr bool HasCreateBufferCollectionFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateBufferCollectionFUCHSIA; };
+        if constexpr (HasCreateBufferCollectionFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_CreateBufferCollectionFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::CreateBufferView: {
+        constexpr bool HasCreateBufferView = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateBufferView; };
+        if constexpr (HasCreateBufferView)
+          return (PFN_vkVoidFunction) &wrap_CreateBufferView<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateCommandPool: {
+        constexpr bool HasCreateCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateCommandPool; };
+        if constexpr (HasCreateCommandPool)
+          return (PFN_vkVoidFunction) &wrap_CreateCommandPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateComputePipelines: {
+        constexpr bool HasCreateComputePipelines = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateComputePipelines; };
+        if constexpr (HasCreateComputePipelines)
+          return (PFN_vkVoidFunction) &wrap_CreateComputePipelines<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateDeferredOperationKHR: {
+        constexpr bool HasCreateDeferredOperationKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDeferredOperationKHR; };
+        if constexpr (HasCreateDeferredOperationKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateDeferredOperationKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorPool: {
+        constexpr bool HasCreateDescriptorPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorPool; };
+        if constexpr (HasCreateDescriptorPool)
+          return (PFN_vkVoidFunction) &wrap_CreateDescriptorPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorSetLayout: {
+        constexpr bool HasCreateDescriptorSetLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorSetLayout; };
+        if constexpr (HasCreateDescriptorSetLayout)
+          return (PFN_vkVoidFunction) &wrap_CreateDescriptorSetLayout<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorUpdateTemplate: {
+        constexpr bool HasCreateDescriptorUpdateTemplate = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorUpdateTemplate; };
+        if constexpr (HasCreateDescriptorUpdateTemplate)
+          return (PFN_vkVoidFunction) &wrap_CreateDescriptorUpdateTemplate<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateDescriptorUpdateTemplateKHR: {
+        constexpr bool HasCreateDescriptorUpdateTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateDescriptorUpdateTemplateKHR; };
+        if constexpr (HasCreateDescriptorUpdateTemplateKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateDescriptorUpdateTemplateKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateEvent: {
+        constexpr bool HasCreateEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateEvent; };
+        if constexpr (HasCreateEvent)
+          return (PFN_vkVoidFunction) &wrap_CreateEvent<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateFence: {
+        constexpr bool HasCreateFence = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateFence; };
+        if constexpr (HasCreateFence)
+          return (PFN_vkVoidFunction) &wrap_CreateFence<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateFramebuffer: {
+        constexpr bool HasCreateFramebuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateFramebuffer; };
+        if constexpr (HasCreateFramebuffer)
+          return (PFN_vkVoidFunction) &wrap_CreateFramebuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateGraphicsPipelines: {
+        constexpr bool HasCreateGraphicsPipelines = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateGraphicsPipelines; };
+        if constexpr (HasCreateGraphicsPipelines)
+          return (PFN_vkVoidFunction) &wrap_CreateGraphicsPipelines<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateImage: {
+        constexpr bool HasCreateImage = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateImage; };
+        if constexpr (HasCreateImage)
+          return (PFN_vkVoidFunction) &wrap_CreateImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateImageView: {
+        constexpr bool HasCreateImageView = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateImageView; };
+        if constexpr (HasCreateImageView)
+          return (PFN_vkVoidFunction) &wrap_CreateImageView<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateIndirectCommandsLayoutNV: {
+        constexpr bool HasCreateIndirectCommandsLayoutNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateIndirectCommandsLayoutNV; };
+        if constexpr (HasCreateIndirectCommandsLayoutNV)
+          return (PFN_vkVoidFunction) &wrap_CreateIndirectCommandsLayoutNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateMicromapEXT: {
+        constexpr bool HasCreateMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateMicromapEXT; };
+        if constexpr (HasCreateMicromapEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateMicromapEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateOpticalFlowSessionNV: {
+        constexpr bool HasCreateOpticalFlowSessionNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateOpticalFlowSessionNV; };
+        if constexpr (HasCreateOpticalFlowSessionNV)
+          return (PFN_vkVoidFunction) &wrap_CreateOpticalFlowSessionNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreatePipelineCache: {
+        constexpr bool HasCreatePipelineCache = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePipelineCache; };
+        if constexpr (HasCreatePipelineCache)
+          return (PFN_vkVoidFunction) &wrap_CreatePipelineCache<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreatePipelineLayout: {
+        constexpr bool HasCreatePipelineLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePipelineLayout; };
+        if constexpr (HasCreatePipelineLayout)
+          return (PFN_vkVoidFunction) &wrap_CreatePipelineLayout<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreatePrivateDataSlot: {
+        constexpr bool HasCreatePrivateDataSlot = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePrivateDataSlot; };
+        if constexpr (HasCreatePrivateDataSlot)
+          return (PFN_vkVoidFunction) &wrap_CreatePrivateDataSlot<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreatePrivateDataSlotEXT: {
+        constexpr bool HasCreatePrivateDataSlotEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreatePrivateDataSlotEXT; };
+        if constexpr (HasCreatePrivateDataSlotEXT)
+          return (PFN_vkVoidFunction) &wrap_CreatePrivateDataSlotEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateQueryPool: {
+        constexpr bool HasCreateQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateQueryPool; };
+        if constexpr (HasCreateQueryPool)
+          return (PFN_vkVoidFunction) &wrap_CreateQueryPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateRayTracingPipelinesKHR: {
+        constexpr bool HasCreateRayTracingPipelinesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRayTracingPipelinesKHR; };
+        if constexpr (HasCreateRayTracingPipelinesKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateRayTracingPipelinesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateRayTracingPipelinesNV: {
+        constexpr bool HasCreateRayTracingPipelinesNV = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRayTracingPipelinesNV; };
+        if constexpr (HasCreateRayTracingPipelinesNV)
+          return (PFN_vkVoidFunction) &wrap_CreateRayTracingPipelinesNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateRenderPass: {
+        constexpr bool HasCreateRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRenderPass; };
+        if constexpr (HasCreateRenderPass)
+          return (PFN_vkVoidFunction) &wrap_CreateRenderPass<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateRenderPass2: {
+        constexpr bool HasCreateRenderPass2 = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRenderPass2; };
+        if constexpr (HasCreateRenderPass2)
+          return (PFN_vkVoidFunction) &wrap_CreateRenderPass2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateRenderPass2KHR: {
+        constexpr bool HasCreateRenderPass2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateRenderPass2KHR; };
+        if constexpr (HasCreateRenderPass2KHR)
+          return (PFN_vkVoidFunction) &wrap_CreateRenderPass2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateSampler: {
+        constexpr bool HasCreateSampler = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSampler; };
+        if constexpr (HasCreateSampler)
+          return (PFN_vkVoidFunction) &wrap_CreateSampler<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateSamplerYcbcrConversion: {
+        constexpr bool HasCreateSamplerYcbcrConversion = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSamplerYcbcrConversion; };
+        if constexpr (HasCreateSamplerYcbcrConversion)
+          return (PFN_vkVoidFunction) &wrap_CreateSamplerYcbcrConversion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateSamplerYcbcrConversionKHR: {
+        constexpr bool HasCreateSamplerYcbcrConversionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSamplerYcbcrConversionKHR; };
+        if constexpr (HasCreateSamplerYcbcrConversionKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateSamplerYcbcrConversionKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateSemaphore: {
+        constexpr bool HasCreateSemaphore = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSemaphore; };
+        if constexpr (HasCreateSemaphore)
+          return (PFN_vkVoidFunction) &wrap_CreateSemaphore<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateShaderModule: {
+        constexpr bool HasCreateShaderModule = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateShaderModule; };
+        if constexpr (HasCreateShaderModule)
+          return (PFN_vkVoidFunction) &wrap_CreateShaderModule<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateShadersEXT: {
+        constexpr bool HasCreateShadersEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateShadersEXT; };
+        if constexpr (HasCreateShadersEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateShadersEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateSharedSwapchainsKHR: {
+        constexpr bool HasCreateSharedSwapchainsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSharedSwapchainsKHR; };
+        if constexpr (HasCreateSharedSwapchainsKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateSharedSwapchainsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateSwapchainKHR: {
+        constexpr bool HasCreateSwapchainKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateSwapchainKHR; };
+        if constexpr (HasCreateSwapchainKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateSwapchainKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateValidationCacheEXT: {
+        constexpr bool HasCreateValidationCacheEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateValidationCacheEXT; };
+        if constexpr (HasCreateValidationCacheEXT)
+          return (PFN_vkVoidFunction) &wrap_CreateValidationCacheEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateVideoSessionKHR: {
+        constexpr bool HasCreateVideoSessionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateVideoSessionKHR; };
+        if constexpr (HasCreateVideoSessionKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateVideoSessionKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::CreateVideoSessionParametersKHR: {
+        constexpr bool HasCreateVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::CreateVideoSessionParametersKHR; };
+        if constexpr (HasCreateVideoSessionParametersKHR)
+          return (PFN_vkVoidFunction) &wrap_CreateVideoSessionParametersKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DebugMarkerSetObjectNameEXT: {
+        constexpr bool HasDebugMarkerSetObjectNameEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DebugMarkerSetObjectNameEXT; };
+        if constexpr (HasDebugMarkerSetObjectNameEXT)
+          return (PFN_vkVoidFunction) &wrap_DebugMarkerSetObjectNameEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DebugMarkerSetObjectTagEXT: {
+        constexpr bool HasDebugMarkerSetObjectTagEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DebugMarkerSetObjectTagEXT; };
+        if constexpr (HasDebugMarkerSetObjectTagEXT)
+          return (PFN_vkVoidFunction) &wrap_DebugMarkerSetObjectTagEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DeferredOperationJoinKHR: {
+        constexpr bool HasDeferredOperationJoinKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DeferredOperationJoinKHR; };
+        if constexpr (HasDeferredOperationJoinKHR)
+          return (PFN_vkVoidFunction) &wrap_DeferredOperationJoinKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyAccelerationStructureKHR: {
+        constexpr bool HasDestroyAccelerationStructureKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyAccelerationStructureKHR; };
+        if constexpr (HasDestroyAccelerationStructureKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroyAccelerationStructureKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyAccelerationStructureNV: {
+        constexpr bool HasDestroyAccelerationStructureNV = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyAccelerationStructureNV; };
+        if constexpr (HasDestroyAccelerationStructureNV)
+          return (PFN_vkVoidFunction) &wrap_DestroyAccelerationStructureNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyBuffer: {
+        constexpr bool HasDestroyBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyBuffer; };
+        if constexpr (HasDestroyBuffer)
+          return (PFN_vkVoidFunction) &wrap_DestroyBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::DestroyBufferCollectionFUCHSIA: {
+        constexpr bool HasDestroyBufferCollectionFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyBufferCollectionFUCHSIA; };
+        if constexpr (HasDestroyBufferCollectionFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_DestroyBufferCollectionFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::DestroyBufferView: {
+        constexpr bool HasDestroyBufferView = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyBufferView; };
+        if constexpr (HasDestroyBufferView)
+          return (PFN_vkVoidFunction) &wrap_DestroyBufferView<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyCommandPool: {
+        constexpr bool HasDestroyCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyCommandPool; };
+        if constexpr (HasDestroyCommandPool)
+          return (PFN_vkVoidFunction) &wrap_DestroyCommandPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else if constexpr (!std::is_base_of<NoOverrides, DeviceOverrides>::value)
+          return (PFN_vkVoidFunction) &implicit_wrap_DestroyCommandPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyDeferredOperationKHR: {
+        constexpr bool HasDestroyDeferredOperationKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDeferredOperationKHR; };
+        if constexpr (HasDestroyDeferredOperationKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroyDeferredOperationKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorPool: {
+        constexpr bool HasDestroyDescriptorPool = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorPool; };
+        if constexpr (HasDestroyDescriptorPool)
+          return (PFN_vkVoidFunction) &wrap_DestroyDescriptorPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorSetLayout: {
+        constexpr bool HasDestroyDescriptorSetLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorSetLayout; };
+        if constexpr (HasDestroyDescriptorSetLayout)
+          return (PFN_vkVoidFunction) &wrap_DestroyDescriptorSetLayout<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorUpdateTemplate: {
+        constexpr bool HasDestroyDescriptorUpdateTemplate = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorUpdateTemplate; };
+        if constexpr (HasDestroyDescriptorUpdateTemplate)
+          return (PFN_vkVoidFunction) &wrap_DestroyDescriptorUpdateTemplate<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyDescriptorUpdateTemplateKHR: {
+        constexpr bool HasDestroyDescriptorUpdateTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDescriptorUpdateTemplateKHR; };
+        if constexpr (HasDestroyDescriptorUpdateTemplateKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroyDescriptorUpdateTemplateKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyDevice: {
+        constexpr bool HasDestroyDevice = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyDevice; };
+        if constexpr (HasDestroyDevice)
+          return (PFN_vkVoidFunction) &wrap_DestroyDevice<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else
+          return (PFN_vkVoidFunction) &implicit_wrap_DestroyDevice<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyEvent: {
+        constexpr bool HasDestroyEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyEvent; };
+        if constexpr (HasDestroyEvent)
+          return (PFN_vkVoidFunction) &wrap_DestroyEvent<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyFence: {
+        constexpr bool HasDestroyFence = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyFence; };
+        if constexpr (HasDestroyFence)
+          return (PFN_vkVoidFunction) &wrap_DestroyFence<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyFramebuffer: {
+        constexpr bool HasDestroyFramebuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyFramebuffer; };
+        if constexpr (HasDestroyFramebuffer)
+          return (PFN_vkVoidFunction) &wrap_DestroyFramebuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyImage: {
+        constexpr bool HasDestroyImage = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyImage; };
+        if constexpr (HasDestroyImage)
+          return (PFN_vkVoidFunction) &wrap_DestroyImage<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyImageView: {
+        constexpr bool HasDestroyImageView = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyImageView; };
+        if constexpr (HasDestroyImageView)
+          return (PFN_vkVoidFunction) &wrap_DestroyImageView<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyIndirectCommandsLayoutNV: {
+        constexpr bool HasDestroyIndirectCommandsLayoutNV = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyIndirectCommandsLayoutNV; };
+        if constexpr (HasDestroyIndirectCommandsLayoutNV)
+          return (PFN_vkVoidFunction) &wrap_DestroyIndirectCommandsLayoutNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyMicromapEXT: {
+        constexpr bool HasDestroyMicromapEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyMicromapEXT; };
+        if constexpr (HasDestroyMicromapEXT)
+          return (PFN_vkVoidFunction) &wrap_DestroyMicromapEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyOpticalFlowSessionNV: {
+        constexpr bool HasDestroyOpticalFlowSessionNV = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyOpticalFlowSessionNV; };
+        if constexpr (HasDestroyOpticalFlowSessionNV)
+          return (PFN_vkVoidFunction) &wrap_DestroyOpticalFlowSessionNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyPipeline: {
+        constexpr bool HasDestroyPipeline = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPipeline; };
+        if constexpr (HasDestroyPipeline)
+          return (PFN_vkVoidFunction) &wrap_DestroyPipeline<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyPipelineCache: {
+        constexpr bool HasDestroyPipelineCache = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPipelineCache; };
+        if constexpr (HasDestroyPipelineCache)
+          return (PFN_vkVoidFunction) &wrap_DestroyPipelineCache<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyPipelineLayout: {
+        constexpr bool HasDestroyPipelineLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPipelineLayout; };
+        if constexpr (HasDestroyPipelineLayout)
+          return (PFN_vkVoidFunction) &wrap_DestroyPipelineLayout<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyPrivateDataSlot: {
+        constexpr bool HasDestroyPrivateDataSlot = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPrivateDataSlot; };
+        if constexpr (HasDestroyPrivateDataSlot)
+          return (PFN_vkVoidFunction) &wrap_DestroyPrivateDataSlot<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyPrivateDataSlotEXT: {
+        constexpr bool HasDestroyPrivateDataSlotEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyPrivateDataSlotEXT; };
+        if constexpr (HasDestroyPrivateDataSlotEXT)
+          return (PFN_vkVoidFunction) &wrap_DestroyPrivateDataSlotEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyQueryPool: {
+        constexpr bool HasDestroyQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyQueryPool; };
+        if constexpr (HasDestroyQueryPool)
+          return (PFN_vkVoidFunction) &wrap_DestroyQueryPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyRenderPass: {
+        constexpr bool HasDestroyRenderPass = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyRenderPass; };
+        if constexpr (HasDestroyRenderPass)
+          return (PFN_vkVoidFunction) &wrap_DestroyRenderPass<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroySampler: {
+        constexpr bool HasDestroySampler = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySampler; };
+        if constexpr (HasDestroySampler)
+          return (PFN_vkVoidFunction) &wrap_DestroySampler<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroySamplerYcbcrConversion: {
+        constexpr bool HasDestroySamplerYcbcrConversion = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySamplerYcbcrConversion; };
+        if constexpr (HasDestroySamplerYcbcrConversion)
+          return (PFN_vkVoidFunction) &wrap_DestroySamplerYcbcrConversion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroySamplerYcbcrConversionKHR: {
+        constexpr bool HasDestroySamplerYcbcrConversionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySamplerYcbcrConversionKHR; };
+        if constexpr (HasDestroySamplerYcbcrConversionKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroySamplerYcbcrConversionKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroySemaphore: {
+        constexpr bool HasDestroySemaphore = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySemaphore; };
+        if constexpr (HasDestroySemaphore)
+          return (PFN_vkVoidFunction) &wrap_DestroySemaphore<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyShaderEXT: {
+        constexpr bool HasDestroyShaderEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyShaderEXT; };
+        if constexpr (HasDestroyShaderEXT)
+          return (PFN_vkVoidFunction) &wrap_DestroyShaderEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyShaderModule: {
+        constexpr bool HasDestroyShaderModule = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyShaderModule; };
+        if constexpr (HasDestroyShaderModule)
+          return (PFN_vkVoidFunction) &wrap_DestroyShaderModule<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroySwapchainKHR: {
+        constexpr bool HasDestroySwapchainKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroySwapchainKHR; };
+        if constexpr (HasDestroySwapchainKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroySwapchainKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyValidationCacheEXT: {
+        constexpr bool HasDestroyValidationCacheEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyValidationCacheEXT; };
+        if constexpr (HasDestroyValidationCacheEXT)
+          return (PFN_vkVoidFunction) &wrap_DestroyValidationCacheEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyVideoSessionKHR: {
+        constexpr bool HasDestroyVideoSessionKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyVideoSessionKHR; };
+        if constexpr (HasDestroyVideoSessionKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroyVideoSessionKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DestroyVideoSessionParametersKHR: {
+        constexpr bool HasDestroyVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::DestroyVideoSessionParametersKHR; };
+        if constexpr (HasDestroyVideoSessionParametersKHR)
+          return (PFN_vkVoidFunction) &wrap_DestroyVideoSessionParametersKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DeviceWaitIdle: {
+        constexpr bool HasDeviceWaitIdle = requires(const DeviceOverrides& t) { &DeviceOverrides::DeviceWaitIdle; };
+        if constexpr (HasDeviceWaitIdle)
+          return (PFN_vkVoidFunction) &wrap_DeviceWaitIdle<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::DisplayPowerControlEXT: {
+        constexpr bool HasDisplayPowerControlEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::DisplayPowerControlEXT; };
+        if constexpr (HasDisplayPowerControlEXT)
+          return (PFN_vkVoidFunction) &wrap_DisplayPowerControlEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::EndCommandBuffer: {
+        constexpr bool HasEndCommandBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::EndCommandBuffer; };
+        if constexpr (HasEndCommandBuffer)
+          return (PFN_vkVoidFunction) &wrap_EndCommandBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case procaddr::DeviceFunc::ExportMetalObjectsEXT: {
+        constexpr bool HasExportMetalObjectsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ExportMetalObjectsEXT; };
+        if constexpr (HasExportMetalObjectsEXT)
+          return (PFN_vkVoidFunction) &wrap_ExportMetalObjectsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::FlushMappedMemoryRanges: {
+        constexpr bool HasFlushMappedMemoryRanges = requires(const DeviceOverrides& t) { &DeviceOverrides::FlushMappedMemoryRanges; };
+        if constexpr (HasFlushMappedMemoryRanges)
+          return (PFN_vkVoidFunction) &wrap_FlushMappedMemoryRanges<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::FreeCommandBuffers: {
+        constexpr bool HasFreeCommandBuffers = requires(const DeviceOverrides& t) { &DeviceOverrides::FreeCommandBuffers; };
+        if constexpr (HasFreeCommandBuffers)
+          return (PFN_vkVoidFunction) &wrap_FreeCommandBuffers<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        else if constexpr (!std::is_base_of<NoOverrides, DeviceOverrides>::value)
+          return (PFN_vkVoidFunction) &implicit_wrap_FreeCommandBuffers<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::FreeDescriptorSets: {
+        constexpr bool HasFreeDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::FreeDescriptorSets; };
+        if constexpr (HasFreeDescriptorSets)
+          return (PFN_vkVoidFunction) &wrap_FreeDescriptorSets<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::FreeMemory: {
+        constexpr bool HasFreeMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::FreeMemory; };
+        if constexpr (HasFreeMemory)
+          return (PFN_vkVoidFunction) &wrap_FreeMemory<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureBuildSizesKHR: {
+        constexpr bool HasGetAccelerationStructureBuildSizesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureBuildSizesKHR; };
+        if constexpr (HasGetAccelerationStructureBuildSizesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetAccelerationStructureBuildSizesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureDeviceAddressKHR: {
+        constexpr bool HasGetAccelerationStructureDeviceAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureDeviceAddressKHR; };
+        if constexpr (HasGetAccelerationStructureDeviceAddressKHR)
+          return (PFN_vkVoidFunction) &wrap_GetAccelerationStructureDeviceAddressKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureHandleNV: {
+        constexpr bool HasGetAccelerationStructureHandleNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureHandleNV; };
+        if constexpr (HasGetAccelerationStructureHandleNV)
+          return (PFN_vkVoidFunction) &wrap_GetAccelerationStructureHandleNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureMemoryRequirementsNV: {
+        constexpr bool HasGetAccelerationStructureMemoryRequirementsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureMemoryRequirementsNV; };
+        if constexpr (HasGetAccelerationStructureMemoryRequirementsNV)
+          return (PFN_vkVoidFunction) &wrap_GetAccelerationStructureMemoryRequirementsNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetAccelerationStructureOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT; };
+        if constexpr (HasGetAccelerationStructureOpaqueCaptureDescriptorDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetAccelerationStructureOpaqueCaptureDescriptorDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case procaddr::DeviceFunc::GetAndroidHardwareBufferPropertiesANDROID: {
+        constexpr bool HasGetAndroidHardwareBufferPropertiesANDROID = requires(const DeviceOverrides& t) { &DeviceOverrides::GetAndroidHardwareBufferPropertiesANDROID; };
+        if constexpr (HasGetAndroidHardwareBufferPropertiesANDROID)
+          return (PFN_vkVoidFunction) &wrap_GetAndroidHardwareBufferPropertiesANDROID<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetBufferCollectionPropertiesFUCHSIA: {
+        constexpr bool HasGetBufferCollectionPropertiesFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferCollectionPropertiesFUCHSIA; };
+        if constexpr (HasGetBufferCollectionPropertiesFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_GetBufferCollectionPropertiesFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetBufferDeviceAddress: {
+        constexpr bool HasGetBufferDeviceAddress = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferDeviceAddress; };
+        if constexpr (HasGetBufferDeviceAddress)
+          return (PFN_vkVoidFunction) &wrap_GetBufferDeviceAddress<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferDeviceAddressEXT: {
+        constexpr bool HasGetBufferDeviceAddressEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferDeviceAddressEXT; };
+        if constexpr (HasGetBufferDeviceAddressEXT)
+          return (PFN_vkVoidFunction) &wrap_GetBufferDeviceAddressEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferDeviceAddressKHR: {
+        constexpr bool HasGetBufferDeviceAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferDeviceAddressKHR; };
+        if constexpr (HasGetBufferDeviceAddressKHR)
+          return (PFN_vkVoidFunction) &wrap_GetBufferDeviceAddressKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferMemoryRequirements: {
+        constexpr bool HasGetBufferMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferMemoryRequirements; };
+        if constexpr (HasGetBufferMemoryRequirements)
+          return (PFN_vkVoidFunction) &wrap_GetBufferMemoryRequirements<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferMemoryRequirements2: {
+        constexpr bool HasGetBufferMemoryRequirements2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferMemoryRequirements2; };
+        if constexpr (HasGetBufferMemoryRequirements2)
+          return (PFN_vkVoidFunction) &wrap_GetBufferMemoryRequirements2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferMemoryRequirements2KHR: {
+        constexpr bool HasGetBufferMemoryRequirements2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferMemoryRequirements2KHR; };
+        if constexpr (HasGetBufferMemoryRequirements2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetBufferMemoryRequirements2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferOpaqueCaptureAddress: {
+        constexpr bool HasGetBufferOpaqueCaptureAddress = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferOpaqueCaptureAddress; };
+        if constexpr (HasGetBufferOpaqueCaptureAddress)
+          return (PFN_vkVoidFunction) &wrap_GetBufferOpaqueCaptureAddress<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferOpaqueCaptureAddressKHR: {
+        constexpr bool HasGetBufferOpaqueCaptureAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferOpaqueCaptureAddressKHR; };
+        if constexpr (HasGetBufferOpaqueCaptureAddressKHR)
+          return (PFN_vkVoidFunction) &wrap_GetBufferOpaqueCaptureAddressKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetBufferOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetBufferOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetBufferOpaqueCaptureDescriptorDataEXT; };
+        if constexpr (HasGetBufferOpaqueCaptureDescriptorDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetBufferOpaqueCaptureDescriptorDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetCalibratedTimestampsEXT: {
+        constexpr bool HasGetCalibratedTimestampsEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetCalibratedTimestampsEXT; };
+        if constexpr (HasGetCalibratedTimestampsEXT)
+          return (PFN_vkVoidFunction) &wrap_GetCalibratedTimestampsEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeferredOperationMaxConcurrencyKHR: {
+        constexpr bool HasGetDeferredOperationMaxConcurrencyKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeferredOperationMaxConcurrencyKHR; };
+        if constexpr (HasGetDeferredOperationMaxConcurrencyKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeferredOperationMaxConcurrencyKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeferredOperationResultKHR: {
+        constexpr bool HasGetDeferredOperationResultKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeferredOperationResultKHR; };
+        if constexpr (HasGetDeferredOperationResultKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeferredOperationResultKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorEXT: {
+        constexpr bool HasGetDescriptorEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorEXT; };
+        if constexpr (HasGetDescriptorEXT)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetHostMappingVALVE: {
+        constexpr bool HasGetDescriptorSetHostMappingVALVE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetHostMappingVALVE; };
+        if constexpr (HasGetDescriptorSetHostMappingVALVE)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorSetHostMappingVALVE<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutBindingOffsetEXT: {
+        constexpr bool HasGetDescriptorSetLayoutBindingOffsetEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutBindingOffsetEXT; };
+        if constexpr (HasGetDescriptorSetLayoutBindingOffsetEXT)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorSetLayoutBindingOffsetEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutHostMappingInfoVALVE: {
+        constexpr bool HasGetDescriptorSetLayoutHostMappingInfoVALVE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutHostMappingInfoVALVE; };
+        if constexpr (HasGetDescriptorSetLayoutHostMappingInfoVALVE)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorSetLayoutHostMappingInfoVALVE<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutSizeEXT: {
+        constexpr bool HasGetDescriptorSetLayoutSizeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutSizeEXT; };
+        if constexpr (HasGetDescriptorSetLayoutSizeEXT)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorSetLayoutSizeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutSupport: {
+        constexpr bool HasGetDescriptorSetLayoutSupport = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutSupport; };
+        if constexpr (HasGetDescriptorSetLayoutSupport)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorSetLayoutSupport<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDescriptorSetLayoutSupportKHR: {
+        constexpr bool HasGetDescriptorSetLayoutSupportKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDescriptorSetLayoutSupportKHR; };
+        if constexpr (HasGetDescriptorSetLayoutSupportKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDescriptorSetLayoutSupportKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceAccelerationStructureCompatibilityKHR: {
+        constexpr bool HasGetDeviceAccelerationStructureCompatibilityKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceAccelerationStructureCompatibilityKHR; };
+        if constexpr (HasGetDeviceAccelerationStructureCompatibilityKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceAccelerationStructureCompatibilityKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceBufferMemoryRequirements: {
+        constexpr bool HasGetDeviceBufferMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceBufferMemoryRequirements; };
+        if constexpr (HasGetDeviceBufferMemoryRequirements)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceBufferMemoryRequirements<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceBufferMemoryRequirementsKHR: {
+        constexpr bool HasGetDeviceBufferMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceBufferMemoryRequirementsKHR; };
+        if constexpr (HasGetDeviceBufferMemoryRequirementsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceBufferMemoryRequirementsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceFaultInfoEXT: {
+        constexpr bool HasGetDeviceFaultInfoEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceFaultInfoEXT; };
+        if constexpr (HasGetDeviceFaultInfoEXT)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceFaultInfoEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeatures: {
+        constexpr bool HasGetDeviceGroupPeerMemoryFeatures = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupPeerMemoryFeatures; };
+        if constexpr (HasGetDeviceGroupPeerMemoryFeatures)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceGroupPeerMemoryFeatures<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceGroupPeerMemoryFeaturesKHR: {
+        constexpr bool HasGetDeviceGroupPeerMemoryFeaturesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupPeerMemoryFeaturesKHR; };
+        if constexpr (HasGetDeviceGroupPeerMemoryFeaturesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceGroupPeerMemoryFeaturesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceGroupPresentCapabilitiesKHR: {
+        constexpr bool HasGetDeviceGroupPresentCapabilitiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupPresentCapabilitiesKHR; };
+        if constexpr (HasGetDeviceGroupPresentCapabilitiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceGroupPresentCapabilitiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModes2EXT: {
+        constexpr bool HasGetDeviceGroupSurfacePresentModes2EXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupSurfacePresentModes2EXT; };
+        if constexpr (HasGetDeviceGroupSurfacePresentModes2EXT)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceGroupSurfacePresentModes2EXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetDeviceGroupSurfacePresentModesKHR: {
+        constexpr bool HasGetDeviceGroupSurfacePresentModesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceGroupSurfacePresentModesKHR; };
+        if constexpr (HasGetDeviceGroupSurfacePresentModesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceGroupSurfacePresentModesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageMemoryRequirements: {
+        constexpr bool HasGetDeviceImageMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageMemoryRequirements; };
+        if constexpr (HasGetDeviceImageMemoryRequirements)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceImageMemoryRequirements<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageMemoryRequirementsKHR: {
+        constexpr bool HasGetDeviceImageMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageMemoryRequirementsKHR; };
+        if constexpr (HasGetDeviceImageMemoryRequirementsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceImageMemoryRequirementsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirements: {
+        constexpr bool HasGetDeviceImageSparseMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageSparseMemoryRequirements; };
+        if constexpr (HasGetDeviceImageSparseMemoryRequirements)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceImageSparseMemoryRequirements<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceImageSparseMemoryRequirementsKHR: {
+        constexpr bool HasGetDeviceImageSparseMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceImageSparseMemoryRequirementsKHR; };
+        if constexpr (HasGetDeviceImageSparseMemoryRequirementsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceImageSparseMemoryRequirementsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceMemoryCommitment: {
+        constexpr bool HasGetDeviceMemoryCommitment = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMemoryCommitment; };
+        if constexpr (HasGetDeviceMemoryCommitment)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceMemoryCommitment<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddress: {
+        constexpr bool HasGetDeviceMemoryOpaqueCaptureAddress = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMemoryOpaqueCaptureAddress; };
+        if constexpr (HasGetDeviceMemoryOpaqueCaptureAddress)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceMemoryOpaqueCaptureAddress<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceMemoryOpaqueCaptureAddressKHR: {
+        constexpr bool HasGetDeviceMemoryOpaqueCaptureAddressKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMemoryOpaqueCaptureAddressKHR; };
+        if constexpr (HasGetDeviceMemoryOpaqueCaptureAddressKHR)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceMemoryOpaqueCaptureAddressKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceMicromapCompatibilityEXT: {
+        constexpr bool HasGetDeviceMicromapCompatibilityEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceMicromapCompatibilityEXT; };
+        if constexpr (HasGetDeviceMicromapCompatibilityEXT)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceMicromapCompatibilityEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceProcAddr: {
+        return (PFN_vkVoidFunction) &GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+      }
+      case procaddr::DeviceFunc::GetDeviceQueue: {
+        constexpr bool HasGetDeviceQueue = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceQueue; };
+        if constexpr (HasGetDeviceQueue)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceQueue<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceQueue2: {
+        constexpr bool HasGetDeviceQueue2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceQueue2; };
+        if constexpr (HasGetDeviceQueue2)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceQueue2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI: {
+        constexpr bool HasGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI; };
+        if constexpr (HasGetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI)
+          return (PFN_vkVoidFunction) &wrap_GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetDynamicRenderingTilePropertiesQCOM: {
+        constexpr bool HasGetDynamicRenderingTilePropertiesQCOM = requires(const DeviceOverrides& t) { &DeviceOverrides::GetDynamicRenderingTilePropertiesQCOM; };
+        if constexpr (HasGetDynamicRenderingTilePropertiesQCOM)
+          return (PFN_vkVoidFunction) &wrap_GetDynamicRenderingTilePropertiesQCOM<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case procaddr::DeviceFunc::GetEncodedVideoSessionParametersKHR: {
+        constexpr bool HasGetEncodedVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetEncodedVideoSessionParametersKHR; };
+        if constexpr (HasGetEncodedVideoSessionParametersKHR)
+          return (PFN_vkVoidFunction) &wrap_GetEncodedVideoSessionParametersKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetEventStatus: {
+        constexpr bool HasGetEventStatus = requires(const DeviceOverrides& t) { &DeviceOverrides::GetEventStatus; };
+        if constexpr (HasGetEventStatus)
+          return (PFN_vkVoidFunction) &wrap_GetEventStatus<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetFenceFdKHR: {
+        constexpr bool HasGetFenceFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFenceFdKHR; };
+        if constexpr (HasGetFenceFdKHR)
+          return (PFN_vkVoidFunction) &wrap_GetFenceFdKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetFenceStatus: {
+        constexpr bool HasGetFenceStatus = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFenceStatus; };
+        if constexpr (HasGetFenceStatus)
+          return (PFN_vkVoidFunction) &wrap_GetFenceStatus<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetFenceWin32HandleKHR: {
+        constexpr bool HasGetFenceWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFenceWin32HandleKHR; };
+        if constexpr (HasGetFenceWin32HandleKHR)
+          return (PFN_vkVoidFunction) &wrap_GetFenceWin32HandleKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetFramebufferTilePropertiesQCOM: {
+        constexpr bool HasGetFramebufferTilePropertiesQCOM = requires(const DeviceOverrides& t) { &DeviceOverrides::GetFramebufferTilePropertiesQCOM; };
+        if constexpr (HasGetFramebufferTilePropertiesQCOM)
+          return (PFN_vkVoidFunction) &wrap_GetFramebufferTilePropertiesQCOM<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetGeneratedCommandsMemoryRequirementsNV: {
+        constexpr bool HasGetGeneratedCommandsMemoryRequirementsNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetGeneratedCommandsMemoryRequirementsNV; };
+        if constexpr (HasGetGeneratedCommandsMemoryRequirementsNV)
+          return (PFN_vkVoidFunction) &wrap_GetGeneratedCommandsMemoryRequirementsNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageDrmFormatModifierPropertiesEXT: {
+        constexpr bool HasGetImageDrmFormatModifierPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageDrmFormatModifierPropertiesEXT; };
+        if constexpr (HasGetImageDrmFormatModifierPropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_GetImageDrmFormatModifierPropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageMemoryRequirements: {
+        constexpr bool HasGetImageMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageMemoryRequirements; };
+        if constexpr (HasGetImageMemoryRequirements)
+          return (PFN_vkVoidFunction) &wrap_GetImageMemoryRequirements<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageMemoryRequirements2: {
+        constexpr bool HasGetImageMemoryRequirements2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageMemoryRequirements2; };
+        if constexpr (HasGetImageMemoryRequirements2)
+          return (PFN_vkVoidFunction) &wrap_GetImageMemoryRequirements2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageMemoryRequirements2KHR: {
+        constexpr bool HasGetImageMemoryRequirements2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageMemoryRequirements2KHR; };
+        if constexpr (HasGetImageMemoryRequirements2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetImageMemoryRequirements2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetImageOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageOpaqueCaptureDescriptorDataEXT; };
+        if constexpr (HasGetImageOpaqueCaptureDescriptorDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetImageOpaqueCaptureDescriptorDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageSparseMemoryRequirements: {
+        constexpr bool HasGetImageSparseMemoryRequirements = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSparseMemoryRequirements; };
+        if constexpr (HasGetImageSparseMemoryRequirements)
+          return (PFN_vkVoidFunction) &wrap_GetImageSparseMemoryRequirements<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageSparseMemoryRequirements2: {
+        constexpr bool HasGetImageSparseMemoryRequirements2 = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSparseMemoryRequirements2; };
+        if constexpr (HasGetImageSparseMemoryRequirements2)
+          return (PFN_vkVoidFunction) &wrap_GetImageSparseMemoryRequirements2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageSparseMemoryRequirements2KHR: {
+        constexpr bool HasGetImageSparseMemoryRequirements2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSparseMemoryRequirements2KHR; };
+        if constexpr (HasGetImageSparseMemoryRequirements2KHR)
+          return (PFN_vkVoidFunction) &wrap_GetImageSparseMemoryRequirements2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageSubresourceLayout: {
+        constexpr bool HasGetImageSubresourceLayout = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSubresourceLayout; };
+        if constexpr (HasGetImageSubresourceLayout)
+          return (PFN_vkVoidFunction) &wrap_GetImageSubresourceLayout<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageSubresourceLayout2EXT: {
+        constexpr bool HasGetImageSubresourceLayout2EXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageSubresourceLayout2EXT; };
+        if constexpr (HasGetImageSubresourceLayout2EXT)
+          return (PFN_vkVoidFunction) &wrap_GetImageSubresourceLayout2EXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetImageViewOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetImageViewOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetImageViewOpaqueCaptureDescriptorDataEXT; };
+        if constexpr (HasGetImageViewOpaqueCaptureDescriptorDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetImageViewOpaqueCaptureDescriptorDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case procaddr::DeviceFunc::GetMemoryAndroidHardwareBufferANDROID: {
+        constexpr bool HasGetMemoryAndroidHardwareBufferANDROID = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryAndroidHardwareBufferANDROID; };
+        if constexpr (HasGetMemoryAndroidHardwareBufferANDROID)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryAndroidHardwareBufferANDROID<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetMemoryFdKHR: {
+        constexpr bool HasGetMemoryFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryFdKHR; };
+        if constexpr (HasGetMemoryFdKHR)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryFdKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetMemoryFdPropertiesKHR: {
+        constexpr bool HasGetMemoryFdPropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryFdPropertiesKHR; };
+        if constexpr (HasGetMemoryFdPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryFdPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetMemoryHostPointerPropertiesEXT: {
+        constexpr bool HasGetMemoryHostPointerPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryHostPointerPropertiesEXT; };
+        if constexpr (HasGetMemoryHostPointerPropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryHostPointerPropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetMemoryRemoteAddressNV: {
+        constexpr bool HasGetMemoryRemoteAddressNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryRemoteAddressNV; };
+        if constexpr (HasGetMemoryRemoteAddressNV)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryRemoteAddressNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetMemoryWin32HandleKHR: {
+        constexpr bool HasGetMemoryWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryWin32HandleKHR; };
+        if constexpr (HasGetMemoryWin32HandleKHR)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryWin32HandleKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetMemoryWin32HandleNV: {
+        constexpr bool HasGetMemoryWin32HandleNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryWin32HandleNV; };
+        if constexpr (HasGetMemoryWin32HandleNV)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryWin32HandleNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetMemoryWin32HandlePropertiesKHR: {
+        constexpr bool HasGetMemoryWin32HandlePropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryWin32HandlePropertiesKHR; };
+        if constexpr (HasGetMemoryWin32HandlePropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryWin32HandlePropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetMemoryZirconHandleFUCHSIA: {
+        constexpr bool HasGetMemoryZirconHandleFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryZirconHandleFUCHSIA; };
+        if constexpr (HasGetMemoryZirconHandleFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryZirconHandleFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetMemoryZirconHandlePropertiesFUCHSIA: {
+        constexpr bool HasGetMemoryZirconHandlePropertiesFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMemoryZirconHandlePropertiesFUCHSIA; };
+        if constexpr (HasGetMemoryZirconHandlePropertiesFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_GetMemoryZirconHandlePropertiesFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetMicromapBuildSizesEXT: {
+        constexpr bool HasGetMicromapBuildSizesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetMicromapBuildSizesEXT; };
+        if constexpr (HasGetMicromapBuildSizesEXT)
+          return (PFN_vkVoidFunction) &wrap_GetMicromapBuildSizesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPastPresentationTimingGOOGLE: {
+        constexpr bool HasGetPastPresentationTimingGOOGLE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPastPresentationTimingGOOGLE; };
+        if constexpr (HasGetPastPresentationTimingGOOGLE)
+          return (PFN_vkVoidFunction) &wrap_GetPastPresentationTimingGOOGLE<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPerformanceParameterINTEL: {
+        constexpr bool HasGetPerformanceParameterINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPerformanceParameterINTEL; };
+        if constexpr (HasGetPerformanceParameterINTEL)
+          return (PFN_vkVoidFunction) &wrap_GetPerformanceParameterINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPipelineCacheData: {
+        constexpr bool HasGetPipelineCacheData = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineCacheData; };
+        if constexpr (HasGetPipelineCacheData)
+          return (PFN_vkVoidFunction) &wrap_GetPipelineCacheData<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPipelineExecutableInternalRepresentationsKHR: {
+        constexpr bool HasGetPipelineExecutableInternalRepresentationsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineExecutableInternalRepresentationsKHR; };
+        if constexpr (HasGetPipelineExecutableInternalRepresentationsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPipelineExecutableInternalRepresentationsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPipelineExecutablePropertiesKHR: {
+        constexpr bool HasGetPipelineExecutablePropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineExecutablePropertiesKHR; };
+        if constexpr (HasGetPipelineExecutablePropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPipelineExecutablePropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPipelineExecutableStatisticsKHR: {
+        constexpr bool HasGetPipelineExecutableStatisticsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelineExecutableStatisticsKHR; };
+        if constexpr (HasGetPipelineExecutableStatisticsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetPipelineExecutableStatisticsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPipelinePropertiesEXT: {
+        constexpr bool HasGetPipelinePropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPipelinePropertiesEXT; };
+        if constexpr (HasGetPipelinePropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_GetPipelinePropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPrivateData: {
+        constexpr bool HasGetPrivateData = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPrivateData; };
+        if constexpr (HasGetPrivateData)
+          return (PFN_vkVoidFunction) &wrap_GetPrivateData<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetPrivateDataEXT: {
+        constexpr bool HasGetPrivateDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetPrivateDataEXT; };
+        if constexpr (HasGetPrivateDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetPrivateDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetQueryPoolResults: {
+        constexpr bool HasGetQueryPoolResults = requires(const DeviceOverrides& t) { &DeviceOverrides::GetQueryPoolResults; };
+        if constexpr (HasGetQueryPoolResults)
+          return (PFN_vkVoidFunction) &wrap_GetQueryPoolResults<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetQueueCheckpointData2NV: {
+        constexpr bool HasGetQueueCheckpointData2NV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetQueueCheckpointData2NV; };
+        if constexpr (HasGetQueueCheckpointData2NV)
+          return (PFN_vkVoidFunction) &wrap_GetQueueCheckpointData2NV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetQueueCheckpointDataNV: {
+        constexpr bool HasGetQueueCheckpointDataNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetQueueCheckpointDataNV; };
+        if constexpr (HasGetQueueCheckpointDataNV)
+          return (PFN_vkVoidFunction) &wrap_GetQueueCheckpointDataNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetRayTracingCaptureReplayShaderGroupHandlesKHR: {
+        constexpr bool HasGetRayTracingCaptureReplayShaderGroupHandlesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingCaptureReplayShaderGroupHandlesKHR; };
+        if constexpr (HasGetRayTracingCaptureReplayShaderGroupHandlesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetRayTracingCaptureReplayShaderGroupHandlesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesKHR: {
+        constexpr bool HasGetRayTracingShaderGroupHandlesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingShaderGroupHandlesKHR; };
+        if constexpr (HasGetRayTracingShaderGroupHandlesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetRayTracingShaderGroupHandlesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetRayTracingShaderGroupHandlesNV: {
+        constexpr bool HasGetRayTracingShaderGroupHandlesNV = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingShaderGroupHandlesNV; };
+        if constexpr (HasGetRayTracingShaderGroupHandlesNV)
+          return (PFN_vkVoidFunction) &wrap_GetRayTracingShaderGroupHandlesNV<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetRayTracingShaderGroupStackSizeKHR: {
+        constexpr bool HasGetRayTracingShaderGroupStackSizeKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRayTracingShaderGroupStackSizeKHR; };
+        if constexpr (HasGetRayTracingShaderGroupStackSizeKHR)
+          return (PFN_vkVoidFunction) &wrap_GetRayTracingShaderGroupStackSizeKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetRefreshCycleDurationGOOGLE: {
+        constexpr bool HasGetRefreshCycleDurationGOOGLE = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRefreshCycleDurationGOOGLE; };
+        if constexpr (HasGetRefreshCycleDurationGOOGLE)
+          return (PFN_vkVoidFunction) &wrap_GetRefreshCycleDurationGOOGLE<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetRenderAreaGranularity: {
+        constexpr bool HasGetRenderAreaGranularity = requires(const DeviceOverrides& t) { &DeviceOverrides::GetRenderAreaGranularity; };
+        if constexpr (HasGetRenderAreaGranularity)
+          return (PFN_vkVoidFunction) &wrap_GetRenderAreaGranularity<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSamplerOpaqueCaptureDescriptorDataEXT: {
+        constexpr bool HasGetSamplerOpaqueCaptureDescriptorDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSamplerOpaqueCaptureDescriptorDataEXT; };
+        if constexpr (HasGetSamplerOpaqueCaptureDescriptorDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetSamplerOpaqueCaptureDescriptorDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSemaphoreCounterValue: {
+        constexpr bool HasGetSemaphoreCounterValue = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreCounterValue; };
+        if constexpr (HasGetSemaphoreCounterValue)
+          return (PFN_vkVoidFunction) &wrap_GetSemaphoreCounterValue<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSemaphoreCounterValueKHR: {
+        constexpr bool HasGetSemaphoreCounterValueKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreCounterValueKHR; };
+        if constexpr (HasGetSemaphoreCounterValueKHR)
+          return (PFN_vkVoidFunction) &wrap_GetSemaphoreCounterValueKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSemaphoreFdKHR: {
+        constexpr bool HasGetSemaphoreFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreFdKHR; };
+        if constexpr (HasGetSemaphoreFdKHR)
+          return (PFN_vkVoidFunction) &wrap_GetSemaphoreFdKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::GetSemaphoreWin32HandleKHR: {
+        constexpr bool HasGetSemaphoreWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreWin32HandleKHR; };
+        if constexpr (HasGetSemaphoreWin32HandleKHR)
+          return (PFN_vkVoidFunction) &wrap_GetSemaphoreWin32HandleKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::GetSemaphoreZirconHandleFUCHSIA: {
+        constexpr bool HasGetSemaphoreZirconHandleFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSemaphoreZirconHandleFUCHSIA; };
+        if constexpr (HasGetSemaphoreZirconHandleFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_GetSemaphoreZirconHandleFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::GetShaderBinaryDataEXT: {
+        constexpr bool HasGetShaderBinaryDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderBinaryDataEXT; };
+        if constexpr (HasGetShaderBinaryDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetShaderBinaryDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetShaderInfoAMD: {
+        constexpr bool HasGetShaderInfoAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderInfoAMD; };
+        if constexpr (HasGetShaderInfoAMD)
+          return (PFN_vkVoidFunction) &wrap_GetShaderInfoAMD<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetShaderModuleCreateInfoIdentifierEXT: {
+        constexpr bool HasGetShaderModuleCreateInfoIdentifierEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderModuleCreateInfoIdentifierEXT; };
+        if constexpr (HasGetShaderModuleCreateInfoIdentifierEXT)
+          return (PFN_vkVoidFunction) &wrap_GetShaderModuleCreateInfoIdentifierEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetShaderModuleIdentifierEXT: {
+        constexpr bool HasGetShaderModuleIdentifierEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetShaderModuleIdentifierEXT; };
+        if constexpr (HasGetShaderModuleIdentifierEXT)
+          return (PFN_vkVoidFunction) &wrap_GetShaderModuleIdentifierEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSwapchainCounterEXT: {
+        constexpr bool HasGetSwapchainCounterEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSwapchainCounterEXT; };
+        if constexpr (HasGetSwapchainCounterEXT)
+          return (PFN_vkVoidFunction) &wrap_GetSwapchainCounterEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSwapchainImagesKHR: {
+        constexpr bool HasGetSwapchainImagesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSwapchainImagesKHR; };
+        if constexpr (HasGetSwapchainImagesKHR)
+          return (PFN_vkVoidFunction) &wrap_GetSwapchainImagesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetSwapchainStatusKHR: {
+        constexpr bool HasGetSwapchainStatusKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetSwapchainStatusKHR; };
+        if constexpr (HasGetSwapchainStatusKHR)
+          return (PFN_vkVoidFunction) &wrap_GetSwapchainStatusKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetValidationCacheDataEXT: {
+        constexpr bool HasGetValidationCacheDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::GetValidationCacheDataEXT; };
+        if constexpr (HasGetValidationCacheDataEXT)
+          return (PFN_vkVoidFunction) &wrap_GetValidationCacheDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::GetVideoSessionMemoryRequirementsKHR: {
+        constexpr bool HasGetVideoSessionMemoryRequirementsKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::GetVideoSessionMemoryRequirementsKHR; };
+        if constexpr (HasGetVideoSessionMemoryRequirementsKHR)
+          return (PFN_vkVoidFunction) &wrap_GetVideoSessionMemoryRequirementsKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ImportFenceFdKHR: {
+        constexpr bool HasImportFenceFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportFenceFdKHR; };
+        if constexpr (HasImportFenceFdKHR)
+          return (PFN_vkVoidFunction) &wrap_ImportFenceFdKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::ImportFenceWin32HandleKHR: {
+        constexpr bool HasImportFenceWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportFenceWin32HandleKHR; };
+        if constexpr (HasImportFenceWin32HandleKHR)
+          return (PFN_vkVoidFunction) &wrap_ImportFenceWin32HandleKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::ImportSemaphoreFdKHR: {
+        constexpr bool HasImportSemaphoreFdKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportSemaphoreFdKHR; };
+        if constexpr (HasImportSemaphoreFdKHR)
+          return (PFN_vkVoidFunction) &wrap_ImportSemaphoreFdKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::ImportSemaphoreWin32HandleKHR: {
+        constexpr bool HasImportSemaphoreWin32HandleKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportSemaphoreWin32HandleKHR; };
+        if constexpr (HasImportSemaphoreWin32HandleKHR)
+          return (PFN_vkVoidFunction) &wrap_ImportSemaphoreWin32HandleKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::ImportSemaphoreZirconHandleFUCHSIA: {
+        constexpr bool HasImportSemaphoreZirconHandleFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::ImportSemaphoreZirconHandleFUCHSIA; };
+        if constexpr (HasImportSemaphoreZirconHandleFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_ImportSemaphoreZirconHandleFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::InitializePerformanceApiINTEL: {
+        constexpr bool HasInitializePerformanceApiINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::InitializePerformanceApiINTEL; };
+        if constexpr (HasInitializePerformanceApiINTEL)
+          return (PFN_vkVoidFunction) &wrap_InitializePerformanceApiINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::InvalidateMappedMemoryRanges: {
+        constexpr bool HasInvalidateMappedMemoryRanges = requires(const DeviceOverrides& t) { &DeviceOverrides::InvalidateMappedMemoryRanges; };
+        if constexpr (HasInvalidateMappedMemoryRanges)
+          return (PFN_vkVoidFunction) &wrap_InvalidateMappedMemoryRanges<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::MapMemory: {
+        constexpr bool HasMapMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::MapMemory; };
+        if constexpr (HasMapMemory)
+          return (PFN_vkVoidFunction) &wrap_MapMemory<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::MapMemory2KHR: {
+        constexpr bool HasMapMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::MapMemory2KHR; };
+        if constexpr (HasMapMemory2KHR)
+          return (PFN_vkVoidFunction) &wrap_MapMemory2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::MergePipelineCaches: {
+        constexpr bool HasMergePipelineCaches = requires(const DeviceOverrides& t) { &DeviceOverrides::MergePipelineCaches; };
+        if constexpr (HasMergePipelineCaches)
+          return (PFN_vkVoidFunction) &wrap_MergePipelineCaches<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::MergeValidationCachesEXT: {
+        constexpr bool HasMergeValidationCachesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::MergeValidationCachesEXT; };
+        if constexpr (HasMergeValidationCachesEXT)
+          return (PFN_vkVoidFunction) &wrap_MergeValidationCachesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueBeginDebugUtilsLabelEXT: {
+        constexpr bool HasQueueBeginDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueBeginDebugUtilsLabelEXT; };
+        if constexpr (HasQueueBeginDebugUtilsLabelEXT)
+          return (PFN_vkVoidFunction) &wrap_QueueBeginDebugUtilsLabelEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueBindSparse: {
+        constexpr bool HasQueueBindSparse = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueBindSparse; };
+        if constexpr (HasQueueBindSparse)
+          return (PFN_vkVoidFunction) &wrap_QueueBindSparse<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueEndDebugUtilsLabelEXT: {
+        constexpr bool HasQueueEndDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueEndDebugUtilsLabelEXT; };
+        if constexpr (HasQueueEndDebugUtilsLabelEXT)
+          return (PFN_vkVoidFunction) &wrap_QueueEndDebugUtilsLabelEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueInsertDebugUtilsLabelEXT: {
+        constexpr bool HasQueueInsertDebugUtilsLabelEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueInsertDebugUtilsLabelEXT; };
+        if constexpr (HasQueueInsertDebugUtilsLabelEXT)
+          return (PFN_vkVoidFunction) &wrap_QueueInsertDebugUtilsLabelEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueuePresentKHR: {
+        constexpr bool HasQueuePresentKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::QueuePresentKHR; };
+        if constexpr (HasQueuePresentKHR)
+          return (PFN_vkVoidFunction) &wrap_QueuePresentKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueSetPerformanceConfigurationINTEL: {
+        constexpr bool HasQueueSetPerformanceConfigurationINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSetPerformanceConfigurationINTEL; };
+        if constexpr (HasQueueSetPerformanceConfigurationINTEL)
+          return (PFN_vkVoidFunction) &wrap_QueueSetPerformanceConfigurationINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueSubmit: {
+        constexpr bool HasQueueSubmit = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSubmit; };
+        if constexpr (HasQueueSubmit)
+          return (PFN_vkVoidFunction) &wrap_QueueSubmit<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueSubmit2: {
+        constexpr bool HasQueueSubmit2 = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSubmit2; };
+        if constexpr (HasQueueSubmit2)
+          return (PFN_vkVoidFunction) &wrap_QueueSubmit2<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueSubmit2KHR: {
+        constexpr bool HasQueueSubmit2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueSubmit2KHR; };
+        if constexpr (HasQueueSubmit2KHR)
+          return (PFN_vkVoidFunction) &wrap_QueueSubmit2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::QueueWaitIdle: {
+        constexpr bool HasQueueWaitIdle = requires(const DeviceOverrides& t) { &DeviceOverrides::QueueWaitIdle; };
+        if constexpr (HasQueueWaitIdle)
+          return (PFN_vkVoidFunction) &wrap_QueueWaitIdle<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::RegisterDeviceEventEXT: {
+        constexpr bool HasRegisterDeviceEventEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::RegisterDeviceEventEXT; };
+        if constexpr (HasRegisterDeviceEventEXT)
+          return (PFN_vkVoidFunction) &wrap_RegisterDeviceEventEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::RegisterDisplayEventEXT: {
+        constexpr bool HasRegisterDisplayEventEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::RegisterDisplayEventEXT; };
+        if constexpr (HasRegisterDisplayEventEXT)
+          return (PFN_vkVoidFunction) &wrap_RegisterDisplayEventEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case procaddr::DeviceFunc::ReleaseFullScreenExclusiveModeEXT: {
+        constexpr bool HasReleaseFullScreenExclusiveModeEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleaseFullScreenExclusiveModeEXT; };
+        if constexpr (HasReleaseFullScreenExclusiveModeEXT)
+          return (PFN_vkVoidFunction) &wrap_ReleaseFullScreenExclusiveModeEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::ReleasePerformanceConfigurationINTEL: {
+        constexpr bool HasReleasePerformanceConfigurationINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleasePerformanceConfigurationINTEL; };
+        if constexpr (HasReleasePerformanceConfigurationINTEL)
+          return (PFN_vkVoidFunction) &wrap_ReleasePerformanceConfigurationINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ReleaseProfilingLockKHR: {
+        constexpr bool HasReleaseProfilingLockKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleaseProfilingLockKHR; };
+        if constexpr (HasReleaseProfilingLockKHR)
+          return (PFN_vkVoidFunction) &wrap_ReleaseProfilingLockKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ReleaseSwapchainImagesEXT: {
+        constexpr bool HasReleaseSwapchainImagesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ReleaseSwapchainImagesEXT; };
+        if constexpr (HasReleaseSwapchainImagesEXT)
+          return (PFN_vkVoidFunction) &wrap_ReleaseSwapchainImagesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetCommandBuffer: {
+        constexpr bool HasResetCommandBuffer = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetCommandBuffer; };
+        if constexpr (HasResetCommandBuffer)
+          return (PFN_vkVoidFunction) &wrap_ResetCommandBuffer<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetCommandPool: {
+        constexpr bool HasResetCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetCommandPool; };
+        if constexpr (HasResetCommandPool)
+          return (PFN_vkVoidFunction) &wrap_ResetCommandPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetDescriptorPool: {
+        constexpr bool HasResetDescriptorPool = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetDescriptorPool; };
+        if constexpr (HasResetDescriptorPool)
+          return (PFN_vkVoidFunction) &wrap_ResetDescriptorPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetEvent: {
+        constexpr bool HasResetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetEvent; };
+        if constexpr (HasResetEvent)
+          return (PFN_vkVoidFunction) &wrap_ResetEvent<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetFences: {
+        constexpr bool HasResetFences = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetFences; };
+        if constexpr (HasResetFences)
+          return (PFN_vkVoidFunction) &wrap_ResetFences<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetQueryPool: {
+        constexpr bool HasResetQueryPool = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetQueryPool; };
+        if constexpr (HasResetQueryPool)
+          return (PFN_vkVoidFunction) &wrap_ResetQueryPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::ResetQueryPoolEXT: {
+        constexpr bool HasResetQueryPoolEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::ResetQueryPoolEXT; };
+        if constexpr (HasResetQueryPoolEXT)
+          return (PFN_vkVoidFunction) &wrap_ResetQueryPoolEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::SetBufferCollectionBufferConstraintsFUCHSIA: {
+        constexpr bool HasSetBufferCollectionBufferConstraintsFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::SetBufferCollectionBufferConstraintsFUCHSIA; };
+        if constexpr (HasSetBufferCollectionBufferConstraintsFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_SetBufferCollectionBufferConstraintsFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case procaddr::DeviceFunc::SetBufferCollectionImageConstraintsFUCHSIA: {
+        constexpr bool HasSetBufferCollectionImageConstraintsFUCHSIA = requires(const DeviceOverrides& t) { &DeviceOverrides::SetBufferCollectionImageConstraintsFUCHSIA; };
+        if constexpr (HasSetBufferCollectionImageConstraintsFUCHSIA)
+          return (PFN_vkVoidFunction) &wrap_SetBufferCollectionImageConstraintsFUCHSIA<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+#endif
+      case procaddr::DeviceFunc::SetDebugUtilsObjectNameEXT: {
+        constexpr bool HasSetDebugUtilsObjectNameEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetDebugUtilsObjectNameEXT; };
+        if constexpr (HasSetDebugUtilsObjectNameEXT)
+          return (PFN_vkVoidFunction) &wrap_SetDebugUtilsObjectNameEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetDebugUtilsObjectTagEXT: {
+        constexpr bool HasSetDebugUtilsObjectTagEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetDebugUtilsObjectTagEXT; };
+        if constexpr (HasSetDebugUtilsObjectTagEXT)
+          return (PFN_vkVoidFunction) &wrap_SetDebugUtilsObjectTagEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetDeviceMemoryPriorityEXT: {
+        constexpr bool HasSetDeviceMemoryPriorityEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetDeviceMemoryPriorityEXT; };
+        if constexpr (HasSetDeviceMemoryPriorityEXT)
+          return (PFN_vkVoidFunction) &wrap_SetDeviceMemoryPriorityEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetEvent: {
+        constexpr bool HasSetEvent = requires(const DeviceOverrides& t) { &DeviceOverrides::SetEvent; };
+        if constexpr (HasSetEvent)
+          return (PFN_vkVoidFunction) &wrap_SetEvent<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetHdrMetadataEXT: {
+        constexpr bool HasSetHdrMetadataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetHdrMetadataEXT; };
+        if constexpr (HasSetHdrMetadataEXT)
+          return (PFN_vkVoidFunction) &wrap_SetHdrMetadataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetLocalDimmingAMD: {
+        constexpr bool HasSetLocalDimmingAMD = requires(const DeviceOverrides& t) { &DeviceOverrides::SetLocalDimmingAMD; };
+        if constexpr (HasSetLocalDimmingAMD)
+          return (PFN_vkVoidFunction) &wrap_SetLocalDimmingAMD<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetPrivateData: {
+        constexpr bool HasSetPrivateData = requires(const DeviceOverrides& t) { &DeviceOverrides::SetPrivateData; };
+        if constexpr (HasSetPrivateData)
+          return (PFN_vkVoidFunction) &wrap_SetPrivateData<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SetPrivateDataEXT: {
+        constexpr bool HasSetPrivateDataEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::SetPrivateDataEXT; };
+        if constexpr (HasSetPrivateDataEXT)
+          return (PFN_vkVoidFunction) &wrap_SetPrivateDataEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SignalSemaphore: {
+        constexpr bool HasSignalSemaphore = requires(const DeviceOverrides& t) { &DeviceOverrides::SignalSemaphore; };
+        if constexpr (HasSignalSemaphore)
+          return (PFN_vkVoidFunction) &wrap_SignalSemaphore<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::SignalSemaphoreKHR: {
+        constexpr bool HasSignalSemaphoreKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::SignalSemaphoreKHR; };
+        if constexpr (HasSignalSemaphoreKHR)
+          return (PFN_vkVoidFunction) &wrap_SignalSemaphoreKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::TrimCommandPool: {
+        constexpr bool HasTrimCommandPool = requires(const DeviceOverrides& t) { &DeviceOverrides::TrimCommandPool; };
+        if constexpr (HasTrimCommandPool)
+          return (PFN_vkVoidFunction) &wrap_TrimCommandPool<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::TrimCommandPoolKHR: {
+        constexpr bool HasTrimCommandPoolKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::TrimCommandPoolKHR; };
+        if constexpr (HasTrimCommandPoolKHR)
+          return (PFN_vkVoidFunction) &wrap_TrimCommandPoolKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UninitializePerformanceApiINTEL: {
+        constexpr bool HasUninitializePerformanceApiINTEL = requires(const DeviceOverrides& t) { &DeviceOverrides::UninitializePerformanceApiINTEL; };
+        if constexpr (HasUninitializePerformanceApiINTEL)
+          return (PFN_vkVoidFunction) &wrap_UninitializePerformanceApiINTEL<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UnmapMemory: {
+        constexpr bool HasUnmapMemory = requires(const DeviceOverrides& t) { &DeviceOverrides::UnmapMemory; };
+        if constexpr (HasUnmapMemory)
+          return (PFN_vkVoidFunction) &wrap_UnmapMemory<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UnmapMemory2KHR: {
+        constexpr bool HasUnmapMemory2KHR = requires(const DeviceOverrides& t) { &DeviceOverrides::UnmapMemory2KHR; };
+        if constexpr (HasUnmapMemory2KHR)
+          return (PFN_vkVoidFunction) &wrap_UnmapMemory2KHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UpdateDescriptorSetWithTemplate: {
+        constexpr bool HasUpdateDescriptorSetWithTemplate = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateDescriptorSetWithTemplate; };
+        if constexpr (HasUpdateDescriptorSetWithTemplate)
+          return (PFN_vkVoidFunction) &wrap_UpdateDescriptorSetWithTemplate<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UpdateDescriptorSetWithTemplateKHR: {
+        constexpr bool HasUpdateDescriptorSetWithTemplateKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateDescriptorSetWithTemplateKHR; };
+        if constexpr (HasUpdateDescriptorSetWithTemplateKHR)
+          return (PFN_vkVoidFunction) &wrap_UpdateDescriptorSetWithTemplateKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UpdateDescriptorSets: {
+        constexpr bool HasUpdateDescriptorSets = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateDescriptorSets; };
+        if constexpr (HasUpdateDescriptorSets)
+          return (PFN_vkVoidFunction) &wrap_UpdateDescriptorSets<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::UpdateVideoSessionParametersKHR: {
+        constexpr bool HasUpdateVideoSessionParametersKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::UpdateVideoSessionParametersKHR; };
+        if constexpr (HasUpdateVideoSessionParametersKHR)
+          return (PFN_vkVoidFunction) &wrap_UpdateVideoSessionParametersKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::WaitForFences: {
+        constexpr bool HasWaitForFences = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitForFences; };
+        if constexpr (HasWaitForFences)
+          return (PFN_vkVoidFunction) &wrap_WaitForFences<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::WaitForPresentKHR: {
+        constexpr bool HasWaitForPresentKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitForPresentKHR; };
+        if constexpr (HasWaitForPresentKHR)
+          return (PFN_vkVoidFunction) &wrap_WaitForPresentKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::WaitSemaphores: {
+        constexpr bool HasWaitSemaphores = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitSemaphores; };
+        if constexpr (HasWaitSemaphores)
+          return (PFN_vkVoidFunction) &wrap_WaitSemaphores<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::WaitSemaphoresKHR: {
+        constexpr bool HasWaitSemaphoresKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::WaitSemaphoresKHR; };
+        if constexpr (HasWaitSemaphoresKHR)
+          return (PFN_vkVoidFunction) &wrap_WaitSemaphoresKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::WriteAccelerationStructuresPropertiesKHR: {
+        constexpr bool HasWriteAccelerationStructuresPropertiesKHR = requires(const DeviceOverrides& t) { &DeviceOverrides::WriteAccelerationStructuresPropertiesKHR; };
+        if constexpr (HasWriteAccelerationStructuresPropertiesKHR)
+          return (PFN_vkVoidFunction) &wrap_WriteAccelerationStructuresPropertiesKHR<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      case procaddr::DeviceFunc::WriteMicromapsPropertiesEXT: {
+        constexpr bool HasWriteMicromapsPropertiesEXT = requires(const DeviceOverrides& t) { &DeviceOverrides::WriteMicromapsPropertiesEXT; };
+        if constexpr (HasWriteMicromapsPropertiesEXT)
+          return (PFN_vkVoidFunction) &wrap_WriteMicromapsPropertiesEXT<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+        break;
+      }
+      default:
+        break;
+    }
+
+    if (dispatch)
+#if VKROOTS_USE_PROC_ADDR_CACHE
+      return dispatch->ProcAddrCache.resolve(name, [&] { return dispatch->GetDeviceProcAddr(device, name); });
+#else
+      return dispatch->GetDeviceProcAddr(device, name);
+#endif
+    else
+      return NULL;
+  }
+
+}
+
+namespace vkroots {
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  VkResult NegotiateLoaderLayerInterfaceVersion(VkNegotiateLayerInterface* pVersionStruct) {
+    if (pVersionStruct->loaderLayerInterfaceVersion < 2)
+      return VK_ERROR_INITIALIZATION_FAILED;
+    pVersionStruct->loaderLayerInterfaceVersion = 2;
+
+    // Can't optimize away not having instance overrides from the layer, need to track device creation and instance dispatch and stuff.
+    pVersionStruct->pfnGetInstanceProcAddr       = std::is_base_of<NoOverrides, InstanceOverrides>::value && std::is_base_of<NoOverrides, PhysicalDeviceOverrides>::value && std::is_base_of<NoOverrides, DeviceOverrides>::value
+                                                     ? nullptr
+                                                     : &GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+    pVersionStruct->pfnGetPhysicalDeviceProcAddr = std::is_base_of<NoOverrides, PhysicalDeviceOverrides>::value && std::is_base_of<NoOverrides, DeviceOverrides>::value
+                                                     ? nullptr
+                                                     : &GetPhysicalDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+    pVersionStruct->pfnGetDeviceProcAddr         = std::is_base_of<NoOverrides, DeviceOverrides>::value
+                                                     ? nullptr
+                                                     : &GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>;
+
+    return VK_SUCCESS;
+  }
+
+}
+
+// Sadly, can't include this in VKROOTS_DEFINE_LAYER_INTERFACES
+// as we need the stupid pragma comment for stdcall aliasing on Win32.
+// So you can only have one layer interface per compilation unit.
+#ifndef VKROOTS_NEGOTIATION_INTERFACE
+#define VKROOTS_NEGOTIATION_INTERFACE vkNegotiateLoaderLayerInterfaceVersion
+#endif
+
+#ifdef _WIN32
+
+// Define VK_LAYER_EXPORT to dllexport.
+# undef VK_LAYER_EXPORT
+# define VK_LAYER_EXPORT extern "C" __declspec(dllexport)
+
+// Fix stdcall aliasing on 32-bit Windows.
+# ifndef _WIN64
+#  pragma comment(linker, "/EXPORT:" #VKROOTS_NEGOTIATION_INTERFACE "=_" #VKROOTS_NEGOTIATION_INTERFACE "@8")
+# endif
+
+#elif defined(__GNUC__)
+
+# undef VK_LAYER_EXPORT
+# define VK_LAYER_EXPORT extern "C" __attribute__((visibility("default")))
+
+#endif
+
+#define VKROOTS_DEFINE_LAYER_INTERFACES(InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides)                                   \
+  VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL VKROOTS_NEGOTIATION_INTERFACE(VkNegotiateLayerInterface* pVersionStruct) {            \
+    return vkroots::NegotiateLoaderLayerInterfaceVersion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(pVersionStruct); \
+  }
+
+// For layers split across many TUs. Put VKROOTS_EXTERN_LAYER_INTERFACES in a
+// header every TU includes and VKROOTS_INSTANTIATE_LAYER_INTERFACES in exactly
+// one source, and the resolvers and every wrapper they reference are compiled
+// once for the given overrides instead of in each TU that uses them.
+#define VKROOTS_EXTERN_LAYER_INTERFACES(InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides)                                                            \
+  extern template PFN_vkVoidFunction vkroots::GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*);       \
+  extern template PFN_vkVoidFunction vkroots::GetPhysicalDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*); \
+  extern template PFN_vkVoidFunction vkroots::GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkDevice, const char*);           \
+  extern template VkResult vkroots::NegotiateLoaderLayerInterfaceVersion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkNegotiateLayerInterface*);
+
+#define VKROOTS_INSTANTIATE_LAYER_INTERFACES(InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides)                                                       \
+  template PFN_vkVoidFunction vkroots::GetInstanceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*);              \
+  template PFN_vkVoidFunction vkroots::GetPhysicalDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkInstance, const char*);        \
+  template PFN_vkVoidFunction vkroots::GetDeviceProcAddr<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkDevice, const char*);                  \
+  template VkResult vkroots::NegotiateLoaderLayerInterfaceVersion<InstanceOverrides, PhysicalDeviceOverrides, DeviceOverrides>(VkNegotiateLayerInterface*);
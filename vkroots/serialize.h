@@ -0,0 +1,8197 @@
+// Part of vkroots.h, generated by gen/make_vkroots.
+
+#pragma once
+
+#include "deep_copy.h"
+#include "stypes.h"
+
+namespace vkroots {
+
+  // A serialized struct is a deep copy of it with every pointer in it swapped
+  // for an offset from the start of the blob, after this header.
+  struct SerializedHeader {
+    uint32_t magic;
+    uint32_t rootSize;
+    uint64_t size;
+  };
+
+  inline constexpr uint32_t SerializedMagic = 0x3152'4b56; // "VKR1"
+
+  // Swaps the pointers in a blob between addresses and offsets, in the same
+  // order deepCopy laid things out. Each one has to point exactly where the
+  // next piece of the layout goes, which keeps everything in bounds and
+  // rules out overlaps and loops in blobs that have been tampered with.
+  class PointerRelocator {
+  public:
+    enum Direction {
+      ToOffsets,
+      ToAddresses,
+    };
+
+    PointerRelocator(void* pData, size_t size, size_t offset, Direction direction)
+      : m_pBase{ static_cast<std::byte*>(pData) }
+      , m_size{ size }
+      , m_offset{ offset }
+      , m_direction{ direction } {
+    }
+
+    // Returns where field points, without claiming it, so the sType of the
+    // next struct in a chain can be read.
+    template <typename T, typename P>
+    const T* peek(P field) {
+      if (!field || m_failed)
+        return nullptr;
+
+      const size_t offset = offsetOf(field);
+      if (offset < m_offset || offset > m_size || m_size - offset < sizeof(T)) {
+        m_failed = true;
+        return nullptr;
+      }
+      return reinterpret_cast<const T*>(m_pBase + offset);
+    }
+
+    // Relocates field, which points to count Ts, and returns their address.
+    template <typename T, typename P>
+    T* relocate(P& field, size_t count) {
+      static_assert(std::is_pointer_v<P>);
+
+      if (!field || m_failed)
+        return nullptr;
+
+      const size_t offset = (m_offset + alignof(T) - 1) & ~(alignof(T) - 1);
+      if (offsetOf(field) != offset || offset > m_size || count > (m_size - offset) / sizeof(T)) {
+        m_failed = true;
+        return nullptr;
+      }
+      m_offset = offset + sizeof(T) * count;
+
+      T* ptr = reinterpret_cast<T*>(m_pBase + offset);
+      field = m_direction == ToOffsets ? reinterpret_cast<P>(offset) : reinterpret_cast<P>(ptr);
+      return ptr;
+    }
+
+    template <typename P>
+    void string(P& field) {
+      const char* pString = peek<char>(field);
+      if (!pString)
+        return;
+
+      const size_t offset = pString - reinterpret_cast<const char*>(m_pBase);
+      const void* pEnd = std::memchr(pString, '\0', m_size - offset);
+      if (!pEnd) {
+        m_failed = true;
+        return;
+      }
+      relocate<char>(field, static_cast<const char*>(pEnd) - pString + 1);
+    }
+
+    bool failed() const {
+      return m_failed;
+    }
+
+    void fail() {
+      m_failed = true;
+    }
+
+  private:
+    template <typename P>
+    size_t offsetOf(P field) const {
+      if (m_direction == ToOffsets)
+        return reinterpret_cast<const std::byte*>(field) - m_pBase;
+      return reinterpret_cast<uintptr_t>(field);
+    }
+
+    std::byte* m_pBase;
+    size_t m_size;
+    size_t m_offset;
+    Direction m_direction;
+    bool m_failed = false;
+  };
+
+  // Structs without any pointers have nothing to relocate.
+  // make_vkroots specializes this for every struct that does.
+  template <typename T>
+  struct RelocateTraits {
+    static void relocate(T&, PointerRelocator&) {}
+  };
+
+  // sTypes are read as plain integers, a blob may hold any value there.
+  inline uint32_t ReadSType(const void* pStruct) {
+    uint32_t sType;
+    std::memcpy(&sType, pStruct, sizeof(sType));
+    return sType;
+  }
+
+  inline void RelocateNextStruct(uint32_t sType, const void*& pNext, PointerRelocator& relocator);
+
+  template <typename P>
+  void RelocateNext(P& pNext, PointerRelocator& relocator) {
+    if (const VkBaseInStructure* header = relocator.peek<VkBaseInStructure>(pNext)) {
+      const void* pRelocated = pNext;
+      RelocateNextStruct(ReadSType(header), pRelocated, relocator);
+      pNext = static_cast<P>(const_cast<void*>(pRelocated));
+    }
+  }
+
+  template <typename T>
+  void RelocateStruct(const void*& pNext, PointerRelocator& relocator) {
+    if (T* ptr = relocator.relocate<T>(pNext, 1))
+      RelocateTraits<T>::relocate(*ptr, relocator);
+  }
+
+  template <typename P>
+  void RelocateArray(P& field, size_t count, PointerRelocator& relocator) {
+    using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+    if (T* ptr = relocator.relocate<T>(field, count)) {
+      for (size_t i = 0; i < count; i++)
+        RelocateTraits<T>::relocate(ptr[i], relocator);
+    }
+  }
+
+  template <typename P>
+  void RelocatePointerArray(P& field, size_t count, PointerRelocator& relocator) {
+    using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+    if (T* ptr = relocator.relocate<T>(field, count)) {
+      for (size_t i = 0; i < count; i++)
+        RelocateArray(ptr[i], 1, relocator);
+    }
+  }
+
+  template <typename P>
+  void RelocateStringArray(P& field, size_t count, PointerRelocator& relocator) {
+    using T = std::remove_cv_t<std::remove_pointer_t<P>>;
+    if (T* ptr = relocator.relocate<T>(field, count)) {
+      for (size_t i = 0; i < count; i++)
+        relocator.string(ptr[i]);
+    }
+  }
+
+  template <typename T>
+  size_t SerializedRootOffset() {
+    size_t offset = 0;
+    DeepCopyReserve<SerializedHeader>(offset, 1);
+    DeepCopyReserve<T>(offset, 0);
+    return offset;
+  }
+
+  // Writes src, everything its pointers point to and its pNext chain into
+  // pData as a single blob without any pointers in it, and returns the size
+  // that needs. Nothing is written if size is smaller than that.
+  // pData must be aligned to alignof(std::max_align_t).
+  // Opaque pointers such as pUserData and handles are written as they are,
+  // so they only mean something in the process that wrote them.
+  template <typename T>
+  size_t serialize(const T& src, void* pData, size_t size) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+
+    size_t needed = SerializedRootOffset<T>();
+    DeepCopyStructSize(src, needed);
+    if (!pData || size < needed)
+      return needed;
+
+    assert(reinterpret_cast<uintptr_t>(pData) % alignof(std::max_align_t) == 0);
+    DeepCopyCursor cursor{ pData };
+    *cursor.take<SerializedHeader>(1) = SerializedHeader{ SerializedMagic, uint32_t(sizeof(T)), needed };
+    T* dst = DeepCopyStruct(src, cursor);
+
+    PointerRelocator relocator{ pData, needed, SerializedRootOffset<T>() + sizeof(T), PointerRelocator::ToOffsets };
+    RelocateTraits<T>::relocate(*dst, relocator);
+    assert(!relocator.failed());
+    return needed;
+  }
+
+  template <typename T>
+  std::vector<std::byte> serialize(const T& src) {
+    std::vector<std::byte> data(serialize(src, nullptr, 0));
+    serialize(src, data.data(), data.size());
+    return data;
+  }
+
+  // Turns a blob written by serialize back into a T, in place: the offsets in
+  // it are swapped for pointers into pData, nothing is allocated or copied.
+  // pData has to be writable (eg. a MAP_PRIVATE mapping), aligned to
+  // alignof(std::max_align_t), and outlive the T.
+  // Returns nullptr if pData isn't a valid blob of a T from the same ABI, in
+  // which case it may be left half relocated.
+  template <typename T>
+  T* deserialize(void* pData, size_t size) {
+    static_assert(DeepCopyTraits<T>::Supported, "This struct has pointers whose length vkroots can't work out.");
+    assert(reinterpret_cast<uintptr_t>(pData) % alignof(std::max_align_t) == 0);
+
+    const size_t rootOffset = SerializedRootOffset<T>();
+    const SerializedHeader* header = static_cast<const SerializedHeader*>(pData);
+    if (size < rootOffset + sizeof(T) || header->magic != SerializedMagic || header->rootSize != sizeof(T))
+      return nullptr;
+    if (header->size < rootOffset + sizeof(T) || header->size > size)
+      return nullptr;
+
+    T* root = reinterpret_cast<T*>(static_cast<std::byte*>(pData) + rootOffset);
+    if constexpr (requires { root->sType; }) {
+      if (ReadSType(root) != uint32_t(ResolveSType<T>()))
+        return nullptr;
+    }
+
+    PointerRelocator relocator{ pData, header->size, rootOffset + sizeof(T), PointerRelocator::ToAddresses };
+    RelocateTraits<T>::relocate(*root, relocator);
+    return relocator.failed() ? nullptr : root;
+  }
+
+}
+namespace vkroots {
+
+  template <> struct RelocateTraits<VkAccelerationStructureBuildSizesInfoKHR> {
+    static void relocate(VkAccelerationStructureBuildSizesInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureCaptureDescriptorDataInfoEXT> {
+    static void relocate(VkAccelerationStructureCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureCreateInfoKHR> {
+    static void relocate(VkAccelerationStructureCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureCreateInfoNV> {
+    static void relocate(VkAccelerationStructureCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureDeviceAddressInfoKHR> {
+    static void relocate(VkAccelerationStructureDeviceAddressInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureGeometryAabbsDataKHR> {
+    static void relocate(VkAccelerationStructureGeometryAabbsDataKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureGeometryInstancesDataKHR> {
+    static void relocate(VkAccelerationStructureGeometryInstancesDataKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureGeometryMotionTrianglesDataNV> {
+    static void relocate(VkAccelerationStructureGeometryMotionTrianglesDataNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureGeometryTrianglesDataKHR> {
+    static void relocate(VkAccelerationStructureGeometryTrianglesDataKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureInfoNV> {
+    static void relocate(VkAccelerationStructureInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureMemoryRequirementsInfoNV> {
+    static void relocate(VkAccelerationStructureMemoryRequirementsInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureMotionInfoNV> {
+    static void relocate(VkAccelerationStructureMotionInfoNV& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkAccelerationStructureTrianglesDisplacementMicromapNV> {
+    static void relocate(VkAccelerationStructureTrianglesDisplacementMicromapNV& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkAccelerationStructureTrianglesOpacityMicromapEXT> {
+    static void relocate(VkAccelerationStructureTrianglesOpacityMicromapEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAccelerationStructureVersionInfoKHR> {
+    static void relocate(VkAccelerationStructureVersionInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAcquireNextImageInfoKHR> {
+    static void relocate(VkAcquireNextImageInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAcquireProfilingLockInfoKHR> {
+    static void relocate(VkAcquireProfilingLockInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAmigoProfilingSubmitInfoSEC> {
+    static void relocate(VkAmigoProfilingSubmitInfoSEC& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkAndroidHardwareBufferFormatProperties2ANDROID> {
+    static void relocate(VkAndroidHardwareBufferFormatProperties2ANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkAndroidHardwareBufferFormatPropertiesANDROID> {
+    static void relocate(VkAndroidHardwareBufferFormatPropertiesANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkAndroidHardwareBufferPropertiesANDROID> {
+    static void relocate(VkAndroidHardwareBufferPropertiesANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkAndroidHardwareBufferUsageANDROID> {
+    static void relocate(VkAndroidHardwareBufferUsageANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkAndroidSurfaceCreateInfoKHR> {
+    static void relocate(VkAndroidSurfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkApplicationInfo> {
+    static void relocate(VkApplicationInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAttachmentDescription2> {
+    static void relocate(VkAttachmentDescription2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAttachmentDescriptionStencilLayout> {
+    static void relocate(VkAttachmentDescriptionStencilLayout& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAttachmentReference2> {
+    static void relocate(VkAttachmentReference2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAttachmentReferenceStencilLayout> {
+    static void relocate(VkAttachmentReferenceStencilLayout& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAttachmentSampleCountInfoAMD> {
+    static void relocate(VkAttachmentSampleCountInfoAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindAccelerationStructureMemoryInfoNV> {
+    static void relocate(VkBindAccelerationStructureMemoryInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindBufferMemoryDeviceGroupInfo> {
+    static void relocate(VkBindBufferMemoryDeviceGroupInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindBufferMemoryInfo> {
+    static void relocate(VkBindBufferMemoryInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindImageMemoryDeviceGroupInfo> {
+    static void relocate(VkBindImageMemoryDeviceGroupInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindImageMemoryInfo> {
+    static void relocate(VkBindImageMemoryInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindImageMemorySwapchainInfoKHR> {
+    static void relocate(VkBindImageMemorySwapchainInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindImagePlaneMemoryInfo> {
+    static void relocate(VkBindImagePlaneMemoryInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSparseBufferMemoryBindInfo> {
+    static void relocate(VkSparseBufferMemoryBindInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSparseImageOpaqueMemoryBindInfo> {
+    static void relocate(VkSparseImageOpaqueMemoryBindInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSparseImageMemoryBindInfo> {
+    static void relocate(VkSparseImageMemoryBindInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindSparseInfo> {
+    static void relocate(VkBindSparseInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBindVideoSessionMemoryInfoKHR> {
+    static void relocate(VkBindVideoSessionMemoryInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBlitImageInfo2> {
+    static void relocate(VkBlitImageInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferCaptureDescriptorDataInfoEXT> {
+    static void relocate(VkBufferCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkBufferCollectionBufferCreateInfoFUCHSIA> {
+    static void relocate(VkBufferCollectionBufferCreateInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkBufferCollectionConstraintsInfoFUCHSIA> {
+    static void relocate(VkBufferCollectionConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkBufferCollectionCreateInfoFUCHSIA> {
+    static void relocate(VkBufferCollectionCreateInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkBufferCollectionImageCreateInfoFUCHSIA> {
+    static void relocate(VkBufferCollectionImageCreateInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkBufferCollectionPropertiesFUCHSIA> {
+    static void relocate(VkBufferCollectionPropertiesFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkBufferConstraintsInfoFUCHSIA> {
+    static void relocate(VkBufferConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkBufferCopy2> {
+    static void relocate(VkBufferCopy2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferCreateInfo> {
+    static void relocate(VkBufferCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferDeviceAddressCreateInfoEXT> {
+    static void relocate(VkBufferDeviceAddressCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferDeviceAddressInfo> {
+    static void relocate(VkBufferDeviceAddressInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferImageCopy2> {
+    static void relocate(VkBufferImageCopy2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferMemoryBarrier> {
+    static void relocate(VkBufferMemoryBarrier& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferMemoryBarrier2> {
+    static void relocate(VkBufferMemoryBarrier2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferMemoryRequirementsInfo2> {
+    static void relocate(VkBufferMemoryRequirementsInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferOpaqueCaptureAddressCreateInfo> {
+    static void relocate(VkBufferOpaqueCaptureAddressCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkBufferViewCreateInfo> {
+    static void relocate(VkBufferViewCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCalibratedTimestampInfoEXT> {
+    static void relocate(VkCalibratedTimestampInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCheckpointData2NV> {
+    static void relocate(VkCheckpointData2NV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCheckpointDataNV> {
+    static void relocate(VkCheckpointDataNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferAllocateInfo> {
+    static void relocate(VkCommandBufferAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferInheritanceConditionalRenderingInfoEXT> {
+    static void relocate(VkCommandBufferInheritanceConditionalRenderingInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferInheritanceInfo> {
+    static void relocate(VkCommandBufferInheritanceInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferInheritanceRenderPassTransformInfoQCOM> {
+    static void relocate(VkCommandBufferInheritanceRenderPassTransformInfoQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferInheritanceRenderingInfo> {
+    static void relocate(VkCommandBufferInheritanceRenderingInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferInheritanceViewportScissorInfoNV> {
+    static void relocate(VkCommandBufferInheritanceViewportScissorInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandBufferSubmitInfo> {
+    static void relocate(VkCommandBufferSubmitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCommandPoolCreateInfo> {
+    static void relocate(VkCommandPoolCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkComputePipelineCreateInfo> {
+    static void relocate(VkComputePipelineCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkConditionalRenderingBeginInfoEXT> {
+    static void relocate(VkConditionalRenderingBeginInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCooperativeMatrixPropertiesNV> {
+    static void relocate(VkCooperativeMatrixPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyAccelerationStructureInfoKHR> {
+    static void relocate(VkCopyAccelerationStructureInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyAccelerationStructureToMemoryInfoKHR> {
+    static void relocate(VkCopyAccelerationStructureToMemoryInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyBufferInfo2> {
+    static void relocate(VkCopyBufferInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyBufferToImageInfo2> {
+    static void relocate(VkCopyBufferToImageInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyCommandTransformInfoQCOM> {
+    static void relocate(VkCopyCommandTransformInfoQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyDescriptorSet> {
+    static void relocate(VkCopyDescriptorSet& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyImageInfo2> {
+    static void relocate(VkCopyImageInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyImageToBufferInfo2> {
+    static void relocate(VkCopyImageToBufferInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyMemoryToAccelerationStructureInfoKHR> {
+    static void relocate(VkCopyMemoryToAccelerationStructureInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyMemoryToMicromapInfoEXT> {
+    static void relocate(VkCopyMemoryToMicromapInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyMicromapInfoEXT> {
+    static void relocate(VkCopyMicromapInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCopyMicromapToMemoryInfoEXT> {
+    static void relocate(VkCopyMicromapToMemoryInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkD3D12FenceSubmitInfoKHR> {
+    static void relocate(VkD3D12FenceSubmitInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkDebugMarkerMarkerInfoEXT> {
+    static void relocate(VkDebugMarkerMarkerInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugMarkerObjectNameInfoEXT> {
+    static void relocate(VkDebugMarkerObjectNameInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugMarkerObjectTagInfoEXT> {
+    static void relocate(VkDebugMarkerObjectTagInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugReportCallbackCreateInfoEXT> {
+    static void relocate(VkDebugReportCallbackCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugUtilsLabelEXT> {
+    static void relocate(VkDebugUtilsLabelEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugUtilsMessengerCallbackDataEXT> {
+    static void relocate(VkDebugUtilsMessengerCallbackDataEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugUtilsMessengerCreateInfoEXT> {
+    static void relocate(VkDebugUtilsMessengerCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugUtilsObjectNameInfoEXT> {
+    static void relocate(VkDebugUtilsObjectNameInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDebugUtilsObjectTagInfoEXT> {
+    static void relocate(VkDebugUtilsObjectTagInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDedicatedAllocationBufferCreateInfoNV> {
+    static void relocate(VkDedicatedAllocationBufferCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDedicatedAllocationImageCreateInfoNV> {
+    static void relocate(VkDedicatedAllocationImageCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDedicatedAllocationMemoryAllocateInfoNV> {
+    static void relocate(VkDedicatedAllocationMemoryAllocateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDependencyInfo> {
+    static void relocate(VkDependencyInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorAddressInfoEXT> {
+    static void relocate(VkDescriptorAddressInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorBufferBindingInfoEXT> {
+    static void relocate(VkDescriptorBufferBindingInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorBufferBindingPushDescriptorBufferHandleEXT> {
+    static void relocate(VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorPoolCreateInfo> {
+    static void relocate(VkDescriptorPoolCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorPoolInlineUniformBlockCreateInfo> {
+    static void relocate(VkDescriptorPoolInlineUniformBlockCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetAllocateInfo> {
+    static void relocate(VkDescriptorSetAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetBindingReferenceVALVE> {
+    static void relocate(VkDescriptorSetBindingReferenceVALVE& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetLayoutBindingFlagsCreateInfo> {
+    static void relocate(VkDescriptorSetLayoutBindingFlagsCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetLayoutBinding> {
+    static void relocate(VkDescriptorSetLayoutBinding& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetLayoutCreateInfo> {
+    static void relocate(VkDescriptorSetLayoutCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetLayoutHostMappingInfoVALVE> {
+    static void relocate(VkDescriptorSetLayoutHostMappingInfoVALVE& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetLayoutSupport> {
+    static void relocate(VkDescriptorSetLayoutSupport& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetVariableDescriptorCountAllocateInfo> {
+    static void relocate(VkDescriptorSetVariableDescriptorCountAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorSetVariableDescriptorCountLayoutSupport> {
+    static void relocate(VkDescriptorSetVariableDescriptorCountLayoutSupport& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDescriptorUpdateTemplateCreateInfo> {
+    static void relocate(VkDescriptorUpdateTemplateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceAddressBindingCallbackDataEXT> {
+    static void relocate(VkDeviceAddressBindingCallbackDataEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceBufferMemoryRequirements> {
+    static void relocate(VkDeviceBufferMemoryRequirements& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceCreateInfo> {
+    static void relocate(VkDeviceCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceDeviceMemoryReportCreateInfoEXT> {
+    static void relocate(VkDeviceDeviceMemoryReportCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceDiagnosticsConfigCreateInfoNV> {
+    static void relocate(VkDeviceDiagnosticsConfigCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceEventInfoEXT> {
+    static void relocate(VkDeviceEventInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceFaultCountsEXT> {
+    static void relocate(VkDeviceFaultCountsEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupBindSparseInfo> {
+    static void relocate(VkDeviceGroupBindSparseInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupCommandBufferBeginInfo> {
+    static void relocate(VkDeviceGroupCommandBufferBeginInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupDeviceCreateInfo> {
+    static void relocate(VkDeviceGroupDeviceCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupPresentCapabilitiesKHR> {
+    static void relocate(VkDeviceGroupPresentCapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupPresentInfoKHR> {
+    static void relocate(VkDeviceGroupPresentInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupRenderPassBeginInfo> {
+    static void relocate(VkDeviceGroupRenderPassBeginInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupSubmitInfo> {
+    static void relocate(VkDeviceGroupSubmitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceGroupSwapchainCreateInfoKHR> {
+    static void relocate(VkDeviceGroupSwapchainCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceImageMemoryRequirements> {
+    static void relocate(VkDeviceImageMemoryRequirements& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceMemoryOpaqueCaptureAddressInfo> {
+    static void relocate(VkDeviceMemoryOpaqueCaptureAddressInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceMemoryOverallocationCreateInfoAMD> {
+    static void relocate(VkDeviceMemoryOverallocationCreateInfoAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceMemoryReportCallbackDataEXT> {
+    static void relocate(VkDeviceMemoryReportCallbackDataEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDevicePrivateDataCreateInfo> {
+    static void relocate(VkDevicePrivateDataCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceQueueCreateInfo> {
+    static void relocate(VkDeviceQueueCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceQueueGlobalPriorityCreateInfoKHR> {
+    static void relocate(VkDeviceQueueGlobalPriorityCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDeviceQueueInfo2> {
+    static void relocate(VkDeviceQueueInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDirectDriverLoadingInfoLUNARG> {
+    static void relocate(VkDirectDriverLoadingInfoLUNARG& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDirectDriverLoadingListLUNARG> {
+    static void relocate(VkDirectDriverLoadingListLUNARG& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+  template <> struct RelocateTraits<VkDirectFBSurfaceCreateInfoEXT> {
+    static void relocate(VkDirectFBSurfaceCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkDisplayEventInfoEXT> {
+    static void relocate(VkDisplayEventInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayModeCreateInfoKHR> {
+    static void relocate(VkDisplayModeCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayModeProperties2KHR> {
+    static void relocate(VkDisplayModeProperties2KHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayNativeHdrSurfaceCapabilitiesAMD> {
+    static void relocate(VkDisplayNativeHdrSurfaceCapabilitiesAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayPlaneCapabilities2KHR> {
+    static void relocate(VkDisplayPlaneCapabilities2KHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayPlaneInfo2KHR> {
+    static void relocate(VkDisplayPlaneInfo2KHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayPlaneProperties2KHR> {
+    static void relocate(VkDisplayPlaneProperties2KHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayPowerInfoEXT> {
+    static void relocate(VkDisplayPowerInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayPresentInfoKHR> {
+    static void relocate(VkDisplayPresentInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayPropertiesKHR> {
+    static void relocate(VkDisplayPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplayProperties2KHR> {
+    static void relocate(VkDisplayProperties2KHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDisplaySurfaceCreateInfoKHR> {
+    static void relocate(VkDisplaySurfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDrmFormatModifierPropertiesList2EXT> {
+    static void relocate(VkDrmFormatModifierPropertiesList2EXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkDrmFormatModifierPropertiesListEXT> {
+    static void relocate(VkDrmFormatModifierPropertiesListEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkEventCreateInfo> {
+    static void relocate(VkEventCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExportFenceCreateInfo> {
+    static void relocate(VkExportFenceCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkExportFenceWin32HandleInfoKHR> {
+    static void relocate(VkExportFenceWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkExportMemoryAllocateInfo> {
+    static void relocate(VkExportMemoryAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExportMemoryAllocateInfoNV> {
+    static void relocate(VkExportMemoryAllocateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkExportMemoryWin32HandleInfoKHR> {
+    static void relocate(VkExportMemoryWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkExportMemoryWin32HandleInfoNV> {
+    static void relocate(VkExportMemoryWin32HandleInfoNV& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalBufferInfoEXT> {
+    static void relocate(VkExportMetalBufferInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalCommandQueueInfoEXT> {
+    static void relocate(VkExportMetalCommandQueueInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalDeviceInfoEXT> {
+    static void relocate(VkExportMetalDeviceInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalIOSurfaceInfoEXT> {
+    static void relocate(VkExportMetalIOSurfaceInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalObjectCreateInfoEXT> {
+    static void relocate(VkExportMetalObjectCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalObjectsInfoEXT> {
+    static void relocate(VkExportMetalObjectsInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalSharedEventInfoEXT> {
+    static void relocate(VkExportMetalSharedEventInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkExportMetalTextureInfoEXT> {
+    static void relocate(VkExportMetalTextureInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkExportSemaphoreCreateInfo> {
+    static void relocate(VkExportSemaphoreCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkExportSemaphoreWin32HandleInfoKHR> {
+    static void relocate(VkExportSemaphoreWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkExternalBufferProperties> {
+    static void relocate(VkExternalBufferProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExternalFenceProperties> {
+    static void relocate(VkExternalFenceProperties& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkExternalFormatANDROID> {
+    static void relocate(VkExternalFormatANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkExternalImageFormatProperties> {
+    static void relocate(VkExternalImageFormatProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExternalMemoryAcquireUnmodifiedEXT> {
+    static void relocate(VkExternalMemoryAcquireUnmodifiedEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExternalMemoryBufferCreateInfo> {
+    static void relocate(VkExternalMemoryBufferCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExternalMemoryImageCreateInfo> {
+    static void relocate(VkExternalMemoryImageCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExternalMemoryImageCreateInfoNV> {
+    static void relocate(VkExternalMemoryImageCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkExternalSemaphoreProperties> {
+    static void relocate(VkExternalSemaphoreProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFenceCreateInfo> {
+    static void relocate(VkFenceCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFenceGetFdInfoKHR> {
+    static void relocate(VkFenceGetFdInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkFenceGetWin32HandleInfoKHR> {
+    static void relocate(VkFenceGetWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkFilterCubicImageViewImageFormatPropertiesEXT> {
+    static void relocate(VkFilterCubicImageViewImageFormatPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFormatProperties2> {
+    static void relocate(VkFormatProperties2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFormatProperties3> {
+    static void relocate(VkFormatProperties3& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFragmentShadingRateAttachmentInfoKHR> {
+    static void relocate(VkFragmentShadingRateAttachmentInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFramebufferAttachmentImageInfo> {
+    static void relocate(VkFramebufferAttachmentImageInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFramebufferAttachmentsCreateInfo> {
+    static void relocate(VkFramebufferAttachmentsCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFramebufferCreateInfo> {
+    static void relocate(VkFramebufferCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkFramebufferMixedSamplesCombinationNV> {
+    static void relocate(VkFramebufferMixedSamplesCombinationNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGeneratedCommandsInfoNV> {
+    static void relocate(VkGeneratedCommandsInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGeneratedCommandsMemoryRequirementsInfoNV> {
+    static void relocate(VkGeneratedCommandsMemoryRequirementsInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGeometryAABBNV> {
+    static void relocate(VkGeometryAABBNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGeometryDataNV> {
+    static void relocate(VkGeometryDataNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGeometryNV> {
+    static void relocate(VkGeometryNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGeometryTrianglesNV> {
+    static void relocate(VkGeometryTrianglesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGraphicsPipelineCreateInfo> {
+    static void relocate(VkGraphicsPipelineCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGraphicsPipelineLibraryCreateInfoEXT> {
+    static void relocate(VkGraphicsPipelineLibraryCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGraphicsPipelineShaderGroupsCreateInfoNV> {
+    static void relocate(VkGraphicsPipelineShaderGroupsCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkGraphicsShaderGroupCreateInfoNV> {
+    static void relocate(VkGraphicsShaderGroupCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkHdrMetadataEXT> {
+    static void relocate(VkHdrMetadataEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkHeadlessSurfaceCreateInfoEXT> {
+    static void relocate(VkHeadlessSurfaceCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_IOS_MVK
+  template <> struct RelocateTraits<VkIOSSurfaceCreateInfoMVK> {
+    static void relocate(VkIOSSurfaceCreateInfoMVK& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImageBlit2> {
+    static void relocate(VkImageBlit2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageCaptureDescriptorDataInfoEXT> {
+    static void relocate(VkImageCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageCompressionControlEXT> {
+    static void relocate(VkImageCompressionControlEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageCompressionPropertiesEXT> {
+    static void relocate(VkImageCompressionPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkImageConstraintsInfoFUCHSIA> {
+    static void relocate(VkImageConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImageCopy2> {
+    static void relocate(VkImageCopy2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageCreateInfo> {
+    static void relocate(VkImageCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageDrmFormatModifierExplicitCreateInfoEXT> {
+    static void relocate(VkImageDrmFormatModifierExplicitCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageDrmFormatModifierListCreateInfoEXT> {
+    static void relocate(VkImageDrmFormatModifierListCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageDrmFormatModifierPropertiesEXT> {
+    static void relocate(VkImageDrmFormatModifierPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkImageFormatConstraintsInfoFUCHSIA> {
+    static void relocate(VkImageFormatConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImageFormatListCreateInfo> {
+    static void relocate(VkImageFormatListCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageFormatProperties2> {
+    static void relocate(VkImageFormatProperties2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageMemoryBarrier> {
+    static void relocate(VkImageMemoryBarrier& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageMemoryBarrier2> {
+    static void relocate(VkImageMemoryBarrier2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageMemoryRequirementsInfo2> {
+    static void relocate(VkImageMemoryRequirementsInfo2& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkImagePipeSurfaceCreateInfoFUCHSIA> {
+    static void relocate(VkImagePipeSurfaceCreateInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImagePlaneMemoryRequirementsInfo> {
+    static void relocate(VkImagePlaneMemoryRequirementsInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageResolve2> {
+    static void relocate(VkImageResolve2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageSparseMemoryRequirementsInfo2> {
+    static void relocate(VkImageSparseMemoryRequirementsInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageStencilUsageCreateInfo> {
+    static void relocate(VkImageStencilUsageCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageSubresource2EXT> {
+    static void relocate(VkImageSubresource2EXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageSwapchainCreateInfoKHR> {
+    static void relocate(VkImageSwapchainCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewASTCDecodeModeEXT> {
+    static void relocate(VkImageViewASTCDecodeModeEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewCaptureDescriptorDataInfoEXT> {
+    static void relocate(VkImageViewCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewCreateInfo> {
+    static void relocate(VkImageViewCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewMinLodCreateInfoEXT> {
+    static void relocate(VkImageViewMinLodCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewSampleWeightCreateInfoQCOM> {
+    static void relocate(VkImageViewSampleWeightCreateInfoQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewSlicedCreateInfoEXT> {
+    static void relocate(VkImageViewSlicedCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImageViewUsageCreateInfo> {
+    static void relocate(VkImageViewUsageCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkImportAndroidHardwareBufferInfoANDROID> {
+    static void relocate(VkImportAndroidHardwareBufferInfoANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImportFenceFdInfoKHR> {
+    static void relocate(VkImportFenceFdInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkImportFenceWin32HandleInfoKHR> {
+    static void relocate(VkImportFenceWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkImportMemoryBufferCollectionFUCHSIA> {
+    static void relocate(VkImportMemoryBufferCollectionFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImportMemoryFdInfoKHR> {
+    static void relocate(VkImportMemoryFdInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkImportMemoryHostPointerInfoEXT> {
+    static void relocate(VkImportMemoryHostPointerInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkImportMemoryWin32HandleInfoKHR> {
+    static void relocate(VkImportMemoryWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkImportMemoryWin32HandleInfoNV> {
+    static void relocate(VkImportMemoryWin32HandleInfoNV& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkImportMemoryZirconHandleInfoFUCHSIA> {
+    static void relocate(VkImportMemoryZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkImportMetalBufferInfoEXT> {
+    static void relocate(VkImportMetalBufferInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkImportMetalIOSurfaceInfoEXT> {
+    static void relocate(VkImportMetalIOSurfaceInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkImportMetalSharedEventInfoEXT> {
+    static void relocate(VkImportMetalSharedEventInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkImportMetalTextureInfoEXT> {
+    static void relocate(VkImportMetalTextureInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkImportSemaphoreFdInfoKHR> {
+    static void relocate(VkImportSemaphoreFdInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkImportSemaphoreWin32HandleInfoKHR> {
+    static void relocate(VkImportSemaphoreWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkImportSemaphoreZirconHandleInfoFUCHSIA> {
+    static void relocate(VkImportSemaphoreZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkIndirectCommandsLayoutCreateInfoNV> {
+    static void relocate(VkIndirectCommandsLayoutCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkIndirectCommandsLayoutTokenNV> {
+    static void relocate(VkIndirectCommandsLayoutTokenNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkInitializePerformanceApiInfoINTEL> {
+    static void relocate(VkInitializePerformanceApiInfoINTEL& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkInstanceCreateInfo> {
+    static void relocate(VkInstanceCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+  template <> struct RelocateTraits<VkMacOSSurfaceCreateInfoMVK> {
+    static void relocate(VkMacOSSurfaceCreateInfoMVK& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkMappedMemoryRange> {
+    static void relocate(VkMappedMemoryRange& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryAllocateFlagsInfo> {
+    static void relocate(VkMemoryAllocateFlagsInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryAllocateInfo> {
+    static void relocate(VkMemoryAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryBarrier> {
+    static void relocate(VkMemoryBarrier& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryBarrier2> {
+    static void relocate(VkMemoryBarrier2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryDedicatedAllocateInfo> {
+    static void relocate(VkMemoryDedicatedAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryDedicatedRequirements> {
+    static void relocate(VkMemoryDedicatedRequirements& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryFdPropertiesKHR> {
+    static void relocate(VkMemoryFdPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <> struct RelocateTraits<VkMemoryGetAndroidHardwareBufferInfoANDROID> {
+    static void relocate(VkMemoryGetAndroidHardwareBufferInfoANDROID& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkMemoryGetFdInfoKHR> {
+    static void relocate(VkMemoryGetFdInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryGetRemoteAddressInfoNV> {
+    static void relocate(VkMemoryGetRemoteAddressInfoNV& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkMemoryGetWin32HandleInfoKHR> {
+    static void relocate(VkMemoryGetWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkMemoryGetZirconHandleInfoFUCHSIA> {
+    static void relocate(VkMemoryGetZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkMemoryHostPointerPropertiesEXT> {
+    static void relocate(VkMemoryHostPointerPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryMapInfoKHR> {
+    static void relocate(VkMemoryMapInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryOpaqueCaptureAddressAllocateInfo> {
+    static void relocate(VkMemoryOpaqueCaptureAddressAllocateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryPriorityAllocateInfoEXT> {
+    static void relocate(VkMemoryPriorityAllocateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryRequirements2> {
+    static void relocate(VkMemoryRequirements2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMemoryUnmapInfoKHR> {
+    static void relocate(VkMemoryUnmapInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkMemoryWin32HandlePropertiesKHR> {
+    static void relocate(VkMemoryWin32HandlePropertiesKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkMemoryZirconHandlePropertiesFUCHSIA> {
+    static void relocate(VkMemoryZirconHandlePropertiesFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <> struct RelocateTraits<VkMetalSurfaceCreateInfoEXT> {
+    static void relocate(VkMetalSurfaceCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkMicromapBuildInfoEXT> {
+    static void relocate(VkMicromapBuildInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMicromapBuildSizesInfoEXT> {
+    static void relocate(VkMicromapBuildSizesInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMicromapCreateInfoEXT> {
+    static void relocate(VkMicromapCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMicromapVersionInfoEXT> {
+    static void relocate(VkMicromapVersionInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMultisamplePropertiesEXT> {
+    static void relocate(VkMultisamplePropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMultisampledRenderToSingleSampledInfoEXT> {
+    static void relocate(VkMultisampledRenderToSingleSampledInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMultiviewPerViewAttributesInfoNVX> {
+    static void relocate(VkMultiviewPerViewAttributesInfoNVX& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM> {
+    static void relocate(VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMutableDescriptorTypeListEXT> {
+    static void relocate(VkMutableDescriptorTypeListEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkMutableDescriptorTypeCreateInfoEXT> {
+    static void relocate(VkMutableDescriptorTypeCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkOpaqueCaptureDescriptorDataCreateInfoEXT> {
+    static void relocate(VkOpaqueCaptureDescriptorDataCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkOpticalFlowExecuteInfoNV> {
+    static void relocate(VkOpticalFlowExecuteInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkOpticalFlowImageFormatInfoNV> {
+    static void relocate(VkOpticalFlowImageFormatInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkOpticalFlowImageFormatPropertiesNV> {
+    static void relocate(VkOpticalFlowImageFormatPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkOpticalFlowSessionCreateInfoNV> {
+    static void relocate(VkOpticalFlowSessionCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkOpticalFlowSessionCreatePrivateDataInfoNV> {
+    static void relocate(VkOpticalFlowSessionCreatePrivateDataInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceConfigurationAcquireInfoINTEL> {
+    static void relocate(VkPerformanceConfigurationAcquireInfoINTEL& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceCounterDescriptionKHR> {
+    static void relocate(VkPerformanceCounterDescriptionKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceCounterKHR> {
+    static void relocate(VkPerformanceCounterKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceMarkerInfoINTEL> {
+    static void relocate(VkPerformanceMarkerInfoINTEL& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceOverrideInfoINTEL> {
+    static void relocate(VkPerformanceOverrideInfoINTEL& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceQuerySubmitInfoKHR> {
+    static void relocate(VkPerformanceQuerySubmitInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPerformanceStreamMarkerInfoINTEL> {
+    static void relocate(VkPerformanceStreamMarkerInfoINTEL& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevice16BitStorageFeatures> {
+    static void relocate(VkPhysicalDevice16BitStorageFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevice4444FormatsFeaturesEXT> {
+    static void relocate(VkPhysicalDevice4444FormatsFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevice8BitStorageFeatures> {
+    static void relocate(VkPhysicalDevice8BitStorageFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceASTCDecodeFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceASTCDecodeFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceAccelerationStructureFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceAccelerationStructureFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceAccelerationStructurePropertiesKHR> {
+    static void relocate(VkPhysicalDeviceAccelerationStructurePropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceAddressBindingReportFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceAddressBindingReportFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceAmigoProfilingFeaturesSEC> {
+    static void relocate(VkPhysicalDeviceAmigoProfilingFeaturesSEC& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceBufferDeviceAddressFeatures> {
+    static void relocate(VkPhysicalDeviceBufferDeviceAddressFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI> {
+    static void relocate(VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI> {
+    static void relocate(VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCoherentMemoryFeaturesAMD> {
+    static void relocate(VkPhysicalDeviceCoherentMemoryFeaturesAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceColorWriteEnableFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceColorWriteEnableFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV> {
+    static void relocate(VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceConditionalRenderingFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceConditionalRenderingFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceConservativeRasterizationPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceConservativeRasterizationPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCooperativeMatrixFeaturesNV> {
+    static void relocate(VkPhysicalDeviceCooperativeMatrixFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCooperativeMatrixPropertiesNV> {
+    static void relocate(VkPhysicalDeviceCooperativeMatrixPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCopyMemoryIndirectFeaturesNV> {
+    static void relocate(VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCopyMemoryIndirectPropertiesNV> {
+    static void relocate(VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCornerSampledImageFeaturesNV> {
+    static void relocate(VkPhysicalDeviceCornerSampledImageFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCoverageReductionModeFeaturesNV> {
+    static void relocate(VkPhysicalDeviceCoverageReductionModeFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCustomBorderColorFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceCustomBorderColorFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceCustomBorderColorPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceCustomBorderColorPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV> {
+    static void relocate(VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDepthClampZeroOneFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDepthClipControlFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceDepthClipControlFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDepthClipEnableFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceDepthClipEnableFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDepthStencilResolveProperties> {
+    static void relocate(VkPhysicalDeviceDepthStencilResolveProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDescriptorBufferFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceDescriptorBufferFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDescriptorBufferPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceDescriptorBufferPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDescriptorIndexingFeatures> {
+    static void relocate(VkPhysicalDeviceDescriptorIndexingFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDescriptorIndexingProperties> {
+    static void relocate(VkPhysicalDeviceDescriptorIndexingProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE> {
+    static void relocate(VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV> {
+    static void relocate(VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV> {
+    static void relocate(VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDiagnosticsConfigFeaturesNV> {
+    static void relocate(VkPhysicalDeviceDiagnosticsConfigFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDiscardRectanglePropertiesEXT> {
+    static void relocate(VkPhysicalDeviceDiscardRectanglePropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkPhysicalDeviceDisplacementMicromapFeaturesNV> {
+    static void relocate(VkPhysicalDeviceDisplacementMicromapFeaturesNV& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkPhysicalDeviceDisplacementMicromapPropertiesNV> {
+    static void relocate(VkPhysicalDeviceDisplacementMicromapPropertiesNV& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDriverProperties> {
+    static void relocate(VkPhysicalDeviceDriverProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDrmPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceDrmPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDynamicRenderingFeatures> {
+    static void relocate(VkPhysicalDeviceDynamicRenderingFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExclusiveScissorFeaturesNV> {
+    static void relocate(VkPhysicalDeviceExclusiveScissorFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExtendedDynamicState3FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExtendedDynamicState3PropertiesEXT> {
+    static void relocate(VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExternalBufferInfo> {
+    static void relocate(VkPhysicalDeviceExternalBufferInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExternalFenceInfo> {
+    static void relocate(VkPhysicalDeviceExternalFenceInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExternalImageFormatInfo> {
+    static void relocate(VkPhysicalDeviceExternalImageFormatInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExternalMemoryHostPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceExternalMemoryHostPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV> {
+    static void relocate(VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceExternalSemaphoreInfo> {
+    static void relocate(VkPhysicalDeviceExternalSemaphoreInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFaultFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceFaultFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFeatures2> {
+    static void relocate(VkPhysicalDeviceFeatures2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFloatControlsProperties> {
+    static void relocate(VkPhysicalDeviceFloatControlsProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT> {
+    static void relocate(VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentDensityMapFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceFragmentDensityMapFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM> {
+    static void relocate(VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM> {
+    static void relocate(VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentDensityMapPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceFragmentDensityMapPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR> {
+    static void relocate(VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV> {
+    static void relocate(VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV> {
+    static void relocate(VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShadingRateFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceFragmentShadingRateFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShadingRateKHR> {
+    static void relocate(VkPhysicalDeviceFragmentShadingRateKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceFragmentShadingRatePropertiesKHR> {
+    static void relocate(VkPhysicalDeviceFragmentShadingRatePropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceGroupProperties> {
+    static void relocate(VkPhysicalDeviceGroupProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceHostQueryResetFeatures> {
+    static void relocate(VkPhysicalDeviceHostQueryResetFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceIDProperties> {
+    static void relocate(VkPhysicalDeviceIDProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageCompressionControlFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceImageCompressionControlFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageDrmFormatModifierInfoEXT> {
+    static void relocate(VkPhysicalDeviceImageDrmFormatModifierInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageFormatInfo2> {
+    static void relocate(VkPhysicalDeviceImageFormatInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageProcessingFeaturesQCOM> {
+    static void relocate(VkPhysicalDeviceImageProcessingFeaturesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageProcessingPropertiesQCOM> {
+    static void relocate(VkPhysicalDeviceImageProcessingPropertiesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageRobustnessFeatures> {
+    static void relocate(VkPhysicalDeviceImageRobustnessFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageViewImageFormatInfoEXT> {
+    static void relocate(VkPhysicalDeviceImageViewImageFormatInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImageViewMinLodFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceImageViewMinLodFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceImagelessFramebufferFeatures> {
+    static void relocate(VkPhysicalDeviceImagelessFramebufferFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceIndexTypeUint8FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceIndexTypeUint8FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceInheritedViewportScissorFeaturesNV> {
+    static void relocate(VkPhysicalDeviceInheritedViewportScissorFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceInlineUniformBlockFeatures> {
+    static void relocate(VkPhysicalDeviceInlineUniformBlockFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceInlineUniformBlockProperties> {
+    static void relocate(VkPhysicalDeviceInlineUniformBlockProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI> {
+    static void relocate(VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceLegacyDitheringFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceLegacyDitheringFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceLineRasterizationFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceLineRasterizationFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceLineRasterizationPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceLineRasterizationPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceLinearColorAttachmentFeaturesNV> {
+    static void relocate(VkPhysicalDeviceLinearColorAttachmentFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMaintenance3Properties> {
+    static void relocate(VkPhysicalDeviceMaintenance3Properties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMaintenance4Features> {
+    static void relocate(VkPhysicalDeviceMaintenance4Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMaintenance4Properties> {
+    static void relocate(VkPhysicalDeviceMaintenance4Properties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMemoryBudgetPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceMemoryBudgetPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMemoryDecompressionFeaturesNV> {
+    static void relocate(VkPhysicalDeviceMemoryDecompressionFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMemoryDecompressionPropertiesNV> {
+    static void relocate(VkPhysicalDeviceMemoryDecompressionPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMemoryPriorityFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceMemoryPriorityFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMemoryProperties2> {
+    static void relocate(VkPhysicalDeviceMemoryProperties2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMeshShaderFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceMeshShaderFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMeshShaderFeaturesNV> {
+    static void relocate(VkPhysicalDeviceMeshShaderFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMeshShaderPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceMeshShaderPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMeshShaderPropertiesNV> {
+    static void relocate(VkPhysicalDeviceMeshShaderPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultiDrawFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceMultiDrawFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultiDrawPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceMultiDrawPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultiviewFeatures> {
+    static void relocate(VkPhysicalDeviceMultiviewFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM> {
+    static void relocate(VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM> {
+    static void relocate(VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMultiviewProperties> {
+    static void relocate(VkPhysicalDeviceMultiviewProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceOpacityMicromapFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceOpacityMicromapFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceOpacityMicromapPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceOpacityMicromapPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceOpticalFlowFeaturesNV> {
+    static void relocate(VkPhysicalDeviceOpticalFlowFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceOpticalFlowPropertiesNV> {
+    static void relocate(VkPhysicalDeviceOpticalFlowPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePCIBusInfoPropertiesEXT> {
+    static void relocate(VkPhysicalDevicePCIBusInfoPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePerformanceQueryFeaturesKHR> {
+    static void relocate(VkPhysicalDevicePerformanceQueryFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePerformanceQueryPropertiesKHR> {
+    static void relocate(VkPhysicalDevicePerformanceQueryPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelineCreationCacheControlFeatures> {
+    static void relocate(VkPhysicalDevicePipelineCreationCacheControlFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR> {
+    static void relocate(VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelinePropertiesFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePipelinePropertiesFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelineProtectedAccessFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelineRobustnessFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePipelineRobustnessFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePipelineRobustnessPropertiesEXT> {
+    static void relocate(VkPhysicalDevicePipelineRobustnessPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePointClippingProperties> {
+    static void relocate(VkPhysicalDevicePointClippingProperties& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkPhysicalDevicePortabilitySubsetFeaturesKHR> {
+    static void relocate(VkPhysicalDevicePortabilitySubsetFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkPhysicalDevicePortabilitySubsetPropertiesKHR> {
+    static void relocate(VkPhysicalDevicePortabilitySubsetPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkPhysicalDevicePresentBarrierFeaturesNV> {
+    static void relocate(VkPhysicalDevicePresentBarrierFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePresentIdFeaturesKHR> {
+    static void relocate(VkPhysicalDevicePresentIdFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePresentWaitFeaturesKHR> {
+    static void relocate(VkPhysicalDevicePresentWaitFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT> {
+    static void relocate(VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePrivateDataFeatures> {
+    static void relocate(VkPhysicalDevicePrivateDataFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceProperties2> {
+    static void relocate(VkPhysicalDeviceProperties2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceProtectedMemoryFeatures> {
+    static void relocate(VkPhysicalDeviceProtectedMemoryFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceProtectedMemoryProperties> {
+    static void relocate(VkPhysicalDeviceProtectedMemoryProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceProvokingVertexFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceProvokingVertexFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceProvokingVertexPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceProvokingVertexPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDevicePushDescriptorPropertiesKHR> {
+    static void relocate(VkPhysicalDevicePushDescriptorPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayQueryFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceRayQueryFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV> {
+    static void relocate(VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV> {
+    static void relocate(VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR> {
+    static void relocate(VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV> {
+    static void relocate(VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingPipelineFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceRayTracingPipelineFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingPipelinePropertiesKHR> {
+    static void relocate(VkPhysicalDeviceRayTracingPipelinePropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRayTracingPropertiesNV> {
+    static void relocate(VkPhysicalDeviceRayTracingPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV> {
+    static void relocate(VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRobustness2FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceRobustness2FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceRobustness2PropertiesEXT> {
+    static void relocate(VkPhysicalDeviceRobustness2PropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSampleLocationsPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceSampleLocationsPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSamplerFilterMinmaxProperties> {
+    static void relocate(VkPhysicalDeviceSamplerFilterMinmaxProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSamplerYcbcrConversionFeatures> {
+    static void relocate(VkPhysicalDeviceSamplerYcbcrConversionFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceScalarBlockLayoutFeatures> {
+    static void relocate(VkPhysicalDeviceScalarBlockLayoutFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures> {
+    static void relocate(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderAtomicInt64Features> {
+    static void relocate(VkPhysicalDeviceShaderAtomicInt64Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderClockFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceShaderClockFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM> {
+    static void relocate(VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM> {
+    static void relocate(VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderCoreProperties2AMD> {
+    static void relocate(VkPhysicalDeviceShaderCoreProperties2AMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderCorePropertiesAMD> {
+    static void relocate(VkPhysicalDeviceShaderCorePropertiesAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderCorePropertiesARM> {
+    static void relocate(VkPhysicalDeviceShaderCorePropertiesARM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures> {
+    static void relocate(VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderDrawParametersFeatures> {
+    static void relocate(VkPhysicalDeviceShaderDrawParametersFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD> {
+    static void relocate(VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderFloat16Int8Features> {
+    static void relocate(VkPhysicalDeviceShaderFloat16Int8Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderImageFootprintFeaturesNV> {
+    static void relocate(VkPhysicalDeviceShaderImageFootprintFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderIntegerDotProductFeatures> {
+    static void relocate(VkPhysicalDeviceShaderIntegerDotProductFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderIntegerDotProductProperties> {
+    static void relocate(VkPhysicalDeviceShaderIntegerDotProductProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL> {
+    static void relocate(VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderObjectFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceShaderObjectFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderObjectPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceShaderObjectPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV> {
+    static void relocate(VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV> {
+    static void relocate(VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures> {
+    static void relocate(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderTerminateInvocationFeatures> {
+    static void relocate(VkPhysicalDeviceShaderTerminateInvocationFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderTileImageFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceShaderTileImageFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShaderTileImagePropertiesEXT> {
+    static void relocate(VkPhysicalDeviceShaderTileImagePropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShadingRateImageFeaturesNV> {
+    static void relocate(VkPhysicalDeviceShadingRateImageFeaturesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceShadingRateImagePropertiesNV> {
+    static void relocate(VkPhysicalDeviceShadingRateImagePropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSparseImageFormatInfo2> {
+    static void relocate(VkPhysicalDeviceSparseImageFormatInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSubgroupProperties> {
+    static void relocate(VkPhysicalDeviceSubgroupProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSubgroupSizeControlFeatures> {
+    static void relocate(VkPhysicalDeviceSubgroupSizeControlFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSubgroupSizeControlProperties> {
+    static void relocate(VkPhysicalDeviceSubgroupSizeControlProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI> {
+    static void relocate(VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI> {
+    static void relocate(VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSurfaceInfo2KHR> {
+    static void relocate(VkPhysicalDeviceSurfaceInfo2KHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT> {
+    static void relocate(VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceSynchronization2Features> {
+    static void relocate(VkPhysicalDeviceSynchronization2Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTexelBufferAlignmentProperties> {
+    static void relocate(VkPhysicalDeviceTexelBufferAlignmentProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTextureCompressionASTCHDRFeatures> {
+    static void relocate(VkPhysicalDeviceTextureCompressionASTCHDRFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTilePropertiesFeaturesQCOM> {
+    static void relocate(VkPhysicalDeviceTilePropertiesFeaturesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTimelineSemaphoreFeatures> {
+    static void relocate(VkPhysicalDeviceTimelineSemaphoreFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTimelineSemaphoreProperties> {
+    static void relocate(VkPhysicalDeviceTimelineSemaphoreProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceToolProperties> {
+    static void relocate(VkPhysicalDeviceToolProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTransformFeedbackFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceTransformFeedbackFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceTransformFeedbackPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceTransformFeedbackPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceUniformBufferStandardLayoutFeatures> {
+    static void relocate(VkPhysicalDeviceUniformBufferStandardLayoutFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVariablePointersFeatures> {
+    static void relocate(VkPhysicalDeviceVariablePointersFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT> {
+    static void relocate(VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR> {
+    static void relocate(VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVideoFormatInfoKHR> {
+    static void relocate(VkPhysicalDeviceVideoFormatInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkan11Features> {
+    static void relocate(VkPhysicalDeviceVulkan11Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkan11Properties> {
+    static void relocate(VkPhysicalDeviceVulkan11Properties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkan12Features> {
+    static void relocate(VkPhysicalDeviceVulkan12Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkan12Properties> {
+    static void relocate(VkPhysicalDeviceVulkan12Properties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkan13Features> {
+    static void relocate(VkPhysicalDeviceVulkan13Features& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkan13Properties> {
+    static void relocate(VkPhysicalDeviceVulkan13Properties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceVulkanMemoryModelFeatures> {
+    static void relocate(VkPhysicalDeviceVulkanMemoryModelFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR> {
+    static void relocate(VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT> {
+    static void relocate(VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures> {
+    static void relocate(VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineCacheCreateInfo> {
+    static void relocate(VkPipelineCacheCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineColorBlendAdvancedStateCreateInfoEXT> {
+    static void relocate(VkPipelineColorBlendAdvancedStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineColorBlendStateCreateInfo> {
+    static void relocate(VkPipelineColorBlendStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineColorWriteCreateInfoEXT> {
+    static void relocate(VkPipelineColorWriteCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineCompilerControlCreateInfoAMD> {
+    static void relocate(VkPipelineCompilerControlCreateInfoAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineCoverageModulationStateCreateInfoNV> {
+    static void relocate(VkPipelineCoverageModulationStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineCoverageReductionStateCreateInfoNV> {
+    static void relocate(VkPipelineCoverageReductionStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineCoverageToColorStateCreateInfoNV> {
+    static void relocate(VkPipelineCoverageToColorStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineCreationFeedbackCreateInfo> {
+    static void relocate(VkPipelineCreationFeedbackCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineDepthStencilStateCreateInfo> {
+    static void relocate(VkPipelineDepthStencilStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineDiscardRectangleStateCreateInfoEXT> {
+    static void relocate(VkPipelineDiscardRectangleStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineDynamicStateCreateInfo> {
+    static void relocate(VkPipelineDynamicStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineExecutableInfoKHR> {
+    static void relocate(VkPipelineExecutableInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineExecutableInternalRepresentationKHR> {
+    static void relocate(VkPipelineExecutableInternalRepresentationKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineExecutablePropertiesKHR> {
+    static void relocate(VkPipelineExecutablePropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineExecutableStatisticKHR> {
+    static void relocate(VkPipelineExecutableStatisticKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineFragmentShadingRateEnumStateCreateInfoNV> {
+    static void relocate(VkPipelineFragmentShadingRateEnumStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineFragmentShadingRateStateCreateInfoKHR> {
+    static void relocate(VkPipelineFragmentShadingRateStateCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineInfoKHR> {
+    static void relocate(VkPipelineInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineInputAssemblyStateCreateInfo> {
+    static void relocate(VkPipelineInputAssemblyStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineLayoutCreateInfo> {
+    static void relocate(VkPipelineLayoutCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineLibraryCreateInfoKHR> {
+    static void relocate(VkPipelineLibraryCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineMultisampleStateCreateInfo> {
+    static void relocate(VkPipelineMultisampleStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelinePropertiesIdentifierEXT> {
+    static void relocate(VkPipelinePropertiesIdentifierEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationConservativeStateCreateInfoEXT> {
+    static void relocate(VkPipelineRasterizationConservativeStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationDepthClipStateCreateInfoEXT> {
+    static void relocate(VkPipelineRasterizationDepthClipStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationLineStateCreateInfoEXT> {
+    static void relocate(VkPipelineRasterizationLineStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT> {
+    static void relocate(VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationStateCreateInfo> {
+    static void relocate(VkPipelineRasterizationStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationStateRasterizationOrderAMD> {
+    static void relocate(VkPipelineRasterizationStateRasterizationOrderAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRasterizationStateStreamCreateInfoEXT> {
+    static void relocate(VkPipelineRasterizationStateStreamCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRenderingCreateInfo> {
+    static void relocate(VkPipelineRenderingCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRepresentativeFragmentTestStateCreateInfoNV> {
+    static void relocate(VkPipelineRepresentativeFragmentTestStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineRobustnessCreateInfoEXT> {
+    static void relocate(VkPipelineRobustnessCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineSampleLocationsStateCreateInfoEXT> {
+    static void relocate(VkPipelineSampleLocationsStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSpecializationInfo> {
+    static void relocate(VkSpecializationInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineShaderStageCreateInfo> {
+    static void relocate(VkPipelineShaderStageCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineShaderStageModuleIdentifierCreateInfoEXT> {
+    static void relocate(VkPipelineShaderStageModuleIdentifierCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo> {
+    static void relocate(VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineTessellationDomainOriginStateCreateInfo> {
+    static void relocate(VkPipelineTessellationDomainOriginStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineTessellationStateCreateInfo> {
+    static void relocate(VkPipelineTessellationStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineVertexInputDivisorStateCreateInfoEXT> {
+    static void relocate(VkPipelineVertexInputDivisorStateCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineVertexInputStateCreateInfo> {
+    static void relocate(VkPipelineVertexInputStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkCoarseSampleOrderCustomNV> {
+    static void relocate(VkCoarseSampleOrderCustomNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV> {
+    static void relocate(VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportDepthClipControlCreateInfoEXT> {
+    static void relocate(VkPipelineViewportDepthClipControlCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportExclusiveScissorStateCreateInfoNV> {
+    static void relocate(VkPipelineViewportExclusiveScissorStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkShadingRatePaletteNV> {
+    static void relocate(VkShadingRatePaletteNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportShadingRateImageStateCreateInfoNV> {
+    static void relocate(VkPipelineViewportShadingRateImageStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportStateCreateInfo> {
+    static void relocate(VkPipelineViewportStateCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportSwizzleStateCreateInfoNV> {
+    static void relocate(VkPipelineViewportSwizzleStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPipelineViewportWScalingStateCreateInfoNV> {
+    static void relocate(VkPipelineViewportWScalingStateCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_GGP
+  template <> struct RelocateTraits<VkPresentFrameTokenGGP> {
+    static void relocate(VkPresentFrameTokenGGP& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkPresentIdKHR> {
+    static void relocate(VkPresentIdKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPresentInfoKHR> {
+    static void relocate(VkPresentInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPresentRegionKHR> {
+    static void relocate(VkPresentRegionKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPresentRegionsKHR> {
+    static void relocate(VkPresentRegionsKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPresentTimesInfoGOOGLE> {
+    static void relocate(VkPresentTimesInfoGOOGLE& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkPrivateDataSlotCreateInfo> {
+    static void relocate(VkPrivateDataSlotCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkProtectedSubmitInfo> {
+    static void relocate(VkProtectedSubmitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueryLowLatencySupportNV> {
+    static void relocate(VkQueryLowLatencySupportNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueryPoolCreateInfo> {
+    static void relocate(VkQueryPoolCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueryPoolPerformanceCreateInfoKHR> {
+    static void relocate(VkQueryPoolPerformanceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueryPoolPerformanceQueryCreateInfoINTEL> {
+    static void relocate(VkQueryPoolPerformanceQueryCreateInfoINTEL& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkQueryPoolVideoEncodeFeedbackCreateInfoKHR> {
+    static void relocate(VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkQueueFamilyCheckpointProperties2NV> {
+    static void relocate(VkQueueFamilyCheckpointProperties2NV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueueFamilyCheckpointPropertiesNV> {
+    static void relocate(VkQueueFamilyCheckpointPropertiesNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueueFamilyGlobalPriorityPropertiesKHR> {
+    static void relocate(VkQueueFamilyGlobalPriorityPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueueFamilyProperties2> {
+    static void relocate(VkQueueFamilyProperties2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueueFamilyQueryResultStatusPropertiesKHR> {
+    static void relocate(VkQueueFamilyQueryResultStatusPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkQueueFamilyVideoPropertiesKHR> {
+    static void relocate(VkQueueFamilyVideoPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRayTracingPipelineCreateInfoKHR> {
+    static void relocate(VkRayTracingPipelineCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRayTracingPipelineCreateInfoNV> {
+    static void relocate(VkRayTracingPipelineCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRayTracingPipelineInterfaceCreateInfoKHR> {
+    static void relocate(VkRayTracingPipelineInterfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRayTracingShaderGroupCreateInfoKHR> {
+    static void relocate(VkRayTracingShaderGroupCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRayTracingShaderGroupCreateInfoNV> {
+    static void relocate(VkRayTracingShaderGroupCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkReleaseSwapchainImagesInfoEXT> {
+    static void relocate(VkReleaseSwapchainImagesInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassAttachmentBeginInfo> {
+    static void relocate(VkRenderPassAttachmentBeginInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassBeginInfo> {
+    static void relocate(VkRenderPassBeginInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassDescription> {
+    static void relocate(VkSubpassDescription& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassCreateInfo> {
+    static void relocate(VkRenderPassCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassCreateInfo2> {
+    static void relocate(VkRenderPassCreateInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassCreationControlEXT> {
+    static void relocate(VkRenderPassCreationControlEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassCreationFeedbackCreateInfoEXT> {
+    static void relocate(VkRenderPassCreationFeedbackCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassFragmentDensityMapCreateInfoEXT> {
+    static void relocate(VkRenderPassFragmentDensityMapCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassInputAttachmentAspectCreateInfo> {
+    static void relocate(VkRenderPassInputAttachmentAspectCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassMultiviewCreateInfo> {
+    static void relocate(VkRenderPassMultiviewCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkAttachmentSampleLocationsEXT> {
+    static void relocate(VkAttachmentSampleLocationsEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassSampleLocationsEXT> {
+    static void relocate(VkSubpassSampleLocationsEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassSampleLocationsBeginInfoEXT> {
+    static void relocate(VkRenderPassSampleLocationsBeginInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassSubpassFeedbackCreateInfoEXT> {
+    static void relocate(VkRenderPassSubpassFeedbackCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderPassTransformBeginInfoQCOM> {
+    static void relocate(VkRenderPassTransformBeginInfoQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderingAttachmentInfo> {
+    static void relocate(VkRenderingAttachmentInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderingFragmentDensityMapAttachmentInfoEXT> {
+    static void relocate(VkRenderingFragmentDensityMapAttachmentInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderingFragmentShadingRateAttachmentInfoKHR> {
+    static void relocate(VkRenderingFragmentShadingRateAttachmentInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkRenderingInfo> {
+    static void relocate(VkRenderingInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkResolveImageInfo2> {
+    static void relocate(VkResolveImageInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSampleLocationsInfoEXT> {
+    static void relocate(VkSampleLocationsInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerBorderColorComponentMappingCreateInfoEXT> {
+    static void relocate(VkSamplerBorderColorComponentMappingCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerCaptureDescriptorDataInfoEXT> {
+    static void relocate(VkSamplerCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerCreateInfo> {
+    static void relocate(VkSamplerCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerCustomBorderColorCreateInfoEXT> {
+    static void relocate(VkSamplerCustomBorderColorCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerReductionModeCreateInfo> {
+    static void relocate(VkSamplerReductionModeCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerYcbcrConversionCreateInfo> {
+    static void relocate(VkSamplerYcbcrConversionCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerYcbcrConversionImageFormatProperties> {
+    static void relocate(VkSamplerYcbcrConversionImageFormatProperties& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSamplerYcbcrConversionInfo> {
+    static void relocate(VkSamplerYcbcrConversionInfo& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+  template <> struct RelocateTraits<VkScreenSurfaceCreateInfoQNX> {
+    static void relocate(VkScreenSurfaceCreateInfoQNX& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkSemaphoreCreateInfo> {
+    static void relocate(VkSemaphoreCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSemaphoreGetFdInfoKHR> {
+    static void relocate(VkSemaphoreGetFdInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkSemaphoreGetWin32HandleInfoKHR> {
+    static void relocate(VkSemaphoreGetWin32HandleInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkSemaphoreGetZirconHandleInfoFUCHSIA> {
+    static void relocate(VkSemaphoreGetZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkSemaphoreSignalInfo> {
+    static void relocate(VkSemaphoreSignalInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSemaphoreSubmitInfo> {
+    static void relocate(VkSemaphoreSubmitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSemaphoreTypeCreateInfo> {
+    static void relocate(VkSemaphoreTypeCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSemaphoreWaitInfo> {
+    static void relocate(VkSemaphoreWaitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkShaderCreateInfoEXT> {
+    static void relocate(VkShaderCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkShaderModuleCreateInfo> {
+    static void relocate(VkShaderModuleCreateInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkShaderModuleIdentifierEXT> {
+    static void relocate(VkShaderModuleIdentifierEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkShaderModuleValidationCacheCreateInfoEXT> {
+    static void relocate(VkShaderModuleValidationCacheCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSharedPresentSurfaceCapabilitiesKHR> {
+    static void relocate(VkSharedPresentSurfaceCapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSparseImageFormatProperties2> {
+    static void relocate(VkSparseImageFormatProperties2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSparseImageMemoryRequirements2> {
+    static void relocate(VkSparseImageMemoryRequirements2& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_GGP
+  template <> struct RelocateTraits<VkStreamDescriptorSurfaceCreateInfoGGP> {
+    static void relocate(VkStreamDescriptorSurfaceCreateInfoGGP& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkSubmitInfo> {
+    static void relocate(VkSubmitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubmitInfo2> {
+    static void relocate(VkSubmitInfo2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassBeginInfo> {
+    static void relocate(VkSubpassBeginInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassDependency2> {
+    static void relocate(VkSubpassDependency2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassDescription2> {
+    static void relocate(VkSubpassDescription2& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassDescriptionDepthStencilResolve> {
+    static void relocate(VkSubpassDescriptionDepthStencilResolve& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassEndInfo> {
+    static void relocate(VkSubpassEndInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassFragmentDensityMapOffsetEndInfoQCOM> {
+    static void relocate(VkSubpassFragmentDensityMapOffsetEndInfoQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassResolvePerformanceQueryEXT> {
+    static void relocate(VkSubpassResolvePerformanceQueryEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubpassShadingPipelineCreateInfoHUAWEI> {
+    static void relocate(VkSubpassShadingPipelineCreateInfoHUAWEI& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSubresourceLayout2EXT> {
+    static void relocate(VkSubresourceLayout2EXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSurfaceCapabilities2EXT> {
+    static void relocate(VkSurfaceCapabilities2EXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSurfaceCapabilities2KHR> {
+    static void relocate(VkSurfaceCapabilities2KHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkSurfaceCapabilitiesFullScreenExclusiveEXT> {
+    static void relocate(VkSurfaceCapabilitiesFullScreenExclusiveEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkSurfaceCapabilitiesPresentBarrierNV> {
+    static void relocate(VkSurfaceCapabilitiesPresentBarrierNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSurfaceFormat2KHR> {
+    static void relocate(VkSurfaceFormat2KHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkSurfaceFullScreenExclusiveInfoEXT> {
+    static void relocate(VkSurfaceFullScreenExclusiveInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkSurfaceFullScreenExclusiveWin32InfoEXT> {
+    static void relocate(VkSurfaceFullScreenExclusiveWin32InfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkSurfacePresentModeCompatibilityEXT> {
+    static void relocate(VkSurfacePresentModeCompatibilityEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSurfacePresentModeEXT> {
+    static void relocate(VkSurfacePresentModeEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSurfacePresentScalingCapabilitiesEXT> {
+    static void relocate(VkSurfacePresentScalingCapabilitiesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSurfaceProtectedCapabilitiesKHR> {
+    static void relocate(VkSurfaceProtectedCapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainCounterCreateInfoEXT> {
+    static void relocate(VkSwapchainCounterCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainCreateInfoKHR> {
+    static void relocate(VkSwapchainCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainDisplayNativeHdrCreateInfoAMD> {
+    static void relocate(VkSwapchainDisplayNativeHdrCreateInfoAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainPresentBarrierCreateInfoNV> {
+    static void relocate(VkSwapchainPresentBarrierCreateInfoNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainPresentFenceInfoEXT> {
+    static void relocate(VkSwapchainPresentFenceInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainPresentModeInfoEXT> {
+    static void relocate(VkSwapchainPresentModeInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainPresentModesCreateInfoEXT> {
+    static void relocate(VkSwapchainPresentModesCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkSwapchainPresentScalingCreateInfoEXT> {
+    static void relocate(VkSwapchainPresentScalingCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <> struct RelocateTraits<VkSysmemColorSpaceFUCHSIA> {
+    static void relocate(VkSysmemColorSpaceFUCHSIA& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkTextureLODGatherFormatPropertiesAMD> {
+    static void relocate(VkTextureLODGatherFormatPropertiesAMD& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkTilePropertiesQCOM> {
+    static void relocate(VkTilePropertiesQCOM& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkTimelineSemaphoreSubmitInfo> {
+    static void relocate(VkTimelineSemaphoreSubmitInfo& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkValidationCacheCreateInfoEXT> {
+    static void relocate(VkValidationCacheCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkValidationFeaturesEXT> {
+    static void relocate(VkValidationFeaturesEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkValidationFlagsEXT> {
+    static void relocate(VkValidationFlagsEXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVertexInputAttributeDescription2EXT> {
+    static void relocate(VkVertexInputAttributeDescription2EXT& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVertexInputBindingDescription2EXT> {
+    static void relocate(VkVertexInputBindingDescription2EXT& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_VI_NN
+  template <> struct RelocateTraits<VkViSurfaceCreateInfoNN> {
+    static void relocate(VkViSurfaceCreateInfoNN& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkVideoBeginCodingInfoKHR> {
+    static void relocate(VkVideoBeginCodingInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoCapabilitiesKHR> {
+    static void relocate(VkVideoCapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoCodingControlInfoKHR> {
+    static void relocate(VkVideoCodingControlInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeCapabilitiesKHR> {
+    static void relocate(VkVideoDecodeCapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH264CapabilitiesKHR> {
+    static void relocate(VkVideoDecodeH264CapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH264DpbSlotInfoKHR> {
+    static void relocate(VkVideoDecodeH264DpbSlotInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH264PictureInfoKHR> {
+    static void relocate(VkVideoDecodeH264PictureInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH264ProfileInfoKHR> {
+    static void relocate(VkVideoDecodeH264ProfileInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH264SessionParametersAddInfoKHR> {
+    static void relocate(VkVideoDecodeH264SessionParametersAddInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH264SessionParametersCreateInfoKHR> {
+    static void relocate(VkVideoDecodeH264SessionParametersCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH265CapabilitiesKHR> {
+    static void relocate(VkVideoDecodeH265CapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH265DpbSlotInfoKHR> {
+    static void relocate(VkVideoDecodeH265DpbSlotInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH265PictureInfoKHR> {
+    static void relocate(VkVideoDecodeH265PictureInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH265ProfileInfoKHR> {
+    static void relocate(VkVideoDecodeH265ProfileInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH265SessionParametersAddInfoKHR> {
+    static void relocate(VkVideoDecodeH265SessionParametersAddInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeH265SessionParametersCreateInfoKHR> {
+    static void relocate(VkVideoDecodeH265SessionParametersCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeInfoKHR> {
+    static void relocate(VkVideoDecodeInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoDecodeUsageInfoKHR> {
+    static void relocate(VkVideoDecodeUsageInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeCapabilitiesKHR> {
+    static void relocate(VkVideoEncodeCapabilitiesKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264CapabilitiesEXT> {
+    static void relocate(VkVideoEncodeH264CapabilitiesEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264DpbSlotInfoEXT> {
+    static void relocate(VkVideoEncodeH264DpbSlotInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264GopRemainingFrameInfoEXT> {
+    static void relocate(VkVideoEncodeH264GopRemainingFrameInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264NaluSliceInfoEXT> {
+    static void relocate(VkVideoEncodeH264NaluSliceInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264PictureInfoEXT> {
+    static void relocate(VkVideoEncodeH264PictureInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264ProfileInfoEXT> {
+    static void relocate(VkVideoEncodeH264ProfileInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264QualityLevelPropertiesEXT> {
+    static void relocate(VkVideoEncodeH264QualityLevelPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264RateControlInfoEXT> {
+    static void relocate(VkVideoEncodeH264RateControlInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264RateControlLayerInfoEXT> {
+    static void relocate(VkVideoEncodeH264RateControlLayerInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264SessionCreateInfoEXT> {
+    static void relocate(VkVideoEncodeH264SessionCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264SessionParametersAddInfoEXT> {
+    static void relocate(VkVideoEncodeH264SessionParametersAddInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264SessionParametersCreateInfoEXT> {
+    static void relocate(VkVideoEncodeH264SessionParametersCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264SessionParametersFeedbackInfoEXT> {
+    static void relocate(VkVideoEncodeH264SessionParametersFeedbackInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH264SessionParametersGetInfoEXT> {
+    static void relocate(VkVideoEncodeH264SessionParametersGetInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265CapabilitiesEXT> {
+    static void relocate(VkVideoEncodeH265CapabilitiesEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265DpbSlotInfoEXT> {
+    static void relocate(VkVideoEncodeH265DpbSlotInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265GopRemainingFrameInfoEXT> {
+    static void relocate(VkVideoEncodeH265GopRemainingFrameInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265NaluSliceSegmentInfoEXT> {
+    static void relocate(VkVideoEncodeH265NaluSliceSegmentInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265PictureInfoEXT> {
+    static void relocate(VkVideoEncodeH265PictureInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265ProfileInfoEXT> {
+    static void relocate(VkVideoEncodeH265ProfileInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265QualityLevelPropertiesEXT> {
+    static void relocate(VkVideoEncodeH265QualityLevelPropertiesEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265RateControlInfoEXT> {
+    static void relocate(VkVideoEncodeH265RateControlInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265RateControlLayerInfoEXT> {
+    static void relocate(VkVideoEncodeH265RateControlLayerInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265SessionCreateInfoEXT> {
+    static void relocate(VkVideoEncodeH265SessionCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265SessionParametersAddInfoEXT> {
+    static void relocate(VkVideoEncodeH265SessionParametersAddInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265SessionParametersCreateInfoEXT> {
+    static void relocate(VkVideoEncodeH265SessionParametersCreateInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265SessionParametersFeedbackInfoEXT> {
+    static void relocate(VkVideoEncodeH265SessionParametersFeedbackInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeH265SessionParametersGetInfoEXT> {
+    static void relocate(VkVideoEncodeH265SessionParametersGetInfoEXT& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeInfoKHR> {
+    static void relocate(VkVideoEncodeInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeQualityLevelInfoKHR> {
+    static void relocate(VkVideoEncodeQualityLevelInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeQualityLevelPropertiesKHR> {
+    static void relocate(VkVideoEncodeQualityLevelPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeRateControlInfoKHR> {
+    static void relocate(VkVideoEncodeRateControlInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeRateControlLayerInfoKHR> {
+    static void relocate(VkVideoEncodeRateControlLayerInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeSessionParametersFeedbackInfoKHR> {
+    static void relocate(VkVideoEncodeSessionParametersFeedbackInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeSessionParametersGetInfoKHR> {
+    static void relocate(VkVideoEncodeSessionParametersGetInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <> struct RelocateTraits<VkVideoEncodeUsageInfoKHR> {
+    static void relocate(VkVideoEncodeUsageInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkVideoEndCodingInfoKHR> {
+    static void relocate(VkVideoEndCodingInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoFormatPropertiesKHR> {
+    static void relocate(VkVideoFormatPropertiesKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoPictureResourceInfoKHR> {
+    static void relocate(VkVideoPictureResourceInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoProfileInfoKHR> {
+    static void relocate(VkVideoProfileInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoProfileListInfoKHR> {
+    static void relocate(VkVideoProfileListInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoReferenceSlotInfoKHR> {
+    static void relocate(VkVideoReferenceSlotInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoSessionCreateInfoKHR> {
+    static void relocate(VkVideoSessionCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoSessionMemoryRequirementsKHR> {
+    static void relocate(VkVideoSessionMemoryRequirementsKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoSessionParametersCreateInfoKHR> {
+    static void relocate(VkVideoSessionParametersCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkVideoSessionParametersUpdateInfoKHR> {
+    static void relocate(VkVideoSessionParametersUpdateInfoKHR& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+  template <> struct RelocateTraits<VkWaylandSurfaceCreateInfoKHR> {
+    static void relocate(VkWaylandSurfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkWin32KeyedMutexAcquireReleaseInfoKHR> {
+    static void relocate(VkWin32KeyedMutexAcquireReleaseInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkWin32KeyedMutexAcquireReleaseInfoNV> {
+    static void relocate(VkWin32KeyedMutexAcquireReleaseInfoNV& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <> struct RelocateTraits<VkWin32SurfaceCreateInfoKHR> {
+    static void relocate(VkWin32SurfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  template <> struct RelocateTraits<VkWriteDescriptorSet> {
+    static void relocate(VkWriteDescriptorSet& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkWriteDescriptorSetAccelerationStructureKHR> {
+    static void relocate(VkWriteDescriptorSetAccelerationStructureKHR& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkWriteDescriptorSetAccelerationStructureNV> {
+    static void relocate(VkWriteDescriptorSetAccelerationStructureNV& obj, PointerRelocator& relocator);
+  };
+
+  template <> struct RelocateTraits<VkWriteDescriptorSetInlineUniformBlock> {
+    static void relocate(VkWriteDescriptorSetInlineUniformBlock& obj, PointerRelocator& relocator);
+  };
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+  template <> struct RelocateTraits<VkXcbSurfaceCreateInfoKHR> {
+    static void relocate(VkXcbSurfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+  template <> struct RelocateTraits<VkXlibSurfaceCreateInfoKHR> {
+    static void relocate(VkXlibSurfaceCreateInfoKHR& obj, PointerRelocator& relocator);
+  };
+#endif
+
+  inline void RelocateTraits<VkAccelerationStructureBuildSizesInfoKHR>::relocate(VkAccelerationStructureBuildSizesInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureCaptureDescriptorDataInfoEXT>::relocate(VkAccelerationStructureCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureCreateInfoKHR>::relocate(VkAccelerationStructureCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureCreateInfoNV>::relocate(VkAccelerationStructureCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkAccelerationStructureInfoNV>::relocate(obj.info, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureDeviceAddressInfoKHR>::relocate(VkAccelerationStructureDeviceAddressInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureGeometryAabbsDataKHR>::relocate(VkAccelerationStructureGeometryAabbsDataKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureGeometryInstancesDataKHR>::relocate(VkAccelerationStructureGeometryInstancesDataKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureGeometryMotionTrianglesDataNV>::relocate(VkAccelerationStructureGeometryMotionTrianglesDataNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureGeometryTrianglesDataKHR>::relocate(VkAccelerationStructureGeometryTrianglesDataKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureInfoNV>::relocate(VkAccelerationStructureInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pGeometries, obj.geometryCount, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureMemoryRequirementsInfoNV>::relocate(VkAccelerationStructureMemoryRequirementsInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureMotionInfoNV>::relocate(VkAccelerationStructureMotionInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkAccelerationStructureTrianglesDisplacementMicromapNV>::relocate(VkAccelerationStructureTrianglesDisplacementMicromapNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pUsageCounts, obj.usageCountsCount, relocator);
+    RelocatePointerArray(obj.ppUsageCounts, obj.usageCountsCount, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkAccelerationStructureTrianglesOpacityMicromapEXT>::relocate(VkAccelerationStructureTrianglesOpacityMicromapEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pUsageCounts, obj.usageCountsCount, relocator);
+    RelocatePointerArray(obj.ppUsageCounts, obj.usageCountsCount, relocator);
+  }
+
+  inline void RelocateTraits<VkAccelerationStructureVersionInfoKHR>::relocate(VkAccelerationStructureVersionInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pVersionData, 2 * VK_UUID_SIZE, relocator);
+  }
+
+  inline void RelocateTraits<VkAcquireNextImageInfoKHR>::relocate(VkAcquireNextImageInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAcquireProfilingLockInfoKHR>::relocate(VkAcquireProfilingLockInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAmigoProfilingSubmitInfoSEC>::relocate(VkAmigoProfilingSubmitInfoSEC& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkAndroidHardwareBufferFormatProperties2ANDROID>::relocate(VkAndroidHardwareBufferFormatProperties2ANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkAndroidHardwareBufferFormatPropertiesANDROID>::relocate(VkAndroidHardwareBufferFormatPropertiesANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkAndroidHardwareBufferPropertiesANDROID>::relocate(VkAndroidHardwareBufferPropertiesANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkAndroidHardwareBufferUsageANDROID>::relocate(VkAndroidHardwareBufferUsageANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkAndroidSurfaceCreateInfoKHR>::relocate(VkAndroidSurfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkApplicationInfo>::relocate(VkApplicationInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pApplicationName);
+    relocator.string(obj.pEngineName);
+  }
+
+  inline void RelocateTraits<VkAttachmentDescription2>::relocate(VkAttachmentDescription2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAttachmentDescriptionStencilLayout>::relocate(VkAttachmentDescriptionStencilLayout& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAttachmentReference2>::relocate(VkAttachmentReference2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAttachmentReferenceStencilLayout>::relocate(VkAttachmentReferenceStencilLayout& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkAttachmentSampleCountInfoAMD>::relocate(VkAttachmentSampleCountInfoAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pColorAttachmentSamples, obj.colorAttachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBindAccelerationStructureMemoryInfoNV>::relocate(VkBindAccelerationStructureMemoryInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDeviceIndices, obj.deviceIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBindBufferMemoryDeviceGroupInfo>::relocate(VkBindBufferMemoryDeviceGroupInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDeviceIndices, obj.deviceIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBindBufferMemoryInfo>::relocate(VkBindBufferMemoryInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBindImageMemoryDeviceGroupInfo>::relocate(VkBindImageMemoryDeviceGroupInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDeviceIndices, obj.deviceIndexCount, relocator);
+    RelocateArray(obj.pSplitInstanceBindRegions, obj.splitInstanceBindRegionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBindImageMemoryInfo>::relocate(VkBindImageMemoryInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBindImageMemorySwapchainInfoKHR>::relocate(VkBindImageMemorySwapchainInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBindImagePlaneMemoryInfo>::relocate(VkBindImagePlaneMemoryInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSparseBufferMemoryBindInfo>::relocate(VkSparseBufferMemoryBindInfo& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pBinds, obj.bindCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSparseImageOpaqueMemoryBindInfo>::relocate(VkSparseImageOpaqueMemoryBindInfo& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pBinds, obj.bindCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSparseImageMemoryBindInfo>::relocate(VkSparseImageMemoryBindInfo& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pBinds, obj.bindCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBindSparseInfo>::relocate(VkBindSparseInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphores, obj.waitSemaphoreCount, relocator);
+    RelocateArray(obj.pBufferBinds, obj.bufferBindCount, relocator);
+    RelocateArray(obj.pImageOpaqueBinds, obj.imageOpaqueBindCount, relocator);
+    RelocateArray(obj.pImageBinds, obj.imageBindCount, relocator);
+    RelocateArray(obj.pSignalSemaphores, obj.signalSemaphoreCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBindVideoSessionMemoryInfoKHR>::relocate(VkBindVideoSessionMemoryInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBlitImageInfo2>::relocate(VkBlitImageInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferCaptureDescriptorDataInfoEXT>::relocate(VkBufferCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkBufferCollectionBufferCreateInfoFUCHSIA>::relocate(VkBufferCollectionBufferCreateInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::relocate(VkBufferCollectionConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkBufferCollectionCreateInfoFUCHSIA>::relocate(VkBufferCollectionCreateInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkBufferCollectionImageCreateInfoFUCHSIA>::relocate(VkBufferCollectionImageCreateInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkBufferCollectionPropertiesFUCHSIA>::relocate(VkBufferCollectionPropertiesFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkSysmemColorSpaceFUCHSIA>::relocate(obj.sysmemColorSpaceIndex, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkBufferConstraintsInfoFUCHSIA>::relocate(VkBufferConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkBufferCreateInfo>::relocate(obj.createInfo, relocator);
+    RelocateTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::relocate(obj.bufferCollectionConstraints, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkBufferCopy2>::relocate(VkBufferCopy2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferCreateInfo>::relocate(VkBufferCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pQueueFamilyIndices, obj.queueFamilyIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferDeviceAddressCreateInfoEXT>::relocate(VkBufferDeviceAddressCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferDeviceAddressInfo>::relocate(VkBufferDeviceAddressInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferImageCopy2>::relocate(VkBufferImageCopy2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferMemoryBarrier>::relocate(VkBufferMemoryBarrier& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferMemoryBarrier2>::relocate(VkBufferMemoryBarrier2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferMemoryRequirementsInfo2>::relocate(VkBufferMemoryRequirementsInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferOpaqueCaptureAddressCreateInfo>::relocate(VkBufferOpaqueCaptureAddressCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkBufferViewCreateInfo>::relocate(VkBufferViewCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCalibratedTimestampInfoEXT>::relocate(VkCalibratedTimestampInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCheckpointData2NV>::relocate(VkCheckpointData2NV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCheckpointDataNV>::relocate(VkCheckpointDataNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferAllocateInfo>::relocate(VkCommandBufferAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferInheritanceConditionalRenderingInfoEXT>::relocate(VkCommandBufferInheritanceConditionalRenderingInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferInheritanceInfo>::relocate(VkCommandBufferInheritanceInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferInheritanceRenderPassTransformInfoQCOM>::relocate(VkCommandBufferInheritanceRenderPassTransformInfoQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferInheritanceRenderingInfo>::relocate(VkCommandBufferInheritanceRenderingInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pColorAttachmentFormats, obj.colorAttachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferInheritanceViewportScissorInfoNV>::relocate(VkCommandBufferInheritanceViewportScissorInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewportDepths, obj.viewportDepthCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandBufferSubmitInfo>::relocate(VkCommandBufferSubmitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCommandPoolCreateInfo>::relocate(VkCommandPoolCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkComputePipelineCreateInfo>::relocate(VkComputePipelineCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkPipelineShaderStageCreateInfo>::relocate(obj.stage, relocator);
+  }
+
+  inline void RelocateTraits<VkConditionalRenderingBeginInfoEXT>::relocate(VkConditionalRenderingBeginInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCooperativeMatrixPropertiesNV>::relocate(VkCooperativeMatrixPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyAccelerationStructureInfoKHR>::relocate(VkCopyAccelerationStructureInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyAccelerationStructureToMemoryInfoKHR>::relocate(VkCopyAccelerationStructureToMemoryInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyBufferInfo2>::relocate(VkCopyBufferInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyBufferToImageInfo2>::relocate(VkCopyBufferToImageInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyCommandTransformInfoQCOM>::relocate(VkCopyCommandTransformInfoQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyDescriptorSet>::relocate(VkCopyDescriptorSet& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyImageInfo2>::relocate(VkCopyImageInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyImageToBufferInfo2>::relocate(VkCopyImageToBufferInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyMemoryToAccelerationStructureInfoKHR>::relocate(VkCopyMemoryToAccelerationStructureInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyMemoryToMicromapInfoEXT>::relocate(VkCopyMemoryToMicromapInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyMicromapInfoEXT>::relocate(VkCopyMicromapInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkCopyMicromapToMemoryInfoEXT>::relocate(VkCopyMicromapToMemoryInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkD3D12FenceSubmitInfoKHR>::relocate(VkD3D12FenceSubmitInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphoreValues, obj.waitSemaphoreValuesCount, relocator);
+    RelocateArray(obj.pSignalSemaphoreValues, obj.signalSemaphoreValuesCount, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkDebugMarkerMarkerInfoEXT>::relocate(VkDebugMarkerMarkerInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pMarkerName);
+  }
+
+  inline void RelocateTraits<VkDebugMarkerObjectNameInfoEXT>::relocate(VkDebugMarkerObjectNameInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pObjectName);
+  }
+
+  inline void RelocateTraits<VkDebugMarkerObjectTagInfoEXT>::relocate(VkDebugMarkerObjectTagInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pTag, obj.tagSize);
+  }
+
+  inline void RelocateTraits<VkDebugReportCallbackCreateInfoEXT>::relocate(VkDebugReportCallbackCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDebugUtilsLabelEXT>::relocate(VkDebugUtilsLabelEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pLabelName);
+  }
+
+  inline void RelocateTraits<VkDebugUtilsMessengerCallbackDataEXT>::relocate(VkDebugUtilsMessengerCallbackDataEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pMessageIdName);
+    relocator.string(obj.pMessage);
+    RelocateArray(obj.pQueueLabels, obj.queueLabelCount, relocator);
+    RelocateArray(obj.pCmdBufLabels, obj.cmdBufLabelCount, relocator);
+    RelocateArray(obj.pObjects, obj.objectCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDebugUtilsMessengerCreateInfoEXT>::relocate(VkDebugUtilsMessengerCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDebugUtilsObjectNameInfoEXT>::relocate(VkDebugUtilsObjectNameInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pObjectName);
+  }
+
+  inline void RelocateTraits<VkDebugUtilsObjectTagInfoEXT>::relocate(VkDebugUtilsObjectTagInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pTag, obj.tagSize);
+  }
+
+  inline void RelocateTraits<VkDedicatedAllocationBufferCreateInfoNV>::relocate(VkDedicatedAllocationBufferCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDedicatedAllocationImageCreateInfoNV>::relocate(VkDedicatedAllocationImageCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDedicatedAllocationMemoryAllocateInfoNV>::relocate(VkDedicatedAllocationMemoryAllocateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDependencyInfo>::relocate(VkDependencyInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pMemoryBarriers, obj.memoryBarrierCount, relocator);
+    RelocateArray(obj.pBufferMemoryBarriers, obj.bufferMemoryBarrierCount, relocator);
+    RelocateArray(obj.pImageMemoryBarriers, obj.imageMemoryBarrierCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorAddressInfoEXT>::relocate(VkDescriptorAddressInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorBufferBindingInfoEXT>::relocate(VkDescriptorBufferBindingInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorBufferBindingPushDescriptorBufferHandleEXT>::relocate(VkDescriptorBufferBindingPushDescriptorBufferHandleEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorPoolCreateInfo>::relocate(VkDescriptorPoolCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPoolSizes, obj.poolSizeCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorPoolInlineUniformBlockCreateInfo>::relocate(VkDescriptorPoolInlineUniformBlockCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetAllocateInfo>::relocate(VkDescriptorSetAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSetLayouts, obj.descriptorSetCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetBindingReferenceVALVE>::relocate(VkDescriptorSetBindingReferenceVALVE& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetLayoutBindingFlagsCreateInfo>::relocate(VkDescriptorSetLayoutBindingFlagsCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pBindingFlags, obj.bindingCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetLayoutBinding>::relocate(VkDescriptorSetLayoutBinding& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pImmutableSamplers, obj.descriptorCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetLayoutCreateInfo>::relocate(VkDescriptorSetLayoutCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pBindings, obj.bindingCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetLayoutHostMappingInfoVALVE>::relocate(VkDescriptorSetLayoutHostMappingInfoVALVE& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetLayoutSupport>::relocate(VkDescriptorSetLayoutSupport& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetVariableDescriptorCountAllocateInfo>::relocate(VkDescriptorSetVariableDescriptorCountAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDescriptorCounts, obj.descriptorSetCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorSetVariableDescriptorCountLayoutSupport>::relocate(VkDescriptorSetVariableDescriptorCountLayoutSupport& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDescriptorUpdateTemplateCreateInfo>::relocate(VkDescriptorUpdateTemplateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDescriptorUpdateEntries, obj.descriptorUpdateEntryCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceAddressBindingCallbackDataEXT>::relocate(VkDeviceAddressBindingCallbackDataEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceBufferMemoryRequirements>::relocate(VkDeviceBufferMemoryRequirements& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pCreateInfo, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceCreateInfo>::relocate(VkDeviceCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pQueueCreateInfos, obj.queueCreateInfoCount, relocator);
+    RelocateStringArray(obj.ppEnabledLayerNames, obj.enabledLayerCount, relocator);
+    RelocateStringArray(obj.ppEnabledExtensionNames, obj.enabledExtensionCount, relocator);
+    RelocateArray(obj.pEnabledFeatures, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceDeviceMemoryReportCreateInfoEXT>::relocate(VkDeviceDeviceMemoryReportCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceDiagnosticsConfigCreateInfoNV>::relocate(VkDeviceDiagnosticsConfigCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceEventInfoEXT>::relocate(VkDeviceEventInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceFaultCountsEXT>::relocate(VkDeviceFaultCountsEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupBindSparseInfo>::relocate(VkDeviceGroupBindSparseInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupCommandBufferBeginInfo>::relocate(VkDeviceGroupCommandBufferBeginInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupDeviceCreateInfo>::relocate(VkDeviceGroupDeviceCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPhysicalDevices, obj.physicalDeviceCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupPresentCapabilitiesKHR>::relocate(VkDeviceGroupPresentCapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupPresentInfoKHR>::relocate(VkDeviceGroupPresentInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDeviceMasks, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupRenderPassBeginInfo>::relocate(VkDeviceGroupRenderPassBeginInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDeviceRenderAreas, obj.deviceRenderAreaCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupSubmitInfo>::relocate(VkDeviceGroupSubmitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphoreDeviceIndices, obj.waitSemaphoreCount, relocator);
+    RelocateArray(obj.pCommandBufferDeviceMasks, obj.commandBufferCount, relocator);
+    RelocateArray(obj.pSignalSemaphoreDeviceIndices, obj.signalSemaphoreCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceGroupSwapchainCreateInfoKHR>::relocate(VkDeviceGroupSwapchainCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceImageMemoryRequirements>::relocate(VkDeviceImageMemoryRequirements& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pCreateInfo, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceMemoryOpaqueCaptureAddressInfo>::relocate(VkDeviceMemoryOpaqueCaptureAddressInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceMemoryOverallocationCreateInfoAMD>::relocate(VkDeviceMemoryOverallocationCreateInfoAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceMemoryReportCallbackDataEXT>::relocate(VkDeviceMemoryReportCallbackDataEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDevicePrivateDataCreateInfo>::relocate(VkDevicePrivateDataCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceQueueCreateInfo>::relocate(VkDeviceQueueCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pQueuePriorities, obj.queueCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceQueueGlobalPriorityCreateInfoKHR>::relocate(VkDeviceQueueGlobalPriorityCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDeviceQueueInfo2>::relocate(VkDeviceQueueInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDirectDriverLoadingInfoLUNARG>::relocate(VkDirectDriverLoadingInfoLUNARG& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDirectDriverLoadingListLUNARG>::relocate(VkDirectDriverLoadingListLUNARG& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDrivers, obj.driverCount, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+  inline void RelocateTraits<VkDirectFBSurfaceCreateInfoEXT>::relocate(VkDirectFBSurfaceCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkDisplayEventInfoEXT>::relocate(VkDisplayEventInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayModeCreateInfoKHR>::relocate(VkDisplayModeCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayModeProperties2KHR>::relocate(VkDisplayModeProperties2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayNativeHdrSurfaceCapabilitiesAMD>::relocate(VkDisplayNativeHdrSurfaceCapabilitiesAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayPlaneCapabilities2KHR>::relocate(VkDisplayPlaneCapabilities2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayPlaneInfo2KHR>::relocate(VkDisplayPlaneInfo2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayPlaneProperties2KHR>::relocate(VkDisplayPlaneProperties2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayPowerInfoEXT>::relocate(VkDisplayPowerInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayPresentInfoKHR>::relocate(VkDisplayPresentInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplayPropertiesKHR>::relocate(VkDisplayPropertiesKHR& obj, PointerRelocator& relocator) {
+    relocator.string(obj.displayName);
+  }
+
+  inline void RelocateTraits<VkDisplayProperties2KHR>::relocate(VkDisplayProperties2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkDisplayPropertiesKHR>::relocate(obj.displayProperties, relocator);
+  }
+
+  inline void RelocateTraits<VkDisplaySurfaceCreateInfoKHR>::relocate(VkDisplaySurfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkDrmFormatModifierPropertiesList2EXT>::relocate(VkDrmFormatModifierPropertiesList2EXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDrmFormatModifierProperties, obj.drmFormatModifierCount, relocator);
+  }
+
+  inline void RelocateTraits<VkDrmFormatModifierPropertiesListEXT>::relocate(VkDrmFormatModifierPropertiesListEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDrmFormatModifierProperties, obj.drmFormatModifierCount, relocator);
+  }
+
+  inline void RelocateTraits<VkEventCreateInfo>::relocate(VkEventCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExportFenceCreateInfo>::relocate(VkExportFenceCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkExportFenceWin32HandleInfoKHR>::relocate(VkExportFenceWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkExportMemoryAllocateInfo>::relocate(VkExportMemoryAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExportMemoryAllocateInfoNV>::relocate(VkExportMemoryAllocateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkExportMemoryWin32HandleInfoKHR>::relocate(VkExportMemoryWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkExportMemoryWin32HandleInfoNV>::relocate(VkExportMemoryWin32HandleInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalBufferInfoEXT>::relocate(VkExportMetalBufferInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalCommandQueueInfoEXT>::relocate(VkExportMetalCommandQueueInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalDeviceInfoEXT>::relocate(VkExportMetalDeviceInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalIOSurfaceInfoEXT>::relocate(VkExportMetalIOSurfaceInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalObjectCreateInfoEXT>::relocate(VkExportMetalObjectCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalObjectsInfoEXT>::relocate(VkExportMetalObjectsInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalSharedEventInfoEXT>::relocate(VkExportMetalSharedEventInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkExportMetalTextureInfoEXT>::relocate(VkExportMetalTextureInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkExportSemaphoreCreateInfo>::relocate(VkExportSemaphoreCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkExportSemaphoreWin32HandleInfoKHR>::relocate(VkExportSemaphoreWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkExternalBufferProperties>::relocate(VkExternalBufferProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExternalFenceProperties>::relocate(VkExternalFenceProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkExternalFormatANDROID>::relocate(VkExternalFormatANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkExternalImageFormatProperties>::relocate(VkExternalImageFormatProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExternalMemoryAcquireUnmodifiedEXT>::relocate(VkExternalMemoryAcquireUnmodifiedEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExternalMemoryBufferCreateInfo>::relocate(VkExternalMemoryBufferCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExternalMemoryImageCreateInfo>::relocate(VkExternalMemoryImageCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExternalMemoryImageCreateInfoNV>::relocate(VkExternalMemoryImageCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkExternalSemaphoreProperties>::relocate(VkExternalSemaphoreProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkFenceCreateInfo>::relocate(VkFenceCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkFenceGetFdInfoKHR>::relocate(VkFenceGetFdInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkFenceGetWin32HandleInfoKHR>::relocate(VkFenceGetWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkFilterCubicImageViewImageFormatPropertiesEXT>::relocate(VkFilterCubicImageViewImageFormatPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkFormatProperties2>::relocate(VkFormatProperties2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkFormatProperties3>::relocate(VkFormatProperties3& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkFragmentShadingRateAttachmentInfoKHR>::relocate(VkFragmentShadingRateAttachmentInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pFragmentShadingRateAttachment, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkFramebufferAttachmentImageInfo>::relocate(VkFramebufferAttachmentImageInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewFormats, obj.viewFormatCount, relocator);
+  }
+
+  inline void RelocateTraits<VkFramebufferAttachmentsCreateInfo>::relocate(VkFramebufferAttachmentsCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachmentImageInfos, obj.attachmentImageInfoCount, relocator);
+  }
+
+  inline void RelocateTraits<VkFramebufferCreateInfo>::relocate(VkFramebufferCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachments, obj.attachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkFramebufferMixedSamplesCombinationNV>::relocate(VkFramebufferMixedSamplesCombinationNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkGeneratedCommandsInfoNV>::relocate(VkGeneratedCommandsInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pStreams, obj.streamCount, relocator);
+  }
+
+  inline void RelocateTraits<VkGeneratedCommandsMemoryRequirementsInfoNV>::relocate(VkGeneratedCommandsMemoryRequirementsInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkGeometryAABBNV>::relocate(VkGeometryAABBNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkGeometryDataNV>::relocate(VkGeometryDataNV& obj, PointerRelocator& relocator) {
+    RelocateTraits<VkGeometryTrianglesNV>::relocate(obj.triangles, relocator);
+    RelocateTraits<VkGeometryAABBNV>::relocate(obj.aabbs, relocator);
+  }
+
+  inline void RelocateTraits<VkGeometryNV>::relocate(VkGeometryNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkGeometryDataNV>::relocate(obj.geometry, relocator);
+  }
+
+  inline void RelocateTraits<VkGeometryTrianglesNV>::relocate(VkGeometryTrianglesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkGraphicsPipelineCreateInfo>::relocate(VkGraphicsPipelineCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pStages, obj.stageCount, relocator);
+    RelocateArray(obj.pVertexInputState, 1, relocator);
+    RelocateArray(obj.pInputAssemblyState, 1, relocator);
+    RelocateArray(obj.pTessellationState, 1, relocator);
+    RelocateArray(obj.pViewportState, 1, relocator);
+    RelocateArray(obj.pRasterizationState, 1, relocator);
+    RelocateArray(obj.pMultisampleState, 1, relocator);
+    RelocateArray(obj.pDepthStencilState, 1, relocator);
+    RelocateArray(obj.pColorBlendState, 1, relocator);
+    RelocateArray(obj.pDynamicState, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkGraphicsPipelineLibraryCreateInfoEXT>::relocate(VkGraphicsPipelineLibraryCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkGraphicsPipelineShaderGroupsCreateInfoNV>::relocate(VkGraphicsPipelineShaderGroupsCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pGroups, obj.groupCount, relocator);
+    RelocateArray(obj.pPipelines, obj.pipelineCount, relocator);
+  }
+
+  inline void RelocateTraits<VkGraphicsShaderGroupCreateInfoNV>::relocate(VkGraphicsShaderGroupCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pStages, obj.stageCount, relocator);
+    RelocateArray(obj.pVertexInputState, 1, relocator);
+    RelocateArray(obj.pTessellationState, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkHdrMetadataEXT>::relocate(VkHdrMetadataEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkHeadlessSurfaceCreateInfoEXT>::relocate(VkHeadlessSurfaceCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_IOS_MVK
+  inline void RelocateTraits<VkIOSSurfaceCreateInfoMVK>::relocate(VkIOSSurfaceCreateInfoMVK& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImageBlit2>::relocate(VkImageBlit2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageCaptureDescriptorDataInfoEXT>::relocate(VkImageCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageCompressionControlEXT>::relocate(VkImageCompressionControlEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pFixedRateFlags, obj.compressionControlPlaneCount, relocator);
+  }
+
+  inline void RelocateTraits<VkImageCompressionPropertiesEXT>::relocate(VkImageCompressionPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkImageConstraintsInfoFUCHSIA>::relocate(VkImageConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pFormatConstraints, obj.formatConstraintsCount, relocator);
+    RelocateTraits<VkBufferCollectionConstraintsInfoFUCHSIA>::relocate(obj.bufferCollectionConstraints, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImageCopy2>::relocate(VkImageCopy2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageCreateInfo>::relocate(VkImageCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pQueueFamilyIndices, obj.queueFamilyIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkImageDrmFormatModifierExplicitCreateInfoEXT>::relocate(VkImageDrmFormatModifierExplicitCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPlaneLayouts, obj.drmFormatModifierPlaneCount, relocator);
+  }
+
+  inline void RelocateTraits<VkImageDrmFormatModifierListCreateInfoEXT>::relocate(VkImageDrmFormatModifierListCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDrmFormatModifiers, obj.drmFormatModifierCount, relocator);
+  }
+
+  inline void RelocateTraits<VkImageDrmFormatModifierPropertiesEXT>::relocate(VkImageDrmFormatModifierPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkImageFormatConstraintsInfoFUCHSIA>::relocate(VkImageFormatConstraintsInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkImageCreateInfo>::relocate(obj.imageCreateInfo, relocator);
+    RelocateArray(obj.pColorSpaces, obj.colorSpaceCount, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImageFormatListCreateInfo>::relocate(VkImageFormatListCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewFormats, obj.viewFormatCount, relocator);
+  }
+
+  inline void RelocateTraits<VkImageFormatProperties2>::relocate(VkImageFormatProperties2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageMemoryBarrier>::relocate(VkImageMemoryBarrier& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageMemoryBarrier2>::relocate(VkImageMemoryBarrier2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageMemoryRequirementsInfo2>::relocate(VkImageMemoryRequirementsInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkImagePipeSurfaceCreateInfoFUCHSIA>::relocate(VkImagePipeSurfaceCreateInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImagePlaneMemoryRequirementsInfo>::relocate(VkImagePlaneMemoryRequirementsInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageResolve2>::relocate(VkImageResolve2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageSparseMemoryRequirementsInfo2>::relocate(VkImageSparseMemoryRequirementsInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageStencilUsageCreateInfo>::relocate(VkImageStencilUsageCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageSubresource2EXT>::relocate(VkImageSubresource2EXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageSwapchainCreateInfoKHR>::relocate(VkImageSwapchainCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewASTCDecodeModeEXT>::relocate(VkImageViewASTCDecodeModeEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewCaptureDescriptorDataInfoEXT>::relocate(VkImageViewCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewCreateInfo>::relocate(VkImageViewCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewMinLodCreateInfoEXT>::relocate(VkImageViewMinLodCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewSampleWeightCreateInfoQCOM>::relocate(VkImageViewSampleWeightCreateInfoQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewSlicedCreateInfoEXT>::relocate(VkImageViewSlicedCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImageViewUsageCreateInfo>::relocate(VkImageViewUsageCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkImportAndroidHardwareBufferInfoANDROID>::relocate(VkImportAndroidHardwareBufferInfoANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImportFenceFdInfoKHR>::relocate(VkImportFenceFdInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkImportFenceWin32HandleInfoKHR>::relocate(VkImportFenceWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkImportMemoryBufferCollectionFUCHSIA>::relocate(VkImportMemoryBufferCollectionFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImportMemoryFdInfoKHR>::relocate(VkImportMemoryFdInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkImportMemoryHostPointerInfoEXT>::relocate(VkImportMemoryHostPointerInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkImportMemoryWin32HandleInfoKHR>::relocate(VkImportMemoryWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkImportMemoryWin32HandleInfoNV>::relocate(VkImportMemoryWin32HandleInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkImportMemoryZirconHandleInfoFUCHSIA>::relocate(VkImportMemoryZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkImportMetalBufferInfoEXT>::relocate(VkImportMetalBufferInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkImportMetalIOSurfaceInfoEXT>::relocate(VkImportMetalIOSurfaceInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkImportMetalSharedEventInfoEXT>::relocate(VkImportMetalSharedEventInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkImportMetalTextureInfoEXT>::relocate(VkImportMetalTextureInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkImportSemaphoreFdInfoKHR>::relocate(VkImportSemaphoreFdInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkImportSemaphoreWin32HandleInfoKHR>::relocate(VkImportSemaphoreWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkImportSemaphoreZirconHandleInfoFUCHSIA>::relocate(VkImportSemaphoreZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkIndirectCommandsLayoutCreateInfoNV>::relocate(VkIndirectCommandsLayoutCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pTokens, obj.tokenCount, relocator);
+    RelocateArray(obj.pStreamStrides, obj.streamCount, relocator);
+  }
+
+  inline void RelocateTraits<VkIndirectCommandsLayoutTokenNV>::relocate(VkIndirectCommandsLayoutTokenNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pIndexTypes, obj.indexTypeCount, relocator);
+    RelocateArray(obj.pIndexTypeValues, obj.indexTypeCount, relocator);
+  }
+
+  inline void RelocateTraits<VkInitializePerformanceApiInfoINTEL>::relocate(VkInitializePerformanceApiInfoINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkInstanceCreateInfo>::relocate(VkInstanceCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pApplicationInfo, 1, relocator);
+    RelocateStringArray(obj.ppEnabledLayerNames, obj.enabledLayerCount, relocator);
+    RelocateStringArray(obj.ppEnabledExtensionNames, obj.enabledExtensionCount, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+  inline void RelocateTraits<VkMacOSSurfaceCreateInfoMVK>::relocate(VkMacOSSurfaceCreateInfoMVK& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkMappedMemoryRange>::relocate(VkMappedMemoryRange& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryAllocateFlagsInfo>::relocate(VkMemoryAllocateFlagsInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryAllocateInfo>::relocate(VkMemoryAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryBarrier>::relocate(VkMemoryBarrier& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryBarrier2>::relocate(VkMemoryBarrier2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryDedicatedAllocateInfo>::relocate(VkMemoryDedicatedAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryDedicatedRequirements>::relocate(VkMemoryDedicatedRequirements& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryFdPropertiesKHR>::relocate(VkMemoryFdPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  inline void RelocateTraits<VkMemoryGetAndroidHardwareBufferInfoANDROID>::relocate(VkMemoryGetAndroidHardwareBufferInfoANDROID& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkMemoryGetFdInfoKHR>::relocate(VkMemoryGetFdInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryGetRemoteAddressInfoNV>::relocate(VkMemoryGetRemoteAddressInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkMemoryGetWin32HandleInfoKHR>::relocate(VkMemoryGetWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkMemoryGetZirconHandleInfoFUCHSIA>::relocate(VkMemoryGetZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkMemoryHostPointerPropertiesEXT>::relocate(VkMemoryHostPointerPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryMapInfoKHR>::relocate(VkMemoryMapInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryOpaqueCaptureAddressAllocateInfo>::relocate(VkMemoryOpaqueCaptureAddressAllocateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryPriorityAllocateInfoEXT>::relocate(VkMemoryPriorityAllocateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryRequirements2>::relocate(VkMemoryRequirements2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMemoryUnmapInfoKHR>::relocate(VkMemoryUnmapInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkMemoryWin32HandlePropertiesKHR>::relocate(VkMemoryWin32HandlePropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkMemoryZirconHandlePropertiesFUCHSIA>::relocate(VkMemoryZirconHandlePropertiesFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  inline void RelocateTraits<VkMetalSurfaceCreateInfoEXT>::relocate(VkMetalSurfaceCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkMicromapBuildInfoEXT>::relocate(VkMicromapBuildInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pUsageCounts, obj.usageCountsCount, relocator);
+    RelocatePointerArray(obj.ppUsageCounts, obj.usageCountsCount, relocator);
+  }
+
+  inline void RelocateTraits<VkMicromapBuildSizesInfoEXT>::relocate(VkMicromapBuildSizesInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMicromapCreateInfoEXT>::relocate(VkMicromapCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMicromapVersionInfoEXT>::relocate(VkMicromapVersionInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pVersionData, 2 * VK_UUID_SIZE, relocator);
+  }
+
+  inline void RelocateTraits<VkMultisamplePropertiesEXT>::relocate(VkMultisamplePropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMultisampledRenderToSingleSampledInfoEXT>::relocate(VkMultisampledRenderToSingleSampledInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMultiviewPerViewAttributesInfoNVX>::relocate(VkMultiviewPerViewAttributesInfoNVX& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM>::relocate(VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPerViewRenderAreas, obj.perViewRenderAreaCount, relocator);
+  }
+
+  inline void RelocateTraits<VkMutableDescriptorTypeListEXT>::relocate(VkMutableDescriptorTypeListEXT& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pDescriptorTypes, obj.descriptorTypeCount, relocator);
+  }
+
+  inline void RelocateTraits<VkMutableDescriptorTypeCreateInfoEXT>::relocate(VkMutableDescriptorTypeCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pMutableDescriptorTypeLists, obj.mutableDescriptorTypeListCount, relocator);
+  }
+
+  inline void RelocateTraits<VkOpaqueCaptureDescriptorDataCreateInfoEXT>::relocate(VkOpaqueCaptureDescriptorDataCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkOpticalFlowExecuteInfoNV>::relocate(VkOpticalFlowExecuteInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkOpticalFlowImageFormatInfoNV>::relocate(VkOpticalFlowImageFormatInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkOpticalFlowImageFormatPropertiesNV>::relocate(VkOpticalFlowImageFormatPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkOpticalFlowSessionCreateInfoNV>::relocate(VkOpticalFlowSessionCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkOpticalFlowSessionCreatePrivateDataInfoNV>::relocate(VkOpticalFlowSessionCreatePrivateDataInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceConfigurationAcquireInfoINTEL>::relocate(VkPerformanceConfigurationAcquireInfoINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceCounterDescriptionKHR>::relocate(VkPerformanceCounterDescriptionKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceCounterKHR>::relocate(VkPerformanceCounterKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceMarkerInfoINTEL>::relocate(VkPerformanceMarkerInfoINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceOverrideInfoINTEL>::relocate(VkPerformanceOverrideInfoINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceQuerySubmitInfoKHR>::relocate(VkPerformanceQuerySubmitInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPerformanceStreamMarkerInfoINTEL>::relocate(VkPerformanceStreamMarkerInfoINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevice16BitStorageFeatures>::relocate(VkPhysicalDevice16BitStorageFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevice4444FormatsFeaturesEXT>::relocate(VkPhysicalDevice4444FormatsFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevice8BitStorageFeatures>::relocate(VkPhysicalDevice8BitStorageFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceASTCDecodeFeaturesEXT>::relocate(VkPhysicalDeviceASTCDecodeFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceAccelerationStructureFeaturesKHR>::relocate(VkPhysicalDeviceAccelerationStructureFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceAccelerationStructurePropertiesKHR>::relocate(VkPhysicalDeviceAccelerationStructurePropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceAddressBindingReportFeaturesEXT>::relocate(VkPhysicalDeviceAddressBindingReportFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceAmigoProfilingFeaturesSEC>::relocate(VkPhysicalDeviceAmigoProfilingFeaturesSEC& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT>::relocate(VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT>::relocate(VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT>::relocate(VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT>::relocate(VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT>::relocate(VkPhysicalDeviceBorderColorSwizzleFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceBufferDeviceAddressFeatures>::relocate(VkPhysicalDeviceBufferDeviceAddressFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>::relocate(VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI>::relocate(VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI>::relocate(VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCoherentMemoryFeaturesAMD>::relocate(VkPhysicalDeviceCoherentMemoryFeaturesAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceColorWriteEnableFeaturesEXT>::relocate(VkPhysicalDeviceColorWriteEnableFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>::relocate(VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceConditionalRenderingFeaturesEXT>::relocate(VkPhysicalDeviceConditionalRenderingFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceConservativeRasterizationPropertiesEXT>::relocate(VkPhysicalDeviceConservativeRasterizationPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCooperativeMatrixFeaturesNV>::relocate(VkPhysicalDeviceCooperativeMatrixFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCooperativeMatrixPropertiesNV>::relocate(VkPhysicalDeviceCooperativeMatrixPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCopyMemoryIndirectFeaturesNV>::relocate(VkPhysicalDeviceCopyMemoryIndirectFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCopyMemoryIndirectPropertiesNV>::relocate(VkPhysicalDeviceCopyMemoryIndirectPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCornerSampledImageFeaturesNV>::relocate(VkPhysicalDeviceCornerSampledImageFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCoverageReductionModeFeaturesNV>::relocate(VkPhysicalDeviceCoverageReductionModeFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCustomBorderColorFeaturesEXT>::relocate(VkPhysicalDeviceCustomBorderColorFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceCustomBorderColorPropertiesEXT>::relocate(VkPhysicalDeviceCustomBorderColorPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>::relocate(VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDepthClampZeroOneFeaturesEXT>::relocate(VkPhysicalDeviceDepthClampZeroOneFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDepthClipControlFeaturesEXT>::relocate(VkPhysicalDeviceDepthClipControlFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDepthClipEnableFeaturesEXT>::relocate(VkPhysicalDeviceDepthClipEnableFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDepthStencilResolveProperties>::relocate(VkPhysicalDeviceDepthStencilResolveProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT>::relocate(VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDescriptorBufferFeaturesEXT>::relocate(VkPhysicalDeviceDescriptorBufferFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDescriptorBufferPropertiesEXT>::relocate(VkPhysicalDeviceDescriptorBufferPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDescriptorIndexingFeatures>::relocate(VkPhysicalDeviceDescriptorIndexingFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDescriptorIndexingProperties>::relocate(VkPhysicalDeviceDescriptorIndexingProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE>::relocate(VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV>::relocate(VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV>::relocate(VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT>::relocate(VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDiagnosticsConfigFeaturesNV>::relocate(VkPhysicalDeviceDiagnosticsConfigFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDiscardRectanglePropertiesEXT>::relocate(VkPhysicalDeviceDiscardRectanglePropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkPhysicalDeviceDisplacementMicromapFeaturesNV>::relocate(VkPhysicalDeviceDisplacementMicromapFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkPhysicalDeviceDisplacementMicromapPropertiesNV>::relocate(VkPhysicalDeviceDisplacementMicromapPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkPhysicalDeviceDriverProperties>::relocate(VkPhysicalDeviceDriverProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDrmPropertiesEXT>::relocate(VkPhysicalDeviceDrmPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDynamicRenderingFeatures>::relocate(VkPhysicalDeviceDynamicRenderingFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT>::relocate(VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExclusiveScissorFeaturesNV>::relocate(VkPhysicalDeviceExclusiveScissorFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>::relocate(VkPhysicalDeviceExtendedDynamicState2FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExtendedDynamicState3FeaturesEXT>::relocate(VkPhysicalDeviceExtendedDynamicState3FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExtendedDynamicState3PropertiesEXT>::relocate(VkPhysicalDeviceExtendedDynamicState3PropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>::relocate(VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExternalBufferInfo>::relocate(VkPhysicalDeviceExternalBufferInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExternalFenceInfo>::relocate(VkPhysicalDeviceExternalFenceInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExternalImageFormatInfo>::relocate(VkPhysicalDeviceExternalImageFormatInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExternalMemoryHostPropertiesEXT>::relocate(VkPhysicalDeviceExternalMemoryHostPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV>::relocate(VkPhysicalDeviceExternalMemoryRDMAFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceExternalSemaphoreInfo>::relocate(VkPhysicalDeviceExternalSemaphoreInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFaultFeaturesEXT>::relocate(VkPhysicalDeviceFaultFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFeatures2>::relocate(VkPhysicalDeviceFeatures2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFloatControlsProperties>::relocate(VkPhysicalDeviceFloatControlsProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>::relocate(VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT>::relocate(VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>::relocate(VkPhysicalDeviceFragmentDensityMapFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>::relocate(VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM>::relocate(VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentDensityMapPropertiesEXT>::relocate(VkPhysicalDeviceFragmentDensityMapPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR>::relocate(VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR>::relocate(VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>::relocate(VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>::relocate(VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV>::relocate(VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>::relocate(VkPhysicalDeviceFragmentShadingRateFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShadingRateKHR>::relocate(VkPhysicalDeviceFragmentShadingRateKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceFragmentShadingRatePropertiesKHR>::relocate(VkPhysicalDeviceFragmentShadingRatePropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR>::relocate(VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>::relocate(VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT>::relocate(VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceGroupProperties>::relocate(VkPhysicalDeviceGroupProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceHostQueryResetFeatures>::relocate(VkPhysicalDeviceHostQueryResetFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceIDProperties>::relocate(VkPhysicalDeviceIDProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT>::relocate(VkPhysicalDeviceImage2DViewOf3DFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageCompressionControlFeaturesEXT>::relocate(VkPhysicalDeviceImageCompressionControlFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT>::relocate(VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageDrmFormatModifierInfoEXT>::relocate(VkPhysicalDeviceImageDrmFormatModifierInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pQueueFamilyIndices, obj.queueFamilyIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageFormatInfo2>::relocate(VkPhysicalDeviceImageFormatInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageProcessingFeaturesQCOM>::relocate(VkPhysicalDeviceImageProcessingFeaturesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageProcessingPropertiesQCOM>::relocate(VkPhysicalDeviceImageProcessingPropertiesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageRobustnessFeatures>::relocate(VkPhysicalDeviceImageRobustnessFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT>::relocate(VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageViewImageFormatInfoEXT>::relocate(VkPhysicalDeviceImageViewImageFormatInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImageViewMinLodFeaturesEXT>::relocate(VkPhysicalDeviceImageViewMinLodFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceImagelessFramebufferFeatures>::relocate(VkPhysicalDeviceImagelessFramebufferFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceIndexTypeUint8FeaturesEXT>::relocate(VkPhysicalDeviceIndexTypeUint8FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>::relocate(VkPhysicalDeviceInheritedViewportScissorFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceInlineUniformBlockFeatures>::relocate(VkPhysicalDeviceInlineUniformBlockFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceInlineUniformBlockProperties>::relocate(VkPhysicalDeviceInlineUniformBlockProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI>::relocate(VkPhysicalDeviceInvocationMaskFeaturesHUAWEI& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceLegacyDitheringFeaturesEXT>::relocate(VkPhysicalDeviceLegacyDitheringFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceLineRasterizationFeaturesEXT>::relocate(VkPhysicalDeviceLineRasterizationFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceLineRasterizationPropertiesEXT>::relocate(VkPhysicalDeviceLineRasterizationPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceLinearColorAttachmentFeaturesNV>::relocate(VkPhysicalDeviceLinearColorAttachmentFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMaintenance3Properties>::relocate(VkPhysicalDeviceMaintenance3Properties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMaintenance4Features>::relocate(VkPhysicalDeviceMaintenance4Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMaintenance4Properties>::relocate(VkPhysicalDeviceMaintenance4Properties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMemoryBudgetPropertiesEXT>::relocate(VkPhysicalDeviceMemoryBudgetPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMemoryDecompressionFeaturesNV>::relocate(VkPhysicalDeviceMemoryDecompressionFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMemoryDecompressionPropertiesNV>::relocate(VkPhysicalDeviceMemoryDecompressionPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMemoryPriorityFeaturesEXT>::relocate(VkPhysicalDeviceMemoryPriorityFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMemoryProperties2>::relocate(VkPhysicalDeviceMemoryProperties2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMeshShaderFeaturesEXT>::relocate(VkPhysicalDeviceMeshShaderFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMeshShaderFeaturesNV>::relocate(VkPhysicalDeviceMeshShaderFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMeshShaderPropertiesEXT>::relocate(VkPhysicalDeviceMeshShaderPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMeshShaderPropertiesNV>::relocate(VkPhysicalDeviceMeshShaderPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultiDrawFeaturesEXT>::relocate(VkPhysicalDeviceMultiDrawFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultiDrawPropertiesEXT>::relocate(VkPhysicalDeviceMultiDrawPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT>::relocate(VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultiviewFeatures>::relocate(VkPhysicalDeviceMultiviewFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM>::relocate(VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM>::relocate(VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMultiviewProperties>::relocate(VkPhysicalDeviceMultiviewProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT>::relocate(VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT>::relocate(VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceOpacityMicromapFeaturesEXT>::relocate(VkPhysicalDeviceOpacityMicromapFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceOpacityMicromapPropertiesEXT>::relocate(VkPhysicalDeviceOpacityMicromapPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceOpticalFlowFeaturesNV>::relocate(VkPhysicalDeviceOpticalFlowFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceOpticalFlowPropertiesNV>::relocate(VkPhysicalDeviceOpticalFlowPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePCIBusInfoPropertiesEXT>::relocate(VkPhysicalDevicePCIBusInfoPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT>::relocate(VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePerformanceQueryFeaturesKHR>::relocate(VkPhysicalDevicePerformanceQueryFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePerformanceQueryPropertiesKHR>::relocate(VkPhysicalDevicePerformanceQueryPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelineCreationCacheControlFeatures>::relocate(VkPhysicalDevicePipelineCreationCacheControlFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>::relocate(VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT>::relocate(VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelinePropertiesFeaturesEXT>::relocate(VkPhysicalDevicePipelinePropertiesFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelineProtectedAccessFeaturesEXT>::relocate(VkPhysicalDevicePipelineProtectedAccessFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelineRobustnessFeaturesEXT>::relocate(VkPhysicalDevicePipelineRobustnessFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePipelineRobustnessPropertiesEXT>::relocate(VkPhysicalDevicePipelineRobustnessPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePointClippingProperties>::relocate(VkPhysicalDevicePointClippingProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkPhysicalDevicePortabilitySubsetFeaturesKHR>::relocate(VkPhysicalDevicePortabilitySubsetFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkPhysicalDevicePortabilitySubsetPropertiesKHR>::relocate(VkPhysicalDevicePortabilitySubsetPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkPhysicalDevicePresentBarrierFeaturesNV>::relocate(VkPhysicalDevicePresentBarrierFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePresentIdFeaturesKHR>::relocate(VkPhysicalDevicePresentIdFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePresentWaitFeaturesKHR>::relocate(VkPhysicalDevicePresentWaitFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>::relocate(VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>::relocate(VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePrivateDataFeatures>::relocate(VkPhysicalDevicePrivateDataFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceProperties2>::relocate(VkPhysicalDeviceProperties2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceProtectedMemoryFeatures>::relocate(VkPhysicalDeviceProtectedMemoryFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceProtectedMemoryProperties>::relocate(VkPhysicalDeviceProtectedMemoryProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceProvokingVertexFeaturesEXT>::relocate(VkPhysicalDeviceProvokingVertexFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceProvokingVertexPropertiesEXT>::relocate(VkPhysicalDeviceProvokingVertexPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDevicePushDescriptorPropertiesKHR>::relocate(VkPhysicalDevicePushDescriptorPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>::relocate(VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT>::relocate(VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayQueryFeaturesKHR>::relocate(VkPhysicalDeviceRayQueryFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV>::relocate(VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV>::relocate(VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR>::relocate(VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>::relocate(VkPhysicalDeviceRayTracingMotionBlurFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>::relocate(VkPhysicalDeviceRayTracingPipelineFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingPipelinePropertiesKHR>::relocate(VkPhysicalDeviceRayTracingPipelinePropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR>::relocate(VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRayTracingPropertiesNV>::relocate(VkPhysicalDeviceRayTracingPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV>::relocate(VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRobustness2FeaturesEXT>::relocate(VkPhysicalDeviceRobustness2FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceRobustness2PropertiesEXT>::relocate(VkPhysicalDeviceRobustness2PropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSampleLocationsPropertiesEXT>::relocate(VkPhysicalDeviceSampleLocationsPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSamplerFilterMinmaxProperties>::relocate(VkPhysicalDeviceSamplerFilterMinmaxProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSamplerYcbcrConversionFeatures>::relocate(VkPhysicalDeviceSamplerYcbcrConversionFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceScalarBlockLayoutFeatures>::relocate(VkPhysicalDeviceScalarBlockLayoutFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>::relocate(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>::relocate(VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>::relocate(VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderAtomicInt64Features>::relocate(VkPhysicalDeviceShaderAtomicInt64Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderClockFeaturesKHR>::relocate(VkPhysicalDeviceShaderClockFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM>::relocate(VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM>::relocate(VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderCoreProperties2AMD>::relocate(VkPhysicalDeviceShaderCoreProperties2AMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderCorePropertiesAMD>::relocate(VkPhysicalDeviceShaderCorePropertiesAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderCorePropertiesARM>::relocate(VkPhysicalDeviceShaderCorePropertiesARM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>::relocate(VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderDrawParametersFeatures>::relocate(VkPhysicalDeviceShaderDrawParametersFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD>::relocate(VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderFloat16Int8Features>::relocate(VkPhysicalDeviceShaderFloat16Int8Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>::relocate(VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderImageFootprintFeaturesNV>::relocate(VkPhysicalDeviceShaderImageFootprintFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderIntegerDotProductFeatures>::relocate(VkPhysicalDeviceShaderIntegerDotProductFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderIntegerDotProductProperties>::relocate(VkPhysicalDeviceShaderIntegerDotProductProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>::relocate(VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT>::relocate(VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT>::relocate(VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderObjectFeaturesEXT>::relocate(VkPhysicalDeviceShaderObjectFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderObjectPropertiesEXT>::relocate(VkPhysicalDeviceShaderObjectPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>::relocate(VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV>::relocate(VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>::relocate(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR>::relocate(VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderTerminateInvocationFeatures>::relocate(VkPhysicalDeviceShaderTerminateInvocationFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderTileImageFeaturesEXT>::relocate(VkPhysicalDeviceShaderTileImageFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShaderTileImagePropertiesEXT>::relocate(VkPhysicalDeviceShaderTileImagePropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShadingRateImageFeaturesNV>::relocate(VkPhysicalDeviceShadingRateImageFeaturesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceShadingRateImagePropertiesNV>::relocate(VkPhysicalDeviceShadingRateImagePropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSparseImageFormatInfo2>::relocate(VkPhysicalDeviceSparseImageFormatInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSubgroupProperties>::relocate(VkPhysicalDeviceSubgroupProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSubgroupSizeControlFeatures>::relocate(VkPhysicalDeviceSubgroupSizeControlFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSubgroupSizeControlProperties>::relocate(VkPhysicalDeviceSubgroupSizeControlProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT>::relocate(VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI>::relocate(VkPhysicalDeviceSubpassShadingFeaturesHUAWEI& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI>::relocate(VkPhysicalDeviceSubpassShadingPropertiesHUAWEI& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSurfaceInfo2KHR>::relocate(VkPhysicalDeviceSurfaceInfo2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT>::relocate(VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceSynchronization2Features>::relocate(VkPhysicalDeviceSynchronization2Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>::relocate(VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTexelBufferAlignmentProperties>::relocate(VkPhysicalDeviceTexelBufferAlignmentProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>::relocate(VkPhysicalDeviceTextureCompressionASTCHDRFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTilePropertiesFeaturesQCOM>::relocate(VkPhysicalDeviceTilePropertiesFeaturesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTimelineSemaphoreFeatures>::relocate(VkPhysicalDeviceTimelineSemaphoreFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTimelineSemaphoreProperties>::relocate(VkPhysicalDeviceTimelineSemaphoreProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceToolProperties>::relocate(VkPhysicalDeviceToolProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTransformFeedbackFeaturesEXT>::relocate(VkPhysicalDeviceTransformFeedbackFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceTransformFeedbackPropertiesEXT>::relocate(VkPhysicalDeviceTransformFeedbackPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>::relocate(VkPhysicalDeviceUniformBufferStandardLayoutFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVariablePointersFeatures>::relocate(VkPhysicalDeviceVariablePointersFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>::relocate(VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT>::relocate(VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>::relocate(VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>::relocate(VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pVideoProfile, 1, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkPhysicalDeviceVideoFormatInfoKHR>::relocate(VkPhysicalDeviceVideoFormatInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkan11Features>::relocate(VkPhysicalDeviceVulkan11Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkan11Properties>::relocate(VkPhysicalDeviceVulkan11Properties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkan12Features>::relocate(VkPhysicalDeviceVulkan12Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkan12Properties>::relocate(VkPhysicalDeviceVulkan12Properties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkan13Features>::relocate(VkPhysicalDeviceVulkan13Features& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkan13Properties>::relocate(VkPhysicalDeviceVulkan13Properties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceVulkanMemoryModelFeatures>::relocate(VkPhysicalDeviceVulkanMemoryModelFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>::relocate(VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT>::relocate(VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>::relocate(VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>::relocate(VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineCacheCreateInfo>::relocate(VkPipelineCacheCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pInitialData, obj.initialDataSize);
+  }
+
+  inline void RelocateTraits<VkPipelineColorBlendAdvancedStateCreateInfoEXT>::relocate(VkPipelineColorBlendAdvancedStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineColorBlendStateCreateInfo>::relocate(VkPipelineColorBlendStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachments, obj.attachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineColorWriteCreateInfoEXT>::relocate(VkPipelineColorWriteCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pColorWriteEnables, obj.attachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineCompilerControlCreateInfoAMD>::relocate(VkPipelineCompilerControlCreateInfoAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineCoverageModulationStateCreateInfoNV>::relocate(VkPipelineCoverageModulationStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pCoverageModulationTable, obj.coverageModulationTableCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineCoverageReductionStateCreateInfoNV>::relocate(VkPipelineCoverageReductionStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineCoverageToColorStateCreateInfoNV>::relocate(VkPipelineCoverageToColorStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineCreationFeedbackCreateInfo>::relocate(VkPipelineCreationFeedbackCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPipelineCreationFeedback, 1, relocator);
+    RelocateArray(obj.pPipelineStageCreationFeedbacks, obj.pipelineStageCreationFeedbackCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineDepthStencilStateCreateInfo>::relocate(VkPipelineDepthStencilStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineDiscardRectangleStateCreateInfoEXT>::relocate(VkPipelineDiscardRectangleStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDiscardRectangles, obj.discardRectangleCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineDynamicStateCreateInfo>::relocate(VkPipelineDynamicStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDynamicStates, obj.dynamicStateCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineExecutableInfoKHR>::relocate(VkPipelineExecutableInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineExecutableInternalRepresentationKHR>::relocate(VkPipelineExecutableInternalRepresentationKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pData, obj.dataSize);
+  }
+
+  inline void RelocateTraits<VkPipelineExecutablePropertiesKHR>::relocate(VkPipelineExecutablePropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineExecutableStatisticKHR>::relocate(VkPipelineExecutableStatisticKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineFragmentShadingRateEnumStateCreateInfoNV>::relocate(VkPipelineFragmentShadingRateEnumStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineFragmentShadingRateStateCreateInfoKHR>::relocate(VkPipelineFragmentShadingRateStateCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineInfoKHR>::relocate(VkPipelineInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineInputAssemblyStateCreateInfo>::relocate(VkPipelineInputAssemblyStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineLayoutCreateInfo>::relocate(VkPipelineLayoutCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSetLayouts, obj.setLayoutCount, relocator);
+    RelocateArray(obj.pPushConstantRanges, obj.pushConstantRangeCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineLibraryCreateInfoKHR>::relocate(VkPipelineLibraryCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pLibraries, obj.libraryCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineMultisampleStateCreateInfo>::relocate(VkPipelineMultisampleStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSampleMask, (obj.rasterizationSamples + 31) / 32, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelinePropertiesIdentifierEXT>::relocate(VkPipelinePropertiesIdentifierEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationConservativeStateCreateInfoEXT>::relocate(VkPipelineRasterizationConservativeStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationDepthClipStateCreateInfoEXT>::relocate(VkPipelineRasterizationDepthClipStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationLineStateCreateInfoEXT>::relocate(VkPipelineRasterizationLineStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT>::relocate(VkPipelineRasterizationProvokingVertexStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationStateCreateInfo>::relocate(VkPipelineRasterizationStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationStateRasterizationOrderAMD>::relocate(VkPipelineRasterizationStateRasterizationOrderAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRasterizationStateStreamCreateInfoEXT>::relocate(VkPipelineRasterizationStateStreamCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRenderingCreateInfo>::relocate(VkPipelineRenderingCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pColorAttachmentFormats, obj.colorAttachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRepresentativeFragmentTestStateCreateInfoNV>::relocate(VkPipelineRepresentativeFragmentTestStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineRobustnessCreateInfoEXT>::relocate(VkPipelineRobustnessCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineSampleLocationsStateCreateInfoEXT>::relocate(VkPipelineSampleLocationsStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkSampleLocationsInfoEXT>::relocate(obj.sampleLocationsInfo, relocator);
+  }
+
+  inline void RelocateTraits<VkSpecializationInfo>::relocate(VkSpecializationInfo& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pMapEntries, obj.mapEntryCount, relocator);
+    relocator.relocate<std::byte>(obj.pData, obj.dataSize);
+  }
+
+  inline void RelocateTraits<VkPipelineShaderStageCreateInfo>::relocate(VkPipelineShaderStageCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.string(obj.pName);
+    RelocateArray(obj.pSpecializationInfo, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>::relocate(VkPipelineShaderStageModuleIdentifierCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pIdentifier, obj.identifierSize, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo>::relocate(VkPipelineShaderStageRequiredSubgroupSizeCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineTessellationDomainOriginStateCreateInfo>::relocate(VkPipelineTessellationDomainOriginStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineTessellationStateCreateInfo>::relocate(VkPipelineTessellationStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineVertexInputDivisorStateCreateInfoEXT>::relocate(VkPipelineVertexInputDivisorStateCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pVertexBindingDivisors, obj.vertexBindingDivisorCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineVertexInputStateCreateInfo>::relocate(VkPipelineVertexInputStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pVertexBindingDescriptions, obj.vertexBindingDescriptionCount, relocator);
+    RelocateArray(obj.pVertexAttributeDescriptions, obj.vertexAttributeDescriptionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkCoarseSampleOrderCustomNV>::relocate(VkCoarseSampleOrderCustomNV& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pSampleLocations, obj.sampleLocationCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>::relocate(VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pCustomSampleOrders, obj.customSampleOrderCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportDepthClipControlCreateInfoEXT>::relocate(VkPipelineViewportDepthClipControlCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportExclusiveScissorStateCreateInfoNV>::relocate(VkPipelineViewportExclusiveScissorStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pExclusiveScissors, obj.exclusiveScissorCount, relocator);
+  }
+
+  inline void RelocateTraits<VkShadingRatePaletteNV>::relocate(VkShadingRatePaletteNV& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pShadingRatePaletteEntries, obj.shadingRatePaletteEntryCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportShadingRateImageStateCreateInfoNV>::relocate(VkPipelineViewportShadingRateImageStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pShadingRatePalettes, obj.viewportCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportStateCreateInfo>::relocate(VkPipelineViewportStateCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewports, obj.viewportCount, relocator);
+    RelocateArray(obj.pScissors, obj.scissorCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportSwizzleStateCreateInfoNV>::relocate(VkPipelineViewportSwizzleStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewportSwizzles, obj.viewportCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPipelineViewportWScalingStateCreateInfoNV>::relocate(VkPipelineViewportWScalingStateCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewportWScalings, obj.viewportCount, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_GGP
+  inline void RelocateTraits<VkPresentFrameTokenGGP>::relocate(VkPresentFrameTokenGGP& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkPresentIdKHR>::relocate(VkPresentIdKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPresentIds, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPresentInfoKHR>::relocate(VkPresentInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphores, obj.waitSemaphoreCount, relocator);
+    RelocateArray(obj.pSwapchains, obj.swapchainCount, relocator);
+    RelocateArray(obj.pImageIndices, obj.swapchainCount, relocator);
+    RelocateArray(obj.pResults, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPresentRegionKHR>::relocate(VkPresentRegionKHR& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pRectangles, obj.rectangleCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPresentRegionsKHR>::relocate(VkPresentRegionsKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPresentTimesInfoGOOGLE>::relocate(VkPresentTimesInfoGOOGLE& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pTimes, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkPrivateDataSlotCreateInfo>::relocate(VkPrivateDataSlotCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkProtectedSubmitInfo>::relocate(VkProtectedSubmitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueryLowLatencySupportNV>::relocate(VkQueryLowLatencySupportNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueryPoolCreateInfo>::relocate(VkQueryPoolCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueryPoolPerformanceCreateInfoKHR>::relocate(VkQueryPoolPerformanceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pCounterIndices, obj.counterIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkQueryPoolPerformanceQueryCreateInfoINTEL>::relocate(VkQueryPoolPerformanceQueryCreateInfoINTEL& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkQueryPoolVideoEncodeFeedbackCreateInfoKHR>::relocate(VkQueryPoolVideoEncodeFeedbackCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkQueueFamilyCheckpointProperties2NV>::relocate(VkQueueFamilyCheckpointProperties2NV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueueFamilyCheckpointPropertiesNV>::relocate(VkQueueFamilyCheckpointPropertiesNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueueFamilyGlobalPriorityPropertiesKHR>::relocate(VkQueueFamilyGlobalPriorityPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueueFamilyProperties2>::relocate(VkQueueFamilyProperties2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueueFamilyQueryResultStatusPropertiesKHR>::relocate(VkQueueFamilyQueryResultStatusPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkQueueFamilyVideoPropertiesKHR>::relocate(VkQueueFamilyVideoPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRayTracingPipelineCreateInfoKHR>::relocate(VkRayTracingPipelineCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pStages, obj.stageCount, relocator);
+    RelocateArray(obj.pGroups, obj.groupCount, relocator);
+    RelocateArray(obj.pLibraryInfo, 1, relocator);
+    RelocateArray(obj.pLibraryInterface, 1, relocator);
+    RelocateArray(obj.pDynamicState, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkRayTracingPipelineCreateInfoNV>::relocate(VkRayTracingPipelineCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pStages, obj.stageCount, relocator);
+    RelocateArray(obj.pGroups, obj.groupCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRayTracingPipelineInterfaceCreateInfoKHR>::relocate(VkRayTracingPipelineInterfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRayTracingShaderGroupCreateInfoKHR>::relocate(VkRayTracingShaderGroupCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRayTracingShaderGroupCreateInfoNV>::relocate(VkRayTracingShaderGroupCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkReleaseSwapchainImagesInfoEXT>::relocate(VkReleaseSwapchainImagesInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pImageIndices, obj.imageIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassAttachmentBeginInfo>::relocate(VkRenderPassAttachmentBeginInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachments, obj.attachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassBeginInfo>::relocate(VkRenderPassBeginInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pClearValues, obj.clearValueCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassDescription>::relocate(VkSubpassDescription& obj, PointerRelocator& relocator) {
+    RelocateArray(obj.pInputAttachments, obj.inputAttachmentCount, relocator);
+    RelocateArray(obj.pColorAttachments, obj.colorAttachmentCount, relocator);
+    RelocateArray(obj.pResolveAttachments, obj.colorAttachmentCount, relocator);
+    RelocateArray(obj.pDepthStencilAttachment, 1, relocator);
+    RelocateArray(obj.pPreserveAttachments, obj.preserveAttachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassCreateInfo>::relocate(VkRenderPassCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachments, obj.attachmentCount, relocator);
+    RelocateArray(obj.pSubpasses, obj.subpassCount, relocator);
+    RelocateArray(obj.pDependencies, obj.dependencyCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassCreateInfo2>::relocate(VkRenderPassCreateInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachments, obj.attachmentCount, relocator);
+    RelocateArray(obj.pSubpasses, obj.subpassCount, relocator);
+    RelocateArray(obj.pDependencies, obj.dependencyCount, relocator);
+    RelocateArray(obj.pCorrelatedViewMasks, obj.correlatedViewMaskCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassCreationControlEXT>::relocate(VkRenderPassCreationControlEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassCreationFeedbackCreateInfoEXT>::relocate(VkRenderPassCreationFeedbackCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRenderPassFeedback, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassFragmentDensityMapCreateInfoEXT>::relocate(VkRenderPassFragmentDensityMapCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassInputAttachmentAspectCreateInfo>::relocate(VkRenderPassInputAttachmentAspectCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAspectReferences, obj.aspectReferenceCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassMultiviewCreateInfo>::relocate(VkRenderPassMultiviewCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pViewMasks, obj.subpassCount, relocator);
+    RelocateArray(obj.pViewOffsets, obj.dependencyCount, relocator);
+    RelocateArray(obj.pCorrelationMasks, obj.correlationMaskCount, relocator);
+  }
+
+  inline void RelocateTraits<VkAttachmentSampleLocationsEXT>::relocate(VkAttachmentSampleLocationsEXT& obj, PointerRelocator& relocator) {
+    RelocateTraits<VkSampleLocationsInfoEXT>::relocate(obj.sampleLocationsInfo, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassSampleLocationsEXT>::relocate(VkSubpassSampleLocationsEXT& obj, PointerRelocator& relocator) {
+    RelocateTraits<VkSampleLocationsInfoEXT>::relocate(obj.sampleLocationsInfo, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassSampleLocationsBeginInfoEXT>::relocate(VkRenderPassSampleLocationsBeginInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAttachmentInitialSampleLocations, obj.attachmentInitialSampleLocationsCount, relocator);
+    RelocateArray(obj.pPostSubpassSampleLocations, obj.postSubpassSampleLocationsCount, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassSubpassFeedbackCreateInfoEXT>::relocate(VkRenderPassSubpassFeedbackCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSubpassFeedback, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderPassTransformBeginInfoQCOM>::relocate(VkRenderPassTransformBeginInfoQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderingAttachmentInfo>::relocate(VkRenderingAttachmentInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderingFragmentDensityMapAttachmentInfoEXT>::relocate(VkRenderingFragmentDensityMapAttachmentInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderingFragmentShadingRateAttachmentInfoKHR>::relocate(VkRenderingFragmentShadingRateAttachmentInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkRenderingInfo>::relocate(VkRenderingInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pColorAttachments, obj.colorAttachmentCount, relocator);
+    RelocateArray(obj.pDepthAttachment, 1, relocator);
+    RelocateArray(obj.pStencilAttachment, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkResolveImageInfo2>::relocate(VkResolveImageInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pRegions, obj.regionCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSampleLocationsInfoEXT>::relocate(VkSampleLocationsInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSampleLocations, obj.sampleLocationsCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerBorderColorComponentMappingCreateInfoEXT>::relocate(VkSamplerBorderColorComponentMappingCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerCaptureDescriptorDataInfoEXT>::relocate(VkSamplerCaptureDescriptorDataInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerCreateInfo>::relocate(VkSamplerCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerCustomBorderColorCreateInfoEXT>::relocate(VkSamplerCustomBorderColorCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerReductionModeCreateInfo>::relocate(VkSamplerReductionModeCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerYcbcrConversionCreateInfo>::relocate(VkSamplerYcbcrConversionCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerYcbcrConversionImageFormatProperties>::relocate(VkSamplerYcbcrConversionImageFormatProperties& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSamplerYcbcrConversionInfo>::relocate(VkSamplerYcbcrConversionInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+  inline void RelocateTraits<VkScreenSurfaceCreateInfoQNX>::relocate(VkScreenSurfaceCreateInfoQNX& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkSemaphoreCreateInfo>::relocate(VkSemaphoreCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSemaphoreGetFdInfoKHR>::relocate(VkSemaphoreGetFdInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkSemaphoreGetWin32HandleInfoKHR>::relocate(VkSemaphoreGetWin32HandleInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkSemaphoreGetZirconHandleInfoFUCHSIA>::relocate(VkSemaphoreGetZirconHandleInfoFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkSemaphoreSignalInfo>::relocate(VkSemaphoreSignalInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSemaphoreSubmitInfo>::relocate(VkSemaphoreSubmitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSemaphoreTypeCreateInfo>::relocate(VkSemaphoreTypeCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSemaphoreWaitInfo>::relocate(VkSemaphoreWaitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSemaphores, obj.semaphoreCount, relocator);
+    RelocateArray(obj.pValues, obj.semaphoreCount, relocator);
+  }
+
+  inline void RelocateTraits<VkShaderCreateInfoEXT>::relocate(VkShaderCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pCode, obj.codeSize);
+    relocator.string(obj.pName);
+    RelocateArray(obj.pSetLayouts, obj.setLayoutCount, relocator);
+    RelocateArray(obj.pPushConstantRanges, obj.pushConstantRangeCount, relocator);
+    RelocateArray(obj.pSpecializationInfo, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkShaderModuleCreateInfo>::relocate(VkShaderModuleCreateInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pCode, obj.codeSize / 4, relocator);
+  }
+
+  inline void RelocateTraits<VkShaderModuleIdentifierEXT>::relocate(VkShaderModuleIdentifierEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkShaderModuleValidationCacheCreateInfoEXT>::relocate(VkShaderModuleValidationCacheCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSharedPresentSurfaceCapabilitiesKHR>::relocate(VkSharedPresentSurfaceCapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSparseImageFormatProperties2>::relocate(VkSparseImageFormatProperties2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSparseImageMemoryRequirements2>::relocate(VkSparseImageMemoryRequirements2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_GGP
+  inline void RelocateTraits<VkStreamDescriptorSurfaceCreateInfoGGP>::relocate(VkStreamDescriptorSurfaceCreateInfoGGP& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkSubmitInfo>::relocate(VkSubmitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphores, obj.waitSemaphoreCount, relocator);
+    RelocateArray(obj.pWaitDstStageMask, obj.waitSemaphoreCount, relocator);
+    RelocateArray(obj.pCommandBuffers, obj.commandBufferCount, relocator);
+    RelocateArray(obj.pSignalSemaphores, obj.signalSemaphoreCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSubmitInfo2>::relocate(VkSubmitInfo2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphoreInfos, obj.waitSemaphoreInfoCount, relocator);
+    RelocateArray(obj.pCommandBufferInfos, obj.commandBufferInfoCount, relocator);
+    RelocateArray(obj.pSignalSemaphoreInfos, obj.signalSemaphoreInfoCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassBeginInfo>::relocate(VkSubpassBeginInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassDependency2>::relocate(VkSubpassDependency2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassDescription2>::relocate(VkSubpassDescription2& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pInputAttachments, obj.inputAttachmentCount, relocator);
+    RelocateArray(obj.pColorAttachments, obj.colorAttachmentCount, relocator);
+    RelocateArray(obj.pResolveAttachments, obj.colorAttachmentCount, relocator);
+    RelocateArray(obj.pDepthStencilAttachment, 1, relocator);
+    RelocateArray(obj.pPreserveAttachments, obj.preserveAttachmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassDescriptionDepthStencilResolve>::relocate(VkSubpassDescriptionDepthStencilResolve& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDepthStencilResolveAttachment, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassEndInfo>::relocate(VkSubpassEndInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassFragmentDensityMapOffsetEndInfoQCOM>::relocate(VkSubpassFragmentDensityMapOffsetEndInfoQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pFragmentDensityOffsets, obj.fragmentDensityOffsetCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassResolvePerformanceQueryEXT>::relocate(VkSubpassResolvePerformanceQueryEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSubpassShadingPipelineCreateInfoHUAWEI>::relocate(VkSubpassShadingPipelineCreateInfoHUAWEI& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSubresourceLayout2EXT>::relocate(VkSubresourceLayout2EXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSurfaceCapabilities2EXT>::relocate(VkSurfaceCapabilities2EXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSurfaceCapabilities2KHR>::relocate(VkSurfaceCapabilities2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkSurfaceCapabilitiesFullScreenExclusiveEXT>::relocate(VkSurfaceCapabilitiesFullScreenExclusiveEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkSurfaceCapabilitiesPresentBarrierNV>::relocate(VkSurfaceCapabilitiesPresentBarrierNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSurfaceFormat2KHR>::relocate(VkSurfaceFormat2KHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkSurfaceFullScreenExclusiveInfoEXT>::relocate(VkSurfaceFullScreenExclusiveInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkSurfaceFullScreenExclusiveWin32InfoEXT>::relocate(VkSurfaceFullScreenExclusiveWin32InfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkSurfacePresentModeCompatibilityEXT>::relocate(VkSurfacePresentModeCompatibilityEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPresentModes, obj.presentModeCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSurfacePresentModeEXT>::relocate(VkSurfacePresentModeEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSurfacePresentScalingCapabilitiesEXT>::relocate(VkSurfacePresentScalingCapabilitiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSurfaceProtectedCapabilitiesKHR>::relocate(VkSurfaceProtectedCapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainCounterCreateInfoEXT>::relocate(VkSwapchainCounterCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainCreateInfoKHR>::relocate(VkSwapchainCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pQueueFamilyIndices, obj.queueFamilyIndexCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainDisplayNativeHdrCreateInfoAMD>::relocate(VkSwapchainDisplayNativeHdrCreateInfoAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainPresentBarrierCreateInfoNV>::relocate(VkSwapchainPresentBarrierCreateInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainPresentFenceInfoEXT>::relocate(VkSwapchainPresentFenceInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pFences, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainPresentModeInfoEXT>::relocate(VkSwapchainPresentModeInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPresentModes, obj.swapchainCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainPresentModesCreateInfoEXT>::relocate(VkSwapchainPresentModesCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPresentModes, obj.presentModeCount, relocator);
+  }
+
+  inline void RelocateTraits<VkSwapchainPresentScalingCreateInfoEXT>::relocate(VkSwapchainPresentScalingCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  inline void RelocateTraits<VkSysmemColorSpaceFUCHSIA>::relocate(VkSysmemColorSpaceFUCHSIA& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkTextureLODGatherFormatPropertiesAMD>::relocate(VkTextureLODGatherFormatPropertiesAMD& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkTilePropertiesQCOM>::relocate(VkTilePropertiesQCOM& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkTimelineSemaphoreSubmitInfo>::relocate(VkTimelineSemaphoreSubmitInfo& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pWaitSemaphoreValues, obj.waitSemaphoreValueCount, relocator);
+    RelocateArray(obj.pSignalSemaphoreValues, obj.signalSemaphoreValueCount, relocator);
+  }
+
+  inline void RelocateTraits<VkValidationCacheCreateInfoEXT>::relocate(VkValidationCacheCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pInitialData, obj.initialDataSize);
+  }
+
+  inline void RelocateTraits<VkValidationFeaturesEXT>::relocate(VkValidationFeaturesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pEnabledValidationFeatures, obj.enabledValidationFeatureCount, relocator);
+    RelocateArray(obj.pDisabledValidationFeatures, obj.disabledValidationFeatureCount, relocator);
+  }
+
+  inline void RelocateTraits<VkValidationFlagsEXT>::relocate(VkValidationFlagsEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pDisabledValidationChecks, obj.disabledValidationCheckCount, relocator);
+  }
+
+  inline void RelocateTraits<VkVertexInputAttributeDescription2EXT>::relocate(VkVertexInputAttributeDescription2EXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVertexInputBindingDescription2EXT>::relocate(VkVertexInputBindingDescription2EXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_VI_NN
+  inline void RelocateTraits<VkViSurfaceCreateInfoNN>::relocate(VkViSurfaceCreateInfoNN& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkVideoBeginCodingInfoKHR>::relocate(VkVideoBeginCodingInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pReferenceSlots, obj.referenceSlotCount, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoCapabilitiesKHR>::relocate(VkVideoCapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoCodingControlInfoKHR>::relocate(VkVideoCodingControlInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeCapabilitiesKHR>::relocate(VkVideoDecodeCapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH264CapabilitiesKHR>::relocate(VkVideoDecodeH264CapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH264DpbSlotInfoKHR>::relocate(VkVideoDecodeH264DpbSlotInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH264PictureInfoKHR>::relocate(VkVideoDecodeH264PictureInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSliceOffsets, obj.sliceCount, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH264ProfileInfoKHR>::relocate(VkVideoDecodeH264ProfileInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH264SessionParametersAddInfoKHR>::relocate(VkVideoDecodeH264SessionParametersAddInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH264SessionParametersCreateInfoKHR>::relocate(VkVideoDecodeH264SessionParametersCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pParametersAddInfo, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH265CapabilitiesKHR>::relocate(VkVideoDecodeH265CapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH265DpbSlotInfoKHR>::relocate(VkVideoDecodeH265DpbSlotInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH265PictureInfoKHR>::relocate(VkVideoDecodeH265PictureInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pSliceSegmentOffsets, obj.sliceSegmentCount, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH265ProfileInfoKHR>::relocate(VkVideoDecodeH265ProfileInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH265SessionParametersAddInfoKHR>::relocate(VkVideoDecodeH265SessionParametersAddInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeH265SessionParametersCreateInfoKHR>::relocate(VkVideoDecodeH265SessionParametersCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pParametersAddInfo, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeInfoKHR>::relocate(VkVideoDecodeInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkVideoPictureResourceInfoKHR>::relocate(obj.dstPictureResource, relocator);
+    RelocateArray(obj.pSetupReferenceSlot, 1, relocator);
+    RelocateArray(obj.pReferenceSlots, obj.referenceSlotCount, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoDecodeUsageInfoKHR>::relocate(VkVideoDecodeUsageInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeCapabilitiesKHR>::relocate(VkVideoEncodeCapabilitiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264CapabilitiesEXT>::relocate(VkVideoEncodeH264CapabilitiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264DpbSlotInfoEXT>::relocate(VkVideoEncodeH264DpbSlotInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264GopRemainingFrameInfoEXT>::relocate(VkVideoEncodeH264GopRemainingFrameInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264NaluSliceInfoEXT>::relocate(VkVideoEncodeH264NaluSliceInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264PictureInfoEXT>::relocate(VkVideoEncodeH264PictureInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pNaluSliceEntries, obj.naluSliceEntryCount, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264ProfileInfoEXT>::relocate(VkVideoEncodeH264ProfileInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264QualityLevelPropertiesEXT>::relocate(VkVideoEncodeH264QualityLevelPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264RateControlInfoEXT>::relocate(VkVideoEncodeH264RateControlInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264RateControlLayerInfoEXT>::relocate(VkVideoEncodeH264RateControlLayerInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264SessionCreateInfoEXT>::relocate(VkVideoEncodeH264SessionCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264SessionParametersAddInfoEXT>::relocate(VkVideoEncodeH264SessionParametersAddInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264SessionParametersCreateInfoEXT>::relocate(VkVideoEncodeH264SessionParametersCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pParametersAddInfo, 1, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264SessionParametersFeedbackInfoEXT>::relocate(VkVideoEncodeH264SessionParametersFeedbackInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH264SessionParametersGetInfoEXT>::relocate(VkVideoEncodeH264SessionParametersGetInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265CapabilitiesEXT>::relocate(VkVideoEncodeH265CapabilitiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265DpbSlotInfoEXT>::relocate(VkVideoEncodeH265DpbSlotInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265GopRemainingFrameInfoEXT>::relocate(VkVideoEncodeH265GopRemainingFrameInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265NaluSliceSegmentInfoEXT>::relocate(VkVideoEncodeH265NaluSliceSegmentInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265PictureInfoEXT>::relocate(VkVideoEncodeH265PictureInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pNaluSliceSegmentEntries, obj.naluSliceSegmentEntryCount, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265ProfileInfoEXT>::relocate(VkVideoEncodeH265ProfileInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265QualityLevelPropertiesEXT>::relocate(VkVideoEncodeH265QualityLevelPropertiesEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265RateControlInfoEXT>::relocate(VkVideoEncodeH265RateControlInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265RateControlLayerInfoEXT>::relocate(VkVideoEncodeH265RateControlLayerInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265SessionCreateInfoEXT>::relocate(VkVideoEncodeH265SessionCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265SessionParametersAddInfoEXT>::relocate(VkVideoEncodeH265SessionParametersAddInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265SessionParametersCreateInfoEXT>::relocate(VkVideoEncodeH265SessionParametersCreateInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pParametersAddInfo, 1, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265SessionParametersFeedbackInfoEXT>::relocate(VkVideoEncodeH265SessionParametersFeedbackInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeH265SessionParametersGetInfoEXT>::relocate(VkVideoEncodeH265SessionParametersGetInfoEXT& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeInfoKHR>::relocate(VkVideoEncodeInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateTraits<VkVideoPictureResourceInfoKHR>::relocate(obj.srcPictureResource, relocator);
+    RelocateArray(obj.pSetupReferenceSlot, 1, relocator);
+    RelocateArray(obj.pReferenceSlots, obj.referenceSlotCount, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeQualityLevelInfoKHR>::relocate(VkVideoEncodeQualityLevelInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeQualityLevelPropertiesKHR>::relocate(VkVideoEncodeQualityLevelPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeRateControlInfoKHR>::relocate(VkVideoEncodeRateControlInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pLayers, obj.layerCount, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeRateControlLayerInfoKHR>::relocate(VkVideoEncodeRateControlLayerInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeSessionParametersFeedbackInfoKHR>::relocate(VkVideoEncodeSessionParametersFeedbackInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeSessionParametersGetInfoKHR>::relocate(VkVideoEncodeSessionParametersGetInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  inline void RelocateTraits<VkVideoEncodeUsageInfoKHR>::relocate(VkVideoEncodeUsageInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkVideoEndCodingInfoKHR>::relocate(VkVideoEndCodingInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoFormatPropertiesKHR>::relocate(VkVideoFormatPropertiesKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoPictureResourceInfoKHR>::relocate(VkVideoPictureResourceInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoProfileInfoKHR>::relocate(VkVideoProfileInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoProfileListInfoKHR>::relocate(VkVideoProfileListInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pProfiles, obj.profileCount, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoReferenceSlotInfoKHR>::relocate(VkVideoReferenceSlotInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pPictureResource, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoSessionCreateInfoKHR>::relocate(VkVideoSessionCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pVideoProfile, 1, relocator);
+    RelocateArray(obj.pStdHeaderVersion, 1, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoSessionMemoryRequirementsKHR>::relocate(VkVideoSessionMemoryRequirementsKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoSessionParametersCreateInfoKHR>::relocate(VkVideoSessionParametersCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+  inline void RelocateTraits<VkVideoSessionParametersUpdateInfoKHR>::relocate(VkVideoSessionParametersUpdateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+  inline void RelocateTraits<VkWaylandSurfaceCreateInfoKHR>::relocate(VkWaylandSurfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkWin32KeyedMutexAcquireReleaseInfoKHR>::relocate(VkWin32KeyedMutexAcquireReleaseInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAcquireSyncs, obj.acquireCount, relocator);
+    RelocateArray(obj.pAcquireKeys, obj.acquireCount, relocator);
+    RelocateArray(obj.pAcquireTimeouts, obj.acquireCount, relocator);
+    RelocateArray(obj.pReleaseSyncs, obj.releaseCount, relocator);
+    RelocateArray(obj.pReleaseKeys, obj.releaseCount, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkWin32KeyedMutexAcquireReleaseInfoNV>::relocate(VkWin32KeyedMutexAcquireReleaseInfoNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAcquireSyncs, obj.acquireCount, relocator);
+    RelocateArray(obj.pAcquireKeys, obj.acquireCount, relocator);
+    RelocateArray(obj.pAcquireTimeoutMilliseconds, obj.acquireCount, relocator);
+    RelocateArray(obj.pReleaseSyncs, obj.releaseCount, relocator);
+    RelocateArray(obj.pReleaseKeys, obj.releaseCount, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  inline void RelocateTraits<VkWin32SurfaceCreateInfoKHR>::relocate(VkWin32SurfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateTraits<VkWriteDescriptorSet>::relocate(VkWriteDescriptorSet& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pImageInfo, obj.descriptorCount, relocator);
+    RelocateArray(obj.pBufferInfo, obj.descriptorCount, relocator);
+    RelocateArray(obj.pTexelBufferView, obj.descriptorCount, relocator);
+  }
+
+  inline void RelocateTraits<VkWriteDescriptorSetAccelerationStructureKHR>::relocate(VkWriteDescriptorSetAccelerationStructureKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAccelerationStructures, obj.accelerationStructureCount, relocator);
+  }
+
+  inline void RelocateTraits<VkWriteDescriptorSetAccelerationStructureNV>::relocate(VkWriteDescriptorSetAccelerationStructureNV& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    RelocateArray(obj.pAccelerationStructures, obj.accelerationStructureCount, relocator);
+  }
+
+  inline void RelocateTraits<VkWriteDescriptorSetInlineUniformBlock>::relocate(VkWriteDescriptorSetInlineUniformBlock& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+    relocator.relocate<std::byte>(obj.pData, obj.dataSize);
+  }
+
+#ifdef VK_USE_PLATFORM_XCB_KHR
+  inline void RelocateTraits<VkXcbSurfaceCreateInfoKHR>::relocate(VkXcbSurfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+  inline void RelocateTraits<VkXlibSurfaceCreateInfoKHR>::relocate(VkXlibSurfaceCreateInfoKHR& obj, PointerRelocator& relocator) {
+    RelocateNext(obj.pNext, relocator);
+  }
+#endif
+
+  inline void RelocateNextStruct(uint32_t sType, const void*& pNext, PointerRelocator& relocator) {
+    switch (sType) {
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_BUILD_SIZES_INFO_KHR: return RelocateStruct<VkAccelerationStructureBuildSizesInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return RelocateStruct<VkAccelerationStructureCaptureDescriptorDataInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_KHR: return RelocateStruct<VkAccelerationStructureCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_CREATE_INFO_NV: return RelocateStruct<VkAccelerationStructureCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_DEVICE_ADDRESS_INFO_KHR: return RelocateStruct<VkAccelerationStructureDeviceAddressInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_AABBS_DATA_KHR: return RelocateStruct<VkAccelerationStructureGeometryAabbsDataKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_INSTANCES_DATA_KHR: return RelocateStruct<VkAccelerationStructureGeometryInstancesDataKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_MOTION_TRIANGLES_DATA_NV: return RelocateStruct<VkAccelerationStructureGeometryMotionTrianglesDataNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_GEOMETRY_TRIANGLES_DATA_KHR: return RelocateStruct<VkAccelerationStructureGeometryTrianglesDataKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_INFO_NV: return RelocateStruct<VkAccelerationStructureInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MEMORY_REQUIREMENTS_INFO_NV: return RelocateStruct<VkAccelerationStructureMemoryRequirementsInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_MOTION_INFO_NV: return RelocateStruct<VkAccelerationStructureMotionInfoNV>(pNext, relocator);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_DISPLACEMENT_MICROMAP_NV: return RelocateStruct<VkAccelerationStructureTrianglesDisplacementMicromapNV>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_TRIANGLES_OPACITY_MICROMAP_EXT: return RelocateStruct<VkAccelerationStructureTrianglesOpacityMicromapEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACCELERATION_STRUCTURE_VERSION_INFO_KHR: return RelocateStruct<VkAccelerationStructureVersionInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR: return RelocateStruct<VkAcquireNextImageInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ACQUIRE_PROFILING_LOCK_INFO_KHR: return RelocateStruct<VkAcquireProfilingLockInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_AMIGO_PROFILING_SUBMIT_INFO_SEC: return RelocateStruct<VkAmigoProfilingSubmitInfoSEC>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_2_ANDROID: return RelocateStruct<VkAndroidHardwareBufferFormatProperties2ANDROID>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID: return RelocateStruct<VkAndroidHardwareBufferFormatPropertiesANDROID>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID: return RelocateStruct<VkAndroidHardwareBufferPropertiesANDROID>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID: return RelocateStruct<VkAndroidHardwareBufferUsageANDROID>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_ANDROID_SURFACE_CREATE_INFO_KHR: return RelocateStruct<VkAndroidSurfaceCreateInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_APPLICATION_INFO: return RelocateStruct<VkApplicationInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2: return RelocateStruct<VkAttachmentDescription2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT: return RelocateStruct<VkAttachmentDescriptionStencilLayout>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2: return RelocateStruct<VkAttachmentReference2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT: return RelocateStruct<VkAttachmentReferenceStencilLayout>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_ATTACHMENT_SAMPLE_COUNT_INFO_AMD: return RelocateStruct<VkAttachmentSampleCountInfoAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_ACCELERATION_STRUCTURE_MEMORY_INFO_NV: return RelocateStruct<VkBindAccelerationStructureMemoryInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO: return RelocateStruct<VkBindBufferMemoryDeviceGroupInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO: return RelocateStruct<VkBindBufferMemoryInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO: return RelocateStruct<VkBindImageMemoryDeviceGroupInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO: return RelocateStruct<VkBindImageMemoryInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR: return RelocateStruct<VkBindImageMemorySwapchainInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO: return RelocateStruct<VkBindImagePlaneMemoryInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO: return RelocateStruct<VkBindSparseInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BIND_VIDEO_SESSION_MEMORY_INFO_KHR: return RelocateStruct<VkBindVideoSessionMemoryInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2: return RelocateStruct<VkBlitImageInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return RelocateStruct<VkBufferCaptureDescriptorDataInfoEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_BUFFER_CREATE_INFO_FUCHSIA: return RelocateStruct<VkBufferCollectionBufferCreateInfoFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CONSTRAINTS_INFO_FUCHSIA: return RelocateStruct<VkBufferCollectionConstraintsInfoFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_CREATE_INFO_FUCHSIA: return RelocateStruct<VkBufferCollectionCreateInfoFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_IMAGE_CREATE_INFO_FUCHSIA: return RelocateStruct<VkBufferCollectionImageCreateInfoFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_BUFFER_COLLECTION_PROPERTIES_FUCHSIA: return RelocateStruct<VkBufferCollectionPropertiesFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_BUFFER_CONSTRAINTS_INFO_FUCHSIA: return RelocateStruct<VkBufferConstraintsInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_BUFFER_COPY_2: return RelocateStruct<VkBufferCopy2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO: return RelocateStruct<VkBufferCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT: return RelocateStruct<VkBufferDeviceAddressCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO: return RelocateStruct<VkBufferDeviceAddressInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2: return RelocateStruct<VkBufferImageCopy2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER: return RelocateStruct<VkBufferMemoryBarrier>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2: return RelocateStruct<VkBufferMemoryBarrier2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2: return RelocateStruct<VkBufferMemoryRequirementsInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO: return RelocateStruct<VkBufferOpaqueCaptureAddressCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO: return RelocateStruct<VkBufferViewCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT: return RelocateStruct<VkCalibratedTimestampInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_2_NV: return RelocateStruct<VkCheckpointData2NV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_CHECKPOINT_DATA_NV: return RelocateStruct<VkCheckpointDataNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO: return RelocateStruct<VkCommandBufferAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT: return RelocateStruct<VkCommandBufferInheritanceConditionalRenderingInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO: return RelocateStruct<VkCommandBufferInheritanceInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM: return RelocateStruct<VkCommandBufferInheritanceRenderPassTransformInfoQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO: return RelocateStruct<VkCommandBufferInheritanceRenderingInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_VIEWPORT_SCISSOR_INFO_NV: return RelocateStruct<VkCommandBufferInheritanceViewportScissorInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO: return RelocateStruct<VkCommandBufferSubmitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO: return RelocateStruct<VkCommandPoolCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO: return RelocateStruct<VkComputePipelineCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_CONDITIONAL_RENDERING_BEGIN_INFO_EXT: return RelocateStruct<VkConditionalRenderingBeginInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COOPERATIVE_MATRIX_PROPERTIES_NV: return RelocateStruct<VkCooperativeMatrixPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_INFO_KHR: return RelocateStruct<VkCopyAccelerationStructureInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_ACCELERATION_STRUCTURE_TO_MEMORY_INFO_KHR: return RelocateStruct<VkCopyAccelerationStructureToMemoryInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2: return RelocateStruct<VkCopyBufferInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2: return RelocateStruct<VkCopyBufferToImageInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM: return RelocateStruct<VkCopyCommandTransformInfoQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET: return RelocateStruct<VkCopyDescriptorSet>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2: return RelocateStruct<VkCopyImageInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2: return RelocateStruct<VkCopyImageToBufferInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_ACCELERATION_STRUCTURE_INFO_KHR: return RelocateStruct<VkCopyMemoryToAccelerationStructureInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_MEMORY_TO_MICROMAP_INFO_EXT: return RelocateStruct<VkCopyMemoryToMicromapInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_MICROMAP_INFO_EXT: return RelocateStruct<VkCopyMicromapInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_COPY_MICROMAP_TO_MEMORY_INFO_EXT: return RelocateStruct<VkCopyMicromapToMemoryInfoEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR: return RelocateStruct<VkD3D12FenceSubmitInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_DEBUG_MARKER_MARKER_INFO_EXT: return RelocateStruct<VkDebugMarkerMarkerInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_NAME_INFO_EXT: return RelocateStruct<VkDebugMarkerObjectNameInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_MARKER_OBJECT_TAG_INFO_EXT: return RelocateStruct<VkDebugMarkerObjectTagInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT: return RelocateStruct<VkDebugReportCallbackCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT: return RelocateStruct<VkDebugUtilsLabelEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CALLBACK_DATA_EXT: return RelocateStruct<VkDebugUtilsMessengerCallbackDataEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT: return RelocateStruct<VkDebugUtilsMessengerCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_NAME_INFO_EXT: return RelocateStruct<VkDebugUtilsObjectNameInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEBUG_UTILS_OBJECT_TAG_INFO_EXT: return RelocateStruct<VkDebugUtilsObjectTagInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV: return RelocateStruct<VkDedicatedAllocationBufferCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV: return RelocateStruct<VkDedicatedAllocationImageCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV: return RelocateStruct<VkDedicatedAllocationMemoryAllocateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEPENDENCY_INFO: return RelocateStruct<VkDependencyInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT: return RelocateStruct<VkDescriptorAddressInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT: return RelocateStruct<VkDescriptorBufferBindingInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_PUSH_DESCRIPTOR_BUFFER_HANDLE_EXT: return RelocateStruct<VkDescriptorBufferBindingPushDescriptorBufferHandleEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO: return RelocateStruct<VkDescriptorPoolCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO: return RelocateStruct<VkDescriptorPoolInlineUniformBlockCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO: return RelocateStruct<VkDescriptorSetAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_BINDING_REFERENCE_VALVE: return RelocateStruct<VkDescriptorSetBindingReferenceVALVE>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO: return RelocateStruct<VkDescriptorSetLayoutBindingFlagsCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO: return RelocateStruct<VkDescriptorSetLayoutCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_HOST_MAPPING_INFO_VALVE: return RelocateStruct<VkDescriptorSetLayoutHostMappingInfoVALVE>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT: return RelocateStruct<VkDescriptorSetLayoutSupport>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO: return RelocateStruct<VkDescriptorSetVariableDescriptorCountAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT: return RelocateStruct<VkDescriptorSetVariableDescriptorCountLayoutSupport>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO: return RelocateStruct<VkDescriptorUpdateTemplateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_ADDRESS_BINDING_CALLBACK_DATA_EXT: return RelocateStruct<VkDeviceAddressBindingCallbackDataEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS: return RelocateStruct<VkDeviceBufferMemoryRequirements>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO: return RelocateStruct<VkDeviceCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT: return RelocateStruct<VkDeviceDeviceMemoryReportCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV: return RelocateStruct<VkDeviceDiagnosticsConfigCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_EVENT_INFO_EXT: return RelocateStruct<VkDeviceEventInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_FAULT_COUNTS_EXT: return RelocateStruct<VkDeviceFaultCountsEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO: return RelocateStruct<VkDeviceGroupBindSparseInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO: return RelocateStruct<VkDeviceGroupCommandBufferBeginInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: return RelocateStruct<VkDeviceGroupDeviceCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR: return RelocateStruct<VkDeviceGroupPresentCapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR: return RelocateStruct<VkDeviceGroupPresentInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO: return RelocateStruct<VkDeviceGroupRenderPassBeginInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO: return RelocateStruct<VkDeviceGroupSubmitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR: return RelocateStruct<VkDeviceGroupSwapchainCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS: return RelocateStruct<VkDeviceImageMemoryRequirements>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO: return RelocateStruct<VkDeviceMemoryOpaqueCaptureAddressInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD: return RelocateStruct<VkDeviceMemoryOverallocationCreateInfoAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_MEMORY_REPORT_CALLBACK_DATA_EXT: return RelocateStruct<VkDeviceMemoryReportCallbackDataEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO: return RelocateStruct<VkDevicePrivateDataCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO: return RelocateStruct<VkDeviceQueueCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_KHR: return RelocateStruct<VkDeviceQueueGlobalPriorityCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2: return RelocateStruct<VkDeviceQueueInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_INFO_LUNARG: return RelocateStruct<VkDirectDriverLoadingInfoLUNARG>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DIRECT_DRIVER_LOADING_LIST_LUNARG: return RelocateStruct<VkDirectDriverLoadingListLUNARG>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+      case VK_STRUCTURE_TYPE_DIRECTFB_SURFACE_CREATE_INFO_EXT: return RelocateStruct<VkDirectFBSurfaceCreateInfoEXT>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_DISPLAY_EVENT_INFO_EXT: return RelocateStruct<VkDisplayEventInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR: return RelocateStruct<VkDisplayModeCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR: return RelocateStruct<VkDisplayModeProperties2KHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD: return RelocateStruct<VkDisplayNativeHdrSurfaceCapabilitiesAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR: return RelocateStruct<VkDisplayPlaneCapabilities2KHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR: return RelocateStruct<VkDisplayPlaneInfo2KHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR: return RelocateStruct<VkDisplayPlaneProperties2KHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_POWER_INFO_EXT: return RelocateStruct<VkDisplayPowerInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR: return RelocateStruct<VkDisplayPresentInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR: return RelocateStruct<VkDisplayProperties2KHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR: return RelocateStruct<VkDisplaySurfaceCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_2_EXT: return RelocateStruct<VkDrmFormatModifierPropertiesList2EXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT: return RelocateStruct<VkDrmFormatModifierPropertiesListEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO: return RelocateStruct<VkEventCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO: return RelocateStruct<VkExportFenceCreateInfo>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkExportFenceWin32HandleInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO: return RelocateStruct<VkExportMemoryAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV: return RelocateStruct<VkExportMemoryAllocateInfoNV>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkExportMemoryWin32HandleInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV: return RelocateStruct<VkExportMemoryWin32HandleInfoNV>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_BUFFER_INFO_EXT: return RelocateStruct<VkExportMetalBufferInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_COMMAND_QUEUE_INFO_EXT: return RelocateStruct<VkExportMetalCommandQueueInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_DEVICE_INFO_EXT: return RelocateStruct<VkExportMetalDeviceInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_IO_SURFACE_INFO_EXT: return RelocateStruct<VkExportMetalIOSurfaceInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECT_CREATE_INFO_EXT: return RelocateStruct<VkExportMetalObjectCreateInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_OBJECTS_INFO_EXT: return RelocateStruct<VkExportMetalObjectsInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_SHARED_EVENT_INFO_EXT: return RelocateStruct<VkExportMetalSharedEventInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_EXPORT_METAL_TEXTURE_INFO_EXT: return RelocateStruct<VkExportMetalTextureInfoEXT>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO: return RelocateStruct<VkExportSemaphoreCreateInfo>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkExportSemaphoreWin32HandleInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES: return RelocateStruct<VkExternalBufferProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES: return RelocateStruct<VkExternalFenceProperties>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID: return RelocateStruct<VkExternalFormatANDROID>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES: return RelocateStruct<VkExternalImageFormatProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_ACQUIRE_UNMODIFIED_EXT: return RelocateStruct<VkExternalMemoryAcquireUnmodifiedEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO: return RelocateStruct<VkExternalMemoryBufferCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO: return RelocateStruct<VkExternalMemoryImageCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV: return RelocateStruct<VkExternalMemoryImageCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES: return RelocateStruct<VkExternalSemaphoreProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO: return RelocateStruct<VkFenceCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR: return RelocateStruct<VkFenceGetFdInfoKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_FENCE_GET_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkFenceGetWin32HandleInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT: return RelocateStruct<VkFilterCubicImageViewImageFormatPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2: return RelocateStruct<VkFormatProperties2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3: return RelocateStruct<VkFormatProperties3>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return RelocateStruct<VkFragmentShadingRateAttachmentInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO: return RelocateStruct<VkFramebufferAttachmentImageInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO: return RelocateStruct<VkFramebufferAttachmentsCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO: return RelocateStruct<VkFramebufferCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_FRAMEBUFFER_MIXED_SAMPLES_COMBINATION_NV: return RelocateStruct<VkFramebufferMixedSamplesCombinationNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_INFO_NV: return RelocateStruct<VkGeneratedCommandsInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GENERATED_COMMANDS_MEMORY_REQUIREMENTS_INFO_NV: return RelocateStruct<VkGeneratedCommandsMemoryRequirementsInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GEOMETRY_AABB_NV: return RelocateStruct<VkGeometryAABBNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GEOMETRY_NV: return RelocateStruct<VkGeometryNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GEOMETRY_TRIANGLES_NV: return RelocateStruct<VkGeometryTrianglesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO: return RelocateStruct<VkGraphicsPipelineCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT: return RelocateStruct<VkGraphicsPipelineLibraryCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV: return RelocateStruct<VkGraphicsPipelineShaderGroupsCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_GRAPHICS_SHADER_GROUP_CREATE_INFO_NV: return RelocateStruct<VkGraphicsShaderGroupCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_HDR_METADATA_EXT: return RelocateStruct<VkHdrMetadataEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT: return RelocateStruct<VkHeadlessSurfaceCreateInfoEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_IOS_MVK
+      case VK_STRUCTURE_TYPE_IOS_SURFACE_CREATE_INFO_MVK: return RelocateStruct<VkIOSSurfaceCreateInfoMVK>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMAGE_BLIT_2: return RelocateStruct<VkImageBlit2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return RelocateStruct<VkImageCaptureDescriptorDataInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_CONTROL_EXT: return RelocateStruct<VkImageCompressionControlEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_COMPRESSION_PROPERTIES_EXT: return RelocateStruct<VkImageCompressionPropertiesEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_IMAGE_CONSTRAINTS_INFO_FUCHSIA: return RelocateStruct<VkImageConstraintsInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMAGE_COPY_2: return RelocateStruct<VkImageCopy2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO: return RelocateStruct<VkImageCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT: return RelocateStruct<VkImageDrmFormatModifierExplicitCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT: return RelocateStruct<VkImageDrmFormatModifierListCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_PROPERTIES_EXT: return RelocateStruct<VkImageDrmFormatModifierPropertiesEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_IMAGE_FORMAT_CONSTRAINTS_INFO_FUCHSIA: return RelocateStruct<VkImageFormatConstraintsInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: return RelocateStruct<VkImageFormatListCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2: return RelocateStruct<VkImageFormatProperties2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER: return RelocateStruct<VkImageMemoryBarrier>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2: return RelocateStruct<VkImageMemoryBarrier2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2: return RelocateStruct<VkImageMemoryRequirementsInfo2>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_IMAGEPIPE_SURFACE_CREATE_INFO_FUCHSIA: return RelocateStruct<VkImagePipeSurfaceCreateInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO: return RelocateStruct<VkImagePlaneMemoryRequirementsInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2: return RelocateStruct<VkImageResolve2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2: return RelocateStruct<VkImageSparseMemoryRequirementsInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO: return RelocateStruct<VkImageStencilUsageCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_SUBRESOURCE_2_EXT: return RelocateStruct<VkImageSubresource2EXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR: return RelocateStruct<VkImageSwapchainCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT: return RelocateStruct<VkImageViewASTCDecodeModeEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return RelocateStruct<VkImageViewCaptureDescriptorDataInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO: return RelocateStruct<VkImageViewCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_MIN_LOD_CREATE_INFO_EXT: return RelocateStruct<VkImageViewMinLodCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_SAMPLE_WEIGHT_CREATE_INFO_QCOM: return RelocateStruct<VkImageViewSampleWeightCreateInfoQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_SLICED_CREATE_INFO_EXT: return RelocateStruct<VkImageViewSlicedCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO: return RelocateStruct<VkImageViewUsageCreateInfo>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return RelocateStruct<VkImportAndroidHardwareBufferInfoANDROID>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMPORT_FENCE_FD_INFO_KHR: return RelocateStruct<VkImportFenceFdInfoKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_IMPORT_FENCE_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkImportFenceWin32HandleInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_IMPORT_MEMORY_BUFFER_COLLECTION_FUCHSIA: return RelocateStruct<VkImportMemoryBufferCollectionFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR: return RelocateStruct<VkImportMemoryFdInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT: return RelocateStruct<VkImportMemoryHostPointerInfoEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkImportMemoryWin32HandleInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV: return RelocateStruct<VkImportMemoryWin32HandleInfoNV>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_IMPORT_MEMORY_ZIRCON_HANDLE_INFO_FUCHSIA: return RelocateStruct<VkImportMemoryZirconHandleInfoFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_IMPORT_METAL_BUFFER_INFO_EXT: return RelocateStruct<VkImportMetalBufferInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_IMPORT_METAL_IO_SURFACE_INFO_EXT: return RelocateStruct<VkImportMetalIOSurfaceInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_IMPORT_METAL_SHARED_EVENT_INFO_EXT: return RelocateStruct<VkImportMetalSharedEventInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_IMPORT_METAL_TEXTURE_INFO_EXT: return RelocateStruct<VkImportMetalTextureInfoEXT>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR: return RelocateStruct<VkImportSemaphoreFdInfoKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkImportSemaphoreWin32HandleInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_ZIRCON_HANDLE_INFO_FUCHSIA: return RelocateStruct<VkImportSemaphoreZirconHandleInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_CREATE_INFO_NV: return RelocateStruct<VkIndirectCommandsLayoutCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_INDIRECT_COMMANDS_LAYOUT_TOKEN_NV: return RelocateStruct<VkIndirectCommandsLayoutTokenNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_INITIALIZE_PERFORMANCE_API_INFO_INTEL: return RelocateStruct<VkInitializePerformanceApiInfoINTEL>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO: return RelocateStruct<VkInstanceCreateInfo>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+      case VK_STRUCTURE_TYPE_MACOS_SURFACE_CREATE_INFO_MVK: return RelocateStruct<VkMacOSSurfaceCreateInfoMVK>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE: return RelocateStruct<VkMappedMemoryRange>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO: return RelocateStruct<VkMemoryAllocateFlagsInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO: return RelocateStruct<VkMemoryAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_BARRIER: return RelocateStruct<VkMemoryBarrier>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2: return RelocateStruct<VkMemoryBarrier2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO: return RelocateStruct<VkMemoryDedicatedAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS: return RelocateStruct<VkMemoryDedicatedRequirements>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR: return RelocateStruct<VkMemoryFdPropertiesKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+      case VK_STRUCTURE_TYPE_MEMORY_GET_ANDROID_HARDWARE_BUFFER_INFO_ANDROID: return RelocateStruct<VkMemoryGetAndroidHardwareBufferInfoANDROID>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR: return RelocateStruct<VkMemoryGetFdInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_GET_REMOTE_ADDRESS_INFO_NV: return RelocateStruct<VkMemoryGetRemoteAddressInfoNV>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_MEMORY_GET_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkMemoryGetWin32HandleInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_MEMORY_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return RelocateStruct<VkMemoryGetZirconHandleInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT: return RelocateStruct<VkMemoryHostPointerPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_MAP_INFO_KHR: return RelocateStruct<VkMemoryMapInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO: return RelocateStruct<VkMemoryOpaqueCaptureAddressAllocateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT: return RelocateStruct<VkMemoryPriorityAllocateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2: return RelocateStruct<VkMemoryRequirements2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MEMORY_UNMAP_INFO_KHR: return RelocateStruct<VkMemoryUnmapInfoKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_MEMORY_WIN32_HANDLE_PROPERTIES_KHR: return RelocateStruct<VkMemoryWin32HandlePropertiesKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_MEMORY_ZIRCON_HANDLE_PROPERTIES_FUCHSIA: return RelocateStruct<VkMemoryZirconHandlePropertiesFUCHSIA>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+      case VK_STRUCTURE_TYPE_METAL_SURFACE_CREATE_INFO_EXT: return RelocateStruct<VkMetalSurfaceCreateInfoEXT>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_MICROMAP_BUILD_INFO_EXT: return RelocateStruct<VkMicromapBuildInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MICROMAP_BUILD_SIZES_INFO_EXT: return RelocateStruct<VkMicromapBuildSizesInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MICROMAP_CREATE_INFO_EXT: return RelocateStruct<VkMicromapCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MICROMAP_VERSION_INFO_EXT: return RelocateStruct<VkMicromapVersionInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MULTISAMPLE_PROPERTIES_EXT: return RelocateStruct<VkMultisamplePropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_INFO_EXT: return RelocateStruct<VkMultisampledRenderToSingleSampledInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_ATTRIBUTES_INFO_NVX: return RelocateStruct<VkMultiviewPerViewAttributesInfoNVX>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MULTIVIEW_PER_VIEW_RENDER_AREAS_RENDER_PASS_BEGIN_INFO_QCOM: return RelocateStruct<VkMultiviewPerViewRenderAreasRenderPassBeginInfoQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_EXT: return RelocateStruct<VkMutableDescriptorTypeCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_OPAQUE_CAPTURE_DESCRIPTOR_DATA_CREATE_INFO_EXT: return RelocateStruct<VkOpaqueCaptureDescriptorDataCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_OPTICAL_FLOW_EXECUTE_INFO_NV: return RelocateStruct<VkOpticalFlowExecuteInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_INFO_NV: return RelocateStruct<VkOpticalFlowImageFormatInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_OPTICAL_FLOW_IMAGE_FORMAT_PROPERTIES_NV: return RelocateStruct<VkOpticalFlowImageFormatPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_INFO_NV: return RelocateStruct<VkOpticalFlowSessionCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_OPTICAL_FLOW_SESSION_CREATE_PRIVATE_DATA_INFO_NV: return RelocateStruct<VkOpticalFlowSessionCreatePrivateDataInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_CONFIGURATION_ACQUIRE_INFO_INTEL: return RelocateStruct<VkPerformanceConfigurationAcquireInfoINTEL>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_DESCRIPTION_KHR: return RelocateStruct<VkPerformanceCounterDescriptionKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_COUNTER_KHR: return RelocateStruct<VkPerformanceCounterKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_MARKER_INFO_INTEL: return RelocateStruct<VkPerformanceMarkerInfoINTEL>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_OVERRIDE_INFO_INTEL: return RelocateStruct<VkPerformanceOverrideInfoINTEL>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR: return RelocateStruct<VkPerformanceQuerySubmitInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PERFORMANCE_STREAM_MARKER_INFO_INTEL: return RelocateStruct<VkPerformanceStreamMarkerInfoINTEL>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES: return RelocateStruct<VkPhysicalDevice16BitStorageFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT: return RelocateStruct<VkPhysicalDevice4444FormatsFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES: return RelocateStruct<VkPhysicalDevice8BitStorageFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceASTCDecodeFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceAccelerationStructureFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDeviceAccelerationStructurePropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ADDRESS_BINDING_REPORT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceAddressBindingReportFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_AMIGO_PROFILING_FEATURES_SEC: return RelocateStruct<VkPhysicalDeviceAmigoProfilingFeaturesSEC>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_DYNAMIC_STATE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceAttachmentFeedbackLoopDynamicStateFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ATTACHMENT_FEEDBACK_LOOP_LAYOUT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceAttachmentFeedbackLoopLayoutFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BORDER_COLOR_SWIZZLE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceBorderColorSwizzleFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES: return RelocateStruct<VkPhysicalDeviceBufferDeviceAddressFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceBufferDeviceAddressFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_FEATURES_HUAWEI: return RelocateStruct<VkPhysicalDeviceClusterCullingShaderFeaturesHUAWEI>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CLUSTER_CULLING_SHADER_PROPERTIES_HUAWEI: return RelocateStruct<VkPhysicalDeviceClusterCullingShaderPropertiesHUAWEI>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD: return RelocateStruct<VkPhysicalDeviceCoherentMemoryFeaturesAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COLOR_WRITE_ENABLE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceColorWriteEnableFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceComputeShaderDerivativesFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceConditionalRenderingFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceConservativeRasterizationPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceCooperativeMatrixFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceCooperativeMatrixPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceCopyMemoryIndirectFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COPY_MEMORY_INDIRECT_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceCopyMemoryIndirectPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceCornerSampledImageFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceCoverageReductionModeFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceCustomBorderColorFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceCustomBorderColorPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLAMP_ZERO_ONE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceDepthClampZeroOneFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceDepthClipControlFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceDepthClipEnableFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES: return RelocateStruct<VkPhysicalDeviceDepthStencilResolveProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_DENSITY_MAP_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceDescriptorBufferDensityMapPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceDescriptorBufferFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceDescriptorBufferPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES: return RelocateStruct<VkPhysicalDeviceDescriptorIndexingFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES: return RelocateStruct<VkPhysicalDeviceDescriptorIndexingProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_SET_HOST_MAPPING_FEATURES_VALVE: return RelocateStruct<VkPhysicalDeviceDescriptorSetHostMappingFeaturesVALVE>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceDeviceMemoryReportFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceDiagnosticsConfigFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceDiscardRectanglePropertiesEXT>(pNext, relocator);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceDisplacementMicromapFeaturesNV>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISPLACEMENT_MICROMAP_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceDisplacementMicromapPropertiesNV>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES: return RelocateStruct<VkPhysicalDeviceDriverProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceDrmPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES: return RelocateStruct<VkPhysicalDeviceDynamicRenderingFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_UNUSED_ATTACHMENTS_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceDynamicRenderingUnusedAttachmentsFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceExclusiveScissorFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceExtendedDynamicState2FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceExtendedDynamicState3FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceExtendedDynamicState3PropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceExtendedDynamicStateFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO: return RelocateStruct<VkPhysicalDeviceExternalBufferInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO: return RelocateStruct<VkPhysicalDeviceExternalFenceInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO: return RelocateStruct<VkPhysicalDeviceExternalImageFormatInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceExternalMemoryHostPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_RDMA_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceExternalMemoryRDMAFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO: return RelocateStruct<VkPhysicalDeviceExternalSemaphoreInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceFaultFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: return RelocateStruct<VkPhysicalDeviceFeatures2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES: return RelocateStruct<VkPhysicalDeviceFloatControlsProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceFragmentDensityMap2FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceFragmentDensityMap2PropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceFragmentDensityMapFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_FEATURES_QCOM: return RelocateStruct<VkPhysicalDeviceFragmentDensityMapOffsetFeaturesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_OFFSET_PROPERTIES_QCOM: return RelocateStruct<VkPhysicalDeviceFragmentDensityMapOffsetPropertiesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceFragmentDensityMapPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceFragmentShaderBarycentricFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDeviceFragmentShaderBarycentricPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceFragmentShadingRateFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_KHR: return RelocateStruct<VkPhysicalDeviceFragmentShadingRateKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDeviceFragmentShadingRatePropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GLOBAL_PRIORITY_QUERY_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceGlobalPriorityQueryFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES: return RelocateStruct<VkPhysicalDeviceGroupProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES: return RelocateStruct<VkPhysicalDeviceHostQueryResetFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES: return RelocateStruct<VkPhysicalDeviceIDProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_2D_VIEW_OF_3D_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceImage2DViewOf3DFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceImageCompressionControlFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT: return RelocateStruct<VkPhysicalDeviceImageDrmFormatModifierInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2: return RelocateStruct<VkPhysicalDeviceImageFormatInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_FEATURES_QCOM: return RelocateStruct<VkPhysicalDeviceImageProcessingFeaturesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_PROCESSING_PROPERTIES_QCOM: return RelocateStruct<VkPhysicalDeviceImageProcessingPropertiesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES: return RelocateStruct<VkPhysicalDeviceImageRobustnessFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_SLICED_VIEW_OF_3D_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceImageSlicedViewOf3DFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT: return RelocateStruct<VkPhysicalDeviceImageViewImageFormatInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_MIN_LOD_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceImageViewMinLodFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES: return RelocateStruct<VkPhysicalDeviceImagelessFramebufferFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceIndexTypeUint8FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INHERITED_VIEWPORT_SCISSOR_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceInheritedViewportScissorFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES: return RelocateStruct<VkPhysicalDeviceInlineUniformBlockFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES: return RelocateStruct<VkPhysicalDeviceInlineUniformBlockProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INVOCATION_MASK_FEATURES_HUAWEI: return RelocateStruct<VkPhysicalDeviceInvocationMaskFeaturesHUAWEI>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceLegacyDitheringFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceLineRasterizationFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceLineRasterizationPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINEAR_COLOR_ATTACHMENT_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceLinearColorAttachmentFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES: return RelocateStruct<VkPhysicalDeviceMaintenance3Properties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES: return RelocateStruct<VkPhysicalDeviceMaintenance4Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES: return RelocateStruct<VkPhysicalDeviceMaintenance4Properties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceMemoryBudgetPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceMemoryDecompressionFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_DECOMPRESSION_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceMemoryDecompressionPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceMemoryPriorityFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2: return RelocateStruct<VkPhysicalDeviceMemoryProperties2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceMeshShaderFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceMeshShaderFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceMeshShaderPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceMeshShaderPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceMultiDrawFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTI_DRAW_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceMultiDrawPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTISAMPLED_RENDER_TO_SINGLE_SAMPLED_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceMultisampledRenderToSingleSampledFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES: return RelocateStruct<VkPhysicalDeviceMultiviewFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_RENDER_AREAS_FEATURES_QCOM: return RelocateStruct<VkPhysicalDeviceMultiviewPerViewRenderAreasFeaturesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_VIEWPORTS_FEATURES_QCOM: return RelocateStruct<VkPhysicalDeviceMultiviewPerViewViewportsFeaturesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES: return RelocateStruct<VkPhysicalDeviceMultiviewProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceMutableDescriptorTypeFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_NON_SEAMLESS_CUBE_MAP_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceNonSeamlessCubeMapFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceOpacityMicromapFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPACITY_MICROMAP_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceOpacityMicromapPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceOpticalFlowFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_OPTICAL_FLOW_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceOpticalFlowPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDevicePCIBusInfoPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PAGEABLE_DEVICE_LOCAL_MEMORY_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePageableDeviceLocalMemoryFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR: return RelocateStruct<VkPhysicalDevicePerformanceQueryFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDevicePerformanceQueryPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES: return RelocateStruct<VkPhysicalDevicePipelineCreationCacheControlFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR: return RelocateStruct<VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_LIBRARY_GROUP_HANDLES_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePipelineLibraryGroupHandlesFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROPERTIES_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePipelinePropertiesFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePipelineProtectedAccessFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePipelineRobustnessFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_ROBUSTNESS_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDevicePipelineRobustnessPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES: return RelocateStruct<VkPhysicalDevicePointClippingProperties>(pNext, relocator);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR: return RelocateStruct<VkPhysicalDevicePortabilitySubsetFeaturesKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDevicePortabilitySubsetPropertiesKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_BARRIER_FEATURES_NV: return RelocateStruct<VkPhysicalDevicePresentBarrierFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR: return RelocateStruct<VkPhysicalDevicePresentIdFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR: return RelocateStruct<VkPhysicalDevicePresentWaitFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVE_TOPOLOGY_LIST_RESTART_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePrimitiveTopologyListRestartFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIMITIVES_GENERATED_QUERY_FEATURES_EXT: return RelocateStruct<VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES: return RelocateStruct<VkPhysicalDevicePrivateDataFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2: return RelocateStruct<VkPhysicalDeviceProperties2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES: return RelocateStruct<VkPhysicalDeviceProtectedMemoryFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES: return RelocateStruct<VkPhysicalDeviceProtectedMemoryProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceProvokingVertexFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROVOKING_VERTEX_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceProvokingVertexPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDevicePushDescriptorPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RGBA10X6_FORMATS_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceRGBA10X6FormatsFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceRayQueryFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceRayTracingInvocationReorderFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_INVOCATION_REORDER_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceRayTracingInvocationReorderPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MAINTENANCE_1_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceRayTracingMaintenance1FeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_MOTION_BLUR_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceRayTracingMotionBlurFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceRayTracingPipelineFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR: return RelocateStruct<VkPhysicalDeviceRayTracingPipelinePropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_POSITION_FETCH_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceRayTracingPositionFetchFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceRayTracingPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceRobustness2FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceRobustness2PropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceSampleLocationsPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES: return RelocateStruct<VkPhysicalDeviceSamplerFilterMinmaxProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES: return RelocateStruct<VkPhysicalDeviceSamplerYcbcrConversionFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES: return RelocateStruct<VkPhysicalDeviceScalarBlockLayoutFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES: return RelocateStruct<VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_2_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceShaderAtomicFloat2FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceShaderAtomicFloatFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderAtomicInt64Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceShaderClockFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_FEATURES_ARM: return RelocateStruct<VkPhysicalDeviceShaderCoreBuiltinsFeaturesARM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_BUILTINS_PROPERTIES_ARM: return RelocateStruct<VkPhysicalDeviceShaderCoreBuiltinsPropertiesARM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD: return RelocateStruct<VkPhysicalDeviceShaderCoreProperties2AMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD: return RelocateStruct<VkPhysicalDeviceShaderCorePropertiesAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_ARM: return RelocateStruct<VkPhysicalDeviceShaderCorePropertiesARM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderDrawParametersFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_EARLY_AND_LATE_FRAGMENT_TESTS_FEATURES_AMD: return RelocateStruct<VkPhysicalDeviceShaderEarlyAndLateFragmentTestsFeaturesAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderFloat16Int8Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceShaderImageFootprintFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderIntegerDotProductFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES: return RelocateStruct<VkPhysicalDeviceShaderIntegerDotProductProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL: return RelocateStruct<VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceShaderModuleIdentifierFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_MODULE_IDENTIFIER_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceShaderModuleIdentifierPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceShaderObjectFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceShaderObjectPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceShaderSMBuiltinsFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceShaderSMBuiltinsPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_UNIFORM_CONTROL_FLOW_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceShaderSubgroupUniformControlFlowFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES: return RelocateStruct<VkPhysicalDeviceShaderTerminateInvocationFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceShaderTileImageFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TILE_IMAGE_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceShaderTileImagePropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV: return RelocateStruct<VkPhysicalDeviceShadingRateImageFeaturesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV: return RelocateStruct<VkPhysicalDeviceShadingRateImagePropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2: return RelocateStruct<VkPhysicalDeviceSparseImageFormatInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES: return RelocateStruct<VkPhysicalDeviceSubgroupProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES: return RelocateStruct<VkPhysicalDeviceSubgroupSizeControlFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES: return RelocateStruct<VkPhysicalDeviceSubgroupSizeControlProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_MERGE_FEEDBACK_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceSubpassMergeFeedbackFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_FEATURES_HUAWEI: return RelocateStruct<VkPhysicalDeviceSubpassShadingFeaturesHUAWEI>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBPASS_SHADING_PROPERTIES_HUAWEI: return RelocateStruct<VkPhysicalDeviceSubpassShadingPropertiesHUAWEI>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR: return RelocateStruct<VkPhysicalDeviceSurfaceInfo2KHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES: return RelocateStruct<VkPhysicalDeviceSynchronization2Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES: return RelocateStruct<VkPhysicalDeviceTexelBufferAlignmentProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES: return RelocateStruct<VkPhysicalDeviceTextureCompressionASTCHDRFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TILE_PROPERTIES_FEATURES_QCOM: return RelocateStruct<VkPhysicalDeviceTilePropertiesFeaturesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES: return RelocateStruct<VkPhysicalDeviceTimelineSemaphoreFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES: return RelocateStruct<VkPhysicalDeviceTimelineSemaphoreProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES: return RelocateStruct<VkPhysicalDeviceToolProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceTransformFeedbackFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceTransformFeedbackPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES: return RelocateStruct<VkPhysicalDeviceUniformBufferStandardLayoutFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES: return RelocateStruct<VkPhysicalDeviceVariablePointersFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT: return RelocateStruct<VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_INPUT_DYNAMIC_STATE_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT>(pNext, relocator);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return RelocateStruct<VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VIDEO_FORMAT_INFO_KHR: return RelocateStruct<VkPhysicalDeviceVideoFormatInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES: return RelocateStruct<VkPhysicalDeviceVulkan11Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES: return RelocateStruct<VkPhysicalDeviceVulkan11Properties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: return RelocateStruct<VkPhysicalDeviceVulkan12Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES: return RelocateStruct<VkPhysicalDeviceVulkan12Properties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES: return RelocateStruct<VkPhysicalDeviceVulkan13Features>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES: return RelocateStruct<VkPhysicalDeviceVulkan13Properties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES: return RelocateStruct<VkPhysicalDeviceVulkanMemoryModelFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_WORKGROUP_MEMORY_EXPLICIT_LAYOUT_FEATURES_KHR: return RelocateStruct<VkPhysicalDeviceWorkgroupMemoryExplicitLayoutFeaturesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_2_PLANE_444_FORMATS_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceYcbcr2Plane444FormatsFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT: return RelocateStruct<VkPhysicalDeviceYcbcrImageArraysFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES: return RelocateStruct<VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO: return RelocateStruct<VkPipelineCacheCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineColorBlendAdvancedStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO: return RelocateStruct<VkPipelineColorBlendStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COLOR_WRITE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineColorWriteCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD: return RelocateStruct<VkPipelineCompilerControlCreateInfoAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineCoverageModulationStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineCoverageReductionStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineCoverageToColorStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO: return RelocateStruct<VkPipelineCreationFeedbackCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO: return RelocateStruct<VkPipelineDepthStencilStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineDiscardRectangleStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO: return RelocateStruct<VkPipelineDynamicStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INFO_KHR: return RelocateStruct<VkPipelineExecutableInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_INTERNAL_REPRESENTATION_KHR: return RelocateStruct<VkPipelineExecutableInternalRepresentationKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_PROPERTIES_KHR: return RelocateStruct<VkPipelineExecutablePropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_EXECUTABLE_STATISTIC_KHR: return RelocateStruct<VkPipelineExecutableStatisticKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineFragmentShadingRateEnumStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR: return RelocateStruct<VkPipelineFragmentShadingRateStateCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_INFO_KHR: return RelocateStruct<VkPipelineInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO: return RelocateStruct<VkPipelineInputAssemblyStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO: return RelocateStruct<VkPipelineLayoutCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR: return RelocateStruct<VkPipelineLibraryCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO: return RelocateStruct<VkPipelineMultisampleStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_PROPERTIES_IDENTIFIER_EXT: return RelocateStruct<VkPipelinePropertiesIdentifierEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineRasterizationConservativeStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineRasterizationDepthClipStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineRasterizationLineStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineRasterizationProvokingVertexStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO: return RelocateStruct<VkPipelineRasterizationStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD: return RelocateStruct<VkPipelineRasterizationStateRasterizationOrderAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT: return RelocateStruct<VkPipelineRasterizationStateStreamCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO: return RelocateStruct<VkPipelineRenderingCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineRepresentativeFragmentTestStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_ROBUSTNESS_CREATE_INFO_EXT: return RelocateStruct<VkPipelineRobustnessCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineSampleLocationsStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO: return RelocateStruct<VkPipelineShaderStageCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_MODULE_IDENTIFIER_CREATE_INFO_EXT: return RelocateStruct<VkPipelineShaderStageModuleIdentifierCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO: return RelocateStruct<VkPipelineShaderStageRequiredSubgroupSizeCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO: return RelocateStruct<VkPipelineTessellationDomainOriginStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO: return RelocateStruct<VkPipelineTessellationStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT: return RelocateStruct<VkPipelineVertexInputDivisorStateCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO: return RelocateStruct<VkPipelineVertexInputStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineViewportCoarseSampleOrderStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT: return RelocateStruct<VkPipelineViewportDepthClipControlCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineViewportExclusiveScissorStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineViewportShadingRateImageStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO: return RelocateStruct<VkPipelineViewportStateCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineViewportSwizzleStateCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV: return RelocateStruct<VkPipelineViewportWScalingStateCreateInfoNV>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_GGP
+      case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP: return RelocateStruct<VkPresentFrameTokenGGP>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_PRESENT_ID_KHR: return RelocateStruct<VkPresentIdKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR: return RelocateStruct<VkPresentInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR: return RelocateStruct<VkPresentRegionsKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE: return RelocateStruct<VkPresentTimesInfoGOOGLE>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO: return RelocateStruct<VkPrivateDataSlotCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO: return RelocateStruct<VkProtectedSubmitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUERY_LOW_LATENCY_SUPPORT_NV: return RelocateStruct<VkQueryLowLatencySupportNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO: return RelocateStruct<VkQueryPoolCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR: return RelocateStruct<VkQueryPoolPerformanceCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL: return RelocateStruct<VkQueryPoolPerformanceQueryCreateInfoINTEL>(pNext, relocator);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_QUERY_POOL_VIDEO_ENCODE_FEEDBACK_CREATE_INFO_KHR: return RelocateStruct<VkQueryPoolVideoEncodeFeedbackCreateInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_2_NV: return RelocateStruct<VkQueueFamilyCheckpointProperties2NV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV: return RelocateStruct<VkQueueFamilyCheckpointPropertiesNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUEUE_FAMILY_GLOBAL_PRIORITY_PROPERTIES_KHR: return RelocateStruct<VkQueueFamilyGlobalPriorityPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2: return RelocateStruct<VkQueueFamilyProperties2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUEUE_FAMILY_QUERY_RESULT_STATUS_PROPERTIES_KHR: return RelocateStruct<VkQueueFamilyQueryResultStatusPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_QUEUE_FAMILY_VIDEO_PROPERTIES_KHR: return RelocateStruct<VkQueueFamilyVideoPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_KHR: return RelocateStruct<VkRayTracingPipelineCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_CREATE_INFO_NV: return RelocateStruct<VkRayTracingPipelineCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RAY_TRACING_PIPELINE_INTERFACE_CREATE_INFO_KHR: return RelocateStruct<VkRayTracingPipelineInterfaceCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_KHR: return RelocateStruct<VkRayTracingShaderGroupCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RAY_TRACING_SHADER_GROUP_CREATE_INFO_NV: return RelocateStruct<VkRayTracingShaderGroupCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RELEASE_SWAPCHAIN_IMAGES_INFO_EXT: return RelocateStruct<VkReleaseSwapchainImagesInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO: return RelocateStruct<VkRenderPassAttachmentBeginInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO: return RelocateStruct<VkRenderPassBeginInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO: return RelocateStruct<VkRenderPassCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2: return RelocateStruct<VkRenderPassCreateInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_CONTROL_EXT: return RelocateStruct<VkRenderPassCreationControlEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_CREATION_FEEDBACK_CREATE_INFO_EXT: return RelocateStruct<VkRenderPassCreationFeedbackCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT: return RelocateStruct<VkRenderPassFragmentDensityMapCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO: return RelocateStruct<VkRenderPassInputAttachmentAspectCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO: return RelocateStruct<VkRenderPassMultiviewCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT: return RelocateStruct<VkRenderPassSampleLocationsBeginInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_SUBPASS_FEEDBACK_CREATE_INFO_EXT: return RelocateStruct<VkRenderPassSubpassFeedbackCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM: return RelocateStruct<VkRenderPassTransformBeginInfoQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO: return RelocateStruct<VkRenderingAttachmentInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_DENSITY_MAP_ATTACHMENT_INFO_EXT: return RelocateStruct<VkRenderingFragmentDensityMapAttachmentInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR: return RelocateStruct<VkRenderingFragmentShadingRateAttachmentInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RENDERING_INFO: return RelocateStruct<VkRenderingInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2: return RelocateStruct<VkResolveImageInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT: return RelocateStruct<VkSampleLocationsInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_BORDER_COLOR_COMPONENT_MAPPING_CREATE_INFO_EXT: return RelocateStruct<VkSamplerBorderColorComponentMappingCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_CAPTURE_DESCRIPTOR_DATA_INFO_EXT: return RelocateStruct<VkSamplerCaptureDescriptorDataInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO: return RelocateStruct<VkSamplerCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT: return RelocateStruct<VkSamplerCustomBorderColorCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO: return RelocateStruct<VkSamplerReductionModeCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO: return RelocateStruct<VkSamplerYcbcrConversionCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES: return RelocateStruct<VkSamplerYcbcrConversionImageFormatProperties>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: return RelocateStruct<VkSamplerYcbcrConversionInfo>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+      case VK_STRUCTURE_TYPE_SCREEN_SURFACE_CREATE_INFO_QNX: return RelocateStruct<VkScreenSurfaceCreateInfoQNX>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO: return RelocateStruct<VkSemaphoreCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR: return RelocateStruct<VkSemaphoreGetFdInfoKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_SEMAPHORE_GET_WIN32_HANDLE_INFO_KHR: return RelocateStruct<VkSemaphoreGetWin32HandleInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_SEMAPHORE_GET_ZIRCON_HANDLE_INFO_FUCHSIA: return RelocateStruct<VkSemaphoreGetZirconHandleInfoFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO: return RelocateStruct<VkSemaphoreSignalInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO: return RelocateStruct<VkSemaphoreSubmitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO: return RelocateStruct<VkSemaphoreTypeCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO: return RelocateStruct<VkSemaphoreWaitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SHADER_CREATE_INFO_EXT: return RelocateStruct<VkShaderCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO: return RelocateStruct<VkShaderModuleCreateInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SHADER_MODULE_IDENTIFIER_EXT: return RelocateStruct<VkShaderModuleIdentifierEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT: return RelocateStruct<VkShaderModuleValidationCacheCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR: return RelocateStruct<VkSharedPresentSurfaceCapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2: return RelocateStruct<VkSparseImageFormatProperties2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2: return RelocateStruct<VkSparseImageMemoryRequirements2>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_GGP
+      case VK_STRUCTURE_TYPE_STREAM_DESCRIPTOR_SURFACE_CREATE_INFO_GGP: return RelocateStruct<VkStreamDescriptorSurfaceCreateInfoGGP>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_SUBMIT_INFO: return RelocateStruct<VkSubmitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBMIT_INFO_2: return RelocateStruct<VkSubmitInfo2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO: return RelocateStruct<VkSubpassBeginInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2: return RelocateStruct<VkSubpassDependency2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2: return RelocateStruct<VkSubpassDescription2>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE: return RelocateStruct<VkSubpassDescriptionDepthStencilResolve>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_END_INFO: return RelocateStruct<VkSubpassEndInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_FRAGMENT_DENSITY_MAP_OFFSET_END_INFO_QCOM: return RelocateStruct<VkSubpassFragmentDensityMapOffsetEndInfoQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_RESOLVE_PERFORMANCE_QUERY_EXT: return RelocateStruct<VkSubpassResolvePerformanceQueryEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBPASS_SHADING_PIPELINE_CREATE_INFO_HUAWEI: return RelocateStruct<VkSubpassShadingPipelineCreateInfoHUAWEI>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SUBRESOURCE_LAYOUT_2_EXT: return RelocateStruct<VkSubresourceLayout2EXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_EXT: return RelocateStruct<VkSurfaceCapabilities2EXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR: return RelocateStruct<VkSurfaceCapabilities2KHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT: return RelocateStruct<VkSurfaceCapabilitiesFullScreenExclusiveEXT>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_PRESENT_BARRIER_NV: return RelocateStruct<VkSurfaceCapabilitiesPresentBarrierNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR: return RelocateStruct<VkSurfaceFormat2KHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT: return RelocateStruct<VkSurfaceFullScreenExclusiveInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT: return RelocateStruct<VkSurfaceFullScreenExclusiveWin32InfoEXT>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_COMPATIBILITY_EXT: return RelocateStruct<VkSurfacePresentModeCompatibilityEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SURFACE_PRESENT_MODE_EXT: return RelocateStruct<VkSurfacePresentModeEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SURFACE_PRESENT_SCALING_CAPABILITIES_EXT: return RelocateStruct<VkSurfacePresentScalingCapabilitiesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR: return RelocateStruct<VkSurfaceProtectedCapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT: return RelocateStruct<VkSwapchainCounterCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR: return RelocateStruct<VkSwapchainCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD: return RelocateStruct<VkSwapchainDisplayNativeHdrCreateInfoAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_BARRIER_CREATE_INFO_NV: return RelocateStruct<VkSwapchainPresentBarrierCreateInfoNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_FENCE_INFO_EXT: return RelocateStruct<VkSwapchainPresentFenceInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODE_INFO_EXT: return RelocateStruct<VkSwapchainPresentModeInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_MODES_CREATE_INFO_EXT: return RelocateStruct<VkSwapchainPresentModesCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_SWAPCHAIN_PRESENT_SCALING_CREATE_INFO_EXT: return RelocateStruct<VkSwapchainPresentScalingCreateInfoEXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_FUCHSIA
+      case VK_STRUCTURE_TYPE_SYSMEM_COLOR_SPACE_FUCHSIA: return RelocateStruct<VkSysmemColorSpaceFUCHSIA>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD: return RelocateStruct<VkTextureLODGatherFormatPropertiesAMD>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_TILE_PROPERTIES_QCOM: return RelocateStruct<VkTilePropertiesQCOM>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO: return RelocateStruct<VkTimelineSemaphoreSubmitInfo>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VALIDATION_CACHE_CREATE_INFO_EXT: return RelocateStruct<VkValidationCacheCreateInfoEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT: return RelocateStruct<VkValidationFeaturesEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT: return RelocateStruct<VkValidationFlagsEXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VERTEX_INPUT_ATTRIBUTE_DESCRIPTION_2_EXT: return RelocateStruct<VkVertexInputAttributeDescription2EXT>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VERTEX_INPUT_BINDING_DESCRIPTION_2_EXT: return RelocateStruct<VkVertexInputBindingDescription2EXT>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_VI_NN
+      case VK_STRUCTURE_TYPE_VI_SURFACE_CREATE_INFO_NN: return RelocateStruct<VkViSurfaceCreateInfoNN>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_VIDEO_BEGIN_CODING_INFO_KHR: return RelocateStruct<VkVideoBeginCodingInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_CAPABILITIES_KHR: return RelocateStruct<VkVideoCapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_CODING_CONTROL_INFO_KHR: return RelocateStruct<VkVideoCodingControlInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_CAPABILITIES_KHR: return RelocateStruct<VkVideoDecodeCapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_CAPABILITIES_KHR: return RelocateStruct<VkVideoDecodeH264CapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_DPB_SLOT_INFO_KHR: return RelocateStruct<VkVideoDecodeH264DpbSlotInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PICTURE_INFO_KHR: return RelocateStruct<VkVideoDecodeH264PictureInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_PROFILE_INFO_KHR: return RelocateStruct<VkVideoDecodeH264ProfileInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_ADD_INFO_KHR: return RelocateStruct<VkVideoDecodeH264SessionParametersAddInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H264_SESSION_PARAMETERS_CREATE_INFO_KHR: return RelocateStruct<VkVideoDecodeH264SessionParametersCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_CAPABILITIES_KHR: return RelocateStruct<VkVideoDecodeH265CapabilitiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_DPB_SLOT_INFO_KHR: return RelocateStruct<VkVideoDecodeH265DpbSlotInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PICTURE_INFO_KHR: return RelocateStruct<VkVideoDecodeH265PictureInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_PROFILE_INFO_KHR: return RelocateStruct<VkVideoDecodeH265ProfileInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_ADD_INFO_KHR: return RelocateStruct<VkVideoDecodeH265SessionParametersAddInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_H265_SESSION_PARAMETERS_CREATE_INFO_KHR: return RelocateStruct<VkVideoDecodeH265SessionParametersCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_INFO_KHR: return RelocateStruct<VkVideoDecodeInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_DECODE_USAGE_INFO_KHR: return RelocateStruct<VkVideoDecodeUsageInfoKHR>(pNext, relocator);
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_CAPABILITIES_KHR: return RelocateStruct<VkVideoEncodeCapabilitiesKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_CAPABILITIES_EXT: return RelocateStruct<VkVideoEncodeH264CapabilitiesEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_DPB_SLOT_INFO_EXT: return RelocateStruct<VkVideoEncodeH264DpbSlotInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_GOP_REMAINING_FRAME_INFO_EXT: return RelocateStruct<VkVideoEncodeH264GopRemainingFrameInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_NALU_SLICE_INFO_EXT: return RelocateStruct<VkVideoEncodeH264NaluSliceInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PICTURE_INFO_EXT: return RelocateStruct<VkVideoEncodeH264PictureInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_PROFILE_INFO_EXT: return RelocateStruct<VkVideoEncodeH264ProfileInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_QUALITY_LEVEL_PROPERTIES_EXT: return RelocateStruct<VkVideoEncodeH264QualityLevelPropertiesEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_INFO_EXT: return RelocateStruct<VkVideoEncodeH264RateControlInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_RATE_CONTROL_LAYER_INFO_EXT: return RelocateStruct<VkVideoEncodeH264RateControlLayerInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_CREATE_INFO_EXT: return RelocateStruct<VkVideoEncodeH264SessionCreateInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_ADD_INFO_EXT: return RelocateStruct<VkVideoEncodeH264SessionParametersAddInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_CREATE_INFO_EXT: return RelocateStruct<VkVideoEncodeH264SessionParametersCreateInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_FEEDBACK_INFO_EXT: return RelocateStruct<VkVideoEncodeH264SessionParametersFeedbackInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H264_SESSION_PARAMETERS_GET_INFO_EXT: return RelocateStruct<VkVideoEncodeH264SessionParametersGetInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_CAPABILITIES_EXT: return RelocateStruct<VkVideoEncodeH265CapabilitiesEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_DPB_SLOT_INFO_EXT: return RelocateStruct<VkVideoEncodeH265DpbSlotInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_GOP_REMAINING_FRAME_INFO_EXT: return RelocateStruct<VkVideoEncodeH265GopRemainingFrameInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_NALU_SLICE_SEGMENT_INFO_EXT: return RelocateStruct<VkVideoEncodeH265NaluSliceSegmentInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PICTURE_INFO_EXT: return RelocateStruct<VkVideoEncodeH265PictureInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_PROFILE_INFO_EXT: return RelocateStruct<VkVideoEncodeH265ProfileInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_QUALITY_LEVEL_PROPERTIES_EXT: return RelocateStruct<VkVideoEncodeH265QualityLevelPropertiesEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_INFO_EXT: return RelocateStruct<VkVideoEncodeH265RateControlInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_RATE_CONTROL_LAYER_INFO_EXT: return RelocateStruct<VkVideoEncodeH265RateControlLayerInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_CREATE_INFO_EXT: return RelocateStruct<VkVideoEncodeH265SessionCreateInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_ADD_INFO_EXT: return RelocateStruct<VkVideoEncodeH265SessionParametersAddInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_CREATE_INFO_EXT: return RelocateStruct<VkVideoEncodeH265SessionParametersCreateInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_FEEDBACK_INFO_EXT: return RelocateStruct<VkVideoEncodeH265SessionParametersFeedbackInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_H265_SESSION_PARAMETERS_GET_INFO_EXT: return RelocateStruct<VkVideoEncodeH265SessionParametersGetInfoEXT>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_INFO_KHR: return RelocateStruct<VkVideoEncodeInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_INFO_KHR: return RelocateStruct<VkVideoEncodeQualityLevelInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_QUALITY_LEVEL_PROPERTIES_KHR: return RelocateStruct<VkVideoEncodeQualityLevelPropertiesKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_INFO_KHR: return RelocateStruct<VkVideoEncodeRateControlInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_RATE_CONTROL_LAYER_INFO_KHR: return RelocateStruct<VkVideoEncodeRateControlLayerInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_FEEDBACK_INFO_KHR: return RelocateStruct<VkVideoEncodeSessionParametersFeedbackInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_SESSION_PARAMETERS_GET_INFO_KHR: return RelocateStruct<VkVideoEncodeSessionParametersGetInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+      case VK_STRUCTURE_TYPE_VIDEO_ENCODE_USAGE_INFO_KHR: return RelocateStruct<VkVideoEncodeUsageInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_VIDEO_END_CODING_INFO_KHR: return RelocateStruct<VkVideoEndCodingInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_FORMAT_PROPERTIES_KHR: return RelocateStruct<VkVideoFormatPropertiesKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_PICTURE_RESOURCE_INFO_KHR: return RelocateStruct<VkVideoPictureResourceInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_PROFILE_INFO_KHR: return RelocateStruct<VkVideoProfileInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_PROFILE_LIST_INFO_KHR: return RelocateStruct<VkVideoProfileListInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_REFERENCE_SLOT_INFO_KHR: return RelocateStruct<VkVideoReferenceSlotInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_SESSION_CREATE_INFO_KHR: return RelocateStruct<VkVideoSessionCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_SESSION_MEMORY_REQUIREMENTS_KHR: return RelocateStruct<VkVideoSessionMemoryRequirementsKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_CREATE_INFO_KHR: return RelocateStruct<VkVideoSessionParametersCreateInfoKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_VIDEO_SESSION_PARAMETERS_UPDATE_INFO_KHR: return RelocateStruct<VkVideoSessionParametersUpdateInfoKHR>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+      case VK_STRUCTURE_TYPE_WAYLAND_SURFACE_CREATE_INFO_KHR: return RelocateStruct<VkWaylandSurfaceCreateInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR: return RelocateStruct<VkWin32KeyedMutexAcquireReleaseInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV: return RelocateStruct<VkWin32KeyedMutexAcquireReleaseInfoNV>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+      case VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR: return RelocateStruct<VkWin32SurfaceCreateInfoKHR>(pNext, relocator);
+#endif
+      case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET: return RelocateStruct<VkWriteDescriptorSet>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR: return RelocateStruct<VkWriteDescriptorSetAccelerationStructureKHR>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV: return RelocateStruct<VkWriteDescriptorSetAccelerationStructureNV>(pNext, relocator);
+      case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK: return RelocateStruct<VkWriteDescriptorSetInlineUniformBlock>(pNext, relocator);
+#ifdef VK_USE_PLATFORM_XCB_KHR
+      case VK_STRUCTURE_TYPE_XCB_SURFACE_CREATE_INFO_KHR: return RelocateStruct<VkXcbSurfaceCreateInfoKHR>(pNext, relocator);
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+      case VK_STRUCTURE_TYPE_XLIB_SURFACE_CREATE_INFO_KHR: return RelocateStruct<VkXlibSurfaceCreateInfoKHR>(pNext, relocator);
+#endif
+      default: return relocator.fail();
+    }
+  }
+}
+
@@ -0,0 +1,5935 @@
+// Part of vkroots.h, generated by gen/make_vkroots.
+
+#pragma once
+
+#include "dispatch_classes.h"
+
+namespace vkroots {
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateAndroidSurfaceKHR(VkInstance instance, const VkAndroidSurfaceCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateAndroidSurfaceKHR(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDebugReportCallbackEXT(VkInstance instance, const VkDebugReportCallbackCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDebugReportCallbackEXT *pCallback) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateDebugReportCallbackEXT(dispatch, instance, pCreateInfo, pAllocator, pCallback);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDebugUtilsMessengerEXT(VkInstance instance, const VkDebugUtilsMessengerCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDebugUtilsMessengerEXT *pMessenger) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateDebugUtilsMessengerEXT(dispatch, instance, pCreateInfo, pAllocator, pMessenger);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    PFN_vkGetDeviceProcAddr deviceProcAddr;
+    VkResult procAddrRes = GetProcAddrs(pCreateInfo, &deviceProcAddr);
+    if (procAddrRes != VK_SUCCESS)
+      return procAddrRes;
+#if VKROOTS_USE_CREATE_TIMINGS
+    tables::VkCreateTimer createTimer;
+#endif
+    VkResult ret = InstanceOverrides::CreateDevice(dispatch, physicalDevice, pCreateInfo, pAllocator, pDevice);
+#if VKROOTS_USE_CREATE_TIMINGS
+    const std::chrono::nanoseconds createTime = createTimer.Elapsed();
+#endif
+    if (ret == VK_SUCCESS) {
+      tables::CreateDispatchTable(pCreateInfo, deviceProcAddr, physicalDevice, *pDevice);
+#if VKROOTS_USE_CREATE_TIMINGS
+      tables::LookupDeviceDispatch(*pDevice)->CreateTimings.Create = createTime;
+#endif
+    }
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDirectFBSurfaceEXT(VkInstance instance, const VkDirectFBSurfaceCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateDirectFBSurfaceEXT(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, const VkDisplayModeCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDisplayModeKHR *pMode) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::CreateDisplayModeKHR(dispatch, physicalDevice, display, pCreateInfo, pAllocator, pMode);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDisplayPlaneSurfaceKHR(VkInstance instance, const VkDisplaySurfaceCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateDisplayPlaneSurfaceKHR(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateHeadlessSurfaceEXT(VkInstance instance, const VkHeadlessSurfaceCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateHeadlessSurfaceEXT(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_IOS_MVK
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateIOSSurfaceMVK(VkInstance instance, const VkIOSSurfaceCreateInfoMVK *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateIOSSurfaceMVK(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateImagePipeSurfaceFUCHSIA(VkInstance instance, const VkImagePipeSurfaceCreateInfoFUCHSIA *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateImagePipeSurfaceFUCHSIA(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkInstance *pInstance) {
+    VkInstanceProcAddrFuncs instanceProcAddrFuncs;
+    VkResult procAddrRes = GetProcAddrs(pCreateInfo, &instanceProcAddrFuncs);
+    if (procAddrRes != VK_SUCCESS)
+      return procAddrRes;
+    PFN_vkCreateInstance createInstanceProc = (PFN_vkCreateInstance) instanceProcAddrFuncs.NextGetInstanceProcAddr(NULL, "vkCreateInstance");
+#if VKROOTS_USE_CREATE_TIMINGS
+    tables::VkCreateTimer createTimer;
+#endif
+    VkResult ret = InstanceOverrides::CreateInstance(createInstanceProc, pCreateInfo, pAllocator, pInstance);
+#if VKROOTS_USE_CREATE_TIMINGS
+    const std::chrono::nanoseconds createTime = createTimer.Elapsed();
+#endif
+    if (ret == VK_SUCCESS) {
+      tables::CreateDispatchTable(instanceProcAddrFuncs.NextGetInstanceProcAddr, instanceProcAddrFuncs.NextGetPhysicalDeviceProcAddr, *pInstance);
+#if VKROOTS_USE_CREATE_TIMINGS
+      tables::LookupInstanceDispatch(*pInstance)->CreateTimings.Create = createTime;
+#endif
+    }
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_MACOS_MVK
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateMacOSSurfaceMVK(VkInstance instance, const VkMacOSSurfaceCreateInfoMVK *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateMacOSSurfaceMVK(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateMetalSurfaceEXT(VkInstance instance, const VkMetalSurfaceCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateMetalSurfaceEXT(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateScreenSurfaceQNX(VkInstance instance, const VkScreenSurfaceCreateInfoQNX *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateScreenSurfaceQNX(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_GGP
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateStreamDescriptorSurfaceGGP(VkInstance instance, const VkStreamDescriptorSurfaceCreateInfoGGP *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateStreamDescriptorSurfaceGGP(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_VI_NN
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateViSurfaceNN(VkInstance instance, const VkViSurfaceCreateInfoNN *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateViSurfaceNN(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateWaylandSurfaceKHR(VkInstance instance, const VkWaylandSurfaceCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateWaylandSurfaceKHR(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateWin32SurfaceKHR(VkInstance instance, const VkWin32SurfaceCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateWin32SurfaceKHR(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateXcbSurfaceKHR(VkInstance instance, const VkXcbSurfaceCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateXcbSurfaceKHR(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateXlibSurfaceKHR(VkInstance instance, const VkXlibSurfaceCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::CreateXlibSurfaceKHR(dispatch, instance, pCreateInfo, pAllocator, pSurface);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, const char *pLayerPrefix, const char *pMessage) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    InstanceOverrides::DebugReportMessageEXT(dispatch, instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, const VkAllocationCallbacks *pAllocator) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    InstanceOverrides::DestroyDebugReportCallbackEXT(dispatch, instance, callback, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDebugUtilsMessengerEXT(VkInstance instance, VkDebugUtilsMessengerEXT messenger, const VkAllocationCallbacks *pAllocator) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    InstanceOverrides::DestroyDebugUtilsMessengerEXT(dispatch, instance, messenger, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    InstanceOverrides::DestroyInstance(dispatch, instance, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, const VkAllocationCallbacks *pAllocator) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    InstanceOverrides::DestroySurfaceKHR(dispatch, instance, surface, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName, uint32_t *pPropertyCount, VkExtensionProperties *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::EnumerateDeviceExtensionProperties(dispatch, physicalDevice, pLayerName, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkLayerProperties *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::EnumerateDeviceLayerProperties(dispatch, physicalDevice, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EnumeratePhysicalDeviceGroups(VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::EnumeratePhysicalDeviceGroups(dispatch, instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EnumeratePhysicalDeviceGroupsKHR(VkInstance instance, uint32_t *pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties *pPhysicalDeviceGroupProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::EnumeratePhysicalDeviceGroupsKHR(dispatch, instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EnumeratePhysicalDevices(VkInstance instance, uint32_t *pPhysicalDeviceCount, VkPhysicalDevice *pPhysicalDevices) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    VkResult ret = InstanceOverrides::EnumeratePhysicalDevices(dispatch, instance, pPhysicalDeviceCount, pPhysicalDevices);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t *pPropertyCount, VkDisplayModePropertiesKHR *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetDisplayModePropertiesKHR(dispatch, physicalDevice, display, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR *pCapabilities) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetDisplayPlaneCapabilitiesKHR(dispatch, physicalDevice, mode, planeIndex, pCapabilities);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t *pDisplayCount, VkDisplayKHR *pDisplays) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetDisplayPlaneSupportedDisplaysKHR(dispatch, physicalDevice, planeIndex, pDisplayCount, pDisplays);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline PFN_vkVoidFunction wrap_GetInstanceProcAddr(VkInstance instance, const char *pName) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    PFN_vkVoidFunction ret = InstanceOverrides::GetInstanceProcAddr(dispatch, instance, pName);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkDisplayPlanePropertiesKHR *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceDisplayPlanePropertiesKHR(dispatch, physicalDevice, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkDisplayPropertiesKHR *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceDisplayPropertiesKHR(dispatch, physicalDevice, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceExternalBufferProperties(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo *pExternalBufferInfo, VkExternalBufferProperties *pExternalBufferProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceExternalBufferProperties(dispatch, physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceExternalFenceProperties(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo *pExternalFenceInfo, VkExternalFenceProperties *pExternalFenceProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceExternalFenceProperties(dispatch, physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceExternalSemaphoreProperties(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo *pExternalSemaphoreInfo, VkExternalSemaphoreProperties *pExternalSemaphoreProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceExternalSemaphoreProperties(dispatch, physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures *pFeatures) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceFeatures(dispatch, physicalDevice, pFeatures);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2 *pFeatures) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceFeatures2(dispatch, physicalDevice, pFeatures);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties *pFormatProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceFormatProperties(dispatch, physicalDevice, format, pFormatProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceFormatProperties2(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2 *pFormatProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceFormatProperties2(dispatch, physicalDevice, format, pFormatProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties *pImageFormatProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceImageFormatProperties(dispatch, physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceImageFormatProperties2(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2 *pImageFormatInfo, VkImageFormatProperties2 *pImageFormatProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceImageFormatProperties2(dispatch, physicalDevice, pImageFormatInfo, pImageFormatProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties *pMemoryProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceMemoryProperties(dispatch, physicalDevice, pMemoryProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2 *pMemoryProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceMemoryProperties2(dispatch, physicalDevice, pMemoryProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDevicePresentRectanglesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t *pRectCount, VkRect2D *pRects) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDevicePresentRectanglesKHR(dispatch, physicalDevice, surface, pRectCount, pRects);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceProperties(dispatch, physicalDevice, pProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2 *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceProperties2(dispatch, physicalDevice, pProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t *pQueueFamilyPropertyCount, VkQueueFamilyProperties *pQueueFamilyProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceQueueFamilyProperties(dispatch, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceQueueFamilyProperties2(VkPhysicalDevice physicalDevice, uint32_t *pQueueFamilyPropertyCount, VkQueueFamilyProperties2 *pQueueFamilyProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceQueueFamilyProperties2(dispatch, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t *pPropertyCount, VkSparseImageFormatProperties *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceSparseImageFormatProperties(dispatch, physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceSparseImageFormatProperties2(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2 *pFormatInfo, uint32_t *pPropertyCount, VkSparseImageFormatProperties2 *pProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    InstanceOverrides::GetPhysicalDeviceSparseImageFormatProperties2(dispatch, physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfaceCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR *pSurfaceInfo, VkSurfaceCapabilities2KHR *pSurfaceCapabilities) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceSurfaceCapabilities2KHR(dispatch, physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR *pSurfaceCapabilities) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceSurfaceCapabilitiesKHR(dispatch, physicalDevice, surface, pSurfaceCapabilities);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR *pSurfaceInfo, uint32_t *pSurfaceFormatCount, VkSurfaceFormat2KHR *pSurfaceFormats) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceSurfaceFormats2KHR(dispatch, physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t *pSurfaceFormatCount, VkSurfaceFormatKHR *pSurfaceFormats) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceSurfaceFormatsKHR(dispatch, physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t *pPresentModeCount, VkPresentModeKHR *pPresentModes) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceSurfacePresentModesKHR(dispatch, physicalDevice, surface, pPresentModeCount, pPresentModes);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32 *pSupported) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceSurfaceSupportKHR(dispatch, physicalDevice, queueFamilyIndex, surface, pSupported);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceToolProperties(VkPhysicalDevice physicalDevice, uint32_t *pToolCount, VkPhysicalDeviceToolProperties *pToolProperties) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkResult ret = InstanceOverrides::GetPhysicalDeviceToolProperties(dispatch, physicalDevice, pToolCount, pToolProperties);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WAYLAND_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkBool32 wrap_GetPhysicalDeviceWaylandPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct wl_display *display) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkBool32 ret = InstanceOverrides::GetPhysicalDeviceWaylandPresentationSupportKHR(dispatch, physicalDevice, queueFamilyIndex, display);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkBool32 wrap_GetPhysicalDeviceWin32PresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkBool32 ret = InstanceOverrides::GetPhysicalDeviceWin32PresentationSupportKHR(dispatch, physicalDevice, queueFamilyIndex);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_XCB_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkBool32 wrap_GetPhysicalDeviceXcbPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, xcb_connection_t *connection, xcb_visualid_t visual_id) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkBool32 ret = InstanceOverrides::GetPhysicalDeviceXcbPresentationSupportKHR(dispatch, physicalDevice, queueFamilyIndex, connection, visual_id);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkBool32 wrap_GetPhysicalDeviceXlibPresentationSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, Display *dpy, VisualID visualID) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    VkBool32 ret = InstanceOverrides::GetPhysicalDeviceXlibPresentationSupportKHR(dispatch, physicalDevice, queueFamilyIndex, dpy, visualID);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_SubmitDebugUtilsMessageEXT(VkInstance instance, VkDebugUtilsMessageSeverityFlagBitsEXT messageSeverity, VkDebugUtilsMessageTypeFlagsEXT messageTypes, const VkDebugUtilsMessengerCallbackDataEXT *pCallbackData) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    InstanceOverrides::SubmitDebugUtilsMessageEXT(dispatch, instance, messageSeverity, messageTypes, pCallbackData);
+  }
+
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult implicit_wrap_CreateInstance(
+    const VkInstanceCreateInfo*  pCreateInfo,
+    const VkAllocationCallbacks* pAllocator,
+          VkInstance*            pInstance) {
+    VkInstanceProcAddrFuncs instanceProcAddrFuncs;
+    VkResult procAddrRes = GetProcAddrs(pCreateInfo, &instanceProcAddrFuncs);
+    if (procAddrRes != VK_SUCCESS)
+      return procAddrRes;
+    PFN_vkCreateInstance createInstanceProc = (PFN_vkCreateInstance) instanceProcAddrFuncs.NextGetInstanceProcAddr(nullptr, "vkCreateInstance");
+#if VKROOTS_USE_CREATE_TIMINGS
+    tables::VkCreateTimer createTimer;
+#endif
+    VkResult ret = createInstanceProc(pCreateInfo, pAllocator, pInstance);
+#if VKROOTS_USE_CREATE_TIMINGS
+    const std::chrono::nanoseconds createTime = createTimer.Elapsed();
+#endif
+    if (ret == VK_SUCCESS) {
+      tables::CreateDispatchTable(instanceProcAddrFuncs.NextGetInstanceProcAddr, instanceProcAddrFuncs.NextGetPhysicalDeviceProcAddr, *pInstance);
+#if VKROOTS_USE_CREATE_TIMINGS
+      tables::LookupInstanceDispatch(*pInstance)->CreateTimings.Create = createTime;
+#endif
+    }
+    return ret;
+  }
+
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void implicit_wrap_DestroyInstance(
+          VkInstance             instance,
+    const VkAllocationCallbacks* pAllocator) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(instance);
+    // Implemented in the Dispatch class, goes to DestroyInstanceWrapper.
+    // Make sure we call ours here.
+    dispatch->DestroyInstance(instance, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireDrmDisplayEXT(VkPhysicalDevice physicalDevice, int32_t drmFd, VkDisplayKHR display) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::AcquireDrmDisplayEXT(dispatch, physicalDevice, drmFd, display);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireWinrtDisplayNV(VkPhysicalDevice physicalDevice, VkDisplayKHR display) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::AcquireWinrtDisplayNV(dispatch, physicalDevice, display);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireXlibDisplayEXT(VkPhysicalDevice physicalDevice, Display *dpy, VkDisplayKHR display) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::AcquireXlibDisplayEXT(dispatch, physicalDevice, dpy, display);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, uint32_t *pCounterCount, VkPerformanceCounterKHR *pCounters, VkPerformanceCounterDescriptionKHR *pCounterDescriptions) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::EnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(dispatch, physicalDevice, queueFamilyIndex, pCounterCount, pCounters, pCounterDescriptions);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDisplayModeProperties2KHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t *pPropertyCount, VkDisplayModeProperties2KHR *pProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetDisplayModeProperties2KHR(dispatch, physicalDevice, display, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDisplayPlaneCapabilities2KHR(VkPhysicalDevice physicalDevice, const VkDisplayPlaneInfo2KHR *pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR *pCapabilities) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetDisplayPlaneCapabilities2KHR(dispatch, physicalDevice, pDisplayPlaneInfo, pCapabilities);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDrmDisplayEXT(VkPhysicalDevice physicalDevice, int32_t drmFd, uint32_t connectorId, VkDisplayKHR *display) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetDrmDisplayEXT(dispatch, physicalDevice, drmFd, connectorId, display);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceCalibrateableTimeDomainsEXT(VkPhysicalDevice physicalDevice, uint32_t *pTimeDomainCount, VkTimeDomainEXT *pTimeDomains) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceCalibrateableTimeDomainsEXT(dispatch, physicalDevice, pTimeDomainCount, pTimeDomains);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceCooperativeMatrixPropertiesNV(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkCooperativeMatrixPropertiesNV *pProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceCooperativeMatrixPropertiesNV(dispatch, physicalDevice, pPropertyCount, pProperties);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_DIRECTFB_EXT
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkBool32 wrap_GetPhysicalDeviceDirectFBPresentationSupportEXT(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, IDirectFB *dfb) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkBool32 ret = PhysicalDeviceOverrides::GetPhysicalDeviceDirectFBPresentationSupportEXT(dispatch, physicalDevice, queueFamilyIndex, dfb);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceDisplayPlaneProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkDisplayPlaneProperties2KHR *pProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceDisplayPlaneProperties2KHR(dispatch, physicalDevice, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceDisplayProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t *pPropertyCount, VkDisplayProperties2KHR *pProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceDisplayProperties2KHR(dispatch, physicalDevice, pPropertyCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceExternalBufferPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalBufferInfo *pExternalBufferInfo, VkExternalBufferProperties *pExternalBufferProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceExternalBufferPropertiesKHR(dispatch, physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceExternalFencePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalFenceInfo *pExternalFenceInfo, VkExternalFenceProperties *pExternalFenceProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceExternalFencePropertiesKHR(dispatch, physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceExternalImageFormatPropertiesNV(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkExternalMemoryHandleTypeFlagsNV externalHandleType, VkExternalImageFormatPropertiesNV *pExternalImageFormatProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceExternalImageFormatPropertiesNV(dispatch, physicalDevice, format, type, tiling, usage, flags, externalHandleType, pExternalImageFormatProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceExternalSemaphorePropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceExternalSemaphoreInfo *pExternalSemaphoreInfo, VkExternalSemaphoreProperties *pExternalSemaphoreProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceExternalSemaphorePropertiesKHR(dispatch, physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceFeatures2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2 *pFeatures) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceFeatures2KHR(dispatch, physicalDevice, pFeatures);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceFormatProperties2KHR(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2 *pFormatProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceFormatProperties2KHR(dispatch, physicalDevice, format, pFormatProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceFragmentShadingRatesKHR(VkPhysicalDevice physicalDevice, uint32_t *pFragmentShadingRateCount, VkPhysicalDeviceFragmentShadingRateKHR *pFragmentShadingRates) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceFragmentShadingRatesKHR(dispatch, physicalDevice, pFragmentShadingRateCount, pFragmentShadingRates);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceImageFormatInfo2 *pImageFormatInfo, VkImageFormatProperties2 *pImageFormatProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceImageFormatProperties2KHR(dispatch, physicalDevice, pImageFormatInfo, pImageFormatProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceMemoryProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2 *pMemoryProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceMemoryProperties2KHR(dispatch, physicalDevice, pMemoryProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceMultisamplePropertiesEXT(VkPhysicalDevice physicalDevice, VkSampleCountFlagBits samples, VkMultisamplePropertiesEXT *pMultisampleProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceMultisamplePropertiesEXT(dispatch, physicalDevice, samples, pMultisampleProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceOpticalFlowImageFormatsNV(VkPhysicalDevice physicalDevice, const VkOpticalFlowImageFormatInfoNV *pOpticalFlowImageFormatInfo, uint32_t *pFormatCount, VkOpticalFlowImageFormatPropertiesNV *pImageFormatProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceOpticalFlowImageFormatsNV(dispatch, physicalDevice, pOpticalFlowImageFormatInfo, pFormatCount, pImageFormatProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceProperties2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2 *pProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceProperties2KHR(dispatch, physicalDevice, pProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(VkPhysicalDevice physicalDevice, const VkQueryPoolPerformanceCreateInfoKHR *pPerformanceQueryCreateInfo, uint32_t *pNumPasses) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(dispatch, physicalDevice, pPerformanceQueryCreateInfo, pNumPasses);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceQueueFamilyProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t *pQueueFamilyPropertyCount, VkQueueFamilyProperties2 *pQueueFamilyProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceQueueFamilyProperties2KHR(dispatch, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+  }
+
+#ifdef VK_USE_PLATFORM_SCREEN_QNX
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkBool32 wrap_GetPhysicalDeviceScreenPresentationSupportQNX(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, struct _screen_window *window) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkBool32 ret = PhysicalDeviceOverrides::GetPhysicalDeviceScreenPresentationSupportQNX(dispatch, physicalDevice, queueFamilyIndex, window);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPhysicalDeviceSparseImageFormatProperties2KHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSparseImageFormatInfo2 *pFormatInfo, uint32_t *pPropertyCount, VkSparseImageFormatProperties2 *pProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    PhysicalDeviceOverrides::GetPhysicalDeviceSparseImageFormatProperties2KHR(dispatch, physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(VkPhysicalDevice physicalDevice, uint32_t *pCombinationCount, VkFramebufferMixedSamplesCombinationNV *pCombinations) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(dispatch, physicalDevice, pCombinationCount, pCombinations);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfaceCapabilities2EXT(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilities2EXT *pSurfaceCapabilities) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceSurfaceCapabilities2EXT(dispatch, physicalDevice, surface, pSurfaceCapabilities);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceSurfacePresentModes2EXT(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceSurfaceInfo2KHR *pSurfaceInfo, uint32_t *pPresentModeCount, VkPresentModeKHR *pPresentModes) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceSurfacePresentModes2EXT(dispatch, physicalDevice, pSurfaceInfo, pPresentModeCount, pPresentModes);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceToolPropertiesEXT(VkPhysicalDevice physicalDevice, uint32_t *pToolCount, VkPhysicalDeviceToolProperties *pToolProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceToolPropertiesEXT(dispatch, physicalDevice, pToolCount, pToolProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceVideoCapabilitiesKHR(VkPhysicalDevice physicalDevice, const VkVideoProfileInfoKHR *pVideoProfile, VkVideoCapabilitiesKHR *pCapabilities) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceVideoCapabilitiesKHR(dispatch, physicalDevice, pVideoProfile, pCapabilities);
+    return ret;
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR *pQualityLevelInfo, VkVideoEncodeQualityLevelPropertiesKHR *pQualityLevelProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR(dispatch, physicalDevice, pQualityLevelInfo, pQualityLevelProperties);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPhysicalDeviceVideoFormatPropertiesKHR(VkPhysicalDevice physicalDevice, const VkPhysicalDeviceVideoFormatInfoKHR *pVideoFormatInfo, uint32_t *pVideoFormatPropertyCount, VkVideoFormatPropertiesKHR *pVideoFormatProperties) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetPhysicalDeviceVideoFormatPropertiesKHR(dispatch, physicalDevice, pVideoFormatInfo, pVideoFormatPropertyCount, pVideoFormatProperties);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetRandROutputDisplayEXT(VkPhysicalDevice physicalDevice, Display *dpy, RROutput rrOutput, VkDisplayKHR *pDisplay) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetRandROutputDisplayEXT(dispatch, physicalDevice, dpy, rrOutput, pDisplay);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetWinrtDisplayNV(VkPhysicalDevice physicalDevice, uint32_t deviceRelativeId, VkDisplayKHR *pDisplay) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::GetWinrtDisplayNV(dispatch, physicalDevice, deviceRelativeId, pDisplay);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ReleaseDisplayEXT(VkPhysicalDevice physicalDevice, VkDisplayKHR display) {
+    const VkPhysicalDeviceDispatch* dispatch = tables::LookupPhysicalDeviceDispatch(physicalDevice);
+    VkResult ret = PhysicalDeviceOverrides::ReleaseDisplayEXT(dispatch, physicalDevice, display);
+    return ret;
+  }
+
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult implicit_wrap_CreateDevice(
+            VkPhysicalDevice       physicalDevice,
+      const VkDeviceCreateInfo*    pCreateInfo,
+      const VkAllocationCallbacks* pAllocator,
+            VkDevice*              pDevice) {
+    const VkInstanceDispatch* dispatch = tables::LookupInstanceDispatch(physicalDevice);
+    PFN_vkGetDeviceProcAddr deviceProcAddr;
+    VkResult procAddrRes = GetProcAddrs(pCreateInfo, &deviceProcAddr);
+    if (procAddrRes != VK_SUCCESS)
+      return procAddrRes;
+#if VKROOTS_USE_CREATE_TIMINGS
+    tables::VkCreateTimer createTimer;
+#endif
+    VkResult ret = dispatch->CreateDevice(physicalDevice, pCreateInfo, pAllocator, pDevice);
+#if VKROOTS_USE_CREATE_TIMINGS
+    const std::chrono::nanoseconds createTime = createTimer.Elapsed();
+#endif
+    if (ret == VK_SUCCESS) {
+      tables::CreateDispatchTable(pCreateInfo, deviceProcAddr, physicalDevice, *pDevice);
+#if VKROOTS_USE_CREATE_TIMINGS
+      tables::LookupDeviceDispatch(*pDevice)->CreateTimings.Create = createTime;
+#endif
+    }
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AcquireFullScreenExclusiveModeEXT(dispatch, device, swapchain);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireNextImage2KHR(VkDevice device, const VkAcquireNextImageInfoKHR *pAcquireInfo, uint32_t *pImageIndex) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AcquireNextImage2KHR(dispatch, device, pAcquireInfo, pImageIndex);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t *pImageIndex) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AcquireNextImageKHR(dispatch, device, swapchain, timeout, semaphore, fence, pImageIndex);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquirePerformanceConfigurationINTEL(VkDevice device, const VkPerformanceConfigurationAcquireInfoINTEL *pAcquireInfo, VkPerformanceConfigurationINTEL *pConfiguration) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AcquirePerformanceConfigurationINTEL(dispatch, device, pAcquireInfo, pConfiguration);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AcquireProfilingLockKHR(VkDevice device, const VkAcquireProfilingLockInfoKHR *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AcquireProfilingLockKHR(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AllocateCommandBuffers(VkDevice device, const VkCommandBufferAllocateInfo *pAllocateInfo, VkCommandBuffer *pCommandBuffers) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AllocateCommandBuffers(dispatch, device, pAllocateInfo, pCommandBuffers);
+    if (ret == VK_SUCCESS)
+      tables::RegisterCommandBuffers(dispatch, tables::CommandBufferStateTypeOf<DeviceOverrides>(), pAllocateInfo, pCommandBuffers);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AllocateDescriptorSets(VkDevice device, const VkDescriptorSetAllocateInfo *pAllocateInfo, VkDescriptorSet *pDescriptorSets) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AllocateDescriptorSets(dispatch, device, pAllocateInfo, pDescriptorSets);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_AllocateMemory(VkDevice device, const VkMemoryAllocateInfo *pAllocateInfo, const VkAllocationCallbacks *pAllocator, VkDeviceMemory *pMemory) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::AllocateMemory(dispatch, device, pAllocateInfo, pAllocator, pMemory);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BeginCommandBuffer(VkCommandBuffer commandBuffer, const VkCommandBufferBeginInfo *pBeginInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::BeginCommandBuffer(dispatch, commandBuffer, pBeginInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::BeginCommandBuffer(dispatch, commandBuffer, pBeginInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->BeginCommandBuffer(commandBuffer, pBeginInfo);
+      return DeviceOverrides::BeginCommandBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pBeginInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindAccelerationStructureMemoryNV(VkDevice device, uint32_t bindInfoCount, const VkBindAccelerationStructureMemoryInfoNV *pBindInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindAccelerationStructureMemoryNV(dispatch, device, bindInfoCount, pBindInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindBufferMemory(dispatch, device, buffer, memory, memoryOffset);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindBufferMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo *pBindInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindBufferMemory2(dispatch, device, bindInfoCount, pBindInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindBufferMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindBufferMemoryInfo *pBindInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindBufferMemory2KHR(dispatch, device, bindInfoCount, pBindInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindImageMemory(dispatch, device, image, memory, memoryOffset);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindImageMemory2(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo *pBindInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindImageMemory2(dispatch, device, bindInfoCount, pBindInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindImageMemory2KHR(VkDevice device, uint32_t bindInfoCount, const VkBindImageMemoryInfo *pBindInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindImageMemory2KHR(dispatch, device, bindInfoCount, pBindInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindOpticalFlowSessionImageNV(VkDevice device, VkOpticalFlowSessionNV session, VkOpticalFlowSessionBindingPointNV bindingPoint, VkImageView view, VkImageLayout layout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindOpticalFlowSessionImageNV(dispatch, device, session, bindingPoint, view, layout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BindVideoSessionMemoryKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t bindSessionMemoryInfoCount, const VkBindVideoSessionMemoryInfoKHR *pBindSessionMemoryInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BindVideoSessionMemoryKHR(dispatch, device, videoSession, bindSessionMemoryInfoCount, pBindSessionMemoryInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BuildAccelerationStructuresKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, const VkAccelerationStructureBuildRangeInfoKHR * const*ppBuildRangeInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BuildAccelerationStructuresKHR(dispatch, device, deferredOperation, infoCount, pInfos, ppBuildRangeInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_BuildMicromapsEXT(VkDevice device, VkDeferredOperationKHR deferredOperation, uint32_t infoCount, const VkMicromapBuildInfoEXT *pInfos) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::BuildMicromapsEXT(dispatch, device, deferredOperation, infoCount, pInfos);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginConditionalRenderingEXT(VkCommandBuffer commandBuffer, const VkConditionalRenderingBeginInfoEXT *pConditionalRenderingBegin) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginConditionalRenderingEXT(dispatch, commandBuffer, pConditionalRenderingBegin); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginConditionalRenderingEXT(dispatch, commandBuffer, pConditionalRenderingBegin);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginConditionalRenderingEXT(commandBuffer, pConditionalRenderingBegin);
+      return DeviceOverrides::CmdBeginConditionalRenderingEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pConditionalRenderingBegin);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT *pLabelInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginDebugUtilsLabelEXT(dispatch, commandBuffer, pLabelInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginDebugUtilsLabelEXT(dispatch, commandBuffer, pLabelInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+      return DeviceOverrides::CmdBeginDebugUtilsLabelEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pLabelInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginQuery(dispatch, commandBuffer, queryPool, query, flags); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginQuery(dispatch, commandBuffer, queryPool, query, flags);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginQuery(commandBuffer, queryPool, query, flags);
+      return DeviceOverrides::CmdBeginQuery(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, queryPool, query, flags);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags, uint32_t index) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginQueryIndexedEXT(dispatch, commandBuffer, queryPool, query, flags, index); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginQueryIndexedEXT(dispatch, commandBuffer, queryPool, query, flags, index);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginQueryIndexedEXT(commandBuffer, queryPool, query, flags, index);
+      return DeviceOverrides::CmdBeginQueryIndexedEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, queryPool, query, flags, index);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginRenderPass(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, VkSubpassContents contents) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginRenderPass(dispatch, commandBuffer, pRenderPassBegin, contents); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginRenderPass(dispatch, commandBuffer, pRenderPassBegin, contents);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginRenderPass(commandBuffer, pRenderPassBegin, contents);
+      return DeviceOverrides::CmdBeginRenderPass(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRenderPassBegin, contents);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginRenderPass2(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassBeginInfo *pSubpassBeginInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginRenderPass2(dispatch, commandBuffer, pRenderPassBegin, pSubpassBeginInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginRenderPass2(dispatch, commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginRenderPass2(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+      return DeviceOverrides::CmdBeginRenderPass2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginRenderPass2KHR(VkCommandBuffer commandBuffer, const VkRenderPassBeginInfo *pRenderPassBegin, const VkSubpassBeginInfo *pSubpassBeginInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginRenderPass2KHR(dispatch, commandBuffer, pRenderPassBegin, pSubpassBeginInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginRenderPass2KHR(dispatch, commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginRenderPass2KHR(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+      return DeviceOverrides::CmdBeginRenderPass2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginRendering(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginRendering(dispatch, commandBuffer, pRenderingInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginRendering(dispatch, commandBuffer, pRenderingInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginRendering(commandBuffer, pRenderingInfo);
+      return DeviceOverrides::CmdBeginRendering(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRenderingInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginRenderingKHR(VkCommandBuffer commandBuffer, const VkRenderingInfo *pRenderingInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginRenderingKHR(dispatch, commandBuffer, pRenderingInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginRenderingKHR(dispatch, commandBuffer, pRenderingInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginRenderingKHR(commandBuffer, pRenderingInfo);
+      return DeviceOverrides::CmdBeginRenderingKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRenderingInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer *pCounterBuffers, const VkDeviceSize *pCounterBufferOffsets) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginTransformFeedbackEXT(dispatch, commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginTransformFeedbackEXT(dispatch, commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+      return DeviceOverrides::CmdBeginTransformFeedbackEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBeginVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoBeginCodingInfoKHR *pBeginInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBeginVideoCodingKHR(dispatch, commandBuffer, pBeginInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBeginVideoCodingKHR(dispatch, commandBuffer, pBeginInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBeginVideoCodingKHR(commandBuffer, pBeginInfo);
+      return DeviceOverrides::CmdBeginVideoCodingKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pBeginInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindDescriptorBufferEmbeddedSamplersEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindDescriptorBufferEmbeddedSamplersEXT(dispatch, commandBuffer, pipelineBindPoint, layout, set); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindDescriptorBufferEmbeddedSamplersEXT(dispatch, commandBuffer, pipelineBindPoint, layout, set);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindDescriptorBufferEmbeddedSamplersEXT(commandBuffer, pipelineBindPoint, layout, set);
+      return DeviceOverrides::CmdBindDescriptorBufferEmbeddedSamplersEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineBindPoint, layout, set);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindDescriptorBuffersEXT(VkCommandBuffer commandBuffer, uint32_t bufferCount, const VkDescriptorBufferBindingInfoEXT *pBindingInfos) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindDescriptorBuffersEXT(dispatch, commandBuffer, bufferCount, pBindingInfos); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindDescriptorBuffersEXT(dispatch, commandBuffer, bufferCount, pBindingInfos);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindDescriptorBuffersEXT(commandBuffer, bufferCount, pBindingInfos);
+      return DeviceOverrides::CmdBindDescriptorBuffersEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, bufferCount, pBindingInfos);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, const VkDescriptorSet *pDescriptorSets, uint32_t dynamicOffsetCount, const uint32_t *pDynamicOffsets) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindDescriptorSets(dispatch, commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindDescriptorSets(dispatch, commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindDescriptorSets(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+      return DeviceOverrides::CmdBindDescriptorSets(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindIndexBuffer(dispatch, commandBuffer, buffer, offset, indexType); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindIndexBuffer(dispatch, commandBuffer, buffer, offset, indexType);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindIndexBuffer(commandBuffer, buffer, offset, indexType);
+      return DeviceOverrides::CmdBindIndexBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, indexType);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindInvocationMaskHUAWEI(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindInvocationMaskHUAWEI(dispatch, commandBuffer, imageView, imageLayout); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindInvocationMaskHUAWEI(dispatch, commandBuffer, imageView, imageLayout);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindInvocationMaskHUAWEI(commandBuffer, imageView, imageLayout);
+      return DeviceOverrides::CmdBindInvocationMaskHUAWEI(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, imageView, imageLayout);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindPipeline(dispatch, commandBuffer, pipelineBindPoint, pipeline); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindPipeline(dispatch, commandBuffer, pipelineBindPoint, pipeline);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindPipeline(commandBuffer, pipelineBindPoint, pipeline);
+      return DeviceOverrides::CmdBindPipeline(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineBindPoint, pipeline);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindPipelineShaderGroupNV(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline, uint32_t groupIndex) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindPipelineShaderGroupNV(dispatch, commandBuffer, pipelineBindPoint, pipeline, groupIndex); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindPipelineShaderGroupNV(dispatch, commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindPipelineShaderGroupNV(commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+      return DeviceOverrides::CmdBindPipelineShaderGroupNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineBindPoint, pipeline, groupIndex);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindShadersEXT(VkCommandBuffer commandBuffer, uint32_t stageCount, const VkShaderStageFlagBits *pStages, const VkShaderEXT *pShaders) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindShadersEXT(dispatch, commandBuffer, stageCount, pStages, pShaders); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindShadersEXT(dispatch, commandBuffer, stageCount, pStages, pShaders);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindShadersEXT(commandBuffer, stageCount, pStages, pShaders);
+      return DeviceOverrides::CmdBindShadersEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stageCount, pStages, pShaders);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindShadingRateImageNV(VkCommandBuffer commandBuffer, VkImageView imageView, VkImageLayout imageLayout) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindShadingRateImageNV(dispatch, commandBuffer, imageView, imageLayout); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindShadingRateImageNV(dispatch, commandBuffer, imageView, imageLayout);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindShadingRateImageNV(commandBuffer, imageView, imageLayout);
+      return DeviceOverrides::CmdBindShadingRateImageNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, imageView, imageLayout);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindTransformFeedbackBuffersEXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindTransformFeedbackBuffersEXT(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindTransformFeedbackBuffersEXT(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindTransformFeedbackBuffersEXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+      return DeviceOverrides::CmdBindTransformFeedbackBuffersEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindVertexBuffers(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindVertexBuffers(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindVertexBuffers(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+      return DeviceOverrides::CmdBindVertexBuffers(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes, const VkDeviceSize *pStrides) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindVertexBuffers2(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindVertexBuffers2(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindVertexBuffers2(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+      return DeviceOverrides::CmdBindVertexBuffers2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBindVertexBuffers2EXT(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, const VkBuffer *pBuffers, const VkDeviceSize *pOffsets, const VkDeviceSize *pSizes, const VkDeviceSize *pStrides) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBindVertexBuffers2EXT(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBindVertexBuffers2EXT(dispatch, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBindVertexBuffers2EXT(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+      return DeviceOverrides::CmdBindVertexBuffers2EXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageBlit *pRegions, VkFilter filter) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBlitImage(dispatch, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBlitImage(dispatch, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBlitImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+      return DeviceOverrides::CmdBlitImage(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBlitImage2(VkCommandBuffer commandBuffer, const VkBlitImageInfo2 *pBlitImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBlitImage2(dispatch, commandBuffer, pBlitImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBlitImage2(dispatch, commandBuffer, pBlitImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBlitImage2(commandBuffer, pBlitImageInfo);
+      return DeviceOverrides::CmdBlitImage2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pBlitImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBlitImage2KHR(VkCommandBuffer commandBuffer, const VkBlitImageInfo2 *pBlitImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBlitImage2KHR(dispatch, commandBuffer, pBlitImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBlitImage2KHR(dispatch, commandBuffer, pBlitImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBlitImage2KHR(commandBuffer, pBlitImageInfo);
+      return DeviceOverrides::CmdBlitImage2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pBlitImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBuildAccelerationStructureNV(VkCommandBuffer commandBuffer, const VkAccelerationStructureInfoNV *pInfo, VkBuffer instanceData, VkDeviceSize instanceOffset, VkBool32 update, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkBuffer scratch, VkDeviceSize scratchOffset) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBuildAccelerationStructureNV(dispatch, commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBuildAccelerationStructureNV(dispatch, commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBuildAccelerationStructureNV(commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+      return DeviceOverrides::CmdBuildAccelerationStructureNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo, instanceData, instanceOffset, update, dst, src, scratch, scratchOffset);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBuildAccelerationStructuresIndirectKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, const VkDeviceAddress *pIndirectDeviceAddresses, const uint32_t *pIndirectStrides, const uint32_t * const*ppMaxPrimitiveCounts) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBuildAccelerationStructuresIndirectKHR(dispatch, commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBuildAccelerationStructuresIndirectKHR(dispatch, commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBuildAccelerationStructuresIndirectKHR(commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+      return DeviceOverrides::CmdBuildAccelerationStructuresIndirectKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, infoCount, pInfos, pIndirectDeviceAddresses, pIndirectStrides, ppMaxPrimitiveCounts);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBuildAccelerationStructuresKHR(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkAccelerationStructureBuildGeometryInfoKHR *pInfos, const VkAccelerationStructureBuildRangeInfoKHR * const*ppBuildRangeInfos) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBuildAccelerationStructuresKHR(dispatch, commandBuffer, infoCount, pInfos, ppBuildRangeInfos); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBuildAccelerationStructuresKHR(dispatch, commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBuildAccelerationStructuresKHR(commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+      return DeviceOverrides::CmdBuildAccelerationStructuresKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, infoCount, pInfos, ppBuildRangeInfos);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdBuildMicromapsEXT(VkCommandBuffer commandBuffer, uint32_t infoCount, const VkMicromapBuildInfoEXT *pInfos) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdBuildMicromapsEXT(dispatch, commandBuffer, infoCount, pInfos); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdBuildMicromapsEXT(dispatch, commandBuffer, infoCount, pInfos);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdBuildMicromapsEXT(commandBuffer, infoCount, pInfos);
+      return DeviceOverrides::CmdBuildMicromapsEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, infoCount, pInfos);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkClearAttachment *pAttachments, uint32_t rectCount, const VkClearRect *pRects) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdClearAttachments(dispatch, commandBuffer, attachmentCount, pAttachments, rectCount, pRects); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdClearAttachments(dispatch, commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdClearAttachments(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+      return DeviceOverrides::CmdClearAttachments(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearColorValue *pColor, uint32_t rangeCount, const VkImageSubresourceRange *pRanges) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdClearColorImage(dispatch, commandBuffer, image, imageLayout, pColor, rangeCount, pRanges); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdClearColorImage(dispatch, commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdClearColorImage(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+      return DeviceOverrides::CmdClearColorImage(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, const VkClearDepthStencilValue *pDepthStencil, uint32_t rangeCount, const VkImageSubresourceRange *pRanges) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdClearDepthStencilImage(dispatch, commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdClearDepthStencilImage(dispatch, commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdClearDepthStencilImage(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+      return DeviceOverrides::CmdClearDepthStencilImage(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdControlVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoCodingControlInfoKHR *pCodingControlInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdControlVideoCodingKHR(dispatch, commandBuffer, pCodingControlInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdControlVideoCodingKHR(dispatch, commandBuffer, pCodingControlInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdControlVideoCodingKHR(commandBuffer, pCodingControlInfo);
+      return DeviceOverrides::CmdControlVideoCodingKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCodingControlInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureInfoKHR *pInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyAccelerationStructureKHR(dispatch, commandBuffer, pInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyAccelerationStructureKHR(dispatch, commandBuffer, pInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyAccelerationStructureKHR(commandBuffer, pInfo);
+      return DeviceOverrides::CmdCopyAccelerationStructureKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyAccelerationStructureNV(VkCommandBuffer commandBuffer, VkAccelerationStructureNV dst, VkAccelerationStructureNV src, VkCopyAccelerationStructureModeKHR mode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyAccelerationStructureNV(dispatch, commandBuffer, dst, src, mode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyAccelerationStructureNV(dispatch, commandBuffer, dst, src, mode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyAccelerationStructureNV(commandBuffer, dst, src, mode);
+      return DeviceOverrides::CmdCopyAccelerationStructureNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, dst, src, mode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyAccelerationStructureToMemoryKHR(VkCommandBuffer commandBuffer, const VkCopyAccelerationStructureToMemoryInfoKHR *pInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyAccelerationStructureToMemoryKHR(dispatch, commandBuffer, pInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyAccelerationStructureToMemoryKHR(dispatch, commandBuffer, pInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyAccelerationStructureToMemoryKHR(commandBuffer, pInfo);
+      return DeviceOverrides::CmdCopyAccelerationStructureToMemoryKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferCopy *pRegions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyBuffer(dispatch, commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyBuffer(dispatch, commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyBuffer(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+      return DeviceOverrides::CmdCopyBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyBuffer2(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyBuffer2(dispatch, commandBuffer, pCopyBufferInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyBuffer2(dispatch, commandBuffer, pCopyBufferInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyBuffer2(commandBuffer, pCopyBufferInfo);
+      return DeviceOverrides::CmdCopyBuffer2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyBufferInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferInfo2 *pCopyBufferInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyBuffer2KHR(dispatch, commandBuffer, pCopyBufferInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyBuffer2KHR(dispatch, commandBuffer, pCopyBufferInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyBuffer2KHR(commandBuffer, pCopyBufferInfo);
+      return DeviceOverrides::CmdCopyBuffer2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyBufferInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkBufferImageCopy *pRegions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyBufferToImage(dispatch, commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyBufferToImage(dispatch, commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyBufferToImage(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+      return DeviceOverrides::CmdCopyBufferToImage(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyBufferToImage2(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2 *pCopyBufferToImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyBufferToImage2(dispatch, commandBuffer, pCopyBufferToImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyBufferToImage2(dispatch, commandBuffer, pCopyBufferToImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyBufferToImage2(commandBuffer, pCopyBufferToImageInfo);
+      return DeviceOverrides::CmdCopyBufferToImage2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyBufferToImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyBufferToImage2KHR(VkCommandBuffer commandBuffer, const VkCopyBufferToImageInfo2 *pCopyBufferToImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyBufferToImage2KHR(dispatch, commandBuffer, pCopyBufferToImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyBufferToImage2KHR(dispatch, commandBuffer, pCopyBufferToImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyBufferToImage2KHR(commandBuffer, pCopyBufferToImageInfo);
+      return DeviceOverrides::CmdCopyBufferToImage2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyBufferToImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageCopy *pRegions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyImage(dispatch, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyImage(dispatch, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+      return DeviceOverrides::CmdCopyImage(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyImage2(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyImage2(dispatch, commandBuffer, pCopyImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyImage2(dispatch, commandBuffer, pCopyImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyImage2(commandBuffer, pCopyImageInfo);
+      return DeviceOverrides::CmdCopyImage2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyImage2KHR(VkCommandBuffer commandBuffer, const VkCopyImageInfo2 *pCopyImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyImage2KHR(dispatch, commandBuffer, pCopyImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyImage2KHR(dispatch, commandBuffer, pCopyImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyImage2KHR(commandBuffer, pCopyImageInfo);
+      return DeviceOverrides::CmdCopyImage2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, const VkBufferImageCopy *pRegions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyImageToBuffer(dispatch, commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyImageToBuffer(dispatch, commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyImageToBuffer(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+      return DeviceOverrides::CmdCopyImageToBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2 *pCopyImageToBufferInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyImageToBuffer2(dispatch, commandBuffer, pCopyImageToBufferInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyImageToBuffer2(dispatch, commandBuffer, pCopyImageToBufferInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyImageToBuffer2(commandBuffer, pCopyImageToBufferInfo);
+      return DeviceOverrides::CmdCopyImageToBuffer2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyImageToBufferInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyImageToBuffer2KHR(VkCommandBuffer commandBuffer, const VkCopyImageToBufferInfo2 *pCopyImageToBufferInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyImageToBuffer2KHR(dispatch, commandBuffer, pCopyImageToBufferInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyImageToBuffer2KHR(dispatch, commandBuffer, pCopyImageToBufferInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyImageToBuffer2KHR(commandBuffer, pCopyImageToBufferInfo);
+      return DeviceOverrides::CmdCopyImageToBuffer2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCopyImageToBufferInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyMemoryIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress, uint32_t copyCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyMemoryIndirectNV(dispatch, commandBuffer, copyBufferAddress, copyCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyMemoryIndirectNV(dispatch, commandBuffer, copyBufferAddress, copyCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyMemoryIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride);
+      return DeviceOverrides::CmdCopyMemoryIndirectNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, copyBufferAddress, copyCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyMemoryToAccelerationStructureKHR(VkCommandBuffer commandBuffer, const VkCopyMemoryToAccelerationStructureInfoKHR *pInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyMemoryToAccelerationStructureKHR(dispatch, commandBuffer, pInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyMemoryToAccelerationStructureKHR(dispatch, commandBuffer, pInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyMemoryToAccelerationStructureKHR(commandBuffer, pInfo);
+      return DeviceOverrides::CmdCopyMemoryToAccelerationStructureKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyMemoryToImageIndirectNV(VkCommandBuffer commandBuffer, VkDeviceAddress copyBufferAddress, uint32_t copyCount, uint32_t stride, VkImage dstImage, VkImageLayout dstImageLayout, const VkImageSubresourceLayers *pImageSubresources) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyMemoryToImageIndirectNV(dispatch, commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyMemoryToImageIndirectNV(dispatch, commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyMemoryToImageIndirectNV(commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
+      return DeviceOverrides::CmdCopyMemoryToImageIndirectNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, copyBufferAddress, copyCount, stride, dstImage, dstImageLayout, pImageSubresources);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyMemoryToMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMemoryToMicromapInfoEXT *pInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyMemoryToMicromapEXT(dispatch, commandBuffer, pInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyMemoryToMicromapEXT(dispatch, commandBuffer, pInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyMemoryToMicromapEXT(commandBuffer, pInfo);
+      return DeviceOverrides::CmdCopyMemoryToMicromapEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyMicromapEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapInfoEXT *pInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyMicromapEXT(dispatch, commandBuffer, pInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyMicromapEXT(dispatch, commandBuffer, pInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyMicromapEXT(commandBuffer, pInfo);
+      return DeviceOverrides::CmdCopyMicromapEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyMicromapToMemoryEXT(VkCommandBuffer commandBuffer, const VkCopyMicromapToMemoryInfoEXT *pInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyMicromapToMemoryEXT(dispatch, commandBuffer, pInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyMicromapToMemoryEXT(dispatch, commandBuffer, pInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyMicromapToMemoryEXT(commandBuffer, pInfo);
+      return DeviceOverrides::CmdCopyMicromapToMemoryEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdCopyQueryPoolResults(dispatch, commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdCopyQueryPoolResults(dispatch, commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdCopyQueryPoolResults(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+      return DeviceOverrides::CmdCopyQueryPoolResults(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDebugMarkerBeginEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT *pMarkerInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDebugMarkerBeginEXT(dispatch, commandBuffer, pMarkerInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDebugMarkerBeginEXT(dispatch, commandBuffer, pMarkerInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDebugMarkerBeginEXT(commandBuffer, pMarkerInfo);
+      return DeviceOverrides::CmdDebugMarkerBeginEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pMarkerInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDebugMarkerEndEXT(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDebugMarkerEndEXT(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDebugMarkerEndEXT(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDebugMarkerEndEXT(commandBuffer);
+      return DeviceOverrides::CmdDebugMarkerEndEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDebugMarkerInsertEXT(VkCommandBuffer commandBuffer, const VkDebugMarkerMarkerInfoEXT *pMarkerInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDebugMarkerInsertEXT(dispatch, commandBuffer, pMarkerInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDebugMarkerInsertEXT(dispatch, commandBuffer, pMarkerInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDebugMarkerInsertEXT(commandBuffer, pMarkerInfo);
+      return DeviceOverrides::CmdDebugMarkerInsertEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pMarkerInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDecodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoDecodeInfoKHR *pDecodeInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDecodeVideoKHR(dispatch, commandBuffer, pDecodeInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDecodeVideoKHR(dispatch, commandBuffer, pDecodeInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDecodeVideoKHR(commandBuffer, pDecodeInfo);
+      return DeviceOverrides::CmdDecodeVideoKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pDecodeInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDecompressMemoryIndirectCountNV(VkCommandBuffer commandBuffer, VkDeviceAddress indirectCommandsAddress, VkDeviceAddress indirectCommandsCountAddress, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDecompressMemoryIndirectCountNV(dispatch, commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDecompressMemoryIndirectCountNV(dispatch, commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDecompressMemoryIndirectCountNV(commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
+      return DeviceOverrides::CmdDecompressMemoryIndirectCountNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, indirectCommandsAddress, indirectCommandsCountAddress, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDecompressMemoryNV(VkCommandBuffer commandBuffer, uint32_t decompressRegionCount, const VkDecompressMemoryRegionNV *pDecompressMemoryRegions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDecompressMemoryNV(dispatch, commandBuffer, decompressRegionCount, pDecompressMemoryRegions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDecompressMemoryNV(dispatch, commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDecompressMemoryNV(commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+      return DeviceOverrides::CmdDecompressMemoryNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, decompressRegionCount, pDecompressMemoryRegions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDispatch(dispatch, commandBuffer, groupCountX, groupCountY, groupCountZ); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDispatch(dispatch, commandBuffer, groupCountX, groupCountY, groupCountZ);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDispatch(commandBuffer, groupCountX, groupCountY, groupCountZ);
+      return DeviceOverrides::CmdDispatch(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDispatchBase(dispatch, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDispatchBase(dispatch, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDispatchBase(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+      return DeviceOverrides::CmdDispatchBase(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDispatchBaseKHR(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDispatchBaseKHR(dispatch, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDispatchBaseKHR(dispatch, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDispatchBaseKHR(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+      return DeviceOverrides::CmdDispatchBaseKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDispatchIndirect(dispatch, commandBuffer, buffer, offset); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDispatchIndirect(dispatch, commandBuffer, buffer, offset);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDispatchIndirect(commandBuffer, buffer, offset);
+      return DeviceOverrides::CmdDispatchIndirect(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDraw(dispatch, commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDraw(dispatch, commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDraw(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+      return DeviceOverrides::CmdDraw(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawClusterHUAWEI(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawClusterHUAWEI(dispatch, commandBuffer, groupCountX, groupCountY, groupCountZ); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawClusterHUAWEI(dispatch, commandBuffer, groupCountX, groupCountY, groupCountZ);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawClusterHUAWEI(commandBuffer, groupCountX, groupCountY, groupCountZ);
+      return DeviceOverrides::CmdDrawClusterHUAWEI(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawClusterIndirectHUAWEI(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawClusterIndirectHUAWEI(dispatch, commandBuffer, buffer, offset); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawClusterIndirectHUAWEI(dispatch, commandBuffer, buffer, offset);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawClusterIndirectHUAWEI(commandBuffer, buffer, offset);
+      return DeviceOverrides::CmdDrawClusterIndirectHUAWEI(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndexed(dispatch, commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndexed(dispatch, commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+      return DeviceOverrides::CmdDrawIndexed(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndexedIndirect(dispatch, commandBuffer, buffer, offset, drawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndexedIndirect(dispatch, commandBuffer, buffer, offset, drawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndexedIndirect(commandBuffer, buffer, offset, drawCount, stride);
+      return DeviceOverrides::CmdDrawIndexedIndirect(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, drawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndexedIndirectCount(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndexedIndirectCount(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndexedIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawIndexedIndirectCount(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndexedIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndexedIndirectCountAMD(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndexedIndirectCountAMD(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndexedIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawIndexedIndirectCountAMD(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndexedIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndexedIndirectCountKHR(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndexedIndirectCountKHR(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndexedIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawIndexedIndirectCountKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndirect(dispatch, commandBuffer, buffer, offset, drawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndirect(dispatch, commandBuffer, buffer, offset, drawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndirect(commandBuffer, buffer, offset, drawCount, stride);
+      return DeviceOverrides::CmdDrawIndirect(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, drawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndirectByteCountEXT(VkCommandBuffer commandBuffer, uint32_t instanceCount, uint32_t firstInstance, VkBuffer counterBuffer, VkDeviceSize counterBufferOffset, uint32_t counterOffset, uint32_t vertexStride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndirectByteCountEXT(dispatch, commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndirectByteCountEXT(dispatch, commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndirectByteCountEXT(commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+      return DeviceOverrides::CmdDrawIndirectByteCountEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, instanceCount, firstInstance, counterBuffer, counterBufferOffset, counterOffset, vertexStride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndirectCount(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndirectCount(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndirectCount(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawIndirectCount(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndirectCountAMD(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndirectCountAMD(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndirectCountAMD(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndirectCountAMD(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawIndirectCountAMD(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawIndirectCountKHR(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawIndirectCountKHR(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawIndirectCountKHR(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawIndirectCountKHR(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawIndirectCountKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMeshTasksEXT(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMeshTasksEXT(dispatch, commandBuffer, groupCountX, groupCountY, groupCountZ); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMeshTasksEXT(dispatch, commandBuffer, groupCountX, groupCountY, groupCountZ);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMeshTasksEXT(commandBuffer, groupCountX, groupCountY, groupCountZ);
+      return DeviceOverrides::CmdDrawMeshTasksEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, groupCountX, groupCountY, groupCountZ);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMeshTasksIndirectCountEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMeshTasksIndirectCountEXT(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectCountEXT(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMeshTasksIndirectCountEXT(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectCountEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMeshTasksIndirectCountNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMeshTasksIndirectCountNV(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectCountNV(dispatch, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMeshTasksIndirectCountNV(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectCountNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMeshTasksIndirectEXT(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMeshTasksIndirectEXT(dispatch, commandBuffer, buffer, offset, drawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectEXT(dispatch, commandBuffer, buffer, offset, drawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMeshTasksIndirectEXT(commandBuffer, buffer, offset, drawCount, stride);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, drawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMeshTasksIndirectNV(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMeshTasksIndirectNV(dispatch, commandBuffer, buffer, offset, drawCount, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectNV(dispatch, commandBuffer, buffer, offset, drawCount, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMeshTasksIndirectNV(commandBuffer, buffer, offset, drawCount, stride);
+      return DeviceOverrides::CmdDrawMeshTasksIndirectNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, buffer, offset, drawCount, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMeshTasksNV(VkCommandBuffer commandBuffer, uint32_t taskCount, uint32_t firstTask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMeshTasksNV(dispatch, commandBuffer, taskCount, firstTask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMeshTasksNV(dispatch, commandBuffer, taskCount, firstTask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMeshTasksNV(commandBuffer, taskCount, firstTask);
+      return DeviceOverrides::CmdDrawMeshTasksNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, taskCount, firstTask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMultiEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawInfoEXT *pVertexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMultiEXT(dispatch, commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMultiEXT(dispatch, commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMultiEXT(commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+      return DeviceOverrides::CmdDrawMultiEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, drawCount, pVertexInfo, instanceCount, firstInstance, stride);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdDrawMultiIndexedEXT(VkCommandBuffer commandBuffer, uint32_t drawCount, const VkMultiDrawIndexedInfoEXT *pIndexInfo, uint32_t instanceCount, uint32_t firstInstance, uint32_t stride, const int32_t *pVertexOffset) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdDrawMultiIndexedEXT(dispatch, commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdDrawMultiIndexedEXT(dispatch, commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdDrawMultiIndexedEXT(commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+      return DeviceOverrides::CmdDrawMultiIndexedEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, drawCount, pIndexInfo, instanceCount, firstInstance, stride, pVertexOffset);
+    }
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEncodeVideoKHR(VkCommandBuffer commandBuffer, const VkVideoEncodeInfoKHR *pEncodeInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEncodeVideoKHR(dispatch, commandBuffer, pEncodeInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEncodeVideoKHR(dispatch, commandBuffer, pEncodeInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEncodeVideoKHR(commandBuffer, pEncodeInfo);
+      return DeviceOverrides::CmdEncodeVideoKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pEncodeInfo);
+    }
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndConditionalRenderingEXT(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndConditionalRenderingEXT(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndConditionalRenderingEXT(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndConditionalRenderingEXT(commandBuffer);
+      return DeviceOverrides::CmdEndConditionalRenderingEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndDebugUtilsLabelEXT(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndDebugUtilsLabelEXT(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndDebugUtilsLabelEXT(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndDebugUtilsLabelEXT(commandBuffer);
+      return DeviceOverrides::CmdEndDebugUtilsLabelEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndQuery(dispatch, commandBuffer, queryPool, query); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndQuery(dispatch, commandBuffer, queryPool, query);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndQuery(commandBuffer, queryPool, query);
+      return DeviceOverrides::CmdEndQuery(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, queryPool, query);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndQueryIndexedEXT(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, uint32_t index) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndQueryIndexedEXT(dispatch, commandBuffer, queryPool, query, index); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndQueryIndexedEXT(dispatch, commandBuffer, queryPool, query, index);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndQueryIndexedEXT(commandBuffer, queryPool, query, index);
+      return DeviceOverrides::CmdEndQueryIndexedEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, queryPool, query, index);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndRenderPass(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndRenderPass(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndRenderPass(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndRenderPass(commandBuffer);
+      return DeviceOverrides::CmdEndRenderPass(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndRenderPass2(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndRenderPass2(dispatch, commandBuffer, pSubpassEndInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndRenderPass2(dispatch, commandBuffer, pSubpassEndInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndRenderPass2(commandBuffer, pSubpassEndInfo);
+      return DeviceOverrides::CmdEndRenderPass2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pSubpassEndInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndRenderPass2KHR(VkCommandBuffer commandBuffer, const VkSubpassEndInfo *pSubpassEndInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndRenderPass2KHR(dispatch, commandBuffer, pSubpassEndInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndRenderPass2KHR(dispatch, commandBuffer, pSubpassEndInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndRenderPass2KHR(commandBuffer, pSubpassEndInfo);
+      return DeviceOverrides::CmdEndRenderPass2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pSubpassEndInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndRendering(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndRendering(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndRendering(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndRendering(commandBuffer);
+      return DeviceOverrides::CmdEndRendering(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndRenderingKHR(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndRenderingKHR(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndRenderingKHR(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndRenderingKHR(commandBuffer);
+      return DeviceOverrides::CmdEndRenderingKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndTransformFeedbackEXT(VkCommandBuffer commandBuffer, uint32_t firstCounterBuffer, uint32_t counterBufferCount, const VkBuffer *pCounterBuffers, const VkDeviceSize *pCounterBufferOffsets) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndTransformFeedbackEXT(dispatch, commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndTransformFeedbackEXT(dispatch, commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndTransformFeedbackEXT(commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+      return DeviceOverrides::CmdEndTransformFeedbackEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstCounterBuffer, counterBufferCount, pCounterBuffers, pCounterBufferOffsets);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdEndVideoCodingKHR(VkCommandBuffer commandBuffer, const VkVideoEndCodingInfoKHR *pEndCodingInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdEndVideoCodingKHR(dispatch, commandBuffer, pEndCodingInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdEndVideoCodingKHR(dispatch, commandBuffer, pEndCodingInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdEndVideoCodingKHR(commandBuffer, pEndCodingInfo);
+      return DeviceOverrides::CmdEndVideoCodingKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pEndCodingInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdExecuteCommands(dispatch, commandBuffer, commandBufferCount, pCommandBuffers); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdExecuteCommands(dispatch, commandBuffer, commandBufferCount, pCommandBuffers);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdExecuteCommands(commandBuffer, commandBufferCount, pCommandBuffers);
+      return DeviceOverrides::CmdExecuteCommands(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, commandBufferCount, pCommandBuffers);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdExecuteGeneratedCommandsNV(VkCommandBuffer commandBuffer, VkBool32 isPreprocessed, const VkGeneratedCommandsInfoNV *pGeneratedCommandsInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdExecuteGeneratedCommandsNV(dispatch, commandBuffer, isPreprocessed, pGeneratedCommandsInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdExecuteGeneratedCommandsNV(dispatch, commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdExecuteGeneratedCommandsNV(commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+      return DeviceOverrides::CmdExecuteGeneratedCommandsNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, isPreprocessed, pGeneratedCommandsInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdFillBuffer(dispatch, commandBuffer, dstBuffer, dstOffset, size, data); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdFillBuffer(dispatch, commandBuffer, dstBuffer, dstOffset, size, data);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdFillBuffer(commandBuffer, dstBuffer, dstOffset, size, data);
+      return DeviceOverrides::CmdFillBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, dstBuffer, dstOffset, size, data);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdInsertDebugUtilsLabelEXT(VkCommandBuffer commandBuffer, const VkDebugUtilsLabelEXT *pLabelInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdInsertDebugUtilsLabelEXT(dispatch, commandBuffer, pLabelInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdInsertDebugUtilsLabelEXT(dispatch, commandBuffer, pLabelInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdInsertDebugUtilsLabelEXT(commandBuffer, pLabelInfo);
+      return DeviceOverrides::CmdInsertDebugUtilsLabelEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pLabelInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdNextSubpass(dispatch, commandBuffer, contents); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdNextSubpass(dispatch, commandBuffer, contents);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdNextSubpass(commandBuffer, contents);
+      return DeviceOverrides::CmdNextSubpass(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, contents);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdNextSubpass2(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo, const VkSubpassEndInfo *pSubpassEndInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdNextSubpass2(dispatch, commandBuffer, pSubpassBeginInfo, pSubpassEndInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdNextSubpass2(dispatch, commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdNextSubpass2(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+      return DeviceOverrides::CmdNextSubpass2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdNextSubpass2KHR(VkCommandBuffer commandBuffer, const VkSubpassBeginInfo *pSubpassBeginInfo, const VkSubpassEndInfo *pSubpassEndInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdNextSubpass2KHR(dispatch, commandBuffer, pSubpassBeginInfo, pSubpassEndInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdNextSubpass2KHR(dispatch, commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdNextSubpass2KHR(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+      return DeviceOverrides::CmdNextSubpass2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdOpticalFlowExecuteNV(VkCommandBuffer commandBuffer, VkOpticalFlowSessionNV session, const VkOpticalFlowExecuteInfoNV *pExecuteInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdOpticalFlowExecuteNV(dispatch, commandBuffer, session, pExecuteInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdOpticalFlowExecuteNV(dispatch, commandBuffer, session, pExecuteInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdOpticalFlowExecuteNV(commandBuffer, session, pExecuteInfo);
+      return DeviceOverrides::CmdOpticalFlowExecuteNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, session, pExecuteInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPipelineBarrier(dispatch, commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPipelineBarrier(dispatch, commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPipelineBarrier(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+      return DeviceOverrides::CmdPipelineBarrier(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPipelineBarrier2(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPipelineBarrier2(dispatch, commandBuffer, pDependencyInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPipelineBarrier2(dispatch, commandBuffer, pDependencyInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPipelineBarrier2(commandBuffer, pDependencyInfo);
+      return DeviceOverrides::CmdPipelineBarrier2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pDependencyInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPipelineBarrier2KHR(VkCommandBuffer commandBuffer, const VkDependencyInfo *pDependencyInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPipelineBarrier2KHR(dispatch, commandBuffer, pDependencyInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPipelineBarrier2KHR(dispatch, commandBuffer, pDependencyInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPipelineBarrier2KHR(commandBuffer, pDependencyInfo);
+      return DeviceOverrides::CmdPipelineBarrier2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pDependencyInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPreprocessGeneratedCommandsNV(VkCommandBuffer commandBuffer, const VkGeneratedCommandsInfoNV *pGeneratedCommandsInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPreprocessGeneratedCommandsNV(dispatch, commandBuffer, pGeneratedCommandsInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPreprocessGeneratedCommandsNV(dispatch, commandBuffer, pGeneratedCommandsInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPreprocessGeneratedCommandsNV(commandBuffer, pGeneratedCommandsInfo);
+      return DeviceOverrides::CmdPreprocessGeneratedCommandsNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pGeneratedCommandsInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, const void *pValues) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPushConstants(dispatch, commandBuffer, layout, stageFlags, offset, size, pValues); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPushConstants(dispatch, commandBuffer, layout, stageFlags, offset, size, pValues);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPushConstants(commandBuffer, layout, stageFlags, offset, size, pValues);
+      return DeviceOverrides::CmdPushConstants(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, layout, stageFlags, offset, size, pValues);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPushDescriptorSetKHR(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t set, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPushDescriptorSetKHR(dispatch, commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPushDescriptorSetKHR(dispatch, commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPushDescriptorSetKHR(commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+      return DeviceOverrides::CmdPushDescriptorSetKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdPushDescriptorSetWithTemplateKHR(VkCommandBuffer commandBuffer, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkPipelineLayout layout, uint32_t set, const void *pData) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdPushDescriptorSetWithTemplateKHR(dispatch, commandBuffer, descriptorUpdateTemplate, layout, set, pData); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdPushDescriptorSetWithTemplateKHR(dispatch, commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdPushDescriptorSetWithTemplateKHR(commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+      return DeviceOverrides::CmdPushDescriptorSetWithTemplateKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, descriptorUpdateTemplate, layout, set, pData);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResetEvent(dispatch, commandBuffer, event, stageMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResetEvent(dispatch, commandBuffer, event, stageMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResetEvent(commandBuffer, event, stageMask);
+      return DeviceOverrides::CmdResetEvent(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, event, stageMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResetEvent2(dispatch, commandBuffer, event, stageMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResetEvent2(dispatch, commandBuffer, event, stageMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResetEvent2(commandBuffer, event, stageMask);
+      return DeviceOverrides::CmdResetEvent2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, event, stageMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResetEvent2KHR(dispatch, commandBuffer, event, stageMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResetEvent2KHR(dispatch, commandBuffer, event, stageMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResetEvent2KHR(commandBuffer, event, stageMask);
+      return DeviceOverrides::CmdResetEvent2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, event, stageMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResetQueryPool(dispatch, commandBuffer, queryPool, firstQuery, queryCount); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResetQueryPool(dispatch, commandBuffer, queryPool, firstQuery, queryCount);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResetQueryPool(commandBuffer, queryPool, firstQuery, queryCount);
+      return DeviceOverrides::CmdResetQueryPool(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, queryPool, firstQuery, queryCount);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, const VkImageResolve *pRegions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResolveImage(dispatch, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResolveImage(dispatch, commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResolveImage(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+      return DeviceOverrides::CmdResolveImage(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResolveImage2(VkCommandBuffer commandBuffer, const VkResolveImageInfo2 *pResolveImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResolveImage2(dispatch, commandBuffer, pResolveImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResolveImage2(dispatch, commandBuffer, pResolveImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResolveImage2(commandBuffer, pResolveImageInfo);
+      return DeviceOverrides::CmdResolveImage2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pResolveImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdResolveImage2KHR(VkCommandBuffer commandBuffer, const VkResolveImageInfo2 *pResolveImageInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdResolveImage2KHR(dispatch, commandBuffer, pResolveImageInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdResolveImage2KHR(dispatch, commandBuffer, pResolveImageInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdResolveImage2KHR(commandBuffer, pResolveImageInfo);
+      return DeviceOverrides::CmdResolveImage2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pResolveImageInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetAlphaToCoverageEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToCoverageEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetAlphaToCoverageEnableEXT(dispatch, commandBuffer, alphaToCoverageEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetAlphaToCoverageEnableEXT(dispatch, commandBuffer, alphaToCoverageEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetAlphaToCoverageEnableEXT(commandBuffer, alphaToCoverageEnable);
+      return DeviceOverrides::CmdSetAlphaToCoverageEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, alphaToCoverageEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetAlphaToOneEnableEXT(VkCommandBuffer commandBuffer, VkBool32 alphaToOneEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetAlphaToOneEnableEXT(dispatch, commandBuffer, alphaToOneEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetAlphaToOneEnableEXT(dispatch, commandBuffer, alphaToOneEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetAlphaToOneEnableEXT(commandBuffer, alphaToOneEnable);
+      return DeviceOverrides::CmdSetAlphaToOneEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, alphaToOneEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetAttachmentFeedbackLoopEnableEXT(VkCommandBuffer commandBuffer, VkImageAspectFlags aspectMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetAttachmentFeedbackLoopEnableEXT(dispatch, commandBuffer, aspectMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetAttachmentFeedbackLoopEnableEXT(dispatch, commandBuffer, aspectMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetAttachmentFeedbackLoopEnableEXT(commandBuffer, aspectMask);
+      return DeviceOverrides::CmdSetAttachmentFeedbackLoopEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, aspectMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetBlendConstants(VkCommandBuffer commandBuffer, const float blendConstants[4]) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetBlendConstants(dispatch, commandBuffer, blendConstants); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetBlendConstants(dispatch, commandBuffer, blendConstants);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetBlendConstants(commandBuffer, blendConstants);
+      return DeviceOverrides::CmdSetBlendConstants(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, blendConstants);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCheckpointNV(VkCommandBuffer commandBuffer, const void *pCheckpointMarker) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCheckpointNV(dispatch, commandBuffer, pCheckpointMarker); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCheckpointNV(dispatch, commandBuffer, pCheckpointMarker);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCheckpointNV(commandBuffer, pCheckpointMarker);
+      return DeviceOverrides::CmdSetCheckpointNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pCheckpointMarker);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoarseSampleOrderNV(VkCommandBuffer commandBuffer, VkCoarseSampleOrderTypeNV sampleOrderType, uint32_t customSampleOrderCount, const VkCoarseSampleOrderCustomNV *pCustomSampleOrders) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoarseSampleOrderNV(dispatch, commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoarseSampleOrderNV(dispatch, commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoarseSampleOrderNV(commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+      return DeviceOverrides::CmdSetCoarseSampleOrderNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, sampleOrderType, customSampleOrderCount, pCustomSampleOrders);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetColorBlendAdvancedEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendAdvancedEXT *pColorBlendAdvanced) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetColorBlendAdvancedEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetColorBlendAdvancedEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetColorBlendAdvancedEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+      return DeviceOverrides::CmdSetColorBlendAdvancedEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstAttachment, attachmentCount, pColorBlendAdvanced);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetColorBlendEnableEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkBool32 *pColorBlendEnables) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetColorBlendEnableEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetColorBlendEnableEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetColorBlendEnableEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+      return DeviceOverrides::CmdSetColorBlendEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstAttachment, attachmentCount, pColorBlendEnables);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetColorBlendEquationEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorBlendEquationEXT *pColorBlendEquations) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetColorBlendEquationEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetColorBlendEquationEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetColorBlendEquationEXT(commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+      return DeviceOverrides::CmdSetColorBlendEquationEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstAttachment, attachmentCount, pColorBlendEquations);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetColorWriteEnableEXT(VkCommandBuffer commandBuffer, uint32_t attachmentCount, const VkBool32 *pColorWriteEnables) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetColorWriteEnableEXT(dispatch, commandBuffer, attachmentCount, pColorWriteEnables); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetColorWriteEnableEXT(dispatch, commandBuffer, attachmentCount, pColorWriteEnables);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetColorWriteEnableEXT(commandBuffer, attachmentCount, pColorWriteEnables);
+      return DeviceOverrides::CmdSetColorWriteEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, attachmentCount, pColorWriteEnables);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetColorWriteMaskEXT(VkCommandBuffer commandBuffer, uint32_t firstAttachment, uint32_t attachmentCount, const VkColorComponentFlags *pColorWriteMasks) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetColorWriteMaskEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetColorWriteMaskEXT(dispatch, commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetColorWriteMaskEXT(commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+      return DeviceOverrides::CmdSetColorWriteMaskEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstAttachment, attachmentCount, pColorWriteMasks);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetConservativeRasterizationModeEXT(VkCommandBuffer commandBuffer, VkConservativeRasterizationModeEXT conservativeRasterizationMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetConservativeRasterizationModeEXT(dispatch, commandBuffer, conservativeRasterizationMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetConservativeRasterizationModeEXT(dispatch, commandBuffer, conservativeRasterizationMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetConservativeRasterizationModeEXT(commandBuffer, conservativeRasterizationMode);
+      return DeviceOverrides::CmdSetConservativeRasterizationModeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, conservativeRasterizationMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoverageModulationModeNV(VkCommandBuffer commandBuffer, VkCoverageModulationModeNV coverageModulationMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoverageModulationModeNV(dispatch, commandBuffer, coverageModulationMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoverageModulationModeNV(dispatch, commandBuffer, coverageModulationMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoverageModulationModeNV(commandBuffer, coverageModulationMode);
+      return DeviceOverrides::CmdSetCoverageModulationModeNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, coverageModulationMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoverageModulationTableEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageModulationTableEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoverageModulationTableEnableNV(dispatch, commandBuffer, coverageModulationTableEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoverageModulationTableEnableNV(dispatch, commandBuffer, coverageModulationTableEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoverageModulationTableEnableNV(commandBuffer, coverageModulationTableEnable);
+      return DeviceOverrides::CmdSetCoverageModulationTableEnableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, coverageModulationTableEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoverageModulationTableNV(VkCommandBuffer commandBuffer, uint32_t coverageModulationTableCount, const float *pCoverageModulationTable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoverageModulationTableNV(dispatch, commandBuffer, coverageModulationTableCount, pCoverageModulationTable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoverageModulationTableNV(dispatch, commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoverageModulationTableNV(commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+      return DeviceOverrides::CmdSetCoverageModulationTableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, coverageModulationTableCount, pCoverageModulationTable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoverageReductionModeNV(VkCommandBuffer commandBuffer, VkCoverageReductionModeNV coverageReductionMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoverageReductionModeNV(dispatch, commandBuffer, coverageReductionMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoverageReductionModeNV(dispatch, commandBuffer, coverageReductionMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoverageReductionModeNV(commandBuffer, coverageReductionMode);
+      return DeviceOverrides::CmdSetCoverageReductionModeNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, coverageReductionMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoverageToColorEnableNV(VkCommandBuffer commandBuffer, VkBool32 coverageToColorEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoverageToColorEnableNV(dispatch, commandBuffer, coverageToColorEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoverageToColorEnableNV(dispatch, commandBuffer, coverageToColorEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoverageToColorEnableNV(commandBuffer, coverageToColorEnable);
+      return DeviceOverrides::CmdSetCoverageToColorEnableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, coverageToColorEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCoverageToColorLocationNV(VkCommandBuffer commandBuffer, uint32_t coverageToColorLocation) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCoverageToColorLocationNV(dispatch, commandBuffer, coverageToColorLocation); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCoverageToColorLocationNV(dispatch, commandBuffer, coverageToColorLocation);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCoverageToColorLocationNV(commandBuffer, coverageToColorLocation);
+      return DeviceOverrides::CmdSetCoverageToColorLocationNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, coverageToColorLocation);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCullMode(dispatch, commandBuffer, cullMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCullMode(dispatch, commandBuffer, cullMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCullMode(commandBuffer, cullMode);
+      return DeviceOverrides::CmdSetCullMode(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, cullMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetCullModeEXT(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetCullModeEXT(dispatch, commandBuffer, cullMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetCullModeEXT(dispatch, commandBuffer, cullMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetCullModeEXT(commandBuffer, cullMode);
+      return DeviceOverrides::CmdSetCullModeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, cullMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthBias(dispatch, commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthBias(dispatch, commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthBias(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+      return DeviceOverrides::CmdSetDepthBias(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthBiasEnable(dispatch, commandBuffer, depthBiasEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthBiasEnable(dispatch, commandBuffer, depthBiasEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthBiasEnable(commandBuffer, depthBiasEnable);
+      return DeviceOverrides::CmdSetDepthBiasEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthBiasEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthBiasEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthBiasEnableEXT(dispatch, commandBuffer, depthBiasEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthBiasEnableEXT(dispatch, commandBuffer, depthBiasEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthBiasEnableEXT(commandBuffer, depthBiasEnable);
+      return DeviceOverrides::CmdSetDepthBiasEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthBiasEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthBounds(dispatch, commandBuffer, minDepthBounds, maxDepthBounds); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthBounds(dispatch, commandBuffer, minDepthBounds, maxDepthBounds);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthBounds(commandBuffer, minDepthBounds, maxDepthBounds);
+      return DeviceOverrides::CmdSetDepthBounds(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, minDepthBounds, maxDepthBounds);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthBoundsTestEnable(dispatch, commandBuffer, depthBoundsTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthBoundsTestEnable(dispatch, commandBuffer, depthBoundsTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthBoundsTestEnable(commandBuffer, depthBoundsTestEnable);
+      return DeviceOverrides::CmdSetDepthBoundsTestEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthBoundsTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthBoundsTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthBoundsTestEnableEXT(dispatch, commandBuffer, depthBoundsTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthBoundsTestEnableEXT(dispatch, commandBuffer, depthBoundsTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthBoundsTestEnableEXT(commandBuffer, depthBoundsTestEnable);
+      return DeviceOverrides::CmdSetDepthBoundsTestEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthBoundsTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthClampEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClampEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthClampEnableEXT(dispatch, commandBuffer, depthClampEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthClampEnableEXT(dispatch, commandBuffer, depthClampEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthClampEnableEXT(commandBuffer, depthClampEnable);
+      return DeviceOverrides::CmdSetDepthClampEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthClampEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthClipEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthClipEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthClipEnableEXT(dispatch, commandBuffer, depthClipEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthClipEnableEXT(dispatch, commandBuffer, depthClipEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthClipEnableEXT(commandBuffer, depthClipEnable);
+      return DeviceOverrides::CmdSetDepthClipEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthClipEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthClipNegativeOneToOneEXT(VkCommandBuffer commandBuffer, VkBool32 negativeOneToOne) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthClipNegativeOneToOneEXT(dispatch, commandBuffer, negativeOneToOne); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthClipNegativeOneToOneEXT(dispatch, commandBuffer, negativeOneToOne);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthClipNegativeOneToOneEXT(commandBuffer, negativeOneToOne);
+      return DeviceOverrides::CmdSetDepthClipNegativeOneToOneEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, negativeOneToOne);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthCompareOp(dispatch, commandBuffer, depthCompareOp); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthCompareOp(dispatch, commandBuffer, depthCompareOp);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthCompareOp(commandBuffer, depthCompareOp);
+      return DeviceOverrides::CmdSetDepthCompareOp(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthCompareOp);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthCompareOpEXT(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthCompareOpEXT(dispatch, commandBuffer, depthCompareOp); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthCompareOpEXT(dispatch, commandBuffer, depthCompareOp);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthCompareOpEXT(commandBuffer, depthCompareOp);
+      return DeviceOverrides::CmdSetDepthCompareOpEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthCompareOp);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthTestEnable(dispatch, commandBuffer, depthTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthTestEnable(dispatch, commandBuffer, depthTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthTestEnable(commandBuffer, depthTestEnable);
+      return DeviceOverrides::CmdSetDepthTestEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthTestEnableEXT(dispatch, commandBuffer, depthTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthTestEnableEXT(dispatch, commandBuffer, depthTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthTestEnableEXT(commandBuffer, depthTestEnable);
+      return DeviceOverrides::CmdSetDepthTestEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthWriteEnable(dispatch, commandBuffer, depthWriteEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthWriteEnable(dispatch, commandBuffer, depthWriteEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthWriteEnable(commandBuffer, depthWriteEnable);
+      return DeviceOverrides::CmdSetDepthWriteEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthWriteEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDepthWriteEnableEXT(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDepthWriteEnableEXT(dispatch, commandBuffer, depthWriteEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDepthWriteEnableEXT(dispatch, commandBuffer, depthWriteEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDepthWriteEnableEXT(commandBuffer, depthWriteEnable);
+      return DeviceOverrides::CmdSetDepthWriteEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, depthWriteEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDescriptorBufferOffsetsEXT(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t setCount, const uint32_t *pBufferIndices, const VkDeviceSize *pOffsets) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDescriptorBufferOffsetsEXT(dispatch, commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDescriptorBufferOffsetsEXT(dispatch, commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDescriptorBufferOffsetsEXT(commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+      return DeviceOverrides::CmdSetDescriptorBufferOffsetsEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDeviceMask(dispatch, commandBuffer, deviceMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDeviceMask(dispatch, commandBuffer, deviceMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDeviceMask(commandBuffer, deviceMask);
+      return DeviceOverrides::CmdSetDeviceMask(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, deviceMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDeviceMaskKHR(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDeviceMaskKHR(dispatch, commandBuffer, deviceMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDeviceMaskKHR(dispatch, commandBuffer, deviceMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDeviceMaskKHR(commandBuffer, deviceMask);
+      return DeviceOverrides::CmdSetDeviceMaskKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, deviceMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDiscardRectangleEXT(VkCommandBuffer commandBuffer, uint32_t firstDiscardRectangle, uint32_t discardRectangleCount, const VkRect2D *pDiscardRectangles) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDiscardRectangleEXT(dispatch, commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDiscardRectangleEXT(dispatch, commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDiscardRectangleEXT(commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+      return DeviceOverrides::CmdSetDiscardRectangleEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstDiscardRectangle, discardRectangleCount, pDiscardRectangles);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDiscardRectangleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 discardRectangleEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDiscardRectangleEnableEXT(dispatch, commandBuffer, discardRectangleEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDiscardRectangleEnableEXT(dispatch, commandBuffer, discardRectangleEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDiscardRectangleEnableEXT(commandBuffer, discardRectangleEnable);
+      return DeviceOverrides::CmdSetDiscardRectangleEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, discardRectangleEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetDiscardRectangleModeEXT(VkCommandBuffer commandBuffer, VkDiscardRectangleModeEXT discardRectangleMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetDiscardRectangleModeEXT(dispatch, commandBuffer, discardRectangleMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetDiscardRectangleModeEXT(dispatch, commandBuffer, discardRectangleMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetDiscardRectangleModeEXT(commandBuffer, discardRectangleMode);
+      return DeviceOverrides::CmdSetDiscardRectangleModeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, discardRectangleMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetEvent(dispatch, commandBuffer, event, stageMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetEvent(dispatch, commandBuffer, event, stageMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetEvent(commandBuffer, event, stageMask);
+      return DeviceOverrides::CmdSetEvent(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, event, stageMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo *pDependencyInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetEvent2(dispatch, commandBuffer, event, pDependencyInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetEvent2(dispatch, commandBuffer, event, pDependencyInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetEvent2(commandBuffer, event, pDependencyInfo);
+      return DeviceOverrides::CmdSetEvent2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, event, pDependencyInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetEvent2KHR(VkCommandBuffer commandBuffer, VkEvent event, const VkDependencyInfo *pDependencyInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetEvent2KHR(dispatch, commandBuffer, event, pDependencyInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetEvent2KHR(dispatch, commandBuffer, event, pDependencyInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetEvent2KHR(commandBuffer, event, pDependencyInfo);
+      return DeviceOverrides::CmdSetEvent2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, event, pDependencyInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetExclusiveScissorEnableNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkBool32 *pExclusiveScissorEnables) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetExclusiveScissorEnableNV(dispatch, commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissorEnables); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetExclusiveScissorEnableNV(dispatch, commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissorEnables);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetExclusiveScissorEnableNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissorEnables);
+      return DeviceOverrides::CmdSetExclusiveScissorEnableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissorEnables);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetExclusiveScissorNV(VkCommandBuffer commandBuffer, uint32_t firstExclusiveScissor, uint32_t exclusiveScissorCount, const VkRect2D *pExclusiveScissors) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetExclusiveScissorNV(dispatch, commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetExclusiveScissorNV(dispatch, commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetExclusiveScissorNV(commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+      return DeviceOverrides::CmdSetExclusiveScissorNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstExclusiveScissor, exclusiveScissorCount, pExclusiveScissors);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetExtraPrimitiveOverestimationSizeEXT(VkCommandBuffer commandBuffer, float extraPrimitiveOverestimationSize) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetExtraPrimitiveOverestimationSizeEXT(dispatch, commandBuffer, extraPrimitiveOverestimationSize); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetExtraPrimitiveOverestimationSizeEXT(dispatch, commandBuffer, extraPrimitiveOverestimationSize);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetExtraPrimitiveOverestimationSizeEXT(commandBuffer, extraPrimitiveOverestimationSize);
+      return DeviceOverrides::CmdSetExtraPrimitiveOverestimationSizeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, extraPrimitiveOverestimationSize);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetFragmentShadingRateEnumNV(VkCommandBuffer commandBuffer, VkFragmentShadingRateNV shadingRate, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetFragmentShadingRateEnumNV(dispatch, commandBuffer, shadingRate, combinerOps); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetFragmentShadingRateEnumNV(dispatch, commandBuffer, shadingRate, combinerOps);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetFragmentShadingRateEnumNV(commandBuffer, shadingRate, combinerOps);
+      return DeviceOverrides::CmdSetFragmentShadingRateEnumNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, shadingRate, combinerOps);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetFragmentShadingRateKHR(VkCommandBuffer commandBuffer, const VkExtent2D *pFragmentSize, const VkFragmentShadingRateCombinerOpKHR combinerOps[2]) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetFragmentShadingRateKHR(dispatch, commandBuffer, pFragmentSize, combinerOps); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetFragmentShadingRateKHR(dispatch, commandBuffer, pFragmentSize, combinerOps);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetFragmentShadingRateKHR(commandBuffer, pFragmentSize, combinerOps);
+      return DeviceOverrides::CmdSetFragmentShadingRateKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pFragmentSize, combinerOps);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetFrontFace(dispatch, commandBuffer, frontFace); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetFrontFace(dispatch, commandBuffer, frontFace);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetFrontFace(commandBuffer, frontFace);
+      return DeviceOverrides::CmdSetFrontFace(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, frontFace);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetFrontFaceEXT(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetFrontFaceEXT(dispatch, commandBuffer, frontFace); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetFrontFaceEXT(dispatch, commandBuffer, frontFace);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetFrontFaceEXT(commandBuffer, frontFace);
+      return DeviceOverrides::CmdSetFrontFaceEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, frontFace);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetLineRasterizationModeEXT(VkCommandBuffer commandBuffer, VkLineRasterizationModeEXT lineRasterizationMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetLineRasterizationModeEXT(dispatch, commandBuffer, lineRasterizationMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetLineRasterizationModeEXT(dispatch, commandBuffer, lineRasterizationMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetLineRasterizationModeEXT(commandBuffer, lineRasterizationMode);
+      return DeviceOverrides::CmdSetLineRasterizationModeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, lineRasterizationMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetLineStippleEXT(VkCommandBuffer commandBuffer, uint32_t lineStippleFactor, uint16_t lineStipplePattern) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetLineStippleEXT(dispatch, commandBuffer, lineStippleFactor, lineStipplePattern); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetLineStippleEXT(dispatch, commandBuffer, lineStippleFactor, lineStipplePattern);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetLineStippleEXT(commandBuffer, lineStippleFactor, lineStipplePattern);
+      return DeviceOverrides::CmdSetLineStippleEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, lineStippleFactor, lineStipplePattern);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetLineStippleEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stippledLineEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetLineStippleEnableEXT(dispatch, commandBuffer, stippledLineEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetLineStippleEnableEXT(dispatch, commandBuffer, stippledLineEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetLineStippleEnableEXT(commandBuffer, stippledLineEnable);
+      return DeviceOverrides::CmdSetLineStippleEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stippledLineEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetLineWidth(dispatch, commandBuffer, lineWidth); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetLineWidth(dispatch, commandBuffer, lineWidth);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetLineWidth(commandBuffer, lineWidth);
+      return DeviceOverrides::CmdSetLineWidth(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, lineWidth);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetLogicOpEXT(VkCommandBuffer commandBuffer, VkLogicOp logicOp) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetLogicOpEXT(dispatch, commandBuffer, logicOp); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetLogicOpEXT(dispatch, commandBuffer, logicOp);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetLogicOpEXT(commandBuffer, logicOp);
+      return DeviceOverrides::CmdSetLogicOpEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, logicOp);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetLogicOpEnableEXT(VkCommandBuffer commandBuffer, VkBool32 logicOpEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetLogicOpEnableEXT(dispatch, commandBuffer, logicOpEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetLogicOpEnableEXT(dispatch, commandBuffer, logicOpEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetLogicOpEnableEXT(commandBuffer, logicOpEnable);
+      return DeviceOverrides::CmdSetLogicOpEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, logicOpEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetPatchControlPointsEXT(VkCommandBuffer commandBuffer, uint32_t patchControlPoints) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPatchControlPointsEXT(dispatch, commandBuffer, patchControlPoints); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPatchControlPointsEXT(dispatch, commandBuffer, patchControlPoints);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPatchControlPointsEXT(commandBuffer, patchControlPoints);
+      return DeviceOverrides::CmdSetPatchControlPointsEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, patchControlPoints);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CmdSetPerformanceMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceMarkerInfoINTEL *pMarkerInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPerformanceMarkerINTEL(dispatch, commandBuffer, pMarkerInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPerformanceMarkerINTEL(dispatch, commandBuffer, pMarkerInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPerformanceMarkerINTEL(commandBuffer, pMarkerInfo);
+      return DeviceOverrides::CmdSetPerformanceMarkerINTEL(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pMarkerInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CmdSetPerformanceOverrideINTEL(VkCommandBuffer commandBuffer, const VkPerformanceOverrideInfoINTEL *pOverrideInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPerformanceOverrideINTEL(dispatch, commandBuffer, pOverrideInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPerformanceOverrideINTEL(dispatch, commandBuffer, pOverrideInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPerformanceOverrideINTEL(commandBuffer, pOverrideInfo);
+      return DeviceOverrides::CmdSetPerformanceOverrideINTEL(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pOverrideInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CmdSetPerformanceStreamMarkerINTEL(VkCommandBuffer commandBuffer, const VkPerformanceStreamMarkerInfoINTEL *pMarkerInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPerformanceStreamMarkerINTEL(dispatch, commandBuffer, pMarkerInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPerformanceStreamMarkerINTEL(dispatch, commandBuffer, pMarkerInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPerformanceStreamMarkerINTEL(commandBuffer, pMarkerInfo);
+      return DeviceOverrides::CmdSetPerformanceStreamMarkerINTEL(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pMarkerInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetPolygonModeEXT(VkCommandBuffer commandBuffer, VkPolygonMode polygonMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPolygonModeEXT(dispatch, commandBuffer, polygonMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPolygonModeEXT(dispatch, commandBuffer, polygonMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPolygonModeEXT(commandBuffer, polygonMode);
+      return DeviceOverrides::CmdSetPolygonModeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, polygonMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPrimitiveRestartEnable(dispatch, commandBuffer, primitiveRestartEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPrimitiveRestartEnable(dispatch, commandBuffer, primitiveRestartEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPrimitiveRestartEnable(commandBuffer, primitiveRestartEnable);
+      return DeviceOverrides::CmdSetPrimitiveRestartEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, primitiveRestartEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetPrimitiveRestartEnableEXT(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPrimitiveRestartEnableEXT(dispatch, commandBuffer, primitiveRestartEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPrimitiveRestartEnableEXT(dispatch, commandBuffer, primitiveRestartEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPrimitiveRestartEnableEXT(commandBuffer, primitiveRestartEnable);
+      return DeviceOverrides::CmdSetPrimitiveRestartEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, primitiveRestartEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPrimitiveTopology(dispatch, commandBuffer, primitiveTopology); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPrimitiveTopology(dispatch, commandBuffer, primitiveTopology);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPrimitiveTopology(commandBuffer, primitiveTopology);
+      return DeviceOverrides::CmdSetPrimitiveTopology(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, primitiveTopology);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetPrimitiveTopologyEXT(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetPrimitiveTopologyEXT(dispatch, commandBuffer, primitiveTopology); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetPrimitiveTopologyEXT(dispatch, commandBuffer, primitiveTopology);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetPrimitiveTopologyEXT(commandBuffer, primitiveTopology);
+      return DeviceOverrides::CmdSetPrimitiveTopologyEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, primitiveTopology);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetProvokingVertexModeEXT(VkCommandBuffer commandBuffer, VkProvokingVertexModeEXT provokingVertexMode) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetProvokingVertexModeEXT(dispatch, commandBuffer, provokingVertexMode); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetProvokingVertexModeEXT(dispatch, commandBuffer, provokingVertexMode);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetProvokingVertexModeEXT(commandBuffer, provokingVertexMode);
+      return DeviceOverrides::CmdSetProvokingVertexModeEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, provokingVertexMode);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetRasterizationSamplesEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits rasterizationSamples) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetRasterizationSamplesEXT(dispatch, commandBuffer, rasterizationSamples); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetRasterizationSamplesEXT(dispatch, commandBuffer, rasterizationSamples);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetRasterizationSamplesEXT(commandBuffer, rasterizationSamples);
+      return DeviceOverrides::CmdSetRasterizationSamplesEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, rasterizationSamples);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetRasterizationStreamEXT(VkCommandBuffer commandBuffer, uint32_t rasterizationStream) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetRasterizationStreamEXT(dispatch, commandBuffer, rasterizationStream); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetRasterizationStreamEXT(dispatch, commandBuffer, rasterizationStream);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetRasterizationStreamEXT(commandBuffer, rasterizationStream);
+      return DeviceOverrides::CmdSetRasterizationStreamEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, rasterizationStream);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetRasterizerDiscardEnable(dispatch, commandBuffer, rasterizerDiscardEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetRasterizerDiscardEnable(dispatch, commandBuffer, rasterizerDiscardEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetRasterizerDiscardEnable(commandBuffer, rasterizerDiscardEnable);
+      return DeviceOverrides::CmdSetRasterizerDiscardEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, rasterizerDiscardEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetRasterizerDiscardEnableEXT(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetRasterizerDiscardEnableEXT(dispatch, commandBuffer, rasterizerDiscardEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetRasterizerDiscardEnableEXT(dispatch, commandBuffer, rasterizerDiscardEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetRasterizerDiscardEnableEXT(commandBuffer, rasterizerDiscardEnable);
+      return DeviceOverrides::CmdSetRasterizerDiscardEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, rasterizerDiscardEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetRayTracingPipelineStackSizeKHR(VkCommandBuffer commandBuffer, uint32_t pipelineStackSize) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetRayTracingPipelineStackSizeKHR(dispatch, commandBuffer, pipelineStackSize); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetRayTracingPipelineStackSizeKHR(dispatch, commandBuffer, pipelineStackSize);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetRayTracingPipelineStackSizeKHR(commandBuffer, pipelineStackSize);
+      return DeviceOverrides::CmdSetRayTracingPipelineStackSizeKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineStackSize);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetRepresentativeFragmentTestEnableNV(VkCommandBuffer commandBuffer, VkBool32 representativeFragmentTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetRepresentativeFragmentTestEnableNV(dispatch, commandBuffer, representativeFragmentTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetRepresentativeFragmentTestEnableNV(dispatch, commandBuffer, representativeFragmentTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetRepresentativeFragmentTestEnableNV(commandBuffer, representativeFragmentTestEnable);
+      return DeviceOverrides::CmdSetRepresentativeFragmentTestEnableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, representativeFragmentTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetSampleLocationsEXT(VkCommandBuffer commandBuffer, const VkSampleLocationsInfoEXT *pSampleLocationsInfo) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetSampleLocationsEXT(dispatch, commandBuffer, pSampleLocationsInfo); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetSampleLocationsEXT(dispatch, commandBuffer, pSampleLocationsInfo);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetSampleLocationsEXT(commandBuffer, pSampleLocationsInfo);
+      return DeviceOverrides::CmdSetSampleLocationsEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pSampleLocationsInfo);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetSampleLocationsEnableEXT(VkCommandBuffer commandBuffer, VkBool32 sampleLocationsEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetSampleLocationsEnableEXT(dispatch, commandBuffer, sampleLocationsEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetSampleLocationsEnableEXT(dispatch, commandBuffer, sampleLocationsEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetSampleLocationsEnableEXT(commandBuffer, sampleLocationsEnable);
+      return DeviceOverrides::CmdSetSampleLocationsEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, sampleLocationsEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetSampleMaskEXT(VkCommandBuffer commandBuffer, VkSampleCountFlagBits samples, const VkSampleMask *pSampleMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetSampleMaskEXT(dispatch, commandBuffer, samples, pSampleMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetSampleMaskEXT(dispatch, commandBuffer, samples, pSampleMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetSampleMaskEXT(commandBuffer, samples, pSampleMask);
+      return DeviceOverrides::CmdSetSampleMaskEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, samples, pSampleMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *pScissors) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetScissor(dispatch, commandBuffer, firstScissor, scissorCount, pScissors); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetScissor(dispatch, commandBuffer, firstScissor, scissorCount, pScissors);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetScissor(commandBuffer, firstScissor, scissorCount, pScissors);
+      return DeviceOverrides::CmdSetScissor(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstScissor, scissorCount, pScissors);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D *pScissors) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetScissorWithCount(dispatch, commandBuffer, scissorCount, pScissors); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetScissorWithCount(dispatch, commandBuffer, scissorCount, pScissors);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetScissorWithCount(commandBuffer, scissorCount, pScissors);
+      return DeviceOverrides::CmdSetScissorWithCount(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, scissorCount, pScissors);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetScissorWithCountEXT(VkCommandBuffer commandBuffer, uint32_t scissorCount, const VkRect2D *pScissors) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetScissorWithCountEXT(dispatch, commandBuffer, scissorCount, pScissors); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetScissorWithCountEXT(dispatch, commandBuffer, scissorCount, pScissors);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetScissorWithCountEXT(commandBuffer, scissorCount, pScissors);
+      return DeviceOverrides::CmdSetScissorWithCountEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, scissorCount, pScissors);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetShadingRateImageEnableNV(VkCommandBuffer commandBuffer, VkBool32 shadingRateImageEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetShadingRateImageEnableNV(dispatch, commandBuffer, shadingRateImageEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetShadingRateImageEnableNV(dispatch, commandBuffer, shadingRateImageEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetShadingRateImageEnableNV(commandBuffer, shadingRateImageEnable);
+      return DeviceOverrides::CmdSetShadingRateImageEnableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, shadingRateImageEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilCompareMask(dispatch, commandBuffer, faceMask, compareMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilCompareMask(dispatch, commandBuffer, faceMask, compareMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilCompareMask(commandBuffer, faceMask, compareMask);
+      return DeviceOverrides::CmdSetStencilCompareMask(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, faceMask, compareMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilOp(dispatch, commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilOp(dispatch, commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilOp(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+      return DeviceOverrides::CmdSetStencilOp(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilOpEXT(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilOpEXT(dispatch, commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilOpEXT(dispatch, commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilOpEXT(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+      return DeviceOverrides::CmdSetStencilOpEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilReference(dispatch, commandBuffer, faceMask, reference); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilReference(dispatch, commandBuffer, faceMask, reference);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilReference(commandBuffer, faceMask, reference);
+      return DeviceOverrides::CmdSetStencilReference(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, faceMask, reference);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilTestEnable(dispatch, commandBuffer, stencilTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilTestEnable(dispatch, commandBuffer, stencilTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilTestEnable(commandBuffer, stencilTestEnable);
+      return DeviceOverrides::CmdSetStencilTestEnable(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stencilTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilTestEnableEXT(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilTestEnableEXT(dispatch, commandBuffer, stencilTestEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilTestEnableEXT(dispatch, commandBuffer, stencilTestEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilTestEnableEXT(commandBuffer, stencilTestEnable);
+      return DeviceOverrides::CmdSetStencilTestEnableEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stencilTestEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetStencilWriteMask(dispatch, commandBuffer, faceMask, writeMask); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetStencilWriteMask(dispatch, commandBuffer, faceMask, writeMask);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetStencilWriteMask(commandBuffer, faceMask, writeMask);
+      return DeviceOverrides::CmdSetStencilWriteMask(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, faceMask, writeMask);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetTessellationDomainOriginEXT(VkCommandBuffer commandBuffer, VkTessellationDomainOrigin domainOrigin) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetTessellationDomainOriginEXT(dispatch, commandBuffer, domainOrigin); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetTessellationDomainOriginEXT(dispatch, commandBuffer, domainOrigin);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetTessellationDomainOriginEXT(commandBuffer, domainOrigin);
+      return DeviceOverrides::CmdSetTessellationDomainOriginEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, domainOrigin);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetVertexInputEXT(VkCommandBuffer commandBuffer, uint32_t vertexBindingDescriptionCount, const VkVertexInputBindingDescription2EXT *pVertexBindingDescriptions, uint32_t vertexAttributeDescriptionCount, const VkVertexInputAttributeDescription2EXT *pVertexAttributeDescriptions) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetVertexInputEXT(dispatch, commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetVertexInputEXT(dispatch, commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetVertexInputEXT(commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+      return DeviceOverrides::CmdSetVertexInputEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, vertexBindingDescriptionCount, pVertexBindingDescriptions, vertexAttributeDescriptionCount, pVertexAttributeDescriptions);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewport *pViewports) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewport(dispatch, commandBuffer, firstViewport, viewportCount, pViewports); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewport(dispatch, commandBuffer, firstViewport, viewportCount, pViewports);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewport(commandBuffer, firstViewport, viewportCount, pViewports);
+      return DeviceOverrides::CmdSetViewport(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstViewport, viewportCount, pViewports);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewportShadingRatePaletteNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkShadingRatePaletteNV *pShadingRatePalettes) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewportShadingRatePaletteNV(dispatch, commandBuffer, firstViewport, viewportCount, pShadingRatePalettes); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewportShadingRatePaletteNV(dispatch, commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewportShadingRatePaletteNV(commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+      return DeviceOverrides::CmdSetViewportShadingRatePaletteNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstViewport, viewportCount, pShadingRatePalettes);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewportSwizzleNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportSwizzleNV *pViewportSwizzles) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewportSwizzleNV(dispatch, commandBuffer, firstViewport, viewportCount, pViewportSwizzles); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewportSwizzleNV(dispatch, commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewportSwizzleNV(commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+      return DeviceOverrides::CmdSetViewportSwizzleNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstViewport, viewportCount, pViewportSwizzles);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewportWScalingEnableNV(VkCommandBuffer commandBuffer, VkBool32 viewportWScalingEnable) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewportWScalingEnableNV(dispatch, commandBuffer, viewportWScalingEnable); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewportWScalingEnableNV(dispatch, commandBuffer, viewportWScalingEnable);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewportWScalingEnableNV(commandBuffer, viewportWScalingEnable);
+      return DeviceOverrides::CmdSetViewportWScalingEnableNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, viewportWScalingEnable);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewportWScalingNV(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, const VkViewportWScalingNV *pViewportWScalings) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewportWScalingNV(dispatch, commandBuffer, firstViewport, viewportCount, pViewportWScalings); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewportWScalingNV(dispatch, commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewportWScalingNV(commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+      return DeviceOverrides::CmdSetViewportWScalingNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, firstViewport, viewportCount, pViewportWScalings);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport *pViewports) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewportWithCount(dispatch, commandBuffer, viewportCount, pViewports); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewportWithCount(dispatch, commandBuffer, viewportCount, pViewports);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewportWithCount(commandBuffer, viewportCount, pViewports);
+      return DeviceOverrides::CmdSetViewportWithCount(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, viewportCount, pViewports);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSetViewportWithCountEXT(VkCommandBuffer commandBuffer, uint32_t viewportCount, const VkViewport *pViewports) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSetViewportWithCountEXT(dispatch, commandBuffer, viewportCount, pViewports); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSetViewportWithCountEXT(dispatch, commandBuffer, viewportCount, pViewports);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSetViewportWithCountEXT(commandBuffer, viewportCount, pViewports);
+      return DeviceOverrides::CmdSetViewportWithCountEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, viewportCount, pViewports);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdSubpassShadingHUAWEI(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdSubpassShadingHUAWEI(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdSubpassShadingHUAWEI(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdSubpassShadingHUAWEI(commandBuffer);
+      return DeviceOverrides::CmdSubpassShadingHUAWEI(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdTraceRaysIndirect2KHR(VkCommandBuffer commandBuffer, VkDeviceAddress indirectDeviceAddress) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdTraceRaysIndirect2KHR(dispatch, commandBuffer, indirectDeviceAddress); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdTraceRaysIndirect2KHR(dispatch, commandBuffer, indirectDeviceAddress);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdTraceRaysIndirect2KHR(commandBuffer, indirectDeviceAddress);
+      return DeviceOverrides::CmdTraceRaysIndirect2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, indirectDeviceAddress);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdTraceRaysIndirectKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable, VkDeviceAddress indirectDeviceAddress) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdTraceRaysIndirectKHR(dispatch, commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdTraceRaysIndirectKHR(dispatch, commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdTraceRaysIndirectKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+      return DeviceOverrides::CmdTraceRaysIndirectKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, indirectDeviceAddress);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdTraceRaysKHR(VkCommandBuffer commandBuffer, const VkStridedDeviceAddressRegionKHR *pRaygenShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pMissShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pHitShaderBindingTable, const VkStridedDeviceAddressRegionKHR *pCallableShaderBindingTable, uint32_t width, uint32_t height, uint32_t depth) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdTraceRaysKHR(dispatch, commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdTraceRaysKHR(dispatch, commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdTraceRaysKHR(commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+      return DeviceOverrides::CmdTraceRaysKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pRaygenShaderBindingTable, pMissShaderBindingTable, pHitShaderBindingTable, pCallableShaderBindingTable, width, height, depth);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdTraceRaysNV(VkCommandBuffer commandBuffer, VkBuffer raygenShaderBindingTableBuffer, VkDeviceSize raygenShaderBindingOffset, VkBuffer missShaderBindingTableBuffer, VkDeviceSize missShaderBindingOffset, VkDeviceSize missShaderBindingStride, VkBuffer hitShaderBindingTableBuffer, VkDeviceSize hitShaderBindingOffset, VkDeviceSize hitShaderBindingStride, VkBuffer callableShaderBindingTableBuffer, VkDeviceSize callableShaderBindingOffset, VkDeviceSize callableShaderBindingStride, uint32_t width, uint32_t height, uint32_t depth) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdTraceRaysNV(dispatch, commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdTraceRaysNV(dispatch, commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdTraceRaysNV(commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+      return DeviceOverrides::CmdTraceRaysNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, raygenShaderBindingTableBuffer, raygenShaderBindingOffset, missShaderBindingTableBuffer, missShaderBindingOffset, missShaderBindingStride, hitShaderBindingTableBuffer, hitShaderBindingOffset, hitShaderBindingStride, callableShaderBindingTableBuffer, callableShaderBindingOffset, callableShaderBindingStride, width, height, depth);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void *pData) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdUpdateBuffer(dispatch, commandBuffer, dstBuffer, dstOffset, dataSize, pData); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdUpdateBuffer(dispatch, commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdUpdateBuffer(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+      return DeviceOverrides::CmdUpdateBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, const VkMemoryBarrier *pMemoryBarriers, uint32_t bufferMemoryBarrierCount, const VkBufferMemoryBarrier *pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, const VkImageMemoryBarrier *pImageMemoryBarriers) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWaitEvents(dispatch, commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWaitEvents(dispatch, commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWaitEvents(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+      return DeviceOverrides::CmdWaitEvents(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents, const VkDependencyInfo *pDependencyInfos) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWaitEvents2(dispatch, commandBuffer, eventCount, pEvents, pDependencyInfos); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWaitEvents2(dispatch, commandBuffer, eventCount, pEvents, pDependencyInfos);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWaitEvents2(commandBuffer, eventCount, pEvents, pDependencyInfos);
+      return DeviceOverrides::CmdWaitEvents2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, eventCount, pEvents, pDependencyInfos);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWaitEvents2KHR(VkCommandBuffer commandBuffer, uint32_t eventCount, const VkEvent *pEvents, const VkDependencyInfo *pDependencyInfos) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWaitEvents2KHR(dispatch, commandBuffer, eventCount, pEvents, pDependencyInfos); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWaitEvents2KHR(dispatch, commandBuffer, eventCount, pEvents, pDependencyInfos);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWaitEvents2KHR(commandBuffer, eventCount, pEvents, pDependencyInfos);
+      return DeviceOverrides::CmdWaitEvents2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, eventCount, pEvents, pDependencyInfos);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteAccelerationStructuresPropertiesKHR(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR *pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteAccelerationStructuresPropertiesKHR(dispatch, commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteAccelerationStructuresPropertiesKHR(dispatch, commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteAccelerationStructuresPropertiesKHR(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+      return DeviceOverrides::CmdWriteAccelerationStructuresPropertiesKHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteAccelerationStructuresPropertiesNV(VkCommandBuffer commandBuffer, uint32_t accelerationStructureCount, const VkAccelerationStructureNV *pAccelerationStructures, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteAccelerationStructuresPropertiesNV(dispatch, commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteAccelerationStructuresPropertiesNV(dispatch, commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteAccelerationStructuresPropertiesNV(commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+      return DeviceOverrides::CmdWriteAccelerationStructuresPropertiesNV(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, accelerationStructureCount, pAccelerationStructures, queryType, queryPool, firstQuery);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteBufferMarker2AMD(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteBufferMarker2AMD(dispatch, commandBuffer, stage, dstBuffer, dstOffset, marker); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteBufferMarker2AMD(dispatch, commandBuffer, stage, dstBuffer, dstOffset, marker);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteBufferMarker2AMD(commandBuffer, stage, dstBuffer, dstOffset, marker);
+      return DeviceOverrides::CmdWriteBufferMarker2AMD(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stage, dstBuffer, dstOffset, marker);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteBufferMarkerAMD(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkBuffer dstBuffer, VkDeviceSize dstOffset, uint32_t marker) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteBufferMarkerAMD(dispatch, commandBuffer, pipelineStage, dstBuffer, dstOffset, marker); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteBufferMarkerAMD(dispatch, commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteBufferMarkerAMD(commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+      return DeviceOverrides::CmdWriteBufferMarkerAMD(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineStage, dstBuffer, dstOffset, marker);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteMicromapsPropertiesEXT(VkCommandBuffer commandBuffer, uint32_t micromapCount, const VkMicromapEXT *pMicromaps, VkQueryType queryType, VkQueryPool queryPool, uint32_t firstQuery) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteMicromapsPropertiesEXT(dispatch, commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteMicromapsPropertiesEXT(dispatch, commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteMicromapsPropertiesEXT(commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+      return DeviceOverrides::CmdWriteMicromapsPropertiesEXT(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, micromapCount, pMicromaps, queryType, queryPool, firstQuery);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteTimestamp(dispatch, commandBuffer, pipelineStage, queryPool, query); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteTimestamp(dispatch, commandBuffer, pipelineStage, queryPool, query);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteTimestamp(commandBuffer, pipelineStage, queryPool, query);
+      return DeviceOverrides::CmdWriteTimestamp(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, pipelineStage, queryPool, query);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteTimestamp2(dispatch, commandBuffer, stage, queryPool, query); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteTimestamp2(dispatch, commandBuffer, stage, queryPool, query);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteTimestamp2(commandBuffer, stage, queryPool, query);
+      return DeviceOverrides::CmdWriteTimestamp2(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stage, queryPool, query);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_CmdWriteTimestamp2KHR(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::CmdWriteTimestamp2KHR(dispatch, commandBuffer, stage, queryPool, query); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::CmdWriteTimestamp2KHR(dispatch, commandBuffer, stage, queryPool, query);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->CmdWriteTimestamp2KHR(commandBuffer, stage, queryPool, query);
+      return DeviceOverrides::CmdWriteTimestamp2KHR(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, stage, queryPool, query);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CompileDeferredNV(VkDevice device, VkPipeline pipeline, uint32_t shader) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CompileDeferredNV(dispatch, device, pipeline, shader);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CopyAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureInfoKHR *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CopyAccelerationStructureKHR(dispatch, device, deferredOperation, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CopyAccelerationStructureToMemoryKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyAccelerationStructureToMemoryInfoKHR *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CopyAccelerationStructureToMemoryKHR(dispatch, device, deferredOperation, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CopyMemoryToAccelerationStructureKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToAccelerationStructureInfoKHR *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CopyMemoryToAccelerationStructureKHR(dispatch, device, deferredOperation, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CopyMemoryToMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMemoryToMicromapInfoEXT *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CopyMemoryToMicromapEXT(dispatch, device, deferredOperation, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CopyMicromapEXT(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMicromapInfoEXT *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CopyMicromapEXT(dispatch, device, deferredOperation, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CopyMicromapToMemoryEXT(VkDevice device, VkDeferredOperationKHR deferredOperation, const VkCopyMicromapToMemoryInfoEXT *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CopyMicromapToMemoryEXT(dispatch, device, deferredOperation, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateAccelerationStructureKHR(VkDevice device, const VkAccelerationStructureCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkAccelerationStructureKHR *pAccelerationStructure) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateAccelerationStructureKHR(dispatch, device, pCreateInfo, pAllocator, pAccelerationStructure);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateAccelerationStructureNV(VkDevice device, const VkAccelerationStructureCreateInfoNV *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkAccelerationStructureNV *pAccelerationStructure) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateAccelerationStructureNV(dispatch, device, pCreateInfo, pAllocator, pAccelerationStructure);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateBuffer(VkDevice device, const VkBufferCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkBuffer *pBuffer) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateBuffer(dispatch, device, pCreateInfo, pAllocator, pBuffer);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateBufferCollectionFUCHSIA(VkDevice device, const VkBufferCollectionCreateInfoFUCHSIA *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkBufferCollectionFUCHSIA *pCollection) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateBufferCollectionFUCHSIA(dispatch, device, pCreateInfo, pAllocator, pCollection);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateBufferView(VkDevice device, const VkBufferViewCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkBufferView *pView) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateBufferView(dispatch, device, pCreateInfo, pAllocator, pView);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkCommandPool *pCommandPool) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateCommandPool(dispatch, device, pCreateInfo, pAllocator, pCommandPool);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkComputePipelineCreateInfo *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateComputePipelines(dispatch, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDeferredOperationKHR(VkDevice device, const VkAllocationCallbacks *pAllocator, VkDeferredOperationKHR *pDeferredOperation) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateDeferredOperationKHR(dispatch, device, pAllocator, pDeferredOperation);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDescriptorPool *pDescriptorPool) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateDescriptorPool(dispatch, device, pCreateInfo, pAllocator, pDescriptorPool);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDescriptorSetLayout(VkDevice device, const VkDescriptorSetLayoutCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDescriptorSetLayout *pSetLayout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateDescriptorSetLayout(dispatch, device, pCreateInfo, pAllocator, pSetLayout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDescriptorUpdateTemplate(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateDescriptorUpdateTemplate(dispatch, device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateDescriptorUpdateTemplateKHR(VkDevice device, const VkDescriptorUpdateTemplateCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkDescriptorUpdateTemplate *pDescriptorUpdateTemplate) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateDescriptorUpdateTemplateKHR(dispatch, device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateEvent(VkDevice device, const VkEventCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkEvent *pEvent) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateEvent(dispatch, device, pCreateInfo, pAllocator, pEvent);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateFence(VkDevice device, const VkFenceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkFence *pFence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateFence(dispatch, device, pCreateInfo, pAllocator, pFence);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateFramebuffer(VkDevice device, const VkFramebufferCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkFramebuffer *pFramebuffer) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateFramebuffer(dispatch, device, pCreateInfo, pAllocator, pFramebuffer);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkGraphicsPipelineCreateInfo *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateGraphicsPipelines(dispatch, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateImage(VkDevice device, const VkImageCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkImage *pImage) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateImage(dispatch, device, pCreateInfo, pAllocator, pImage);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateImageView(VkDevice device, const VkImageViewCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkImageView *pView) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateImageView(dispatch, device, pCreateInfo, pAllocator, pView);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateIndirectCommandsLayoutNV(VkDevice device, const VkIndirectCommandsLayoutCreateInfoNV *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkIndirectCommandsLayoutNV *pIndirectCommandsLayout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateIndirectCommandsLayoutNV(dispatch, device, pCreateInfo, pAllocator, pIndirectCommandsLayout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateMicromapEXT(VkDevice device, const VkMicromapCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkMicromapEXT *pMicromap) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateMicromapEXT(dispatch, device, pCreateInfo, pAllocator, pMicromap);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateOpticalFlowSessionNV(VkDevice device, const VkOpticalFlowSessionCreateInfoNV *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkOpticalFlowSessionNV *pSession) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateOpticalFlowSessionNV(dispatch, device, pCreateInfo, pAllocator, pSession);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreatePipelineCache(VkDevice device, const VkPipelineCacheCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkPipelineCache *pPipelineCache) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreatePipelineCache(dispatch, device, pCreateInfo, pAllocator, pPipelineCache);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreatePipelineLayout(VkDevice device, const VkPipelineLayoutCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkPipelineLayout *pPipelineLayout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreatePipelineLayout(dispatch, device, pCreateInfo, pAllocator, pPipelineLayout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreatePrivateDataSlot(VkDevice device, const VkPrivateDataSlotCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkPrivateDataSlot *pPrivateDataSlot) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreatePrivateDataSlot(dispatch, device, pCreateInfo, pAllocator, pPrivateDataSlot);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreatePrivateDataSlotEXT(VkDevice device, const VkPrivateDataSlotCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkPrivateDataSlot *pPrivateDataSlot) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreatePrivateDataSlotEXT(dispatch, device, pCreateInfo, pAllocator, pPrivateDataSlot);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateQueryPool(VkDevice device, const VkQueryPoolCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkQueryPool *pQueryPool) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateQueryPool(dispatch, device, pCreateInfo, pAllocator, pQueryPool);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateRayTracingPipelinesKHR(dispatch, device, deferredOperation, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateRayTracingPipelinesNV(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoNV *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateRayTracingPipelinesNV(dispatch, device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateRenderPass(dispatch, device, pCreateInfo, pAllocator, pRenderPass);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateRenderPass2(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateRenderPass2(dispatch, device, pCreateInfo, pAllocator, pRenderPass);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateRenderPass2KHR(VkDevice device, const VkRenderPassCreateInfo2 *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkRenderPass *pRenderPass) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateRenderPass2KHR(dispatch, device, pCreateInfo, pAllocator, pRenderPass);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateSampler(VkDevice device, const VkSamplerCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSampler *pSampler) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateSampler(dispatch, device, pCreateInfo, pAllocator, pSampler);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateSamplerYcbcrConversion(VkDevice device, const VkSamplerYcbcrConversionCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSamplerYcbcrConversion *pYcbcrConversion) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateSamplerYcbcrConversion(dispatch, device, pCreateInfo, pAllocator, pYcbcrConversion);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateSamplerYcbcrConversionKHR(VkDevice device, const VkSamplerYcbcrConversionCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSamplerYcbcrConversion *pYcbcrConversion) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateSamplerYcbcrConversionKHR(dispatch, device, pCreateInfo, pAllocator, pYcbcrConversion);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSemaphore *pSemaphore) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateSemaphore(dispatch, device, pCreateInfo, pAllocator, pSemaphore);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateShaderModule(dispatch, device, pCreateInfo, pAllocator, pShaderModule);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateShadersEXT(VkDevice device, uint32_t createInfoCount, const VkShaderCreateInfoEXT *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkShaderEXT *pShaders) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateShadersEXT(dispatch, device, createInfoCount, pCreateInfos, pAllocator, pShaders);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, const VkSwapchainCreateInfoKHR *pCreateInfos, const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchains) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateSharedSwapchainsKHR(dispatch, device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateSwapchainKHR(VkDevice device, const VkSwapchainCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkSwapchainKHR *pSwapchain) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateSwapchainKHR(dispatch, device, pCreateInfo, pAllocator, pSwapchain);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateValidationCacheEXT(VkDevice device, const VkValidationCacheCreateInfoEXT *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkValidationCacheEXT *pValidationCache) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateValidationCacheEXT(dispatch, device, pCreateInfo, pAllocator, pValidationCache);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateVideoSessionKHR(VkDevice device, const VkVideoSessionCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkVideoSessionKHR *pVideoSession) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateVideoSessionKHR(dispatch, device, pCreateInfo, pAllocator, pVideoSession);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_CreateVideoSessionParametersKHR(VkDevice device, const VkVideoSessionParametersCreateInfoKHR *pCreateInfo, const VkAllocationCallbacks *pAllocator, VkVideoSessionParametersKHR *pVideoSessionParameters) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::CreateVideoSessionParametersKHR(dispatch, device, pCreateInfo, pAllocator, pVideoSessionParameters);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_DebugMarkerSetObjectNameEXT(VkDevice device, const VkDebugMarkerObjectNameInfoEXT *pNameInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::DebugMarkerSetObjectNameEXT(dispatch, device, pNameInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_DebugMarkerSetObjectTagEXT(VkDevice device, const VkDebugMarkerObjectTagInfoEXT *pTagInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::DebugMarkerSetObjectTagEXT(dispatch, device, pTagInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_DeferredOperationJoinKHR(VkDevice device, VkDeferredOperationKHR operation) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::DeferredOperationJoinKHR(dispatch, device, operation);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyAccelerationStructureKHR(VkDevice device, VkAccelerationStructureKHR accelerationStructure, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyAccelerationStructureKHR(dispatch, device, accelerationStructure, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyAccelerationStructureNV(VkDevice device, VkAccelerationStructureNV accelerationStructure, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyAccelerationStructureNV(dispatch, device, accelerationStructure, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyBuffer(VkDevice device, VkBuffer buffer, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyBuffer(dispatch, device, buffer, pAllocator);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyBufferCollectionFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyBufferCollectionFUCHSIA(dispatch, device, collection, pAllocator);
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyBufferView(VkDevice device, VkBufferView bufferView, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyBufferView(dispatch, device, bufferView, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyCommandPool(VkDevice device, VkCommandPool commandPool, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    tables::UnregisterCommandPool(device, commandPool);
+    DeviceOverrides::DestroyCommandPool(dispatch, device, commandPool, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDeferredOperationKHR(VkDevice device, VkDeferredOperationKHR operation, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyDeferredOperationKHR(dispatch, device, operation, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyDescriptorPool(dispatch, device, descriptorPool, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyDescriptorSetLayout(dispatch, device, descriptorSetLayout, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyDescriptorUpdateTemplate(dispatch, device, descriptorUpdateTemplate, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDescriptorUpdateTemplateKHR(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyDescriptorUpdateTemplateKHR(dispatch, device, descriptorUpdateTemplate, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyDevice(dispatch, device, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyEvent(dispatch, device, event, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyFence(dispatch, device, fence, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyFramebuffer(dispatch, device, framebuffer, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyImage(VkDevice device, VkImage image, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyImage(dispatch, device, image, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyImageView(VkDevice device, VkImageView imageView, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyImageView(dispatch, device, imageView, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyIndirectCommandsLayoutNV(VkDevice device, VkIndirectCommandsLayoutNV indirectCommandsLayout, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyIndirectCommandsLayoutNV(dispatch, device, indirectCommandsLayout, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyMicromapEXT(VkDevice device, VkMicromapEXT micromap, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyMicromapEXT(dispatch, device, micromap, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyOpticalFlowSessionNV(VkDevice device, VkOpticalFlowSessionNV session, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyOpticalFlowSessionNV(dispatch, device, session, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyPipeline(dispatch, device, pipeline, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyPipelineCache(dispatch, device, pipelineCache, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyPipelineLayout(dispatch, device, pipelineLayout, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyPrivateDataSlot(dispatch, device, privateDataSlot, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyPrivateDataSlotEXT(VkDevice device, VkPrivateDataSlot privateDataSlot, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyPrivateDataSlotEXT(dispatch, device, privateDataSlot, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyQueryPool(dispatch, device, queryPool, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyRenderPass(dispatch, device, renderPass, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroySampler(dispatch, device, sampler, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroySamplerYcbcrConversion(dispatch, device, ycbcrConversion, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroySamplerYcbcrConversionKHR(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroySamplerYcbcrConversionKHR(dispatch, device, ycbcrConversion, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroySemaphore(dispatch, device, semaphore, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyShaderEXT(VkDevice device, VkShaderEXT shader, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyShaderEXT(dispatch, device, shader, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyShaderModule(VkDevice device, VkShaderModule shaderModule, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyShaderModule(dispatch, device, shaderModule, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroySwapchainKHR(dispatch, device, swapchain, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyValidationCacheEXT(VkDevice device, VkValidationCacheEXT validationCache, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyValidationCacheEXT(dispatch, device, validationCache, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyVideoSessionKHR(VkDevice device, VkVideoSessionKHR videoSession, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyVideoSessionKHR(dispatch, device, videoSession, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_DestroyVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::DestroyVideoSessionParametersKHR(dispatch, device, videoSessionParameters, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_DeviceWaitIdle(VkDevice device) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::DeviceWaitIdle(dispatch, device);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_DisplayPowerControlEXT(VkDevice device, VkDisplayKHR display, const VkDisplayPowerInfoEXT *pDisplayPowerInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::DisplayPowerControlEXT(dispatch, device, display, pDisplayPowerInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_EndCommandBuffer(VkCommandBuffer commandBuffer) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::EndCommandBuffer(dispatch, commandBuffer); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::EndCommandBuffer(dispatch, commandBuffer);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->EndCommandBuffer(commandBuffer);
+      return DeviceOverrides::EndCommandBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer);
+    }
+  }
+
+#ifdef VK_USE_PLATFORM_METAL_EXT
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_ExportMetalObjectsEXT(VkDevice device, VkExportMetalObjectsInfoEXT *pMetalObjectsInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::ExportMetalObjectsEXT(dispatch, device, pMetalObjectsInfo);
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_FlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange *pMemoryRanges) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::FlushMappedMemoryRanges(dispatch, device, memoryRangeCount, pMemoryRanges);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_FreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, const VkCommandBuffer *pCommandBuffers) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    tables::UnregisterCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+    DeviceOverrides::FreeCommandBuffers(dispatch, device, commandPool, commandBufferCount, pCommandBuffers);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_FreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, const VkDescriptorSet *pDescriptorSets) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::FreeDescriptorSets(dispatch, device, descriptorPool, descriptorSetCount, pDescriptorSets);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_FreeMemory(VkDevice device, VkDeviceMemory memory, const VkAllocationCallbacks *pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::FreeMemory(dispatch, device, memory, pAllocator);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetAccelerationStructureBuildSizesKHR(VkDevice device, VkAccelerationStructureBuildTypeKHR buildType, const VkAccelerationStructureBuildGeometryInfoKHR *pBuildInfo, const uint32_t *pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR *pSizeInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetAccelerationStructureBuildSizesKHR(dispatch, device, buildType, pBuildInfo, pMaxPrimitiveCounts, pSizeInfo);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkDeviceAddress wrap_GetAccelerationStructureDeviceAddressKHR(VkDevice device, const VkAccelerationStructureDeviceAddressInfoKHR *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkDeviceAddress ret = DeviceOverrides::GetAccelerationStructureDeviceAddressKHR(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetAccelerationStructureHandleNV(VkDevice device, VkAccelerationStructureNV accelerationStructure, size_t dataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetAccelerationStructureHandleNV(dispatch, device, accelerationStructure, dataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetAccelerationStructureMemoryRequirementsNV(VkDevice device, const VkAccelerationStructureMemoryRequirementsInfoNV *pInfo, VkMemoryRequirements2KHR *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetAccelerationStructureMemoryRequirementsNV(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetAccelerationStructureOpaqueCaptureDescriptorDataEXT(VkDevice device, const VkAccelerationStructureCaptureDescriptorDataInfoEXT *pInfo, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetAccelerationStructureOpaqueCaptureDescriptorDataEXT(dispatch, device, pInfo, pData);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetAndroidHardwareBufferPropertiesANDROID(VkDevice device, const struct AHardwareBuffer *buffer, VkAndroidHardwareBufferPropertiesANDROID *pProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetAndroidHardwareBufferPropertiesANDROID(dispatch, device, buffer, pProperties);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetBufferCollectionPropertiesFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, VkBufferCollectionPropertiesFUCHSIA *pProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetBufferCollectionPropertiesFUCHSIA(dispatch, device, collection, pProperties);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkDeviceAddress wrap_GetBufferDeviceAddress(VkDevice device, const VkBufferDeviceAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkDeviceAddress ret = DeviceOverrides::GetBufferDeviceAddress(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkDeviceAddress wrap_GetBufferDeviceAddressEXT(VkDevice device, const VkBufferDeviceAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkDeviceAddress ret = DeviceOverrides::GetBufferDeviceAddressEXT(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkDeviceAddress wrap_GetBufferDeviceAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkDeviceAddress ret = DeviceOverrides::GetBufferDeviceAddressKHR(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetBufferMemoryRequirements(dispatch, device, buffer, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetBufferMemoryRequirements2(VkDevice device, const VkBufferMemoryRequirementsInfo2 *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetBufferMemoryRequirements2(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetBufferMemoryRequirements2KHR(VkDevice device, const VkBufferMemoryRequirementsInfo2 *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetBufferMemoryRequirements2KHR(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline uint64_t wrap_GetBufferOpaqueCaptureAddress(VkDevice device, const VkBufferDeviceAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    uint64_t ret = DeviceOverrides::GetBufferOpaqueCaptureAddress(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline uint64_t wrap_GetBufferOpaqueCaptureAddressKHR(VkDevice device, const VkBufferDeviceAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    uint64_t ret = DeviceOverrides::GetBufferOpaqueCaptureAddressKHR(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetBufferOpaqueCaptureDescriptorDataEXT(VkDevice device, const VkBufferCaptureDescriptorDataInfoEXT *pInfo, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetBufferOpaqueCaptureDescriptorDataEXT(dispatch, device, pInfo, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetCalibratedTimestampsEXT(VkDevice device, uint32_t timestampCount, const VkCalibratedTimestampInfoEXT *pTimestampInfos, uint64_t *pTimestamps, uint64_t *pMaxDeviation) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetCalibratedTimestampsEXT(dispatch, device, timestampCount, pTimestampInfos, pTimestamps, pMaxDeviation);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline uint32_t wrap_GetDeferredOperationMaxConcurrencyKHR(VkDevice device, VkDeferredOperationKHR operation) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    uint32_t ret = DeviceOverrides::GetDeferredOperationMaxConcurrencyKHR(dispatch, device, operation);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDeferredOperationResultKHR(VkDevice device, VkDeferredOperationKHR operation) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDeferredOperationResultKHR(dispatch, device, operation);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorEXT(VkDevice device, const VkDescriptorGetInfoEXT *pDescriptorInfo, size_t dataSize, void *pDescriptor) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorEXT(dispatch, device, pDescriptorInfo, dataSize, pDescriptor);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorSetHostMappingVALVE(VkDevice device, VkDescriptorSet descriptorSet, void **ppData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorSetHostMappingVALVE(dispatch, device, descriptorSet, ppData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorSetLayoutBindingOffsetEXT(VkDevice device, VkDescriptorSetLayout layout, uint32_t binding, VkDeviceSize *pOffset) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorSetLayoutBindingOffsetEXT(dispatch, device, layout, binding, pOffset);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorSetLayoutHostMappingInfoVALVE(VkDevice device, const VkDescriptorSetBindingReferenceVALVE *pBindingReference, VkDescriptorSetLayoutHostMappingInfoVALVE *pHostMapping) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorSetLayoutHostMappingInfoVALVE(dispatch, device, pBindingReference, pHostMapping);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorSetLayoutSizeEXT(VkDevice device, VkDescriptorSetLayout layout, VkDeviceSize *pLayoutSizeInBytes) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorSetLayoutSizeEXT(dispatch, device, layout, pLayoutSizeInBytes);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorSetLayoutSupport(VkDevice device, const VkDescriptorSetLayoutCreateInfo *pCreateInfo, VkDescriptorSetLayoutSupport *pSupport) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorSetLayoutSupport(dispatch, device, pCreateInfo, pSupport);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDescriptorSetLayoutSupportKHR(VkDevice device, const VkDescriptorSetLayoutCreateInfo *pCreateInfo, VkDescriptorSetLayoutSupport *pSupport) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDescriptorSetLayoutSupportKHR(dispatch, device, pCreateInfo, pSupport);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceAccelerationStructureCompatibilityKHR(VkDevice device, const VkAccelerationStructureVersionInfoKHR *pVersionInfo, VkAccelerationStructureCompatibilityKHR *pCompatibility) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceAccelerationStructureCompatibilityKHR(dispatch, device, pVersionInfo, pCompatibility);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceBufferMemoryRequirements(VkDevice device, const VkDeviceBufferMemoryRequirements *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceBufferMemoryRequirements(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceBufferMemoryRequirementsKHR(VkDevice device, const VkDeviceBufferMemoryRequirements *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceBufferMemoryRequirementsKHR(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDeviceFaultInfoEXT(VkDevice device, VkDeviceFaultCountsEXT *pFaultCounts, VkDeviceFaultInfoEXT *pFaultInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDeviceFaultInfoEXT(dispatch, device, pFaultCounts, pFaultInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceGroupPeerMemoryFeatures(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags *pPeerMemoryFeatures) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceGroupPeerMemoryFeatures(dispatch, device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceGroupPeerMemoryFeaturesKHR(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags *pPeerMemoryFeatures) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceGroupPeerMemoryFeaturesKHR(dispatch, device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabilitiesKHR *pDeviceGroupPresentCapabilities) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDeviceGroupPresentCapabilitiesKHR(dispatch, device, pDeviceGroupPresentCapabilities);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDeviceGroupSurfacePresentModes2EXT(VkDevice device, const VkPhysicalDeviceSurfaceInfo2KHR *pSurfaceInfo, VkDeviceGroupPresentModeFlagsKHR *pModes) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDeviceGroupSurfacePresentModes2EXT(dispatch, device, pSurfaceInfo, pModes);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR *pModes) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDeviceGroupSurfacePresentModesKHR(dispatch, device, surface, pModes);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceImageMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceImageMemoryRequirements(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceImageMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirements *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceImageMemoryRequirementsKHR(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceImageSparseMemoryRequirements(VkDevice device, const VkDeviceImageMemoryRequirements *pInfo, uint32_t *pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceImageSparseMemoryRequirements(dispatch, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceImageSparseMemoryRequirementsKHR(VkDevice device, const VkDeviceImageMemoryRequirements *pInfo, uint32_t *pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceImageSparseMemoryRequirementsKHR(dispatch, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize *pCommittedMemoryInBytes) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceMemoryCommitment(dispatch, device, memory, pCommittedMemoryInBytes);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline uint64_t wrap_GetDeviceMemoryOpaqueCaptureAddress(VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    uint64_t ret = DeviceOverrides::GetDeviceMemoryOpaqueCaptureAddress(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline uint64_t wrap_GetDeviceMemoryOpaqueCaptureAddressKHR(VkDevice device, const VkDeviceMemoryOpaqueCaptureAddressInfo *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    uint64_t ret = DeviceOverrides::GetDeviceMemoryOpaqueCaptureAddressKHR(dispatch, device, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceMicromapCompatibilityEXT(VkDevice device, const VkMicromapVersionInfoEXT *pVersionInfo, VkAccelerationStructureCompatibilityKHR *pCompatibility) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceMicromapCompatibilityEXT(dispatch, device, pVersionInfo, pCompatibility);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue *pQueue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceQueue(dispatch, device, queueFamilyIndex, queueIndex, pQueue);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetDeviceQueue2(VkDevice device, const VkDeviceQueueInfo2 *pQueueInfo, VkQueue *pQueue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetDeviceQueue2(dispatch, device, pQueueInfo, pQueue);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(VkDevice device, VkRenderPass renderpass, VkExtent2D *pMaxWorkgroupSize) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDeviceSubpassShadingMaxWorkgroupSizeHUAWEI(dispatch, device, renderpass, pMaxWorkgroupSize);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetDynamicRenderingTilePropertiesQCOM(VkDevice device, const VkRenderingInfo *pRenderingInfo, VkTilePropertiesQCOM *pProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetDynamicRenderingTilePropertiesQCOM(dispatch, device, pRenderingInfo, pProperties);
+    return ret;
+  }
+
+#ifdef VK_ENABLE_BETA_EXTENSIONS
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetEncodedVideoSessionParametersKHR(VkDevice device, const VkVideoEncodeSessionParametersGetInfoKHR *pVideoSessionParametersInfo, VkVideoEncodeSessionParametersFeedbackInfoKHR *pFeedbackInfo, size_t *pDataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetEncodedVideoSessionParametersKHR(dispatch, device, pVideoSessionParametersInfo, pFeedbackInfo, pDataSize, pData);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetEventStatus(VkDevice device, VkEvent event) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetEventStatus(dispatch, device, event);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetFenceFdKHR(VkDevice device, const VkFenceGetFdInfoKHR *pGetFdInfo, int *pFd) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetFenceFdKHR(dispatch, device, pGetFdInfo, pFd);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetFenceStatus(VkDevice device, VkFence fence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetFenceStatus(dispatch, device, fence);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetFenceWin32HandleKHR(VkDevice device, const VkFenceGetWin32HandleInfoKHR *pGetWin32HandleInfo, HANDLE *pHandle) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetFenceWin32HandleKHR(dispatch, device, pGetWin32HandleInfo, pHandle);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetFramebufferTilePropertiesQCOM(VkDevice device, VkFramebuffer framebuffer, uint32_t *pPropertiesCount, VkTilePropertiesQCOM *pProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetFramebufferTilePropertiesQCOM(dispatch, device, framebuffer, pPropertiesCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetGeneratedCommandsMemoryRequirementsNV(VkDevice device, const VkGeneratedCommandsMemoryRequirementsInfoNV *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetGeneratedCommandsMemoryRequirementsNV(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetImageDrmFormatModifierPropertiesEXT(VkDevice device, VkImage image, VkImageDrmFormatModifierPropertiesEXT *pProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetImageDrmFormatModifierPropertiesEXT(dispatch, device, image, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageMemoryRequirements(dispatch, device, image, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageMemoryRequirements2(VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageMemoryRequirements2(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageMemoryRequirements2KHR(VkDevice device, const VkImageMemoryRequirementsInfo2 *pInfo, VkMemoryRequirements2 *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageMemoryRequirements2KHR(dispatch, device, pInfo, pMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetImageOpaqueCaptureDescriptorDataEXT(VkDevice device, const VkImageCaptureDescriptorDataInfoEXT *pInfo, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetImageOpaqueCaptureDescriptorDataEXT(dispatch, device, pInfo, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t *pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements *pSparseMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageSparseMemoryRequirements(dispatch, device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageSparseMemoryRequirements2(VkDevice device, const VkImageSparseMemoryRequirementsInfo2 *pInfo, uint32_t *pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageSparseMemoryRequirements2(dispatch, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageSparseMemoryRequirements2KHR(VkDevice device, const VkImageSparseMemoryRequirementsInfo2 *pInfo, uint32_t *pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2 *pSparseMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageSparseMemoryRequirements2KHR(dispatch, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageSubresourceLayout(VkDevice device, VkImage image, const VkImageSubresource *pSubresource, VkSubresourceLayout *pLayout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageSubresourceLayout(dispatch, device, image, pSubresource, pLayout);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetImageSubresourceLayout2EXT(VkDevice device, VkImage image, const VkImageSubresource2EXT *pSubresource, VkSubresourceLayout2EXT *pLayout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetImageSubresourceLayout2EXT(dispatch, device, image, pSubresource, pLayout);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetImageViewOpaqueCaptureDescriptorDataEXT(VkDevice device, const VkImageViewCaptureDescriptorDataInfoEXT *pInfo, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetImageViewOpaqueCaptureDescriptorDataEXT(dispatch, device, pInfo, pData);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_ANDROID_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryAndroidHardwareBufferANDROID(VkDevice device, const VkMemoryGetAndroidHardwareBufferInfoANDROID *pInfo, struct AHardwareBuffer **pBuffer) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryAndroidHardwareBufferANDROID(dispatch, device, pInfo, pBuffer);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryFdKHR(VkDevice device, const VkMemoryGetFdInfoKHR *pGetFdInfo, int *pFd) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryFdKHR(dispatch, device, pGetFdInfo, pFd);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR *pMemoryFdProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryFdPropertiesKHR(dispatch, device, handleType, fd, pMemoryFdProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryHostPointerPropertiesEXT(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, const void *pHostPointer, VkMemoryHostPointerPropertiesEXT *pMemoryHostPointerProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryHostPointerPropertiesEXT(dispatch, device, handleType, pHostPointer, pMemoryHostPointerProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryRemoteAddressNV(VkDevice device, const VkMemoryGetRemoteAddressInfoNV *pMemoryGetRemoteAddressInfo, VkRemoteAddressNV *pAddress) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryRemoteAddressNV(dispatch, device, pMemoryGetRemoteAddressInfo, pAddress);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryWin32HandleKHR(VkDevice device, const VkMemoryGetWin32HandleInfoKHR *pGetWin32HandleInfo, HANDLE *pHandle) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryWin32HandleKHR(dispatch, device, pGetWin32HandleInfo, pHandle);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryWin32HandleNV(VkDevice device, VkDeviceMemory memory, VkExternalMemoryHandleTypeFlagsNV handleType, HANDLE *pHandle) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryWin32HandleNV(dispatch, device, memory, handleType, pHandle);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryWin32HandlePropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, HANDLE handle, VkMemoryWin32HandlePropertiesKHR *pMemoryWin32HandleProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryWin32HandlePropertiesKHR(dispatch, device, handleType, handle, pMemoryWin32HandleProperties);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryZirconHandleFUCHSIA(VkDevice device, const VkMemoryGetZirconHandleInfoFUCHSIA *pGetZirconHandleInfo, zx_handle_t *pZirconHandle) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryZirconHandleFUCHSIA(dispatch, device, pGetZirconHandleInfo, pZirconHandle);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetMemoryZirconHandlePropertiesFUCHSIA(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, zx_handle_t zirconHandle, VkMemoryZirconHandlePropertiesFUCHSIA *pMemoryZirconHandleProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetMemoryZirconHandlePropertiesFUCHSIA(dispatch, device, handleType, zirconHandle, pMemoryZirconHandleProperties);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetMicromapBuildSizesEXT(VkDevice device, VkAccelerationStructureBuildTypeKHR buildType, const VkMicromapBuildInfoEXT *pBuildInfo, VkMicromapBuildSizesInfoEXT *pSizeInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetMicromapBuildSizesEXT(dispatch, device, buildType, pBuildInfo, pSizeInfo);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPastPresentationTimingGOOGLE(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pPresentationTimingCount, VkPastPresentationTimingGOOGLE *pPresentationTimings) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPastPresentationTimingGOOGLE(dispatch, device, swapchain, pPresentationTimingCount, pPresentationTimings);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPerformanceParameterINTEL(VkDevice device, VkPerformanceParameterTypeINTEL parameter, VkPerformanceValueINTEL *pValue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPerformanceParameterINTEL(dispatch, device, parameter, pValue);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t *pDataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPipelineCacheData(dispatch, device, pipelineCache, pDataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPipelineExecutableInternalRepresentationsKHR(VkDevice device, const VkPipelineExecutableInfoKHR *pExecutableInfo, uint32_t *pInternalRepresentationCount, VkPipelineExecutableInternalRepresentationKHR *pInternalRepresentations) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPipelineExecutableInternalRepresentationsKHR(dispatch, device, pExecutableInfo, pInternalRepresentationCount, pInternalRepresentations);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPipelineExecutablePropertiesKHR(VkDevice device, const VkPipelineInfoKHR *pPipelineInfo, uint32_t *pExecutableCount, VkPipelineExecutablePropertiesKHR *pProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPipelineExecutablePropertiesKHR(dispatch, device, pPipelineInfo, pExecutableCount, pProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPipelineExecutableStatisticsKHR(VkDevice device, const VkPipelineExecutableInfoKHR *pExecutableInfo, uint32_t *pStatisticCount, VkPipelineExecutableStatisticKHR *pStatistics) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPipelineExecutableStatisticsKHR(dispatch, device, pExecutableInfo, pStatisticCount, pStatistics);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetPipelinePropertiesEXT(VkDevice device, const VkPipelineInfoEXT *pPipelineInfo, VkBaseOutStructure *pPipelineProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetPipelinePropertiesEXT(dispatch, device, pPipelineInfo, pPipelineProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetPrivateData(dispatch, device, objectType, objectHandle, privateDataSlot, pData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetPrivateDataEXT(dispatch, device, objectType, objectHandle, privateDataSlot, pData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void *pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetQueryPoolResults(dispatch, device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetQueueCheckpointData2NV(VkQueue queue, uint32_t *pCheckpointDataCount, VkCheckpointData2NV *pCheckpointData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    DeviceOverrides::GetQueueCheckpointData2NV(dispatch, queue, pCheckpointDataCount, pCheckpointData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetQueueCheckpointDataNV(VkQueue queue, uint32_t *pCheckpointDataCount, VkCheckpointDataNV *pCheckpointData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    DeviceOverrides::GetQueueCheckpointDataNV(dispatch, queue, pCheckpointDataCount, pCheckpointData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetRayTracingCaptureReplayShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetRayTracingCaptureReplayShaderGroupHandlesKHR(dispatch, device, pipeline, firstGroup, groupCount, dataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetRayTracingShaderGroupHandlesKHR(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetRayTracingShaderGroupHandlesKHR(dispatch, device, pipeline, firstGroup, groupCount, dataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetRayTracingShaderGroupHandlesNV(VkDevice device, VkPipeline pipeline, uint32_t firstGroup, uint32_t groupCount, size_t dataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetRayTracingShaderGroupHandlesNV(dispatch, device, pipeline, firstGroup, groupCount, dataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkDeviceSize wrap_GetRayTracingShaderGroupStackSizeKHR(VkDevice device, VkPipeline pipeline, uint32_t group, VkShaderGroupShaderKHR groupShader) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkDeviceSize ret = DeviceOverrides::GetRayTracingShaderGroupStackSizeKHR(dispatch, device, pipeline, group, groupShader);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetRefreshCycleDurationGOOGLE(VkDevice device, VkSwapchainKHR swapchain, VkRefreshCycleDurationGOOGLE *pDisplayTimingProperties) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetRefreshCycleDurationGOOGLE(dispatch, device, swapchain, pDisplayTimingProperties);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D *pGranularity) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetRenderAreaGranularity(dispatch, device, renderPass, pGranularity);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSamplerOpaqueCaptureDescriptorDataEXT(VkDevice device, const VkSamplerCaptureDescriptorDataInfoEXT *pInfo, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSamplerOpaqueCaptureDescriptorDataEXT(dispatch, device, pInfo, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t *pValue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSemaphoreCounterValue(dispatch, device, semaphore, pValue);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSemaphoreCounterValueKHR(VkDevice device, VkSemaphore semaphore, uint64_t *pValue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSemaphoreCounterValueKHR(dispatch, device, semaphore, pValue);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSemaphoreFdKHR(VkDevice device, const VkSemaphoreGetFdInfoKHR *pGetFdInfo, int *pFd) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSemaphoreFdKHR(dispatch, device, pGetFdInfo, pFd);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSemaphoreWin32HandleKHR(VkDevice device, const VkSemaphoreGetWin32HandleInfoKHR *pGetWin32HandleInfo, HANDLE *pHandle) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSemaphoreWin32HandleKHR(dispatch, device, pGetWin32HandleInfo, pHandle);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSemaphoreZirconHandleFUCHSIA(VkDevice device, const VkSemaphoreGetZirconHandleInfoFUCHSIA *pGetZirconHandleInfo, zx_handle_t *pZirconHandle) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSemaphoreZirconHandleFUCHSIA(dispatch, device, pGetZirconHandleInfo, pZirconHandle);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetShaderBinaryDataEXT(VkDevice device, VkShaderEXT shader, size_t *pDataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetShaderBinaryDataEXT(dispatch, device, shader, pDataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetShaderInfoAMD(VkDevice device, VkPipeline pipeline, VkShaderStageFlagBits shaderStage, VkShaderInfoTypeAMD infoType, size_t *pInfoSize, void *pInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetShaderInfoAMD(dispatch, device, pipeline, shaderStage, infoType, pInfoSize, pInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetShaderModuleCreateInfoIdentifierEXT(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo, VkShaderModuleIdentifierEXT *pIdentifier) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetShaderModuleCreateInfoIdentifierEXT(dispatch, device, pCreateInfo, pIdentifier);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_GetShaderModuleIdentifierEXT(VkDevice device, VkShaderModule shaderModule, VkShaderModuleIdentifierEXT *pIdentifier) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::GetShaderModuleIdentifierEXT(dispatch, device, shaderModule, pIdentifier);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSwapchainCounterEXT(VkDevice device, VkSwapchainKHR swapchain, VkSurfaceCounterFlagBitsEXT counter, uint64_t *pCounterValue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSwapchainCounterEXT(dispatch, device, swapchain, counter, pCounterValue);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t *pSwapchainImageCount, VkImage *pSwapchainImages) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSwapchainImagesKHR(dispatch, device, swapchain, pSwapchainImageCount, pSwapchainImages);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetSwapchainStatusKHR(VkDevice device, VkSwapchainKHR swapchain) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetSwapchainStatusKHR(dispatch, device, swapchain);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetValidationCacheDataEXT(VkDevice device, VkValidationCacheEXT validationCache, size_t *pDataSize, void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetValidationCacheDataEXT(dispatch, device, validationCache, pDataSize, pData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_GetVideoSessionMemoryRequirementsKHR(VkDevice device, VkVideoSessionKHR videoSession, uint32_t *pMemoryRequirementsCount, VkVideoSessionMemoryRequirementsKHR *pMemoryRequirements) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::GetVideoSessionMemoryRequirementsKHR(dispatch, device, videoSession, pMemoryRequirementsCount, pMemoryRequirements);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ImportFenceFdKHR(VkDevice device, const VkImportFenceFdInfoKHR *pImportFenceFdInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ImportFenceFdKHR(dispatch, device, pImportFenceFdInfo);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ImportFenceWin32HandleKHR(VkDevice device, const VkImportFenceWin32HandleInfoKHR *pImportFenceWin32HandleInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ImportFenceWin32HandleKHR(dispatch, device, pImportFenceWin32HandleInfo);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ImportSemaphoreFdKHR(VkDevice device, const VkImportSemaphoreFdInfoKHR *pImportSemaphoreFdInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ImportSemaphoreFdKHR(dispatch, device, pImportSemaphoreFdInfo);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ImportSemaphoreWin32HandleKHR(VkDevice device, const VkImportSemaphoreWin32HandleInfoKHR *pImportSemaphoreWin32HandleInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ImportSemaphoreWin32HandleKHR(dispatch, device, pImportSemaphoreWin32HandleInfo);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ImportSemaphoreZirconHandleFUCHSIA(VkDevice device, const VkImportSemaphoreZirconHandleInfoFUCHSIA *pImportSemaphoreZirconHandleInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ImportSemaphoreZirconHandleFUCHSIA(dispatch, device, pImportSemaphoreZirconHandleInfo);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_InitializePerformanceApiINTEL(VkDevice device, const VkInitializePerformanceApiInfoINTEL *pInitializeInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::InitializePerformanceApiINTEL(dispatch, device, pInitializeInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_InvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, const VkMappedMemoryRange *pMemoryRanges) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::InvalidateMappedMemoryRanges(dispatch, device, memoryRangeCount, pMemoryRanges);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_MapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void **ppData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::MapMemory(dispatch, device, memory, offset, size, flags, ppData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_MapMemory2KHR(VkDevice device, const VkMemoryMapInfoKHR *pMemoryMapInfo, void **ppData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::MapMemory2KHR(dispatch, device, pMemoryMapInfo, ppData);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_MergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, const VkPipelineCache *pSrcCaches) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::MergePipelineCaches(dispatch, device, dstCache, srcCacheCount, pSrcCaches);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_MergeValidationCachesEXT(VkDevice device, VkValidationCacheEXT dstCache, uint32_t srcCacheCount, const VkValidationCacheEXT *pSrcCaches) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::MergeValidationCachesEXT(dispatch, device, dstCache, srcCacheCount, pSrcCaches);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_QueueBeginDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT *pLabelInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    DeviceOverrides::QueueBeginDebugUtilsLabelEXT(dispatch, queue, pLabelInfo);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueueBindSparse(VkQueue queue, uint32_t bindInfoCount, const VkBindSparseInfo *pBindInfo, VkFence fence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueueBindSparse(dispatch, queue, bindInfoCount, pBindInfo, fence);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_QueueEndDebugUtilsLabelEXT(VkQueue queue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    DeviceOverrides::QueueEndDebugUtilsLabelEXT(dispatch, queue);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_QueueInsertDebugUtilsLabelEXT(VkQueue queue, const VkDebugUtilsLabelEXT *pLabelInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    DeviceOverrides::QueueInsertDebugUtilsLabelEXT(dispatch, queue, pLabelInfo);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueuePresentKHR(VkQueue queue, const VkPresentInfoKHR *pPresentInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueuePresentKHR(dispatch, queue, pPresentInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueueSetPerformanceConfigurationINTEL(VkQueue queue, VkPerformanceConfigurationINTEL configuration) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueueSetPerformanceConfigurationINTEL(dispatch, queue, configuration);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueueSubmit(VkQueue queue, uint32_t submitCount, const VkSubmitInfo *pSubmits, VkFence fence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueueSubmit(dispatch, queue, submitCount, pSubmits, fence);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueueSubmit2(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueueSubmit2(dispatch, queue, submitCount, pSubmits, fence);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueueSubmit2KHR(VkQueue queue, uint32_t submitCount, const VkSubmitInfo2 *pSubmits, VkFence fence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueueSubmit2KHR(dispatch, queue, submitCount, pSubmits, fence);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_QueueWaitIdle(VkQueue queue) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(queue);
+    VkResult ret = DeviceOverrides::QueueWaitIdle(dispatch, queue);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_RegisterDeviceEventEXT(VkDevice device, const VkDeviceEventInfoEXT *pDeviceEventInfo, const VkAllocationCallbacks *pAllocator, VkFence *pFence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::RegisterDeviceEventEXT(dispatch, device, pDeviceEventInfo, pAllocator, pFence);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_RegisterDisplayEventEXT(VkDevice device, VkDisplayKHR display, const VkDisplayEventInfoEXT *pDisplayEventInfo, const VkAllocationCallbacks *pAllocator, VkFence *pFence) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::RegisterDisplayEventEXT(dispatch, device, display, pDisplayEventInfo, pAllocator, pFence);
+    return ret;
+  }
+
+#ifdef VK_USE_PLATFORM_WIN32_KHR
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ReleaseFullScreenExclusiveModeEXT(VkDevice device, VkSwapchainKHR swapchain) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ReleaseFullScreenExclusiveModeEXT(dispatch, device, swapchain);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ReleasePerformanceConfigurationINTEL(VkDevice device, VkPerformanceConfigurationINTEL configuration) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ReleasePerformanceConfigurationINTEL(dispatch, device, configuration);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_ReleaseProfilingLockKHR(VkDevice device) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::ReleaseProfilingLockKHR(dispatch, device);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ReleaseSwapchainImagesEXT(VkDevice device, const VkReleaseSwapchainImagesInfoEXT *pReleaseInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ReleaseSwapchainImagesEXT(dispatch, device, pReleaseInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+    if constexpr (requires (const VkDeviceDispatch* dispatch) { DeviceOverrides::ResetCommandBuffer(dispatch, commandBuffer, flags); }) {
+      const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(commandBuffer);
+      return DeviceOverrides::ResetCommandBuffer(dispatch, commandBuffer, flags);
+    } else {
+      const tables::VkCommandBufferEntry* entry = tables::LookupCommandBufferEntry(commandBuffer);
+      if (!entry) [[unlikely]]
+        return tables::LookupDeviceDispatch(commandBuffer)->ResetCommandBuffer(commandBuffer, flags);
+      return DeviceOverrides::ResetCommandBuffer(entry->dispatch, entry->CommandBufferState<typename DeviceOverrides::CommandBufferState>(), commandBuffer, flags);
+    }
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ResetCommandPool(dispatch, device, commandPool, flags);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ResetDescriptorPool(dispatch, device, descriptorPool, flags);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ResetEvent(VkDevice device, VkEvent event) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ResetEvent(dispatch, device, event);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_ResetFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::ResetFences(dispatch, device, fenceCount, pFences);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_ResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::ResetQueryPool(dispatch, device, queryPool, firstQuery, queryCount);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_ResetQueryPoolEXT(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::ResetQueryPoolEXT(dispatch, device, queryPool, firstQuery, queryCount);
+  }
+
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetBufferCollectionBufferConstraintsFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkBufferConstraintsInfoFUCHSIA *pBufferConstraintsInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetBufferCollectionBufferConstraintsFUCHSIA(dispatch, device, collection, pBufferConstraintsInfo);
+    return ret;
+  }
+
+#endif
+#ifdef VK_USE_PLATFORM_FUCHSIA
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetBufferCollectionImageConstraintsFUCHSIA(VkDevice device, VkBufferCollectionFUCHSIA collection, const VkImageConstraintsInfoFUCHSIA *pImageConstraintsInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetBufferCollectionImageConstraintsFUCHSIA(dispatch, device, collection, pImageConstraintsInfo);
+    return ret;
+  }
+
+#endif
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetDebugUtilsObjectNameEXT(VkDevice device, const VkDebugUtilsObjectNameInfoEXT *pNameInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetDebugUtilsObjectNameEXT(dispatch, device, pNameInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetDebugUtilsObjectTagEXT(VkDevice device, const VkDebugUtilsObjectTagInfoEXT *pTagInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetDebugUtilsObjectTagEXT(dispatch, device, pTagInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_SetDeviceMemoryPriorityEXT(VkDevice device, VkDeviceMemory memory, float priority) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::SetDeviceMemoryPriorityEXT(dispatch, device, memory, priority);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetEvent(VkDevice device, VkEvent event) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetEvent(dispatch, device, event);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_SetHdrMetadataEXT(VkDevice device, uint32_t swapchainCount, const VkSwapchainKHR *pSwapchains, const VkHdrMetadataEXT *pMetadata) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::SetHdrMetadataEXT(dispatch, device, swapchainCount, pSwapchains, pMetadata);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_SetLocalDimmingAMD(VkDevice device, VkSwapchainKHR swapChain, VkBool32 localDimmingEnable) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::SetLocalDimmingAMD(dispatch, device, swapChain, localDimmingEnable);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetPrivateData(dispatch, device, objectType, objectHandle, privateDataSlot, data);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SetPrivateDataEXT(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SetPrivateDataEXT(dispatch, device, objectType, objectHandle, privateDataSlot, data);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SignalSemaphore(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SignalSemaphore(dispatch, device, pSignalInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_SignalSemaphoreKHR(VkDevice device, const VkSemaphoreSignalInfo *pSignalInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::SignalSemaphoreKHR(dispatch, device, pSignalInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_TrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::TrimCommandPool(dispatch, device, commandPool, flags);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_TrimCommandPoolKHR(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::TrimCommandPoolKHR(dispatch, device, commandPool, flags);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_UninitializePerformanceApiINTEL(VkDevice device) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::UninitializePerformanceApiINTEL(dispatch, device);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_UnmapMemory(VkDevice device, VkDeviceMemory memory) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::UnmapMemory(dispatch, device, memory);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_UnmapMemory2KHR(VkDevice device, const VkMemoryUnmapInfoKHR *pMemoryUnmapInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::UnmapMemory2KHR(dispatch, device, pMemoryUnmapInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_UpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::UpdateDescriptorSetWithTemplate(dispatch, device, descriptorSet, descriptorUpdateTemplate, pData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_UpdateDescriptorSetWithTemplateKHR(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, const void *pData) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::UpdateDescriptorSetWithTemplateKHR(dispatch, device, descriptorSet, descriptorUpdateTemplate, pData);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void wrap_UpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, const VkWriteDescriptorSet *pDescriptorWrites, uint32_t descriptorCopyCount, const VkCopyDescriptorSet *pDescriptorCopies) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    DeviceOverrides::UpdateDescriptorSets(dispatch, device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_UpdateVideoSessionParametersKHR(VkDevice device, VkVideoSessionParametersKHR videoSessionParameters, const VkVideoSessionParametersUpdateInfoKHR *pUpdateInfo) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::UpdateVideoSessionParametersKHR(dispatch, device, videoSessionParameters, pUpdateInfo);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_WaitForFences(VkDevice device, uint32_t fenceCount, const VkFence *pFences, VkBool32 waitAll, uint64_t timeout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::WaitForFences(dispatch, device, fenceCount, pFences, waitAll, timeout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_WaitForPresentKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t presentId, uint64_t timeout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::WaitForPresentKHR(dispatch, device, swapchain, presentId, timeout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_WaitSemaphores(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::WaitSemaphores(dispatch, device, pWaitInfo, timeout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_WaitSemaphoresKHR(VkDevice device, const VkSemaphoreWaitInfo *pWaitInfo, uint64_t timeout) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::WaitSemaphoresKHR(dispatch, device, pWaitInfo, timeout);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_WriteAccelerationStructuresPropertiesKHR(VkDevice device, uint32_t accelerationStructureCount, const VkAccelerationStructureKHR *pAccelerationStructures, VkQueryType queryType, size_t dataSize, void *pData, size_t stride) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::WriteAccelerationStructuresPropertiesKHR(dispatch, device, accelerationStructureCount, pAccelerationStructures, queryType, dataSize, pData, stride);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult wrap_WriteMicromapsPropertiesEXT(VkDevice device, uint32_t micromapCount, const VkMicromapEXT *pMicromaps, VkQueryType queryType, size_t dataSize, void *pData, size_t stride) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = DeviceOverrides::WriteMicromapsPropertiesEXT(dispatch, device, micromapCount, pMicromaps, queryType, dataSize, pData, stride);
+    return ret;
+  }
+
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void implicit_wrap_DestroyDevice(
+          VkDevice               device,
+    const VkAllocationCallbacks* pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    // Implemented in the Dispatch class, goes to DestroyDeviceWrapper.
+    // Make sure we call ours here.
+    dispatch->DestroyDevice(device, pAllocator);
+  }
+
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline VkResult implicit_wrap_AllocateCommandBuffers(
+          VkDevice                     device,
+    const VkCommandBufferAllocateInfo* pAllocateInfo,
+          VkCommandBuffer*             pCommandBuffers) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    VkResult ret = dispatch->AllocateCommandBuffers(device, pAllocateInfo, pCommandBuffers);
+    if (ret == VK_SUCCESS)
+      tables::RegisterCommandBuffers(dispatch, tables::CommandBufferStateTypeOf<DeviceOverrides>(), pAllocateInfo, pCommandBuffers);
+    return ret;
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void implicit_wrap_FreeCommandBuffers(
+          VkDevice                     device,
+          VkCommandPool                commandPool,
+          uint32_t                     commandBufferCount,
+    const VkCommandBuffer*             pCommandBuffers) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    // Unregister first, the handles can be handed out again as soon as they're freed.
+    tables::UnregisterCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+    dispatch->FreeCommandBuffers(device, commandPool, commandBufferCount, pCommandBuffers);
+  }
+
+  template <typename InstanceOverrides, typename PhysicalDeviceOverrides, typename DeviceOverrides>
+  inline void implicit_wrap_DestroyCommandPool(
+          VkDevice                     device,
+          VkCommandPool                commandPool,
+    const VkAllocationCallbacks*       pAllocator) {
+    const VkDeviceDispatch* dispatch = tables::LookupDeviceDispatch(device);
+    // Destroying a pool frees every command buffer allocated from it.
+    tables::UnregisterCommandPool(device, commandPool);
+    dispatch->DestroyCommandPool(device, commandPool, pAllocator);
+  }
+}
+